@@ -0,0 +1,521 @@
+/**
+* BSP trees for static meshes
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "bsp.h"
+#include "mesh.h"
+
+// Points closer than this (in object space units) count as on the plane
+#define BSP_EPSILON (1.0 / 64.0)
+
+// Splitter choice: Try a few candidate faces, score each on a sample of the
+// faces to be split. Splitting a face is worse than a lopsided tree.
+#define BSP_CANDIDATES 32
+#define BSP_SCORE_SAMPLE 256
+#define BSP_SPLIT_COST 32
+
+// A tree only pays off if it doesn't split up the mesh too much: Every extra
+// face costs a transform and a triangle setup every frame, more than the
+// sort it saves. Meshes whose tree has more than this many times their
+// faces get sorted like any other.
+#define BSP_MAX_GROWTH 1.25
+
+// Trees are kept around for the lifetime of the program and shared by all
+// models using the same mesh. Rejected ones stay in there without geometry
+// or nodes, so they aren't built again. One per mesh file mesh_load can
+// keep, so those always fit; trees past that belong to their model.
+#define BSP_CACHE_SIZE MESH_MAX_FILES
+static bsp_tree_t* bsp_cache[BSP_CACHE_SIZE];
+static int32_t bsp_cache_count = 0;
+
+// Plane for build time, in floating point
+typedef struct {
+    double n[3];
+    double d;
+    int32_t valid;
+} bsp_plane_t;
+
+// Node during building: Plane, children and the list of faces in it
+typedef struct {
+    bsp_plane_t plane;
+    int32_t front;
+    int32_t back;
+    int32_t* faces;
+    int32_t num_faces;
+} bsp_build_node_t;
+
+// Build state: Growable copies of the mesh plus per face planes
+typedef struct {
+    vertex_t* vertices;
+    int32_t num_vertices;
+    int32_t max_vertices;
+
+    texcoord_t* texcoords;
+    int32_t num_texcoords;
+    int32_t max_texcoords;
+
+    face_t* faces;
+    bsp_plane_t* planes;
+    int32_t num_faces;
+    int32_t max_faces;
+
+    bsp_build_node_t* nodes;
+    int32_t num_nodes;
+    int32_t max_nodes;
+} bsp_build_t;
+
+// Face list waiting to be split up, and the node it belongs to
+typedef struct {
+    int32_t node;
+    int32_t* faces;
+    int32_t num_faces;
+} bsp_work_t;
+
+// Growable int list
+typedef struct {
+    int32_t* data;
+    int32_t count;
+    int32_t max;
+} bsp_list_t;
+
+static void list_push(bsp_list_t* list, int32_t val) {
+    if(list->count == list->max) {
+        list->max = list->max * 2 + 16;
+        list->data = (int32_t*)realloc(list->data, sizeof(int32_t) * list->max);
+    }
+    list->data[list->count++] = val;
+}
+
+static int32_t add_vertex(bsp_build_t* build, vertex_t vertex) {
+    if(build->num_vertices == build->max_vertices) {
+        build->max_vertices = build->max_vertices * 2 + 16;
+        build->vertices = (vertex_t*)realloc(build->vertices, sizeof(vertex_t) * build->max_vertices);
+    }
+    build->vertices[build->num_vertices] = vertex;
+    return build->num_vertices++;
+}
+
+static int32_t add_texcoord(bsp_build_t* build, texcoord_t texcoord) {
+    if(build->num_texcoords == build->max_texcoords) {
+        build->max_texcoords = build->max_texcoords * 2 + 16;
+        build->texcoords = (texcoord_t*)realloc(build->texcoords, sizeof(texcoord_t) * build->max_texcoords);
+    }
+    build->texcoords[build->num_texcoords] = texcoord;
+    return build->num_texcoords++;
+}
+
+static int32_t add_face(bsp_build_t* build, face_t face, bsp_plane_t plane) {
+    if(build->num_faces == build->max_faces) {
+        build->max_faces = build->max_faces * 2 + 16;
+        build->faces = (face_t*)realloc(build->faces, sizeof(face_t) * build->max_faces);
+        build->planes = (bsp_plane_t*)realloc(build->planes, sizeof(bsp_plane_t) * build->max_faces);
+    }
+    build->faces[build->num_faces] = face;
+    build->planes[build->num_faces] = plane;
+    return build->num_faces++;
+}
+
+static int32_t add_node(bsp_build_t* build) {
+    if(build->num_nodes == build->max_nodes) {
+        build->max_nodes = build->max_nodes * 2 + 16;
+        build->nodes = (bsp_build_node_t*)realloc(build->nodes, sizeof(bsp_build_node_t) * build->max_nodes);
+    }
+    memset(&build->nodes[build->num_nodes], 0, sizeof(bsp_build_node_t));
+    build->nodes[build->num_nodes].front = -1;
+    build->nodes[build->num_nodes].back = -1;
+    return build->num_nodes++;
+}
+
+static inline double vertex_coord(const bsp_build_t* build, int32_t vertex, int32_t axis) {
+    const vertex_t* v = &build->vertices[vertex];
+    return (axis == 0 ? v->x : (axis == 1 ? v->y : v->z)) / 4096.0;
+}
+
+static inline double plane_distance(const bsp_build_t* build, const bsp_plane_t* plane, int32_t vertex) {
+    return
+        plane->n[0] * vertex_coord(build, vertex, 0) +
+        plane->n[1] * vertex_coord(build, vertex, 1) +
+        plane->n[2] * vertex_coord(build, vertex, 2) - plane->d;
+}
+
+// Plane through a face, invalid for degenerate faces
+static bsp_plane_t face_plane(const bsp_build_t* build, const face_t* face) {
+    bsp_plane_t plane;
+    double p[3][3];
+    for(int i = 0; i < 3; i++) {
+        for(int axis = 0; axis < 3; axis++) {
+            p[i][axis] = vertex_coord(build, face->v[i], axis);
+        }
+    }
+
+    double a[3] = { p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2] };
+    double b[3] = { p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2] };
+    plane.n[0] = a[1] * b[2] - a[2] * b[1];
+    plane.n[1] = a[2] * b[0] - a[0] * b[2];
+    plane.n[2] = a[0] * b[1] - a[1] * b[0];
+
+    double len = sqrt(plane.n[0] * plane.n[0] + plane.n[1] * plane.n[1] + plane.n[2] * plane.n[2]);
+    plane.valid = len > 1e-9;
+    if(!plane.valid) {
+        plane.n[0] = 0.0;
+        plane.n[1] = 1.0;
+        plane.n[2] = 0.0;
+        len = 1.0;
+    }
+
+    for(int axis = 0; axis < 3; axis++) {
+        plane.n[axis] /= len;
+    }
+    plane.d = plane.n[0] * p[0][0] + plane.n[1] * p[0][1] + plane.n[2] * p[0][2];
+    return plane;
+}
+
+// Which side of the plane a face is on: 0 in plane, 1 front, 2 back, 3 both
+static int32_t classify_face(const bsp_build_t* build, const bsp_plane_t* plane, int32_t face, double* dist) {
+    int32_t side = 0;
+    for(int i = 0; i < 3; i++) {
+        dist[i] = plane_distance(build, plane, build->faces[face].v[i]);
+        if(dist[i] > BSP_EPSILON) {
+            side |= 1;
+        }
+        else if(dist[i] < -BSP_EPSILON) {
+            side |= 2;
+        }
+    }
+    return side;
+}
+
+// Pick the candidate plane that causes the fewest splits and keeps the tree
+// balanced. Returns -1 if no face has a usable plane.
+static int32_t choose_splitter(const bsp_build_t* build, const int32_t* faces, int32_t num_faces) {
+    int32_t num_candidates = num_faces < BSP_CANDIDATES ? num_faces : BSP_CANDIDATES;
+    int32_t stride = num_faces / BSP_SCORE_SAMPLE;
+    stride = stride < 1 ? 1 : stride;
+
+    int32_t best = -1;
+    int32_t best_score = 0;
+    for(int32_t c = 0; c < num_candidates; c++) {
+        int32_t candidate = faces[(int64_t)c * num_faces / num_candidates];
+        const bsp_plane_t* plane = &build->planes[candidate];
+        if(!plane->valid) {
+            continue;
+        }
+
+        int32_t counts[4] = { 0, 0, 0, 0 };
+        double dist[3];
+        for(int32_t i = 0; i < num_faces; i += stride) {
+            counts[classify_face(build, plane, faces[i], dist)]++;
+        }
+
+        int32_t score = counts[3] * BSP_SPLIT_COST + abs(counts[1] - counts[2]);
+        if(best == -1 || score < best_score) {
+            best = candidate;
+            best_score = score;
+        }
+    }
+
+    // All candidates degenerate? Take any face that is not
+    for(int32_t i = 0; i < num_faces && best == -1; i++) {
+        if(build->planes[faces[i]].valid) {
+            best = faces[i];
+        }
+    }
+    return best;
+}
+
+// Cut a face in two along the plane. On-plane vertices go to both halves,
+// edges that cross get a new vertex / texcoord. Halves are fan triangulated.
+static void split_face(bsp_build_t* build, int32_t face, const double* dist, bsp_list_t* front, bsp_list_t* back) {
+    face_t source = build->faces[face];
+    bsp_plane_t plane = build->planes[face];
+
+    int32_t front_v[4], front_t[4], num_front = 0;
+    int32_t back_v[4], back_t[4], num_back = 0;
+    for(int i = 0; i < 3; i++) {
+        int j = (i + 1) % 3;
+
+        if(dist[i] >= -BSP_EPSILON) {
+            front_v[num_front] = source.v[i];
+            front_t[num_front++] = source.v[i + 4];
+        }
+        if(dist[i] <= BSP_EPSILON) {
+            back_v[num_back] = source.v[i];
+            back_t[num_back++] = source.v[i + 4];
+        }
+
+        if((dist[i] > BSP_EPSILON && dist[j] < -BSP_EPSILON) || (dist[i] < -BSP_EPSILON && dist[j] > BSP_EPSILON)) {
+            double t = dist[i] / (dist[i] - dist[j]);
+
+            vertex_t va = build->vertices[source.v[i]];
+            vertex_t vb = build->vertices[source.v[j]];
+            int32_t vertex = add_vertex(build, ivec3(
+                va.x + (int32_t)lround((vb.x - va.x) * t),
+                va.y + (int32_t)lround((vb.y - va.y) * t),
+                va.z + (int32_t)lround((vb.z - va.z) * t)
+            ));
+
+            texcoord_t ta = build->texcoords[source.v[i + 4]];
+            texcoord_t tb = build->texcoords[source.v[j + 4]];
+            texcoord_t tc;
+            tc.u = ta.u + (int32_t)lround((tb.u - ta.u) * t);
+            tc.v = ta.v + (int32_t)lround((tb.v - ta.v) * t);
+            int32_t texcoord = add_texcoord(build, tc);
+
+            front_v[num_front] = vertex;
+            front_t[num_front++] = texcoord;
+            back_v[num_back] = vertex;
+            back_t[num_back++] = texcoord;
+        }
+    }
+
+    // Halves keep normal and texture and the plane of the original face
+    for(int32_t i = 1; i + 1 < num_front; i++) {
+        face_t half = source;
+        half.v[0] = front_v[0]; half.v[1] = front_v[i]; half.v[2] = front_v[i + 1];
+        half.v[4] = front_t[0]; half.v[5] = front_t[i]; half.v[6] = front_t[i + 1];
+        list_push(front, add_face(build, half, plane));
+    }
+    for(int32_t i = 1; i + 1 < num_back; i++) {
+        face_t half = source;
+        half.v[0] = back_v[0]; half.v[1] = back_v[i]; half.v[2] = back_v[i + 1];
+        half.v[4] = back_t[0]; half.v[5] = back_t[i]; half.v[6] = back_t[i + 1];
+        list_push(back, add_face(build, half, plane));
+    }
+}
+
+// Build the tree. Iterative, since trees for meshes made of many convex
+// pieces can get very deep.
+static bsp_tree_t* bsp_build(const model_t* model) {
+    bsp_build_t build;
+    memset(&build, 0, sizeof(bsp_build_t));
+
+    for(int32_t i = 0; i < model->num_vertices; i++) {
+        add_vertex(&build, model->vertices[i]);
+    }
+    for(int32_t i = 0; i < model->num_texcoords; i++) {
+        add_texcoord(&build, model->texcoords[i]);
+    }
+
+    bsp_list_t all = { 0, 0, 0 };
+    for(int32_t i = 0; i < model->num_faces; i++) {
+        add_face(&build, model->faces[i], face_plane(&build, &model->faces[i]));
+        list_push(&all, i);
+    }
+
+    bsp_work_t* work = 0;
+    int32_t num_work = 0;
+    int32_t max_work = 0;
+    if(all.count != 0) {
+        max_work = 16;
+        work = (bsp_work_t*)malloc(sizeof(bsp_work_t) * max_work);
+        work[num_work].node = add_node(&build);
+        work[num_work].faces = all.data;
+        work[num_work].num_faces = all.count;
+        num_work++;
+    }
+
+    while(num_work != 0) {
+        bsp_work_t item = work[--num_work];
+        bsp_build_node_t* node = &build.nodes[item.node];
+
+        // Nothing left to split with: All faces go into this node
+        int32_t splitter = choose_splitter(&build, item.faces, item.num_faces);
+        if(splitter == -1) {
+            node->plane = build.planes[item.faces[0]];
+            node->faces = item.faces;
+            node->num_faces = item.num_faces;
+            continue;
+        }
+        bsp_plane_t plane = build.planes[splitter];
+
+        bsp_list_t on = { 0, 0, 0 };
+        bsp_list_t front = { 0, 0, 0 };
+        bsp_list_t back = { 0, 0, 0 };
+        double dist[3];
+        for(int32_t i = 0; i < item.num_faces; i++) {
+            int32_t face = item.faces[i];
+            switch(classify_face(&build, &plane, face, dist)) {
+                case 0: list_push(&on, face); break;
+                case 1: list_push(&front, face); break;
+                case 2: list_push(&back, face); break;
+                default: split_face(&build, face, dist, &front, &back); break;
+            }
+        }
+        free(item.faces);
+
+        // Nodes may have moved when adding children
+        int32_t front_node = front.count != 0 ? add_node(&build) : -1;
+        int32_t back_node = back.count != 0 ? add_node(&build) : -1;
+        node = &build.nodes[item.node];
+        node->plane = plane;
+        node->faces = on.data;
+        node->num_faces = on.count;
+        node->front = front_node;
+        node->back = back_node;
+
+        if(num_work + 2 > max_work) {
+            max_work = max_work * 2 + 16;
+            work = (bsp_work_t*)realloc(work, sizeof(bsp_work_t) * max_work);
+        }
+        if(front_node != -1) {
+            work[num_work].node = front_node;
+            work[num_work].faces = front.data;
+            work[num_work].num_faces = front.count;
+            num_work++;
+        }
+        if(back_node != -1) {
+            work[num_work].node = back_node;
+            work[num_work].faces = back.data;
+            work[num_work].num_faces = back.count;
+            num_work++;
+        }
+    }
+    free(work);
+
+    // Flatten: Faces in node order, fixed point planes
+    bsp_tree_t* tree = (bsp_tree_t*)malloc(sizeof(bsp_tree_t));
+    tree->source = model->faces;
+    tree->num_nodes = build.num_nodes;
+    tree->nodes = (bsp_node_t*)malloc(sizeof(bsp_node_t) * (build.num_nodes + 1));
+    tree->stack = (int32_t*)malloc(sizeof(int32_t) * (2 * build.num_nodes + 1));
+
+    int32_t num_faces = 0;
+    for(int32_t i = 0; i < build.num_nodes; i++) {
+        num_faces += build.nodes[i].num_faces;
+    }
+    tree->num_faces = num_faces;
+    tree->faces = (face_t*)malloc(sizeof(face_t) * (num_faces + 1));
+
+    num_faces = 0;
+    for(int32_t i = 0; i < build.num_nodes; i++) {
+        bsp_build_node_t* node = &build.nodes[i];
+        tree->nodes[i].normal = ivec3(
+            FLOAT_FIXED(node->plane.n[0]),
+            FLOAT_FIXED(node->plane.n[1]),
+            FLOAT_FIXED(node->plane.n[2])
+        );
+        tree->nodes[i].dist = FLOAT_FIXED(node->plane.d);
+        tree->nodes[i].front = node->front;
+        tree->nodes[i].back = node->back;
+        tree->nodes[i].first_face = num_faces;
+        tree->nodes[i].num_faces = node->num_faces;
+
+        for(int32_t j = 0; j < node->num_faces; j++) {
+            tree->faces[num_faces++] = build.faces[node->faces[j]];
+        }
+        free(node->faces);
+    }
+
+    tree->vertices = build.vertices;
+    tree->num_vertices = build.num_vertices;
+    tree->texcoords = build.texcoords;
+    tree->num_texcoords = build.num_texcoords;
+
+    free(build.faces);
+    free(build.planes);
+    free(build.nodes);
+    return tree;
+}
+
+static int32_t bsp_cached(const bsp_tree_t* tree) {
+    for(int32_t i = 0; i < bsp_cache_count; i++) {
+        if(bsp_cache[i] == tree) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void bsp_free_geometry(bsp_tree_t* tree) {
+    free(tree->nodes);
+    free(tree->stack);
+    free(tree->vertices);
+    free(tree->texcoords);
+    free(tree->faces);
+}
+
+void bsp_compile_model(model_t* model) {
+    bsp_tree_t* tree = 0;
+    for(int32_t i = 0; i < bsp_cache_count; i++) {
+        if(bsp_cache[i]->source == model->faces || bsp_cache[i]->faces == model->faces) {
+            tree = bsp_cache[i];
+        }
+    }
+
+    if(tree == 0) {
+        tree = bsp_build(model);
+        if(tree->num_faces > model->num_faces * BSP_MAX_GROWTH) {
+            bsp_free_geometry(tree);
+            memset(tree, 0, sizeof(bsp_tree_t));
+            tree->source = model->faces;
+        }
+        if(bsp_cache_count < BSP_CACHE_SIZE) {
+            bsp_cache[bsp_cache_count++] = tree;
+        }
+        else if(tree->num_nodes == 0) {
+            free(tree);
+            return;
+        }
+    }
+    if(tree->num_nodes == 0) {
+        return;
+    }
+
+    model->bsp = tree;
+    model->vertices = tree->vertices;
+    model->texcoords = tree->texcoords;
+    model->faces = tree->faces;
+    model->num_vertices = tree->num_vertices;
+    model->num_texcoords = tree->num_texcoords;
+    model->num_faces = tree->num_faces;
+}
+
+void bsp_release_model(model_t* model) {
+    if(model->bsp != 0 && !bsp_cached(model->bsp)) {
+        bsp_free_geometry(model->bsp);
+        free(model->bsp);
+    }
+    model->bsp = 0;
+}
+
+int32_t bsp_traverse(bsp_tree_t* tree, ivec3_t eye, int32_t* order) {
+    if(tree->num_nodes == 0) {
+        return 0;
+    }
+
+    // Stack entries: Node to visit, or -(node + 1) to emit a nodes faces.
+    // Far side first, then the node, then the near side.
+    int32_t* stack = tree->stack;
+    int32_t top = 0;
+    int32_t count = 0;
+    stack[top++] = 0;
+    while(top != 0) {
+        int32_t node = stack[--top];
+        if(node < 0) {
+            order[count++] = -node - 1;
+            continue;
+        }
+
+        const bsp_node_t* n = &tree->nodes[node];
+        int64_t side =
+            (int64_t)n->normal.x * eye.x +
+            (int64_t)n->normal.y * eye.y +
+            (int64_t)n->normal.z * eye.z -
+            ((int64_t)n->dist << 12);
+
+        int32_t near_child = side >= 0 ? n->front : n->back;
+        int32_t far_child = side >= 0 ? n->back : n->front;
+        if(near_child != -1) {
+            stack[top++] = near_child;
+        }
+        stack[top++] = -node - 1;
+        if(far_child != -1) {
+            stack[top++] = far_child;
+        }
+    }
+    return count;
+}
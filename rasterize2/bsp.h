@@ -0,0 +1,56 @@
+/**
+* BSP trees for static meshes: Built once at load time, traversed every frame
+* to get an exact back-to-front face order without sorting
+*/
+
+#ifndef __BSP_H__
+#define __BSP_H__
+
+#include "rasterize.h"
+
+// A node: Splitting plane (normal . p = dist, object space), children (-1 if
+// empty) and the faces lying in the plane, as a range of the trees faces
+typedef struct {
+    ivec3_t normal;
+    int32_t dist;
+    int32_t front;
+    int32_t back;
+    int32_t first_face;
+    int32_t num_faces;
+} bsp_node_t;
+
+// The tree owns a copy of the mesh with faces split where they straddled a
+// plane and reordered so every nodes faces are contiguous. Root is node 0.
+struct bsp_tree {
+    const face_t* source;
+
+    bsp_node_t* nodes;
+    int32_t num_nodes;
+
+    vertex_t* vertices;
+    texcoord_t* texcoords;
+    face_t* faces;
+    int32_t num_vertices;
+    int32_t num_texcoords;
+    int32_t num_faces;
+
+    // Traversal scratch space
+    int32_t* stack;
+};
+
+// Build a tree for the models mesh (or reuse the one built for the same mesh
+// before) and point the model at the trees geometry. Only for meshes that
+// are moved rigidly, never deformed. If the tree would split the mesh up too
+// much, the model is left as it is, without a tree.
+void bsp_compile_model(model_t* model);
+
+// Free the models tree, unless it is shared through the cache. The model's
+// geometry pointers still point into the tree afterwards, so only for
+// models that are going away.
+void bsp_release_model(model_t* model);
+
+// Write node indices to order, back to front as seen from the object space
+// eye position. order needs room for num_nodes entries. Returns the count.
+int32_t bsp_traverse(bsp_tree_t* tree, ivec3_t eye, int32_t* order);
+
+#endif
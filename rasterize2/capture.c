@@ -0,0 +1,111 @@
+/**
+* Frame capture
+*
+* File layout: "CDFC", version (32 bit each), then the fields of
+* frame_capture_t in order, models only as many as there are. Values are
+* stored in the byte order of the machine capturing.
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include "capture.h"
+
+#define CAPTURE_MAGIC "CDFC"
+#define CAPTURE_VERSION 1
+
+void capture_frame(
+    frame_capture_t* capture, int32_t level, int32_t num_enemies, double frame_time,
+    const model_t* models, int32_t num_models, imat4x4_t camera, imat4x4_t projection,
+    const uint8_t* floor_texture, uint8_t sky_color
+) {
+    capture->level = level;
+    capture->num_enemies = num_enemies;
+    capture->frame_time = frame_time;
+    capture->camera = camera;
+    capture->projection = projection;
+
+    capture->num_models = imin(num_models, LEVEL_MAX_MODELS);
+    for(int32_t i = 0; i < capture->num_models; i++) {
+        capture->modelviews[i] = models[i].modelview;
+        capture->draw[i] = models[i].draw;
+        capture->num_faces[i] = models[i].num_faces;
+    }
+
+    memcpy(capture->floor_texture, floor_texture, TEX_SIZE * TEX_SIZE);
+    capture->sky_color = sky_color;
+}
+
+int32_t capture_write(const char* path, const frame_capture_t* capture) {
+    FILE* file = fopen(path, "wb");
+    if(file == 0) {
+        return 0;
+    }
+
+    uint32_t version = CAPTURE_VERSION;
+    int32_t count = capture->num_models;
+    fwrite(CAPTURE_MAGIC, 1, 4, file);
+    fwrite(&version, sizeof(uint32_t), 1, file);
+    fwrite(&capture->level, sizeof(int32_t), 1, file);
+    fwrite(&capture->num_enemies, sizeof(int32_t), 1, file);
+    fwrite(&capture->frame_time, sizeof(double), 1, file);
+    fwrite(&capture->camera, sizeof(imat4x4_t), 1, file);
+    fwrite(&capture->projection, sizeof(imat4x4_t), 1, file);
+    fwrite(&count, sizeof(int32_t), 1, file);
+    fwrite(capture->modelviews, sizeof(imat4x4_t), count, file);
+    fwrite(capture->draw, sizeof(int32_t), count, file);
+    fwrite(capture->num_faces, sizeof(int32_t), count, file);
+    fwrite(capture->floor_texture, 1, TEX_SIZE * TEX_SIZE, file);
+    fwrite(&capture->sky_color, 1, 1, file);
+    return fclose(file) == 0;
+}
+
+int32_t capture_read(const char* path, frame_capture_t* capture) {
+    FILE* file = fopen(path, "rb");
+    if(file == 0) {
+        return 0;
+    }
+
+    char magic[4];
+    uint32_t version;
+    int32_t count = 0;
+    int32_t ok =
+        fread(magic, 1, 4, file) == 4 && memcmp(magic, CAPTURE_MAGIC, 4) == 0 &&
+        fread(&version, sizeof(uint32_t), 1, file) == 1 && version == CAPTURE_VERSION &&
+        fread(&capture->level, sizeof(int32_t), 1, file) == 1 &&
+        fread(&capture->num_enemies, sizeof(int32_t), 1, file) == 1 &&
+        fread(&capture->frame_time, sizeof(double), 1, file) == 1 &&
+        fread(&capture->camera, sizeof(imat4x4_t), 1, file) == 1 &&
+        fread(&capture->projection, sizeof(imat4x4_t), 1, file) == 1 &&
+        fread(&count, sizeof(int32_t), 1, file) == 1 && count >= 0 && count <= LEVEL_MAX_MODELS &&
+        fread(capture->modelviews, sizeof(imat4x4_t), count, file) == (size_t)count &&
+        fread(capture->draw, sizeof(int32_t), count, file) == (size_t)count &&
+        fread(capture->num_faces, sizeof(int32_t), count, file) == (size_t)count &&
+        fread(capture->floor_texture, 1, TEX_SIZE * TEX_SIZE, file) == TEX_SIZE * TEX_SIZE &&
+        fread(&capture->sky_color, 1, 1, file) == 1;
+    fclose(file);
+
+    capture->num_models = ok ? count : 0;
+    return ok;
+}
+
+int32_t capture_apply(const frame_capture_t* capture, model_t* models, int32_t num_models) {
+    if(num_models != capture->num_models) {
+        return 0;
+    }
+    for(int32_t i = 0; i < num_models; i++) {
+        if(models[i].num_faces != capture->num_faces[i]) {
+            return 0;
+        }
+    }
+
+    for(int32_t i = 0; i < num_models; i++) {
+        models[i].modelview = capture->modelviews[i];
+        models[i].draw = capture->draw[i];
+    }
+    return 1;
+}
@@ -0,0 +1,50 @@
+/**
+* Frame capture: Everything rasterize() takes for one frame, written to a
+* small binary file and read back, so a slow frame can be drawn again
+* exactly, away from the game
+*/
+
+#ifndef __CAPTURE_H__
+#define __CAPTURE_H__
+
+#include <stdint.h>
+
+#include "rasterize.h"
+#include "levels.h"
+
+// Render inputs of one frame. Geometry is not stored, only which level (and
+// how many enemies after its static models) it came from, and per model the
+// face count, to check against when putting the transforms back.
+// frame_time is how long the frame took to draw, in seconds.
+typedef struct {
+    int32_t level;
+    int32_t num_enemies;
+    double frame_time;
+
+    imat4x4_t camera;
+    imat4x4_t projection;
+
+    int32_t num_models;
+    imat4x4_t modelviews[LEVEL_MAX_MODELS];
+    int32_t draw[LEVEL_MAX_MODELS];
+    int32_t num_faces[LEVEL_MAX_MODELS];
+
+    uint8_t floor_texture[TEX_SIZE * TEX_SIZE];
+    uint8_t sky_color;
+} frame_capture_t;
+
+void capture_frame(
+    frame_capture_t* capture, int32_t level, int32_t num_enemies, double frame_time,
+    const model_t* models, int32_t num_models, imat4x4_t camera, imat4x4_t projection,
+    const uint8_t* floor_texture, uint8_t sky_color
+);
+
+// 0 if the file can't be written, or read, or isn't a capture of this version
+int32_t capture_write(const char* path, const frame_capture_t* capture);
+int32_t capture_read(const char* path, frame_capture_t* capture);
+
+// Move and show / hide the models of a level loaded the same way as in the
+// capture. 0 if they don't match up.
+int32_t capture_apply(const frame_capture_t* capture, model_t* models, int32_t num_models);
+
+#endif
@@ -0,0 +1,289 @@
+/**
+* Depth sorting of faces by precomputed integer keys
+*/
+
+#include <string.h>
+
+#include "depthsort.h"
+#include "threads.h"
+
+// Three passes of 11 bits cover the whole 32 bit key, and 2048 entry
+// histograms still fit comfortably into L1
+#define RADIX_BITS 11
+#define RADIX_SIZE (1 << RADIX_BITS)
+#define RADIX_MASK (RADIX_SIZE - 1)
+#define RADIX_PASSES 3
+
+void depth_sort_radix(depth_key_t* keys, depth_key_t* tmp, int32_t count) {
+    if(count < 2) {
+        return;
+    }
+
+    uint32_t hist[RADIX_PASSES][RADIX_SIZE];
+    memset(hist, 0, sizeof(hist));
+
+    // All histograms in one go
+    for(int32_t i = 0; i < count; i++) {
+        uint32_t key = keys[i].key;
+        hist[0][key & RADIX_MASK]++;
+        hist[1][(key >> RADIX_BITS) & RADIX_MASK]++;
+        hist[2][key >> (2 * RADIX_BITS)]++;
+    }
+
+    depth_key_t* src = keys;
+    depth_key_t* dst = tmp;
+    for(int pass = 0; pass < RADIX_PASSES; pass++) {
+        int shift = pass * RADIX_BITS;
+
+        // Skip passes where every key has the same digit. Depth keys tend to
+        // only use the lower 24 or so bits, so the last pass usually goes.
+        if(hist[pass][(src[0].key >> shift) & RADIX_MASK] == (uint32_t)count) {
+            continue;
+        }
+
+        // Histogram to offsets
+        uint32_t sum = 0;
+        for(int i = 0; i < RADIX_SIZE; i++) {
+            uint32_t bucket = hist[pass][i];
+            hist[pass][i] = sum;
+            sum += bucket;
+        }
+
+        // Scatter
+        for(int32_t i = 0; i < count; i++) {
+            dst[hist[pass][(src[i].key >> shift) & RADIX_MASK]++] = src[i];
+        }
+
+        depth_key_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if(src != keys) {
+        memcpy(keys, src, sizeof(depth_key_t) * count);
+    }
+}
+
+int32_t depth_sort_insertion(depth_key_t* keys, int32_t count, int32_t max_moves) {
+    int32_t moves = 0;
+    for(int32_t i = 1; i < count; i++) {
+        // Common case: Already in place
+        if(keys[i - 1].key <= keys[i].key) {
+            continue;
+        }
+
+        depth_key_t cur = keys[i];
+        int32_t j = i;
+        while(j > 0 && keys[j - 1].key > cur.key) {
+            keys[j] = keys[j - 1];
+            j--;
+        }
+        keys[j] = cur;
+
+        moves += i - j;
+        if(moves > max_moves) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void depth_sort_merge(const depth_key_t* a, int32_t count_a, const depth_key_t* b, int32_t count_b, depth_key_t* out) {
+    int32_t i = 0;
+    int32_t j = 0;
+    while(i < count_a && j < count_b) {
+        if(b[j].key < a[i].key) {
+            *out++ = b[j++];
+        }
+        else {
+            *out++ = a[i++];
+        }
+    }
+    memcpy(out, &a[i], sizeof(depth_key_t) * (count_a - i));
+    out += count_a - i;
+    memcpy(out, &b[j], sizeof(depth_key_t) * (count_b - j));
+}
+
+// Parallel run sort: Runs get sorted independently, then the merged output
+// is cut into parts by key range so every part can be merged on its own
+#define MERGE_SAMPLES_PER_PART 32
+#define MERGE_MIN_PART_SIZE 4096
+#define MERGE_MAX_SAMPLES (2 * JOB_MAX_THREADS * MERGE_SAMPLES_PER_PART + DEPTH_SORT_MAX_RUNS)
+
+typedef struct {
+    depth_key_t* keys;
+    depth_key_t* tmp;
+    const int32_t* run_starts;
+    int32_t num_runs;
+    uint32_t sorted_runs;
+
+    // Where in every run each part begins, and where its output goes
+    int32_t num_parts;
+    int32_t part_starts[JOB_MAX_THREADS + 1][DEPTH_SORT_MAX_RUNS];
+    int32_t part_out[JOB_MAX_THREADS];
+} run_sort_job_t;
+
+static void sort_runs_task(void* data, int32_t first_run, int32_t end_run) {
+    run_sort_job_t* job = (run_sort_job_t*)data;
+    for(int32_t run = first_run; run < end_run; run++) {
+        if(job->sorted_runs & (1u << run)) {
+            continue;
+        }
+        int32_t start = job->run_starts[run];
+        int32_t count = job->run_starts[run + 1] - start;
+        depth_sort_radix(&job->keys[start], &job->tmp[start], count);
+    }
+}
+
+// Heap order for the merge: Lower key first, then lower run to keep it stable
+static inline int32_t merge_less(const depth_key_t* keys, const int32_t* pos, int32_t a, int32_t b) {
+    uint32_t key_a = keys[pos[a]].key;
+    uint32_t key_b = keys[pos[b]].key;
+    return key_a < key_b || (key_a == key_b && a < b);
+}
+
+static void merge_part(run_sort_job_t* job, int32_t part) {
+    const depth_key_t* keys = job->keys;
+    depth_key_t* out = &job->tmp[job->part_out[part]];
+
+    // Build a min-heap of the runs that have anything in this part
+    int32_t pos[DEPTH_SORT_MAX_RUNS];
+    int32_t end[DEPTH_SORT_MAX_RUNS];
+    int32_t heap[DEPTH_SORT_MAX_RUNS];
+    int32_t heap_size = 0;
+    for(int32_t r = 0; r < job->num_runs; r++) {
+        pos[r] = job->part_starts[part][r];
+        end[r] = job->part_starts[part + 1][r];
+        if(pos[r] == end[r]) {
+            continue;
+        }
+
+        int32_t i = heap_size++;
+        while(i > 0 && merge_less(keys, pos, r, heap[(i - 1) / 2])) {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = r;
+    }
+
+    // Pop the smallest, advance its run, sift down
+    while(heap_size > 1) {
+        int32_t r = heap[0];
+        *out++ = keys[pos[r]++];
+        if(pos[r] == end[r]) {
+            r = heap[--heap_size];
+        }
+
+        int32_t i = 0;
+        while(1) {
+            int32_t child = 2 * i + 1;
+            if(child >= heap_size) {
+                break;
+            }
+            if(child + 1 < heap_size && merge_less(keys, pos, heap[child + 1], heap[child])) {
+                child++;
+            }
+            if(!merge_less(keys, pos, heap[child], r)) {
+                break;
+            }
+            heap[i] = heap[child];
+            i = child;
+        }
+        heap[i] = r;
+    }
+
+    // Last run standing
+    if(heap_size == 1) {
+        int32_t r = heap[0];
+        memcpy(out, &keys[pos[r]], sizeof(depth_key_t) * (end[r] - pos[r]));
+    }
+}
+
+static void merge_parts_task(void* data, int32_t first_part, int32_t end_part) {
+    for(int32_t part = first_part; part < end_part; part++) {
+        merge_part((run_sort_job_t*)data, part);
+    }
+}
+
+// First position in keys[start, end) with a key >= key
+static int32_t lower_bound(const depth_key_t* keys, int32_t start, int32_t end, uint32_t key) {
+    while(start < end) {
+        int32_t mid = start + (end - start) / 2;
+        if(keys[mid].key < key) {
+            start = mid + 1;
+        }
+        else {
+            end = mid;
+        }
+    }
+    return start;
+}
+
+void depth_sort_runs(depth_key_t* keys, depth_key_t* tmp, const int32_t* run_starts, int32_t num_runs, uint32_t sorted_runs) {
+    int32_t first = run_starts[0];
+    int32_t count = run_starts[num_runs] - first;
+    if(num_runs == 1 && sorted_runs != 0) {
+        return;
+    }
+    if(num_runs <= 1 || num_runs > DEPTH_SORT_MAX_RUNS) {
+        depth_sort_radix(&keys[first], &tmp[first], count);
+        return;
+    }
+
+    run_sort_job_t job;
+    job.keys = keys;
+    job.tmp = tmp;
+    job.run_starts = run_starts;
+    job.num_runs = num_runs;
+    job.sorted_runs = sorted_runs;
+
+    // Sort runs
+    job_parallel_for(sort_runs_task, &job, num_runs, 1);
+
+    // Pick part boundaries from a sorted sample of keys, taken from every
+    // run in proportion to its size
+    int32_t num_parts = count / MERGE_MIN_PART_SIZE;
+    num_parts = num_parts > jobs_num_threads() ? jobs_num_threads() : num_parts;
+    num_parts = num_parts < 1 ? 1 : num_parts;
+
+    uint32_t samples[MERGE_MAX_SAMPLES];
+    int32_t num_samples = 0;
+    if(num_parts > 1) {
+        int32_t stride = count / (num_parts * MERGE_SAMPLES_PER_PART);
+        stride = stride < 1 ? 1 : stride;
+        for(int32_t r = 0; r < num_runs; r++) {
+            for(int32_t i = run_starts[r] + stride / 2; i < run_starts[r + 1] && num_samples < MERGE_MAX_SAMPLES; i += stride) {
+                // Insertion sort while sampling, there are only a few hundred
+                uint32_t key = keys[i].key;
+                int32_t j = num_samples++;
+                while(j > 0 && samples[j - 1] > key) {
+                    samples[j] = samples[j - 1];
+                    j--;
+                }
+                samples[j] = key;
+            }
+        }
+    }
+
+    job.num_parts = num_parts;
+    for(int32_t r = 0; r < num_runs; r++) {
+        job.part_starts[0][r] = run_starts[r];
+        job.part_starts[num_parts][r] = run_starts[r + 1];
+    }
+    for(int32_t part = 1; part < num_parts; part++) {
+        uint32_t split = samples[part * num_samples / num_parts];
+        for(int32_t r = 0; r < num_runs; r++) {
+            job.part_starts[part][r] = lower_bound(keys, run_starts[r], run_starts[r + 1], split);
+        }
+    }
+    for(int32_t part = 0; part < num_parts; part++) {
+        job.part_out[part] = first;
+        for(int32_t r = 0; r < num_runs; r++) {
+            job.part_out[part] += job.part_starts[part][r] - run_starts[r];
+        }
+    }
+
+    // Merge into tmp, then back
+    job_parallel_for(merge_parts_task, &job, num_parts, 1);
+    memcpy(&keys[first], &tmp[first], sizeof(depth_key_t) * count);
+}
@@ -0,0 +1,39 @@
+/**
+* Depth sorting of faces by precomputed integer keys
+*/
+
+#ifndef __DEPTHSORT_H__
+#define __DEPTHSORT_H__
+
+#include <stdint.h>
+
+// Sort key plus the face it belongs to. Smaller keys get drawn first.
+typedef struct {
+    uint32_t key;
+    int32_t face;
+} depth_key_t;
+
+// Stable LSD radix sort by key. tmp must have room for count entries.
+// Result ends up in keys.
+void depth_sort_radix(depth_key_t* keys, depth_key_t* tmp, int32_t count);
+
+// Insertion sort for keys that are already almost in order, e.g. last frames
+// draw order with fresh keys. Gives up once more than max_moves elements have
+// been shifted (plus at most count for the element in flight) and returns 0,
+// leaving keys permuted but not sorted. Returns 1 when keys are sorted.
+int32_t depth_sort_insertion(depth_key_t* keys, int32_t count, int32_t max_moves);
+
+// Merge two sorted runs into out, which must not overlap either. Stable,
+// entries from a go first on equal keys.
+void depth_sort_merge(const depth_key_t* a, int32_t count_a, const depth_key_t* b, int32_t count_b, depth_key_t* out);
+
+// Sort keys made up of num_runs runs (run r is [run_starts[r], run_starts[r + 1]))
+// by radix sorting every run on its own and then k-way merging them, both as
+// jobs. Equal keys keep their input order, so the result is the
+// same as depth_sort_radix over the whole array. tmp must be as large as keys.
+// Runs with their bit set in sorted_runs are already sorted by key and only
+// get merged.
+#define DEPTH_SORT_MAX_RUNS 32
+void depth_sort_runs(depth_key_t* keys, depth_key_t* tmp, const int32_t* run_starts, int32_t num_runs, uint32_t sorted_runs);
+
+#endif
@@ -1,2138 +0,0 @@
-/**
- * Model: enemy
- */
-
-#include "rasterize.h"
-
-#define NUM_VERTICES 282
-#define NUM_NORMALS 536
-#define NUM_TEXCOORDS 714
-#define NUM_FACES 560
-
-static vertex_t vertices[] = {
-    {FLOAT_FIXED(0), FLOAT_FIXED(-2.5), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(1.8090175), FLOAT_FIXED(-1.11805), FLOAT_FIXED(1.3143125)}, 
-    {FLOAT_FIXED(-0.69097), FLOAT_FIXED(-1.11805), FLOAT_FIXED(2.1266225)}, 
-    {FLOAT_FIXED(-2.236065), FLOAT_FIXED(-1.11804), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.69097), FLOAT_FIXED(-1.11805), FLOAT_FIXED(-2.1266225)}, 
-    {FLOAT_FIXED(1.8090175), FLOAT_FIXED(-1.11805), FLOAT_FIXED(-1.3143125)}, 
-    {FLOAT_FIXED(0.69097), FLOAT_FIXED(1.11805), FLOAT_FIXED(2.1266225)}, 
-    {FLOAT_FIXED(-1.8090175), FLOAT_FIXED(1.11805), FLOAT_FIXED(1.3143125)}, 
-    {FLOAT_FIXED(-1.8090175), FLOAT_FIXED(1.11805), FLOAT_FIXED(-1.3143125)}, 
-    {FLOAT_FIXED(0.69097), FLOAT_FIXED(1.11805), FLOAT_FIXED(-2.1266225)}, 
-    {FLOAT_FIXED(2.236065), FLOAT_FIXED(1.11804), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(2.5), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.40614), FLOAT_FIXED(-2.126635), FLOAT_FIXED(1.2499875)}, 
-    {FLOAT_FIXED(1.0633075), FLOAT_FIXED(-2.126635), FLOAT_FIXED(0.7725275)}, 
-    {FLOAT_FIXED(0.6571725), FLOAT_FIXED(-1.314345), FLOAT_FIXED(2.02253)}, 
-    {FLOAT_FIXED(2.12662), FLOAT_FIXED(-1.31434), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(1.0633075), FLOAT_FIXED(-2.126635), FLOAT_FIXED(-0.7725275)}, 
-    {FLOAT_FIXED(-1.314325), FLOAT_FIXED(-2.12663), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-1.7204725), FLOAT_FIXED(-1.31434), FLOAT_FIXED(1.2499925)}, 
-    {FLOAT_FIXED(-0.40614), FLOAT_FIXED(-2.126635), FLOAT_FIXED(-1.2499875)}, 
-    {FLOAT_FIXED(-1.7204725), FLOAT_FIXED(-1.31434), FLOAT_FIXED(-1.2499925)}, 
-    {FLOAT_FIXED(0.6571725), FLOAT_FIXED(-1.314345), FLOAT_FIXED(-2.02253)}, 
-    {FLOAT_FIXED(2.377645), FLOAT_FIXED(0), FLOAT_FIXED(0.7725325)}, 
-    {FLOAT_FIXED(2.377645), FLOAT_FIXED(0), FLOAT_FIXED(-0.7725325)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0), FLOAT_FIXED(2.5)}, 
-    {FLOAT_FIXED(1.469465), FLOAT_FIXED(0), FLOAT_FIXED(2.0225425)}, 
-    {FLOAT_FIXED(-2.377645), FLOAT_FIXED(0), FLOAT_FIXED(0.7725325)}, 
-    {FLOAT_FIXED(-1.469465), FLOAT_FIXED(0), FLOAT_FIXED(2.0225425)}, 
-    {FLOAT_FIXED(-1.469465), FLOAT_FIXED(0), FLOAT_FIXED(-2.0225425)}, 
-    {FLOAT_FIXED(-2.377645), FLOAT_FIXED(0), FLOAT_FIXED(-0.7725325)}, 
-    {FLOAT_FIXED(1.469465), FLOAT_FIXED(0), FLOAT_FIXED(-2.0225425)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0), FLOAT_FIXED(-2.5)}, 
-    {FLOAT_FIXED(1.7204725), FLOAT_FIXED(1.31434), FLOAT_FIXED(1.2499925)}, 
-    {FLOAT_FIXED(-0.6571725), FLOAT_FIXED(1.314345), FLOAT_FIXED(2.02253)}, 
-    {FLOAT_FIXED(-2.12662), FLOAT_FIXED(1.31434), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.6571725), FLOAT_FIXED(1.314345), FLOAT_FIXED(-2.02253)}, 
-    {FLOAT_FIXED(1.7204725), FLOAT_FIXED(1.31434), FLOAT_FIXED(-1.2499925)}, 
-    {FLOAT_FIXED(0.40614), FLOAT_FIXED(2.126635), FLOAT_FIXED(1.2499875)}, 
-    {FLOAT_FIXED(1.314325), FLOAT_FIXED(2.12663), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-1.0633075), FLOAT_FIXED(2.126635), FLOAT_FIXED(0.7725275)}, 
-    {FLOAT_FIXED(-1.0633075), FLOAT_FIXED(2.126635), FLOAT_FIXED(-0.7725275)}, 
-    {FLOAT_FIXED(0.40614), FLOAT_FIXED(2.126635), FLOAT_FIXED(-1.2499875)}, 
-    {FLOAT_FIXED(0.0564725), FLOAT_FIXED(-3.020445), FLOAT_FIXED(0.1738025)}, 
-    {FLOAT_FIXED(1.11978), FLOAT_FIXED(-2.64708), FLOAT_FIXED(0.94633)}, 
-    {FLOAT_FIXED(-0.349665), FLOAT_FIXED(-2.64708), FLOAT_FIXED(1.42379)}, 
-    {FLOAT_FIXED(2.19526), FLOAT_FIXED(-1.48304), FLOAT_FIXED(1.4621575)}, 
-    {FLOAT_FIXED(1.4495475), FLOAT_FIXED(-2.4916275), FLOAT_FIXED(0.920375)}, 
-    {FLOAT_FIXED(2.51286), FLOAT_FIXED(-1.67933), FLOAT_FIXED(0.147845)}, 
-    {FLOAT_FIXED(-0.1478475), FLOAT_FIXED(-3.020445), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(-0.553985), FLOAT_FIXED(-2.64708), FLOAT_FIXED(1.357405)}, 
-    {FLOAT_FIXED(-1.46217), FLOAT_FIXED(-2.6470725), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(-0.1478475), FLOAT_FIXED(-3.020445), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(-1.46217), FLOAT_FIXED(-2.6470725), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(-0.553985), FLOAT_FIXED(-2.64708), FLOAT_FIXED(-1.357405)}, 
-    {FLOAT_FIXED(0.0564725), FLOAT_FIXED(-3.020445), FLOAT_FIXED(-0.1738025)}, 
-    {FLOAT_FIXED(-0.349665), FLOAT_FIXED(-2.64708), FLOAT_FIXED(-1.42379)}, 
-    {FLOAT_FIXED(1.11978), FLOAT_FIXED(-2.64708), FLOAT_FIXED(-0.94633)}, 
-    {FLOAT_FIXED(2.3082075), FLOAT_FIXED(-1.3002875), FLOAT_FIXED(1.4621575)}, 
-    {FLOAT_FIXED(2.6258075), FLOAT_FIXED(-1.49658), FLOAT_FIXED(0.147845)}, 
-    {FLOAT_FIXED(2.8768325), FLOAT_FIXED(-0.18224), FLOAT_FIXED(0.9203775)}, 
-    {FLOAT_FIXED(-0.67732), FLOAT_FIXED(-1.30029), FLOAT_FIXED(2.6470675)}, 
-    {FLOAT_FIXED(0.6708225), FLOAT_FIXED(-1.496585), FLOAT_FIXED(2.5429725)}, 
-    {FLOAT_FIXED(0.01365), FLOAT_FIXED(-0.18224), FLOAT_FIXED(3.0204425)}, 
-    {FLOAT_FIXED(-2.72682), FLOAT_FIXED(-1.3002775), FLOAT_FIXED(0.173805)}, 
-    {FLOAT_FIXED(-2.2112275), FLOAT_FIXED(-1.49658), FLOAT_FIXED(1.4237975)}, 
-    {FLOAT_FIXED(-2.8683975), FLOAT_FIXED(-0.18224), FLOAT_FIXED(0.9463375)}, 
-    {FLOAT_FIXED(-1.0079175), FLOAT_FIXED(-1.30029), FLOAT_FIXED(-2.53965)}, 
-    {FLOAT_FIXED(-2.0374225), FLOAT_FIXED(-1.4965825), FLOAT_FIXED(-1.66302)}, 
-    {FLOAT_FIXED(-1.7864125), FLOAT_FIXED(-0.18224), FLOAT_FIXED(-2.4355675)}, 
-    {FLOAT_FIXED(2.1038875), FLOAT_FIXED(-1.30029), FLOAT_FIXED(-1.74338)}, 
-    {FLOAT_FIXED(0.9520425), FLOAT_FIXED(-1.496585), FLOAT_FIXED(-2.4515975)}, 
-    {FLOAT_FIXED(1.764335), FLOAT_FIXED(-0.18224), FLOAT_FIXED(-2.45161)}, 
-    {FLOAT_FIXED(2.251735), FLOAT_FIXED(-1.187345), FLOAT_FIXED(1.635965)}, 
-    {FLOAT_FIXED(2.82036), FLOAT_FIXED(-0.069295), FLOAT_FIXED(1.0941825)}, 
-    {FLOAT_FIXED(1.91218), FLOAT_FIXED(-0.069295), FLOAT_FIXED(2.3441925)}, 
-    {FLOAT_FIXED(-0.8600725), FLOAT_FIXED(-1.187345), FLOAT_FIXED(2.6470675)}, 
-    {FLOAT_FIXED(-0.1691025), FLOAT_FIXED(-0.0692975), FLOAT_FIXED(3.0204425)}, 
-    {FLOAT_FIXED(-1.6385675), FLOAT_FIXED(-0.0692975), FLOAT_FIXED(2.542985)}, 
-    {FLOAT_FIXED(-2.7832925), FLOAT_FIXED(-1.187335), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-2.92487), FLOAT_FIXED(-0.069295), FLOAT_FIXED(0.7725325)}, 
-    {FLOAT_FIXED(-2.92487), FLOAT_FIXED(-0.069295), FLOAT_FIXED(-0.7725325)}, 
-    {FLOAT_FIXED(-0.8600725), FLOAT_FIXED(-1.187345), FLOAT_FIXED(-2.6470675)}, 
-    {FLOAT_FIXED(-1.6385675), FLOAT_FIXED(-0.0692975), FLOAT_FIXED(-2.542985)}, 
-    {FLOAT_FIXED(-0.1691025), FLOAT_FIXED(-0.0692975), FLOAT_FIXED(-3.0204425)}, 
-    {FLOAT_FIXED(2.251735), FLOAT_FIXED(-1.187345), FLOAT_FIXED(-1.635965)}, 
-    {FLOAT_FIXED(1.91218), FLOAT_FIXED(-0.069295), FLOAT_FIXED(-2.3441925)}, 
-    {FLOAT_FIXED(2.82036), FLOAT_FIXED(-0.069295), FLOAT_FIXED(-1.0941825)}, 
-    {FLOAT_FIXED(0.9165425), FLOAT_FIXED(1.48304), FLOAT_FIXED(2.47326)}, 
-    {FLOAT_FIXED(1.9460475), FLOAT_FIXED(1.67933), FLOAT_FIXED(1.59663)}, 
-    {FLOAT_FIXED(0.6317125), FLOAT_FIXED(2.4916275), FLOAT_FIXED(1.596625)}, 
-    {FLOAT_FIXED(-2.068985), FLOAT_FIXED(1.48304), FLOAT_FIXED(1.6359625)}, 
-    {FLOAT_FIXED(-0.91714), FLOAT_FIXED(1.679335), FLOAT_FIXED(2.3441775)}, 
-    {FLOAT_FIXED(-1.323275), FLOAT_FIXED(2.491625), FLOAT_FIXED(1.0941775)}, 
-    {FLOAT_FIXED(-2.19526), FLOAT_FIXED(1.48304), FLOAT_FIXED(-1.4621575)}, 
-    {FLOAT_FIXED(-2.51286), FLOAT_FIXED(1.67933), FLOAT_FIXED(-0.147845)}, 
-    {FLOAT_FIXED(-1.4495475), FLOAT_FIXED(2.4916275), FLOAT_FIXED(-0.920375)}, 
-    {FLOAT_FIXED(0.7122225), FLOAT_FIXED(1.48304), FLOAT_FIXED(-2.5396475)}, 
-    {FLOAT_FIXED(-0.63592), FLOAT_FIXED(1.679335), FLOAT_FIXED(-2.4355525)}, 
-    {FLOAT_FIXED(0.4273925), FLOAT_FIXED(2.4916275), FLOAT_FIXED(-1.6630125)}, 
-    {FLOAT_FIXED(2.635445), FLOAT_FIXED(1.4830275), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(2.1198525), FLOAT_FIXED(1.67933), FLOAT_FIXED(-1.3574075)}, 
-    {FLOAT_FIXED(1.7137025), FLOAT_FIXED(2.4916175), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(1.46217), FLOAT_FIXED(2.6470725), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(0.553985), FLOAT_FIXED(2.64708), FLOAT_FIXED(-1.357405)}, 
-    {FLOAT_FIXED(0.1478475), FLOAT_FIXED(3.020445), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(1.585225), FLOAT_FIXED(2.56496), FLOAT_FIXED(-0.1968225)}, 
-    {FLOAT_FIXED(1.9913725), FLOAT_FIXED(1.75267), FLOAT_FIXED(-1.4468125)}, 
-    {FLOAT_FIXED(0.6770375), FLOAT_FIXED(2.5649675), FLOAT_FIXED(-1.44681)}, 
-    {FLOAT_FIXED(1.9460475), FLOAT_FIXED(1.67933), FLOAT_FIXED(-1.59663)}, 
-    {FLOAT_FIXED(0.9165425), FLOAT_FIXED(1.48304), FLOAT_FIXED(-2.47326)}, 
-    {FLOAT_FIXED(0.6317125), FLOAT_FIXED(2.4916275), FLOAT_FIXED(-1.596625)}, 
-    {FLOAT_FIXED(0.349665), FLOAT_FIXED(2.64708), FLOAT_FIXED(-1.42379)}, 
-    {FLOAT_FIXED(-1.11978), FLOAT_FIXED(2.64708), FLOAT_FIXED(-0.94633)}, 
-    {FLOAT_FIXED(-0.0564725), FLOAT_FIXED(3.020445), FLOAT_FIXED(-0.1738025)}, 
-    {FLOAT_FIXED(0.3026625), FLOAT_FIXED(2.5649675), FLOAT_FIXED(-1.56845)}, 
-    {FLOAT_FIXED(-0.7606475), FLOAT_FIXED(1.752675), FLOAT_FIXED(-2.34099)}, 
-    {FLOAT_FIXED(-1.1667825), FLOAT_FIXED(2.564965), FLOAT_FIXED(-1.09099)}, 
-    {FLOAT_FIXED(-0.91714), FLOAT_FIXED(1.679335), FLOAT_FIXED(-2.3441775)}, 
-    {FLOAT_FIXED(-2.068985), FLOAT_FIXED(1.48304), FLOAT_FIXED(-1.6359625)}, 
-    {FLOAT_FIXED(-1.323275), FLOAT_FIXED(2.491625), FLOAT_FIXED(-1.0941775)}, 
-    {FLOAT_FIXED(-1.2460525), FLOAT_FIXED(2.64708), FLOAT_FIXED(-0.7725275)}, 
-    {FLOAT_FIXED(-1.2460525), FLOAT_FIXED(2.64708), FLOAT_FIXED(0.7725275)}, 
-    {FLOAT_FIXED(-0.1827475), FLOAT_FIXED(3.020445), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-1.39816), FLOAT_FIXED(2.564965), FLOAT_FIXED(-0.7725275)}, 
-    {FLOAT_FIXED(-2.4614725), FLOAT_FIXED(1.75267), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-1.39816), FLOAT_FIXED(2.564965), FLOAT_FIXED(0.7725275)}, 
-    {FLOAT_FIXED(-2.51286), FLOAT_FIXED(1.67933), FLOAT_FIXED(0.147845)}, 
-    {FLOAT_FIXED(-2.19526), FLOAT_FIXED(1.48304), FLOAT_FIXED(1.4621575)}, 
-    {FLOAT_FIXED(-1.4495475), FLOAT_FIXED(2.4916275), FLOAT_FIXED(0.920375)}, 
-    {FLOAT_FIXED(-1.11978), FLOAT_FIXED(2.64708), FLOAT_FIXED(0.94633)}, 
-    {FLOAT_FIXED(0.349665), FLOAT_FIXED(2.64708), FLOAT_FIXED(1.42379)}, 
-    {FLOAT_FIXED(-0.0564725), FLOAT_FIXED(3.020445), FLOAT_FIXED(0.1738025)}, 
-    {FLOAT_FIXED(-1.1667825), FLOAT_FIXED(2.564965), FLOAT_FIXED(1.09099)}, 
-    {FLOAT_FIXED(-0.7606475), FLOAT_FIXED(1.752675), FLOAT_FIXED(2.34099)}, 
-    {FLOAT_FIXED(0.3026625), FLOAT_FIXED(2.5649675), FLOAT_FIXED(1.56845)}, 
-    {FLOAT_FIXED(-0.63592), FLOAT_FIXED(1.679335), FLOAT_FIXED(2.4355525)}, 
-    {FLOAT_FIXED(0.7122225), FLOAT_FIXED(1.48304), FLOAT_FIXED(2.5396475)}, 
-    {FLOAT_FIXED(0.4273925), FLOAT_FIXED(2.4916275), FLOAT_FIXED(1.6630125)}, 
-    {FLOAT_FIXED(0.553985), FLOAT_FIXED(2.64708), FLOAT_FIXED(1.357405)}, 
-    {FLOAT_FIXED(1.46217), FLOAT_FIXED(2.6470725), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(0.1478475), FLOAT_FIXED(3.020445), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(0.6770375), FLOAT_FIXED(2.5649675), FLOAT_FIXED(1.44681)}, 
-    {FLOAT_FIXED(1.9913725), FLOAT_FIXED(1.75267), FLOAT_FIXED(1.4468125)}, 
-    {FLOAT_FIXED(1.585225), FLOAT_FIXED(2.56496), FLOAT_FIXED(0.1968225)}, 
-    {FLOAT_FIXED(2.1198525), FLOAT_FIXED(1.67933), FLOAT_FIXED(1.3574075)}, 
-    {FLOAT_FIXED(2.635445), FLOAT_FIXED(1.4830275), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(1.7137025), FLOAT_FIXED(2.4916175), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(2.8683975), FLOAT_FIXED(0.18224), FLOAT_FIXED(-0.9463375)}, 
-    {FLOAT_FIXED(2.2112275), FLOAT_FIXED(1.49658), FLOAT_FIXED(-1.4237975)}, 
-    {FLOAT_FIXED(2.72682), FLOAT_FIXED(1.3002775), FLOAT_FIXED(-0.173805)}, 
-    {FLOAT_FIXED(2.815975), FLOAT_FIXED(0.1034775), FLOAT_FIXED(-1.090995)}, 
-    {FLOAT_FIXED(1.9077925), FLOAT_FIXED(0.1034775), FLOAT_FIXED(-2.341005)}, 
-    {FLOAT_FIXED(2.1588025), FLOAT_FIXED(1.4178175), FLOAT_FIXED(-1.568455)}, 
-    {FLOAT_FIXED(1.7864125), FLOAT_FIXED(0.18224), FLOAT_FIXED(-2.4355675)}, 
-    {FLOAT_FIXED(1.0079175), FLOAT_FIXED(1.30029), FLOAT_FIXED(-2.53965)}, 
-    {FLOAT_FIXED(2.0374225), FLOAT_FIXED(1.4965825), FLOAT_FIXED(-1.66302)}, 
-    {FLOAT_FIXED(-0.01365), FLOAT_FIXED(0.18224), FLOAT_FIXED(-3.0204425)}, 
-    {FLOAT_FIXED(-0.6708225), FLOAT_FIXED(1.496585), FLOAT_FIXED(-2.5429725)}, 
-    {FLOAT_FIXED(0.67732), FLOAT_FIXED(1.30029), FLOAT_FIXED(-2.6470675)}, 
-    {FLOAT_FIXED(-0.1674275), FLOAT_FIXED(0.1034775), FLOAT_FIXED(-3.015285)}, 
-    {FLOAT_FIXED(-1.63689), FLOAT_FIXED(0.1034775), FLOAT_FIXED(-2.5378275)}, 
-    {FLOAT_FIXED(-0.8245975), FLOAT_FIXED(1.4178225), FLOAT_FIXED(-2.537815)}, 
-    {FLOAT_FIXED(-1.764335), FLOAT_FIXED(0.18224), FLOAT_FIXED(-2.45161)}, 
-    {FLOAT_FIXED(-2.1038875), FLOAT_FIXED(1.30029), FLOAT_FIXED(-1.74338)}, 
-    {FLOAT_FIXED(-0.9520425), FLOAT_FIXED(1.496585), FLOAT_FIXED(-2.4515975)}, 
-    {FLOAT_FIXED(-2.8768325), FLOAT_FIXED(0.18224), FLOAT_FIXED(-0.9203775)}, 
-    {FLOAT_FIXED(-2.6258075), FLOAT_FIXED(1.49658), FLOAT_FIXED(-0.147845)}, 
-    {FLOAT_FIXED(-2.3082075), FLOAT_FIXED(1.3002875), FLOAT_FIXED(-1.4621575)}, 
-    {FLOAT_FIXED(-2.9194475), FLOAT_FIXED(0.1034775), FLOAT_FIXED(-0.7725325)}, 
-    {FLOAT_FIXED(-2.9194475), FLOAT_FIXED(0.1034775), FLOAT_FIXED(0.7725325)}, 
-    {FLOAT_FIXED(-2.6684225), FLOAT_FIXED(1.4178175), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-2.8768325), FLOAT_FIXED(0.18224), FLOAT_FIXED(0.9203775)}, 
-    {FLOAT_FIXED(-2.3082075), FLOAT_FIXED(1.3002875), FLOAT_FIXED(1.4621575)}, 
-    {FLOAT_FIXED(-2.6258075), FLOAT_FIXED(1.49658), FLOAT_FIXED(0.147845)}, 
-    {FLOAT_FIXED(-1.764335), FLOAT_FIXED(0.18224), FLOAT_FIXED(2.45161)}, 
-    {FLOAT_FIXED(-0.9520425), FLOAT_FIXED(1.496585), FLOAT_FIXED(2.4515975)}, 
-    {FLOAT_FIXED(-2.1038875), FLOAT_FIXED(1.30029), FLOAT_FIXED(1.74338)}, 
-    {FLOAT_FIXED(-1.63689), FLOAT_FIXED(0.1034775), FLOAT_FIXED(2.5378275)}, 
-    {FLOAT_FIXED(-0.1674275), FLOAT_FIXED(0.1034775), FLOAT_FIXED(3.015285)}, 
-    {FLOAT_FIXED(-0.8245975), FLOAT_FIXED(1.4178225), FLOAT_FIXED(2.537815)}, 
-    {FLOAT_FIXED(-0.01365), FLOAT_FIXED(0.18224), FLOAT_FIXED(3.0204425)}, 
-    {FLOAT_FIXED(0.67732), FLOAT_FIXED(1.30029), FLOAT_FIXED(2.6470675)}, 
-    {FLOAT_FIXED(-0.6708225), FLOAT_FIXED(1.496585), FLOAT_FIXED(2.5429725)}, 
-    {FLOAT_FIXED(1.7864125), FLOAT_FIXED(0.18224), FLOAT_FIXED(2.4355675)}, 
-    {FLOAT_FIXED(2.0374225), FLOAT_FIXED(1.4965825), FLOAT_FIXED(1.66302)}, 
-    {FLOAT_FIXED(1.0079175), FLOAT_FIXED(1.30029), FLOAT_FIXED(2.53965)}, 
-    {FLOAT_FIXED(1.9077925), FLOAT_FIXED(0.1034775), FLOAT_FIXED(2.341005)}, 
-    {FLOAT_FIXED(2.815975), FLOAT_FIXED(0.1034775), FLOAT_FIXED(1.090995)}, 
-    {FLOAT_FIXED(2.1588025), FLOAT_FIXED(1.4178175), FLOAT_FIXED(1.568455)}, 
-    {FLOAT_FIXED(2.8683975), FLOAT_FIXED(0.18224), FLOAT_FIXED(0.9463375)}, 
-    {FLOAT_FIXED(2.72682), FLOAT_FIXED(1.3002775), FLOAT_FIXED(0.173805)}, 
-    {FLOAT_FIXED(2.2112275), FLOAT_FIXED(1.49658), FLOAT_FIXED(1.4237975)}, 
-    {FLOAT_FIXED(1.6385675), FLOAT_FIXED(0.0692975), FLOAT_FIXED(-2.542985)}, 
-    {FLOAT_FIXED(0.1691025), FLOAT_FIXED(0.0692975), FLOAT_FIXED(-3.0204425)}, 
-    {FLOAT_FIXED(0.8600725), FLOAT_FIXED(1.187345), FLOAT_FIXED(-2.6470675)}, 
-    {FLOAT_FIXED(1.63689), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(-2.5378275)}, 
-    {FLOAT_FIXED(0.8245975), FLOAT_FIXED(-1.4178225), FLOAT_FIXED(-2.537815)}, 
-    {FLOAT_FIXED(0.1674275), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(-3.015285)}, 
-    {FLOAT_FIXED(0.6708225), FLOAT_FIXED(-1.496585), FLOAT_FIXED(-2.5429725)}, 
-    {FLOAT_FIXED(-0.67732), FLOAT_FIXED(-1.30029), FLOAT_FIXED(-2.6470675)}, 
-    {FLOAT_FIXED(0.01365), FLOAT_FIXED(-0.18224), FLOAT_FIXED(-3.0204425)}, 
-    {FLOAT_FIXED(-1.91218), FLOAT_FIXED(0.069295), FLOAT_FIXED(-2.3441925)}, 
-    {FLOAT_FIXED(-2.82036), FLOAT_FIXED(0.069295), FLOAT_FIXED(-1.0941825)}, 
-    {FLOAT_FIXED(-2.251735), FLOAT_FIXED(1.187345), FLOAT_FIXED(-1.635965)}, 
-    {FLOAT_FIXED(-1.9077925), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(-2.341005)}, 
-    {FLOAT_FIXED(-2.1588025), FLOAT_FIXED(-1.4178175), FLOAT_FIXED(-1.568455)}, 
-    {FLOAT_FIXED(-2.815975), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(-1.090995)}, 
-    {FLOAT_FIXED(-2.2112275), FLOAT_FIXED(-1.49658), FLOAT_FIXED(-1.4237975)}, 
-    {FLOAT_FIXED(-2.72682), FLOAT_FIXED(-1.3002775), FLOAT_FIXED(-0.173805)}, 
-    {FLOAT_FIXED(-2.8683975), FLOAT_FIXED(-0.18224), FLOAT_FIXED(-0.9463375)}, 
-    {FLOAT_FIXED(-2.82036), FLOAT_FIXED(0.069295), FLOAT_FIXED(1.0941825)}, 
-    {FLOAT_FIXED(-1.91218), FLOAT_FIXED(0.069295), FLOAT_FIXED(2.3441925)}, 
-    {FLOAT_FIXED(-2.251735), FLOAT_FIXED(1.187345), FLOAT_FIXED(1.635965)}, 
-    {FLOAT_FIXED(-2.815975), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(1.090995)}, 
-    {FLOAT_FIXED(-2.1588025), FLOAT_FIXED(-1.4178175), FLOAT_FIXED(1.568455)}, 
-    {FLOAT_FIXED(-1.9077925), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(2.341005)}, 
-    {FLOAT_FIXED(-2.0374225), FLOAT_FIXED(-1.4965825), FLOAT_FIXED(1.66302)}, 
-    {FLOAT_FIXED(-1.0079175), FLOAT_FIXED(-1.30029), FLOAT_FIXED(2.53965)}, 
-    {FLOAT_FIXED(-1.7864125), FLOAT_FIXED(-0.18224), FLOAT_FIXED(2.4355675)}, 
-    {FLOAT_FIXED(0.1691025), FLOAT_FIXED(0.0692975), FLOAT_FIXED(3.0204425)}, 
-    {FLOAT_FIXED(1.6385675), FLOAT_FIXED(0.0692975), FLOAT_FIXED(2.542985)}, 
-    {FLOAT_FIXED(0.8600725), FLOAT_FIXED(1.187345), FLOAT_FIXED(2.6470675)}, 
-    {FLOAT_FIXED(0.1674275), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(3.015285)}, 
-    {FLOAT_FIXED(0.8245975), FLOAT_FIXED(-1.4178225), FLOAT_FIXED(2.537815)}, 
-    {FLOAT_FIXED(1.63689), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(2.5378275)}, 
-    {FLOAT_FIXED(0.9520425), FLOAT_FIXED(-1.496585), FLOAT_FIXED(2.4515975)}, 
-    {FLOAT_FIXED(2.1038875), FLOAT_FIXED(-1.30029), FLOAT_FIXED(1.74338)}, 
-    {FLOAT_FIXED(1.764335), FLOAT_FIXED(-0.18224), FLOAT_FIXED(2.45161)}, 
-    {FLOAT_FIXED(2.92487), FLOAT_FIXED(0.069295), FLOAT_FIXED(0.7725325)}, 
-    {FLOAT_FIXED(2.92487), FLOAT_FIXED(0.069295), FLOAT_FIXED(-0.7725325)}, 
-    {FLOAT_FIXED(2.7832925), FLOAT_FIXED(1.187335), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(2.9194475), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(0.7725325)}, 
-    {FLOAT_FIXED(2.6684225), FLOAT_FIXED(-1.4178175), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(2.9194475), FLOAT_FIXED(-0.1034775), FLOAT_FIXED(-0.7725325)}, 
-    {FLOAT_FIXED(2.6258075), FLOAT_FIXED(-1.49658), FLOAT_FIXED(-0.147845)}, 
-    {FLOAT_FIXED(2.3082075), FLOAT_FIXED(-1.3002875), FLOAT_FIXED(-1.4621575)}, 
-    {FLOAT_FIXED(2.8768325), FLOAT_FIXED(-0.18224), FLOAT_FIXED(-0.9203775)}, 
-    {FLOAT_FIXED(1.323275), FLOAT_FIXED(-2.491625), FLOAT_FIXED(-1.0941775)}, 
-    {FLOAT_FIXED(0.91714), FLOAT_FIXED(-1.679335), FLOAT_FIXED(-2.3441775)}, 
-    {FLOAT_FIXED(2.068985), FLOAT_FIXED(-1.48304), FLOAT_FIXED(-1.6359625)}, 
-    {FLOAT_FIXED(1.1667825), FLOAT_FIXED(-2.564965), FLOAT_FIXED(-1.09099)}, 
-    {FLOAT_FIXED(-0.3026625), FLOAT_FIXED(-2.5649675), FLOAT_FIXED(-1.56845)}, 
-    {FLOAT_FIXED(0.7606475), FLOAT_FIXED(-1.752675), FLOAT_FIXED(-2.34099)}, 
-    {FLOAT_FIXED(-0.4273925), FLOAT_FIXED(-2.4916275), FLOAT_FIXED(-1.6630125)}, 
-    {FLOAT_FIXED(-0.7122225), FLOAT_FIXED(-1.48304), FLOAT_FIXED(-2.5396475)}, 
-    {FLOAT_FIXED(0.63592), FLOAT_FIXED(-1.679335), FLOAT_FIXED(-2.4355525)}, 
-    {FLOAT_FIXED(-0.6317125), FLOAT_FIXED(-2.4916275), FLOAT_FIXED(-1.596625)}, 
-    {FLOAT_FIXED(-1.9460475), FLOAT_FIXED(-1.67933), FLOAT_FIXED(-1.59663)}, 
-    {FLOAT_FIXED(-0.9165425), FLOAT_FIXED(-1.48304), FLOAT_FIXED(-2.47326)}, 
-    {FLOAT_FIXED(-0.6770375), FLOAT_FIXED(-2.5649675), FLOAT_FIXED(-1.44681)}, 
-    {FLOAT_FIXED(-1.585225), FLOAT_FIXED(-2.56496), FLOAT_FIXED(-0.1968225)}, 
-    {FLOAT_FIXED(-1.9913725), FLOAT_FIXED(-1.75267), FLOAT_FIXED(-1.4468125)}, 
-    {FLOAT_FIXED(-1.7137025), FLOAT_FIXED(-2.4916175), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(-2.635445), FLOAT_FIXED(-1.4830275), FLOAT_FIXED(-0.107415)}, 
-    {FLOAT_FIXED(-2.1198525), FLOAT_FIXED(-1.67933), FLOAT_FIXED(-1.3574075)}, 
-    {FLOAT_FIXED(-1.7137025), FLOAT_FIXED(-2.4916175), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(-2.1198525), FLOAT_FIXED(-1.67933), FLOAT_FIXED(1.3574075)}, 
-    {FLOAT_FIXED(-2.635445), FLOAT_FIXED(-1.4830275), FLOAT_FIXED(0.107415)}, 
-    {FLOAT_FIXED(-1.585225), FLOAT_FIXED(-2.56496), FLOAT_FIXED(0.1968225)}, 
-    {FLOAT_FIXED(-0.6770375), FLOAT_FIXED(-2.5649675), FLOAT_FIXED(1.44681)}, 
-    {FLOAT_FIXED(-1.9913725), FLOAT_FIXED(-1.75267), FLOAT_FIXED(1.4468125)}, 
-    {FLOAT_FIXED(-0.6317125), FLOAT_FIXED(-2.4916275), FLOAT_FIXED(1.596625)}, 
-    {FLOAT_FIXED(-0.9165425), FLOAT_FIXED(-1.48304), FLOAT_FIXED(2.47326)}, 
-    {FLOAT_FIXED(-1.9460475), FLOAT_FIXED(-1.67933), FLOAT_FIXED(1.59663)}, 
-    {FLOAT_FIXED(2.51286), FLOAT_FIXED(-1.67933), FLOAT_FIXED(-0.147845)}, 
-    {FLOAT_FIXED(1.4495475), FLOAT_FIXED(-2.4916275), FLOAT_FIXED(-0.920375)}, 
-    {FLOAT_FIXED(2.19526), FLOAT_FIXED(-1.48304), FLOAT_FIXED(-1.4621575)}, 
-    {FLOAT_FIXED(2.4614725), FLOAT_FIXED(-1.75267), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(1.39816), FLOAT_FIXED(-2.564965), FLOAT_FIXED(0.7725275)}, 
-    {FLOAT_FIXED(1.39816), FLOAT_FIXED(-2.564965), FLOAT_FIXED(-0.7725275)}, 
-    {FLOAT_FIXED(1.2460525), FLOAT_FIXED(-2.64708), FLOAT_FIXED(0.7725275)}, 
-    {FLOAT_FIXED(0.1827475), FLOAT_FIXED(-3.020445), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(1.2460525), FLOAT_FIXED(-2.64708), FLOAT_FIXED(-0.7725275)}, 
-    {FLOAT_FIXED(-0.4273925), FLOAT_FIXED(-2.4916275), FLOAT_FIXED(1.6630125)}, 
-    {FLOAT_FIXED(0.63592), FLOAT_FIXED(-1.679335), FLOAT_FIXED(2.4355525)}, 
-    {FLOAT_FIXED(-0.7122225), FLOAT_FIXED(-1.48304), FLOAT_FIXED(2.5396475)}, 
-    {FLOAT_FIXED(-0.3026625), FLOAT_FIXED(-2.5649675), FLOAT_FIXED(1.56845)}, 
-    {FLOAT_FIXED(1.1667825), FLOAT_FIXED(-2.564965), FLOAT_FIXED(1.09099)}, 
-    {FLOAT_FIXED(0.7606475), FLOAT_FIXED(-1.752675), FLOAT_FIXED(2.34099)}, 
-    {FLOAT_FIXED(1.323275), FLOAT_FIXED(-2.491625), FLOAT_FIXED(1.0941775)}, 
-    {FLOAT_FIXED(2.068985), FLOAT_FIXED(-1.48304), FLOAT_FIXED(1.6359625)}, 
-    {FLOAT_FIXED(0.91714), FLOAT_FIXED(-1.679335), FLOAT_FIXED(2.3441775)}, 
-};
-
-static vertex_t normals[] = {
-    {FLOAT_FIXED(0.102380931087175), FLOAT_FIXED(-0.943523223203742), FLOAT_FIXED(0.315090577810484)}, 
-    {FLOAT_FIXED(0.619578909588332), FLOAT_FIXED(-0.187325247400766), FLOAT_FIXED(-0.762254043268762)}, 
-    {FLOAT_FIXED(0.291568893520346), FLOAT_FIXED(0.331306352495979), FLOAT_FIXED(0.897342566207093)}, 
-    {FLOAT_FIXED(-0.949294339903636), FLOAT_FIXED(-0.187324241900737), FLOAT_FIXED(-0.252487394978905)}, 
-    {FLOAT_FIXED(0.700224776051499), FLOAT_FIXED(-0.661698404555919), FLOAT_FIXED(0.268030752735166)}, 
-    {FLOAT_FIXED(-0.460237091550926), FLOAT_FIXED(-0.131368420403064), FLOAT_FIXED(0.878022868541331)}, 
-    {FLOAT_FIXED(-0.189932526759114), FLOAT_FIXED(-0.534565525498493), FLOAT_FIXED(-0.823507944240624)}, 
-    {FLOAT_FIXED(0.675018562316607), FLOAT_FIXED(0.735879096559182), FLOAT_FIXED(0.053215559522228)}, 
-    {FLOAT_FIXED(-0.26803567192826), FLOAT_FIXED(-0.94352239229705), FLOAT_FIXED(0.194736678127205)}, 
-    {FLOAT_FIXED(0.916406563199513), FLOAT_FIXED(-0.187323900996283), FLOAT_FIXED(0.353707176970432)}, 
-    {FLOAT_FIXED(-0.763321441174168), FLOAT_FIXED(0.331305082808759), FLOAT_FIXED(0.554596537627917)}, 
-    {FLOAT_FIXED(-0.0532140953792746), FLOAT_FIXED(-0.187322537722273), FLOAT_FIXED(-0.980856017422666)}, 
-    {FLOAT_FIXED(-0.26803567192826), FLOAT_FIXED(-0.94352239229705), FLOAT_FIXED(-0.194736678127205)}, 
-    {FLOAT_FIXED(-0.0532143875862546), FLOAT_FIXED(-0.187323566339835), FLOAT_FIXED(0.980855805125068)}, 
-    {FLOAT_FIXED(-0.763321169919906), FLOAT_FIXED(0.331306037675248), FLOAT_FIXED(-0.554596340550524)}, 
-    {FLOAT_FIXED(0.916405020260391), FLOAT_FIXED(-0.187329332408345), FLOAT_FIXED(-0.353708297981537)}, 
-    {FLOAT_FIXED(0.102380931087175), FLOAT_FIXED(-0.943523223203742), FLOAT_FIXED(-0.315090577810484)}, 
-    {FLOAT_FIXED(-0.949293899408551), FLOAT_FIXED(-0.187328301387733), FLOAT_FIXED(0.252486039306919)}, 
-    {FLOAT_FIXED(0.291569028813772), FLOAT_FIXED(0.331305105652722), FLOAT_FIXED(-0.897342982590844)}, 
-    {FLOAT_FIXED(0.619578909588332), FLOAT_FIXED(-0.187325247400766), FLOAT_FIXED(0.762254043268762)}, 
-    {FLOAT_FIXED(0.904989177073949), FLOAT_FIXED(-0.330384536003797), FLOAT_FIXED(0.268031057432849)}, 
-    {FLOAT_FIXED(-0.356318555166737), FLOAT_FIXED(-0.932847928548662), FLOAT_FIXED(0.0532149363088864)}, 
-    {FLOAT_FIXED(0.393192860152942), FLOAT_FIXED(0.408940121641844), FLOAT_FIXED(-0.823509169127037)}, 
-    {FLOAT_FIXED(-0.0883199861934042), FLOAT_FIXED(0.47038967203819), FLOAT_FIXED(0.878027981603434)}, 
-    {FLOAT_FIXED(0.0247473427402908), FLOAT_FIXED(-0.330385129025), FLOAT_FIXED(0.943521719700415)}, 
-    {FLOAT_FIXED(-0.160722093885027), FLOAT_FIXED(-0.932847677636309), FLOAT_FIXED(-0.32243389844394)}, 
-    {FLOAT_FIXED(0.904702377620027), FLOAT_FIXED(0.408950167846217), FLOAT_FIXED(0.119471202166966)}, 
-    {FLOAT_FIXED(-0.862349423574725), FLOAT_FIXED(0.470384593168889), FLOAT_FIXED(0.187328070960223)}, 
-    {FLOAT_FIXED(-0.889697426542421), FLOAT_FIXED(-0.33038431973485), FLOAT_FIXED(0.315094732544253)}, 
-    {FLOAT_FIXED(0.256982032757219), FLOAT_FIXED(-0.932848738257895), FLOAT_FIXED(-0.252494487802448)}, 
-    {FLOAT_FIXED(0.165940328161748), FLOAT_FIXED(0.408948214883463), FLOAT_FIXED(0.897343393040368)}, 
-    {FLOAT_FIXED(-0.444634420333733), FLOAT_FIXED(0.470390618822873), FLOAT_FIXED(-0.762255139686129)}, 
-    {FLOAT_FIXED(-0.574601042556898), FLOAT_FIXED(-0.330386534894741), FLOAT_FIXED(-0.748784601506183)}, 
-    {FLOAT_FIXED(0.319545511045693), FLOAT_FIXED(-0.932847439885121), FLOAT_FIXED(0.166392067930904)}, 
-    {FLOAT_FIXED(-0.802147795216185), FLOAT_FIXED(0.408944272537728), FLOAT_FIXED(0.435113199740484)}, 
-    {FLOAT_FIXED(0.587543901024326), FLOAT_FIXED(0.470397947283857), FLOAT_FIXED(-0.658420789131275)}, 
-    {FLOAT_FIXED(0.534577066899585), FLOAT_FIXED(-0.33038712469629), FLOAT_FIXED(-0.777863553189089)}, 
-    {FLOAT_FIXED(-0.0594985410643838), FLOAT_FIXED(-0.93284779052617), FLOAT_FIXED(0.355323688095309)}, 
-    {FLOAT_FIXED(-0.66169795430351), FLOAT_FIXED(0.408937098061141), FLOAT_FIXED(-0.628431593015407)}, 
-    {FLOAT_FIXED(0.807756949579629), FLOAT_FIXED(0.470396936437217), FLOAT_FIXED(0.355324404729388)}, 
-    {FLOAT_FIXED(0.802609358206668), FLOAT_FIXED(-0.12562595177623), FLOAT_FIXED(0.583126348538117)}, 
-    {FLOAT_FIXED(0.427346868887418), FLOAT_FIXED(-0.560926749476066), FLOAT_FIXED(-0.709038669872338)}, 
-    {FLOAT_FIXED(0.101634249815188), FLOAT_FIXED(0.992077598685001), FLOAT_FIXED(0.0738411636684166)}, 
-    {FLOAT_FIXED(-0.542274189387007), FLOAT_FIXED(-0.560933804619695), FLOAT_FIXED(0.625533348718945)}, 
-    {FLOAT_FIXED(-0.306568428140651), FLOAT_FIXED(-0.125627826503172), FLOAT_FIXED(0.943521832325813)}, 
-    {FLOAT_FIXED(0.806396047223857), FLOAT_FIXED(-0.560922375582566), FLOAT_FIXED(0.187327263345594)}, 
-    {FLOAT_FIXED(-0.0388220333050612), FLOAT_FIXED(0.992077053614018), FLOAT_FIXED(0.119482088291883)}, 
-    {FLOAT_FIXED(-0.762488977242179), FLOAT_FIXED(-0.560934397123562), FLOAT_FIXED(-0.322433189525834)}, 
-    {FLOAT_FIXED(-0.992077562777056), FLOAT_FIXED(-0.125626865893947), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.0710300199525896), FLOAT_FIXED(-0.560926512281634), FLOAT_FIXED(0.824812817604756)}, 
-    {FLOAT_FIXED(-0.125626601548217), FLOAT_FIXED(0.992077596251143), FLOAT_FIXED(-7.36782498446783e-18)}, 
-    {FLOAT_FIXED(0.0710297005743964), FLOAT_FIXED(-0.560926552724951), FLOAT_FIXED(-0.824812817604343)}, 
-    {FLOAT_FIXED(-0.306568428140651), FLOAT_FIXED(-0.125627826503172), FLOAT_FIXED(-0.943521832325813)}, 
-    {FLOAT_FIXED(-0.762487749838716), FLOAT_FIXED(-0.560933894142262), FLOAT_FIXED(0.322436967093243)}, 
-    {FLOAT_FIXED(-0.0388220333050612), FLOAT_FIXED(0.992077053614018), FLOAT_FIXED(-0.119482088291883)}, 
-    {FLOAT_FIXED(0.806395528128607), FLOAT_FIXED(-0.560922588302568), FLOAT_FIXED(-0.187328860953494)}, 
-    {FLOAT_FIXED(0.802609358206668), FLOAT_FIXED(-0.12562595177623), FLOAT_FIXED(-0.583126348538117)}, 
-    {FLOAT_FIXED(-0.542274189387007), FLOAT_FIXED(-0.560933804619695), FLOAT_FIXED(-0.625533348718945)}, 
-    {FLOAT_FIXED(0.101634249815188), FLOAT_FIXED(0.992077598685001), FLOAT_FIXED(-0.0738411636684166)}, 
-    {FLOAT_FIXED(0.427347893582228), FLOAT_FIXED(-0.560926909865448), FLOAT_FIXED(0.709037925388785)}, 
-    {FLOAT_FIXED(0.408946244025195), FLOAT_FIXED(0.661697843178942), FLOAT_FIXED(0.628425758407484)}, 
-    {FLOAT_FIXED(0.514818237936938), FLOAT_FIXED(-0.735879842465061), FLOAT_FIXED(0.439821599448121)}, 
-    {FLOAT_FIXED(0.330382331358325), FLOAT_FIXED(0.534569763665879), FLOAT_FIXED(-0.777870608070805)}, 
-    {FLOAT_FIXED(-0.88842959505093), FLOAT_FIXED(0.13137437753798), FLOAT_FIXED(0.439810899778699)}, 
-    {FLOAT_FIXED(-0.471299513973557), FLOAT_FIXED(0.661698874987981), FLOAT_FIXED(0.58312208581731)}, 
-    {FLOAT_FIXED(-0.259207586911062), FLOAT_FIXED(-0.735877263896961), FLOAT_FIXED(0.625536633113735)}, 
-    {FLOAT_FIXED(0.84189164128228), FLOAT_FIXED(0.534570479793166), FLOAT_FIXED(0.0738435269521556)}, 
-    {FLOAT_FIXED(-0.692825324018191), FLOAT_FIXED(0.131373046469314), FLOAT_FIXED(-0.709037511744238)}, 
-    {FLOAT_FIXED(-0.700224776051499), FLOAT_FIXED(0.661698404555919), FLOAT_FIXED(-0.268030752735166)}, 
-    {FLOAT_FIXED(-0.675020704579411), FLOAT_FIXED(-0.735877072164932), FLOAT_FIXED(-0.0532163795375359)}, 
-    {FLOAT_FIXED(0.189931609766156), FLOAT_FIXED(0.534566392039972), FLOAT_FIXED(0.823507593233361)}, 
-    {FLOAT_FIXED(0.460232427510481), FLOAT_FIXED(0.131372827841589), FLOAT_FIXED(-0.87802465385245)}, 
-    {FLOAT_FIXED(0.0385299741187642), FLOAT_FIXED(0.661698418442112), FLOAT_FIXED(-0.748779436233137)}, 
-    {FLOAT_FIXED(-0.157984959327919), FLOAT_FIXED(-0.735876689573299), FLOAT_FIXED(-0.65842710330666)}, 
-    {FLOAT_FIXED(-0.72450405545308), FLOAT_FIXED(0.534568421355719), FLOAT_FIXED(0.435121220490674)}, 
-    {FLOAT_FIXED(0.977270961766597), FLOAT_FIXED(0.131372794914534), FLOAT_FIXED(0.166381056746656)}, 
-    {FLOAT_FIXED(0.724041723518963), FLOAT_FIXED(0.661696059192217), FLOAT_FIXED(-0.194735481751987)}, 
-    {FLOAT_FIXED(0.577378930232565), FLOAT_FIXED(-0.735878363152822), FLOAT_FIXED(-0.35371825732781)}, 
-    {FLOAT_FIXED(-0.637701864065336), FLOAT_FIXED(0.534573860245707), FLOAT_FIXED(-0.554587342543624)}, 
-    {FLOAT_FIXED(0.143748773959571), FLOAT_FIXED(0.131370522124446), FLOAT_FIXED(0.980855787515102)}, 
-    {FLOAT_FIXED(0.26803567192826), FLOAT_FIXED(0.94352239229705), FLOAT_FIXED(-0.194736678127205)}, 
-    {FLOAT_FIXED(0.763321169919906), FLOAT_FIXED(-0.331306037675248), FLOAT_FIXED(-0.554596340550524)}, 
-    {FLOAT_FIXED(-0.916405020260391), FLOAT_FIXED(0.187329332408345), FLOAT_FIXED(-0.353708297981537)}, 
-    {FLOAT_FIXED(0.0532140953792746), FLOAT_FIXED(0.187322537722273), FLOAT_FIXED(0.980856017422666)}, 
-    {FLOAT_FIXED(0.491120243632891), FLOAT_FIXED(0.794656412793059), FLOAT_FIXED(-0.356822213295133)}, 
-    {FLOAT_FIXED(0.830482714496976), FLOAT_FIXED(-0.303529601982392), FLOAT_FIXED(0.467084833453351)}, 
-    {FLOAT_FIXED(-0.187592299987969), FLOAT_FIXED(-0.303527641751474), FLOAT_FIXED(-0.934173484786425)}, 
-    {FLOAT_FIXED(-0.642885520775662), FLOAT_FIXED(0.607059414555558), FLOAT_FIXED(0.46709428852906)}, 
-    {FLOAT_FIXED(0.408946244025195), FLOAT_FIXED(0.661697843178942), FLOAT_FIXED(-0.628425758407484)}, 
-    {FLOAT_FIXED(0.514819192138234), FLOAT_FIXED(-0.735878298518671), FLOAT_FIXED(-0.439823065760997)}, 
-    {FLOAT_FIXED(-0.888429838547399), FLOAT_FIXED(0.131373983544832), FLOAT_FIXED(-0.439810525597335)}, 
-    {FLOAT_FIXED(0.330382331358325), FLOAT_FIXED(0.534569763665879), FLOAT_FIXED(0.777870608070805)}, 
-    {FLOAT_FIXED(-0.102380931087175), FLOAT_FIXED(0.943523223203742), FLOAT_FIXED(-0.315090577810484)}, 
-    {FLOAT_FIXED(-0.291568893520346), FLOAT_FIXED(-0.331306352495979), FLOAT_FIXED(-0.897342566207093)}, 
-    {FLOAT_FIXED(-0.619578909588332), FLOAT_FIXED(0.187325247400766), FLOAT_FIXED(0.762254043268762)}, 
-    {FLOAT_FIXED(0.949293899408551), FLOAT_FIXED(0.187328301387733), FLOAT_FIXED(0.252486039306919)}, 
-    {FLOAT_FIXED(-0.187595449128905), FLOAT_FIXED(0.794657500243018), FLOAT_FIXED(-0.577345134883496)}, 
-    {FLOAT_FIXED(0.700856284265517), FLOAT_FIXED(-0.303527383618913), FLOAT_FIXED(-0.645501042755927)}, 
-    {FLOAT_FIXED(-0.946422221623738), FLOAT_FIXED(-0.303525770525193), FLOAT_FIXED(-0.110259172153054)}, 
-    {FLOAT_FIXED(0.245566054069138), FLOAT_FIXED(0.607058616290919), FLOAT_FIXED(0.755762627731663)}, 
-    {FLOAT_FIXED(-0.471299513973557), FLOAT_FIXED(0.66169887498798), FLOAT_FIXED(-0.58312208581731)}, 
-    {FLOAT_FIXED(-0.259206250718806), FLOAT_FIXED(-0.735879139884828), FLOAT_FIXED(-0.625534979893742)}, 
-    {FLOAT_FIXED(-0.692825324018191), FLOAT_FIXED(0.131373046469314), FLOAT_FIXED(0.709037511744238)}, 
-    {FLOAT_FIXED(0.84189164128228), FLOAT_FIXED(0.534570479793166), FLOAT_FIXED(-0.0738435269521556)}, 
-    {FLOAT_FIXED(-0.331305391889576), FLOAT_FIXED(0.943523575383728), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.943524787988278), FLOAT_FIXED(-0.331301938496706), FLOAT_FIXED(1.47356655009898e-17)}, 
-    {FLOAT_FIXED(0.533476187403313), FLOAT_FIXED(0.187323232152268), FLOAT_FIXED(0.824810986935585)}, 
-    {FLOAT_FIXED(0.53347698845549), FLOAT_FIXED(0.187320950831113), FLOAT_FIXED(-0.824810986934697)}, 
-    {FLOAT_FIXED(-0.607060361244373), FLOAT_FIXED(0.794655722817027), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.397323004982757), FLOAT_FIXED(-0.303526113946088), FLOAT_FIXED(-0.866029057170865)}, 
-    {FLOAT_FIXED(-0.397323004982757), FLOAT_FIXED(-0.303526113946088), FLOAT_FIXED(0.866029057170866)}, 
-    {FLOAT_FIXED(0.794656066980602), FLOAT_FIXED(0.607059910726215), FLOAT_FIXED(2.94713345749881e-17)}, 
-    {FLOAT_FIXED(-0.700224776051499), FLOAT_FIXED(0.661698404555919), FLOAT_FIXED(0.268030752735166)}, 
-    {FLOAT_FIXED(-0.675018562316607), FLOAT_FIXED(-0.735879096559182), FLOAT_FIXED(0.053215559522228)}, 
-    {FLOAT_FIXED(0.460237091550926), FLOAT_FIXED(0.131368420403064), FLOAT_FIXED(0.878022868541331)}, 
-    {FLOAT_FIXED(0.189932526759114), FLOAT_FIXED(0.534565525498493), FLOAT_FIXED(-0.823507944240624)}, 
-    {FLOAT_FIXED(-0.102380931087175), FLOAT_FIXED(0.943523223203742), FLOAT_FIXED(0.315090577810484)}, 
-    {FLOAT_FIXED(-0.291569028813772), FLOAT_FIXED(-0.331305105652722), FLOAT_FIXED(0.897342982590845)}, 
-    {FLOAT_FIXED(0.949293899408551), FLOAT_FIXED(0.187328301387733), FLOAT_FIXED(-0.252486039306919)}, 
-    {FLOAT_FIXED(-0.619578909588332), FLOAT_FIXED(0.187325247400766), FLOAT_FIXED(-0.762254043268762)}, 
-    {FLOAT_FIXED(-0.187595449128905), FLOAT_FIXED(0.794657500243018), FLOAT_FIXED(0.577345134883496)}, 
-    {FLOAT_FIXED(-0.946422315369149), FLOAT_FIXED(-0.303525373411168), FLOAT_FIXED(0.110259460668512)}, 
-    {FLOAT_FIXED(0.700855979133883), FLOAT_FIXED(-0.303526091061752), FLOAT_FIXED(0.645501981838212)}, 
-    {FLOAT_FIXED(0.245566361420215), FLOAT_FIXED(0.607057314335825), FLOAT_FIXED(-0.755763573646026)}, 
-    {FLOAT_FIXED(0.0385299741187642), FLOAT_FIXED(0.661698418442112), FLOAT_FIXED(0.748779436233137)}, 
-    {FLOAT_FIXED(-0.157985074312391), FLOAT_FIXED(-0.735878664203362), FLOAT_FIXED(0.658424868807963)}, 
-    {FLOAT_FIXED(0.977270961766597), FLOAT_FIXED(0.131372794914534), FLOAT_FIXED(-0.166381056746656)}, 
-    {FLOAT_FIXED(-0.724504055453081), FLOAT_FIXED(0.534568421355719), FLOAT_FIXED(-0.435121220490674)}, 
-    {FLOAT_FIXED(0.26803567192826), FLOAT_FIXED(0.94352239229705), FLOAT_FIXED(0.194736678127205)}, 
-    {FLOAT_FIXED(0.763321169919906), FLOAT_FIXED(-0.331306037675248), FLOAT_FIXED(0.554596340550524)}, 
-    {FLOAT_FIXED(0.0532140953792746), FLOAT_FIXED(0.187322537722273), FLOAT_FIXED(-0.980856017422666)}, 
-    {FLOAT_FIXED(-0.916406563199513), FLOAT_FIXED(0.187323900996283), FLOAT_FIXED(0.353707176970432)}, 
-    {FLOAT_FIXED(0.491120243632891), FLOAT_FIXED(0.794656412793058), FLOAT_FIXED(0.356822213295134)}, 
-    {FLOAT_FIXED(-0.187592299987969), FLOAT_FIXED(-0.303527641751474), FLOAT_FIXED(0.934173484786425)}, 
-    {FLOAT_FIXED(0.830483754181868), FLOAT_FIXED(-0.303527919720767), FLOAT_FIXED(-0.467084078073718)}, 
-    {FLOAT_FIXED(-0.642888303014743), FLOAT_FIXED(0.607054912727975), FLOAT_FIXED(-0.467096309961506)}, 
-    {FLOAT_FIXED(0.724041723518963), FLOAT_FIXED(0.661696059192217), FLOAT_FIXED(0.194735481751987)}, 
-    {FLOAT_FIXED(0.577376515390553), FLOAT_FIXED(-0.735880570053462), FLOAT_FIXED(0.353717607836046)}, 
-    {FLOAT_FIXED(0.143748773959571), FLOAT_FIXED(0.131370522124446), FLOAT_FIXED(-0.980855787515102)}, 
-    {FLOAT_FIXED(-0.637701525643507), FLOAT_FIXED(0.534574169525582), FLOAT_FIXED(0.554587433564787)}, 
-    {FLOAT_FIXED(0.889697426542421), FLOAT_FIXED(0.33038431973485), FLOAT_FIXED(-0.315094732544253)}, 
-    {FLOAT_FIXED(-0.165940328161748), FLOAT_FIXED(-0.408948214883463), FLOAT_FIXED(-0.897343393040368)}, 
-    {FLOAT_FIXED(-0.256982032757219), FLOAT_FIXED(0.932848738257895), FLOAT_FIXED(0.252494487802448)}, 
-    {FLOAT_FIXED(0.444638110063529), FLOAT_FIXED(-0.470389248658304), FLOAT_FIXED(0.762253832936122)}, 
-    {FLOAT_FIXED(0.79465487160021), FLOAT_FIXED(0.187595613401835), FLOAT_FIXED(-0.57734869955205)}, 
-    {FLOAT_FIXED(0.151768851549239), FLOAT_FIXED(-0.982246229016347), FLOAT_FIXED(-0.110265866353059)}, 
-    {FLOAT_FIXED(-0.584918853670119), FLOAT_FIXED(0.491120988461398), FLOAT_FIXED(-0.645499891025501)}, 
-    {FLOAT_FIXED(0.433149886232126), FLOAT_FIXED(0.491122210272826), FLOAT_FIXED(0.755764613245308)}, 
-    {FLOAT_FIXED(0.574601042556898), FLOAT_FIXED(0.330386534894741), FLOAT_FIXED(-0.748784601506183)}, 
-    {FLOAT_FIXED(-0.587543901024326), FLOAT_FIXED(-0.470397947283857), FLOAT_FIXED(-0.658420789131275)}, 
-    {FLOAT_FIXED(-0.319545511045693), FLOAT_FIXED(0.932847439885121), FLOAT_FIXED(0.166392067930904)}, 
-    {FLOAT_FIXED(0.802147795216185), FLOAT_FIXED(-0.408944272537728), FLOAT_FIXED(0.435113199740484)}, 
-    {FLOAT_FIXED(-0.0247473427402907), FLOAT_FIXED(0.330385129025), FLOAT_FIXED(-0.943521719700415)}, 
-    {FLOAT_FIXED(-0.904702377620027), FLOAT_FIXED(-0.408950167846217), FLOAT_FIXED(-0.119471202166966)}, 
-    {FLOAT_FIXED(0.160722057722954), FLOAT_FIXED(0.932848160449648), FLOAT_FIXED(0.322432519617684)}, 
-    {FLOAT_FIXED(0.862349402564586), FLOAT_FIXED(-0.470384312661783), FLOAT_FIXED(-0.187328872035796)}, 
-    {FLOAT_FIXED(-0.303530827693893), FLOAT_FIXED(0.187597238166362), FLOAT_FIXED(-0.934171457962516)}, 
-    {FLOAT_FIXED(-0.057970525581305), FLOAT_FIXED(-0.982246123567499), FLOAT_FIXED(-0.178415164435227)}, 
-    {FLOAT_FIXED(-0.794660588946598), FLOAT_FIXED(0.491113350122604), FLOAT_FIXED(0.356822400791204)}, 
-    {FLOAT_FIXED(0.852623486096655), FLOAT_FIXED(0.49112404976428), FLOAT_FIXED(-0.178410646261709)}, 
-    {FLOAT_FIXED(-0.534577066899585), FLOAT_FIXED(0.33038712469629), FLOAT_FIXED(-0.777863553189089)}, 
-    {FLOAT_FIXED(-0.807756949579629), FLOAT_FIXED(-0.470396936437217), FLOAT_FIXED(0.355324404729388)}, 
-    {FLOAT_FIXED(0.059498541064384), FLOAT_FIXED(0.93284779052617), FLOAT_FIXED(0.35532368809531)}, 
-    {FLOAT_FIXED(0.66169795430351), FLOAT_FIXED(-0.408937098061141), FLOAT_FIXED(-0.628431593015407)}, 
-    {FLOAT_FIXED(-0.90498917707395), FLOAT_FIXED(0.330384536003797), FLOAT_FIXED(-0.268031057432849)}, 
-    {FLOAT_FIXED(-0.393192860152942), FLOAT_FIXED(-0.408940121641844), FLOAT_FIXED(0.823509169127037)}, 
-    {FLOAT_FIXED(0.356318555166737), FLOAT_FIXED(0.932847928548662), FLOAT_FIXED(-0.0532149363088863)}, 
-    {FLOAT_FIXED(0.0883199861934043), FLOAT_FIXED(-0.47038967203819), FLOAT_FIXED(-0.878027981603434)}, 
-    {FLOAT_FIXED(-0.982245790136838), FLOAT_FIXED(0.187598528135109), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.187596724621492), FLOAT_FIXED(-0.982246134587094), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.0937967161157602), FLOAT_FIXED(0.491114447907121), FLOAT_FIXED(0.866030470077574)}, 
-    {FLOAT_FIXED(0.0937967161157601), FLOAT_FIXED(0.49111444790712), FLOAT_FIXED(-0.866030470077574)}, 
-    {FLOAT_FIXED(-0.90498917707395), FLOAT_FIXED(0.330384536003797), FLOAT_FIXED(0.268031057432849)}, 
-    {FLOAT_FIXED(0.0883199861934042), FLOAT_FIXED(-0.47038967203819), FLOAT_FIXED(0.878027981603434)}, 
-    {FLOAT_FIXED(0.356318555166737), FLOAT_FIXED(0.932847928548662), FLOAT_FIXED(0.0532149363088864)}, 
-    {FLOAT_FIXED(-0.393192860152942), FLOAT_FIXED(-0.408940121641844), FLOAT_FIXED(-0.823509169127037)}, 
-    {FLOAT_FIXED(-0.534577066899585), FLOAT_FIXED(0.33038712469629), FLOAT_FIXED(0.777863553189089)}, 
-    {FLOAT_FIXED(0.66169795430351), FLOAT_FIXED(-0.408937098061142), FLOAT_FIXED(0.628431593015407)}, 
-    {FLOAT_FIXED(0.059498541064384), FLOAT_FIXED(0.93284779052617), FLOAT_FIXED(-0.35532368809531)}, 
-    {FLOAT_FIXED(-0.807756949579629), FLOAT_FIXED(-0.470396936437217), FLOAT_FIXED(-0.355324404729388)}, 
-    {FLOAT_FIXED(-0.303530827693893), FLOAT_FIXED(0.187597238166362), FLOAT_FIXED(0.934171457962516)}, 
-    {FLOAT_FIXED(-0.057970525581305), FLOAT_FIXED(-0.982246123567499), FLOAT_FIXED(0.178415164435227)}, 
-    {FLOAT_FIXED(0.852623486096655), FLOAT_FIXED(0.49112404976428), FLOAT_FIXED(0.178410646261709)}, 
-    {FLOAT_FIXED(-0.794660588946598), FLOAT_FIXED(0.491113350122604), FLOAT_FIXED(-0.356822400791205)}, 
-    {FLOAT_FIXED(-0.0247473427402907), FLOAT_FIXED(0.330385129025), FLOAT_FIXED(0.943521719700415)}, 
-    {FLOAT_FIXED(0.862349423574725), FLOAT_FIXED(-0.470384593168889), FLOAT_FIXED(0.187328070960223)}, 
-    {FLOAT_FIXED(0.160722093885027), FLOAT_FIXED(0.932847677636309), FLOAT_FIXED(-0.32243389844394)}, 
-    {FLOAT_FIXED(-0.904702377620027), FLOAT_FIXED(-0.408950167846217), FLOAT_FIXED(0.119471202166966)}, 
-    {FLOAT_FIXED(0.574601042556898), FLOAT_FIXED(0.330386534894741), FLOAT_FIXED(0.748784601506183)}, 
-    {FLOAT_FIXED(0.802147795216185), FLOAT_FIXED(-0.408944272537728), FLOAT_FIXED(-0.435113199740484)}, 
-    {FLOAT_FIXED(-0.31954391384405), FLOAT_FIXED(0.932848358253816), FLOAT_FIXED(-0.166389986562852)}, 
-    {FLOAT_FIXED(-0.587543901024326), FLOAT_FIXED(-0.470397947283857), FLOAT_FIXED(0.658420789131275)}, 
-    {FLOAT_FIXED(0.79465487160021), FLOAT_FIXED(0.187595613401835), FLOAT_FIXED(0.57734869955205)}, 
-    {FLOAT_FIXED(0.151769398163908), FLOAT_FIXED(-0.982246099975475), FLOAT_FIXED(0.11026626348949)}, 
-    {FLOAT_FIXED(0.433149886232125), FLOAT_FIXED(0.491122210272826), FLOAT_FIXED(-0.755764613245308)}, 
-    {FLOAT_FIXED(-0.584920960329238), FLOAT_FIXED(0.491120491137006), FLOAT_FIXED(0.645498360457149)}, 
-    {FLOAT_FIXED(0.889697426542421), FLOAT_FIXED(0.33038431973485), FLOAT_FIXED(0.315094732544253)}, 
-    {FLOAT_FIXED(0.444634420333733), FLOAT_FIXED(-0.470390618822873), FLOAT_FIXED(-0.762255139686129)}, 
-    {FLOAT_FIXED(-0.256982032757219), FLOAT_FIXED(0.932848738257895), FLOAT_FIXED(-0.252494487802448)}, 
-    {FLOAT_FIXED(-0.165940328161748), FLOAT_FIXED(-0.408948214883463), FLOAT_FIXED(0.897343393040368)}, 
-    {FLOAT_FIXED(0.306568428140651), FLOAT_FIXED(0.125627826503172), FLOAT_FIXED(-0.943521832325813)}, 
-    {FLOAT_FIXED(0.0388220333050612), FLOAT_FIXED(-0.992077053614018), FLOAT_FIXED(-0.119482088291883)}, 
-    {FLOAT_FIXED(-0.806395528128607), FLOAT_FIXED(0.560922588302568), FLOAT_FIXED(-0.187328860953494)}, 
-    {FLOAT_FIXED(0.762487749838716), FLOAT_FIXED(0.560933894142262), FLOAT_FIXED(0.322436967093243)}, 
-    {FLOAT_FIXED(0.303530827693893), FLOAT_FIXED(-0.187597238166362), FLOAT_FIXED(-0.934171457962516)}, 
-    {FLOAT_FIXED(0.794660588946598), FLOAT_FIXED(-0.491113350122604), FLOAT_FIXED(0.356822400791204)}, 
-    {FLOAT_FIXED(-0.852623486096655), FLOAT_FIXED(-0.49112404976428), FLOAT_FIXED(-0.178410646261709)}, 
-    {FLOAT_FIXED(0.057970525581305), FLOAT_FIXED(0.982246123567499), FLOAT_FIXED(-0.178415164435227)}, 
-    {FLOAT_FIXED(0.0247473427402908), FLOAT_FIXED(-0.330385129025), FLOAT_FIXED(-0.943521719700415)}, 
-    {FLOAT_FIXED(-0.160722057722954), FLOAT_FIXED(-0.932848160449648), FLOAT_FIXED(0.322432519617684)}, 
-    {FLOAT_FIXED(-0.862349402564586), FLOAT_FIXED(0.470384312661783), FLOAT_FIXED(-0.187328872035796)}, 
-    {FLOAT_FIXED(0.904702377620027), FLOAT_FIXED(0.408950167846217), FLOAT_FIXED(-0.119471202166966)}, 
-    {FLOAT_FIXED(-0.802609358206668), FLOAT_FIXED(0.12562595177623), FLOAT_FIXED(-0.583126348538117)}, 
-    {FLOAT_FIXED(-0.101634249815188), FLOAT_FIXED(-0.992077598685001), FLOAT_FIXED(-0.0738411636684166)}, 
-    {FLOAT_FIXED(-0.427347893582228), FLOAT_FIXED(0.560926909865448), FLOAT_FIXED(0.709037925388785)}, 
-    {FLOAT_FIXED(0.542274189387007), FLOAT_FIXED(0.560933804619695), FLOAT_FIXED(-0.625533348718945)}, 
-    {FLOAT_FIXED(-0.79465487160021), FLOAT_FIXED(-0.187595613401835), FLOAT_FIXED(-0.57734869955205)}, 
-    {FLOAT_FIXED(0.584918853670119), FLOAT_FIXED(-0.491120988461398), FLOAT_FIXED(-0.645499891025501)}, 
-    {FLOAT_FIXED(-0.433149886232126), FLOAT_FIXED(-0.491122210272826), FLOAT_FIXED(0.755764613245308)}, 
-    {FLOAT_FIXED(-0.151768851549239), FLOAT_FIXED(0.982246229016347), FLOAT_FIXED(-0.110265866353059)}, 
-    {FLOAT_FIXED(-0.889697426542421), FLOAT_FIXED(-0.33038431973485), FLOAT_FIXED(-0.315094732544253)}, 
-    {FLOAT_FIXED(0.256982032757219), FLOAT_FIXED(-0.932848738257895), FLOAT_FIXED(0.252494487802448)}, 
-    {FLOAT_FIXED(-0.444638110063529), FLOAT_FIXED(0.470389248658304), FLOAT_FIXED(0.762253832936122)}, 
-    {FLOAT_FIXED(0.165940328161748), FLOAT_FIXED(0.408948214883463), FLOAT_FIXED(-0.897343393040368)}, 
-    {FLOAT_FIXED(-0.802609358206668), FLOAT_FIXED(0.12562595177623), FLOAT_FIXED(0.583126348538117)}, 
-    {FLOAT_FIXED(-0.101634249815188), FLOAT_FIXED(-0.992077598685001), FLOAT_FIXED(0.0738411636684166)}, 
-    {FLOAT_FIXED(0.542274189387007), FLOAT_FIXED(0.560933804619695), FLOAT_FIXED(0.625533348718945)}, 
-    {FLOAT_FIXED(-0.427346868887418), FLOAT_FIXED(0.560926749476066), FLOAT_FIXED(-0.709038669872338)}, 
-    {FLOAT_FIXED(-0.79465487160021), FLOAT_FIXED(-0.187595613401835), FLOAT_FIXED(0.57734869955205)}, 
-    {FLOAT_FIXED(-0.433149886232125), FLOAT_FIXED(-0.491122210272826), FLOAT_FIXED(-0.755764613245308)}, 
-    {FLOAT_FIXED(0.584920960329238), FLOAT_FIXED(-0.491120491137006), FLOAT_FIXED(0.645498360457149)}, 
-    {FLOAT_FIXED(-0.151769398163908), FLOAT_FIXED(0.982246099975475), FLOAT_FIXED(0.11026626348949)}, 
-    {FLOAT_FIXED(-0.574601042556898), FLOAT_FIXED(-0.330386534894741), FLOAT_FIXED(0.748784601506183)}, 
-    {FLOAT_FIXED(0.319545511045693), FLOAT_FIXED(-0.932847439885121), FLOAT_FIXED(-0.166392067930904)}, 
-    {FLOAT_FIXED(0.587543901024326), FLOAT_FIXED(0.470397947283857), FLOAT_FIXED(0.658420789131275)}, 
-    {FLOAT_FIXED(-0.802147795216185), FLOAT_FIXED(0.408944272537728), FLOAT_FIXED(-0.435113199740484)}, 
-    {FLOAT_FIXED(0.306568428140651), FLOAT_FIXED(0.125627826503172), FLOAT_FIXED(0.943521832325813)}, 
-    {FLOAT_FIXED(0.0388220333050612), FLOAT_FIXED(-0.992077053614018), FLOAT_FIXED(0.119482088291883)}, 
-    {FLOAT_FIXED(0.762488977242179), FLOAT_FIXED(0.560934397123562), FLOAT_FIXED(-0.322433189525834)}, 
-    {FLOAT_FIXED(-0.806396047223857), FLOAT_FIXED(0.560922375582566), FLOAT_FIXED(0.187327263345594)}, 
-    {FLOAT_FIXED(0.303530827693893), FLOAT_FIXED(-0.187597238166362), FLOAT_FIXED(0.934171457962516)}, 
-    {FLOAT_FIXED(-0.852623486096655), FLOAT_FIXED(-0.49112404976428), FLOAT_FIXED(0.178410646261709)}, 
-    {FLOAT_FIXED(0.794660588946598), FLOAT_FIXED(-0.491113350122604), FLOAT_FIXED(-0.356822400791205)}, 
-    {FLOAT_FIXED(0.057970525581305), FLOAT_FIXED(0.982246123567499), FLOAT_FIXED(0.178415164435227)}, 
-    {FLOAT_FIXED(0.534577066899585), FLOAT_FIXED(-0.33038712469629), FLOAT_FIXED(0.777863553189089)}, 
-    {FLOAT_FIXED(-0.059498541064384), FLOAT_FIXED(-0.93284779052617), FLOAT_FIXED(-0.35532368809531)}, 
-    {FLOAT_FIXED(0.807756949579629), FLOAT_FIXED(0.470396936437217), FLOAT_FIXED(-0.355324404729388)}, 
-    {FLOAT_FIXED(-0.66169795430351), FLOAT_FIXED(0.408937098061142), FLOAT_FIXED(0.628431593015407)}, 
-    {FLOAT_FIXED(0.992077562777056), FLOAT_FIXED(0.125626865893947), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.125626601548217), FLOAT_FIXED(-0.992077596251143), FLOAT_FIXED(-7.36782498446783e-18)}, 
-    {FLOAT_FIXED(-0.0710297005743964), FLOAT_FIXED(0.560926552724951), FLOAT_FIXED(-0.824812817604343)}, 
-    {FLOAT_FIXED(-0.0710300199525896), FLOAT_FIXED(0.560926512281634), FLOAT_FIXED(0.824812817604756)}, 
-    {FLOAT_FIXED(0.982245790136838), FLOAT_FIXED(-0.187598528135109), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.0937967161157602), FLOAT_FIXED(-0.491114447907121), FLOAT_FIXED(0.866030470077574)}, 
-    {FLOAT_FIXED(-0.0937967161157601), FLOAT_FIXED(-0.49111444790712), FLOAT_FIXED(-0.866030470077574)}, 
-    {FLOAT_FIXED(0.187596724621492), FLOAT_FIXED(0.982246134587094), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.90498917707395), FLOAT_FIXED(-0.330384536003797), FLOAT_FIXED(-0.268031057432849)}, 
-    {FLOAT_FIXED(-0.356318555166737), FLOAT_FIXED(-0.932847928548662), FLOAT_FIXED(-0.0532149363088863)}, 
-    {FLOAT_FIXED(-0.0883199861934043), FLOAT_FIXED(0.47038967203819), FLOAT_FIXED(-0.878027981603434)}, 
-    {FLOAT_FIXED(0.393192860152942), FLOAT_FIXED(0.408940121641844), FLOAT_FIXED(0.823509169127037)}, 
-    {FLOAT_FIXED(0.471299513973557), FLOAT_FIXED(-0.66169887498798), FLOAT_FIXED(-0.58312208581731)}, 
-    {FLOAT_FIXED(-0.84189164128228), FLOAT_FIXED(-0.534570479793166), FLOAT_FIXED(-0.0738435269521556)}, 
-    {FLOAT_FIXED(0.259206250718806), FLOAT_FIXED(0.735879139884828), FLOAT_FIXED(-0.625534979893742)}, 
-    {FLOAT_FIXED(0.692825324018191), FLOAT_FIXED(-0.131373046469314), FLOAT_FIXED(0.709037511744238)}, 
-    {FLOAT_FIXED(0.187595449128905), FLOAT_FIXED(-0.794657500243018), FLOAT_FIXED(-0.577345134883496)}, 
-    {FLOAT_FIXED(-0.245566361420215), FLOAT_FIXED(-0.607057314335825), FLOAT_FIXED(0.755763573646026)}, 
-    {FLOAT_FIXED(-0.700856284265517), FLOAT_FIXED(0.303527383618913), FLOAT_FIXED(-0.645501042755927)}, 
-    {FLOAT_FIXED(0.946422221623738), FLOAT_FIXED(0.303525770525193), FLOAT_FIXED(-0.110259172153054)}, 
-    {FLOAT_FIXED(-0.0385299741187642), FLOAT_FIXED(-0.661698418442112), FLOAT_FIXED(-0.748779436233137)}, 
-    {FLOAT_FIXED(-0.977270961766597), FLOAT_FIXED(-0.131372794914534), FLOAT_FIXED(0.166381056746656)}, 
-    {FLOAT_FIXED(0.157984959327919), FLOAT_FIXED(0.735876689573299), FLOAT_FIXED(-0.65842710330666)}, 
-    {FLOAT_FIXED(0.724504038086459), FLOAT_FIXED(-0.534568719601134), FLOAT_FIXED(0.43512088299738)}, 
-    {FLOAT_FIXED(-0.408946244025195), FLOAT_FIXED(-0.661697843178942), FLOAT_FIXED(-0.628425758407484)}, 
-    {FLOAT_FIXED(-0.330382709812526), FLOAT_FIXED(-0.534570376026616), FLOAT_FIXED(0.777870026502946)}, 
-    {FLOAT_FIXED(-0.514819192138234), FLOAT_FIXED(0.735878298518671), FLOAT_FIXED(-0.439823065760997)}, 
-    {FLOAT_FIXED(0.88842959505093), FLOAT_FIXED(-0.13137437753798), FLOAT_FIXED(-0.439810899778699)}, 
-    {FLOAT_FIXED(-0.491120243632891), FLOAT_FIXED(-0.794656412793058), FLOAT_FIXED(-0.356822213295134)}, 
-    {FLOAT_FIXED(0.642885520775662), FLOAT_FIXED(-0.607059414555558), FLOAT_FIXED(0.46709428852906)}, 
-    {FLOAT_FIXED(-0.830482714496976), FLOAT_FIXED(0.303529601982392), FLOAT_FIXED(0.467084833453351)}, 
-    {FLOAT_FIXED(0.187594121301092), FLOAT_FIXED(0.303530588732124), FLOAT_FIXED(-0.934172161519065)}, 
-    {FLOAT_FIXED(-0.724041723518963), FLOAT_FIXED(-0.661696059192217), FLOAT_FIXED(-0.194735481751987)}, 
-    {FLOAT_FIXED(-0.143748773959571), FLOAT_FIXED(-0.131370522124446), FLOAT_FIXED(0.980855787515102)}, 
-    {FLOAT_FIXED(-0.577378930232565), FLOAT_FIXED(0.735878363152822), FLOAT_FIXED(-0.35371825732781)}, 
-    {FLOAT_FIXED(0.637701864065336), FLOAT_FIXED(-0.534573860245707), FLOAT_FIXED(-0.554587342543624)}, 
-    {FLOAT_FIXED(-0.724041723518963), FLOAT_FIXED(-0.661696059192217), FLOAT_FIXED(0.194735481751987)}, 
-    {FLOAT_FIXED(0.637701525643507), FLOAT_FIXED(-0.534574169525582), FLOAT_FIXED(0.554587433564787)}, 
-    {FLOAT_FIXED(-0.577376515390553), FLOAT_FIXED(0.735880570053462), FLOAT_FIXED(0.353717607836046)}, 
-    {FLOAT_FIXED(-0.143748773959571), FLOAT_FIXED(-0.131370522124446), FLOAT_FIXED(-0.980855787515102)}, 
-    {FLOAT_FIXED(-0.491120243632891), FLOAT_FIXED(-0.794656412793059), FLOAT_FIXED(0.356822213295133)}, 
-    {FLOAT_FIXED(0.642888303014743), FLOAT_FIXED(-0.607054912727975), FLOAT_FIXED(-0.467096309961506)}, 
-    {FLOAT_FIXED(0.187594121301092), FLOAT_FIXED(0.303530588732123), FLOAT_FIXED(0.934172161519065)}, 
-    {FLOAT_FIXED(-0.830482714496976), FLOAT_FIXED(0.303529601982392), FLOAT_FIXED(-0.467084833453351)}, 
-    {FLOAT_FIXED(-0.408946244025195), FLOAT_FIXED(-0.661697843178942), FLOAT_FIXED(0.628425758407484)}, 
-    {FLOAT_FIXED(0.88842959505093), FLOAT_FIXED(-0.13137437753798), FLOAT_FIXED(0.439810899778699)}, 
-    {FLOAT_FIXED(-0.514818237936938), FLOAT_FIXED(0.735879842465061), FLOAT_FIXED(0.439821599448121)}, 
-    {FLOAT_FIXED(-0.330382331358325), FLOAT_FIXED(-0.534569763665879), FLOAT_FIXED(-0.777870608070805)}, 
-    {FLOAT_FIXED(0.700224776051499), FLOAT_FIXED(-0.661698404555919), FLOAT_FIXED(-0.268030752735166)}, 
-    {FLOAT_FIXED(-0.189931609766156), FLOAT_FIXED(-0.534566392039972), FLOAT_FIXED(0.823507593233361)}, 
-    {FLOAT_FIXED(-0.460232427510481), FLOAT_FIXED(-0.131372827841589), FLOAT_FIXED(-0.87802465385245)}, 
-    {FLOAT_FIXED(0.675018562316607), FLOAT_FIXED(0.735879096559182), FLOAT_FIXED(-0.0532155595222279)}, 
-    {FLOAT_FIXED(0.607060361244373), FLOAT_FIXED(-0.794655722817027), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.397323004982757), FLOAT_FIXED(0.303526113946088), FLOAT_FIXED(0.866029057170866)}, 
-    {FLOAT_FIXED(-0.794656066980602), FLOAT_FIXED(-0.607059910726215), FLOAT_FIXED(2.94713345749881e-17)}, 
-    {FLOAT_FIXED(0.397323004982757), FLOAT_FIXED(0.303526113946088), FLOAT_FIXED(-0.866029057170865)}, 
-    {FLOAT_FIXED(0.331305391889576), FLOAT_FIXED(-0.943523575383728), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.533476187403313), FLOAT_FIXED(-0.187323232152268), FLOAT_FIXED(0.824810986935585)}, 
-    {FLOAT_FIXED(-0.53347698845549), FLOAT_FIXED(-0.187320950831113), FLOAT_FIXED(-0.824810986934697)}, 
-    {FLOAT_FIXED(0.943524787988278), FLOAT_FIXED(0.331301938496706), FLOAT_FIXED(1.47356655009898e-17)}, 
-    {FLOAT_FIXED(-0.0385299741187642), FLOAT_FIXED(-0.661698418442112), FLOAT_FIXED(0.748779436233137)}, 
-    {FLOAT_FIXED(0.724504038086459), FLOAT_FIXED(-0.534568719601134), FLOAT_FIXED(-0.43512088299738)}, 
-    {FLOAT_FIXED(0.157984959327919), FLOAT_FIXED(0.735876689573299), FLOAT_FIXED(0.65842710330666)}, 
-    {FLOAT_FIXED(-0.977270961766597), FLOAT_FIXED(-0.131372794914534), FLOAT_FIXED(-0.166381056746656)}, 
-    {FLOAT_FIXED(0.187595449128905), FLOAT_FIXED(-0.794657500243018), FLOAT_FIXED(0.577345134883496)}, 
-    {FLOAT_FIXED(-0.245566054069138), FLOAT_FIXED(-0.607058616290919), FLOAT_FIXED(-0.755762627731663)}, 
-    {FLOAT_FIXED(0.946422315369149), FLOAT_FIXED(0.303525373411168), FLOAT_FIXED(0.110259460668512)}, 
-    {FLOAT_FIXED(-0.700856284265517), FLOAT_FIXED(0.303527383618913), FLOAT_FIXED(0.645501042755927)}, 
-    {FLOAT_FIXED(0.471299513973557), FLOAT_FIXED(-0.66169887498798), FLOAT_FIXED(0.58312208581731)}, 
-    {FLOAT_FIXED(0.692825324018191), FLOAT_FIXED(-0.131373046469314), FLOAT_FIXED(-0.709037511744238)}, 
-    {FLOAT_FIXED(0.259207586911062), FLOAT_FIXED(0.735877263896961), FLOAT_FIXED(0.625536633113735)}, 
-    {FLOAT_FIXED(-0.84189164128228), FLOAT_FIXED(-0.534570479793166), FLOAT_FIXED(0.0738435269521556)}, 
-    {FLOAT_FIXED(0.291569477496466), FLOAT_FIXED(0.331305105652493), FLOAT_FIXED(0.89734283680265)}, 
-    {FLOAT_FIXED(-0.94929441572116), FLOAT_FIXED(-0.187327826742748), FLOAT_FIXED(-0.25248445023102)}, 
-    {FLOAT_FIXED(-0.4602309599189), FLOAT_FIXED(-0.13137084289217), FLOAT_FIXED(0.878025720107292)}, 
-    {FLOAT_FIXED(-0.189931931511935), FLOAT_FIXED(-0.534566637828144), FLOAT_FIXED(-0.823507359477291)}, 
-    {FLOAT_FIXED(0.675020991682643), FLOAT_FIXED(0.735876894723774), FLOAT_FIXED(0.0532151914351251)}, 
-    {FLOAT_FIXED(0.916405711064153), FLOAT_FIXED(-0.187329967460415), FLOAT_FIXED(0.353706171871915)}, 
-    {FLOAT_FIXED(-0.763321382284837), FLOAT_FIXED(0.331306037675386), FLOAT_FIXED(0.554596048260896)}, 
-    {FLOAT_FIXED(-0.0532148109527238), FLOAT_FIXED(-0.187323446071715), FLOAT_FIXED(-0.980855805124833)}, 
-    {FLOAT_FIXED(-0.0532145187430508), FLOAT_FIXED(-0.187322417453517), FLOAT_FIXED(0.980856017422698)}, 
-    {FLOAT_FIXED(-0.763321653539839), FLOAT_FIXED(0.331305082810147), FLOAT_FIXED(-0.554596245336522)}, 
-    {FLOAT_FIXED(0.91640725400176), FLOAT_FIXED(-0.187324536054702), FLOAT_FIXED(-0.35370505086137)}, 
-    {FLOAT_FIXED(-0.949294856216725), FLOAT_FIXED(-0.187323767253324), FLOAT_FIXED(0.252485805903005)}, 
-    {FLOAT_FIXED(0.291569342202624), FLOAT_FIXED(0.331306352497669), FLOAT_FIXED(-0.897342420418326)}, 
-    {FLOAT_FIXED(0.619578909588332), FLOAT_FIXED(-0.187325247400767), FLOAT_FIXED(0.762254043268761)}, 
-    {FLOAT_FIXED(-0.356313815734208), FLOAT_FIXED(-0.932849520063771), FLOAT_FIXED(0.0532187714412923)}, 
-    {FLOAT_FIXED(0.393192860152941), FLOAT_FIXED(0.408940121641844), FLOAT_FIXED(-0.823509169127037)}, 
-    {FLOAT_FIXED(-0.0883212623908994), FLOAT_FIXED(0.470390816186866), FLOAT_FIXED(0.87802724027033)}, 
-    {FLOAT_FIXED(-0.160722639831437), FLOAT_FIXED(-0.932848075692266), FLOAT_FIXED(-0.322432474671597)}, 
-    {FLOAT_FIXED(-0.862349229229514), FLOAT_FIXED(0.470384593132978), FLOAT_FIXED(0.187328965700412)}, 
-    {FLOAT_FIXED(0.256985150253809), FLOAT_FIXED(-0.932847096189708), FLOAT_FIXED(-0.252497381529903)}, 
-    {FLOAT_FIXED(0.165941111494943), FLOAT_FIXED(0.40894823496828), FLOAT_FIXED(0.89734323902961)}, 
-    {FLOAT_FIXED(-0.444638283550376), FLOAT_FIXED(0.470390618653), FLOAT_FIXED(-0.762252886307834)}, 
-    {FLOAT_FIXED(0.319544759368208), FLOAT_FIXED(-0.932848197040693), FLOAT_FIXED(0.166389266595664)}, 
-    {FLOAT_FIXED(-0.802147697088026), FLOAT_FIXED(0.408944277610582), FLOAT_FIXED(0.435113375875685)}, 
-    {FLOAT_FIXED(0.587541499924456), FLOAT_FIXED(0.470397947130479), FLOAT_FIXED(-0.658422931862151)}, 
-    {FLOAT_FIXED(-0.0594985410643842), FLOAT_FIXED(-0.93284779052617), FLOAT_FIXED(0.35532368809531)}, 
-    {FLOAT_FIXED(-0.66169795430351), FLOAT_FIXED(0.408937098061142), FLOAT_FIXED(-0.628431593015407)}, 
-    {FLOAT_FIXED(0.807756949579629), FLOAT_FIXED(0.470396936437217), FLOAT_FIXED(0.355324404729387)}, 
-    {FLOAT_FIXED(0.427347679087098), FLOAT_FIXED(-0.560927331612471), FLOAT_FIXED(-0.709037721019823)}, 
-    {FLOAT_FIXED(-0.542273924375442), FLOAT_FIXED(-0.560933727371327), FLOAT_FIXED(0.625533647727896)}, 
-    {FLOAT_FIXED(0.80639518244172), FLOAT_FIXED(-0.560923147652988), FLOAT_FIXED(0.187328674158148)}, 
-    {FLOAT_FIXED(-0.76248682893619), FLOAT_FIXED(-0.560935216710969), FLOAT_FIXED(-0.322436843974523)}, 
-    {FLOAT_FIXED(0.0710297140410188), FLOAT_FIXED(-0.560926659071817), FLOAT_FIXED(0.824812744121828)}, 
-    {FLOAT_FIXED(-0.125626601548217), FLOAT_FIXED(0.992077596251143), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.071030033419333), FLOAT_FIXED(-0.560926618628971), FLOAT_FIXED(-0.824812744121911)}, 
-    {FLOAT_FIXED(-0.762488056344733), FLOAT_FIXED(-0.56093571968805), FLOAT_FIXED(0.322433066402441)}, 
-    {FLOAT_FIXED(0.806395701536726), FLOAT_FIXED(-0.560922934934634), FLOAT_FIXED(-0.187327076546365)}, 
-    {FLOAT_FIXED(-0.542273924375442), FLOAT_FIXED(-0.560933727371327), FLOAT_FIXED(-0.625533647727896)}, 
-    {FLOAT_FIXED(0.427346654390904), FLOAT_FIXED(-0.560927171225732), FLOAT_FIXED(0.709038465502119)}, 
-    {FLOAT_FIXED(0.514818482389691), FLOAT_FIXED(-0.73587843384353), FLOAT_FIXED(0.439823670115615)}, 
-    {FLOAT_FIXED(0.330382990852021), FLOAT_FIXED(0.534570202335177), FLOAT_FIXED(-0.777870026502501)}, 
-    {FLOAT_FIXED(-0.888429788437376), FLOAT_FIXED(0.131373806106043), FLOAT_FIXED(0.439810679822956)}, 
-    {FLOAT_FIXED(-0.259205285830421), FLOAT_FIXED(-0.735878975451938), FLOAT_FIXED(0.625535573157416)}, 
-    {FLOAT_FIXED(0.841891830424297), FLOAT_FIXED(0.534570195520387), FLOAT_FIXED(0.0738434284559065)}, 
-    {FLOAT_FIXED(-0.675018849418017), FLOAT_FIXED(-0.735878919119447), FLOAT_FIXED(-0.053214371423239)}, 
-    {FLOAT_FIXED(0.189932848504726), FLOAT_FIXED(0.534565771289138), FLOAT_FIXED(0.823507710482986)}, 
-    {FLOAT_FIXED(0.460235623953299), FLOAT_FIXED(0.131366435462866), FLOAT_FIXED(-0.878023934797963)}, 
-    {FLOAT_FIXED(-0.157986263009859), FLOAT_FIXED(-0.735878491125262), FLOAT_FIXED(-0.658424777024215)}, 
-    {FLOAT_FIXED(-0.72450414882394), FLOAT_FIXED(0.534568635005896), FLOAT_FIXED(0.435120802542043)}, 
-    {FLOAT_FIXED(0.977271034816845), FLOAT_FIXED(0.131373011465245), FLOAT_FIXED(0.166380456684571)}, 
-    {FLOAT_FIXED(0.577376007298826), FLOAT_FIXED(-0.735880376604819), FLOAT_FIXED(-0.353718839650388)}, 
-    {FLOAT_FIXED(-0.637701481780005), FLOAT_FIXED(0.534574081800199), FLOAT_FIXED(-0.554587568561594)}, 
-    {FLOAT_FIXED(0.14374812480194), FLOAT_FIXED(0.131370285175594), FLOAT_FIXED(0.980855914387434)}, 
-    {FLOAT_FIXED(0.763321653539839), FLOAT_FIXED(-0.331305082810147), FLOAT_FIXED(-0.554596245336522)}, 
-    {FLOAT_FIXED(-0.91640725400176), FLOAT_FIXED(0.187324536054702), FLOAT_FIXED(-0.35370505086137)}, 
-    {FLOAT_FIXED(0.0532148109527238), FLOAT_FIXED(0.187323446071715), FLOAT_FIXED(0.980855805124832)}, 
-    {FLOAT_FIXED(0.830483555517136), FLOAT_FIXED(-0.30352752239267), FLOAT_FIXED(0.467084689500506)}, 
-    {FLOAT_FIXED(-0.187592995093421), FLOAT_FIXED(-0.303531284751839), FLOAT_FIXED(-0.934172161525261)}, 
-    {FLOAT_FIXED(-0.642887114226315), FLOAT_FIXED(0.607054912725488), FLOAT_FIXED(0.467097946150067)}, 
-    {FLOAT_FIXED(0.514817528191025), FLOAT_FIXED(-0.735879977787541), FLOAT_FIXED(-0.43982220380364)}, 
-    {FLOAT_FIXED(-0.888429544941085), FLOAT_FIXED(0.131374200098127), FLOAT_FIXED(-0.439811054004277)}, 
-    {FLOAT_FIXED(0.330382990852021), FLOAT_FIXED(0.534570202335177), FLOAT_FIXED(0.777870026502501)}, 
-    {FLOAT_FIXED(-0.291569477496466), FLOAT_FIXED(-0.331305105652493), FLOAT_FIXED(-0.897342836802651)}, 
-    {FLOAT_FIXED(-0.619578909588332), FLOAT_FIXED(0.187325247400767), FLOAT_FIXED(0.762254043268761)}, 
-    {FLOAT_FIXED(0.949294856216725), FLOAT_FIXED(0.187323767253324), FLOAT_FIXED(0.252485805903005)}, 
-    {FLOAT_FIXED(0.700856378755326), FLOAT_FIXED(-0.303525785780136), FLOAT_FIXED(-0.645501691496252)}, 
-    {FLOAT_FIXED(-0.946422268474209), FLOAT_FIXED(-0.303525467203312), FLOAT_FIXED(-0.110259605001755)}, 
-    {FLOAT_FIXED(0.245565805137918), FLOAT_FIXED(0.607057314334822), FLOAT_FIXED(0.755763754396544)}, 
-    {FLOAT_FIXED(-0.259206622021394), FLOAT_FIXED(-0.735877099461856), FLOAT_FIXED(-0.625537226380544)}, 
-    {FLOAT_FIXED(0.841891830424297), FLOAT_FIXED(0.534570195520387), FLOAT_FIXED(-0.0738434284559065)}, 
-    {FLOAT_FIXED(-0.943524787988278), FLOAT_FIXED(-0.331301938496706), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.533477748103409), FLOAT_FIXED(0.187321217567961), FLOAT_FIXED(0.824810435025753)}, 
-    {FLOAT_FIXED(0.533476947048951), FLOAT_FIXED(0.187323498891964), FLOAT_FIXED(-0.824810435027469)}, 
-    {FLOAT_FIXED(0.794656066980602), FLOAT_FIXED(0.607059910726215), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.675020991682643), FLOAT_FIXED(-0.735876894723774), FLOAT_FIXED(0.0532151914351251)}, 
-    {FLOAT_FIXED(0.4602309599189), FLOAT_FIXED(0.13137084289217), FLOAT_FIXED(0.878025720107292)}, 
-    {FLOAT_FIXED(0.189931931511935), FLOAT_FIXED(0.534566637828144), FLOAT_FIXED(-0.823507359477291)}, 
-    {FLOAT_FIXED(-0.291569342202623), FLOAT_FIXED(-0.331306352497669), FLOAT_FIXED(0.897342420418326)}, 
-    {FLOAT_FIXED(0.949294856216725), FLOAT_FIXED(0.187323767253324), FLOAT_FIXED(-0.252485805903005)}, 
-    {FLOAT_FIXED(-0.946422174728798), FLOAT_FIXED(-0.303525864317613), FLOAT_FIXED(0.110259316485541)}, 
-    {FLOAT_FIXED(0.700856683890112), FLOAT_FIXED(-0.303527078336524), FLOAT_FIXED(0.645500752410909)}, 
-    {FLOAT_FIXED(0.245565497783892), FLOAT_FIXED(0.60705861629192), FLOAT_FIXED(-0.75576280848153)}, 
-    {FLOAT_FIXED(-0.157986148029438), FLOAT_FIXED(-0.735876516494887), FLOAT_FIXED(0.658427011522288)}, 
-    {FLOAT_FIXED(0.977271034816844), FLOAT_FIXED(0.131373011465245), FLOAT_FIXED(-0.166380456684571)}, 
-    {FLOAT_FIXED(-0.72450414882394), FLOAT_FIXED(0.534568635005895), FLOAT_FIXED(-0.435120802542043)}, 
-    {FLOAT_FIXED(0.763321653539839), FLOAT_FIXED(-0.331305082810147), FLOAT_FIXED(0.554596245336522)}, 
-    {FLOAT_FIXED(0.0532148109527238), FLOAT_FIXED(0.187323446071715), FLOAT_FIXED(-0.980855805124833)}, 
-    {FLOAT_FIXED(-0.916405711064153), FLOAT_FIXED(0.187329967460415), FLOAT_FIXED(0.353706171871915)}, 
-    {FLOAT_FIXED(-0.187592995093421), FLOAT_FIXED(-0.303531284751839), FLOAT_FIXED(0.934172161525261)}, 
-    {FLOAT_FIXED(0.830482515830562), FLOAT_FIXED(-0.303529204655855), FLOAT_FIXED(-0.467085444882117)}, 
-    {FLOAT_FIXED(-0.642884331988245), FLOAT_FIXED(0.60705941454879), FLOAT_FIXED(-0.467095924721794)}, 
-    {FLOAT_FIXED(0.577378422141727), FLOAT_FIXED(-0.735878169705339), FLOAT_FIXED(0.353719489138287)}, 
-    {FLOAT_FIXED(0.14374812480194), FLOAT_FIXED(0.131370285175594), FLOAT_FIXED(-0.980855914387434)}, 
-    {FLOAT_FIXED(-0.637701820201701), FLOAT_FIXED(0.534573772519641), FLOAT_FIXED(0.55458747754124)}, 
-    {FLOAT_FIXED(-0.165941111494943), FLOAT_FIXED(-0.40894823496828), FLOAT_FIXED(-0.89734323902961)}, 
-    {FLOAT_FIXED(-0.256985150253809), FLOAT_FIXED(0.932847096189708), FLOAT_FIXED(0.252497381529903)}, 
-    {FLOAT_FIXED(0.444634593813916), FLOAT_FIXED(-0.470391988816407), FLOAT_FIXED(0.762254193062445)}, 
-    {FLOAT_FIXED(0.151769253823949), FLOAT_FIXED(-0.982246099975502), FLOAT_FIXED(-0.110266462157077)}, 
-    {FLOAT_FIXED(-0.584920806580102), FLOAT_FIXED(0.491121296205112), FLOAT_FIXED(-0.645497887249442)}, 
-    {FLOAT_FIXED(0.433149886232125), FLOAT_FIXED(0.491122210272826), FLOAT_FIXED(0.755764613245309)}, 
-    {FLOAT_FIXED(-0.587541499924456), FLOAT_FIXED(-0.470397947130479), FLOAT_FIXED(-0.658422931862151)}, 
-    {FLOAT_FIXED(-0.319544759368208), FLOAT_FIXED(0.932848197040693), FLOAT_FIXED(0.166389266595664)}, 
-    {FLOAT_FIXED(0.802147697088026), FLOAT_FIXED(-0.408944277610582), FLOAT_FIXED(0.435113375875685)}, 
-    {FLOAT_FIXED(-0.904702377620028), FLOAT_FIXED(-0.408950167846217), FLOAT_FIXED(-0.119471202166966)}, 
-    {FLOAT_FIXED(0.160722675995995), FLOAT_FIXED(0.932847592878633), FLOAT_FIXED(0.322433853497469)}, 
-    {FLOAT_FIXED(0.862349250240405), FLOAT_FIXED(-0.470384873639025), FLOAT_FIXED(-0.187328164624038)}, 
-    {FLOAT_FIXED(-0.0579705350390622), FLOAT_FIXED(-0.982246172856674), FLOAT_FIXED(-0.178414890005577)}, 
-    {FLOAT_FIXED(0.852625245806156), FLOAT_FIXED(0.491122151303977), FLOAT_FIXED(-0.178407462603294)}, 
-    {FLOAT_FIXED(-0.807756949579629), FLOAT_FIXED(-0.470396936437217), FLOAT_FIXED(0.355324404729387)}, 
-    {FLOAT_FIXED(0.059498541064384), FLOAT_FIXED(0.93284779052617), FLOAT_FIXED(0.355323688095309)}, 
-    {FLOAT_FIXED(0.66169795430351), FLOAT_FIXED(-0.408937098061142), FLOAT_FIXED(-0.628431593015407)}, 
-    {FLOAT_FIXED(-0.393192860152941), FLOAT_FIXED(-0.408940121641844), FLOAT_FIXED(0.823509169127037)}, 
-    {FLOAT_FIXED(0.356313815734208), FLOAT_FIXED(0.932849520063771), FLOAT_FIXED(-0.0532187714412923)}, 
-    {FLOAT_FIXED(0.0883212623908995), FLOAT_FIXED(-0.470390816186866), FLOAT_FIXED(-0.87802724027033)}, 
-    {FLOAT_FIXED(0.0937967161157601), FLOAT_FIXED(0.49111444790712), FLOAT_FIXED(0.866030470077574)}, 
-    {FLOAT_FIXED(0.09379671611576), FLOAT_FIXED(0.49111444790712), FLOAT_FIXED(-0.866030470077574)}, 
-    {FLOAT_FIXED(0.0883212623908994), FLOAT_FIXED(-0.470390816186866), FLOAT_FIXED(0.87802724027033)}, 
-    {FLOAT_FIXED(0.356313815734208), FLOAT_FIXED(0.932849520063771), FLOAT_FIXED(0.0532187714412923)}, 
-    {FLOAT_FIXED(-0.393192860152941), FLOAT_FIXED(-0.408940121641844), FLOAT_FIXED(-0.823509169127037)}, 
-    {FLOAT_FIXED(0.66169795430351), FLOAT_FIXED(-0.408937098061141), FLOAT_FIXED(0.628431593015407)}, 
-    {FLOAT_FIXED(0.059498541064384), FLOAT_FIXED(0.93284779052617), FLOAT_FIXED(-0.355323688095309)}, 
-    {FLOAT_FIXED(-0.807756949579629), FLOAT_FIXED(-0.470396936437218), FLOAT_FIXED(-0.355324404729388)}, 
-    {FLOAT_FIXED(-0.0579705350390622), FLOAT_FIXED(-0.982246172856674), FLOAT_FIXED(0.178414890005577)}, 
-    {FLOAT_FIXED(0.852625245806156), FLOAT_FIXED(0.491122151303977), FLOAT_FIXED(0.178407462603294)}, 
-    {FLOAT_FIXED(-0.794660588946598), FLOAT_FIXED(0.491113350122604), FLOAT_FIXED(-0.356822400791204)}, 
-    {FLOAT_FIXED(0.862349229229514), FLOAT_FIXED(-0.470384593132978), FLOAT_FIXED(0.187328965700412)}, 
-    {FLOAT_FIXED(0.160722639831437), FLOAT_FIXED(0.932848075692266), FLOAT_FIXED(-0.322432474671597)}, 
-    {FLOAT_FIXED(0.802147697088026), FLOAT_FIXED(-0.408944277610582), FLOAT_FIXED(-0.435113375875685)}, 
-    {FLOAT_FIXED(-0.319546356563761), FLOAT_FIXED(0.932847278674166), FLOAT_FIXED(-0.166391347963253)}, 
-    {FLOAT_FIXED(-0.587541499924456), FLOAT_FIXED(-0.470397947130479), FLOAT_FIXED(0.658422931862151)}, 
-    {FLOAT_FIXED(0.151768707210319), FLOAT_FIXED(-0.982246229016251), FLOAT_FIXED(0.110266065020308)}, 
-    {FLOAT_FIXED(0.433149886232126), FLOAT_FIXED(0.491122210272826), FLOAT_FIXED(-0.755764613245308)}, 
-    {FLOAT_FIXED(-0.58491869992209), FLOAT_FIXED(0.491121793526474), FLOAT_FIXED(0.645499417819096)}, 
-    {FLOAT_FIXED(0.444638283550376), FLOAT_FIXED(-0.470390618653), FLOAT_FIXED(-0.762252886307834)}, 
-    {FLOAT_FIXED(-0.256985150253809), FLOAT_FIXED(0.932847096189708), FLOAT_FIXED(-0.252497381529903)}, 
-    {FLOAT_FIXED(-0.165941111494943), FLOAT_FIXED(-0.40894823496828), FLOAT_FIXED(0.89734323902961)}, 
-    {FLOAT_FIXED(-0.806395701536726), FLOAT_FIXED(0.560922934934634), FLOAT_FIXED(-0.187327076546365)}, 
-    {FLOAT_FIXED(0.762488056344733), FLOAT_FIXED(0.56093571968805), FLOAT_FIXED(0.322433066402441)}, 
-    {FLOAT_FIXED(-0.852625245806156), FLOAT_FIXED(-0.491122151303977), FLOAT_FIXED(-0.178407462603294)}, 
-    {FLOAT_FIXED(0.0579705350390622), FLOAT_FIXED(0.982246172856674), FLOAT_FIXED(-0.178414890005577)}, 
-    {FLOAT_FIXED(-0.160722675995995), FLOAT_FIXED(-0.932847592878633), FLOAT_FIXED(0.322433853497469)}, 
-    {FLOAT_FIXED(-0.862349250240405), FLOAT_FIXED(0.470384873639025), FLOAT_FIXED(-0.187328164624038)}, 
-    {FLOAT_FIXED(0.904702377620028), FLOAT_FIXED(0.408950167846217), FLOAT_FIXED(-0.119471202166966)}, 
-    {FLOAT_FIXED(-0.427346654390904), FLOAT_FIXED(0.560927171225732), FLOAT_FIXED(0.709038465502119)}, 
-    {FLOAT_FIXED(0.542273924375442), FLOAT_FIXED(0.560933727371327), FLOAT_FIXED(-0.625533647727896)}, 
-    {FLOAT_FIXED(0.584920806580102), FLOAT_FIXED(-0.491121296205112), FLOAT_FIXED(-0.645497887249442)}, 
-    {FLOAT_FIXED(-0.433149886232125), FLOAT_FIXED(-0.491122210272826), FLOAT_FIXED(0.755764613245309)}, 
-    {FLOAT_FIXED(-0.151769253823949), FLOAT_FIXED(0.982246099975502), FLOAT_FIXED(-0.110266462157077)}, 
-    {FLOAT_FIXED(0.256985150253809), FLOAT_FIXED(-0.932847096189708), FLOAT_FIXED(0.252497381529903)}, 
-    {FLOAT_FIXED(-0.444634593813916), FLOAT_FIXED(0.470391988816407), FLOAT_FIXED(0.762254193062445)}, 
-    {FLOAT_FIXED(0.165941111494943), FLOAT_FIXED(0.40894823496828), FLOAT_FIXED(-0.89734323902961)}, 
-    {FLOAT_FIXED(0.542273924375442), FLOAT_FIXED(0.560933727371327), FLOAT_FIXED(0.625533647727896)}, 
-    {FLOAT_FIXED(-0.427347679087098), FLOAT_FIXED(0.560927331612471), FLOAT_FIXED(-0.709037721019823)}, 
-    {FLOAT_FIXED(-0.433149886232126), FLOAT_FIXED(-0.491122210272826), FLOAT_FIXED(-0.755764613245308)}, 
-    {FLOAT_FIXED(0.58491869992209), FLOAT_FIXED(-0.491121793526474), FLOAT_FIXED(0.645499417819096)}, 
-    {FLOAT_FIXED(-0.151768707210319), FLOAT_FIXED(0.982246229016251), FLOAT_FIXED(0.110266065020308)}, 
-    {FLOAT_FIXED(0.319544759368208), FLOAT_FIXED(-0.932848197040693), FLOAT_FIXED(-0.166389266595664)}, 
-    {FLOAT_FIXED(0.587541499924456), FLOAT_FIXED(0.470397947130479), FLOAT_FIXED(0.658422931862151)}, 
-    {FLOAT_FIXED(-0.802147697088026), FLOAT_FIXED(0.408944277610582), FLOAT_FIXED(-0.435113375875685)}, 
-    {FLOAT_FIXED(0.76248682893619), FLOAT_FIXED(0.560935216710969), FLOAT_FIXED(-0.322436843974523)}, 
-    {FLOAT_FIXED(-0.80639518244172), FLOAT_FIXED(0.560923147652988), FLOAT_FIXED(0.187328674158148)}, 
-    {FLOAT_FIXED(-0.852625245806156), FLOAT_FIXED(-0.491122151303977), FLOAT_FIXED(0.178407462603294)}, 
-    {FLOAT_FIXED(0.794660588946598), FLOAT_FIXED(-0.491113350122604), FLOAT_FIXED(-0.356822400791204)}, 
-    {FLOAT_FIXED(0.0579705350390622), FLOAT_FIXED(0.982246172856674), FLOAT_FIXED(0.178414890005577)}, 
-    {FLOAT_FIXED(-0.059498541064384), FLOAT_FIXED(-0.93284779052617), FLOAT_FIXED(-0.355323688095309)}, 
-    {FLOAT_FIXED(0.807756949579629), FLOAT_FIXED(0.470396936437218), FLOAT_FIXED(-0.355324404729388)}, 
-    {FLOAT_FIXED(-0.66169795430351), FLOAT_FIXED(0.408937098061141), FLOAT_FIXED(0.628431593015407)}, 
-    {FLOAT_FIXED(0.125626601548217), FLOAT_FIXED(-0.992077596251143), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.071030033419333), FLOAT_FIXED(0.560926618628971), FLOAT_FIXED(-0.824812744121911)}, 
-    {FLOAT_FIXED(-0.0710297140410188), FLOAT_FIXED(0.560926659071817), FLOAT_FIXED(0.824812744121828)}, 
-    {FLOAT_FIXED(-0.0937967161157601), FLOAT_FIXED(-0.49111444790712), FLOAT_FIXED(0.866030470077574)}, 
-    {FLOAT_FIXED(-0.09379671611576), FLOAT_FIXED(-0.49111444790712), FLOAT_FIXED(-0.866030470077574)}, 
-    {FLOAT_FIXED(-0.356313815734208), FLOAT_FIXED(-0.932849520063771), FLOAT_FIXED(-0.0532187714412923)}, 
-    {FLOAT_FIXED(-0.0883212623908995), FLOAT_FIXED(0.470390816186866), FLOAT_FIXED(-0.87802724027033)}, 
-    {FLOAT_FIXED(0.393192860152941), FLOAT_FIXED(0.408940121641844), FLOAT_FIXED(0.823509169127037)}, 
-    {FLOAT_FIXED(-0.841891830424297), FLOAT_FIXED(-0.534570195520387), FLOAT_FIXED(-0.0738434284559065)}, 
-    {FLOAT_FIXED(0.259206622021394), FLOAT_FIXED(0.735877099461856), FLOAT_FIXED(-0.625537226380544)}, 
-    {FLOAT_FIXED(-0.245565497783892), FLOAT_FIXED(-0.60705861629192), FLOAT_FIXED(0.755762808481529)}, 
-    {FLOAT_FIXED(-0.700856378755326), FLOAT_FIXED(0.303525785780136), FLOAT_FIXED(-0.645501691496252)}, 
-    {FLOAT_FIXED(0.946422268474209), FLOAT_FIXED(0.303525467203312), FLOAT_FIXED(-0.110259605001755)}, 
-    {FLOAT_FIXED(-0.977271034816845), FLOAT_FIXED(-0.131373011465245), FLOAT_FIXED(0.166380456684571)}, 
-    {FLOAT_FIXED(0.157986263009859), FLOAT_FIXED(0.735878491125262), FLOAT_FIXED(-0.658424777024215)}, 
-    {FLOAT_FIXED(0.724504166189853), FLOAT_FIXED(-0.534568336761034), FLOAT_FIXED(0.435121140035838)}, 
-    {FLOAT_FIXED(-0.33038261239834), FLOAT_FIXED(-0.534569589976002), FLOAT_FIXED(0.777870608069065)}, 
-    {FLOAT_FIXED(-0.514817528191025), FLOAT_FIXED(0.735879977787541), FLOAT_FIXED(-0.43982220380364)}, 
-    {FLOAT_FIXED(0.888429788437376), FLOAT_FIXED(-0.131373806106044), FLOAT_FIXED(-0.439810679822956)}, 
-    {FLOAT_FIXED(0.642887114226315), FLOAT_FIXED(-0.607054912725488), FLOAT_FIXED(0.467097946150067)}, 
-    {FLOAT_FIXED(-0.830483555517136), FLOAT_FIXED(0.30352752239267), FLOAT_FIXED(0.467084689500506)}, 
-    {FLOAT_FIXED(0.187591173780983), FLOAT_FIXED(0.303528337779836), FLOAT_FIXED(-0.934173484789674)}, 
-    {FLOAT_FIXED(-0.14374812480194), FLOAT_FIXED(-0.131370285175594), FLOAT_FIXED(0.980855914387434)}, 
-    {FLOAT_FIXED(-0.577376007298826), FLOAT_FIXED(0.735880376604819), FLOAT_FIXED(-0.353718839650388)}, 
-    {FLOAT_FIXED(0.637701481780005), FLOAT_FIXED(-0.534574081800199), FLOAT_FIXED(-0.554587568561594)}, 
-    {FLOAT_FIXED(0.637701820201701), FLOAT_FIXED(-0.534573772519641), FLOAT_FIXED(0.55458747754124)}, 
-    {FLOAT_FIXED(-0.577378422141727), FLOAT_FIXED(0.735878169705339), FLOAT_FIXED(0.353719489138287)}, 
-    {FLOAT_FIXED(-0.14374812480194), FLOAT_FIXED(-0.131370285175594), FLOAT_FIXED(-0.980855914387434)}, 
-    {FLOAT_FIXED(0.642884331988245), FLOAT_FIXED(-0.60705941454879), FLOAT_FIXED(-0.467095924721794)}, 
-    {FLOAT_FIXED(0.187591173780983), FLOAT_FIXED(0.303528337779836), FLOAT_FIXED(0.934173484789674)}, 
-    {FLOAT_FIXED(-0.830483555517136), FLOAT_FIXED(0.30352752239267), FLOAT_FIXED(-0.467084689500506)}, 
-    {FLOAT_FIXED(0.888429788437376), FLOAT_FIXED(-0.131373806106043), FLOAT_FIXED(0.439810679822956)}, 
-    {FLOAT_FIXED(-0.514818482389691), FLOAT_FIXED(0.73587843384353), FLOAT_FIXED(0.439823670115615)}, 
-    {FLOAT_FIXED(-0.330382990852021), FLOAT_FIXED(-0.534570202335177), FLOAT_FIXED(-0.777870026502501)}, 
-    {FLOAT_FIXED(-0.189932848504726), FLOAT_FIXED(-0.534565771289138), FLOAT_FIXED(0.823507710482986)}, 
-    {FLOAT_FIXED(-0.460235623953299), FLOAT_FIXED(-0.131366435462866), FLOAT_FIXED(-0.878023934797963)}, 
-    {FLOAT_FIXED(0.675020991682643), FLOAT_FIXED(0.735876894723774), FLOAT_FIXED(-0.0532151914351251)}, 
-    {FLOAT_FIXED(-0.794656066980602), FLOAT_FIXED(-0.607059910726215), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.533477748103409), FLOAT_FIXED(-0.187321217567961), FLOAT_FIXED(0.824810435025753)}, 
-    {FLOAT_FIXED(-0.533476947048951), FLOAT_FIXED(-0.187323498891964), FLOAT_FIXED(-0.824810435027469)}, 
-    {FLOAT_FIXED(0.943524787988278), FLOAT_FIXED(0.331301938496706), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.724504166189853), FLOAT_FIXED(-0.534568336761034), FLOAT_FIXED(-0.435121140035838)}, 
-    {FLOAT_FIXED(0.157986263009859), FLOAT_FIXED(0.735878491125262), FLOAT_FIXED(0.658424777024215)}, 
-    {FLOAT_FIXED(-0.977271034816844), FLOAT_FIXED(-0.131373011465245), FLOAT_FIXED(-0.166380456684571)}, 
-    {FLOAT_FIXED(-0.245565805137918), FLOAT_FIXED(-0.607057314334822), FLOAT_FIXED(-0.755763754396544)}, 
-    {FLOAT_FIXED(0.946422174728798), FLOAT_FIXED(0.303525864317613), FLOAT_FIXED(0.110259316485541)}, 
-    {FLOAT_FIXED(-0.700856378755326), FLOAT_FIXED(0.303525785780135), FLOAT_FIXED(0.645501691496252)}, 
-    {FLOAT_FIXED(0.259205285830421), FLOAT_FIXED(0.735878975451938), FLOAT_FIXED(0.625535573157416)}, 
-    {FLOAT_FIXED(-0.841891830424297), FLOAT_FIXED(-0.534570195520387), FLOAT_FIXED(0.0738434284559065)}, 
-};
-
-static texcoord_t texcoords[] = {
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0124), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.9872), FLOAT_FIXED(1.9616)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.0403), FLOAT_FIXED(1.0147)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.595)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-    {FLOAT_FIXED(1.4038), FLOAT_FIXED(1.9864)}, 
-};
-
-static triangle_t faces[] = {
-    {42, 43, 44, 0, 0, 1, 2, 0},
-    {43, 0, 13, 1, 3, 4, 5, 0},
-    {44, 13, 12, 2, 6, 7, 8, 0},
-    {42, 12, 0, 3, 9, 10, 11, 0},
-    {45, 46, 47, 4, 12, 13, 14, 0},
-    {46, 1, 13, 5, 15, 16, 5, 0},
-    {47, 13, 15, 6, 17, 7, 18, 0},
-    {45, 15, 1, 7, 19, 20, 21, 0},
-    {48, 49, 50, 8, 22, 23, 24, 0},
-    {49, 0, 12, 9, 25, 4, 26, 0},
-    {50, 12, 17, 10, 27, 8, 28, 0},
-    {48, 17, 0, 11, 29, 30, 11, 0},
-    {51, 52, 53, 12, 31, 32, 33, 0},
-    {52, 0, 17, 13, 34, 4, 35, 0},
-    {53, 17, 19, 14, 36, 28, 37, 0},
-    {51, 19, 0, 15, 38, 39, 11, 0},
-    {54, 55, 56, 16, 40, 41, 42, 0},
-    {55, 0, 19, 17, 43, 4, 44, 0},
-    {56, 19, 16, 18, 45, 37, 46, 0},
-    {54, 16, 0, 19, 47, 48, 11, 0},
-    {57, 58, 59, 20, 49, 50, 51, 0},
-    {58, 1, 15, 21, 52, 16, 53, 0},
-    {22, 58, 15, 22, 54, 55, 18, 0},
-    {1, 59, 22, 23, 21, 56, 57, 0},
-    {60, 61, 62, 24, 58, 59, 60, 0},
-    {61, 2, 14, 25, 61, 62, 63, 0},
-    {62, 14, 24, 26, 64, 65, 66, 0},
-    {60, 24, 2, 27, 67, 68, 69, 0},
-    {63, 64, 65, 28, 70, 71, 72, 0},
-    {18, 63, 3, 29, 73, 74, 75, 0},
-    {26, 64, 18, 30, 76, 77, 78, 0},
-    {63, 26, 3, 31, 79, 80, 81, 0},
-    {66, 67, 68, 32, 82, 83, 84, 0},
-    {67, 4, 20, 33, 85, 86, 87, 0},
-    {28, 67, 20, 34, 88, 89, 90, 0},
-    {66, 28, 4, 35, 91, 92, 93, 0},
-    {69, 70, 71, 36, 94, 95, 96, 0},
-    {70, 5, 21, 37, 97, 98, 99, 0},
-    {71, 21, 30, 38, 100, 101, 102, 0},
-    {69, 30, 5, 39, 103, 104, 105, 0},
-    {72, 73, 74, 40, 106, 107, 108, 0},
-    {73, 1, 22, 41, 109, 16, 110, 0},
-    {74, 22, 25, 42, 111, 54, 112, 0},
-    {72, 25, 1, 43, 113, 114, 21, 0},
-    {75, 76, 77, 44, 115, 116, 117, 0},
-    {76, 2, 24, 45, 118, 62, 119, 0},
-    {27, 76, 24, 46, 120, 121, 66, 0},
-    {75, 27, 2, 47, 122, 123, 69, 0},
-    {78, 79, 80, 48, 124, 125, 126, 0},
-    {79, 3, 26, 49, 127, 75, 128, 0},
-    {80, 26, 29, 50, 129, 76, 130, 0},
-    {78, 29, 3, 51, 131, 132, 81, 0},
-    {81, 82, 83, 52, 133, 134, 135, 0},
-    {82, 4, 28, 53, 136, 86, 137, 0},
-    {83, 28, 31, 54, 138, 88, 139, 0},
-    {81, 31, 4, 55, 140, 141, 93, 0},
-    {84, 85, 86, 56, 142, 143, 144, 0},
-    {30, 84, 5, 57, 145, 146, 98, 0},
-    {86, 30, 23, 58, 147, 102, 148, 0},
-    {84, 23, 5, 59, 149, 150, 105, 0},
-    {87, 88, 89, 60, 151, 152, 153, 0},
-    {88, 6, 32, 61, 154, 155, 156, 0},
-    {89, 32, 37, 62, 157, 158, 159, 0},
-    {87, 37, 6, 63, 160, 161, 162, 0},
-    {90, 91, 92, 64, 163, 164, 165, 0},
-    {91, 7, 33, 65, 166, 167, 168, 0},
-    {39, 91, 33, 66, 169, 170, 171, 0},
-    {90, 39, 7, 67, 172, 173, 174, 0},
-    {93, 94, 95, 68, 175, 176, 177, 0},
-    {94, 8, 34, 69, 178, 179, 180, 0},
-    {95, 34, 40, 70, 181, 182, 183, 0},
-    {93, 40, 8, 71, 184, 185, 186, 0},
-    {96, 97, 98, 72, 187, 188, 189, 0},
-    {97, 9, 35, 73, 190, 191, 192, 0},
-    {98, 35, 41, 74, 193, 194, 195, 0},
-    {9, 98, 41, 75, 196, 197, 198, 0},
-    {99, 100, 101, 76, 199, 200, 201, 0},
-    {100, 10, 36, 77, 202, 203, 204, 0},
-    {101, 36, 38, 78, 205, 206, 207, 0},
-    {10, 101, 38, 79, 208, 209, 210, 0},
-    {102, 103, 104, 80, 211, 212, 213, 0},
-    {103, 38, 41, 81, 214, 207, 195, 0},
-    {104, 41, 11, 82, 215, 198, 216, 0},
-    {38, 104, 11, 83, 217, 218, 219, 0},
-    {105, 106, 107, 84, 220, 221, 222, 0},
-    {106, 38, 36, 85, 223, 207, 206, 0},
-    {41, 106, 36, 86, 195, 223, 206, 0},
-    {105, 41, 38, 87, 220, 195, 207, 0},
-    {108, 109, 110, 88, 224, 225, 226, 0},
-    {109, 36, 9, 89, 227, 228, 196, 0},
-    {110, 9, 41, 90, 229, 191, 230, 0},
-    {36, 110, 41, 91, 206, 231, 195, 0},
-    {111, 112, 113, 92, 232, 233, 234, 0},
-    {40, 111, 41, 93, 183, 232, 195, 0},
-    {113, 40, 11, 94, 235, 185, 216, 0},
-    {111, 11, 41, 95, 236, 219, 230, 0},
-    {114, 115, 116, 96, 237, 238, 239, 0},
-    {115, 41, 35, 97, 240, 195, 194, 0},
-    {116, 35, 40, 98, 241, 194, 183, 0},
-    {41, 116, 40, 99, 195, 241, 183, 0},
-    {117, 118, 119, 100, 242, 243, 244, 0},
-    {118, 35, 8, 101, 245, 246, 186, 0},
-    {119, 8, 40, 102, 247, 179, 248, 0},
-    {117, 40, 35, 103, 242, 183, 194, 0},
-    {120, 121, 122, 104, 249, 250, 251, 0},
-    {121, 40, 39, 105, 252, 183, 169, 0},
-    {122, 39, 11, 106, 253, 173, 216, 0},
-    {120, 11, 40, 107, 254, 219, 248, 0},
-    {123, 124, 125, 108, 255, 256, 257, 0},
-    {124, 40, 34, 109, 258, 183, 182, 0},
-    {39, 124, 34, 110, 169, 258, 182, 0},
-    {123, 39, 40, 111, 255, 169, 183, 0},
-    {126, 127, 128, 112, 259, 260, 261, 0},
-    {127, 34, 7, 113, 262, 263, 174, 0},
-    {128, 7, 39, 114, 264, 167, 265, 0},
-    {126, 39, 34, 115, 259, 169, 182, 0},
-    {129, 130, 131, 116, 266, 267, 268, 0},
-    {37, 129, 39, 117, 159, 266, 169, 0},
-    {11, 130, 37, 118, 216, 269, 161, 0},
-    {129, 11, 39, 119, 270, 219, 265, 0},
-    {132, 133, 134, 120, 271, 272, 273, 0},
-    {133, 39, 33, 121, 274, 169, 171, 0},
-    {134, 33, 37, 122, 275, 171, 159, 0},
-    {39, 134, 37, 123, 169, 275, 159, 0},
-    {135, 136, 137, 124, 276, 277, 278, 0},
-    {136, 33, 6, 125, 279, 280, 162, 0},
-    {137, 6, 37, 126, 281, 155, 282, 0},
-    {33, 137, 37, 127, 171, 283, 159, 0},
-    {138, 139, 140, 128, 284, 285, 286, 0},
-    {38, 138, 37, 129, 207, 284, 159, 0},
-    {140, 38, 11, 130, 287, 210, 216, 0},
-    {138, 11, 37, 131, 288, 219, 282, 0},
-    {141, 142, 143, 132, 289, 290, 291, 0},
-    {142, 37, 32, 133, 292, 159, 158, 0},
-    {143, 32, 38, 134, 293, 158, 207, 0},
-    {141, 38, 37, 135, 289, 207, 159, 0},
-    {144, 145, 146, 136, 294, 295, 296, 0},
-    {145, 32, 10, 137, 297, 298, 208, 0},
-    {146, 10, 38, 138, 299, 203, 217, 0},
-    {144, 38, 32, 139, 294, 207, 158, 0},
-    {147, 148, 149, 140, 300, 301, 302, 0},
-    {148, 23, 36, 141, 303, 148, 206, 0},
-    {149, 36, 10, 142, 304, 228, 208, 0},
-    {147, 10, 23, 143, 305, 203, 306, 0},
-    {150, 151, 152, 144, 307, 308, 309, 0},
-    {30, 150, 23, 145, 102, 307, 148, 0},
-    {152, 30, 36, 146, 310, 102, 206, 0},
-    {150, 36, 23, 147, 307, 206, 148, 0},
-    {153, 154, 155, 148, 311, 312, 313, 0},
-    {154, 30, 9, 149, 314, 104, 196, 0},
-    {155, 9, 36, 150, 315, 191, 204, 0},
-    {30, 155, 36, 151, 102, 316, 206, 0},
-    {156, 157, 158, 152, 317, 318, 319, 0},
-    {157, 31, 35, 153, 320, 139, 194, 0},
-    {158, 35, 9, 154, 321, 246, 196, 0},
-    {156, 9, 31, 155, 322, 191, 323, 0},
-    {159, 160, 161, 156, 324, 325, 326, 0},
-    {160, 31, 28, 157, 327, 139, 88, 0},
-    {161, 28, 35, 158, 328, 88, 194, 0},
-    {159, 35, 31, 159, 324, 194, 139, 0},
-    {162, 163, 164, 160, 329, 330, 331, 0},
-    {163, 28, 8, 161, 332, 92, 186, 0},
-    {35, 163, 8, 162, 192, 333, 179, 0},
-    {162, 35, 28, 163, 329, 194, 88, 0},
-    {165, 166, 167, 164, 334, 335, 336, 0},
-    {166, 29, 34, 165, 337, 130, 182, 0},
-    {8, 166, 34, 166, 186, 338, 263, 0},
-    {165, 8, 29, 167, 339, 179, 340, 0},
-    {168, 169, 170, 168, 341, 342, 343, 0},
-    {169, 29, 26, 169, 344, 130, 76, 0},
-    {34, 169, 26, 170, 182, 344, 76, 0},
-    {29, 170, 34, 171, 130, 345, 182, 0},
-    {171, 172, 173, 172, 346, 347, 348, 0},
-    {7, 171, 26, 173, 174, 349, 80, 0},
-    {173, 7, 34, 174, 350, 167, 180, 0},
-    {26, 173, 34, 175, 76, 351, 182, 0},
-    {174, 175, 176, 176, 352, 353, 354, 0},
-    {175, 27, 33, 177, 355, 120, 171, 0},
-    {176, 33, 7, 178, 356, 280, 174, 0},
-    {174, 7, 27, 179, 357, 167, 358, 0},
-    {177, 178, 179, 180, 359, 360, 361, 0},
-    {24, 177, 27, 181, 66, 359, 120, 0},
-    {33, 178, 24, 182, 171, 362, 66, 0},
-    {177, 33, 27, 183, 359, 171, 120, 0},
-    {180, 181, 182, 184, 363, 364, 365, 0},
-    {181, 24, 6, 185, 366, 68, 162, 0},
-    {182, 6, 33, 186, 367, 155, 168, 0},
-    {180, 33, 24, 187, 363, 171, 66, 0},
-    {183, 184, 185, 188, 368, 369, 370, 0},
-    {184, 25, 32, 189, 371, 112, 158, 0},
-    {185, 32, 6, 190, 372, 298, 162, 0},
-    {25, 185, 6, 191, 373, 374, 155, 0},
-    {186, 187, 188, 192, 375, 376, 377, 0},
-    {22, 186, 25, 193, 54, 375, 112, 0},
-    {188, 22, 32, 194, 378, 54, 158, 0},
-    {186, 32, 25, 195, 375, 158, 112, 0},
-    {189, 190, 191, 196, 379, 380, 381, 0},
-    {190, 22, 10, 197, 382, 57, 208, 0},
-    {32, 190, 10, 198, 156, 383, 203, 0},
-    {22, 191, 32, 199, 54, 384, 158, 0},
-    {192, 193, 194, 200, 385, 386, 387, 0},
-    {193, 30, 31, 201, 388, 102, 139, 0},
-    {194, 31, 9, 202, 389, 141, 196, 0},
-    {192, 9, 30, 203, 390, 191, 145, 0},
-    {195, 196, 197, 204, 391, 392, 393, 0},
-    {21, 195, 30, 205, 101, 391, 102, 0},
-    {197, 21, 31, 206, 394, 101, 139, 0},
-    {195, 31, 30, 207, 391, 139, 102, 0},
-    {198, 199, 200, 208, 395, 396, 397, 0},
-    {199, 21, 4, 209, 398, 399, 93, 0},
-    {200, 4, 31, 210, 400, 86, 323, 0},
-    {198, 31, 21, 211, 395, 139, 101, 0},
-    {201, 202, 203, 212, 401, 402, 403, 0},
-    {202, 28, 29, 213, 404, 88, 130, 0},
-    {203, 29, 8, 214, 405, 132, 186, 0},
-    {28, 203, 8, 215, 137, 406, 179, 0},
-    {204, 205, 206, 216, 407, 408, 409, 0},
-    {205, 28, 20, 217, 410, 88, 90, 0},
-    {206, 20, 29, 218, 411, 90, 130, 0},
-    {28, 206, 29, 219, 88, 411, 130, 0},
-    {207, 208, 209, 220, 412, 413, 414, 0},
-    {208, 20, 3, 221, 415, 416, 81, 0},
-    {209, 3, 29, 222, 417, 75, 340, 0},
-    {207, 29, 20, 223, 412, 130, 90, 0},
-    {210, 211, 212, 224, 418, 419, 420, 0},
-    {211, 26, 27, 225, 421, 76, 120, 0},
-    {212, 27, 7, 226, 422, 123, 174, 0},
-    {210, 7, 26, 227, 423, 167, 128, 0},
-    {213, 214, 215, 228, 424, 425, 426, 0},
-    {214, 26, 18, 229, 427, 76, 78, 0},
-    {215, 18, 27, 230, 428, 78, 120, 0},
-    {26, 215, 27, 231, 76, 428, 120, 0},
-    {216, 217, 218, 232, 429, 430, 431, 0},
-    {2, 216, 18, 233, 69, 432, 433, 0},
-    {27, 217, 2, 234, 358, 434, 62, 0},
-    {216, 27, 18, 235, 429, 120, 78, 0},
-    {219, 220, 221, 236, 435, 436, 437, 0},
-    {25, 219, 24, 237, 112, 435, 66, 0},
-    {221, 25, 6, 238, 438, 114, 162, 0},
-    {219, 6, 24, 239, 439, 155, 119, 0},
-    {222, 223, 224, 240, 440, 441, 442, 0},
-    {14, 222, 24, 241, 65, 440, 66, 0},
-    {224, 14, 25, 242, 443, 65, 112, 0},
-    {24, 224, 25, 243, 66, 443, 112, 0},
-    {225, 226, 227, 244, 444, 445, 446, 0},
-    {226, 14, 1, 245, 447, 448, 21, 0},
-    {227, 1, 25, 246, 449, 16, 373, 0},
-    {225, 25, 14, 247, 444, 112, 65, 0},
-    {228, 229, 230, 248, 450, 451, 452, 0},
-    {229, 22, 23, 249, 453, 54, 148, 0},
-    {230, 23, 10, 250, 454, 150, 208, 0},
-    {228, 10, 22, 251, 455, 203, 110, 0},
-    {231, 232, 233, 252, 456, 457, 458, 0},
-    {15, 231, 22, 253, 18, 456, 54, 0},
-    {23, 232, 15, 254, 148, 459, 18, 0},
-    {231, 23, 22, 255, 456, 148, 54, 0},
-    {234, 235, 236, 256, 460, 461, 462, 0},
-    {5, 234, 15, 257, 105, 463, 20, 0},
-    {236, 5, 23, 258, 464, 98, 306, 0},
-    {234, 23, 15, 259, 460, 148, 18, 0},
-    {237, 238, 239, 260, 465, 466, 467, 0},
-    {238, 16, 21, 261, 468, 46, 101, 0},
-    {239, 21, 5, 262, 469, 399, 105, 0},
-    {237, 5, 16, 263, 470, 98, 471, 0},
-    {240, 241, 242, 264, 472, 473, 474, 0},
-    {241, 16, 19, 265, 475, 46, 37, 0},
-    {242, 19, 21, 266, 476, 37, 101, 0},
-    {240, 21, 16, 267, 472, 101, 46, 0},
-    {243, 244, 245, 268, 477, 478, 479, 0},
-    {4, 243, 19, 269, 93, 480, 39, 0},
-    {245, 4, 21, 270, 481, 86, 99, 0},
-    {19, 245, 21, 271, 37, 482, 101, 0},
-    {246, 247, 248, 272, 483, 484, 485, 0},
-    {247, 19, 20, 273, 486, 37, 90, 0},
-    {248, 20, 4, 274, 487, 416, 93, 0},
-    {19, 248, 4, 275, 44, 488, 86, 0},
-    {249, 250, 251, 276, 489, 490, 491, 0},
-    {250, 19, 17, 277, 492, 37, 28, 0},
-    {251, 17, 20, 278, 493, 28, 90, 0},
-    {249, 20, 19, 279, 489, 90, 37, 0},
-    {252, 253, 254, 280, 494, 495, 496, 0},
-    {3, 252, 17, 281, 81, 497, 30, 0},
-    {254, 3, 20, 282, 498, 75, 87, 0},
-    {252, 20, 17, 283, 494, 90, 28, 0},
-    {255, 256, 257, 284, 499, 500, 501, 0},
-    {256, 17, 18, 285, 502, 28, 78, 0},
-    {257, 18, 3, 286, 503, 433, 81, 0},
-    {255, 3, 17, 287, 504, 75, 35, 0},
-    {258, 259, 260, 288, 505, 506, 507, 0},
-    {259, 17, 12, 289, 508, 28, 8, 0},
-    {18, 259, 12, 290, 78, 508, 8, 0},
-    {17, 260, 18, 291, 28, 509, 78, 0},
-    {261, 262, 263, 292, 510, 511, 512, 0},
-    {262, 12, 2, 293, 513, 10, 69, 0},
-    {263, 2, 18, 294, 514, 62, 73, 0},
-    {261, 18, 12, 295, 510, 78, 8, 0},
-    {264, 265, 266, 296, 515, 516, 517, 0},
-    {265, 15, 16, 297, 518, 18, 46, 0},
-    {266, 16, 5, 298, 519, 48, 105, 0},
-    {15, 266, 5, 299, 53, 520, 98, 0},
-    {267, 268, 269, 300, 521, 522, 523, 0},
-    {13, 267, 15, 301, 7, 521, 18, 0},
-    {269, 13, 16, 302, 524, 7, 46, 0},
-    {267, 16, 15, 303, 521, 46, 18, 0},
-    {270, 271, 272, 304, 525, 526, 527, 0},
-    {271, 13, 0, 305, 528, 529, 11, 0},
-    {272, 0, 16, 306, 530, 4, 471, 0},
-    {270, 16, 13, 307, 525, 46, 7, 0},
-    {273, 274, 275, 308, 531, 532, 533, 0},
-    {274, 12, 14, 309, 534, 8, 65, 0},
-    {2, 274, 14, 310, 69, 535, 448, 0},
-    {273, 2, 12, 311, 536, 62, 26, 0},
-    {276, 277, 278, 312, 537, 538, 539, 0},
-    {277, 12, 13, 313, 540, 8, 7, 0},
-    {278, 13, 14, 314, 541, 7, 65, 0},
-    {12, 278, 14, 315, 8, 541, 65, 0},
-    {279, 280, 281, 316, 542, 543, 544, 0},
-    {280, 13, 1, 317, 545, 529, 21, 0},
-    {281, 1, 14, 318, 546, 16, 63, 0},
-    {13, 281, 14, 319, 7, 547, 65, 0},
-    {43, 42, 0, 1, 3, 548, 4, 0},
-    {44, 43, 13, 320, 6, 549, 7, 0},
-    {42, 44, 12, 321, 9, 550, 10, 0},
-    {46, 45, 1, 322, 15, 551, 16, 0},
-    {47, 46, 13, 323, 17, 552, 7, 0},
-    {45, 47, 15, 324, 19, 553, 20, 0},
-    {49, 48, 0, 325, 25, 554, 4, 0},
-    {50, 49, 12, 326, 27, 555, 8, 0},
-    {48, 50, 17, 327, 29, 556, 30, 0},
-    {52, 51, 0, 328, 34, 557, 4, 0},
-    {53, 52, 17, 329, 36, 558, 28, 0},
-    {51, 53, 19, 330, 38, 559, 39, 0},
-    {55, 54, 0, 331, 43, 560, 4, 0},
-    {56, 55, 19, 332, 45, 561, 37, 0},
-    {54, 56, 16, 333, 47, 562, 48, 0},
-    {58, 57, 1, 334, 52, 563, 16, 0},
-    {22, 59, 58, 335, 54, 564, 55, 0},
-    {1, 57, 59, 336, 21, 565, 56, 0},
-    {61, 60, 2, 337, 61, 566, 62, 0},
-    {62, 61, 14, 26, 64, 567, 65, 0},
-    {60, 62, 24, 338, 67, 568, 68, 0},
-    {18, 64, 63, 339, 73, 569, 74, 0},
-    {26, 65, 64, 340, 76, 570, 77, 0},
-    {63, 65, 26, 341, 79, 571, 80, 0},
-    {67, 66, 4, 342, 85, 572, 86, 0},
-    {28, 68, 67, 343, 88, 573, 89, 0},
-    {66, 68, 28, 344, 91, 574, 92, 0},
-    {70, 69, 5, 345, 97, 575, 98, 0},
-    {71, 70, 21, 346, 100, 576, 101, 0},
-    {69, 71, 30, 347, 103, 577, 104, 0},
-    {73, 72, 1, 348, 109, 578, 16, 0},
-    {74, 73, 22, 42, 111, 579, 54, 0},
-    {72, 74, 25, 349, 113, 580, 114, 0},
-    {76, 75, 2, 350, 118, 581, 62, 0},
-    {27, 77, 76, 46, 120, 582, 121, 0},
-    {75, 77, 27, 351, 122, 583, 123, 0},
-    {79, 78, 3, 352, 127, 584, 75, 0},
-    {80, 79, 26, 353, 129, 585, 76, 0},
-    {78, 80, 29, 354, 131, 586, 132, 0},
-    {82, 81, 4, 355, 136, 587, 86, 0},
-    {83, 82, 28, 54, 138, 588, 88, 0},
-    {81, 83, 31, 356, 140, 589, 141, 0},
-    {30, 85, 84, 357, 145, 590, 146, 0},
-    {86, 85, 30, 58, 147, 591, 102, 0},
-    {84, 86, 23, 358, 149, 592, 150, 0},
-    {88, 87, 6, 359, 154, 593, 155, 0},
-    {89, 88, 32, 360, 157, 594, 158, 0},
-    {87, 89, 37, 361, 160, 595, 161, 0},
-    {91, 90, 7, 362, 166, 596, 167, 0},
-    {39, 92, 91, 363, 169, 597, 170, 0},
-    {90, 92, 39, 67, 172, 598, 173, 0},
-    {94, 93, 8, 364, 178, 599, 179, 0},
-    {95, 94, 34, 365, 181, 600, 182, 0},
-    {93, 95, 40, 366, 184, 601, 185, 0},
-    {97, 96, 9, 367, 190, 602, 191, 0},
-    {98, 97, 35, 368, 193, 603, 194, 0},
-    {9, 96, 98, 369, 196, 604, 197, 0},
-    {100, 99, 10, 370, 202, 605, 203, 0},
-    {101, 100, 36, 371, 205, 606, 206, 0},
-    {10, 99, 101, 372, 208, 607, 209, 0},
-    {103, 102, 38, 373, 214, 211, 207, 0},
-    {104, 103, 41, 374, 215, 608, 198, 0},
-    {38, 102, 104, 375, 217, 609, 218, 0},
-    {106, 105, 38, 376, 223, 220, 207, 0},
-    {41, 107, 106, 377, 195, 610, 223, 0},
-    {105, 107, 41, 378, 220, 610, 195, 0},
-    {109, 108, 36, 379, 227, 611, 228, 0},
-    {110, 109, 9, 380, 229, 612, 191, 0},
-    {36, 108, 110, 381, 206, 224, 231, 0},
-    {40, 112, 111, 382, 183, 613, 232, 0},
-    {113, 112, 40, 383, 235, 614, 185, 0},
-    {111, 113, 11, 384, 236, 615, 219, 0},
-    {115, 114, 41, 385, 240, 237, 195, 0},
-    {116, 115, 35, 386, 241, 240, 194, 0},
-    {41, 114, 116, 387, 195, 237, 241, 0},
-    {118, 117, 35, 388, 245, 616, 246, 0},
-    {119, 118, 8, 102, 247, 617, 179, 0},
-    {117, 119, 40, 389, 242, 618, 183, 0},
-    {121, 120, 40, 390, 252, 249, 183, 0},
-    {122, 121, 39, 391, 253, 619, 173, 0},
-    {120, 122, 11, 392, 254, 620, 219, 0},
-    {124, 123, 40, 109, 258, 255, 183, 0},
-    {39, 125, 124, 110, 169, 621, 258, 0},
-    {123, 125, 39, 393, 255, 621, 169, 0},
-    {127, 126, 34, 394, 262, 622, 263, 0},
-    {128, 127, 7, 395, 264, 623, 167, 0},
-    {126, 128, 39, 396, 259, 624, 169, 0},
-    {37, 130, 129, 397, 159, 625, 266, 0},
-    {11, 131, 130, 398, 216, 626, 269, 0},
-    {129, 131, 11, 119, 270, 627, 219, 0},
-    {133, 132, 39, 399, 274, 271, 169, 0},
-    {134, 133, 33, 400, 275, 274, 171, 0},
-    {39, 132, 134, 401, 169, 271, 275, 0},
-    {136, 135, 33, 402, 279, 628, 280, 0},
-    {137, 136, 6, 403, 281, 629, 155, 0},
-    {33, 135, 137, 404, 171, 276, 283, 0},
-    {38, 139, 138, 405, 207, 630, 284, 0},
-    {140, 139, 38, 406, 287, 631, 210, 0},
-    {138, 140, 11, 407, 288, 632, 219, 0},
-    {142, 141, 37, 408, 292, 289, 159, 0},
-    {143, 142, 32, 409, 293, 292, 158, 0},
-    {141, 143, 38, 410, 289, 293, 207, 0},
-    {145, 144, 32, 411, 297, 633, 298, 0},
-    {146, 145, 10, 412, 299, 634, 203, 0},
-    {144, 146, 38, 413, 294, 635, 207, 0},
-    {148, 147, 23, 414, 303, 300, 148, 0},
-    {149, 148, 36, 415, 304, 636, 228, 0},
-    {147, 149, 10, 416, 305, 637, 203, 0},
-    {30, 151, 150, 417, 102, 638, 307, 0},
-    {152, 151, 30, 418, 310, 638, 102, 0},
-    {150, 152, 36, 419, 307, 310, 206, 0},
-    {154, 153, 30, 420, 314, 639, 104, 0},
-    {155, 154, 9, 421, 315, 640, 191, 0},
-    {30, 153, 155, 422, 102, 311, 316, 0},
-    {157, 156, 31, 423, 320, 317, 139, 0},
-    {158, 157, 35, 424, 321, 641, 246, 0},
-    {156, 158, 9, 425, 322, 642, 191, 0},
-    {160, 159, 31, 426, 327, 324, 139, 0},
-    {161, 160, 28, 158, 328, 327, 88, 0},
-    {159, 161, 35, 427, 324, 328, 194, 0},
-    {163, 162, 28, 428, 332, 643, 92, 0},
-    {35, 164, 163, 429, 192, 644, 333, 0},
-    {162, 164, 35, 430, 329, 645, 194, 0},
-    {166, 165, 29, 431, 337, 334, 130, 0},
-    {8, 167, 166, 432, 186, 646, 338, 0},
-    {165, 167, 8, 433, 339, 647, 179, 0},
-    {169, 168, 29, 169, 344, 341, 130, 0},
-    {34, 170, 169, 434, 182, 345, 344, 0},
-    {29, 168, 170, 435, 130, 341, 345, 0},
-    {7, 172, 171, 436, 174, 648, 349, 0},
-    {173, 172, 7, 437, 350, 649, 167, 0},
-    {26, 171, 173, 438, 76, 346, 351, 0},
-    {175, 174, 27, 439, 355, 352, 120, 0},
-    {176, 175, 33, 440, 356, 650, 280, 0},
-    {174, 176, 7, 441, 357, 651, 167, 0},
-    {24, 178, 177, 442, 66, 362, 359, 0},
-    {33, 179, 178, 443, 171, 652, 362, 0},
-    {177, 179, 33, 444, 359, 652, 171, 0},
-    {181, 180, 24, 445, 366, 653, 68, 0},
-    {182, 181, 6, 446, 367, 654, 155, 0},
-    {180, 182, 33, 187, 363, 655, 171, 0},
-    {184, 183, 25, 447, 371, 368, 112, 0},
-    {185, 184, 32, 448, 372, 656, 298, 0},
-    {25, 183, 185, 449, 373, 657, 374, 0},
-    {22, 187, 186, 450, 54, 658, 375, 0},
-    {188, 187, 22, 451, 378, 658, 54, 0},
-    {186, 188, 32, 452, 375, 378, 158, 0},
-    {190, 189, 22, 453, 382, 659, 57, 0},
-    {32, 191, 190, 454, 156, 660, 383, 0},
-    {22, 189, 191, 455, 54, 379, 384, 0},
-    {193, 192, 30, 201, 388, 385, 102, 0},
-    {194, 193, 31, 456, 389, 661, 141, 0},
-    {192, 194, 9, 457, 390, 662, 191, 0},
-    {21, 196, 195, 205, 101, 663, 391, 0},
-    {197, 196, 21, 458, 394, 663, 101, 0},
-    {195, 197, 31, 459, 391, 394, 139, 0},
-    {199, 198, 21, 460, 398, 664, 399, 0},
-    {200, 199, 4, 461, 400, 665, 86, 0},
-    {198, 200, 31, 462, 395, 666, 139, 0},
-    {202, 201, 28, 213, 404, 401, 88, 0},
-    {203, 202, 29, 463, 405, 667, 132, 0},
-    {28, 201, 203, 464, 137, 668, 406, 0},
-    {205, 204, 28, 465, 410, 407, 88, 0},
-    {206, 205, 20, 466, 411, 410, 90, 0},
-    {28, 204, 206, 467, 88, 407, 411, 0},
-    {208, 207, 20, 468, 415, 669, 416, 0},
-    {209, 208, 3, 469, 417, 670, 75, 0},
-    {207, 209, 29, 470, 412, 671, 130, 0},
-    {211, 210, 26, 225, 421, 418, 76, 0},
-    {212, 211, 27, 471, 422, 672, 123, 0},
-    {210, 212, 7, 472, 423, 673, 167, 0},
-    {214, 213, 26, 473, 427, 424, 76, 0},
-    {215, 214, 18, 474, 428, 427, 78, 0},
-    {26, 213, 215, 475, 76, 424, 428, 0},
-    {2, 217, 216, 476, 69, 674, 432, 0},
-    {27, 218, 217, 477, 358, 675, 434, 0},
-    {216, 218, 27, 478, 429, 676, 120, 0},
-    {25, 220, 219, 237, 112, 677, 435, 0},
-    {221, 220, 25, 479, 438, 678, 114, 0},
-    {219, 221, 6, 480, 439, 679, 155, 0},
-    {14, 223, 222, 481, 65, 680, 440, 0},
-    {224, 223, 14, 482, 443, 680, 65, 0},
-    {24, 222, 224, 483, 66, 440, 443, 0},
-    {226, 225, 14, 484, 447, 681, 448, 0},
-    {227, 226, 1, 485, 449, 682, 16, 0},
-    {225, 227, 25, 486, 444, 683, 112, 0},
-    {229, 228, 22, 487, 453, 450, 54, 0},
-    {230, 229, 23, 488, 454, 684, 150, 0},
-    {228, 230, 10, 489, 455, 685, 203, 0},
-    {15, 232, 231, 490, 18, 459, 456, 0},
-    {23, 233, 232, 491, 148, 686, 459, 0},
-    {231, 233, 23, 255, 456, 686, 148, 0},
-    {5, 235, 234, 492, 105, 687, 463, 0},
-    {236, 235, 5, 493, 464, 688, 98, 0},
-    {234, 236, 23, 494, 460, 689, 148, 0},
-    {238, 237, 16, 495, 468, 465, 46, 0},
-    {239, 238, 21, 496, 469, 690, 399, 0},
-    {237, 239, 5, 263, 470, 691, 98, 0},
-    {241, 240, 16, 497, 475, 472, 46, 0},
-    {242, 241, 19, 498, 476, 475, 37, 0},
-    {240, 242, 21, 499, 472, 476, 101, 0},
-    {4, 244, 243, 500, 93, 692, 480, 0},
-    {245, 244, 4, 501, 481, 693, 86, 0},
-    {19, 243, 245, 502, 37, 477, 482, 0},
-    {247, 246, 19, 503, 486, 483, 37, 0},
-    {248, 247, 20, 504, 487, 694, 416, 0},
-    {19, 246, 248, 505, 44, 695, 488, 0},
-    {250, 249, 19, 506, 492, 489, 37, 0},
-    {251, 250, 17, 507, 493, 492, 28, 0},
-    {249, 251, 20, 508, 489, 493, 90, 0},
-    {3, 253, 252, 509, 81, 696, 497, 0},
-    {254, 253, 3, 510, 498, 697, 75, 0},
-    {252, 254, 20, 511, 494, 698, 90, 0},
-    {256, 255, 17, 512, 502, 499, 28, 0},
-    {257, 256, 18, 513, 503, 699, 433, 0},
-    {255, 257, 3, 514, 504, 700, 75, 0},
-    {259, 258, 17, 515, 508, 505, 28, 0},
-    {18, 260, 259, 516, 78, 509, 508, 0},
-    {17, 258, 260, 517, 28, 505, 509, 0},
-    {262, 261, 12, 518, 513, 701, 10, 0},
-    {263, 262, 2, 519, 514, 702, 62, 0},
-    {261, 263, 18, 520, 510, 703, 78, 0},
-    {265, 264, 15, 521, 518, 515, 18, 0},
-    {266, 265, 16, 522, 519, 704, 48, 0},
-    {15, 264, 266, 523, 53, 705, 520, 0},
-    {13, 268, 267, 301, 7, 706, 521, 0},
-    {269, 268, 13, 524, 524, 706, 7, 0},
-    {267, 269, 16, 303, 521, 524, 46, 0},
-    {271, 270, 13, 525, 528, 707, 529, 0},
-    {272, 271, 0, 526, 530, 708, 4, 0},
-    {270, 272, 16, 527, 525, 709, 46, 0},
-    {274, 273, 12, 528, 534, 531, 8, 0},
-    {2, 275, 274, 529, 69, 710, 535, 0},
-    {273, 275, 2, 530, 536, 711, 62, 0},
-    {277, 276, 12, 531, 540, 537, 8, 0},
-    {278, 277, 13, 532, 541, 540, 7, 0},
-    {12, 276, 278, 533, 8, 537, 541, 0},
-    {280, 279, 13, 317, 545, 712, 529, 0},
-    {281, 280, 1, 534, 546, 713, 16, 0},
-    {13, 279, 281, 535, 7, 542, 547, 0},
-};
-
-model_t get_model_enemy() {
-    model_t model;
-
-    model.vertices = vertices;
-    model.normals = normals;
-    model.texcoords = texcoords;
-    model.faces = faces;
-
-    model.num_vertices = NUM_VERTICES;
-    model.num_normals = NUM_NORMALS;
-    model.num_texcoords = NUM_TEXCOORDS;
-    model.num_faces = NUM_FACES;
-
-    model.modelview = imat4x4(
-        INT_FIXED(1), 0, 0, 0,
-        0, INT_FIXED(1), 0, 0,
-        0, 0, INT_FIXED(1), 0,
-        0, 0, 0, INT_FIXED(1)
-    );
-
-    return model;
-}
-
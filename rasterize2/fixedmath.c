@@ -1,10 +1,19 @@
 /**
 * Fixed point math, not-inline-in-header part.
-* Mostly, a sine table.
+* Mostly, a sine table, plus the batched vector / matrix functions.
 */
 
 #include "fixedmath.h"
 
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Batched functions use SIMD (if compiled in) while this is set
+int32_t fixedmath_simd = 1;
+
 int32_t isin(int a) {
     const static int table[1025] = {
         0,6,13,19,25,31,38,44,
@@ -146,3 +155,403 @@ int32_t isin(int a) {
         default: return 0;
     }
 }
+
+// 1 / sqrt(f) - 1 for f in [0.25, 1) in 0.16 fixed point, indexed by the top 12 bits of f
+// and sampled at bucket midpoints. Good to about 12 bits, so one Newton step is enough.
+const uint16_t irsqrt_table[3072] = {
+    65504,65440,65376,65313,65249,65185,65122,65059,64995,64932,64869,64806,64743,64680,64618,64555,
+    64493,64430,64368,64306,64243,64181,64119,64057,63996,63934,63872,63811,63749,63688,63627,63565,
+    63504,63443,63382,63321,63261,63200,63139,63079,63018,62958,62898,62838,62778,62718,62658,62598,
+    62538,62478,62419,62359,62300,62241,62181,62122,62063,62004,61945,61886,61828,61769,61710,61652,
+    61593,61535,61477,61418,61360,61302,61244,61186,61129,61071,61013,60956,60898,60841,60784,60726,
+    60669,60612,60555,60498,60441,60384,60328,60271,60215,60158,60102,60045,59989,59933,59877,59821,
+    59765,59709,59653,59597,59542,59486,59431,59375,59320,59265,59209,59154,59099,59044,58989,58934,
+    58880,58825,58770,58716,58661,58607,58553,58498,58444,58390,58336,58282,58228,58174,58120,58067,
+    58013,57959,57906,57853,57799,57746,57693,57640,57586,57533,57481,57428,57375,57322,57269,57217,
+    57164,57112,57059,57007,56955,56903,56850,56798,56746,56694,56643,56591,56539,56487,56436,56384,
+    56333,56281,56230,56179,56128,56076,56025,55974,55923,55872,55822,55771,55720,55669,55619,55568,
+    55518,55468,55417,55367,55317,55267,55217,55167,55117,55067,55017,54967,54917,54868,54818,54769,
+    54719,54670,54620,54571,54522,54473,54424,54375,54326,54277,54228,54179,54130,54082,54033,53985,
+    53936,53888,53839,53791,53743,53694,53646,53598,53550,53502,53454,53406,53359,53311,53263,53216,
+    53168,53121,53073,53026,52978,52931,52884,52837,52790,52743,52696,52649,52602,52555,52508,52461,
+    52415,52368,52322,52275,52229,52182,52136,52090,52043,51997,51951,51905,51859,51813,51767,51721,
+    51675,51630,51584,51538,51493,51447,51402,51356,51311,51266,51220,51175,51130,51085,51040,50995,
+    50950,50905,50860,50815,50771,50726,50681,50637,50592,50548,50503,50459,50415,50370,50326,50282,
+    50238,50194,50150,50106,50062,50018,49974,49930,49887,49843,49799,49756,49712,49669,49625,49582,
+    49539,49495,49452,49409,49366,49323,49280,49237,49194,49151,49108,49065,49022,48980,48937,48894,
+    48852,48809,48767,48724,48682,48640,48597,48555,48513,48471,48429,48387,48345,48303,48261,48219,
+    48177,48135,48094,48052,48010,47969,47927,47886,47844,47803,47762,47720,47679,47638,47597,47555,
+    47514,47473,47432,47391,47350,47310,47269,47228,47187,47147,47106,47065,47025,46984,46944,46903,
+    46863,46823,46782,46742,46702,46662,46622,46582,46541,46501,46462,46422,46382,46342,46302,46262,
+    46223,46183,46143,46104,46064,46025,45985,45946,45907,45867,45828,45789,45750,45711,45671,45632,
+    45593,45554,45515,45476,45438,45399,45360,45321,45283,45244,45205,45167,45128,45090,45051,45013,
+    44974,44936,44898,44860,44821,44783,44745,44707,44669,44631,44593,44555,44517,44479,44441,44404,
+    44366,44328,44290,44253,44215,44178,44140,44103,44065,44028,43990,43953,43916,43879,43841,43804,
+    43767,43730,43693,43656,43619,43582,43545,43508,43471,43435,43398,43361,43324,43288,43251,43215,
+    43178,43142,43105,43069,43032,42996,42960,42923,42887,42851,42815,42779,42742,42706,42670,42634,
+    42598,42562,42527,42491,42455,42419,42383,42348,42312,42276,42241,42205,42170,42134,42099,42063,
+    42028,41993,41957,41922,41887,41852,41816,41781,41746,41711,41676,41641,41606,41571,41536,41501,
+    41466,41432,41397,41362,41327,41293,41258,41224,41189,41154,41120,41085,41051,41017,40982,40948,
+    40914,40879,40845,40811,40777,40743,40709,40674,40640,40606,40572,40538,40505,40471,40437,40403,
+    40369,40336,40302,40268,40235,40201,40167,40134,40100,40067,40033,40000,39966,39933,39900,39866,
+    39833,39800,39767,39734,39700,39667,39634,39601,39568,39535,39502,39469,39436,39404,39371,39338,
+    39305,39272,39240,39207,39174,39142,39109,39077,39044,39012,38979,38947,38914,38882,38850,38817,
+    38785,38753,38721,38688,38656,38624,38592,38560,38528,38496,38464,38432,38400,38368,38336,38304,
+    38273,38241,38209,38177,38146,38114,38082,38051,38019,37988,37956,37925,37893,37862,37830,37799,
+    37768,37736,37705,37674,37642,37611,37580,37549,37518,37487,37456,37425,37394,37363,37332,37301,
+    37270,37239,37208,37177,37147,37116,37085,37054,37024,36993,36962,36932,36901,36871,36840,36810,
+    36779,36749,36718,36688,36658,36627,36597,36567,36537,36506,36476,36446,36416,36386,36356,36326,
+    36296,36266,36236,36206,36176,36146,36116,36086,36056,36027,35997,35967,35937,35908,35878,35848,
+    35819,35789,35760,35730,35701,35671,35642,35612,35583,35554,35524,35495,35466,35436,35407,35378,
+    35349,35320,35290,35261,35232,35203,35174,35145,35116,35087,35058,35029,35000,34971,34943,34914,
+    34885,34856,34827,34799,34770,34741,34713,34684,34656,34627,34598,34570,34541,34513,34484,34456,
+    34428,34399,34371,34343,34314,34286,34258,34229,34201,34173,34145,34117,34089,34061,34032,34004,
+    33976,33948,33920,33893,33865,33837,33809,33781,33753,33725,33698,33670,33642,33614,33587,33559,
+    33531,33504,33476,33449,33421,33393,33366,33338,33311,33284,33256,33229,33201,33174,33147,33119,
+    33092,33065,33038,33010,32983,32956,32929,32902,32875,32848,32821,32794,32767,32740,32713,32686,
+    32659,32632,32605,32578,32551,32524,32498,32471,32444,32417,32391,32364,32337,32311,32284,32258,
+    32231,32204,32178,32151,32125,32098,32072,32046,32019,31993,31966,31940,31914,31887,31861,31835,
+    31809,31783,31756,31730,31704,31678,31652,31626,31600,31574,31548,31522,31496,31470,31444,31418,
+    31392,31366,31340,31314,31289,31263,31237,31211,31186,31160,31134,31108,31083,31057,31032,31006,
+    30980,30955,30929,30904,30878,30853,30828,30802,30777,30751,30726,30701,30675,30650,30625,30599,
+    30574,30549,30524,30499,30473,30448,30423,30398,30373,30348,30323,30298,30273,30248,30223,30198,
+    30173,30148,30123,30098,30073,30049,30024,29999,29974,29950,29925,29900,29875,29851,29826,29801,
+    29777,29752,29728,29703,29678,29654,29629,29605,29581,29556,29532,29507,29483,29458,29434,29410,
+    29385,29361,29337,29313,29288,29264,29240,29216,29192,29167,29143,29119,29095,29071,29047,29023,
+    28999,28975,28951,28927,28903,28879,28855,28831,28807,28784,28760,28736,28712,28688,28665,28641,
+    28617,28593,28570,28546,28522,28499,28475,28451,28428,28404,28381,28357,28334,28310,28287,28263,
+    28240,28216,28193,28170,28146,28123,28099,28076,28053,28030,28006,27983,27960,27937,27913,27890,
+    27867,27844,27821,27798,27774,27751,27728,27705,27682,27659,27636,27613,27590,27567,27544,27522,
+    27499,27476,27453,27430,27407,27384,27362,27339,27316,27293,27271,27248,27225,27203,27180,27157,
+    27135,27112,27089,27067,27044,27022,26999,26977,26954,26932,26909,26887,26864,26842,26820,26797,
+    26775,26752,26730,26708,26685,26663,26641,26619,26596,26574,26552,26530,26508,26486,26463,26441,
+    26419,26397,26375,26353,26331,26309,26287,26265,26243,26221,26199,26177,26155,26133,26111,26089,
+    26068,26046,26024,26002,25980,25959,25937,25915,25893,25872,25850,25828,25807,25785,25763,25742,
+    25720,25698,25677,25655,25634,25612,25591,25569,25548,25526,25505,25483,25462,25441,25419,25398,
+    25376,25355,25334,25312,25291,25270,25249,25227,25206,25185,25164,25142,25121,25100,25079,25058,
+    25037,25015,24994,24973,24952,24931,24910,24889,24868,24847,24826,24805,24784,24763,24742,24722,
+    24701,24680,24659,24638,24617,24596,24576,24555,24534,24513,24492,24472,24451,24430,24410,24389,
+    24368,24348,24327,24306,24286,24265,24245,24224,24204,24183,24162,24142,24122,24101,24081,24060,
+    24040,24019,23999,23978,23958,23938,23917,23897,23877,23856,23836,23816,23796,23775,23755,23735,
+    23715,23694,23674,23654,23634,23614,23594,23574,23553,23533,23513,23493,23473,23453,23433,23413,
+    23393,23373,23353,23333,23313,23293,23273,23253,23234,23214,23194,23174,23154,23134,23115,23095,
+    23075,23055,23035,23016,22996,22976,22957,22937,22917,22898,22878,22858,22839,22819,22799,22780,
+    22760,22741,22721,22702,22682,22663,22643,22624,22604,22585,22565,22546,22526,22507,22488,22468,
+    22449,22430,22410,22391,22372,22352,22333,22314,22294,22275,22256,22237,22217,22198,22179,22160,
+    22141,22122,22102,22083,22064,22045,22026,22007,21988,21969,21950,21931,21912,21893,21874,21855,
+    21836,21817,21798,21779,21760,21741,21722,21703,21685,21666,21647,21628,21609,21590,21572,21553,
+    21534,21515,21497,21478,21459,21440,21422,21403,21384,21366,21347,21328,21310,21291,21273,21254,
+    21235,21217,21198,21180,21161,21143,21124,21106,21087,21069,21050,21032,21014,20995,20977,20958,
+    20940,20922,20903,20885,20866,20848,20830,20812,20793,20775,20757,20738,20720,20702,20684,20666,
+    20647,20629,20611,20593,20575,20556,20538,20520,20502,20484,20466,20448,20430,20412,20394,20376,
+    20358,20340,20322,20304,20286,20268,20250,20232,20214,20196,20178,20160,20142,20124,20107,20089,
+    20071,20053,20035,20018,20000,19982,19964,19946,19929,19911,19893,19875,19858,19840,19822,19805,
+    19787,19769,19752,19734,19717,19699,19681,19664,19646,19629,19611,19594,19576,19558,19541,19523,
+    19506,19489,19471,19454,19436,19419,19401,19384,19367,19349,19332,19314,19297,19280,19262,19245,
+    19228,19210,19193,19176,19159,19141,19124,19107,19090,19072,19055,19038,19021,19004,18986,18969,
+    18952,18935,18918,18901,18884,18867,18849,18832,18815,18798,18781,18764,18747,18730,18713,18696,
+    18679,18662,18645,18628,18611,18594,18577,18561,18544,18527,18510,18493,18476,18459,18443,18426,
+    18409,18392,18375,18358,18342,18325,18308,18291,18275,18258,18241,18225,18208,18191,18174,18158,
+    18141,18125,18108,18091,18075,18058,18041,18025,18008,17992,17975,17959,17942,17926,17909,17892,
+    17876,17859,17843,17827,17810,17794,17777,17761,17744,17728,17712,17695,17679,17662,17646,17630,
+    17613,17597,17581,17564,17548,17532,17515,17499,17483,17467,17450,17434,17418,17402,17386,17369,
+    17353,17337,17321,17305,17288,17272,17256,17240,17224,17208,17192,17176,17160,17143,17127,17111,
+    17095,17079,17063,17047,17031,17015,16999,16983,16967,16951,16935,16920,16904,16888,16872,16856,
+    16840,16824,16808,16792,16776,16761,16745,16729,16713,16697,16682,16666,16650,16634,16618,16603,
+    16587,16571,16555,16540,16524,16508,16493,16477,16461,16446,16430,16414,16399,16383,16367,16352,
+    16336,16321,16305,16289,16274,16258,16243,16227,16212,16196,16181,16165,16150,16134,16119,16103,
+    16088,16072,16057,16041,16026,16011,15995,15980,15964,15949,15934,15918,15903,15888,15872,15857,
+    15842,15826,15811,15796,15780,15765,15750,15735,15719,15704,15689,15674,15658,15643,15628,15613,
+    15598,15582,15567,15552,15537,15522,15507,15492,15476,15461,15446,15431,15416,15401,15386,15371,
+    15356,15341,15326,15311,15296,15281,15266,15251,15236,15221,15206,15191,15176,15161,15146,15131,
+    15116,15101,15086,15072,15057,15042,15027,15012,14997,14982,14968,14953,14938,14923,14908,14894,
+    14879,14864,14849,14834,14820,14805,14790,14775,14761,14746,14731,14717,14702,14687,14673,14658,
+    14643,14629,14614,14599,14585,14570,14556,14541,14526,14512,14497,14483,14468,14454,14439,14424,
+    14410,14395,14381,14366,14352,14337,14323,14308,14294,14280,14265,14251,14236,14222,14207,14193,
+    14179,14164,14150,14135,14121,14107,14092,14078,14064,14049,14035,14021,14006,13992,13978,13963,
+    13949,13935,13921,13906,13892,13878,13864,13849,13835,13821,13807,13793,13778,13764,13750,13736,
+    13722,13708,13694,13679,13665,13651,13637,13623,13609,13595,13581,13567,13553,13538,13524,13510,
+    13496,13482,13468,13454,13440,13426,13412,13398,13384,13370,13356,13342,13329,13315,13301,13287,
+    13273,13259,13245,13231,13217,13203,13190,13176,13162,13148,13134,13120,13106,13093,13079,13065,
+    13051,13037,13024,13010,12996,12982,12969,12955,12941,12927,12914,12900,12886,12872,12859,12845,
+    12831,12818,12804,12790,12777,12763,12749,12736,12722,12709,12695,12681,12668,12654,12641,12627,
+    12613,12600,12586,12573,12559,12546,12532,12519,12505,12492,12478,12465,12451,12438,12424,12411,
+    12397,12384,12370,12357,12344,12330,12317,12303,12290,12277,12263,12250,12236,12223,12210,12196,
+    12183,12170,12156,12143,12130,12116,12103,12090,12076,12063,12050,12037,12023,12010,11997,11984,
+    11970,11957,11944,11931,11917,11904,11891,11878,11865,11852,11838,11825,11812,11799,11786,11773,
+    11759,11746,11733,11720,11707,11694,11681,11668,11655,11642,11629,11616,11602,11589,11576,11563,
+    11550,11537,11524,11511,11498,11485,11472,11459,11446,11433,11420,11408,11395,11382,11369,11356,
+    11343,11330,11317,11304,11291,11278,11265,11253,11240,11227,11214,11201,11188,11176,11163,11150,
+    11137,11124,11111,11099,11086,11073,11060,11048,11035,11022,11009,10997,10984,10971,10958,10946,
+    10933,10920,10908,10895,10882,10869,10857,10844,10831,10819,10806,10793,10781,10768,10756,10743,
+    10730,10718,10705,10693,10680,10667,10655,10642,10630,10617,10605,10592,10580,10567,10554,10542,
+    10529,10517,10504,10492,10479,10467,10455,10442,10430,10417,10405,10392,10380,10367,10355,10343,
+    10330,10318,10305,10293,10280,10268,10256,10243,10231,10219,10206,10194,10182,10169,10157,10145,
+    10132,10120,10108,10095,10083,10071,10059,10046,10034,10022,10009,9997,9985,9973,9960,9948,
+    9936,9924,9912,9899,9887,9875,9863,9851,9838,9826,9814,9802,9790,9778,9766,9753,
+    9741,9729,9717,9705,9693,9681,9669,9657,9645,9632,9620,9608,9596,9584,9572,9560,
+    9548,9536,9524,9512,9500,9488,9476,9464,9452,9440,9428,9416,9404,9392,9380,9368,
+    9356,9344,9332,9321,9309,9297,9285,9273,9261,9249,9237,9225,9213,9202,9190,9178,
+    9166,9154,9142,9131,9119,9107,9095,9083,9071,9060,9048,9036,9024,9012,9001,8989,
+    8977,8965,8954,8942,8930,8918,8907,8895,8883,8872,8860,8848,8836,8825,8813,8801,
+    8790,8778,8766,8755,8743,8731,8720,8708,8697,8685,8673,8662,8650,8639,8627,8615,
+    8604,8592,8581,8569,8557,8546,8534,8523,8511,8500,8488,8477,8465,8454,8442,8431,
+    8419,8408,8396,8385,8373,8362,8350,8339,8327,8316,8304,8293,8282,8270,8259,8247,
+    8236,8224,8213,8202,8190,8179,8167,8156,8145,8133,8122,8111,8099,8088,8077,8065,
+    8054,8043,8031,8020,8009,7997,7986,7975,7963,7952,7941,7930,7918,7907,7896,7885,
+    7873,7862,7851,7840,7828,7817,7806,7795,7784,7772,7761,7750,7739,7728,7716,7705,
+    7694,7683,7672,7661,7650,7638,7627,7616,7605,7594,7583,7572,7561,7549,7538,7527,
+    7516,7505,7494,7483,7472,7461,7450,7439,7428,7417,7406,7395,7384,7373,7362,7351,
+    7340,7329,7318,7307,7296,7285,7274,7263,7252,7241,7230,7219,7208,7197,7186,7175,
+    7164,7153,7142,7131,7121,7110,7099,7088,7077,7066,7055,7044,7034,7023,7012,7001,
+    6990,6979,6968,6958,6947,6936,6925,6914,6904,6893,6882,6871,6860,6850,6839,6828,
+    6817,6806,6796,6785,6774,6763,6753,6742,6731,6721,6710,6699,6688,6678,6667,6656,
+    6646,6635,6624,6614,6603,6592,6582,6571,6560,6550,6539,6528,6518,6507,6496,6486,
+    6475,6465,6454,6443,6433,6422,6412,6401,6390,6380,6369,6359,6348,6338,6327,6317,
+    6306,6295,6285,6274,6264,6253,6243,6232,6222,6211,6201,6190,6180,6169,6159,6148,
+    6138,6127,6117,6107,6096,6086,6075,6065,6054,6044,6034,6023,6013,6002,5992,5981,
+    5971,5961,5950,5940,5930,5919,5909,5898,5888,5878,5867,5857,5847,5836,5826,5816,
+    5805,5795,5785,5774,5764,5754,5744,5733,5723,5713,5702,5692,5682,5672,5661,5651,
+    5641,5631,5620,5610,5600,5590,5579,5569,5559,5549,5539,5528,5518,5508,5498,5488,
+    5477,5467,5457,5447,5437,5427,5416,5406,5396,5386,5376,5366,5356,5345,5335,5325,
+    5315,5305,5295,5285,5275,5265,5255,5244,5234,5224,5214,5204,5194,5184,5174,5164,
+    5154,5144,5134,5124,5114,5104,5094,5084,5074,5064,5054,5044,5034,5024,5014,5004,
+    4994,4984,4974,4964,4954,4944,4934,4924,4914,4904,4894,4884,4875,4865,4855,4845,
+    4835,4825,4815,4805,4795,4785,4776,4766,4756,4746,4736,4726,4716,4706,4697,4687,
+    4677,4667,4657,4647,4638,4628,4618,4608,4598,4589,4579,4569,4559,4549,4540,4530,
+    4520,4510,4501,4491,4481,4471,4461,4452,4442,4432,4423,4413,4403,4393,4384,4374,
+    4364,4355,4345,4335,4325,4316,4306,4296,4287,4277,4267,4258,4248,4238,4229,4219,
+    4209,4200,4190,4181,4171,4161,4152,4142,4132,4123,4113,4104,4094,4084,4075,4065,
+    4056,4046,4036,4027,4017,4008,3998,3989,3979,3970,3960,3951,3941,3931,3922,3912,
+    3903,3893,3884,3874,3865,3855,3846,3836,3827,3817,3808,3798,3789,3780,3770,3761,
+    3751,3742,3732,3723,3713,3704,3694,3685,3676,3666,3657,3647,3638,3629,3619,3610,
+    3600,3591,3582,3572,3563,3553,3544,3535,3525,3516,3507,3497,3488,3479,3469,3460,
+    3451,3441,3432,3423,3413,3404,3395,3385,3376,3367,3357,3348,3339,3330,3320,3311,
+    3302,3292,3283,3274,3265,3255,3246,3237,3228,3218,3209,3200,3191,3182,3172,3163,
+    3154,3145,3135,3126,3117,3108,3099,3090,3080,3071,3062,3053,3044,3034,3025,3016,
+    3007,2998,2989,2980,2970,2961,2952,2943,2934,2925,2916,2907,2897,2888,2879,2870,
+    2861,2852,2843,2834,2825,2816,2807,2797,2788,2779,2770,2761,2752,2743,2734,2725,
+    2716,2707,2698,2689,2680,2671,2662,2653,2644,2635,2626,2617,2608,2599,2590,2581,
+    2572,2563,2554,2545,2536,2527,2518,2509,2500,2491,2482,2473,2464,2455,2446,2438,
+    2429,2420,2411,2402,2393,2384,2375,2366,2357,2348,2340,2331,2322,2313,2304,2295,
+    2286,2277,2269,2260,2251,2242,2233,2224,2215,2207,2198,2189,2180,2171,2163,2154,
+    2145,2136,2127,2118,2110,2101,2092,2083,2075,2066,2057,2048,2039,2031,2022,2013,
+    2004,1996,1987,1978,1969,1961,1952,1943,1934,1926,1917,1908,1900,1891,1882,1873,
+    1865,1856,1847,1839,1830,1821,1813,1804,1795,1786,1778,1769,1760,1752,1743,1735,
+    1726,1717,1709,1700,1691,1683,1674,1665,1657,1648,1640,1631,1622,1614,1605,1596,
+    1588,1579,1571,1562,1554,1545,1536,1528,1519,1511,1502,1494,1485,1476,1468,1459,
+    1451,1442,1434,1425,1417,1408,1400,1391,1383,1374,1366,1357,1349,1340,1332,1323,
+    1315,1306,1298,1289,1281,1272,1264,1255,1247,1238,1230,1221,1213,1204,1196,1188,
+    1179,1171,1162,1154,1145,1137,1128,1120,1112,1103,1095,1086,1078,1070,1061,1053,
+    1044,1036,1028,1019,1011,1003,994,986,977,969,961,952,944,936,927,919,
+    911,902,894,886,877,869,861,852,844,836,827,819,811,803,794,786,
+    778,769,761,753,744,736,728,720,711,703,695,687,678,670,662,654,
+    645,637,629,621,612,604,596,588,580,571,563,555,547,539,530,522,
+    514,506,498,489,481,473,465,457,449,440,432,424,416,408,400,391,
+    383,375,367,359,351,343,335,326,318,310,302,294,286,278,270,262,
+    253,245,237,229,221,213,205,197,189,181,173,165,157,149,140,132,
+    124,116,108,100,92,84,76,68,60,52,44,36,28,20,12,4,
+};
+
+#ifdef __SSE2__
+// Four unsigned (a * b) >> shift, where every result fits in 32 bits
+static inline __m128i umulshift_x4(__m128i a, __m128i b, int shift) {
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), shift);
+    __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), shift);
+    return _mm_or_si128(_mm_and_si128(even, _mm_set_epi32(0, -1, 0, -1)), _mm_slli_epi64(odd, 32));
+}
+
+// irsqrt_newton() on four lanes
+static inline __m128i irsqrt_newton_x4(__m128i m, __m128i y) {
+    __m128i y2 = umulshift_x4(y, y, 29);
+    __m128i fy2 = umulshift_x4(m, y2, 32);
+    return umulshift_x4(y, _mm_sub_epi32(_mm_set1_epi32(3 << 29), fy2), 30);
+}
+#endif
+
+// isqrt() on many values. With the integer path, normalization and the final fixup are per
+// value and the Newton step runs four at a time.
+void isqrt_batch(const int32_t* in, int32_t* out, int32_t count) {
+    int32_t i = 0;
+#if defined(__SSE2__) && defined(FIXEDMATH_INTEGER_SQRT)
+    for(; fixedmath_simd && i + 4 <= count; i += 4) {
+        uint32_t m[4];
+        uint32_t y[4];
+        int k[4];
+        for(int j = 0; j < 4; j++) {
+            // Dummy value for the lanes that don't get a root, fixed up below
+            m[j] = irsqrt_normalize(in[i + j] > 0 ? (uint32_t)in[i + j] : 1, &k[j]);
+            y[j] = irsqrt_seed(m[j]);
+        }
+
+        __m128i mv = _mm_loadu_si128((const __m128i*)m);
+        __m128i yv = _mm_loadu_si128((const __m128i*)y);
+        yv = irsqrt_newton_x4(mv, yv);
+        _mm_storeu_si128((__m128i*)y, yv);
+
+        for(int j = 0; j < 4; j++) {
+            int32_t val = in[i + j];
+            out[i + j] = val <= 0 ? 0 : isqrt_fixup(val, ((uint64_t)val * y[j]) >> (39 - k[j]));
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = isqrt(in[i]);
+    }
+}
+
+#ifdef __SSE4_1__
+// Four imul()s at once. pmuldq only looks at the even lanes, so do evens and odds
+// separately. Only the low 32 bits of (a * b) >> 12 survive, so a logical 64 bit
+// shift gives the same result as the arithmetic one the scalar version does.
+static inline __m128i imul_x4(__m128i a, __m128i b) {
+    __m128i even = _mm_srli_epi64(_mm_mul_epi32(a, b), 12);
+    __m128i odd = _mm_srli_epi64(_mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), 12);
+    return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+}
+
+// Transform a vector given as four broadcast components by the columns of a matrix
+static inline __m128i transform_x4(const __m128i* col, __m128i x, __m128i y, __m128i z, __m128i w) {
+    __m128i res = imul_x4(x, col[0]);
+    res = _mm_add_epi32(res, imul_x4(y, col[1]));
+    res = _mm_add_epi32(res, imul_x4(z, col[2]));
+    return _mm_add_epi32(res, imul_x4(w, col[3]));
+}
+#endif
+
+// Transform count vectors by one matrix
+void imat4x4transform_batch(imat4x4_t m, const ivec4_t* in, ivec4_t* out, int32_t count) {
+    int32_t i = 0;
+#ifdef __SSE4_1__
+    if(fixedmath_simd) {
+        __m128i col[4];
+        for(int j = 0; j < 4; j++) {
+            col[j] = _mm_loadu_si128((const __m128i*)&m.m[j * 4]);
+        }
+
+        for(; i < count; i++) {
+            __m128i v = _mm_loadu_si128((const __m128i*)&in[i]);
+            __m128i res = transform_x4(col,
+                _mm_shuffle_epi32(v, 0x00),
+                _mm_shuffle_epi32(v, 0x55),
+                _mm_shuffle_epi32(v, 0xAA),
+                _mm_shuffle_epi32(v, 0xFF)
+            );
+            _mm_storeu_si128((__m128i*)&out[i], res);
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = imat4x4transform(m, in[i]);
+    }
+}
+
+// Transform count points (implicit w = 1) by one matrix. imul(1, x) == x, so
+// the w column can just be added.
+void imat4x4transformpoints_batch(imat4x4_t m, const ivec3_t* in, ivec4_t* out, int32_t count) {
+    int32_t i = 0;
+#ifdef __SSE4_1__
+    if(fixedmath_simd) {
+        __m128i col[4];
+        for(int j = 0; j < 4; j++) {
+            col[j] = _mm_loadu_si128((const __m128i*)&m.m[j * 4]);
+        }
+
+        for(; i < count; i++) {
+            __m128i res = imul_x4(_mm_set1_epi32(in[i].x), col[0]);
+            res = _mm_add_epi32(res, imul_x4(_mm_set1_epi32(in[i].y), col[1]));
+            res = _mm_add_epi32(res, imul_x4(_mm_set1_epi32(in[i].z), col[2]));
+            res = _mm_add_epi32(res, col[3]);
+            _mm_storeu_si128((__m128i*)&out[i], res);
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = imat4x4transform(m, ivec4(in[i].x, in[i].y, in[i].z, INT_FIXED(1)));
+    }
+}
+
+// Multiply count pairs of matrices
+void imat4x4mul_batch(const imat4x4_t* a, const imat4x4_t* b, imat4x4_t* out, int32_t count) {
+    int32_t i = 0;
+#ifdef __SSE4_1__
+    for(; fixedmath_simd && i < count; i++) {
+        // Column c of a * b is a * (column c of b)
+        __m128i col[4];
+        for(int j = 0; j < 4; j++) {
+            col[j] = _mm_loadu_si128((const __m128i*)&a[i].m[j * 4]);
+        }
+
+        for(int c = 0; c < 4; c++) {
+            const int32_t* bc = &b[i].m[c * 4];
+            __m128i res = transform_x4(col,
+                _mm_set1_epi32(bc[0]),
+                _mm_set1_epi32(bc[1]),
+                _mm_set1_epi32(bc[2]),
+                _mm_set1_epi32(bc[3])
+            );
+            _mm_storeu_si128((__m128i*)&out[i].m[c * 4], res);
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = imat4x4mul(a[i], b[i]);
+    }
+}
+
+// Multiply a chain of matrices, left to right
+imat4x4_t imat4x4mul_chain(const imat4x4_t* mats, int32_t count) {
+    imat4x4_t res = imat4x4scale(INT_FIXED(1));
+    if(count <= 0) {
+        return res;
+    }
+
+    res = mats[0];
+    for(int32_t i = 1; i < count; i++) {
+        imat4x4mul_batch(&res, &mats[i], &res, 1);
+    }
+    return res;
+}
+
+// Dot products of count pairs of vectors
+void ivec3dot_batch(const ivec3_t* a, const ivec3_t* b, int32_t* out, int32_t count) {
+    int32_t i = 0;
+#ifdef __SSE4_1__
+    // Four vectors are exactly three registers. Multiply component-wise, then add up
+    // the triples.
+    for(; fixedmath_simd && i + 4 <= count; i += 4) {
+        int32_t prod[12];
+        for(int j = 0; j < 3; j++) {
+            __m128i va = _mm_loadu_si128((const __m128i*)&a[i].x + j);
+            __m128i vb = _mm_loadu_si128((const __m128i*)&b[i].x + j);
+            _mm_storeu_si128((__m128i*)prod + j, imul_x4(va, vb));
+        }
+        for(int j = 0; j < 4; j++) {
+            out[i + j] = prod[j * 3] + prod[j * 3 + 1] + prod[j * 3 + 2];
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = ivec3dot(a[i], b[i]);
+    }
+}
+
+// Normalize count vectors. Dot products and square roots are batched, the division
+// is per vector.
+void ivec3norm_batch(const ivec3_t* in, ivec3_t* out, int32_t count) {
+    int32_t lengths[64];
+    for(int32_t base = 0; base < count; base += 64) {
+        int32_t chunk = imin(count - base, 64);
+        ivec3dot_batch(&in[base], &in[base], lengths, chunk);
+        isqrt_batch(lengths, lengths, chunk);
+        for(int32_t i = 0; i < chunk; i++) {
+            int32_t abs = lengths[i];
+            if(abs == 0) {
+                out[base + i] = ivec3(0, 0, 0);
+            }
+            else {
+                out[base + i] = ivec3div(in[base + i], abs);
+            }
+        }
+    }
+}
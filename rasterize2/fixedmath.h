@@ -7,12 +7,15 @@
 #ifndef __FIXEDMATH_H__
 #define __FIXEDMATH_H__
 
-// For sqrt
 #include <math.h>
 
 // Scalars
 #include <stdint.h>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 // "Signed shift" warnings. Should your compiler actually not
 // compile signed shifts as arithmetic, then well, change this.
 #define FLOAT_FIXED(val)  (int32_t)((val)*4096.0)
@@ -29,7 +32,86 @@ static inline int32_t imul(int32_t a, int32_t b) { return (int32_t)imul64(a, b);
 static inline int64_t idiv64(int64_t num, int64_t den) { return (num << 12) / den; }
 static inline int32_t idiv(int32_t num, int32_t den) { return (int32_t)idiv64(num, den); }
 
-static inline int32_t isqrt(int32_t val) { return (int32_t)sqrt(((double)val)*4096.0); } // TODO how good is sqrt on Cortex-M4F?
+// Square root and reciprocal square root. isqrt is exact, i.e. (int32_t)sqrt(val * 4096.0),
+// and 0 for val <= 0. irsqrt is 1 / sqrt(val) within 1 ulp, and 0 for val <= 0, integer only
+// (table seed + one Newton step). isqrt uses the hardware sqrt, which on x86 is about 4x
+// faster than the integer path; define FIXEDMATH_INTEGER_SQRT for targets without an FPU
+// to get the integer path for isqrt too. Both give the same results.
+extern const uint16_t irsqrt_table[3072];
+
+static inline int iclz32(uint32_t x) {
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanReverse(&idx, x);
+    return 31 - (int)idx;
+#else
+    return __builtin_clz(x);
+#endif
+}
+
+// Scale x (> 0) by an even power of two into m in [2^30, 2^32), so that x = m / 4^k.
+// Seen as f = m / 2^32 in [0.25, 1), 1 / sqrt(x) is then 2^(k - 16) / sqrt(f).
+static inline uint32_t irsqrt_normalize(uint32_t x, int* k) {
+    *k = iclz32(x) >> 1;
+    return x << (*k * 2);
+}
+
+// One Newton step for y = 1 / sqrt(f): y' = y * (3 - f * y^2) / 2. y stays at or below
+// 2.0 (give or take rounding), so every intermediate fits in 32 bits.
+static inline uint32_t irsqrt_newton(uint32_t m, uint32_t y) {
+    uint32_t y2 = (uint32_t)(((uint64_t)y * y) >> 29);
+    uint32_t fy2 = (uint32_t)(((uint64_t)m * y2) >> 32);
+    return (uint32_t)(((uint64_t)y * ((3u << 29) - fy2)) >> 30);
+}
+
+// Table seed for a normalized m, in 3.29
+static inline uint32_t irsqrt_seed(uint32_t m) {
+    return (1u << 29) + ((uint32_t)irsqrt_table[(m >> 20) - 1024] << 13);
+}
+
+// 1 / sqrt(f) in 3.29 for a normalized m. Relative error is below 2^-23.
+static inline uint32_t irsqrt_q29(uint32_t m) {
+    return irsqrt_newton(m, irsqrt_seed(m));
+}
+
+// Turn an approximate root of val << 12 into the exact floor. With the error bound
+// above, s is off by at most one either way, so both checks can be done at once.
+static inline int32_t isqrt_fixup(int32_t val, uint64_t s) {
+    uint64_t n = (uint64_t)val << 12;
+    return (int32_t)s + ((s + 1) * (s + 1) <= n) - (s * s > n);
+}
+
+#ifdef FIXEDMATH_INTEGER_SQRT
+// sqrt(val * 4096) = val * 64 / sqrt(val), and 64 / sqrt(val) = y * 2^(k - 39)
+static inline int32_t isqrt(int32_t val) {
+    if(val <= 0) {
+        return 0;
+    }
+
+    int k;
+    uint32_t m = irsqrt_normalize((uint32_t)val, &k);
+    uint32_t y = irsqrt_q29(m);
+    return isqrt_fixup(val, ((uint64_t)val * y) >> (39 - k));
+}
+#else
+static inline int32_t isqrt(int32_t val) {
+    return val <= 0 ? 0 : (int32_t)sqrt((double)val * 4096.0);
+}
+#endif
+
+// 1 / sqrt(val / 4096) in 20.12 is y * 2^(k - 27)
+static inline int32_t irsqrt(int32_t val) {
+    if(val <= 0) {
+        return 0;
+    }
+
+    int k;
+    uint32_t m = irsqrt_normalize((uint32_t)val, &k);
+    uint32_t y = irsqrt_q29(m);
+    return (int32_t)((y + (1u << (26 - k))) >> (27 - k));
+}
+
+void isqrt_batch(const int32_t* in, int32_t* out, int32_t count);
 
 static inline int32_t imin(int32_t a, int32_t b) { return a < b ? a : b; }
 static inline int32_t imax(int32_t a, int32_t b) { return a > b ? a : b; }
@@ -78,6 +160,28 @@ static inline ivec3_t ivec3norm(ivec3_t v) {
     }
 }
 
+// Normalize by multiplying with a full precision reciprocal length instead of dividing
+// each component by the (truncated) length. Saves the three divisions; components end
+// up within 2 ulp of exact, same as ivec3norm.
+static inline ivec3_t ivec3normfast(ivec3_t v) {
+    int32_t dot = ivec3dot(v, v);
+    if(dot <= 0) {
+        return ivec3(0, 0, 0);
+    }
+
+    // Same as irsqrt, but keep all the bits of y and shift once per component
+    int k;
+    uint32_t m = irsqrt_normalize((uint32_t)dot, &k);
+    int64_t y = irsqrt_q29(m);
+    int shift = 39 - k;
+    int64_t round = (int64_t)1 << (shift - 1);
+    return ivec3(
+        (int32_t)((v.x * y + round) >> shift),
+        (int32_t)((v.y * y + round) >> shift),
+        (int32_t)((v.z * y + round) >> shift)
+    );
+}
+
 static inline ivec4_t ivec4norm(ivec4_t v) {
     int32_t abs = ivec4abs(v);
     if (abs == 0) {
@@ -338,4 +442,17 @@ static inline imat4x4_t imat4x4lookat(ivec3_t eye, ivec3_t lookat, ivec3_t up) {
         0, 0, 0, INT_FIXED(1)
     );
 }
+
+// Batched versions of some of the above, for when there's a lot of data to push through.
+// Results are bit-exact with calling the scalar versions in a loop. Uses SSE4.1 if the
+// compiler is allowed to, plain C otherwise.
+// Clearing fixedmath_simd switches to plain C at runtime, for checking one against the
+// other.
+extern int32_t fixedmath_simd;
+void imat4x4transform_batch(imat4x4_t m, const ivec4_t* in, ivec4_t* out, int32_t count);
+void imat4x4transformpoints_batch(imat4x4_t m, const ivec3_t* in, ivec4_t* out, int32_t count); // w = 1
+void imat4x4mul_batch(const imat4x4_t* a, const imat4x4_t* b, imat4x4_t* out, int32_t count);
+imat4x4_t imat4x4mul_chain(const imat4x4_t* mats, int32_t count); // mats[0] * mats[1] * ...
+void ivec3dot_batch(const ivec3_t* a, const ivec3_t* b, int32_t* out, int32_t count);
+void ivec3norm_batch(const ivec3_t* in, ivec3_t* out, int32_t count);
 #endif
@@ -0,0 +1,231 @@
+/**
+* Property tests for the batched fixed point math in fixedmath.c: Feeds
+* random and edge case inputs (0, +-1, +-1.0, INT_MIN, INT_MAX, huge and
+* negative values) through every *_batch function and imat4x4mul_chain, at
+* every count from 0 up past the SIMD and chunk sizes, with fixedmath_simd
+* on and off, and checks the results against the scalar functions in a
+* plain loop. Also checks nothing gets written past count.
+*
+* Prints the first mismatches and exits with 1 if there are any.
+*
+* Usage: fixedtest [rounds]
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "fixedmath.h"
+
+// Largest count tried (past a few ivec3norm_batch chunks of 64), matrices
+// in the longest chain, default rounds of everything
+#define TEST_MAX_COUNT 140
+#define TEST_MAX_CHAIN 12
+#define TEST_ROUNDS 50
+
+// Mismatches printed before going quiet
+#define TEST_MAX_REPORTS 10
+
+#define TEST_SEED 1234
+
+// Goes into outputs first, must still be there past count afterwards
+#define TEST_SENTINEL 0x5A
+
+static const int32_t edge_values[] = {
+    0, 1, -1, INT_FIXED(1), -INT_FIXED(1), INT_FIXED(1) - 1, INT_FIXED(1) + 1,
+    INT_MIN, INT_MIN + 1, INT_MAX, INT_MAX - 1, 1 << 16, -(1 << 16), 1 << 24, -(1 << 24)
+};
+#define NUM_EDGE_VALUES ((int32_t)(sizeof(edge_values) / sizeof(edge_values[0])))
+
+static int32_t failures = 0;
+
+// rand() may only give 15 bits
+static uint32_t random_bits() {
+    return ((uint32_t)rand() & 0x7FFF) | (((uint32_t)rand() & 0x7FFF) << 15) | ((uint32_t)rand() << 30);
+}
+
+// Mostly values a game would see, plus edge cases and anything at all
+static int32_t random_value() {
+    switch(rand() % 4) {
+        case 0:
+            return edge_values[rand() % NUM_EDGE_VALUES];
+        case 1:
+            return (int32_t)random_bits();
+        default:
+            return (int32_t)(random_bits() % INT_FIXED(2000)) - INT_FIXED(1000);
+    }
+}
+
+static void random_values(int32_t* values, int32_t count) {
+    for(int32_t i = 0; i < count; i++) {
+        values[i] = random_value();
+    }
+}
+
+// Count a mismatch, printing the first few
+static void mismatch(const char* func, int32_t count, int32_t index, const char* what) {
+    if(failures < TEST_MAX_REPORTS) {
+        printf("MISMATCH %s (%s), count %d, element %d: %s\n", func, fixedmath_simd ? "simd" : "scalar", count, index, what);
+    }
+    failures++;
+}
+
+// Compare count elements of size bytes, and that the sentinel past them is
+// untouched
+static void check(const char* func, int32_t count, const void* expected, const void* got, size_t size) {
+    const uint8_t* e = (const uint8_t*)expected;
+    const uint8_t* g = (const uint8_t*)got;
+    for(int32_t i = 0; i < count; i++) {
+        if(memcmp(&e[i * size], &g[i * size], size) != 0) {
+            mismatch(func, count, i, "differs from the scalar version");
+            return;
+        }
+    }
+    for(size_t i = count * size; i < (count + 1) * size; i++) {
+        if(g[i] != TEST_SENTINEL) {
+            mismatch(func, count, count, "written past count");
+            return;
+        }
+    }
+}
+
+static void test_isqrt(int32_t count) {
+    static int32_t in[TEST_MAX_COUNT];
+    static int32_t expected[TEST_MAX_COUNT];
+    static int32_t got[TEST_MAX_COUNT + 1];
+    random_values(in, count);
+    for(int32_t i = 0; i < count; i++) {
+        expected[i] = isqrt(in[i]);
+    }
+    memset(got, TEST_SENTINEL, sizeof(got));
+    isqrt_batch(in, got, count);
+    check("isqrt_batch", count, expected, got, sizeof(got[0]));
+}
+
+static void test_transform(int32_t count) {
+    static ivec4_t in[TEST_MAX_COUNT];
+    static ivec4_t expected[TEST_MAX_COUNT];
+    static ivec4_t got[TEST_MAX_COUNT + 1];
+    imat4x4_t m;
+    random_values(m.m, 16);
+    random_values(&in[0].x, count * 4);
+    for(int32_t i = 0; i < count; i++) {
+        expected[i] = imat4x4transform(m, in[i]);
+    }
+    memset(got, TEST_SENTINEL, sizeof(got));
+    imat4x4transform_batch(m, in, got, count);
+    check("imat4x4transform_batch", count, expected, got, sizeof(got[0]));
+}
+
+static void test_transformpoints(int32_t count) {
+    static ivec3_t in[TEST_MAX_COUNT];
+    static ivec4_t expected[TEST_MAX_COUNT];
+    static ivec4_t got[TEST_MAX_COUNT + 1];
+    imat4x4_t m;
+    random_values(m.m, 16);
+    random_values(&in[0].x, count * 3);
+    for(int32_t i = 0; i < count; i++) {
+        expected[i] = imat4x4transform(m, ivec4(in[i].x, in[i].y, in[i].z, INT_FIXED(1)));
+    }
+    memset(got, TEST_SENTINEL, sizeof(got));
+    imat4x4transformpoints_batch(m, in, got, count);
+    check("imat4x4transformpoints_batch", count, expected, got, sizeof(got[0]));
+}
+
+static void test_mul(int32_t count) {
+    static imat4x4_t a[TEST_MAX_COUNT];
+    static imat4x4_t b[TEST_MAX_COUNT];
+    static imat4x4_t expected[TEST_MAX_COUNT];
+    static imat4x4_t got[TEST_MAX_COUNT + 1];
+    random_values(a[0].m, count * 16);
+    random_values(b[0].m, count * 16);
+    for(int32_t i = 0; i < count; i++) {
+        expected[i] = imat4x4mul(a[i], b[i]);
+    }
+    memset(got, TEST_SENTINEL, sizeof(got));
+    imat4x4mul_batch(a, b, got, count);
+    check("imat4x4mul_batch", count, expected, got, sizeof(got[0]));
+}
+
+static void test_dot(int32_t count) {
+    static ivec3_t a[TEST_MAX_COUNT];
+    static ivec3_t b[TEST_MAX_COUNT];
+    static int32_t expected[TEST_MAX_COUNT];
+    static int32_t got[TEST_MAX_COUNT + 1];
+    random_values(&a[0].x, count * 3);
+    random_values(&b[0].x, count * 3);
+    for(int32_t i = 0; i < count; i++) {
+        expected[i] = ivec3dot(a[i], b[i]);
+    }
+    memset(got, TEST_SENTINEL, sizeof(got));
+    ivec3dot_batch(a, b, got, count);
+    check("ivec3dot_batch", count, expected, got, sizeof(got[0]));
+}
+
+static void test_norm(int32_t count) {
+    static ivec3_t in[TEST_MAX_COUNT];
+    static ivec3_t expected[TEST_MAX_COUNT];
+    static ivec3_t got[TEST_MAX_COUNT + 1];
+    random_values(&in[0].x, count * 3);
+    for(int32_t i = 0; i < count; i++) {
+        expected[i] = ivec3norm(in[i]);
+    }
+    memset(got, TEST_SENTINEL, sizeof(got));
+    ivec3norm_batch(in, got, count);
+    check("ivec3norm_batch", count, expected, got, sizeof(got[0]));
+}
+
+static void test_chain(int32_t count) {
+    imat4x4_t mats[TEST_MAX_CHAIN];
+    random_values(mats[0].m, count * 16);
+    imat4x4_t expected = imat4x4scale(INT_FIXED(1));
+    if(count > 0) {
+        expected = mats[0];
+        for(int32_t i = 1; i < count; i++) {
+            expected = imat4x4mul(expected, mats[i]);
+        }
+    }
+    imat4x4_t got = imat4x4mul_chain(mats, count);
+    if(memcmp(&expected, &got, sizeof(got)) != 0) {
+        mismatch("imat4x4mul_chain", count, 0, "differs from the scalar version");
+    }
+}
+
+int main(int argc, char** argv) {
+    int32_t rounds = argc > 1 ? atoi(argv[1]) : TEST_ROUNDS;
+    if(rounds <= 0) {
+        printf("Usage: %s [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    srand(TEST_SEED);
+    for(int32_t round = 0; round < rounds; round++) {
+        for(int32_t simd = 0; simd < 2; simd++) {
+            fixedmath_simd = simd;
+            for(int32_t count = 0; count <= TEST_MAX_COUNT; count++) {
+                test_isqrt(count);
+                test_transform(count);
+                test_transformpoints(count);
+                test_mul(count);
+                test_dot(count);
+                test_norm(count);
+            }
+            for(int32_t count = 0; count <= TEST_MAX_CHAIN; count++) {
+                test_chain(count);
+            }
+        }
+    }
+    fixedmath_simd = 1;
+
+    if(failures != 0) {
+        printf("FAILED: %d mismatches\n", failures);
+        return 1;
+    }
+    printf("Passed: %d rounds, counts up to %d, simd and scalar\n", rounds, TEST_MAX_COUNT);
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+* Image files: The one place that includes the BMP handler
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "images.h"
+#include "rasterize.h"
+#include "timing.h"
+#include "bmp_handler.h"
+
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+// One row of BGR888 pixels to RGB332
+static void convert_row(const uint8_t* bgr, uint8_t* out, int32_t width) {
+    int32_t x = 0;
+#ifdef __SSSE3__
+    // 16 pixels from three loads: Shuffle each colour into a register of its
+    // own, then mask and shift the bits that are kept into place. 16 bit
+    // shifts are fine, the masks drop what comes over from the next byte.
+    const __m128i blue_0 = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i blue_1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+    const __m128i blue_2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+    const __m128i green_0 = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i green_1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+    const __m128i green_2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+    const __m128i red_0 = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i red_1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+    const __m128i red_2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+    const __m128i red_mask = _mm_set1_epi8((char)0xE0);
+    const __m128i green_mask = _mm_set1_epi8(0x1C);
+    const __m128i blue_mask = _mm_set1_epi8(0x03);
+
+    for(; x + 16 <= width; x += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(bgr + x * 3));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(bgr + x * 3 + 16));
+        __m128i v2 = _mm_loadu_si128((const __m128i*)(bgr + x * 3 + 32));
+        __m128i b = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, blue_0), _mm_shuffle_epi8(v1, blue_1)), _mm_shuffle_epi8(v2, blue_2));
+        __m128i g = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, green_0), _mm_shuffle_epi8(v1, green_1)), _mm_shuffle_epi8(v2, green_2));
+        __m128i r = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, red_0), _mm_shuffle_epi8(v1, red_1)), _mm_shuffle_epi8(v2, red_2));
+
+        __m128i packed = _mm_and_si128(r, red_mask);
+        packed = _mm_or_si128(packed, _mm_and_si128(_mm_srli_epi16(g, 3), green_mask));
+        packed = _mm_or_si128(packed, _mm_and_si128(_mm_srli_epi16(b, 6), blue_mask));
+        _mm_storeu_si128((__m128i*)(out + x), packed);
+    }
+#endif
+    for(; x < width; x++) {
+        out[x] = RGB332(bgr[x * 3 + 2], bgr[x * 3 + 1], bgr[x * 3]);
+    }
+}
+
+// The whole file in one read, then a row at a time. Rows are padded to 4
+// bytes and stored bottom up, unless the height is negative. Either way, the
+// texture gets the bottom row first, like the framebuffer.
+uint8_t* load_texture(const char* path) {
+    timer_begin("load_texture");
+    uint8_t* texture = 0;
+    uint8_t* data = 0;
+    long size = 0;
+
+    FILE* file = fopen(path, "rb");
+    if(file != 0) {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        data = size > 0 ? (uint8_t*)malloc(size) : 0;
+        if(data != 0 && fread(data, 1, size, file) != (size_t)size) {
+            size = 0;
+        }
+        fclose(file);
+    }
+
+    bmp_header header;
+    if(data != 0 && size >= (long)sizeof(bmp_header)) {
+        memcpy(&header, data, sizeof(bmp_header));
+        int32_t width = (int32_t)header.x_size;
+        int32_t height = (int32_t)header.y_size;
+        int32_t top_down = height < 0;
+        height = top_down ? -height : height;
+        int64_t stride = ((int64_t)width * 3 + 3) & ~3;
+
+        if(
+            header.file_type[0] == 'B' && header.file_type[1] == 'M' && header.bpp == 24 && header.compression == 0 &&
+            width > 0 && height > 0 && header.pixel_offset + stride * height <= size
+        ) {
+            texture = (uint8_t*)malloc((size_t)width * height);
+            for(int32_t y = 0; y < height; y++) {
+                int32_t row = top_down ? height - 1 - y : y;
+                convert_row(data + header.pixel_offset + row * stride, texture + (size_t)y * width, width);
+            }
+        }
+    }
+    if(texture == 0) {
+        printf("Could not load %s as a 24 bit BMP\n", path);
+    }
+
+    free(data);
+    timer_end();
+    return texture;
+}
+
+void save_framebuffer(const char* path, const uint8_t* framebuffer, int32_t width, int32_t height) {
+    bmp_info* bmp_file = bmp_open_write(path, width, height);
+    for(int32_t i = 0; i < width * height; i++) {
+        // Stretch 3/3/2 bits back out to the full 0-255 range
+        uint8_t pixel = framebuffer[i];
+        bmp_write_pixel(bmp_file, (pixel >> 5) * 255 / 7, ((pixel >> 2) & 0x07) * 255 / 7, (pixel & 0x03) * 255 / 3);
+    }
+    bmp_close(bmp_file);
+}
+
+void save_framebuffer_diff(const char* path, const uint8_t* expected, const uint8_t* actual, int32_t width, int32_t height) {
+    bmp_info* bmp_file = bmp_open_write(path, width, height);
+    for(int32_t i = 0; i < width * height; i++) {
+        if(expected[i] != actual[i]) {
+            bmp_write_pixel(bmp_file, 255, 0, 0);
+        }
+        else {
+            uint8_t pixel = expected[i];
+            bmp_write_pixel(bmp_file, (pixel >> 5) * 85 / 7, ((pixel >> 2) & 0x07) * 85 / 7, (pixel & 0x03) * 85 / 3);
+        }
+    }
+    bmp_close(bmp_file);
+}
+
+uint64_t hash_framebuffer(const uint8_t* framebuffer, int32_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(int32_t i = 0; i < size; i++) {
+        hash ^= framebuffer[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
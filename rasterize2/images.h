@@ -0,0 +1,25 @@
+/**
+* Image files: Loading BMPs as RGB332 textures and saving framebuffers
+*/
+
+#ifndef __IMAGES_H__
+#define __IMAGES_H__
+
+#include <stdint.h>
+
+// Load a 24 bit BMP as an RGB332 texture, bottom row first, allocated with
+// malloc. 0 if the file can't be read or isn't an uncompressed 24 bit BMP.
+uint8_t* load_texture(const char* path);
+
+// Save an RGB332 framebuffer (bottom row first, like it goes to GL) as a
+// 24 bit BMP
+void save_framebuffer(const char* path, const uint8_t* framebuffer, int32_t width, int32_t height);
+
+// Save where two framebuffers differ: Differing pixels in red, the rest of
+// the expected one dimmed
+void save_framebuffer_diff(const char* path, const uint8_t* expected, const uint8_t* actual, int32_t width, int32_t height);
+
+// 64 bit FNV-1a hash of a framebuffer, for comparing renders
+uint64_t hash_framebuffer(const uint8_t* framebuffer, int32_t size);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+* Levels: Model placement and texture lists per stage
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "levels.h"
+#include "mesh.h"
+#include "bsp.h"
+#include "images.h"
+
+static const char* level_names[NUM_LEVELS] = {
+    "city",
+    "ringworld",
+    "core"
+};
+
+const char* level_name(int32_t id) {
+    return id >= 0 && id < NUM_LEVELS ? level_names[id] : "unknown";
+}
+
+int32_t level_find(const char* name) {
+    for(int32_t i = 0; i < NUM_LEVELS; i++) {
+        if(strcmp(name, level_names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Meshes live in data/, made from models/*.obj. Without them there is
+// nothing to play.
+static model_t load_mesh(const char* path) {
+    model_t model;
+    if(!mesh_load(&model, path)) {
+        printf("Could not load mesh %s\n", path);
+        exit(1);
+    }
+    return model;
+}
+
+static void add_model(level_t* level, model_t model, imat4x4_t modelview) {
+    bsp_compile_model(&model);
+    model.modelview = modelview;
+    model.draw = 1;
+    level->models[level->num_models++] = model;
+}
+
+static void add_texture(level_t* level, const char* path) {
+    level->textures[level->num_textures++] = load_texture(path);
+}
+
+void level_load(level_t* level, int32_t id, int32_t num_enemies) {
+    memset(level, 0, sizeof(level_t));
+    level->id = id;
+
+    // Static geometry, BSP compiled where that pays off
+    switch(id) {
+        case LEVEL_CITY:
+            add_model(level, load_mesh("data/tower.mesh"), imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(0), INT_FIXED(0))));
+            add_model(level, load_mesh("data/cityscape.mesh"), imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(0), INT_FIXED(160))));
+            add_model(level, load_mesh("data/cityscape.mesh"), imat4x4translate(ivec3(INT_FIXED(138), INT_FIXED(0), INT_FIXED(-80))));
+            add_model(level, load_mesh("data/cityscape.mesh"), imat4x4translate(ivec3(INT_FIXED(-138), INT_FIXED(0), INT_FIXED(-80))));
+
+            add_texture(level, "data/tower.bmp");
+            for(int i = 0; i < 3; i++) {
+                add_texture(level, "data/windows.bmp");
+                add_texture(level, "data/roof_sharp.bmp");
+                add_texture(level, "data/roof_flat.bmp");
+                add_texture(level, "data/windows.bmp");
+            }
+            level->floor_texture = load_texture("data/floor.bmp");
+            level->sky_color = RGB332(36, 0, 85);
+            break;
+
+        case LEVEL_RINGWORLD:
+            add_model(level, load_mesh("data/ringworld.mesh"), imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(95), INT_FIXED(0))));
+
+            add_texture(level, "data/ringworld.bmp");
+            level->floor_texture = load_texture("data/floor.bmp");
+            level->sky_color = RGB332(0, 0, 0);
+            break;
+
+        case LEVEL_CORE:
+            for(int i = 0; i < 3; i++) {
+                add_model(level, load_mesh("data/core.mesh"), imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(0), INT_FIXED(0))));
+            }
+            for(int i = 0; i < 9; i++) {
+                add_texture(level, "data/core.bmp");
+            }
+            level->floor_texture = load_texture("data/floor2.bmp");
+            level->sky_color = RGB332(197, 46, 106);
+            level_animate(id, level->models, 0.0);
+            break;
+    }
+    level->num_static_models = level->num_models;
+
+    // Enemies
+    num_enemies = imin(num_enemies, LEVEL_MAX_MODELS - level->num_models);
+    for(int i = 0; i < num_enemies; i++) {
+        model_t enemy = load_mesh("data/enemy.mesh");
+        enemy.draw = 1;
+        level->models[level->num_models++] = enemy;
+        add_texture(level, "data/enemy.bmp");
+    }
+
+    // Texture indices count on from model to model, and have to stay within
+    // the level's textures
+    int tex_offset = 0;
+    for(int m = 0; m < level->num_models; m++) {
+        int tex_max = 0;
+        for(int i = 0; i < level->models[m].num_faces; i++) {
+            tex_max = imax(level->models[m].faces[i].v[7], tex_max);
+        }
+        if(tex_offset + tex_max >= level->num_textures) {
+            printf("Model %d of level %s uses texture %d, but the level only has %d\n", m, level_name(id), tex_offset + tex_max, level->num_textures);
+            exit(1);
+        }
+        level->models[m].textures = &level->textures[tex_offset];
+        tex_offset += tex_max + 1;
+    }
+}
+
+void level_free(level_t* level) {
+    for(int i = 0; i < level->num_models; i++) {
+        bsp_release_model(&level->models[i]);
+    }
+    for(int i = 0; i < level->num_textures; i++) {
+        free(level->textures[i]);
+    }
+    free(level->floor_texture);
+    memset(level, 0, sizeof(level_t));
+}
+
+void level_animate(int32_t id, model_t* models, double alltime) {
+    switch(id) {
+        case LEVEL_RINGWORLD:
+            models[0].modelview = imat4x4mul(
+                imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(95), INT_FIXED(0))),
+                imat4x4rotatey(FLOAT_FIXED(alltime * 0.01))
+            );
+            break;
+
+        case LEVEL_CORE:
+            for(int i = 0; i < 3; i++) {
+                models[i].modelview = imat4x4mul(
+                    imat4x4rotatey(FLOAT_FIXED(alltime * 0.02) + FLOAT_FIXED(i / 3.0))
+                    , imat4x4mul(
+                        imat4x4translate(ivec3(INT_FIXED(135), INT_FIXED(0), INT_FIXED(0))),
+                        imat4x4rotatey(FLOAT_FIXED(alltime * 0.1))
+                        )
+                    );
+            }
+            break;
+    }
+}
@@ -0,0 +1,44 @@
+/**
+* Levels: Static geometry, textures, floor and sky of every stage, set up the
+* same way for the game and for the headless tools
+*/
+
+#ifndef __LEVELS_H__
+#define __LEVELS_H__
+
+#include "rasterize.h"
+
+#define LEVEL_CITY 0
+#define LEVEL_RINGWORLD 1
+#define LEVEL_CORE 2
+#define NUM_LEVELS 3
+
+#define LEVEL_MAX_MODELS 20
+#define LEVEL_MAX_TEXTURES 64
+
+// A loaded level. The static models come first, then the enemies. Owns its
+// textures.
+typedef struct {
+    int32_t id;
+    model_t models[LEVEL_MAX_MODELS];
+    int32_t num_models;
+    int32_t num_static_models;
+    uint8_t* textures[LEVEL_MAX_TEXTURES];
+    int32_t num_textures;
+    uint8_t* floor_texture;
+    uint8_t sky_color;
+} level_t;
+
+// Name for messages and command lines, and back (-1 if there is none)
+const char* level_name(int32_t id);
+int32_t level_find(const char* name);
+
+// Load models and textures from data/, with num_enemies enemy models after
+// the static ones. Enemies are drawn, at the origin, until moved.
+void level_load(level_t* level, int32_t id, int32_t num_enemies);
+void level_free(level_t* level);
+
+// Move the static models of level id to where they are alltime seconds in
+void level_animate(int32_t id, model_t* models, double alltime);
+
+#endif
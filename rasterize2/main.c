@@ -30,8 +30,14 @@
 #include <string.h>
 
 #include "rasterize.h"
-#include "models.h"
-#include "bmp_handler.h"
+#include "timing.h"
+#include "threads.h"
+#include "levels.h"
+#include "images.h"
+#include "replay.h"
+#include "pacing.h"
+#include "trace.h"
+#include "capture.h"
 
 #include "text/font8x8_basic.h"
 
@@ -48,8 +54,6 @@ uint8_t cyber_cols[8] = {
     RGB332(0  , 255, 253) 
 };
 
-uint8_t sky_color;
-
 // The Enemy
 typedef struct enemy {
     ivec3_t pos;
@@ -70,7 +74,6 @@ int32_t player_charge;
 int32_t player_health;
 int32_t player_shake;
 int32_t stage_enemies_max;
-int32_t texture_count;
 
 void (*stage_onupdate)(double, double);
 void (*stage_onwin)();
@@ -99,6 +102,9 @@ int32_t transition_state;
 int32_t have_transitioned;
 int32_t debug_mode = 0;
 
+// Frame time breakdown on screen, toggled with t
+int32_t show_timers = 0;
+
 HSTREAM music;
 HSTREAM sounds[10];
 
@@ -152,46 +158,164 @@ char* dialog_lose[] = {
     0
 };
 
-// Keyboard state
-int keys[256];
+// Keyboard state, written by GLUT, read by the simulation. Presses are
+// counted so the simulation can pick them up as events. The two run on
+// different threads, so both sides only go through these.
+#ifdef _MSC_VER
+#define atomic_add(p, v) InterlockedExchangeAdd((volatile LONG*)(p), v)
+#define atomic_swap(p, v) InterlockedExchange((volatile LONG*)(p), v)
+#define load_acquire(p) InterlockedCompareExchange((volatile LONG*)(p), 0, 0)
+#else
+#define atomic_add(p, v) __sync_fetch_and_add(p, v)
+#define atomic_swap(p, v) __sync_lock_test_and_set(p, v)
+#define load_acquire(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#endif
+
+volatile int32_t keys[256];
+volatile int32_t key_presses[256];
+int32_t key_presses_seen[256];
 
-// Frame buffer, frame counter, rendering start time
+// Frame buffer being drawn (on the render thread), presented and rendered
+// frame counters, rendering start time
 uint8_t* framebuffer;
 int framecount;
+int rendercount;
 double starttime;
 double lasttime;
 double alltime;
 
-// List of models and projection matrix
-#define NUM_MODELS_MAX 20
+// Current level, list of models and projection matrix
+#define NUM_MODELS_MAX LEVEL_MAX_MODELS
+level_t level;
 model_t models[NUM_MODELS_MAX];
 int32_t num_models;
 imat4x4_t projection;
-uint8_t* textures[64];
-uint8_t* texture_floor;
 uint8_t* texture_overlay[5];
 uint8_t* texture_shot;
 uint8_t* texture_menuimages[10];
 
-// Time in seconds to nanosecond accuracy.
-// qpf every round because it can apparently change?
-#ifdef _WIN32
-double nanotime() {
-    LARGE_INTEGER li;
-    QueryPerformanceFrequency(&li);
-    double qpcFreq = (double)li.QuadPart;
-    QueryPerformanceCounter(&li);
-    double qpcVal = (double)li.QuadPart;
-    double qpcProper = qpcVal / qpcFreq;
-    return qpcProper;
-}
-#else
-double nanotime() {
-    struct timespec curtime;
-    clock_gettime(CLOCK_MONOTONIC, &curtime);
-    return((double)curtime.tv_sec + 1.0e-9 * curtime.tv_nsec);
-}
-#endif
+// The simulation runs up to this many frames ahead of rendering, on its own
+// thread. 0 runs both on the render thread, one after the other. Can be
+// changed with -latency n on the command line.
+#define PIPELINE_LATENCY 1
+
+// Framebuffers between the render thread and the GLUT thread, which presents
+// them. With three, rendering gets one frame ahead of the one shown and then
+// waits for the swap. With -mailbox it never waits, and frames that get
+// overtaken before they are shown are dropped instead.
+#define PRESENT_BUFFERS 3
+
+// Everything needed to draw one frame. Written by the simulation, read by the
+// renderer, never modified in between.
+typedef struct {
+    // Title screen instead of the game
+    int32_t menu;
+    int32_t menu_prompt;
+    int32_t menu_debug;
+
+    // 3D view
+    int32_t invalidate_order;
+    imat4x4_t camera;
+    imat4x4_t projection;
+    model_t models[NUM_MODELS_MAX];
+    int32_t num_models;
+    uint8_t* floor_texture;
+    uint8_t sky_color;
+
+    // Crosshair on an enemy, lines from charging enemies
+    int32_t hit_marker;
+    int32_t hit_x;
+    int32_t hit_y;
+    ivec3_t eye;
+    int32_t num_enemy_lines;
+    ivec3_t enemy_line_pos[ENEMY_MAX];
+    int32_t enemy_line_len[ENEMY_MAX];
+
+    // HUD: Shot flash, cockpit image and shake, wave number (0 if not shown),
+    // alert, pause screen, dialog box image and text (or 0)
+    int32_t shot;
+    int32_t cockpit;
+    int32_t shake;
+    int32_t wave;
+    int32_t target_alert;
+    int32_t paused;
+    uint8_t* dialog_image;
+    char* dialog_text;
+
+    // Transition shutter height in lines, -1 for fully lowered, 0 for none
+    int32_t shutter;
+
+    // Frame time breakdown on top of everything
+    int32_t show_timers;
+
+    // What the game is doing, for the frame pacing report (level -1 for none),
+    // and whether to print that report after this frame
+    int32_t level;
+    int32_t mode;
+    int32_t report_pacing;
+
+    // Simulation step that made this frame, for tagging timer scopes
+    int32_t number;
+
+    // Replay is over: Nothing to draw, the threads stop after this frame
+    int32_t quit;
+} frame_t;
+
+// Frames in flight between simulation and renderer (0 without a pipeline),
+// and the single frame used otherwise
+int32_t pipeline_latency = PIPELINE_LATENCY;
+frame_ring_t* frame_ring;
+frame_t serial_frame;
+
+// Finished framebuffers on their way to the screen, dropping overtaken ones
+// instead of waiting with -mailbox on the command line
+swap_chain_t* swap_chain;
+int32_t present_mailbox = 0;
+
+// Threads for the job system, 0 for one per CPU. -threads n on the command line.
+int32_t num_threads = 0;
+
+// Input of the current simulation step, from the keyboard or a replay.
+// -record file logs every steps input and the random seed, -replay file
+// plays them back instead of reading the keyboard. -headless, with -replay,
+// runs without window and sound and quits when the replay ends.
+replay_input_t step_input;
+replay_t* recording;
+replay_t* replaying;
+int32_t headless;
+
+// Frame pacing: Time between finished frames, per level and game mode,
+// against a budget (-budget ms on the command line). Reported on exit and
+// when pressing f.
+#define FRAME_BUDGET_MS (1000.0 / 60.0)
+
+#define MODE_MENU 0
+#define MODE_DIALOG 1
+#define MODE_PLAYING 2
+#define MODE_PAUSED 3
+#define MODE_TRANSITION 4
+#define NUM_MODES 5
+
+const char* mode_names[NUM_MODES] = {
+    "menu",
+    "dialog",
+    "playing",
+    "paused",
+    "transition"
+};
+
+double frame_budget = FRAME_BUDGET_MS / 1000.0;
+pacing_histogram_t pacing[NUM_LEVELS + 1][NUM_MODES];
+double last_frame_done;
+int32_t report_pacing;
+
+// Slow frame capture: With -capture ms on the command line, frames that take
+// longer than that to draw get their render inputs written to
+// slow_frame_<n>.cap, up to CAPTURE_MAX_FILES of them, for render -capture
+#define CAPTURE_MAX_FILES 16
+
+double capture_budget = 0.0;
+int32_t captures_written;
 
 // Play music
 void change_music(const char* path) {
@@ -258,19 +382,6 @@ void draw_string(char* string, int px, int py, int dialogy) {
     }
 }
 
-// Free level-relevant textures
-void free_textures() {
-    for(int i = 0; i < texture_count; i++) {
-        free(textures[i]);
-    }
-    texture_count = 0;
-
-    if(texture_floor != 0) {
-        free(texture_floor);
-        texture_floor = 0;
-    }
-}
-
 // Moeller-Trumbore ray triangle intersection, using fixed point vector math
 // https://www.scratchapixel.com/lessons/3d-basic-rendering/ray-tracing-rendering-a-triangle/moller-trumbore-ray-triangle-intersection
 int32_t ray_tri_intersect(ivec3_t orig, ivec3_t dir, ivec3_t v0, ivec3_t v1, ivec3_t v2, int32_t* t) {
@@ -300,8 +411,66 @@ int32_t ray_tri_intersect(ivec3_t orig, ivec3_t dir, ivec3_t v0, ivec3_t v1, ive
     return 1;
 }
 
+// Ray tracing runs over pieces of at least RAYTRACE_GRAIN faces as jobs.
+// Every piece keeps its closest hit and its last intersection, and pieces
+// are merged in order, so the result is the same as going through all
+// faces one by one.
+#define RAYTRACE_GRAIN 2048
+#define RAYTRACE_MAX_PIECES 128
+
+typedef struct {
+    // Ray in every models space
+    ivec3_t pos[NUM_MODELS_MAX];
+    ivec3_t dir[NUM_MODELS_MAX];
+
+    int32_t num_pieces;
+    int32_t piece_model[RAYTRACE_MAX_PIECES];
+    int32_t piece_start[RAYTRACE_MAX_PIECES];
+    int32_t piece_end[RAYTRACE_MAX_PIECES];
+
+    // Per piece: Closest t > 0 (if hit), t of the last intersection (if any)
+    int32_t hit[RAYTRACE_MAX_PIECES];
+    int32_t best_t[RAYTRACE_MAX_PIECES];
+    int32_t intersected[RAYTRACE_MAX_PIECES];
+    int32_t last_t[RAYTRACE_MAX_PIECES];
+} raytrace_job_t;
+
+void raytrace_task(void* data, int32_t first_piece, int32_t end_piece) {
+    raytrace_job_t* job = (raytrace_job_t*)data;
+    for(int piece = first_piece; piece < end_piece; piece++) {
+        int m = job->piece_model[piece];
+        ivec3_t pos = job->pos[m];
+        ivec3_t dir = job->dir[m];
+
+        int32_t t = 0;
+        int32_t best_t = INT_FIXED(2000);
+        int32_t hit = 0;
+        int32_t intersected = 0;
+        for(int i = job->piece_start[piece]; i < job->piece_end[piece]; i++) {
+            ivec3_t v0 = models[m].vertices[models[m].faces[i].v[0]];
+            ivec3_t v1 = models[m].vertices[models[m].faces[i].v[1]];
+            ivec3_t v2 = models[m].vertices[models[m].faces[i].v[2]];
+            if(ray_tri_intersect(pos, dir, v0, v1, v2, &t) != 0) {
+                intersected = 1;
+                if(t > 0) {
+                    if (t < best_t) {
+                        best_t = t;
+                    }
+                    hit = 1;
+                }
+            }
+        }
+
+        job->hit[piece] = hit;
+        job->best_t[piece] = best_t;
+        job->intersected[piece] = intersected;
+        job->last_t[piece] = t;
+    }
+}
+
 // Traces a ray against geometry
 int raytrace(ivec3_t origin_local, ivec3_t dir_local, ivec3_t* hit_pos, int32_t* hit_model, int32_t ignore_model) {
+    timer_begin("raytrace");
     int32_t t = 0;
     int32_t best_t = INT_FIXED(2000);
     int32_t hit = 0;
@@ -309,6 +478,16 @@ int raytrace(ivec3_t origin_local, ivec3_t dir_local, ivec3_t* hit_pos, int32_t*
         *hit_model = -1;
     }
     dir_local = ivec3norm(dir_local);
+
+    // Piece size so that everything fits
+    int32_t total_faces = 0;
+    for(int m = 0; m < num_models; m++) {
+        total_faces += models[m].num_faces;
+    }
+    int32_t grain = max(RAYTRACE_GRAIN, total_faces / (RAYTRACE_MAX_PIECES - NUM_MODELS_MAX) + 1);
+
+    raytrace_job_t job;
+    job.num_pieces = 0;
     for(int m = 0; m < num_models; m++) {
         if(m == ignore_model) {
             continue;
@@ -321,29 +500,37 @@ int raytrace(ivec3_t origin_local, ivec3_t dir_local, ivec3_t* hit_pos, int32_t*
             imat4x4affineinverse(models[m].modelview), 
             ivec4(origin_local.x, origin_local.y, origin_local.z, INT_FIXED(1))
         );
-        ivec3_t pos = ivec3(pos_transformed.x, pos_transformed.y, pos_transformed.z);
+        job.pos[m] = ivec3(pos_transformed.x, pos_transformed.y, pos_transformed.z);
 
         ivec4_t dir_transformed = imat4x4transform(
             imat4x4affineinverse(models[m].modelview), 
             ivec4(dir_local.x, dir_local.y, dir_local.z, INT_FIXED(0))
         );
-        ivec3_t dir = ivec3norm(ivec3(dir_transformed.x, dir_transformed.y, dir_transformed.z));
+        job.dir[m] = ivec3normfast(ivec3(dir_transformed.x, dir_transformed.y, dir_transformed.z));
 
-        for(int i = 0; i < models[m].num_faces; i++) {
-            ivec3_t v0 = models[m].vertices[models[m].faces[i].v[0]];
-            ivec3_t v1 = models[m].vertices[models[m].faces[i].v[1]];
-            ivec3_t v2 = models[m].vertices[models[m].faces[i].v[2]];
-            if(ray_tri_intersect(pos, dir, v0, v1, v2, &t) != 0) {
-                if(t > 0) {
-                    if (t < best_t) {
-                        best_t = t;
-                        if(hit_model != 0) {
-                            *hit_model = m;
-                        }
-                    }
-                    hit = 1;
+        for(int start = 0; start < models[m].num_faces; start += grain) {
+            job.piece_model[job.num_pieces] = m;
+            job.piece_start[job.num_pieces] = start;
+            job.piece_end[job.num_pieces] = min(start + grain, models[m].num_faces);
+            job.num_pieces++;
+        }
+    }
+
+    job_parallel_for(raytrace_task, &job, job.num_pieces, 1);
+
+    // Merge in face order
+    for(int piece = 0; piece < job.num_pieces; piece++) {
+        if(job.intersected[piece]) {
+            t = job.last_t[piece];
+        }
+        if(job.hit[piece]) {
+            if(job.best_t[piece] < best_t) {
+                best_t = job.best_t[piece];
+                if(hit_model != 0) {
+                    *hit_model = job.piece_model[piece];
                 }
             }
+            hit = 1;
         }
     }
 
@@ -355,6 +542,7 @@ int raytrace(ivec3_t origin_local, ivec3_t dir_local, ivec3_t* hit_pos, int32_t*
         );
     }
 
+    timer_end();
     return hit;
 }
 
@@ -431,26 +619,6 @@ void enemy_line(ivec3_t enemy, ivec3_t pos, imat4x4_t mvp, int32_t len, uint8_t*
     }
 }
 
-// Texture loader
-uint8_t* load_texture(const char* path) {
-    int32_t r;
-    int32_t g;
-    int32_t b;
-
-    bmp_info* bmp_file = bmp_open_read(path);
-    uint8_t* texture = (uint8_t*)malloc(bmp_file->x_size * bmp_file->y_size * sizeof(uint8_t));
-
-    for(int y = 0; y < bmp_file->y_size; y++) {
-        for(int x = 0; x < bmp_file->x_size; x++) {
-            bmp_read_pixel(bmp_file, &r, &g, &b);
-            texture[y * bmp_file->x_size + x] = RGB332(r, g, b);
-        }
-    }
-    bmp_close(bmp_file);
-
-    return texture;
-}
-
 // Draws an overlay on the screen
 void blit_to_screen(uint8_t* blit_texture) {
     for(int y = 0; y < SCREEN_HEIGHT; y++) {
@@ -499,6 +667,7 @@ void start_game() {
     xpos = 10;
     ypos = 10;
     zpos = 10;
+    invalidate_draw_order();
 
     anglex = 0;
     angley = 0;
@@ -518,15 +687,22 @@ void core_onwin() {
 
 // Core model updater
 void core_onupdate(double elapsed, double alltime) {
-    for(int i = 0; i < 3; i++) {
-        models[i].modelview = imat4x4mul(
-            imat4x4rotatey(FLOAT_FIXED(alltime * 0.02) + FLOAT_FIXED(i / 3.0))
-            , imat4x4mul(
-                imat4x4translate(ivec3(INT_FIXED(135), INT_FIXED(0), INT_FIXED(0))),
-                imat4x4rotatey(FLOAT_FIXED(alltime * 0.1))
-                )
-            );
+    level_animate(LEVEL_CORE, models, alltime);
+}
+
+// Load a levels models and textures, with a model for every enemy
+void load_level(int32_t id) {
+    level_free(&level);
+    level_load(&level, id, ENEMY_MAX);
+
+    memcpy(models, level.models, sizeof(model_t) * level.num_models);
+    num_models = level.num_models;
+    for(int i = 0; i < ENEMY_MAX; i++) {
+        enemies[i].model = level.num_static_models + i;
     }
+
+    // Set up storage required
+    prepare_geometry_storage(models, num_models);
 }
 
 // Load the "core" level
@@ -540,72 +716,20 @@ void load_level_core() {
         stage_enemies_max = 2;
     }
 
-    // Set all models to no draw
-    for(int i = 0; i < num_models; i++) {
-        models[i].draw = 0;
-    }
-
-    // Create model
-    for(int i = 0; i < 3; i++) {
-        models[i] = get_model_core();
-        models[i].draw = 1;
-    }
-
-    for(int i = 0; i < ENEMY_MAX; i++) {
-        models[3  + i] = get_model_enemy();
-        models[3 + i].draw = 1;
-        enemies[i].model = i + 3;
-    }
-    num_models = 4 + ENEMY_MAX;
-
-    textures[0] = load_texture("data/core.bmp");
-    textures[1] = load_texture("data/core.bmp");
-    textures[2] = load_texture("data/core.bmp");
-    textures[3] = load_texture("data/core.bmp");
-    textures[4] = load_texture("data/core.bmp");
-    textures[5] = load_texture("data/core.bmp");
-    textures[6] = load_texture("data/core.bmp");
-    textures[7] = load_texture("data/core.bmp");
-    textures[8] = load_texture("data/core.bmp");
-
-    for(int i = 0; i < ENEMY_MAX; i++) {
-        textures[9 + i] = load_texture("data/enemy.bmp");
-    }
-
-    texture_floor = load_texture("data/floor2.bmp");
-
-    int tex_offset = 0;
-    for(int m = 0; m < num_models; m++) {
-        int tex_max = 0;
-        for(int i = 0; i < models[m].num_faces; i++) {
-            tex_max = max(models[m].faces[i].v[7], tex_max);
-            models[m].faces[i].texture = textures[models[m].faces[i].v[7] + tex_offset];
-        }
-        // printf("%d -> %d\n", m, tex_offset);
-        tex_offset += tex_max + 1;
-        tex_max = 0;
-    }
+    // Models and textures
+    load_level(LEVEL_CORE);
 
     // Update / win functions
     stage_onupdate = core_onupdate;
     stage_onwin = core_onwin;
 
-    // Set up storage required
-    prepare_geometry_storage(models, num_models);
-
-    // Sky
-    sky_color = RGB332(197, 46, 106);
-
     // Begin
     start_game();
 }
 
 // Ringworld stage updater
 void ringworld_onupdate(double elapsed, double alltime) {
-    models[0].modelview = imat4x4mul(
-        imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(95), INT_FIXED(0))),
-        imat4x4rotatey(FLOAT_FIXED(alltime * 0.01))
-    );
+    level_animate(LEVEL_RINGWORLD, models, alltime);
 }
 
 // Ring world "on win" function
@@ -619,62 +743,19 @@ void load_level_ringworld() {
     // Change music
     change_music("data/rings.ogg");
 
-    // Reset textures
-    free_textures();
-
     // Maximum enemies for this stage
     stage_enemies_max = 8;
     if(debug_mode) {
         stage_enemies_max = 2;
     }
 
-    // Set all models to no draw
-    for(int i = 0; i < num_models; i++) {
-        models[i].draw = 0;
-    }
-
-    // Create model
-    models[0] = get_model_ringworld();
-    models[0].modelview = imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(95), INT_FIXED(0)));
-    models[0].draw = 1;
-
-    for(int i = 0; i < ENEMY_MAX; i++) {
-        models[1  + i] = get_model_enemy();
-        models[1 + i].draw = 1;
-        enemies[i].model = i + 1;
-    }
-    num_models = 1 + ENEMY_MAX;
-
-    textures[0] = load_texture("data/ringworld.bmp");
-
-    for(int i = 0; i < ENEMY_MAX; i++) {
-        textures[1 + i] = load_texture("data/enemy.bmp");
-    }
-
-    texture_floor = load_texture("data/floor.bmp");
-
-    int tex_offset = 0;
-    for(int m = 0; m < num_models; m++) {
-        int tex_max = 0;
-        for(int i = 0; i < models[m].num_faces; i++) {
-            tex_max = max(models[m].faces[i].v[7], tex_max);
-            models[m].faces[i].texture = textures[models[m].faces[i].v[7] + tex_offset];
-        }
-        // printf("%d -> %d\n", m, tex_offset);
-        tex_offset += tex_max + 1;
-        tex_max = 0;
-    }
+    // Models and textures
+    load_level(LEVEL_RINGWORLD);
 
     // Update / win functions
     stage_onupdate = ringworld_onupdate;
     stage_onwin = ringworld_onwin;
 
-    // Set up storage required
-    prepare_geometry_storage(models, num_models);
-
-    // Sky
-    sky_color = RGB332(0, 0, 0);
-
     start_game();
 }
 
@@ -695,84 +776,18 @@ void load_level_city() {
         stage_enemies_max = 2;
     }
 
-    // Set all models to no draw
-    for(int i = 0; i < num_models; i++) {
-        models[i].draw = 0;
-    }
-
-    // Create model
-    models[0] = get_model_tower();
-    models[0].draw = 1;
-
-    models[1] = get_model_cityscape3();
-    models[1].modelview = imat4x4translate(ivec3(INT_FIXED(0), INT_FIXED(0), INT_FIXED(160)));
-    models[1].draw = 1;
-
-    models[2] = get_model_cityscape3();
-    models[2].modelview = imat4x4translate(ivec3(INT_FIXED(138), INT_FIXED(0), INT_FIXED(-80)));
-    models[2].draw = 1;
-
-    models[3] = get_model_cityscape3();
-    models[3].modelview = imat4x4translate(ivec3(INT_FIXED(-138), INT_FIXED(0), INT_FIXED(-80)));
-    models[3].draw = 1;
-
-    for(int i = 0; i < ENEMY_MAX; i++) {
-        models[4  + i] = get_model_enemy();
-        models[4 + i].draw = 1;
-        enemies[i].model = i + 4;
-    }
-    num_models = 4 + ENEMY_MAX;
-
-    textures[0] = load_texture("data/tower.bmp");
-
-    textures[1] = load_texture("data/windows.bmp");
-    textures[2] = load_texture("data/roof_sharp.bmp");
-    textures[3] = load_texture("data/roof_flat.bmp");
-    textures[4] = load_texture("data/windows.bmp");
-
-    textures[5] = load_texture("data/windows.bmp");
-    textures[6] = load_texture("data/roof_sharp.bmp");
-    textures[7] = load_texture("data/roof_flat.bmp");
-    textures[8] = load_texture("data/windows.bmp");
-
-    textures[9] = load_texture("data/windows.bmp");
-    textures[10] = load_texture("data/roof_sharp.bmp");
-    textures[11] = load_texture("data/roof_flat.bmp");
-    textures[12] = load_texture("data/windows.bmp");
-
-    for(int i = 0; i < ENEMY_MAX; i++) {
-        textures[13 + i] = load_texture("data/enemy.bmp");
-    }
-
-    texture_floor = load_texture("data/floor.bmp");
-
-    int tex_offset = 0;
-    for(int m = 0; m < num_models; m++) {
-        int tex_max = 0;
-        for(int i = 0; i < models[m].num_faces; i++) {
-            tex_max = max(models[m].faces[i].v[7], tex_max);
-            models[m].faces[i].texture = textures[models[m].faces[i].v[7] + tex_offset];
-        }
-        // printf("%d -> %d\n", m, tex_offset);
-        tex_offset += tex_max + 1;
-        tex_max = 0;
-    }
+    // Models and textures
+    load_level(LEVEL_CITY);
 
     // Update / win functions
     stage_onupdate = 0;
     stage_onwin = city_onwin;
 
-    // Set up storage required
-    prepare_geometry_storage(models, num_models);
-
-    // Sky
-    sky_color = RGB332(36, 0, 85);
-
     start_game();
 }
 
-// Update function: In game only
-void run_game(double elapsed) {
+// Update function: In game only. Records what to draw into frame.
+void run_game(double elapsed, frame_t* frame) {
     // Timing
     if(paused == 1 || dialog_mode == 1) {
         elapsed = 0;
@@ -785,6 +800,7 @@ void run_game(double elapsed) {
     }
 
     // Enemies
+    timer_begin("enemies");
     for(int i = 0; i < ENEMY_MAX; i++) {
         // Is it alive?
         if(enemies[i].active == 0) {
@@ -869,6 +885,7 @@ void run_game(double elapsed) {
             imat4x4scale(enemies[i].scale)
             );
     }
+    timer_end();
 
     // Player shot charge
     if(player_charge <= FLOAT_FIXED(0.1)) {
@@ -876,11 +893,12 @@ void run_game(double elapsed) {
     }
 
     // Input handling
+    timer_begin("input");
     double inpscale = elapsed * 100.0;
-    if(keys['s']) {
+    if(replay_key_held(&step_input, 's')) {
         ypower += inpscale * 0.02 / 100.0;
     } 
-    else if(keys['w']) {
+    else if(replay_key_held(&step_input, 'w')) {
         ypower -= inpscale * 0.02 / 100.0;
     }
     else {
@@ -903,10 +921,10 @@ void run_game(double elapsed) {
         }
     }
 
-    if(keys['a']) {
+    if(replay_key_held(&step_input, 'a')) {
         xpower += inpscale * 0.02 / 150.0;
     } 
-    else if(keys['d']) {
+    else if(replay_key_held(&step_input, 'd')) {
         xpower -= inpscale * 0.02 / 150.0;
     }
     else {
@@ -935,7 +953,7 @@ void run_game(double elapsed) {
         ypower = 0.0;
     }
 
-    if(keys[' ']) {
+    if(replay_key_held(&step_input, ' ')) {
         speed += 0.03 * inpscale;
     }
     else {
@@ -946,7 +964,7 @@ void run_game(double elapsed) {
 
     // Shooting?
     int32_t player_shot = 0;
-    if(keys['m'] && player_charge >= FLOAT_FIXED(0.1)) {
+    if(replay_key_held(&step_input, 'm') && player_charge >= FLOAT_FIXED(0.1)) {
         player_charge = 0;
         player_shot = 1;
         BASS_ChannelPlay(sounds[0], 1);
@@ -967,10 +985,17 @@ void run_game(double elapsed) {
 
     imat4x4_t camera = imat4x4lookat(eye, lookat, up);
 
-    // Draw models to screen buffer
-    rasterize(framebuffer, models, num_models, camera, projection, texture_floor, sky_color);
+    // Models to draw, as they are now
+    frame->camera = camera;
+    frame->projection = projection;
+    memcpy(frame->models, models, sizeof(model_t) * num_models);
+    frame->num_models = num_models;
+    frame->floor_texture = level.floor_texture;
+    frame->sky_color = level.sky_color;
+    timer_end();
 
     // Collide ship TODO this is bad
+    timer_begin("collide");
     int32_t best_dot = INT_FIXED(2000);
     for(int m = 0; m < num_models; m++) {
         if(models[m].draw == 0) {
@@ -1000,6 +1025,7 @@ void run_game(double elapsed) {
         xpos = 50;
         ypos = 50;
         zpos = 50;
+        frame->invalidate_order = 1;
 
         anglex = 0;
         angley = 0;
@@ -1017,17 +1043,14 @@ void run_game(double elapsed) {
             enemies[i].charging = 0;
         }
     }
+    timer_end();
 
     // Trace shots
+    timer_begin("shots");
     ivec3_t hit_pos;
     int32_t hit_model;
     int hit = raytrace(ivec3(FLOAT_FIXED(xpos), FLOAT_FIXED(ypos), FLOAT_FIXED(zpos)), ivec3sub(lookat, eye), &hit_pos, &hit_model, -1);
     if(hit == 1) {
-        imat4x4_t mvp = imat4x4mul(projection, camera);
-        ivec4_t hit_pos_tranformed = imat4x4transform(mvp, ivec4(hit_pos.x, hit_pos.y, hit_pos.z, INT_FIXED(1)));
-        int32_t px = FIXED_INT_ROUND(VIEWPORT(hit_pos_tranformed.x, hit_pos_tranformed.w, SCREEN_WIDTH));
-        int32_t py = FIXED_INT_ROUND(VIEWPORT(hit_pos_tranformed.y, hit_pos_tranformed.w, SCREEN_HEIGHT));
-
         int32_t hit_enemy = -1;
         for(int i = 0; i < enemy_count; i++) {
             if(hit_model == enemies[i].model) {
@@ -1036,7 +1059,11 @@ void run_game(double elapsed) {
         }
 
         if(hit_enemy != -1) {
-            framebuffer[px + SCREEN_WIDTH * py] = 0xF0;
+            imat4x4_t mvp = imat4x4mul(projection, camera);
+            ivec4_t hit_pos_tranformed = imat4x4transform(mvp, ivec4(hit_pos.x, hit_pos.y, hit_pos.z, INT_FIXED(1)));
+            frame->hit_marker = 1;
+            frame->hit_x = FIXED_INT_ROUND(VIEWPORT(hit_pos_tranformed.x, hit_pos_tranformed.w, SCREEN_WIDTH));
+            frame->hit_y = FIXED_INT_ROUND(VIEWPORT(hit_pos_tranformed.y, hit_pos_tranformed.w, SCREEN_HEIGHT));
 
             // Shooting?
             if(player_shot && enemies[hit_enemy].active == 1) {
@@ -1046,21 +1073,22 @@ void run_game(double elapsed) {
             }
         }
     }
+    timer_end();
 
     // Enemy lines
     int32_t enemy_lock = 0;
+    frame->eye = eye;
     for(int i = 0; i < enemy_count; i++) {
         if(enemies[i].charging && enemies[i].active) {
-            imat4x4_t mvp = imat4x4mul(projection, camera);
-            enemy_line(enemies[i].pos, eye, mvp, enemies[i].charge, framebuffer, RGB332(36, 219, 85));
+            frame->enemy_line_pos[frame->num_enemy_lines] = enemies[i].pos;
+            frame->enemy_line_len[frame->num_enemy_lines] = enemies[i].charge;
+            frame->num_enemy_lines++;
             enemy_lock = 1;
         }
     }
 
     // Shot draw
-    if(player_charge < FLOAT_FIXED(0.02)) {
-        blit_to_screen(texture_shot);
-    }
+    frame->shot = player_charge < FLOAT_FIXED(0.02);
 
     // Overlay
     int32_t ssinc = 0;
@@ -1073,31 +1101,17 @@ void run_game(double elapsed) {
 
     int cockpit_img = player_health - 1;
     cockpit_img = cockpit_img < 0 ? 0 : cockpit_img;
-    for(int y = 0; y < SCREEN_HEIGHT; y++) {
-        for(int x = 0; x < SCREEN_WIDTH; x++) {
-            int px = x + ssinc;
-            px = px < 0 ? 0 : px;
-            px = px >= SCREEN_WIDTH ? SCREEN_WIDTH - 1 : px;
-
-            uint8_t pixel = texture_overlay[cockpit_img][px + y * SCREEN_WIDTH];
-            if(pixel != RGB332(0, 255, 0)) {
-                framebuffer[x + y * SCREEN_WIDTH] = pixel;
-            }
-        }
-    }
+    frame->cockpit = cockpit_img;
+    frame->shake = ssinc;
 
     // Display "wave n" text
     if(wave_show > 0 && !enemy_lock) {
-        char wavetext[255];
-        sprintf(wavetext, "_Wave %d_", wave_nb);
-        draw_string(wavetext, 90 - ssinc, 183, 0);
+        frame->wave = wave_nb;
         wave_show -= FLOAT_FIXED(elapsed);        
     }
 
     // Display Lock Alert
-    if(enemy_lock) {
-        draw_string("_TARGET ALERT_", 90 - ssinc, 183, 0);
-    }
+    frame->target_alert = enemy_lock;
 
     // Unshake
     if(player_shake > 0) {
@@ -1108,9 +1122,7 @@ void run_game(double elapsed) {
     }
 
     // "Paused"
-    if(paused == 1) {
-        blit_to_screen(texture_menuimages[0]);
-    }
+    frame->paused = paused == 1;
 
     // Dialog mode
     if(dialog_mode == 1) {
@@ -1123,17 +1135,17 @@ void run_game(double elapsed) {
                 return;
             }
             else if(active_dialog[dialog_pos][0] == '/') {
-                blit_to_screen(texture_menuimages[2]);
+                frame->dialog_image = texture_menuimages[2];
                 if(from_menu == 1) {
                     dialog_pos++;
                     from_menu = 0;
                 }
             }
             else if(active_dialog[dialog_pos][0] == '-') {
-                blit_to_screen(texture_menuimages[4]);
+                frame->dialog_image = texture_menuimages[4];
             }
             else if(active_dialog[dialog_pos][0] == '+') {
-                blit_to_screen(texture_menuimages[3]);
+                frame->dialog_image = texture_menuimages[3];
             }
             else if(active_dialog[dialog_pos][0] == '~' && transition_state == 0) {
                 transition_state = FLOAT_FIXED(3.0);
@@ -1141,8 +1153,8 @@ void run_game(double elapsed) {
                 dialog_pos--;
             }
             else {
-                blit_to_screen(texture_menuimages[1]);
-                draw_string(active_dialog[dialog_pos], 27, 157, 1);
+                frame->dialog_image = texture_menuimages[1];
+                frame->dialog_text = active_dialog[dialog_pos];
             }
         }
         else {
@@ -1166,12 +1178,118 @@ void run_game(double elapsed) {
     }
 }
 
-// Update function
-void main_loop(void) {
-    // Timing
-    double thistime = nanotime();
-    double elapsed = thistime - lasttime;
-    lasttime = thistime;
+// Game input: key pressed. Runs on the simulation side.
+void key_pressed(unsigned char key) {
+    switch(key) {
+    case 27:
+        if(!dialog_mode && !menu_mode) {
+            if(paused == 1) {
+                paused = 0;
+            }
+            else {
+                paused = 1;
+            }
+        }
+    break;        
+    case ' ':
+        if(!transition_state) {
+            if(dialog_mode) {
+                dialog_pos++;
+            }
+
+            if(menu_mode) {
+                stage_dialogfun = load_level_city;
+                start_dialog(dialog_gamestart);
+                menu_mode = 0;
+                from_menu = 1;
+            }
+        }
+    break;
+    case 't':
+        show_timers = !show_timers;
+    break;
+    case 'f':
+        report_pacing = 1;
+    break;
+    case 'p':
+        if(menu_mode) {
+            if(debug_mode == 1) {
+                debug_mode = 0;
+            }
+            else {
+                debug_mode = 1;
+            }
+        }
+    break;
+    default:
+        break;
+    }
+}
+
+// Wait until the renderer is done with every frame handed to it, so level
+// data can be swapped out
+void flush_pipeline() {
+    if(frame_ring != 0) {
+        frame_ring_drain(frame_ring);
+    }
+}
+
+// End of a replay, once the last frame was presented and the simulation and
+// render threads have stopped: Say how long it took and where the game ended
+// up, for comparing runs, and quit
+void finish_replay() {
+    double seconds = nanotime() - starttime;
+    printf(
+        "Replay done: %d steps, %d frames rendered in %.3f s, %.3f ms per frame\n",
+        replay_steps(replaying), rendercount, seconds, rendercount ? seconds * 1000.0 / rendercount : 0.0
+    );
+    printf(
+        "Final state: position %f %f %f, health %d, wave %d, %d enemies alive\n",
+        xpos, ypos, zpos, player_health, wave_nb, enemies_alive
+    );
+    exit(0);
+}
+
+// Input for the next step: Keys held right now and presses since the last
+// step, or the next step of the replay. Returns 0 when the replay is over.
+int32_t read_input(double elapsed) {
+    if(replaying != 0) {
+        return replay_read(replaying, &step_input);
+    }
+
+    step_input.elapsed = elapsed;
+    step_input.num_presses = 0;
+    for(int key = 0; key < 256; key++) {
+        replay_set_key_held(&step_input, key, load_acquire(&keys[key]));
+        int32_t presses = load_acquire(&key_presses[key]);
+        while(key_presses_seen[key] != presses && step_input.num_presses < REPLAY_MAX_PRESSES) {
+            key_presses_seen[key]++;
+            step_input.presses[step_input.num_presses++] = key;
+        }
+    }
+
+    if(recording != 0) {
+        replay_write(recording, &step_input);
+    }
+    return 1;
+}
+
+// Simulation step: Advance the game by elapsed seconds and record the frame
+void simulate(double elapsed, frame_t* frame) {
+    static int32_t steps = 0;
+    memset(frame, 0, sizeof(frame_t));
+    frame->number = ++steps;
+    timer_set_frame(frame->number);
+
+    // Input events since last step
+    if(!read_input(elapsed)) {
+        frame->quit = 1;
+        return;
+    }
+    elapsed = step_input.elapsed;
+    for(int i = 0; i < step_input.num_presses; i++) {
+        key_pressed(step_input.presses[i]);
+    }
 
     // Restart music
     if(!BASS_ChannelIsActive(music)) {
@@ -1180,23 +1298,20 @@ void main_loop(void) {
 
     // Draw
     if(!menu_mode) {
-        run_game(elapsed);
+        timer_begin("game");
+        run_game(elapsed, frame);
+        timer_end();
     }
     else {
         menu_blink -= FLOAT_FIXED(1.0 * elapsed);
         if(menu_blink < FLOAT_FIXED(-1.0)) {
             menu_blink = FLOAT_FIXED(1.0);
         }
-        blit_to_screen(texture_menuimages[2]);
-        if(debug_mode == 1) {
-            draw_string("_easy mode_", 10, 30, 0);
-        }
-
-        if(menu_blink > FLOAT_FIXED(-0.5)) {
-            draw_string("space to start >", 10, 10, 0);
-            draw_string("p to toggle difficulty", 10, 20, 0);
-        }
+        frame->menu = 1;
+        frame->menu_debug = debug_mode == 1;
+        frame->menu_prompt = menu_blink > FLOAT_FIXED(-0.5);
     }
+    frame->show_timers = show_timers;
 
     // Transition shutter
     if(transition_state > 0) {
@@ -1209,7 +1324,6 @@ void main_loop(void) {
         } 
         else if(transition_state >= FLOAT_FIXED(1.0)) {
             // Lowered
-            blit_to_screen(texture_menuimages[5]);
             height = -1;
 
             if(have_transitioned == 0) {
@@ -1217,6 +1331,7 @@ void main_loop(void) {
                 have_transitioned = 1;
 
                 if(stage_dialogfun != 0) {
+                    flush_pipeline();
                     stage_dialogfun();
                 }
             }
@@ -1225,32 +1340,386 @@ void main_loop(void) {
             // Up
             height = FIXED_INT(imul(transition_state, INT_FIXED(SCREEN_HEIGHT)));
         }
+        frame->shutter = height;
+    }
+    else {
+        transition_state = 0;
+    }
+
+    // Tag the frame
+    frame->level = menu_mode || level.num_models == 0 ? -1 : level.id;
+    if(menu_mode) {
+        frame->mode = MODE_MENU;
+    }
+    else if(transition_state > 0) {
+        frame->mode = MODE_TRANSITION;
+    }
+    else if(dialog_mode) {
+        frame->mode = MODE_DIALOG;
+    }
+    else if(paused) {
+        frame->mode = MODE_PAUSED;
+    }
+    else {
+        frame->mode = MODE_PLAYING;
+    }
+    frame->report_pacing = report_pacing;
+    report_pacing = 0;
+}
+
+// Frame pacing for every level and mode there were frames in, then overall
+void print_pacing_report() {
+    pacing_histogram_t all;
+    pacing_reset(&all);
+
+    pacing_print_header(stdout, frame_budget);
+    for(int32_t level_id = -1; level_id < NUM_LEVELS; level_id++) {
+        for(int32_t mode = 0; mode < NUM_MODES; mode++) {
+            char tag[64];
+            snprintf(tag, sizeof(tag), "%s %s", level_id < 0 ? "-" : level_name(level_id), mode_names[mode]);
+            pacing_print(stdout, tag, &pacing[level_id + 1][mode]);
+            pacing_merge(&all, &pacing[level_id + 1][mode]);
+        }
+    }
+    pacing_print(stdout, "all", &all);
+}
+
+// Stages in the frame time graph, bottom to top: The renderers, then the
+// simulations. The simulation runs in parallel when pipelined, so the stack
+// is CPU time, not latency.
+#define TIMER_STAGES 7
+#define TIMER_GRAPH_FRAMES 64
+#define TIMER_GRAPH_HEIGHT 60
+#define TIMER_GRAPH_MS 10
+
+const char* timer_stage_names[TIMER_STAGES] = {
+    "transform",
+    "sort",
+    "floor",
+    "border",
+    "raster",
+    "hud",
+    "game"
+};
+
+uint8_t timer_stage_colors[TIMER_STAGES] = {
+    RGB332(255, 0, 0),
+    RGB332(255, 146, 0),
+    RGB332(255, 255, 0),
+    RGB332(0, 255, 0),
+    RGB332(0, 255, 255),
+    RGB332(73, 73, 255),
+    RGB332(255, 0, 255)
+};
+
+double timer_history[TIMER_GRAPH_FRAMES][TIMER_STAGES];
+int32_t timer_history_pos;
+
+// Solid rectangle, y counted from the top like draw_string
+void fill_rect(int px, int py, int w, int h, uint8_t color) {
+    for(int y = py; y < py + h; y++) {
+        for(int x = px; x < px + w; x++) {
+            framebuffer[x + (SCREEN_HEIGHT - 1 - y) * SCREEN_WIDTH] = color;
+        }
+    }
+}
 
-        if(height != -1) {
-            for(int y = SCREEN_HEIGHT - 1; y > SCREEN_HEIGHT - height; y--) {
-                for(int x = 0; x < SCREEN_WIDTH; x++) {
-                    uint8_t pixel = texture_menuimages[5][x + y * SCREEN_WIDTH];
-                    if(pixel != RGB332(0, 255, 0)) {
-                        framebuffer[x + y * SCREEN_WIDTH] = pixel;
-                    }
+// Last frames stage times as a stacked bar graph (one bar per frame, newest
+// right, TIMER_GRAPH_MS full height) with the numbers for this one
+void draw_timers() {
+    double* times = timer_history[timer_history_pos];
+    timer_history_pos = (timer_history_pos + 1) % TIMER_GRAPH_FRAMES;
+    timer_last_many(timer_stage_names, TIMER_STAGES, times);
+    for(int s = 0; s < TIMER_STAGES; s++) {
+        times[s] *= 1000.0;
+    }
+
+    int graph_x = SCREEN_WIDTH - 2 * TIMER_GRAPH_FRAMES - 4;
+    int graph_y = 4;
+    fill_rect(graph_x - 1, graph_y - 1, 2 * TIMER_GRAPH_FRAMES + 2, TIMER_GRAPH_HEIGHT + 2, RGB332(0, 0, 0));
+    for(int f = 0; f < TIMER_GRAPH_FRAMES; f++) {
+        double* bar = timer_history[(timer_history_pos + f) % TIMER_GRAPH_FRAMES];
+        int bottom = TIMER_GRAPH_HEIGHT;
+        for(int s = 0; s < TIMER_STAGES && bottom > 0; s++) {
+            int height = (int)(bar[s] * TIMER_GRAPH_HEIGHT / TIMER_GRAPH_MS + 0.5);
+            height = min(height, bottom);
+            fill_rect(graph_x + 2 * f, graph_y + bottom - height, 2, height, timer_stage_colors[s]);
+            bottom -= height;
+        }
+    }
+
+    char line[64];
+    double total = 0.0;
+    fill_rect(3, 3, 8 * 15 + 2, 9 * (TIMER_STAGES + 1) + 1, RGB332(0, 0, 0));
+    for(int s = 0; s < TIMER_STAGES; s++) {
+        fill_rect(4, 4 + 9 * s, 6, 7, timer_stage_colors[s]);
+        sprintf(line, "%-9s%5.2f", timer_stage_names[s], times[s]);
+        draw_string(line, 12, 4 + 9 * s, 0);
+        total += times[s];
+    }
+    sprintf(line, "%-9s%5.2f", "total ms", total);
+    draw_string(line, 12, 4 + 9 * TIMER_STAGES, 0);
+}
+
+// Draw a recorded frame to the framebuffer
+void render_frame(frame_t* frame) {
+    if(frame->menu) {
+        blit_to_screen(texture_menuimages[2]);
+        if(frame->menu_debug) {
+            draw_string("_easy mode_", 10, 30, 0);
+        }
+
+        if(frame->menu_prompt) {
+            draw_string("space to start >", 10, 10, 0);
+            draw_string("p to toggle difficulty", 10, 20, 0);
+        }
+    }
+    else {
+        // Draw models to screen buffer
+        if(frame->invalidate_order) {
+            invalidate_draw_order();
+        }
+        rasterize(framebuffer, frame->models, frame->num_models, frame->camera, frame->projection, frame->floor_texture, frame->sky_color);
+
+        // Enemy under the crosshair
+        timer_begin("hud");
+        if(frame->hit_marker) {
+            framebuffer[frame->hit_x + SCREEN_WIDTH * frame->hit_y] = 0xF0;
+        }
+
+        // Enemy lines
+        imat4x4_t mvp = imat4x4mul(frame->projection, frame->camera);
+        for(int i = 0; i < frame->num_enemy_lines; i++) {
+            enemy_line(frame->enemy_line_pos[i], frame->eye, mvp, frame->enemy_line_len[i], framebuffer, RGB332(36, 219, 85));
+        }
+
+        // Shot draw
+        if(frame->shot) {
+            blit_to_screen(texture_shot);
+        }
+
+        // Overlay
+        for(int y = 0; y < SCREEN_HEIGHT; y++) {
+            for(int x = 0; x < SCREEN_WIDTH; x++) {
+                int px = x + frame->shake;
+                px = px < 0 ? 0 : px;
+                px = px >= SCREEN_WIDTH ? SCREEN_WIDTH - 1 : px;
+
+                uint8_t pixel = texture_overlay[frame->cockpit][px + y * SCREEN_WIDTH];
+                if(pixel != RGB332(0, 255, 0)) {
+                    framebuffer[x + y * SCREEN_WIDTH] = pixel;
                 }
             }
         }
+
+        // Display "wave n" text
+        if(frame->wave != 0) {
+            char wavetext[255];
+            sprintf(wavetext, "_Wave %d_", frame->wave);
+            draw_string(wavetext, 90 - frame->shake, 183, 0);
+        }
+
+        // Display Lock Alert
+        if(frame->target_alert) {
+            draw_string("_TARGET ALERT_", 90 - frame->shake, 183, 0);
+        }
+
+        // "Paused"
+        if(frame->paused) {
+            blit_to_screen(texture_menuimages[0]);
+        }
+
+        // Dialog mode
+        if(frame->dialog_image != 0) {
+            blit_to_screen(frame->dialog_image);
+        }
+        if(frame->dialog_text != 0) {
+            draw_string(frame->dialog_text, 27, 157, 1);
+        }
+        timer_end();
+    }
+
+    // Transition shutter
+    if(frame->shutter == -1) {
+        blit_to_screen(texture_menuimages[5]);
     }
     else {
-        transition_state = 0;
+        for(int y = SCREEN_HEIGHT - 1; y > SCREEN_HEIGHT - frame->shutter; y--) {
+            for(int x = 0; x < SCREEN_WIDTH; x++) {
+                uint8_t pixel = texture_menuimages[5][x + y * SCREEN_WIDTH];
+                if(pixel != RGB332(0, 255, 0)) {
+                    framebuffer[x + y * SCREEN_WIDTH] = pixel;
+                }
+            }
+        }
+    }
+
+    if(frame->show_timers) {
+        draw_timers();
+    }
+}
+
+// Write out the render inputs of a frame that went over the capture budget
+void capture_slow_frame(frame_t* frame, double render_time) {
+    static frame_capture_t capture;
+    if(captures_written >= CAPTURE_MAX_FILES) {
+        return;
+    }
+
+    char path[64];
+    snprintf(path, sizeof(path), "slow_frame_%03d.cap", captures_written++);
+    capture_frame(
+        &capture, frame->level, ENEMY_MAX, render_time, frame->models, frame->num_models,
+        frame->camera, frame->projection, frame->floor_texture, frame->sky_color
+    );
+    if(capture_write(path, &capture)) {
+        printf("Slow frame (%.2f ms) captured to %s\n", render_time * 1000.0, path);
+    }
+}
+
+// Simulation thread: Produce frames as fast as the renderer takes them,
+// until a replay ends
+void simulation_thread(void* unused) {
+    timer_name_thread("simulation");
+    while(1) {
+        frame_t* frame = (frame_t*)frame_ring_begin_write(frame_ring);
+
+        // Timing
+        double thistime = nanotime();
+        double elapsed = thistime - lasttime;
+        lasttime = thistime;
+
+        simulate(elapsed, frame);
+        int32_t quit = frame->quit;
+        frame_ring_end_write(frame_ring);
+        if(quit) {
+            return;
+        }
+    }
+}
+
+// Render thread: Draw frames as they come in, simulating them first if there
+// is no simulation thread, and hand them to the GLUT thread. Stops at the
+// end of a replay.
+void render_thread(void* unused) {
+    timer_name_thread("render");
+    while(1) {
+        frame_t* frame;
+        if(frame_ring != 0) {
+            frame = (frame_t*)frame_ring_begin_read(frame_ring);
+        }
+        else {
+            // Timing
+            double thistime = nanotime();
+            double elapsed = thistime - lasttime;
+            lasttime = thistime;
+
+            frame = &serial_frame;
+            simulate(elapsed, frame);
+        }
+
+        // Everything before this frame is drawn and submitted, let the
+        // presenting thread run out
+        if(frame->quit) {
+            if(frame_ring != 0) {
+                frame_ring_end_read(frame_ring);
+            }
+            swap_chain_close(swap_chain);
+            return;
+        }
+
+        framebuffer = (uint8_t*)swap_chain_begin_draw(swap_chain);
+        timer_set_frame(frame->number);
+        timer_begin("render");
+        render_frame(frame);
+        double render_time = timer_end();
+        swap_chain_submit(swap_chain);
+        if(capture_budget > 0.0 && render_time > capture_budget && !frame->menu && frame->level >= 0) {
+            capture_slow_frame(frame, render_time);
+        }
+
+        // Time since the last frame was done, simulation stalls included
+        double frame_done = nanotime();
+        if(last_frame_done != 0.0) {
+            pacing_add(&pacing[frame->level + 1][frame->mode], frame_done - last_frame_done, frame_budget);
+        }
+        last_frame_done = frame_done;
+        if(frame->report_pacing) {
+            print_pacing_report();
+        }
+        if(frame_ring != 0) {
+            frame_ring_end_read(frame_ring);
+        }
+
+        // Print sort stats
+        rendercount++;
+        if(rendercount % 1000 == 0) {
+            sort_stats_t sort_stats;
+            get_sort_stats(&sort_stats);
+            reset_sort_stats();
+            printf(
+                "Sort: %d full (%.3f ms avg), %d incremental (%.3f ms avg)\n",
+                sort_stats.full_sorts, 
+                sort_stats.full_sorts ? 1000.0 * sort_stats.full_time / sort_stats.full_sorts : 0.0,
+                sort_stats.incremental_sorts, 
+                sort_stats.incremental_sorts ? 1000.0 * sort_stats.incremental_time / sort_stats.incremental_sorts : 0.0
+            );
+
+            int32_t frames = imax(sort_stats.full_sorts + sort_stats.incremental_sorts, 1);
+            printf(
+                "Faces per frame: %d total, %d inactive, %d backface, %d clipped, %d sorted\n",
+                (int32_t)(sort_stats.faces_total / frames),
+                (int32_t)(sort_stats.faces_inactive / frames),
+                (int32_t)(sort_stats.faces_backface / frames),
+                (int32_t)(sort_stats.faces_clipped / frames),
+                (int32_t)(sort_stats.faces_sorted / frames)
+            );
+
+#ifdef RENDER_STATS
+            render_stats_t render_stats;
+            get_render_stats(&render_stats);
+            render_counts_t* counts = &render_stats.frame;
+            printf(
+                "Last frame: %d vertices (%d near, %d far, %d xy), %d models skipped, %d triangles (%d / %d clipped to one / two), %d spans, %d pixels\n",
+                counts->vertices, counts->vertices_near, counts->vertices_far, counts->vertices_xy, counts->skipped,
+                counts->triangles, counts->triangles_clipped_one, counts->triangles_clipped_two, counts->spans, (int32_t)counts->pixels
+            );
+#endif
+        }
+    }
+}
+
+// Update function: Present the next finished frame. GL calls have to stay on
+// the GLUT thread.
+void main_loop(void) {
+    uint8_t* frontbuffer = (uint8_t*)swap_chain_acquire(swap_chain);
+    if(frontbuffer == 0) {
+        finish_replay();
     }
 
     // Buffer to screen
-    glPixelZoom(ZOOM_LEVEL, ZOOM_LEVEL);
-    glDrawPixels(SCREEN_WIDTH, SCREEN_HEIGHT, GL_RGB, GL_UNSIGNED_BYTE_3_3_2, framebuffer);
-    glutSwapBuffers();
+    if(!headless) {
+        glPixelZoom(ZOOM_LEVEL, ZOOM_LEVEL);
+        glDrawPixels(SCREEN_WIDTH, SCREEN_HEIGHT, GL_RGB, GL_UNSIGNED_BYTE_3_3_2, frontbuffer);
+        glutSwapBuffers();
+    }
 
-    // Calculate fps and print
+    // Calculate fps and print, along with how many frames never made it
     framecount++;
     if(framecount % 1000 == 0) {
         double fps = (double)framecount / (nanotime() - starttime);
         printf("FPS: %f\n", fps);
+
+        swap_chain_stats_t present_stats;
+        swap_chain_get_stats(swap_chain, &present_stats);
+        swap_chain_reset_stats(swap_chain);
+        printf(
+            "Present: %d rendered, %d shown, %d dropped, %.2f frames queued avg\n",
+            present_stats.submitted,
+            present_stats.presented,
+            present_stats.dropped,
+            present_stats.presented ? (double)present_stats.queue_depth_total / present_stats.presented : 0.0
+        );
     }
 }
 
@@ -1261,51 +1730,13 @@ void reshape(int w, int h) {
 
 // Glut input: key down
 void keyboard(unsigned char key, int x, int y) {
-    keys[key] = 1;
-
-    switch(key) {
-    case 27:
-        if(!dialog_mode && !menu_mode) {
-            if(paused == 1) {
-                paused = 0;
-            }
-            else {
-                paused = 1;
-            }
-        }
-    break;        
-    case ' ':
-        if(!transition_state) {
-            if(dialog_mode) {
-                dialog_pos++;
-            }
-
-            if(menu_mode) {
-                stage_dialogfun = load_level_city;
-                start_dialog(dialog_gamestart);
-                menu_mode = 0;
-                from_menu = 1;
-            }
-        }
-    break;
-    case 'p':
-        if(menu_mode) {
-            if(debug_mode == 1) {
-                debug_mode = 0;
-            }
-            else {
-                debug_mode = 1;
-            }
-        }
-    break;
-    default:
-        break;
-    }
+    atomic_swap(&keys[key], 1);
+    atomic_add(&key_presses[key], 1);
 }
 
 // Glut input: key up
 void keyboardup(unsigned char key, int x, int y) {
-    keys[key] = 0;
+    atomic_swap(&keys[key], 0);
 }
 
 // Entry point
@@ -1319,21 +1750,90 @@ int main(int argc, char **argv) {
     putenv( (char *) "__GL_SYNC_TO_VBLANK=0" );
 #endif
 */
-    // Create a window
-    glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE);
-    glutInitWindowSize(SCREEN_WIDTH * ZOOM_LEVEL, SCREEN_HEIGHT * ZOOM_LEVEL);
-    glutCreateWindow("CYBER DEFENSE 2200");
-    glutReshapeFunc(reshape);
-    glutIgnoreKeyRepeat (1);
-    glutKeyboardFunc(keyboard);
-    glutKeyboardUpFunc(keyboardup);
-    glutSetCursor(GLUT_CURSOR_NONE); 
-    glutIdleFunc(main_loop);
+    const char* record_path = 0;
+    const char* replay_path = 0;
+    const char* trace_path = 0;
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-latency") == 0 && i + 1 < argc) {
+            pipeline_latency = atoi(argv[i + 1]);
+        }
+        if(strcmp(argv[i], "-threads") == 0 && i + 1 < argc) {
+            num_threads = atoi(argv[i + 1]);
+        }
+        if(strcmp(argv[i], "-record") == 0 && i + 1 < argc) {
+            record_path = argv[i + 1];
+        }
+        if(strcmp(argv[i], "-replay") == 0 && i + 1 < argc) {
+            replay_path = argv[i + 1];
+        }
+        if(strcmp(argv[i], "-headless") == 0) {
+            headless = 1;
+        }
+        if(strcmp(argv[i], "-mailbox") == 0) {
+            present_mailbox = 1;
+        }
+        if(strcmp(argv[i], "-budget") == 0 && i + 1 < argc) {
+            frame_budget = atof(argv[i + 1]) / 1000.0;
+        }
+        if(strcmp(argv[i], "-trace") == 0 && i + 1 < argc) {
+            trace_path = argv[i + 1];
+        }
+        if(strcmp(argv[i], "-capture") == 0 && i + 1 < argc) {
+            capture_budget = atof(argv[i + 1]) / 1000.0;
+        }
+    }
+
+    // Random seed: Fresh, or the replays
+    uint32_t seed = (uint32_t)time(0);
+    if(replay_path != 0) {
+        replaying = replay_play(replay_path);
+        if(replaying == 0) {
+            printf("Could not read replay %s\n", replay_path);
+            return 1;
+        }
+        seed = replay_seed(replaying);
+    }
+    else if(headless) {
+        printf("-headless needs -replay\n");
+        return 1;
+    }
+    if(record_path != 0) {
+        recording = replay_record(record_path, seed);
+        if(recording == 0) {
+            printf("Could not write replay %s\n", record_path);
+            return 1;
+        }
+    }
+    srand(seed);
+    atexit(print_pacing_report);
+
+    // -trace file.json: Timeline of every timed scope, from startup on
+    timer_name_thread("main");
+    if(trace_path != 0) {
+        if(!trace_start(trace_path)) {
+            printf("Could not write trace %s\n", trace_path);
+            return 1;
+        }
+        atexit(trace_stop);
+    }
+
+    if(!headless) {
+        // Create a window
+        glutInit(&argc, argv);
+        glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE);
+        glutInitWindowSize(SCREEN_WIDTH * ZOOM_LEVEL, SCREEN_HEIGHT * ZOOM_LEVEL);
+        glutCreateWindow("CYBER DEFENSE 2200");
+        glutReshapeFunc(reshape);
+        glutIgnoreKeyRepeat (1);
+        glutKeyboardFunc(keyboard);
+        glutKeyboardUpFunc(keyboardup);
+        glutSetCursor(GLUT_CURSOR_NONE); 
+        glutIdleFunc(main_loop);
     
-    // Sound
-    BASS_Init(-1, 44100, 0, 0, 0);
-    BASS_Start();
+        // Sound
+        BASS_Init(-1, 44100, 0, 0, 0);
+        BASS_Start();
+    }
 
     // Music!
     music = 0;
@@ -1342,11 +1842,14 @@ int main(int argc, char **argv) {
     sounds[0] = BASS_StreamCreateFile(0, "data/fwup.ogg", 0, 0, BASS_STREAM_PRESCAN);
     sounds[1] = BASS_StreamCreateFile(0, "data/bwoom.ogg", 0, 0, BASS_STREAM_PRESCAN);
 
+    // Worker threads for renderer and simulation
+    jobs_init(num_threads);
+
     // Set up projection
     projection = imat4x4perspective(INT_FIXED(45), idiv(INT_FIXED(SCREEN_WIDTH), INT_FIXED(SCREEN_HEIGHT)), ZNEAR, ZFAR);
 
     // Screen buffers
-    framebuffer = malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint8_t));
+    swap_chain = swap_chain_create(PRESENT_BUFFERS, SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint8_t), present_mailbox);
 
     // Load up a bunch of global textures
     texture_overlay[0] = load_texture("data/cockpit_low.bmp");
@@ -1363,16 +1866,24 @@ int main(int argc, char **argv) {
     texture_menuimages[4] = load_texture("data/lose.bmp");
     texture_menuimages[5] = load_texture("data/barrier.bmp");
 
-    texture_count = 0;
-    texture_floor = 0;
-
     // Set up game
     menu_mode = 1;
     dialog_mode = 0;
 
-    // Run render loop
+    // Render on another thread, simulating ahead on a third if we pipeline,
+    // and present from the GLUT loop
     starttime = nanotime();
     lasttime = starttime;
+    if(pipeline_latency > 0) {
+        frame_ring = frame_ring_create(pipeline_latency + 1, sizeof(frame_t));
+        thread_start(simulation_thread, 0);
+    }
+    thread_start(render_thread, 0);
+    if(headless) {
+        while(1) {
+            main_loop();
+        }
+    }
     glutMainLoop();
 
 return 0;
@@ -0,0 +1,162 @@
+/**
+* Binary meshes: mmap / MapViewOfFile and pointers into the mapping
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <string.h>
+
+#include "mesh.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Meshes mapped so far, by path
+typedef struct {
+    char path[256];
+    model_t model;
+} mesh_file_t;
+
+static mesh_file_t mesh_files[MESH_MAX_FILES];
+static int32_t num_mesh_files = 0;
+
+// Whole file, read only, 0 on failure
+static uint8_t* map_file(const char* path, size_t* size) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if(file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+    LARGE_INTEGER file_size;
+    HANDLE mapping = 0;
+    uint8_t* data = 0;
+    if(GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+        *size = (size_t)file_size.QuadPart;
+    }
+    if(mapping != 0) {
+        data = (uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    return data;
+#else
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        return 0;
+    }
+    struct stat info;
+    void* data = MAP_FAILED;
+    if(fstat(fd, &info) == 0 && info.st_size > 0) {
+        data = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        *size = (size_t)info.st_size;
+    }
+    close(fd);
+    return data != MAP_FAILED ? (uint8_t*)data : 0;
+#endif
+}
+
+static void unmap_file(uint8_t* data, size_t size) {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+// Array of count elements of size bytes at offset lies within the file
+static int32_t array_fits(uint32_t offset, int32_t count, size_t size, size_t file_size) {
+    return count >= 0 && offset % 4 == 0 && offset <= file_size && (size_t)count <= (file_size - offset) / size;
+}
+
+// Index in [0, count)
+static int32_t index_valid(int32_t index, int32_t count) {
+    return index >= 0 && index < count;
+}
+
+static int32_t mesh_valid(const mesh_header_t* header, size_t size) {
+    if(size < sizeof(mesh_header_t) || memcmp(header->magic, MESH_MAGIC, 4) != 0 || header->version != MESH_VERSION) {
+        return 0;
+    }
+    if(!(
+        header->face_size == sizeof(face_t) &&
+        array_fits(header->vertices_offset, header->num_vertices, sizeof(vertex_t), size) &&
+        array_fits(header->normals_offset, header->num_normals, sizeof(vertex_t), size) &&
+        array_fits(header->texcoords_offset, header->num_texcoords, sizeof(texcoord_t), size) &&
+        array_fits(header->faces_offset, header->num_faces, header->face_size, size)
+    )) {
+        return 0;
+    }
+
+    // Every index a face holds points into its array. Texture ids can only
+    // be checked against a texture table, by whoever assigns one.
+    const face_t* faces = (const face_t*)((const uint8_t*)header + header->faces_offset);
+    for(int32_t i = 0; i < header->num_faces; i++) {
+        const int32_t* v = faces[i].v;
+        if(
+            !index_valid(v[0], header->num_vertices) ||
+            !index_valid(v[1], header->num_vertices) ||
+            !index_valid(v[2], header->num_vertices) ||
+            !index_valid(v[3], header->num_normals) ||
+            !index_valid(v[4], header->num_texcoords) ||
+            !index_valid(v[5], header->num_texcoords) ||
+            !index_valid(v[6], header->num_texcoords) ||
+            v[7] < 0
+        ) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int32_t mesh_load(model_t* model, const char* path) {
+    for(int32_t i = 0; i < num_mesh_files; i++) {
+        if(strcmp(mesh_files[i].path, path) == 0) {
+            *model = mesh_files[i].model;
+            return 1;
+        }
+    }
+    if(num_mesh_files == MESH_MAX_FILES || strlen(path) >= sizeof(mesh_files[0].path)) {
+        return 0;
+    }
+
+    size_t size;
+    uint8_t* data = map_file(path, &size);
+    if(data == 0) {
+        return 0;
+    }
+    const mesh_header_t* header = (const mesh_header_t*)data;
+    if(!mesh_valid(header, size)) {
+        unmap_file(data, size);
+        return 0;
+    }
+
+    memset(model, 0, sizeof(model_t));
+    model->vertices = (vertex_t*)(data + header->vertices_offset);
+    model->normals = (vertex_t*)(data + header->normals_offset);
+    model->texcoords = (texcoord_t*)(data + header->texcoords_offset);
+    model->faces = (face_t*)(data + header->faces_offset);
+    model->num_vertices = header->num_vertices;
+    model->num_normals = header->num_normals;
+    model->num_texcoords = header->num_texcoords;
+    model->num_faces = header->num_faces;
+    model->modelview = imat4x4(
+        INT_FIXED(1), 0, 0, 0,
+        0, INT_FIXED(1), 0, 0,
+        0, 0, INT_FIXED(1), 0,
+        0, 0, 0, INT_FIXED(1)
+    );
+
+    strcpy(mesh_files[num_mesh_files].path, path);
+    mesh_files[num_mesh_files].model = *model;
+    num_mesh_files++;
+    return 1;
+}
@@ -0,0 +1,48 @@
+/**
+* Binary meshes: Models as a versioned file of fixed point arrays, made with
+* models/convert-obj.pl, mapped into memory and used in place. Level meshes
+* that get a BSP tree are copied by bsp_compile_model (split and reordered)
+* and drawn from that copy, so for them the mapping only saves the parsing.
+*/
+
+#ifndef __MESH_H__
+#define __MESH_H__
+
+#include <stdint.h>
+
+#include "rasterize.h"
+
+#define MESH_MAGIC "CDMS"
+#define MESH_VERSION 2
+
+// Up front in every mesh file: Counts, and byte offsets from the start of the
+// file of the vertex, normal, texcoord and face arrays (64 byte aligned).
+// Faces are face_t records, face_size is their 32 bytes. Little endian.
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t face_size;
+    int32_t num_vertices;
+    int32_t num_normals;
+    int32_t num_texcoords;
+    int32_t num_faces;
+    uint32_t vertices_offset;
+    uint32_t normals_offset;
+    uint32_t texcoords_offset;
+    uint32_t faces_offset;
+    uint8_t reserved[20];
+} mesh_header_t;
+
+#define MESH_MAX_FILES 16
+
+// Point model at the arrays of the mesh at path, with an identity modelview,
+// no textures, not drawn. Returns 0 if the file can't be mapped or isn't a
+// valid mesh of this version, including faces with out of range vertex,
+// normal or texcoord indices. Texture ids are only checked to be >= 0.
+//
+// Mappings are read only and stay for as long as the program runs: BSP
+// trees are cached by the address of their source faces, which must never
+// come back as a different mesh. Loading a path again gives the same arrays.
+int32_t mesh_load(model_t* model, const char* path);
+
+#endif
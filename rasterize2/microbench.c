@@ -0,0 +1,433 @@
+/**
+* Microbenchmarks for the hot primitives: Fixed point math from fixedmath.h
+* and the triangle drawer, over sets of synthetic triangles (tiny, thin and
+* large ones at random orientations, inside the screen, across its edge and
+* through the near plane).
+*
+* Every benchmark runs for a while to warm up, then gets timed BENCH_REPS
+* times. Prints median and minimum ns per op and the spread (standard
+* deviation over mean) of the repetitions, for triangles also pixels drawn
+* per triangle and per second, at the median.
+*
+* Usage: microbench [name filter]
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rasterize.h"
+#include "timing.h"
+
+// Inputs per batch (power of two), triangles per set
+#define BENCH_BATCH 1024
+#define BENCH_MASK (BENCH_BATCH - 1)
+#define BENCH_TRIANGLES 1024
+
+// Seconds of warm-up, seconds every timed repetition runs at least, and
+// how many of those
+#define BENCH_WARMUP_TIME 0.05
+#define BENCH_REP_TIME 0.01
+#define BENCH_REPS 15
+
+#define BENCH_SEED 1234
+
+// A benchmark: func runs its batch iterations times. ops is the number of
+// operations in a batch, pixels the number of pixels it draws (0 for math).
+typedef void (*bench_func_t)(void* data, int32_t iterations);
+
+typedef struct {
+    const char* name;
+    bench_func_t func;
+    void* data;
+    int32_t ops;
+    int64_t pixels;
+} bench_t;
+
+// Inputs. Every iteration pairs them up a little differently, so the
+// compiler can't do a batch once and be done.
+static int32_t values_a[BENCH_BATCH];
+static int32_t values_b[BENCH_BATCH];
+static int32_t positive_values[BENCH_BATCH];
+static int32_t angles[BENCH_BATCH];
+static ivec3_t vectors[BENCH_BATCH];
+static ivec4_t points[BENCH_BATCH];
+static imat4x4_t matrices_a[BENCH_BATCH];
+static imat4x4_t matrices_b[BENCH_BATCH];
+
+// Outputs, not static so that stores to them stay
+int32_t bench_values_out[BENCH_BATCH];
+ivec3_t bench_vectors_out[BENCH_BATCH];
+ivec4_t bench_points_out[BENCH_BATCH];
+imat4x4_t bench_matrices_out[BENCH_BATCH];
+
+static double random_unit() {
+    return rand() / (double)RAND_MAX;
+}
+
+static double random_range(double min, double max) {
+    return min + (max - min) * random_unit();
+}
+
+// Random rotation and translation
+static imat4x4_t random_affine() {
+    imat4x4_t rotation = imat4x4mul(
+        imat4x4rotatex(rand() % INT_FIXED(1)),
+        imat4x4mul(imat4x4rotatey(rand() % INT_FIXED(1)), imat4x4rotatez(rand() % INT_FIXED(1)))
+    );
+    ivec3_t offset = ivec3(FLOAT_FIXED(random_range(-200.0, 200.0)), FLOAT_FIXED(random_range(-200.0, 200.0)), FLOAT_FIXED(random_range(-200.0, 200.0)));
+    return imat4x4mul(imat4x4translate(offset), rotation);
+}
+
+static void make_math_inputs() {
+    for(int32_t i = 0; i < BENCH_BATCH; i++) {
+        values_a[i] = FLOAT_FIXED(random_range(-100.0, 100.0));
+        values_b[i] = FLOAT_FIXED(random_range(0.5, 100.0)) * (rand() % 2 ? 1 : -1);
+        positive_values[i] = FLOAT_FIXED(random_range(0.0, 10000.0));
+        angles[i] = rand() % INT_FIXED(4);
+        vectors[i] = ivec3(FLOAT_FIXED(random_range(-50.0, 50.0)), FLOAT_FIXED(random_range(-50.0, 50.0)), FLOAT_FIXED(random_range(1.0, 50.0)));
+        points[i] = ivec4(vectors[i].x, vectors[i].y, vectors[i].z, INT_FIXED(1));
+        matrices_a[i] = random_affine();
+        matrices_b[i] = random_affine();
+    }
+}
+
+static void bench_imul(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_values_out[i] = imul(values_a[i], values_b[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_idiv(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_values_out[i] = idiv(values_a[i], values_b[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_isqrt(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_values_out[i] = isqrt(positive_values[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_isin(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_values_out[i] = isin(angles[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_imat4x4mul(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_matrices_out[i] = imat4x4mul(matrices_a[i], matrices_b[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_imat4x4transform(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_points_out[i] = imat4x4transform(matrices_a[i], points[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_imat4x4affineinverse(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_matrices_out[i] = imat4x4affineinverse(matrices_a[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+static void bench_ivec3norm(void* data, int32_t iterations) {
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_BATCH; i++) {
+            bench_vectors_out[i] = ivec3norm(vectors[(i + n) & BENCH_MASK]);
+        }
+    }
+}
+
+// Triangle sets: Size is the longest side in pixels. Thin triangles have the
+// given width in pixels, others are as wide as half to all of their size.
+// Behind is the number of vertices moved behind the camera.
+#define PLACE_INSIDE 0
+#define PLACE_EDGE 1
+
+typedef struct {
+    const char* name;
+    double min_size;
+    double max_size;
+    double width;
+    int32_t placement;
+    int32_t behind;
+} triangle_case_t;
+
+#define NUM_TRIANGLE_CASES 8
+static const triangle_case_t triangle_cases[NUM_TRIANGLE_CASES] = {
+    { "tri_tiny", 1.0, 4.0, 0.0, PLACE_INSIDE, 0 },
+    { "tri_tiny_edge", 1.0, 4.0, 0.0, PLACE_EDGE, 0 },
+    { "tri_thin", 40.0, 200.0, 1.5, PLACE_INSIDE, 0 },
+    { "tri_thin_edge", 40.0, 200.0, 1.5, PLACE_EDGE, 0 },
+    { "tri_large", 100.0, 300.0, 0.0, PLACE_INSIDE, 0 },
+    { "tri_large_edge", 100.0, 300.0, 0.0, PLACE_EDGE, 0 },
+    { "tri_near_one", 50.0, 150.0, 0.0, PLACE_INSIDE, 1 },
+    { "tri_near_two", 50.0, 150.0, 0.0, PLACE_INSIDE, 2 },
+};
+
+typedef struct {
+    transformed_triangle_t triangles[BENCH_TRIANGLES];
+    uint8_t* texture;
+    uint8_t* framebuffer;
+} triangle_set_t;
+
+// A vertex at view space (x, y, z), set up like the transform does it
+static transformed_vertex_t make_vertex(imat4x4_t projection, double x, double y, double z, int32_t u, int32_t v) {
+    transformed_vertex_t vert;
+    vert.cp = imat4x4transform(projection, ivec4(FLOAT_FIXED(x), FLOAT_FIXED(y), FLOAT_FIXED(z), INT_FIXED(1)));
+    vert.p = ivec3(0, 0, 0);
+    vert.uw = u;
+    vert.vw = v;
+
+    if(vert.cp.z <= 0) {
+        vert.clip = 1;
+    }
+    else if(vert.cp.z >= vert.cp.w) {
+        vert.clip = 3;
+    }
+    else {
+        vert.p = ivec3(
+            VIEWPORT(vert.cp.x, vert.cp.w, SCREEN_WIDTH),
+            VIEWPORT(vert.cp.y, vert.cp.w, SCREEN_HEIGHT),
+            vert.cp.z
+        );
+        vert.clip = 0;
+    }
+    return vert;
+}
+
+// A random triangle of the given case, laid out in pixels, then put at a
+// random depth so it lands on those pixels
+static transformed_triangle_t make_triangle(const triangle_case_t* tri_case, imat4x4_t projection) {
+    double size = random_range(tri_case->min_size, tri_case->max_size);
+    double width = tri_case->width > 0.0 ? tri_case->width : size * random_range(0.5, 1.0);
+    double shape[3][2] = {
+        { -0.5 * size, -0.5 * width },
+        { 0.5 * size, random_range(-0.5, 0.5) * width },
+        { random_range(-0.5, 0.5) * size, 0.5 * width }
+    };
+
+    // Turn, then find the bounds
+    double angle = random_range(0.0, 2.0 * 3.14159265);
+    double pos[3][2];
+    double min[2] = { 1e9, 1e9 };
+    double max[2] = { -1e9, -1e9 };
+    for(int32_t i = 0; i < 3; i++) {
+        pos[i][0] = shape[i][0] * cos(angle) - shape[i][1] * sin(angle);
+        pos[i][1] = shape[i][0] * sin(angle) + shape[i][1] * cos(angle);
+        for(int32_t j = 0; j < 2; j++) {
+            min[j] = pos[i][j] < min[j] ? pos[i][j] : min[j];
+            max[j] = pos[i][j] > max[j] ? pos[i][j] : max[j];
+        }
+    }
+
+    // Inside: Shrink to fit if need be, then anywhere it fits. Edge: Centered
+    // somewhere on the screens border.
+    double screen[2] = { SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1 };
+    double center[2];
+    if(tri_case->placement == PLACE_INSIDE) {
+        double scale = 1.0;
+        for(int32_t j = 0; j < 2; j++) {
+            scale = max[j] - min[j] > screen[j] ? fmin(scale, screen[j] / (max[j] - min[j])) : scale;
+        }
+        for(int32_t j = 0; j < 2; j++) {
+            min[j] *= scale;
+            max[j] *= scale;
+            center[j] = random_range(-min[j], screen[j] - max[j]);
+        }
+        for(int32_t i = 0; i < 3; i++) {
+            pos[i][0] *= scale;
+            pos[i][1] *= scale;
+        }
+    }
+    else {
+        double along = random_range(0.0, 2.0 * (screen[0] + screen[1]));
+        if(along < 2.0 * screen[0]) {
+            center[0] = fmod(along, screen[0]);
+            center[1] = along < screen[0] ? 0.0 : screen[1];
+        }
+        else {
+            along -= 2.0 * screen[0];
+            center[0] = along < screen[1] ? 0.0 : screen[0];
+            center[1] = fmod(along, screen[1]);
+        }
+    }
+
+    // Pixels to view space at the picked depth, using the projections scale
+    double depth = random_range(5.0, 50.0);
+    double scale_x = projection.m[0] / 4096.0;
+    double scale_y = projection.m[5] / 4096.0;
+
+    transformed_triangle_t tri;
+    tri.shade = FLOAT_FIXED(random_range(0.3, 1.0));
+    for(int32_t i = 0; i < 3; i++) {
+        double ndc_x = 2.0 * (center[0] + pos[i][0]) / SCREEN_WIDTH - 1.0;
+        double ndc_y = 2.0 * (center[1] + pos[i][1]) / SCREEN_HEIGHT - 1.0;
+        double z = i < tri_case->behind ? 0.5 * depth : -depth;
+        tri.v[i] = make_vertex(
+            projection, ndc_x * depth / scale_x, ndc_y * depth / scale_y, z,
+            FLOAT_FIXED(random_range(0.0, 4.0)), FLOAT_FIXED(random_range(0.0, 4.0))
+        );
+    }
+    return tri;
+}
+
+static void bench_triangles(void* data, int32_t iterations) {
+    triangle_set_t* set = (triangle_set_t*)data;
+    for(int32_t n = 0; n < iterations; n++) {
+        for(int32_t i = 0; i < BENCH_TRIANGLES; i++) {
+            draw_triangle(set->framebuffer, &set->triangles[i], set->texture);
+        }
+    }
+}
+
+// Pixels the set draws: Every triangle on its own, fully lit and white, into
+// a black framebuffer
+static int64_t count_pixels(const triangle_set_t* set) {
+    uint8_t* white = (uint8_t*)malloc(TEX_SIZE * TEX_SIZE * sizeof(uint8_t));
+    uint8_t* framebuffer = (uint8_t*)malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint8_t));
+    memset(white, 0xFF, TEX_SIZE * TEX_SIZE);
+
+    int64_t pixels = 0;
+    for(int32_t i = 0; i < BENCH_TRIANGLES; i++) {
+        transformed_triangle_t tri = set->triangles[i];
+        tri.shade = INT_FIXED(1);
+        memset(framebuffer, 0, SCREEN_WIDTH * SCREEN_HEIGHT);
+        draw_triangle(framebuffer, &tri, white);
+        for(int32_t j = 0; j < SCREEN_WIDTH * SCREEN_HEIGHT; j++) {
+            pixels += framebuffer[j] != 0;
+        }
+    }
+
+    free(framebuffer);
+    free(white);
+    return pixels;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Warm up, then time BENCH_REPS repetitions of as many iterations as take
+// BENCH_REP_TIME, and print the results
+static void run_bench(const bench_t* bench) {
+    int32_t iterations = 1;
+    double start = nanotime();
+    double rep_start = start;
+    while(1) {
+        bench->func(bench->data, iterations);
+        double now = nanotime();
+        if(now - rep_start < BENCH_REP_TIME && iterations < (1 << 24)) {
+            iterations *= 2;
+        }
+        else if(now - start >= BENCH_WARMUP_TIME) {
+            break;
+        }
+        rep_start = now;
+    }
+
+    double ns[BENCH_REPS];
+    double sum = 0.0;
+    for(int32_t rep = 0; rep < BENCH_REPS; rep++) {
+        rep_start = nanotime();
+        bench->func(bench->data, iterations);
+        ns[rep] = (nanotime() - rep_start) * 1e9 / ((double)iterations * bench->ops);
+        sum += ns[rep];
+    }
+    qsort(ns, BENCH_REPS, sizeof(double), compare_doubles);
+
+    double mean = sum / BENCH_REPS;
+    double variance = 0.0;
+    for(int32_t rep = 0; rep < BENCH_REPS; rep++) {
+        variance += (ns[rep] - mean) * (ns[rep] - mean);
+    }
+    double spread = 100.0 * sqrt(variance / (BENCH_REPS - 1)) / mean;
+    double median = ns[BENCH_REPS / 2];
+
+    printf("%-26s %12.2f %12.2f %7.1f%%", bench->name, median, ns[0], spread);
+    if(bench->pixels != 0) {
+        double pixels_per_op = (double)bench->pixels / bench->ops;
+        printf(" %10.1f %10.1f", pixels_per_op, pixels_per_op * 1e3 / median);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+    srand(BENCH_SEED);
+    make_math_inputs();
+
+    bench_t benches[8 + NUM_TRIANGLE_CASES] = {
+        { "imul", bench_imul, 0, BENCH_BATCH, 0 },
+        { "idiv", bench_idiv, 0, BENCH_BATCH, 0 },
+        { "isqrt", bench_isqrt, 0, BENCH_BATCH, 0 },
+        { "isin", bench_isin, 0, BENCH_BATCH, 0 },
+        { "imat4x4mul", bench_imat4x4mul, 0, BENCH_BATCH, 0 },
+        { "imat4x4transform", bench_imat4x4transform, 0, BENCH_BATCH, 0 },
+        { "imat4x4affineinverse", bench_imat4x4affineinverse, 0, BENCH_BATCH, 0 },
+        { "ivec3norm", bench_ivec3norm, 0, BENCH_BATCH, 0 },
+    };
+    int32_t num_benches = 8;
+
+    // Triangle sets share a random texture and a framebuffer
+    imat4x4_t projection = imat4x4perspective(INT_FIXED(45), idiv(INT_FIXED(SCREEN_WIDTH), INT_FIXED(SCREEN_HEIGHT)), ZNEAR, ZFAR);
+    uint8_t* texture = (uint8_t*)malloc(TEX_SIZE * TEX_SIZE * sizeof(uint8_t));
+    uint8_t* framebuffer = (uint8_t*)calloc(SCREEN_WIDTH * SCREEN_HEIGHT, sizeof(uint8_t));
+    for(int32_t i = 0; i < TEX_SIZE * TEX_SIZE; i++) {
+        texture[i] = rand() & 0xFF;
+    }
+
+    triangle_set_t* sets = (triangle_set_t*)malloc(NUM_TRIANGLE_CASES * sizeof(triangle_set_t));
+    for(int32_t c = 0; c < NUM_TRIANGLE_CASES; c++) {
+        triangle_set_t* set = &sets[c];
+        set->texture = texture;
+        set->framebuffer = framebuffer;
+        for(int32_t i = 0; i < BENCH_TRIANGLES; i++) {
+            set->triangles[i] = make_triangle(&triangle_cases[c], projection);
+        }
+
+        bench_t* bench = &benches[num_benches++];
+        bench->name = triangle_cases[c].name;
+        bench->func = bench_triangles;
+        bench->data = set;
+        bench->ops = BENCH_TRIANGLES;
+        bench->pixels = strstr(bench->name, filter) != 0 ? count_pixels(set) : 0;
+    }
+
+    printf("%-26s %12s %12s %8s %10s %10s\n", "benchmark", "median ns/op", "min ns/op", "spread", "px/op", "Mpx/s");
+    for(int32_t i = 0; i < num_benches; i++) {
+        if(strstr(benches[i].name, filter) != 0) {
+            run_bench(&benches[i]);
+        }
+    }
+
+    free(sets);
+    free(framebuffer);
+    free(texture);
+    return 0;
+}
@@ -1,12 +0,0 @@
-/**
-* City-scape model
-*/
-
-#include "rasterize.h"
-
-model_t get_model_cityscape2();
-model_t get_model_cityscape3();
-model_t get_model_tower();
-model_t get_model_enemy();
-model_t get_model_ringworld();
-model_t get_model_core();
\ No newline at end of file
@@ -23144,7 +23144,7 @@ static texcoord_t texcoords[] = {
     {FLOAT_FIXED(4.7769), FLOAT_FIXED(26.2063)}, 
 };
 
-static triangle_t faces[] = {
+static face_t faces[] = {
     {296, 254, 1087, 0, 0, 1, 2, 0},
     {316, 222, 1083, 1, 3, 4, 5, 0},
     {336, 244, 1079, 2, 6, 7, 8, 0},
@@ -1,14 +1,34 @@
 #!/usr/bin/perl
 
-# OBJ -> .h converter. Ignores specified normals and recalculates them as
-# as face normals.
+# OBJ -> binary mesh converter. Ignores specified normals and recalculates
+# them as face normals.
+#
+# Usage: convert-obj.pl [-scale s] model.obj > model.mesh
+#
+# The games meshes in data/ are: core.obj at scale 3.7, ringworld.obj and
+# tower.obj at 20, city2.obj at 2 (cityscape.mesh) and enemy.obj at 2.5.
+#
+# Mesh layout, see mesh.h: 64 byte header ("CDMS", version, face record
+# size, then vertex / normal / texcoord / face counts and the byte offset of
+# each array), then the arrays, each starting on a 64 byte boundary. Values
+# are 20.12 fixed point, little endian. Face records are the 8 indices of a
+# face_t (32 bytes), so the game can use them in place.
 
 use warnings;
 use strict;
 
-my $scale = 3.7;
+my $scale = 1.0;
 my $offset = 0;
-my $name = "core";
+
+while(@ARGV && $ARGV[0] =~ /^-/) {
+    my $option = shift @ARGV;
+    if($option eq "-scale") {
+        $scale = shift @ARGV;
+    }
+    else {
+        die "Usage: convert-obj.pl [-scale s] model.obj > model.mesh\n";
+    }
+}
 
 my @vertices;
 my @texcoords;
@@ -105,77 +125,65 @@ for(my $faceidx = 0; $faceidx < scalar @faces; $faceidx++) {
     push(@faces_proper, $faces[$faceidx]);
 }
 
-print "/**\n * Model: $name\n */\n\n";
+# Same as the game's FLOAT_FIXED, applied to the number as perl prints it
+sub fixed {
+    return int(("" . $_[0]) * 4096.0);
+}
 
-print "#include \"rasterize.h\"\n\n";
+my $mesh_version = 2;
+my $face_size = 32;
+my $header_size = 64;
+my $align = 64;
 
-print "#define NUM_VERTICES " . scalar @vertices . "\n";
-print "#define NUM_NORMALS " . scalar @normalsarr . "\n";
-print "#define NUM_TEXCOORDS " . scalar @texcoords . "\n";
-print "#define NUM_FACES " . scalar @faces_proper . "\n\n";
+sub aligned {
+    return int(($_[0] + $align - 1) / $align) * $align;
+}
+
+my $vertices_offset = $header_size;
+my $normals_offset = aligned($vertices_offset + 12 * scalar @vertices);
+my $texcoords_offset = aligned($normals_offset + 12 * scalar @normalsarr);
+my $faces_offset = aligned($texcoords_offset + 8 * scalar @texcoords);
+
+binmode STDOUT;
+my $out = pack(
+    "a4 V2 l<4 V4",
+    "CDMS", $mesh_version, $face_size,
+    scalar @vertices, scalar @normalsarr, scalar @texcoords, scalar @faces_proper,
+    $vertices_offset, $normals_offset, $texcoords_offset, $faces_offset
+);
 
-print "static vertex_t vertices[] = {\n";
+$out .= "\0" x ($vertices_offset - length $out);
 foreach(@vertices) {
     my @vertex = @{$_};
-    print "    {FLOAT_FIXED(" . $vertex[0]*$scale .
-        "), FLOAT_FIXED(" . $vertex[1]*$scale .
-        "), FLOAT_FIXED(" . $vertex[2]*$scale . ")}, \n";
+    $out .= pack("l<3", fixed($vertex[0] * $scale), fixed($vertex[1] * $scale), fixed($vertex[2] * $scale));
 }
-print "};\n\n";
 
-print "static vertex_t normals[] = {\n";
+$out .= "\0" x ($normals_offset - length $out);
 foreach(@normalsarr) {
-        my @normal = @{$_};
-        print "    {FLOAT_FIXED(" . $normal[0]*1.0 .
-                "), FLOAT_FIXED(" . $normal[1]*1.0 .
-                "), FLOAT_FIXED(" . $normal[2]*1.0 . ")}, \n";
+    my @normal = @{$_};
+    $out .= pack("l<3", fixed($normal[0] * 1.0), fixed($normal[1] * 1.0), fixed($normal[2] * 1.0));
 }
-print "};\n\n";
 
-print "static texcoord_t texcoords[] = {\n";
+$out .= "\0" x ($texcoords_offset - length $out);
 foreach(@texcoords) {
-        my @texcoord = @{$_};
-        print "    {FLOAT_FIXED(" . ($texcoord[0] + $texcoord_min_u) .
-                "), FLOAT_FIXED(" . ($texcoord[1] + $texcoord_min_v) . ")}, \n";
+    my @texcoord = @{$_};
+    $out .= pack("l<2", fixed($texcoord[0] + $texcoord_min_u), fixed($texcoord[1] + $texcoord_min_v));
 }
-print "};\n\n";
 
-print "static triangle_t faces[] = {\n";
-foreach(@faces) {
+$out .= "\0" x ($faces_offset - length $out);
+foreach(@faces_proper) {
     my @face = @{$_};
-    print "    {" . ($face[0] - 1 + $offset) . ", " .
-                ($face[1] - 1 + $offset) . ", " .
-                ($face[2] - 1 + $offset) . ", " .
-                ($face[3] - 1 + $offset) . ", " .
-                ($face[4] - 1 + $offset) . ", " .
-                ($face[5] - 1 + $offset) . ", " .
-                ($face[6] - 1 + $offset) . ", " .				
-                ($face[7]) . "},\n";
-}
-print "};\n\n";
-
-print "model_t get_model_$name() {\n";
-print <<"RETURN_FUNC";
-    model_t model;
-
-    model.vertices = vertices;
-    model.normals = normals;
-    model.texcoords = texcoords;
-    model.faces = faces;
-
-    model.num_vertices = NUM_VERTICES;
-    model.num_normals = NUM_NORMALS;
-    model.num_texcoords = NUM_TEXCOORDS;
-    model.num_faces = NUM_FACES;
-
-    model.modelview = imat4x4(
-        INT_FIXED(1), 0, 0, 0,
-        0, INT_FIXED(1), 0, 0,
-        0, 0, INT_FIXED(1), 0,
-        0, 0, 0, INT_FIXED(1)
+    $out .= pack(
+        "l<8",
+        $face[0] - 1 + $offset,
+        $face[1] - 1 + $offset,
+        $face[2] - 1 + $offset,
+        $face[3] - 1 + $offset,
+        $face[4] - 1 + $offset,
+        $face[5] - 1 + $offset,
+        $face[6] - 1 + $offset,
+        $face[7]
     );
-
-    return model;
 }
 
-RETURN_FUNC
+print $out;
@@ -0,0 +1,108 @@
+/**
+* Frame pacing histograms
+*/
+
+#include <string.h>
+
+#include "pacing.h"
+
+// Bucket for a time in microseconds: The value itself while small, then the
+// top PACING_SUB_BITS - 1 bits below the highest one, per power of two
+static int32_t bucket_index(uint32_t us) {
+    if(us < PACING_SUB) {
+        return us;
+    }
+
+    int32_t top_bit = 31;
+    while(!(us >> top_bit)) {
+        top_bit--;
+    }
+    if(top_bit > PACING_MAX_BITS) {
+        return PACING_BUCKETS - 1;
+    }
+    int32_t shift = top_bit - PACING_SUB_BITS + 1;
+    return PACING_SUB + (shift - 1) * (PACING_SUB / 2) + (int32_t)(us >> shift) - PACING_SUB / 2;
+}
+
+// Middle of a bucket, in microseconds
+static double bucket_value(int32_t index) {
+    if(index < PACING_SUB) {
+        return index;
+    }
+    int32_t shift = (index - PACING_SUB) / (PACING_SUB / 2) + 1;
+    int32_t top = (index - PACING_SUB) % (PACING_SUB / 2) + PACING_SUB / 2;
+    return ((double)top + 0.5) * (1 << shift);
+}
+
+void pacing_reset(pacing_histogram_t* hist) {
+    memset(hist, 0, sizeof(pacing_histogram_t));
+}
+
+void pacing_add(pacing_histogram_t* hist, double seconds, double budget) {
+    double us = seconds * 1000000.0;
+    hist->counts[bucket_index(us < 0.0 ? 0 : (us > 4e9 ? 4000000000u : (uint32_t)us))]++;
+    hist->frames++;
+    hist->total += seconds;
+    hist->max = seconds > hist->max ? seconds : hist->max;
+
+    if(seconds > budget) {
+        hist->over_budget++;
+        hist->current_run++;
+        if(hist->current_run == 2) {
+            hist->miss_runs++;
+        }
+        hist->longest_run = hist->current_run > hist->longest_run ? hist->current_run : hist->longest_run;
+    }
+    else {
+        hist->current_run = 0;
+    }
+}
+
+void pacing_merge(pacing_histogram_t* into, const pacing_histogram_t* hist) {
+    for(int32_t i = 0; i < PACING_BUCKETS; i++) {
+        into->counts[i] += hist->counts[i];
+    }
+    into->frames += hist->frames;
+    into->total += hist->total;
+    into->max = hist->max > into->max ? hist->max : into->max;
+    into->over_budget += hist->over_budget;
+    into->miss_runs += hist->miss_runs;
+    into->longest_run = hist->longest_run > into->longest_run ? hist->longest_run : into->longest_run;
+}
+
+double pacing_percentile(const pacing_histogram_t* hist, double p) {
+    int64_t rank = (int64_t)(p * hist->frames + 0.5);
+    rank = rank < 1 ? 1 : rank;
+
+    int64_t seen = 0;
+    for(int32_t i = 0; i < PACING_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if(seen >= rank) {
+            // The true value is never above the largest one seen
+            double value = bucket_value(i) / 1000000.0;
+            return value > hist->max ? hist->max : value;
+        }
+    }
+    return hist->max;
+}
+
+void pacing_print_header(FILE* out, double budget) {
+    fprintf(out, "Frame times in ms, budget %.2f ms\n", budget * 1000.0);
+    fprintf(
+        out, "%-22s %7s %7s %7s %7s %7s %7s %7s %7s %6s %5s %7s\n",
+        "", "frames", "mean", "p50", "p90", "p99", "p99.9", "max", "over", "over%", "runs", "longest"
+    );
+}
+
+void pacing_print(FILE* out, const char* tag, const pacing_histogram_t* hist) {
+    if(hist->frames == 0) {
+        return;
+    }
+    fprintf(
+        out, "%-22s %7d %7.2f %7.2f %7.2f %7.2f %7.2f %7.2f %7d %5.1f%% %5d %7d\n",
+        tag, hist->frames, hist->total * 1000.0 / hist->frames,
+        pacing_percentile(hist, 0.5) * 1000.0, pacing_percentile(hist, 0.9) * 1000.0,
+        pacing_percentile(hist, 0.99) * 1000.0, pacing_percentile(hist, 0.999) * 1000.0, hist->max * 1000.0,
+        hist->over_budget, 100.0 * hist->over_budget / hist->frames, hist->miss_runs, hist->longest_run
+    );
+}
@@ -0,0 +1,48 @@
+/**
+* Frame pacing: Frame times in an HDR style histogram, with stutter
+* detection, and a report of where the time went
+*/
+
+#ifndef __PACING_H__
+#define __PACING_H__
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Log-linear buckets over microseconds: Exact below 64 us, then 32 buckets
+// per power of two, so every value is within about 3%, up to 2^24 us (about
+// 16 s). Anything longer lands in the last bucket.
+#define PACING_SUB_BITS 6
+#define PACING_SUB (1 << PACING_SUB_BITS)
+#define PACING_MAX_BITS 24
+#define PACING_BUCKETS (PACING_SUB + (PACING_MAX_BITS - PACING_SUB_BITS + 1) * (PACING_SUB / 2))
+
+// Frame count, total and longest time in seconds, and stutter: Frames over
+// budget, runs of two or more of them in a row, the longest such run and the
+// one going on right now
+typedef struct {
+    uint32_t counts[PACING_BUCKETS];
+    int32_t frames;
+    double total;
+    double max;
+
+    int32_t over_budget;
+    int32_t miss_runs;
+    int32_t longest_run;
+    int32_t current_run;
+} pacing_histogram_t;
+
+void pacing_reset(pacing_histogram_t* hist);
+void pacing_add(pacing_histogram_t* hist, double seconds, double budget);
+
+// Add everything in hist to into. Runs in progress don't carry over.
+void pacing_merge(pacing_histogram_t* into, const pacing_histogram_t* hist);
+
+// Frame time at percentile p (0 - 1), in seconds
+double pacing_percentile(const pacing_histogram_t* hist, double p);
+
+// Report: A header, then one line per histogram, times in ms
+void pacing_print_header(FILE* out, double budget);
+void pacing_print(FILE* out, const char* tag, const pacing_histogram_t* hist);
+
+#endif
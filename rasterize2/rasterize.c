@@ -4,8 +4,13 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include "rasterize.h"
+#include "depthsort.h"
+#include "bsp.h"
+#include "timing.h"
+#include "threads.h"
 
 #define RGBCOMPSCALE(col, shift, mask, s) ((FIXED_INT_ROUND(imul(INT_FIXED(((col) >> (shift)) & (mask)), (s)))) << (shift))
 #define RGB322SCALE(col, s) (RGBCOMPSCALE(col, 5, 0x07, s) + RGBCOMPSCALE(col, 2, 0x07, s) + RGBCOMPSCALE(col, 0, 0x03, s))
@@ -14,12 +19,87 @@
 // Storage for post-transform vertices / texcoords / triangles
 static int32_t num_vertices_total = 0;
 static transformed_vertex_t* transformed_vertices = 0;
+static ivec4_t* clip_positions = 0;
 
 static int32_t num_faces_total = 0;
-static triangle_t* sorted_triangles = 0;
+static triangle_t* scene_triangles = 0;
+
+// Draw order: Depth key + face index for all faces that survived the
+// visibility pass, and scratch space for sorting
+static depth_key_t* draw_order = 0;
+static depth_key_t* draw_order_tmp = 0;
+static int32_t draw_order_count = 0;
+
+// Per face visibility (bit 0: this frame, bit 1: last frame, bit 2: the
+// face is ordered by its models BSP tree, not by key) and depth key, and the
+// faces the visibility pass hands to the sorter
+#define FACE_VISIBLE 1
+#define FACE_WAS_VISIBLE 2
+#define FACE_BSP 4
+static uint8_t* face_flags = 0;
+static uint32_t* face_keys = 0;
+static int32_t* sort_input = 0;
+
+// Whether draw_order holds last frames visible faces in order, so that the
+// ones sorted by key can be repaired instead of sorted from scratch
+static int32_t draw_order_valid = 0;
+
+// Node order scratch space for BSP traversal
+static int32_t* bsp_order = 0;
+static int32_t bsp_order_size = 0;
+static sort_stats_t sort_stats;
+static stage_times_t stage_times;
+
+// Per model counters of the current frame. model_counts points at the ones
+// of the model being worked on, and is 0 while doing anything else.
+#ifdef RENDER_STATS
+static render_stats_t render_stats;
+static render_counts_t* model_counts = 0;
+
+#define RENDER_COUNT_MODEL(m) (model_counts = &render_stats.models[imin((m), RENDER_STATS_MAX_MODELS - 1)])
+#define RENDER_COUNT_END() (model_counts = 0)
+#define RENDER_COUNT(field, n) do { if(model_counts != 0) { model_counts->field += (n); } } while(0)
+#define RENDER_COUNT_SPAN(first, last) do { if(model_counts != 0 && (first) <= (last)) { model_counts->spans++; model_counts->pixels += (last) - (first) + 1; } } while(0)
+#else
+#define RENDER_COUNT_MODEL(m)
+#define RENDER_COUNT_END()
+#define RENDER_COUNT(field, n)
+#define RENDER_COUNT_SPAN(first, last)
+#endif
+
+// Incremental repair gives up after shifting this many elements per face
+// and a full radix sort is done instead. Past that point the radix sort is
+// faster. After giving up, skip the repair attempt for a few frames, since
+// the camera is probably still turning quickly.
+#define SORT_REPAIR_BUDGET 4
+#define SORT_REPAIR_BACKOFF 8
+static int32_t sort_repair_backoff = 0;
+
+// Vertex transform jobs: Per model mvp and where its vertices go, split into
+// pieces of TRANSFORM_GRAIN vertices
+#define TRANSFORM_GRAIN 2048
+
+typedef struct {
+    imat4x4_t mvp;
+    const ivec3_t* vertices;
+    int32_t offset;
+} transform_job_t;
+
+static transform_job_t* transform_jobs = 0;
+static int32_t transform_jobs_size = 0;
+
+// Floor at the bottom, ceiling at the top of the arena
+static const int32_t floor_heights[] = { INT_FIXED(0), INT_FIXED(200) };
+
+// v + d * n, wrapping the same way as adding d n times
+static inline int32_t istep(int32_t v, int32_t d, int32_t n) {
+    return (int32_t)((uint32_t)v + (uint32_t)d * (uint32_t)n);
+}
 
-// Triangle drawer
-static inline void rasterize_triangle(uint8_t* image, transformed_triangle_t* tri, uint8_t* shadetex) {
+// Triangle drawer, for the scanlines in [row_start, row_end). Edges are
+// stepped past the rows above in one go, so every row comes out the same as
+// when drawing the whole triangle.
+static inline void rasterize_triangle(uint8_t* image, transformed_triangle_t* tri, uint8_t* shadetex, int32_t row_start, int32_t row_end) {
     // Local vertex sorting
     transformed_vertex_t upperVertex;
     transformed_vertex_t centerVertex;
@@ -82,6 +162,7 @@ static inline void rasterize_triangle(uint8_t* image, transformed_triangle_t* tr
     if(lowerDiff == 0 && upperDiff == 0) {
         return;
     }
+    RENDER_COUNT(triangles, 1);
     
     // Calculate whole-triangle deltas
     int32_t temp = idiv(centerVertex.p.y - upperVertex.p.y,lowerVertex.p.y - upperVertex.p.y);
@@ -144,11 +225,21 @@ static inline void rasterize_triangle(uint8_t* image, transformed_triangle_t* tr
         leftVd = idiv(leftV - lowerVertex.vw, lowerDiff);
     }
 
+    scanline = FIXED_INT_ROUND(upperVertex.p.y);
+    scanlineMax = imin(imin(FIXED_INT_ROUND(centerVertex.p.y), SCREEN_HEIGHT - 1), row_end);
+    if(scanline < row_start && scanline < scanlineMax) {
+        int32_t skip = imin(row_start, scanlineMax) - scanline;
+        leftX = istep(leftX, leftXd, skip);
+        rightX = istep(rightX, rightXd, skip);
+        leftU = istep(leftU, leftUd, skip);
+        leftV = istep(leftV, leftVd, skip);
+        scanline += skip;
+    }
+
     U = leftU;
     V = leftV;
     
-    scanlineMax = imin(FIXED_INT_ROUND(centerVertex.p.y), SCREEN_HEIGHT - 1);
-    for(scanline = FIXED_INT_ROUND(upperVertex.p.y); scanline < scanlineMax; scanline++ ) {
+    for(; scanline < scanlineMax; scanline++ ) {
         if(scanline >= 0) {
             int32_t xMax = imin(FIXED_INT_ROUND(rightX), SCREEN_WIDTH - 1);
             if(xMax >= 0) {
@@ -160,6 +251,7 @@ static inline void rasterize_triangle(uint8_t* image, transformed_triangle_t* tr
                     V += VdX;
                     x++;
                 }
+                RENDER_COUNT_SPAN(x, xMax);
                 
                 while(x <= xMax) {
                     image[x+offset] = RGB322SCALE(shadetex[TEX_TRANSFORM(U, V)], tri->shade);
@@ -204,12 +296,21 @@ static inline void rasterize_triangle(uint8_t* image, transformed_triangle_t* tr
 lower_half_render:
 
     // Lower triangle half
-    scanlineMax = imin(FIXED_INT_ROUND(lowerVertex.p.y), SCREEN_HEIGHT - 1);
+    scanline = FIXED_INT_ROUND(centerVertex.p.y);
+    scanlineMax = imin(imin(FIXED_INT_ROUND(lowerVertex.p.y), SCREEN_HEIGHT - 1), row_end);
+    if(scanline < row_start && scanline < scanlineMax) {
+        int32_t skip = imin(row_start, scanlineMax) - scanline;
+        leftX = istep(leftX, leftXd, skip);
+        rightX = istep(rightX, rightXd, skip);
+        leftU = istep(leftU, leftUd, skip);
+        leftV = istep(leftV, leftVd, skip);
+        scanline += skip;
+    }
         
     U = leftU;
     V = leftV;
 
-    for(scanline = FIXED_INT_ROUND(centerVertex.p.y); scanline < scanlineMax; scanline++ ) {
+    for(; scanline < scanlineMax; scanline++ ) {
         if(scanline >= 0) {
             int32_t xMax = imin(FIXED_INT_ROUND(rightX), SCREEN_WIDTH - 1);
             if(xMax >= 0) {
@@ -221,6 +322,7 @@ lower_half_render:
                     V += VdX;
                     x++;
                 }
+                RENDER_COUNT_SPAN(x, xMax);
                 while(x <= xMax) {
                     image[x+offset] = RGB322SCALE(shadetex[TEX_TRANSFORM(U, V)], tri->shade);
                     x++;
@@ -239,69 +341,225 @@ lower_half_render:
     }
 }
 
-// Depth sorting comparator for comparing by average (sum) depth
-static int triAvgDepthCompare(const void *p1, const void *p2) {
-    triangle_t* t1 = (triangle_t*)p1;
-    triangle_t* t2 = (triangle_t*)p2;
-    return(
-        transformed_vertices[t2->v[0]].p.z +
-        transformed_vertices[t2->v[1]].p.z +
-        transformed_vertices[t2->v[2]].p.z -
-        transformed_vertices[t1->v[0]].p.z -
-        transformed_vertices[t1->v[1]].p.z -
-        transformed_vertices[t1->v[2]].p.z
-    );
-}
-
-// Depth sorting comparator for comparing by miminal depth
-static int triClosestDepthCompare(const void *p1, const void *p2) {
-    triangle_t* t1 = (triangle_t*)p1;
-    triangle_t* t2 = (triangle_t*)p2;
-    int d1 = imin(imin(
-            transformed_vertices[t1->v[0]].p.z,
-            transformed_vertices[t1->v[1]].p.z
-        ),
-        transformed_vertices[t1->v[2]].p.z
-    );
-    int d2 = imin(imin(
-            transformed_vertices[t2->v[0]].p.z,
-            transformed_vertices[t2->v[1]].p.z
-        ),
-        transformed_vertices[t2->v[2]].p.z
-    );
-    return(d1 - d2);
+// Sort key for ordering by average (sum) depth, far to near. Uses the clip space
+// depth, which is valid for clipped vertices as well.
+static inline uint32_t triAvgDepthKey(const triangle_t* t) {
+    int64_t depth =
+        (int64_t)transformed_vertices[t->v[0]].cp.z +
+        (int64_t)transformed_vertices[t->v[1]].cp.z +
+        (int64_t)transformed_vertices[t->v[2]].cp.z;
+    depth = depth > INT32_MAX ? INT32_MAX : depth;
+    depth = depth < INT32_MIN ? INT32_MIN : depth;
+    return (uint32_t)((int64_t)INT32_MAX - depth);
+}
+
+// Backface test. Viewport positions are only valid if no vertex got clipped
+// against near / far, otherwise use the sign of the determinant of the clip
+// space (x, y, w) rows, which is the same test without the perspective divide
+static inline int32_t triFrontFacing(const transformed_vertex_t* a, const transformed_vertex_t* b, const transformed_vertex_t* c) {
+    if(((a->clip | b->clip | c->clip) & 0xFF) == 0) {
+        return imul(b->p.x - a->p.x, c->p.y - a->p.y) - imul(c->p.x - a->p.x, b->p.y - a->p.y) >= 0;
+    }
+
+    double det =
+        (double)a->cp.x * ((double)b->cp.y * c->cp.w - (double)c->cp.y * b->cp.w) -
+        (double)a->cp.y * ((double)b->cp.x * c->cp.w - (double)c->cp.x * b->cp.w) +
+        (double)a->cp.w * ((double)b->cp.x * c->cp.y - (double)c->cp.x * b->cp.y);
+    return det >= 0.0;
+}
+
+// Visibility pass: Drop faces of inactive models, backfaces and faces that
+// clip_rasterize would reject anyway. Updates face_flags and face_keys for
+// all faces. If collect_new is set, faces sorted by key that were not
+// visible last frame are written to sort_input. Returns the number of faces
+// in sort_input, and counts all visible faces and those sorted by key.
+static int32_t visibility_pass(model_t* models, int32_t num_models, int32_t collect_new, int32_t* num_visible, int32_t* num_sorted) {
+    int32_t num_input = 0;
+    int32_t visible = 0;
+    int32_t sorted = 0;
+    int32_t face_offset = 0;
+    for(int32_t m = 0; m < num_models; m++) {
+        int32_t face_end = face_offset + models[m].num_faces;
+        uint8_t bsp = models[m].bsp != 0 ? FACE_BSP : 0;
+        int32_t model_visible = visible;
+        sort_stats.faces_total += models[m].num_faces;
+        RENDER_COUNT_MODEL(m);
+
+        if(models[m].draw == 0) {
+            for(int32_t i = face_offset; i < face_end; i++) {
+                face_flags[i] = (face_flags[i] << 1) & FACE_WAS_VISIBLE;
+            }
+            sort_stats.faces_inactive += models[m].num_faces;
+            RENDER_COUNT(skipped, 1);
+            face_offset = face_end;
+            continue;
+        }
+
+        for(int32_t i = face_offset; i < face_end; i++) {
+            uint8_t flags = ((face_flags[i] << 1) & FACE_WAS_VISIBLE) | bsp;
+            face_flags[i] = flags;
+
+            const transformed_vertex_t* a = &transformed_vertices[scene_triangles[i].v[0]];
+            const transformed_vertex_t* b = &transformed_vertices[scene_triangles[i].v[1]];
+            const transformed_vertex_t* c = &transformed_vertices[scene_triangles[i].v[2]];
+
+            // Same rule as in clip_rasterize
+            uint32_t clip = a->clip + b->clip + c->clip;
+            if(clip + ((clip & 0xFF) << 8) >= 0x300) {
+                sort_stats.faces_clipped++;
+                RENDER_COUNT(faces_clipped, 1);
+                continue;
+            }
+
+            if(!triFrontFacing(a, b, c)) {
+                sort_stats.faces_backface++;
+                RENDER_COUNT(faces_backface, 1);
+                continue;
+            }
+
+            face_flags[i] = flags | FACE_VISIBLE;
+            face_keys[i] = triAvgDepthKey(&scene_triangles[i]);
+            if(collect_new && !(flags & (FACE_WAS_VISIBLE | FACE_BSP))) {
+                sort_input[num_input++] = i;
+            }
+            visible++;
+        }
+        if(!bsp) {
+            sorted += visible - model_visible;
+        }
+        face_offset = face_end;
+    }
+    RENDER_COUNT_END();
+
+    sort_stats.faces_sorted += visible;
+    *num_visible = visible;
+    *num_sorted = sorted;
+    return num_input;
+}
+
+// Fill draw_order with the visible faces of models without a BSP tree, in
+// face order, one run per model (models past the run limit share the last
+// run), for depth_sort_runs
+static int32_t gather_sorted_runs(model_t* models, int32_t num_models, int32_t* run_starts) {
+    int32_t num_runs = 0;
+    int32_t count = 0;
+    int32_t face_offset = 0;
+    for(int32_t m = 0; m < num_models; m++) {
+        int32_t face_end = face_offset + models[m].num_faces;
+        if(models[m].bsp == 0) {
+            if(num_runs < DEPTH_SORT_MAX_RUNS) {
+                run_starts[num_runs++] = count;
+            }
+            for(int32_t i = face_offset; i < face_end; i++) {
+                if(face_flags[i] & FACE_VISIBLE) {
+                    draw_order[count].key = face_keys[i];
+                    draw_order[count].face = i;
+                    count++;
+                }
+            }
+        }
+        face_offset = face_end;
+    }
+    run_starts[num_runs] = count;
+    return num_runs;
+}
+
+// Append the visible faces of models with a BSP tree to the num_sorted
+// faces already in draw_order, back to front, one run per model after the
+// run of sorted faces (models past the run limit share the last run). Keys
+// along a BSP order go up and down, so every face gets the largest key up
+// to it in its run instead: That keeps the tree order within a model, and
+// every run is sorted, so runs merge by key like any others.
+static int32_t gather_bsp_runs(model_t* models, int32_t num_models, imat4x4_t camera, int32_t num_sorted, int32_t* run_starts) {
+    int32_t num_runs = 1;
+    int32_t count = num_sorted;
+    int32_t face_offset = 0;
+    uint32_t key = 0;
+    run_starts[0] = 0;
+    for(int32_t m = 0; m < num_models; m++) {
+        if(models[m].bsp != 0 && models[m].draw != 0) {
+            if(num_runs < DEPTH_SORT_MAX_RUNS) {
+                run_starts[num_runs++] = count;
+                key = 0;
+            }
+
+            // Object space eye position: modelview and camera are rigid
+            imat4x4_t inverse = imat4x4affineinverse(imat4x4mul(camera, models[m].modelview));
+            ivec3_t eye = ivec3(inverse.m[12], inverse.m[13], inverse.m[14]);
+
+            int32_t num_nodes = bsp_traverse(models[m].bsp, eye, bsp_order);
+            for(int32_t n = 0; n < num_nodes; n++) {
+                const bsp_node_t* node = &models[m].bsp->nodes[bsp_order[n]];
+                int32_t node_end = face_offset + node->first_face + node->num_faces;
+                for(int32_t i = face_offset + node->first_face; i < node_end; i++) {
+                    if(face_flags[i] & FACE_VISIBLE) {
+                        key = face_keys[i] > key ? face_keys[i] : key;
+                        draw_order[count].key = key;
+                        draw_order[count].face = i;
+                        count++;
+                    }
+                }
+            }
+        }
+        face_offset += models[m].num_faces;
+    }
+    run_starts[num_runs] = count;
+    return num_runs;
 }
 
 // Set up storage for geometry and copy face data
 void prepare_geometry_storage(model_t* models, int32_t num_models) {
-    // Count vertices / faces
+    // Count vertices / faces / BSP nodes
     int32_t vert_count = 0;
     int32_t face_count = 0;
+    int32_t node_count = 0;
     for(int32_t m = 0; m < num_models; m++) {
         vert_count += models[m].num_vertices;
         face_count += models[m].num_faces;
+        if(models[m].bsp != 0) {
+            node_count = imax(node_count, models[m].bsp->num_nodes);
+        }
+    }
+
+    if(num_models > transform_jobs_size) {
+        transform_jobs_size = num_models;
+        transform_jobs = (transform_job_t*)realloc(transform_jobs, sizeof(transform_job_t) * transform_jobs_size);
+    }
+
+    if(node_count > bsp_order_size) {
+        bsp_order_size = node_count;
+        bsp_order = (int32_t*)realloc(bsp_order, sizeof(int32_t) * bsp_order_size);
     }
 
     // (Re)alloc storage
     if(vert_count > num_vertices_total || transformed_vertices == 0) {
         num_vertices_total = vert_count;
         transformed_vertices = (transformed_vertex_t*)realloc(transformed_vertices, sizeof(transformed_vertex_t) * num_vertices_total);
+        clip_positions = (ivec4_t*)realloc(clip_positions, sizeof(ivec4_t) * num_vertices_total);
     }
 
-    if (face_count > num_faces_total || sorted_triangles == 0) {
+    if (face_count > num_faces_total || scene_triangles == 0) {
         num_faces_total = face_count;
-        sorted_triangles = (triangle_t*)realloc(sorted_triangles, sizeof(triangle_t) * num_faces_total);
+        scene_triangles = (triangle_t*)realloc(scene_triangles, sizeof(triangle_t) * num_faces_total);
+        draw_order = (depth_key_t*)realloc(draw_order, sizeof(depth_key_t) * num_faces_total);
+        draw_order_tmp = (depth_key_t*)realloc(draw_order_tmp, sizeof(depth_key_t) * num_faces_total);
+        face_flags = (uint8_t*)realloc(face_flags, sizeof(uint8_t) * num_faces_total);
+        face_keys = (uint32_t*)realloc(face_keys, sizeof(uint32_t) * num_faces_total);
+        sort_input = (int32_t*)realloc(sort_input, sizeof(int32_t) * num_faces_total);
     }
+    memset(face_flags, 0, sizeof(uint8_t) * face_count);
 
     // Copy face data
     int32_t face_offset = 0;
     int32_t vert_offset = 0;
     for(int32_t m = 0; m < num_models; m++) {
-        memcpy(&sorted_triangles[face_offset], models[m].faces, sizeof(triangle_t) * models[m].num_faces);
-        for(int i = face_offset; i < face_offset + models[m].num_faces; i++) {
-            sorted_triangles[i].model_id = m;
+        for(int i = 0; i < models[m].num_faces; i++) {
+            triangle_t* tri = &scene_triangles[face_offset + i];
+            memcpy(tri->v, models[m].faces[i].v, sizeof(tri->v));
+            tri->model_id = m;
+            tri->texture = models[m].textures != 0 ? models[m].textures[tri->v[7]] : 0;
             for(int j = 0; j < 3; j++) {
-                sorted_triangles[i].v[j] += vert_offset;
+                tri->v[j] += vert_offset;
             }
         }
         vert_offset +=  models[m].num_vertices;
@@ -310,12 +568,109 @@ void prepare_geometry_storage(model_t* models, int32_t num_models) {
 
     num_faces_total = face_count;
     num_vertices_total = vert_count;
+
+    // New scene, old order is meaningless
+    draw_order_count = 0;
+    draw_order_valid = 0;
+    sort_repair_backoff = 0;
+}
+
+// Force a full sort next frame, e.g. on camera cuts
+void invalidate_draw_order() {
+    draw_order_valid = 0;
 }
 
-// Cleanup
+// Sort timing statistics, accumulated since last reset
+void get_sort_stats(sort_stats_t* stats) {
+    *stats = sort_stats;
+}
+
+void reset_sort_stats() {
+    memset(&sort_stats, 0, sizeof(sort_stats_t));
+}
+
+// Stage timings of the last frame
+void get_stage_times(stage_times_t* times) {
+    *times = stage_times;
+}
+
+void get_render_stats(render_stats_t* stats) {
+#ifdef RENDER_STATS
+    *stats = render_stats;
+#else
+    memset(stats, 0, sizeof(render_stats_t));
+#endif
+}
+
+#ifdef RENDER_STATS
+// Vertex clip outcomes of every active model, once the transform is done
+static void count_vertices(model_t* models, int32_t num_models) {
+    int32_t vert_offset = 0;
+    for(int32_t m = 0; m < num_models; m++) {
+        if(models[m].draw != 0) {
+            RENDER_COUNT_MODEL(m);
+            for(int32_t i = vert_offset; i < vert_offset + models[m].num_vertices; i++) {
+                model_counts->vertices++;
+                model_counts->vertices_near += transformed_vertices[i].clip == 1;
+                model_counts->vertices_far += transformed_vertices[i].clip == 3;
+                model_counts->vertices_xy += transformed_vertices[i].clip == 0x100;
+            }
+        }
+        vert_offset += models[m].num_vertices;
+    }
+    RENDER_COUNT_END();
+}
+
+// Frame totals from the per model counts
+static void sum_render_counts() {
+    render_counts_t* sum = &render_stats.frame;
+    for(int32_t m = 0; m < render_stats.num_models; m++) {
+        const render_counts_t* counts = &render_stats.models[m];
+        sum->vertices += counts->vertices;
+        sum->vertices_near += counts->vertices_near;
+        sum->vertices_far += counts->vertices_far;
+        sum->vertices_xy += counts->vertices_xy;
+        sum->skipped += counts->skipped;
+        sum->faces_backface += counts->faces_backface;
+        sum->faces_clipped += counts->faces_clipped;
+        sum->triangles_clipped_one += counts->triangles_clipped_one;
+        sum->triangles_clipped_two += counts->triangles_clipped_two;
+        sum->triangles += counts->triangles;
+        sum->spans += counts->spans;
+        sum->pixels += counts->pixels;
+    }
+}
+#endif
+
+// Cleanup. Storage can be prepared again afterwards.
 void free_geometry_storage() {
     free(transformed_vertices);
-    free(sorted_triangles);
+    free(clip_positions);
+    free(scene_triangles);
+    free(draw_order);
+    free(draw_order_tmp);
+    free(face_flags);
+    free(face_keys);
+    free(sort_input);
+    free(bsp_order);
+    free(transform_jobs);
+
+    transformed_vertices = 0;
+    clip_positions = 0;
+    scene_triangles = 0;
+    draw_order = 0;
+    draw_order_tmp = 0;
+    face_flags = 0;
+    face_keys = 0;
+    sort_input = 0;
+    bsp_order = 0;
+    transform_jobs = 0;
+    num_vertices_total = 0;
+    num_faces_total = 0;
+    bsp_order_size = 0;
+    transform_jobs_size = 0;
+    draw_order_count = 0;
+    draw_order_valid = 0;
 }
 
 // Clip a line against znear
@@ -335,21 +690,22 @@ ivec4_t clip_line(ivec4_t a, ivec4_t b) {
 void set_shading(uint8_t* framebuffer, model_t* models, int32_t tri_idx, transformed_triangle_t* tri) {
     // Set up tex coords
     for(int ver = 0; ver < 3; ver++) {        
-        tri->v[ver].uw = models[sorted_triangles[tri_idx].model_id].texcoords[sorted_triangles[tri_idx].v[ver + 4]].u;
-        tri->v[ver].vw = models[sorted_triangles[tri_idx].model_id].texcoords[sorted_triangles[tri_idx].v[ver + 4]].v;           
+        tri->v[ver].uw = models[scene_triangles[tri_idx].model_id].texcoords[scene_triangles[tri_idx].v[ver + 4]].u;
+        tri->v[ver].vw = models[scene_triangles[tri_idx].model_id].texcoords[scene_triangles[tri_idx].v[ver + 4]].v;           
     }
 
     // Shade (Hemi lighting, per face)
-    ivec3_t light_dir = ivec3norm(ivec3(FLOAT_FIXED(0.5), FLOAT_FIXED(1.0), FLOAT_FIXED(0.5)));
+    ivec3_t light_dir = ivec3normfast(ivec3(FLOAT_FIXED(0.5), FLOAT_FIXED(1.0), FLOAT_FIXED(0.5)));
     // TODO rotate
-    ivec3_t norm = models[sorted_triangles[tri_idx].model_id].normals[sorted_triangles[tri_idx].v[3]];
-    ivec4_t norm_tranformed = imat4x4transform( models[sorted_triangles[tri_idx].model_id].modelview, ivec4(norm.x, norm.y, norm.z, 0));
-    ivec3_t norm_proper = ivec3norm(ivec3(norm_tranformed.x, norm_tranformed.y, norm_tranformed.z));
+    ivec3_t norm = models[scene_triangles[tri_idx].model_id].normals[scene_triangles[tri_idx].v[3]];
+    ivec4_t norm_tranformed = imat4x4transform( models[scene_triangles[tri_idx].model_id].modelview, ivec4(norm.x, norm.y, norm.z, 0));
+    ivec3_t norm_proper = ivec3normfast(ivec3(norm_tranformed.x, norm_tranformed.y, norm_tranformed.z));
     tri->shade = imin(FLOAT_FIXED(1.0), FLOAT_FIXED(0.1) + imax(0, ivec3dot(norm_proper, light_dir)));
 }
 
-// Draw a single triangle, view clipping against near/far if need be
-void clip_rasterize(uint8_t* framebuffer, model_t* models, int32_t tri_idx, transformed_triangle_t tri, uint8_t* texture_override) {
+// Draw the rows [row_start, row_end) of a single triangle, view clipping
+// against near/far if need be
+static void clip_rasterize_rows(uint8_t* framebuffer, model_t* models, int32_t tri_idx, transformed_triangle_t tri, uint8_t* texture_override, int32_t row_start, int32_t row_end) {
     // Check what needs clipping
     uint32_t clip = 0;
 
@@ -388,6 +744,7 @@ void clip_rasterize(uint8_t* framebuffer, model_t* models, int32_t tri_idx, tran
 
     // One vertex out -> quad, so copy tri 
     if(clip == 1) {
+        RENDER_COUNT(triangles_clipped_two, 1);
         ivec4_t transform_pos = clip_line(tri.v[clip_a].cp, tri.v[clip_b].cp);
         if(transform_pos.w == 0) {
             return;
@@ -402,10 +759,10 @@ void clip_rasterize(uint8_t* framebuffer, model_t* models, int32_t tri_idx, tran
         // Additional draw for the bonus triangle
         if(texture_override == 0) {
             set_shading(framebuffer, models, tri_idx, &tri);
-            rasterize_triangle(framebuffer, &tri, sorted_triangles[tri_idx].texture); 
+            rasterize_triangle(framebuffer, &tri, scene_triangles[tri_idx].texture, row_start, row_end);
         }
         else {
-            rasterize_triangle(framebuffer, &tri, texture_override); 
+            rasterize_triangle(framebuffer, &tri, texture_override, row_start, row_end);
         }
         
         // Set up final triangle
@@ -424,6 +781,7 @@ void clip_rasterize(uint8_t* framebuffer, model_t* models, int32_t tri_idx, tran
 
     // Two vertices out -> tri again
     if (clip == 2) {   
+        RENDER_COUNT(triangles_clipped_one, 1);
         ivec4_t transform_pos = clip_line(tri.v[clip_a].cp, tri.v[clip_c].cp);
         transform_pos = clip_line(tri.v[clip_a].cp, tri.v[clip_c].cp);
         if(transform_pos.w == 0) {
@@ -450,187 +808,554 @@ void clip_rasterize(uint8_t* framebuffer, model_t* models, int32_t tri_idx, tran
 
     if(texture_override == 0) {
         set_shading(framebuffer, models, tri_idx, &tri);
-        rasterize_triangle(framebuffer, &tri, sorted_triangles[tri_idx].texture);
+        rasterize_triangle(framebuffer, &tri, scene_triangles[tri_idx].texture, row_start, row_end);
     }
     else {
-        rasterize_triangle(framebuffer, &tri, texture_override); 
+        rasterize_triangle(framebuffer, &tri, texture_override, row_start, row_end);
     }
 }
 
-// Draw a xz-plane
-void draw_floor(uint8_t* framebuffer, imat4x4_t camera, imat4x4_t projection, uint8_t* texture, int32_t height) {
-    imat4x4_t mvp = imat4x4mul(projection, camera);
+// Draw a single triangle, view clipping against near/far if need be
+void clip_rasterize(uint8_t* framebuffer, model_t* models, int32_t tri_idx, transformed_triangle_t tri, uint8_t* texture_override) {
+    clip_rasterize_rows(framebuffer, models, tri_idx, tri, texture_override, 0, SCREEN_HEIGHT);
+}
+
+// Raster jobs: Every band of rows draws all faces in draw order, clipped to
+// its rows, so the painters order holds within every band and the frame
+// comes out the same as drawn on one thread. Faces entirely above or below
+// a band are skipped before any setup. With RENDER_STATS, which counts into
+// one set of per model counters, the whole screen is one band.
+#define RASTER_ROW_GRAIN 16
 
-    // Figure out how far above the plane we are so we can clip agressively
-    int harsh_clip = 1;
-    ivec4_t pos = imat4x4transform(camera, ivec4(0, height, 0, INT_FIXED(1)));
-    if(iabs(pos.y) > INT_FIXED(20)) {
-        harsh_clip = 3;
+typedef struct {
+    uint8_t* framebuffer;
+    model_t* models;
+} raster_job_t;
+
+static void raster_task(void* data, int32_t row_start, int32_t row_end) {
+    raster_job_t* job = (raster_job_t*)data;
+    transformed_triangle_t tri;
+    for(int32_t i = 0; i < draw_order_count; i++) {
+        int32_t face = draw_order[i].face;
+        const transformed_vertex_t* a = &transformed_vertices[scene_triangles[face].v[0]];
+        const transformed_vertex_t* b = &transformed_vertices[scene_triangles[face].v[1]];
+        const transformed_vertex_t* c = &transformed_vertices[scene_triangles[face].v[2]];
+
+        // Rows drawn are [round(top), round(bottom)). Screen positions are
+        // only valid if no vertex got clipped against near / far.
+        if(((a->clip | b->clip | c->clip) & 0xFF) == 0) {
+            int32_t top = FIXED_INT_ROUND(imin(imin(a->p.y, b->p.y), c->p.y));
+            int32_t bottom = FIXED_INT_ROUND(imax(imax(a->p.y, b->p.y), c->p.y));
+            if(bottom <= row_start || top >= row_end) {
+                continue;
+            }
+        }
+
+        // Set up triangle
+        tri.v[0] = *a;
+        tri.v[1] = *b;
+        tri.v[2] = *c;
+
+        RENDER_COUNT_MODEL(scene_triangles[face].model_id);
+        clip_rasterize_rows(job->framebuffer, job->models, face, tri, 0, row_start, row_end);
     }
-    
-    for(int x = -32; x <= 32; x++) {
-        for(int z = -32; z <= 32; z++) {
-            // Skip if outside arena
-            if(x * x + z * z > 32 * 32) {
+}
+
+// Draw one textured triangle on its own, clipping like the renderer does
+void draw_triangle(uint8_t* framebuffer, const transformed_triangle_t* tri, uint8_t* texture) {
+    clip_rasterize(framebuffer, 0, 0, *tri, texture);
+}
+
+#ifndef FLOOR_TRIANGLES
+// Draw xz-planes as horizontal spans. Screen to plane is a homography, so
+// invert the planes part of the mvp once, then walk every row doing the
+// perspective divide every FLOOR_SPAN_STEP pixels, stepping texcoords linearly
+// in between. One texture tile per 8x8 cell, round arena of 32 cells.
+#define FLOOR_SPAN_STEP 16
+#define FLOOR_ARENA_CELLS 32
+
+// Texcoords get clamped to this many cells before they become integers.
+// Far beyond the arena, and small enough that stepping a span and squaring
+// cells can't overflow.
+#define FLOOR_TEXCOORD_LIMIT (256 * 4096)
+#define FLOOR_ROW_GRAIN 8
+#define FLOOR_MAX_PLANES 4
+
+// A plane ready for drawing rows: Screen to plane mapping, per pixel step
+typedef struct {
+    double inv[3][3];
+    double step[3];
+} floor_plane_t;
+
+typedef struct {
+    uint8_t* framebuffer;
+    uint8_t* texture;
+    int32_t num_planes;
+    floor_plane_t planes[FLOOR_MAX_PLANES];
+} floor_job_t;
+
+// Returns 0 if the plane is seen exactly edge-on
+static int32_t floor_plane_setup(floor_plane_t* plane, imat4x4_t mvp, int32_t height) {
+    // (x, y, w) in clip space from (x, z, 1) on the plane
+    double h = height / 4096.0;
+    double m[3][3] = {
+        { mvp.m[0] / 4096.0, mvp.m[8] / 4096.0, (mvp.m[4] * h + mvp.m[12]) / 4096.0 },
+        { mvp.m[1] / 4096.0, mvp.m[9] / 4096.0, (mvp.m[5] * h + mvp.m[13]) / 4096.0 },
+        { mvp.m[3] / 4096.0, mvp.m[11] / 4096.0, (mvp.m[7] * h + mvp.m[15]) / 4096.0 },
+    };
+
+    // Invert: (x, z, 1) / w from (ndc x, ndc y, 1)
+    double det =
+        m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+        m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+        m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    if(det == 0.0) {
+        return 0;
+    }
+    double inv[3][3] = {
+        { (m[1][1] * m[2][2] - m[1][2] * m[2][1]) / det, (m[0][2] * m[2][1] - m[0][1] * m[2][2]) / det, (m[0][1] * m[1][2] - m[0][2] * m[1][1]) / det },
+        { (m[1][2] * m[2][0] - m[1][0] * m[2][2]) / det, (m[0][0] * m[2][2] - m[0][2] * m[2][0]) / det, (m[0][2] * m[1][0] - m[0][0] * m[1][2]) / det },
+        { (m[1][0] * m[2][1] - m[1][1] * m[2][0]) / det, (m[0][1] * m[2][0] - m[0][0] * m[2][1]) / det, (m[0][0] * m[1][1] - m[0][1] * m[1][0]) / det },
+    };
+
+    // Per pixel step along a row
+    memcpy(plane->inv, inv, sizeof(inv));
+    for(int i = 0; i < 3; i++) {
+        plane->step[i] = inv[i][0] * (2.0 / SCREEN_WIDTH);
+    }
+    return 1;
+}
+
+// Texcoord (in tiles) to fixed point, clamped. Near the horizon 1 / w goes
+// to zero and texcoords blow up (or turn into NaN), which don't fit an int.
+static inline int32_t floor_texcoord(double coord) {
+    double fixed = coord * 4096.0;
+    if(!(fixed > -FLOOR_TEXCOORD_LIMIT)) {
+        return -FLOOR_TEXCOORD_LIMIT;
+    }
+    if(!(fixed < FLOOR_TEXCOORD_LIMIT)) {
+        return FLOOR_TEXCOORD_LIMIT;
+    }
+    return (int32_t)fixed;
+}
+
+// Rows [y_start, y_end) of a plane
+static void floor_plane_rows(const floor_plane_t* plane, uint8_t* framebuffer, uint8_t* texture, int32_t y_start, int32_t y_end) {
+    const double (*inv)[3] = plane->inv;
+    const double* step = plane->step;
+
+    // Smallest 1 / w we still draw
+    double min_rw = 4096.0 / ZFAR;
+
+    for(int32_t y = y_start; y < y_end; y++) {
+        double ndc_y = 2.0 * y / SCREEN_HEIGHT - 1.0;
+        double row[3];
+        for(int i = 0; i < 3; i++) {
+            row[i] = inv[i][0] * -1.0 + inv[i][1] * ndc_y + inv[i][2];
+        }
+
+        // Part of the row where the plane is in front of the camera and
+        // not too far away. 1 / w is linear along the row.
+        int32_t x_start = 0;
+        int32_t x_end = SCREEN_WIDTH - 1;
+        if(step[2] == 0.0) {
+            if(row[2] < min_rw) {
                 continue;
             }
-            
-            // Floor triangle 1
-            transformed_triangle_t floor_tri;
-            floor_tri.shade = INT_FIXED(1);
-            floor_tri.v[0].cp = imat4x4transform(mvp, ivec4(INT_FIXED(8 * x),       height, INT_FIXED(8 * z),       INT_FIXED(1)));
-            floor_tri.v[2].cp = imat4x4transform(mvp, ivec4(INT_FIXED(8 * (x + 1)), height, INT_FIXED(8 * z),       INT_FIXED(1)));
-            floor_tri.v[1].cp = imat4x4transform(mvp, ivec4(INT_FIXED(8 * x),       height, INT_FIXED(8 * (z + 1)), INT_FIXED(1)));
-            
-            floor_tri.v[0].uw = INT_FIXED(0);
-            floor_tri.v[0].vw = INT_FIXED(0);
-            
-            floor_tri.v[1].uw = INT_FIXED(1);
-            floor_tri.v[1].vw = INT_FIXED(0);
-            
-            floor_tri.v[2].uw = INT_FIXED(0);
-            floor_tri.v[2].vw = INT_FIXED(1);
-            
-            // Clip?
-            for(int i = 0; i < 3; i++) {
-                if(floor_tri.v[i].cp.z <= 0) {
-                    floor_tri.v[i].clip = harsh_clip;
-                    continue;
-                }
-                else {
-                    if(floor_tri.v[i].cp.z >= floor_tri.v[i].cp.w) {
-                        floor_tri.v[i].clip = 3;
-                        continue;
-                    }
-                }
-                
-                // xy clip?
-                if(
-                    floor_tri.v[i].cp.x >= floor_tri.v[i].cp.w ||
-                    floor_tri.v[i].cp.y >= floor_tri.v[i].cp.w ||
-                    floor_tri.v[i].cp.x <= -floor_tri.v[i].cp.w ||
-                    floor_tri.v[i].cp.y <= -floor_tri.v[i].cp.w 
-                ) {
-                    floor_tri.v[i].clip = 0x100;
-                }
+        }
+        else {
+            // Clamped to the screen while still a double: With the row
+            // almost parallel to the horizon the bound is huge
+            double bound = (min_rw - row[2]) / step[2];
+            bound = bound < -1.0 ? -1.0 : (bound > SCREEN_WIDTH ? SCREEN_WIDTH : bound);
+            if(step[2] > 0.0) {
+                x_start = imax(x_start, (int32_t)ceil(bound));
+            }
+            else {
+                x_end = imin(x_end, (int32_t)floor(bound));
+            }
+        }
+        if(x_start > x_end) {
+            continue;
+        }
 
-                floor_tri.v[i].p = ivec3(
-                    VIEWPORT(floor_tri.v[i].cp.x, floor_tri.v[i].cp.w, SCREEN_WIDTH),
-                    VIEWPORT(floor_tri.v[i].cp.y, floor_tri.v[i].cp.w, SCREEN_HEIGHT),
-                    floor_tri.v[i].cp.z
-                );
-                floor_tri.v[i].clip = 0;
+        uint8_t* line = &framebuffer[y * SCREEN_WIDTH];
+        for(int32_t x = x_start; x <= x_end; x += FLOOR_SPAN_STEP) {
+            // Exact texcoords at both ends of the span (u along z, v along x,
+            // one tile per 8 units), linear in between
+            int32_t span = imin(FLOOR_SPAN_STEP, x_end - x + 1);
+            double rw_a = row[2] + step[2] * x;
+            double rw_b = row[2] + step[2] * (x + span);
+            int32_t u_a = floor_texcoord((row[1] + step[1] * x) / rw_a * (1.0 / 8.0));
+            int32_t v_a = floor_texcoord((row[0] + step[0] * x) / rw_a * (1.0 / 8.0));
+            int32_t u_b = floor_texcoord((row[1] + step[1] * (x + span)) / rw_b * (1.0 / 8.0));
+            int32_t v_b = floor_texcoord((row[0] + step[0] * (x + span)) / rw_b * (1.0 / 8.0));
+            int32_t ud = (u_b - u_a) / span;
+            int32_t vd = (v_b - v_a) / span;
+
+            int32_t u = u_a;
+            int32_t v = v_a;
+            for(int32_t i = x; i < x + span; i++) {
+                // Arena cutoff, per cell like the grid
+                int32_t cell_u = u >> 12;
+                int32_t cell_v = v >> 12;
+                if(cell_u * cell_u + cell_v * cell_v <= FLOOR_ARENA_CELLS * FLOOR_ARENA_CELLS) {
+                    line[i] = texture[TEX_TRANSFORM(u, v)];
+                }
+                u += ud;
+                v += vd;
             }
-            
-            // Pass to rasterizer
-            clip_rasterize(framebuffer, 0, 0, floor_tri, texture);
-            
-             // Floor triangle 2
-            floor_tri.shade = INT_FIXED(1);
-            floor_tri.v[0].cp = imat4x4transform(mvp, ivec4(INT_FIXED(8 * (x + 1)), height, INT_FIXED(8 * (z + 1)), INT_FIXED(1)));
-            floor_tri.v[2].cp = imat4x4transform(mvp, ivec4(INT_FIXED(8 * (x + 1)), height, INT_FIXED(8 * z),       INT_FIXED(1)));
-            floor_tri.v[1].cp = imat4x4transform(mvp, ivec4(INT_FIXED(8 * x),       height, INT_FIXED(8 * (z + 1)), INT_FIXED(1)));
-            
-            floor_tri.v[0].uw = INT_FIXED(1);
-            floor_tri.v[0].vw = INT_FIXED(1);
-            
-            floor_tri.v[1].uw = INT_FIXED(1);
-            floor_tri.v[1].vw = INT_FIXED(0);
-            
-            floor_tri.v[2].uw = INT_FIXED(0);
-            floor_tri.v[2].vw = INT_FIXED(1);
-            
+        }
+    }
+}
+
+static void floor_task(void* data, int32_t y_start, int32_t y_end) {
+    floor_job_t* job = (floor_job_t*)data;
+    for(int32_t i = 0; i < job->num_planes; i++) {
+        floor_plane_rows(&job->planes[i], job->framebuffer, job->texture, y_start, y_end);
+    }
+}
+
+// Draw xz-planes at the given heights, in bands of rows as jobs. Every band
+// does all planes, in order, so overlaps come out as if drawn one by one.
+void draw_floor(uint8_t* framebuffer, imat4x4_t camera, imat4x4_t projection, uint8_t* texture, const int32_t* heights, int32_t num_planes) {
+    imat4x4_t mvp = imat4x4mul(projection, camera);
+
+    floor_job_t job;
+    job.framebuffer = framebuffer;
+    job.texture = texture;
+    job.num_planes = 0;
+    for(int32_t i = 0; i < num_planes && i < FLOOR_MAX_PLANES; i++) {
+        job.num_planes += floor_plane_setup(&job.planes[job.num_planes], mvp, heights[i]);
+    }
+
+    job_parallel_for(floor_task, &job, SCREEN_HEIGHT, FLOOR_ROW_GRAIN);
+}
+#else
+// Draw a xz-plane as a grid of triangles. Grid corners are transformed once
+// per plane, then the grid is walked as a quad tree, dropping blocks that are
+// entirely outside the arena or whose corners are all outside the same
+// frustum plane. Cells are 8x8 units with one texture tile each.
+#define FLOOR_CELLS 65
+#define FLOOR_VERTS (FLOOR_CELLS + 1)
+#define FLOOR_ARENA_CELLS 32
+#define FLOOR_ROW_GRAIN 8
+#define FLOOR_VERTEX(x, z) ((z) * FLOOR_VERTS + (x))
+
+// Frustum outcodes, in clip space
+#define OUT_LEFT 1
+#define OUT_RIGHT 2
+#define OUT_BOTTOM 4
+#define OUT_TOP 8
+#define OUT_NEAR 16
+#define OUT_FAR 32
+
+static transformed_vertex_t floor_vertices[FLOOR_VERTS * FLOOR_VERTS];
+static uint8_t floor_outcodes[FLOOR_VERTS * FLOOR_VERTS];
+
+// Two triangles for the cell with its -x -z corner at grid corner (x, z)
+static void draw_floor_cell(uint8_t* framebuffer, uint8_t* texture, int32_t x, int32_t z) {
+    transformed_triangle_t floor_tri;
+    floor_tri.shade = INT_FIXED(1);
+
+    // Floor triangle 1
+    floor_tri.v[0] = floor_vertices[FLOOR_VERTEX(x, z)];
+    floor_tri.v[1] = floor_vertices[FLOOR_VERTEX(x, z + 1)];
+    floor_tri.v[2] = floor_vertices[FLOOR_VERTEX(x + 1, z)];
+
+    floor_tri.v[0].uw = INT_FIXED(0);
+    floor_tri.v[0].vw = INT_FIXED(0);
+
+    floor_tri.v[1].uw = INT_FIXED(1);
+    floor_tri.v[1].vw = INT_FIXED(0);
+
+    floor_tri.v[2].uw = INT_FIXED(0);
+    floor_tri.v[2].vw = INT_FIXED(1);
+
+    clip_rasterize(framebuffer, 0, 0, floor_tri, texture);
+
+    // Floor triangle 2, shares the second and third vertex
+    floor_tri.v[0] = floor_vertices[FLOOR_VERTEX(x + 1, z + 1)];
+    floor_tri.v[0].uw = INT_FIXED(1);
+    floor_tri.v[0].vw = INT_FIXED(1);
+
+    floor_tri.v[1].uw = INT_FIXED(1);
+    floor_tri.v[1].vw = INT_FIXED(0);
+
+    floor_tri.v[2].uw = INT_FIXED(0);
+    floor_tri.v[2].vw = INT_FIXED(1);
+
+    clip_rasterize(framebuffer, 0, 0, floor_tri, texture);
+}
+
+// Cells [x0, x1) x [z0, z1), culled as a whole, else split in four
+static void draw_floor_block(uint8_t* framebuffer, uint8_t* texture, int32_t x0, int32_t z0, int32_t x1, int32_t z1) {
+    // A block is flat and convex, so if all corners are outside one plane,
+    // everything in between is, too
+    uint8_t outside =
+        floor_outcodes[FLOOR_VERTEX(x0, z0)] &
+        floor_outcodes[FLOOR_VERTEX(x1, z0)] &
+        floor_outcodes[FLOOR_VERTEX(x0, z1)] &
+        floor_outcodes[FLOOR_VERTEX(x1, z1)];
+    if(outside != 0) {
+        return;
+    }
+
+    // Closest cell to the arena center, in cells from the center
+    int32_t near_x = imax(x0 - FLOOR_ARENA_CELLS, imin(0, x1 - 1 - FLOOR_ARENA_CELLS));
+    int32_t near_z = imax(z0 - FLOOR_ARENA_CELLS, imin(0, z1 - 1 - FLOOR_ARENA_CELLS));
+    if(near_x * near_x + near_z * near_z > FLOOR_ARENA_CELLS * FLOOR_ARENA_CELLS) {
+        return;
+    }
+
+    if(x1 - x0 == 1 && z1 - z0 == 1) {
+        draw_floor_cell(framebuffer, texture, x0, z0);
+        return;
+    }
+
+    int32_t xm = x1 - x0 > 1 ? (x0 + x1) / 2 : x1;
+    int32_t zm = z1 - z0 > 1 ? (z0 + z1) / 2 : z1;
+    draw_floor_block(framebuffer, texture, x0, z0, xm, zm);
+    if(xm != x1) {
+        draw_floor_block(framebuffer, texture, xm, z0, x1, zm);
+    }
+    if(zm != z1) {
+        draw_floor_block(framebuffer, texture, x0, zm, xm, z1);
+    }
+    if(xm != x1 && zm != z1) {
+        draw_floor_block(framebuffer, texture, xm, zm, x1, z1);
+    }
+}
+
+typedef struct {
+    imat4x4_t mvp;
+    int32_t height;
+} floor_transform_job_t;
+
+// Transform and classify grid corner rows [z_start, z_end)
+static void floor_transform_task(void* data, int32_t z_start, int32_t z_end) {
+    floor_transform_job_t* job = (floor_transform_job_t*)data;
+    for(int32_t z = z_start; z < z_end; z++) {
+        for(int32_t x = 0; x < FLOOR_VERTS; x++) {
+            transformed_vertex_t* vert = &floor_vertices[FLOOR_VERTEX(x, z)];
+            vert->cp = imat4x4transform(job->mvp, ivec4(
+                INT_FIXED(8 * (x - FLOOR_ARENA_CELLS)),
+                job->height,
+                INT_FIXED(8 * (z - FLOOR_ARENA_CELLS)),
+                INT_FIXED(1)
+            ));
+
+            uint8_t outcode = 0;
+            outcode |= vert->cp.x < -vert->cp.w ? OUT_LEFT : 0;
+            outcode |= vert->cp.x > vert->cp.w ? OUT_RIGHT : 0;
+            outcode |= vert->cp.y < -vert->cp.w ? OUT_BOTTOM : 0;
+            outcode |= vert->cp.y > vert->cp.w ? OUT_TOP : 0;
+            outcode |= vert->cp.z <= 0 ? OUT_NEAR : 0;
+            outcode |= vert->cp.z >= vert->cp.w ? OUT_FAR : 0;
+            floor_outcodes[FLOOR_VERTEX(x, z)] = outcode;
+
             // Clip?
-            for(int i = 0; i < 3; i++) {
-                if(floor_tri.v[i].cp.z <= 0) {
-                    floor_tri.v[i].clip = harsh_clip;
-                    continue;
-                }
-                else {
-                    if(floor_tri.v[i].cp.z >= floor_tri.v[i].cp.w) {
-                        floor_tri.v[i].clip = 3;
-                        continue;
-                    }
-                }
-                
-                floor_tri.v[i].p = ivec3(
-                    VIEWPORT(floor_tri.v[i].cp.x, floor_tri.v[i].cp.w, SCREEN_WIDTH),
-                    VIEWPORT(floor_tri.v[i].cp.y, floor_tri.v[i].cp.w, SCREEN_HEIGHT),
-                    floor_tri.v[i].cp.z
-                );
-                floor_tri.v[i].clip = 0;                
+            if(vert->cp.z <= 0) {
+                vert->clip = 1;
+                continue;
             }
-            
-            // Pass to rasterizer
-            clip_rasterize(framebuffer, 0, 0, floor_tri, texture);
+            if(vert->cp.z >= vert->cp.w) {
+                vert->clip = 3;
+                continue;
+            }
+
+            vert->p = ivec3(
+                VIEWPORT(vert->cp.x, vert->cp.w, SCREEN_WIDTH),
+                VIEWPORT(vert->cp.y, vert->cp.w, SCREEN_HEIGHT),
+                vert->cp.z
+            );
+            vert->clip = 0;
+        }
+    }
+}
+
+// Draw xz-planes at the given heights, one after the other
+void draw_floor(uint8_t* framebuffer, imat4x4_t camera, imat4x4_t projection, uint8_t* texture, const int32_t* heights, int32_t num_planes) {
+    floor_transform_job_t job;
+    job.mvp = imat4x4mul(projection, camera);
+
+    for(int32_t i = 0; i < num_planes; i++) {
+        // Transform and classify every grid corner once
+        job.height = heights[i];
+        job_parallel_for(floor_transform_task, &job, FLOOR_VERTS, FLOOR_ROW_GRAIN);
+
+        draw_floor_block(framebuffer, texture, 0, 0, FLOOR_CELLS, FLOOR_CELLS);
+    }
+}
+#endif
+
+// Transform, clip and project vertices [start, end) of one model
+static void transform_task(void* data, int32_t start, int32_t end) {
+    transform_job_t* job = (transform_job_t*)data;
+    imat4x4transformpoints_batch(job->mvp, &job->vertices[start], &clip_positions[job->offset + start], end - start);
+
+    // Then clip and project
+    shade_vertex_t transform_vertex;
+    for(int32_t i = start + job->offset; i < end + job->offset; i++) {
+        transform_vertex.p = clip_positions[i];
+        transformed_vertices[i].cp = transform_vertex.p;
+
+        transformed_vertices[i].clip = 0;
+
+        // Near clip?
+        if(transform_vertex.p.z <= 0) {
+            transformed_vertices[i].clip = 1;
+            continue;
+        }
+        else {
+            // Far clip?
+            if(transform_vertex.p.z >= transform_vertex.p.w) {
+                transformed_vertices[i].clip = 3; // Far clip is THREE TIMES as bad as near clip
+                continue;
+            }
+
+            // xy clip?
+            if(
+                transform_vertex.p.x >= transform_vertex.p.w ||
+                transform_vertex.p.y >= transform_vertex.p.w ||
+                transform_vertex.p.x <= -transform_vertex.p.w ||
+                transform_vertex.p.y <= -transform_vertex.p.w 
+            ) {
+                transformed_vertices[i].clip = 0x100;
+            }
+
+            // No clipping? Perspective divide and viewport transform
+            transformed_vertices[i].p = ivec3(
+                VIEWPORT(transform_vertex.p.x, transform_vertex.p.w, SCREEN_WIDTH),
+                VIEWPORT(transform_vertex.p.y, transform_vertex.p.w, SCREEN_HEIGHT),
+                transform_vertex.p.z
+            );
         }
     }
 }
 
 // Actual model rasterizer. Prepare model storage before rendering (whenever scene changes)
 void rasterize(uint8_t* framebuffer, model_t* models, int32_t num_models, imat4x4_t camera, imat4x4_t projection, uint8_t* floor_tex, uint8_t sky_color) {
+    // Transform all vertices, all models at once
+    timer_begin("transform");
+    job_group_t transform_group = { 0 };
     int32_t vert_offset = 0;
     for(int32_t m = 0; m < num_models; m++) {
+        // Inactive models never reach the sort, no need to transform them
+        if(models[m].draw == 0) {
+            vert_offset += models[m].num_vertices;
+            continue;
+        }
+
         // Mvp matrix from camera, mv and p
         imat4x4_t mvp = imat4x4mul(camera, models[m].modelview);
-        mvp = imat4x4mul(projection, mvp);
+        transform_jobs[m].mvp = imat4x4mul(projection, mvp);
+        transform_jobs[m].vertices = models[m].vertices;
+        transform_jobs[m].offset = vert_offset;
 
-        // Transform all vertices
-        shade_vertex_t transform_vertex;
-        for(int32_t i = 0; i < models[m].num_vertices; i++) {
-            transform_vertex.p = imat4x4transform(mvp, ivec4(models[m].vertices[i].x, models[m].vertices[i].y, models[m].vertices[i].z, INT_FIXED(1)));
-            transformed_vertices[i + vert_offset].cp = transform_vertex.p;
+        for(int32_t start = 0; start < models[m].num_vertices; start += TRANSFORM_GRAIN) {
+            int32_t end = imin(start + TRANSFORM_GRAIN, models[m].num_vertices);
+            job_spawn(&transform_group, transform_task, &transform_jobs[m], start, end);
+        }
 
-            transformed_vertices[i + vert_offset].clip = 0;
+        vert_offset += models[m].num_vertices;
+    }
+    job_wait(&transform_group);
+    stage_times.transform = timer_end();
+
+#ifdef RENDER_STATS
+    memset(&render_stats, 0, sizeof(render_stats_t));
+    render_stats.num_models = imin(num_models, RENDER_STATS_MAX_MODELS);
+    count_vertices(models, num_models);
+#endif
+
+    // Depth sort: One key per visible face. The camera moves smoothly, so last
+    // frames order with fresh keys is usually almost sorted and gets repaired
+    // by insertion, and faces that became visible are sorted separately and
+    // merged in. If that takes too long or there is no old order, sort every
+    // models faces on its own and merge, in parallel. Models with a BSP tree
+    // are left out of that and merged in afterwards.
+    timer_begin("sort");
+    int32_t incremental = draw_order_valid && sort_repair_backoff == 0;
+    int32_t num_visible = 0;
+    int32_t num_sorted = 0;
+    int32_t num_input = visibility_pass(models, num_models, incremental, &num_visible, &num_sorted);
+    double sort_start = nanotime();
+
+    int32_t repaired = 0;
+    if(incremental) {
+        // Keep last frames faces that are still visible, with fresh keys. The
+        // BSP merge kept them in order among themselves.
+        int32_t kept = 0;
+        for(int32_t i = 0; i < draw_order_count; i++) {
+            int32_t face = draw_order[i].face;
+            if((face_flags[face] & (FACE_VISIBLE | FACE_BSP)) == FACE_VISIBLE) {
+                draw_order[kept].key = face_keys[face];
+                draw_order[kept].face = face;
+                kept++;
+            }
+        }
+        repaired = depth_sort_insertion(draw_order, kept, num_sorted * SORT_REPAIR_BUDGET);
+        if(!repaired) {
+            sort_repair_backoff = SORT_REPAIR_BACKOFF;
+        }
 
-            // Near clip?
-            if(transform_vertex.p.z <= 0) {
-                transformed_vertices[i + vert_offset].clip = 1;
-                continue;
+        // Newly visible faces get sorted on their own and merged in
+        if(repaired && num_input != 0) {
+            for(int32_t i = 0; i < num_input; i++) {
+                draw_order[kept + i].key = face_keys[sort_input[i]];
+                draw_order[kept + i].face = sort_input[i];
             }
-            else {
-                // Far clip?
-                if(transform_vertex.p.z >= transform_vertex.p.w) {
-                    transformed_vertices[i + vert_offset].clip = 3; // Far clip is THREE TIMES as bad as near clip
-                    continue;
-                }
 
-                // xy clip?
-                if(
-                    transform_vertex.p.x >= transform_vertex.p.w ||
-                    transform_vertex.p.y >= transform_vertex.p.w ||
-                    transform_vertex.p.x <= -transform_vertex.p.w ||
-                    transform_vertex.p.y <= -transform_vertex.p.w 
-                ) {
-                    transformed_vertices[i + vert_offset].clip = 0x100;
-                }
+            depth_sort_radix(&draw_order[kept], draw_order_tmp, num_input);
+            depth_sort_merge(draw_order, kept, &draw_order[kept], num_input, draw_order_tmp);
 
-                // No clipping? Perspective divide and viewport transform
-                transformed_vertices[i + vert_offset].p = ivec3(
-                    VIEWPORT(transform_vertex.p.x, transform_vertex.p.w, SCREEN_WIDTH),
-                    VIEWPORT(transform_vertex.p.y, transform_vertex.p.w, SCREEN_HEIGHT),
-                    transform_vertex.p.z
-                );
-            }
+            depth_key_t* swap = draw_order;
+            draw_order = draw_order_tmp;
+            draw_order_tmp = swap;
         }
+    }
+    else {
+        sort_repair_backoff = imax(sort_repair_backoff - 1, 0);
+    }
 
-        vert_offset += models[m].num_vertices;
+    int32_t run_starts[DEPTH_SORT_MAX_RUNS + 1];
+    if(!repaired) {
+        int32_t num_runs = gather_sorted_runs(models, num_models, run_starts);
+        depth_sort_runs(draw_order, draw_order_tmp, run_starts, num_runs, 0);
     }
 
-    // Depth sort
-    qsort(sorted_triangles, num_faces_total, sizeof(triangle_t), &triAvgDepthCompare);
+    // BSP models in tree order, merged with everything else by key
+    if(num_sorted != num_visible) {
+        int32_t num_runs = gather_bsp_runs(models, num_models, camera, num_sorted, run_starts);
+        depth_sort_runs(draw_order, draw_order_tmp, run_starts, num_runs, 0xFFFFFFFFu >> (32 - num_runs));
+    }
+    draw_order_count = num_visible;
+    draw_order_valid = 1;
+
+    double sort_time = nanotime() - sort_start;
+    if(repaired) {
+        sort_stats.incremental_sorts++;
+        sort_stats.incremental_time += sort_time;
+    }
+    else {
+        sort_stats.full_sorts++;
+        sort_stats.full_time += sort_time;
+    }
+    stage_times.sort = timer_end();
     
     // Clear screen
+    timer_begin("floor");
     memset(framebuffer, sky_color, SCREEN_HEIGHT * SCREEN_WIDTH);
     
     // Floor / ceiling
     if(floor_tex != 0) {
-        draw_floor(framebuffer, camera, projection, floor_tex, INT_FIXED(0));
-        draw_floor(framebuffer, camera, projection, floor_tex, INT_FIXED(200));
+        draw_floor(framebuffer, camera, projection, floor_tex, floor_heights, 2);
     }
-    
+    stage_times.floor = timer_end();
     
     // Draw border
+    timer_begin("border");
     for(int i = 0; i < 20; i++) {
         ivec4_t dot;
         imat4x4_t mvp = imat4x4mul(projection, camera);
@@ -649,29 +1374,24 @@ void rasterize(uint8_t* framebuffer, model_t* models, int32_t num_models, imat4x
             }
         }
     }
+    stage_times.border = timer_end();
     
-    // Rasterize triangle-order
-    transformed_triangle_t tri;
-
-    for(int32_t i = 0; i < num_faces_total; i++ ) {
-        // Inefficient, but urgh too lazy to rewrite: skip triangle if model inactive
-        if(models[sorted_triangles[i].model_id].draw == 0) {
-            continue;
-        }
-
-        // Set up triangle
-        for(int ver = 0; ver < 3; ver++) {
-            tri.v[ver] = transformed_vertices[sorted_triangles[i].v[ver]];
-        }
-        
-        // Cull backfaces 
-        if(imul(tri.v[1].p.x - tri.v[0].p.x, tri.v[2].p.y - tri.v[0].p.y) -
-            imul(tri.v[2].p.x - tri.v[0].p.x, tri.v[1].p.y - tri.v[0].p.y) < 0) {
-            continue;
-        }
-
-        clip_rasterize(framebuffer, models, i, tri, 0);
-    }
+    // Rasterize triangle-order, in bands of rows as jobs
+    timer_begin("raster");
+    raster_job_t job;
+    job.framebuffer = framebuffer;
+    job.models = models;
+#ifdef RENDER_STATS
+    raster_task(&job, 0, SCREEN_HEIGHT);
+#else
+    job_parallel_for(raster_task, &job, SCREEN_HEIGHT, RASTER_ROW_GRAIN);
+#endif
+    RENDER_COUNT_END();
+    stage_times.raster = timer_end();
+
+#ifdef RENDER_STATS
+    sum_render_counts();
+#endif
     
     /*
     // Draw a little RGB332 swatch
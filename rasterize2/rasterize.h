@@ -9,6 +9,13 @@
 #define ZNEAR FLOAT_FIXED(0.1)
 #define ZFAR FLOAT_FIXED(1024.0)
 
+// Floor / ceiling as a triangle grid instead of spans
+//#define FLOOR_TRIANGLES
+
+// Count what rasterize() does, per model, see render_stats_t. Costs a little
+// in the inner loops, so it is left out unless defined.
+//#define RENDER_STATS
+
 // 0-255 R G B to packed RGB332
 #define RGB332(r, g, b) ((((r) >> 5) & 0x07) << 5 | (((g) >> 5 ) & 0x07) << 2 | (((b) >> 6) & 0x03))
 
@@ -32,6 +39,14 @@ typedef struct {
     int32_t v;
 } texcoord_t;
 
+// A models face, the same 32 bytes in mesh files. texid indexes the models
+// textures.
+typedef struct {
+    int32_t v[8]; // p0, p1, p2, n, t1, t2, t3, texid
+} face_t;
+
+// A face of the scene being drawn: Indices into the scenes vertices, the
+// model it belongs to and its texture
 typedef struct {
     int32_t v[8]; // p0, p1, p2, n, t1, t2, t3, texid
     uint8_t model_id;
@@ -59,27 +74,105 @@ typedef struct {
     int32_t shade;    
 } transformed_triangle_t;
 
+// BSP tree for static meshes, see bsp.h
+typedef struct bsp_tree bsp_tree_t;
+
 // A model: Backing vertices / normals / texcoords / faces, 
-// number of vertices / normals / texcoords / faces, modelview matrix
+// number of vertices / normals / texcoords / faces, textures by texid,
+// modelview matrix, BSP tree (or 0) if the mesh is static
 typedef struct {
     vertex_t* vertices;
     vertex_t* normals;
     texcoord_t* texcoords;
-    triangle_t* faces;
+    face_t* faces;
 
-    int16_t num_vertices;
-    int16_t num_normals;
-    int16_t num_texcoords;
-    int16_t num_faces;
+    int32_t num_vertices;
+    int32_t num_normals;
+    int32_t num_texcoords;
+    int32_t num_faces;
 
+    uint8_t** textures;
     int32_t draw;
 
     imat4x4_t modelview;
+    bsp_tree_t* bsp;
 } model_t;
 
+// Depth sort statistics: Number of frames and total seconds spent sorting,
+// for full sorts and for incremental repairs of last frames order. Face
+// counts are summed over frames: all faces, faces dropped by the visibility
+// pass (inactive model, backface, clip reject) and faces that got sorted.
+typedef struct {
+    int32_t full_sorts;
+    int32_t incremental_sorts;
+    double full_time;
+    double incremental_time;
+
+    int64_t faces_total;
+    int64_t faces_inactive;
+    int64_t faces_backface;
+    int64_t faces_clipped;
+    int64_t faces_sorted;
+} sort_stats_t;
+
+// Seconds spent in each stage of the last rasterize() call: Vertex transform,
+// visibility pass and depth sort, clear and floor / ceiling, arena border,
+// triangles
+typedef struct {
+    double transform;
+    double sort;
+    double floor;
+    double border;
+    double raster;
+} stage_times_t;
+
+// What rasterize() did for one model (or the sum over all): Vertices
+// transformed and how many were near / far / xy clipped, whether the model
+// was skipped as inactive, faces dropped as backfacing or completely
+// clipped, triangles clipped against near / far into one or two pieces,
+// triangles that reached the drawer, and the spans and pixels it drew. Every
+// pixel fetches exactly one texel, so pixels are texel fetches as well. The
+// floor and arena border are not counted.
+typedef struct {
+    int32_t vertices;
+    int32_t vertices_near;
+    int32_t vertices_far;
+    int32_t vertices_xy;
+    int32_t skipped;
+    int32_t faces_backface;
+    int32_t faces_clipped;
+    int32_t triangles_clipped_one;
+    int32_t triangles_clipped_two;
+    int32_t triangles;
+    int32_t spans;
+    int64_t pixels;
+} render_counts_t;
+
+// Counts of a frame, per model. Models past RENDER_STATS_MAX_MODELS share
+// the last entry.
+#define RENDER_STATS_MAX_MODELS 32
+
+typedef struct {
+    render_counts_t frame;
+    render_counts_t models[RENDER_STATS_MAX_MODELS];
+    int32_t num_models;
+} render_stats_t;
+
 // Actual model drawer
 void prepare_geometry_storage(model_t* models, int32_t num_models);
 void free_geometry_storage();
+void invalidate_draw_order();
+void get_sort_stats(sort_stats_t* stats);
+void reset_sort_stats();
+void get_stage_times(stage_times_t* times);
+
+// Counts of the last rasterize() call, all zero without RENDER_STATS
+void get_render_stats(render_stats_t* stats);
 void rasterize(uint8_t* framebuffer, model_t* models, int32_t num_models, imat4x4_t camera, imat4x4_t projection, uint8_t* floor_tex, uint8_t sky_color);
 
+// A single triangle, with vertices set up like the transform does (clip
+// space position, clip flags, viewport position unless clipped, texcoords).
+// Near / far clipped vertices get clipped here. For benchmarks.
+void draw_triangle(uint8_t* framebuffer, const transformed_triangle_t* tri, uint8_t* texture);
+
 #endif
@@ -0,0 +1,765 @@
+/**
+* Offline renderer: Draws a level along a scripted camera path without any
+* window or sound, for machines that have neither.
+*
+* Usage: render [-level city|ringworld|core] [-frames n] [-threads n]
+*               [-camera script] [-out pattern] [-benchmark results.json]
+*               [-counters] [-trace trace.json] [-record golden]
+*               [-verify golden] [-capture slow_frame.cap]
+*
+* The camera script has one key per line, "time eye_x eye_y eye_z look_x
+* look_y look_z", with times in seconds, in order. Lines starting with # are
+* ignored. Without a script, the camera flies a fixed loop through the arena.
+* Enemies hover at fixed spots.
+*
+* Frames go to pattern, formatted with the frame number (frames/%04d.bmp),
+* as BMPs. Without -out, they are only rendered.
+*
+* -benchmark flies through every level, times every stage of every frame and
+* writes mean, median, p95 and p99 per stage and level as JSON to the given
+* file, or to stdout for "-". Time steps are fixed, so every run draws the
+* exact same frames. With -counters, it also reads the hardware counters
+* (Linux perf_event) over every stage and adds IPC and cache and branch misses
+* per frame, per screen pixel and per drawn triangle.
+*
+* -trace writes a timeline of every timed scope, tagged with frame numbers,
+* as Chrome Trace Event JSON.
+*
+* -capture draws a frame captured by the game (raster -capture ms) again,
+* frames times over, each from scratch with a full depth sort, and prints
+* how long that takes against how long it took in the game. With -out, the
+* first one is saved.
+*
+* -verify renders a few fixed poses along the path in every level, with the
+* SIMD and the plain C math and with one and with all threads, and checks the
+* framebuffer hashes against each other and against the golden file. Any
+* mismatch is reported, the frame saved as verify_<level>_<pose>.bmp and,
+* where two ways of drawing it disagree, what differs as ..._diff.bmp, and
+* the exit code is 1. -record writes the golden file instead, after the same
+* checks between variants. Hashes only match for the same camera path and the
+* same build (FLOOR_TRIANGLES, compiler and flags).
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rasterize.h"
+#include "levels.h"
+#include "images.h"
+#include "threads.h"
+#include "timing.h"
+#include "trace.h"
+#include "capture.h"
+#include "fixedmath.h"
+
+#define RENDER_FRAMES 300
+#define RENDER_FRAME_TIME (1.0 / 60.0)
+#define RENDER_ENEMIES 8
+#define CAMERA_MAX_KEYS 256
+
+// Benchmark frames per level, and frames drawn before timing starts
+#define BENCHMARK_FRAMES 600
+#define BENCHMARK_WARMUP 10
+
+// Poses per level for -verify / -record: Evenly spread along the path, then
+// the fixed cameras below
+#define VERIFY_PATH_POSES 8
+#define VERIFY_FIXED_POSES 1
+#define VERIFY_POSES (VERIFY_PATH_POSES + VERIFY_FIXED_POSES)
+#define VERIFY_MAX_LINE 256
+
+// Timed stages: The ones rasterize() reports, then the cockpit overlay, the
+// conversion to 24 bit colour a display would get, and the whole frame
+#define STAGE_TRANSFORM 0
+#define STAGE_SORT 1
+#define STAGE_FLOOR 2
+#define STAGE_BORDER 3
+#define STAGE_RASTER 4
+#define STAGE_OVERLAYS 5
+#define STAGE_PRESENT 6
+#define STAGE_TOTAL 7
+#define NUM_STAGES 8
+
+// One benchmark frame: Stage times in ms, stage counters (zero without
+// counters) and triangles that made it through the sort
+typedef struct {
+    double times[NUM_STAGES];
+    uint64_t counters[NUM_STAGES][TIMER_COUNTERS];
+    int64_t triangles;
+} frame_stats_t;
+
+static const char* stage_names[NUM_STAGES] = {
+    "transform",
+    "sort",
+    "floor",
+    "border",
+    "raster",
+    "overlays",
+    "present",
+    "total"
+};
+
+// Ways of drawing the same frame that have to agree. Threads 0 means as
+// many as were asked for, but at least VERIFY_MIN_THREADS, so the work gets
+// split up even on a machine with one or two CPUs.
+#define VERIFY_MIN_THREADS 4
+
+typedef struct {
+    const char* name;
+    int32_t threads;
+    int32_t simd;
+} variant_t;
+
+#define NUM_VARIANTS 4
+static const variant_t variants[NUM_VARIANTS] = {
+    { "simd, all threads", 0, 1 },
+    { "simd, 1 thread", 1, 1 },
+    { "scalar, 1 thread", 1, 0 },
+    { "scalar, all threads", 0, 0 },
+};
+
+typedef struct {
+    double time;
+    double eye[3];
+    double lookat[3];
+} camera_key_t;
+
+typedef struct {
+    camera_key_t keys[CAMERA_MAX_KEYS];
+    int32_t num_keys;
+} camera_path_t;
+
+// Read a camera script, returns 0 if it can't be read or has no keys
+static int32_t camera_path_load(camera_path_t* path, const char* file_name) {
+    FILE* script = fopen(file_name, "r");
+    if(script == 0) {
+        return 0;
+    }
+
+    char line[256];
+    path->num_keys = 0;
+    while(fgets(line, sizeof(line), script) != 0 && path->num_keys < CAMERA_MAX_KEYS) {
+        camera_key_t* key = &path->keys[path->num_keys];
+        if(line[0] == '#') {
+            continue;
+        }
+        int32_t values = sscanf(
+            line, "%lf %lf %lf %lf %lf %lf %lf",
+            &key->time, &key->eye[0], &key->eye[1], &key->eye[2], &key->lookat[0], &key->lookat[1], &key->lookat[2]
+        );
+        if(values == 7) {
+            path->num_keys++;
+        }
+    }
+    fclose(script);
+    return path->num_keys != 0;
+}
+
+// A loop through the arena, swooping up and down, looking where it goes
+static void camera_path_flythrough(camera_path_t* path, double duration) {
+    path->num_keys = 129;
+    for(int32_t i = 0; i < path->num_keys; i++) {
+        double angle = 2.0 * 3.14159265 * i / (path->num_keys - 1);
+        double ahead = angle + 0.15;
+        camera_key_t* key = &path->keys[i];
+        key->time = duration * i / (path->num_keys - 1);
+        key->eye[0] = 180.0 * sin(angle);
+        key->eye[1] = 50.0 + 30.0 * sin(3.0 * angle);
+        key->eye[2] = 150.0 * sin(2.0 * angle);
+        key->lookat[0] = 180.0 * sin(ahead);
+        key->lookat[1] = 45.0 + 30.0 * sin(3.0 * ahead);
+        key->lookat[2] = 150.0 * sin(2.0 * ahead);
+    }
+}
+
+// Camera matrix at time, interpolating linearly between keys and holding
+// the first and last one outside of them
+static imat4x4_t camera_path_eval(const camera_path_t* path, double time) {
+    int32_t next = 0;
+    while(next < path->num_keys - 1 && path->keys[next].time < time) {
+        next++;
+    }
+    const camera_key_t* a = &path->keys[next > 0 ? next - 1 : 0];
+    const camera_key_t* b = &path->keys[next];
+
+    double t = b->time > a->time ? (time - a->time) / (b->time - a->time) : 1.0;
+    t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+
+    double eye[3];
+    double lookat[3];
+    for(int32_t i = 0; i < 3; i++) {
+        eye[i] = a->eye[i] + (b->eye[i] - a->eye[i]) * t;
+        lookat[i] = a->lookat[i] + (b->lookat[i] - a->lookat[i]) * t;
+    }
+    return imat4x4lookat(
+        ivec3(FLOAT_FIXED(eye[0]), FLOAT_FIXED(eye[1]), FLOAT_FIXED(eye[2])),
+        ivec3(FLOAT_FIXED(lookat[0]), FLOAT_FIXED(lookat[1]), FLOAT_FIXED(lookat[2])),
+        ivec3(0, INT_FIXED(1), 0)
+    );
+}
+
+// Enemies in a ring around the middle at three heights, spinning like in
+// the game
+static void place_enemies(level_t* level, double time) {
+    int32_t num_enemies = level->num_models - level->num_static_models;
+    for(int32_t i = 0; i < num_enemies; i++) {
+        double angle = 2.0 * 3.14159265 * i / num_enemies;
+        ivec3_t pos = ivec3(FLOAT_FIXED(120.0 * cos(angle)), INT_FIXED(30 + 20 * (i % 3)), FLOAT_FIXED(120.0 * sin(angle)));
+        level->models[level->num_static_models + i].modelview = imat4x4mul(
+            imat4x4translate(pos),
+            imat4x4rotatey(FLOAT_FIXED(time))
+        );
+    }
+}
+
+// Cameras -verify always checks, whatever the path: time, eye, look at
+static const camera_key_t verify_cameras[VERIFY_FIXED_POSES] = {
+    // Looking down, the floor rows almost parallel to the horizon. Made the
+    // floor span bounds overflow once.
+    { 0.0, { 10.0, 43.0, 10.0 }, { 10.3572, 42.7449, 9.0660 } },
+};
+
+// Move everything to where it is at time, returns the camera
+static imat4x4_t pose_scene(level_t* level, int32_t level_id, const camera_path_t* path, double time) {
+    level_animate(level_id, level->models, time);
+    place_enemies(level, time);
+    return camera_path_eval(path, time);
+}
+
+// Cockpit on top, like the game draws it. Pure green is transparent.
+static void draw_overlay(uint8_t* framebuffer, const uint8_t* overlay) {
+    for(int32_t i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        if(overlay[i] != RGB332(0, 255, 0)) {
+            framebuffer[i] = overlay[i];
+        }
+    }
+}
+
+// Hand the frame to a (pretend) display: Expand to 24 bit colour
+static void present(const uint8_t* framebuffer, uint8_t* display) {
+    for(int32_t i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        uint8_t pixel = framebuffer[i];
+        display[i * 3 + 0] = (pixel >> 5) * 255 / 7;
+        display[i * 3 + 1] = ((pixel >> 2) & 0x07) * 255 / 7;
+        display[i * 3 + 2] = (pixel & 0x03) * 255 / 3;
+    }
+}
+
+// Draw frames of level along path. If stats is given, frames after the first
+// warmup ones store their measurements there, frame by frame.
+static void render_level(int32_t level_id, const camera_path_t* path, int32_t frames, int32_t warmup, const char* out_pattern, frame_stats_t* stats) {
+    static level_t level;
+    level_load(&level, level_id, RENDER_ENEMIES);
+    prepare_geometry_storage(level.models, level.num_models);
+    uint8_t* overlay = load_texture("data/cockpit.bmp");
+
+    imat4x4_t projection = imat4x4perspective(INT_FIXED(45), idiv(INT_FIXED(SCREEN_WIDTH), INT_FIXED(SCREEN_HEIGHT)), ZNEAR, ZFAR);
+    uint8_t* framebuffer = (uint8_t*)malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint8_t));
+    uint8_t* display = (uint8_t*)malloc(SCREEN_WIDTH * SCREEN_HEIGHT * 3 * sizeof(uint8_t));
+
+    double total_time = 0.0;
+    for(int32_t f = 0; f < frames; f++) {
+        imat4x4_t camera = pose_scene(&level, level_id, path, f * RENDER_FRAME_TIME);
+        reset_sort_stats();
+
+        timer_set_frame(f);
+        timer_begin("frame");
+        rasterize(framebuffer, level.models, level.num_models, camera, projection, level.floor_texture, level.sky_color);
+        timer_begin("overlays");
+        draw_overlay(framebuffer, overlay);
+        double overlay_time = timer_end();
+        timer_begin("present");
+        present(framebuffer, display);
+        double present_time = timer_end();
+        double frame_time = timer_end();
+        total_time += frame_time;
+
+        if(stats != 0 && f >= warmup) {
+            stage_times_t stage_times;
+            get_stage_times(&stage_times);
+            sort_stats_t sort_stats;
+            get_sort_stats(&sort_stats);
+
+            frame_stats_t* frame = &stats[f - warmup];
+            frame->times[STAGE_TRANSFORM] = stage_times.transform * 1000.0;
+            frame->times[STAGE_SORT] = stage_times.sort * 1000.0;
+            frame->times[STAGE_FLOOR] = stage_times.floor * 1000.0;
+            frame->times[STAGE_BORDER] = stage_times.border * 1000.0;
+            frame->times[STAGE_RASTER] = stage_times.raster * 1000.0;
+            frame->times[STAGE_OVERLAYS] = overlay_time * 1000.0;
+            frame->times[STAGE_PRESENT] = present_time * 1000.0;
+            frame->times[STAGE_TOTAL] = frame_time * 1000.0;
+            frame->triangles = sort_stats.faces_sorted;
+
+            // Stage scopes are named like the stages, the whole frame is "frame"
+            for(int32_t stage = 0; stage < NUM_STAGES; stage++) {
+                timer_last_counters(stage == STAGE_TOTAL ? "frame" : stage_names[stage], frame->counters[stage]);
+            }
+        }
+
+        if(out_pattern != 0) {
+            char file_name[1024];
+            snprintf(file_name, sizeof(file_name), out_pattern, f);
+            save_framebuffer(file_name, framebuffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+        }
+    }
+
+    if(stats == 0) {
+        printf(
+            "%s: %d frames, %.3f ms per frame, %d threads\n",
+            level_name(level_id), frames, frames ? total_time * 1000.0 / frames : 0.0, jobs_num_threads()
+        );
+    }
+
+    free(display);
+    free(framebuffer);
+    free(overlay);
+    free_geometry_storage();
+    level_free(&level);
+}
+
+// Redraw a captured frame, frames times. Returns 0 if it can't be read or
+// doesn't fit the level data.
+static int32_t render_capture(const char* file_name, int32_t frames, const char* out_pattern) {
+    static frame_capture_t capture;
+    static level_t level;
+    if(!capture_read(file_name, &capture) || capture.level < 0 || capture.level >= NUM_LEVELS) {
+        printf("Could not read capture %s\n", file_name);
+        return 0;
+    }
+    level_load(&level, capture.level, capture.num_enemies);
+    if(!capture_apply(&capture, level.models, level.num_models)) {
+        printf("Capture %s does not match the %s level data\n", file_name, level_name(capture.level));
+        level_free(&level);
+        return 0;
+    }
+    prepare_geometry_storage(level.models, level.num_models);
+    uint8_t* framebuffer = (uint8_t*)malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint8_t));
+
+    double total_time = 0.0;
+    double best_time = 0.0;
+    for(int32_t f = 0; f < frames; f++) {
+        invalidate_draw_order();
+        timer_set_frame(f);
+        timer_begin("frame");
+        rasterize(framebuffer, level.models, level.num_models, capture.camera, capture.projection, capture.floor_texture, capture.sky_color);
+        double frame_time = timer_end();
+        total_time += frame_time;
+        best_time = f == 0 || frame_time < best_time ? frame_time : best_time;
+
+        if(out_pattern != 0 && f == 0) {
+            char out_name[1024];
+            snprintf(out_name, sizeof(out_name), out_pattern, f);
+            save_framebuffer(out_name, framebuffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+        }
+    }
+
+    printf(
+        "%s (%s): %.3f ms in the game, %d redraws at %.3f ms mean, %.3f ms best, %d threads\n",
+        file_name, level_name(capture.level), capture.frame_time * 1000.0, frames,
+        frames ? total_time * 1000.0 / frames : 0.0, best_time * 1000.0, jobs_num_threads()
+    );
+
+    free(framebuffer);
+    free_geometry_storage();
+    level_free(&level);
+    return 1;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest rank percentile of sorted values
+static double percentile(const double* sorted, int32_t count, double p) {
+    int32_t rank = (int32_t)ceil(p * count) - 1;
+    return sorted[imax(0, imin(rank, count - 1))];
+}
+
+// Counter stats of one stage over all frames, continuing its JSON object
+static void write_counters_json(FILE* out, const frame_stats_t* stats, int32_t count, int32_t stage) {
+    uint64_t sums[TIMER_COUNTERS] = { 0 };
+    int64_t triangles = 0;
+    for(int32_t f = 0; f < count; f++) {
+        for(int32_t i = 0; i < TIMER_COUNTERS; i++) {
+            sums[i] += stats[f].counters[stage][i];
+        }
+        triangles += stats[f].triangles;
+    }
+
+    double pixels = (double)SCREEN_WIDTH * SCREEN_HEIGHT * count;
+    double tris = triangles > 0 ? (double)triangles : 1.0;
+    fprintf(
+        out, ", \"cycles\": %.0f, \"instructions\": %.0f, \"ipc\": %.3f, "
+        "\"cache_misses\": %.1f, \"cache_misses_per_pixel\": %.5f, \"cache_misses_per_triangle\": %.4f, "
+        "\"branch_misses\": %.1f, \"branch_misses_per_pixel\": %.5f, \"branch_misses_per_triangle\": %.4f",
+        (double)sums[TIMER_CYCLES] / count, (double)sums[TIMER_INSTRUCTIONS] / count,
+        sums[TIMER_CYCLES] ? (double)sums[TIMER_INSTRUCTIONS] / sums[TIMER_CYCLES] : 0.0,
+        (double)sums[TIMER_CACHE_MISSES] / count, sums[TIMER_CACHE_MISSES] / pixels, sums[TIMER_CACHE_MISSES] / tris,
+        (double)sums[TIMER_BRANCH_MISSES] / count, sums[TIMER_BRANCH_MISSES] / pixels, sums[TIMER_BRANCH_MISSES] / tris
+    );
+}
+
+// One level: Stats of every stage over all frames, as a JSON object
+static void write_level_json(FILE* out, int32_t level_id, const frame_stats_t* stats, int32_t count, int32_t counters, double* sorted, int32_t last) {
+    int64_t triangles = 0;
+    for(int32_t f = 0; f < count; f++) {
+        triangles += stats[f].triangles;
+    }
+
+    fprintf(
+        out, "    {\n      \"level\": \"%s\",\n      \"frames\": %d,\n      \"triangles\": %.1f,\n      \"stages\": {\n",
+        level_name(level_id), count, (double)triangles / count
+    );
+    for(int32_t stage = 0; stage < NUM_STAGES; stage++) {
+        double sum = 0.0;
+        for(int32_t f = 0; f < count; f++) {
+            sorted[f] = stats[f].times[stage];
+            sum += sorted[f];
+        }
+        qsort(sorted, count, sizeof(double), compare_doubles);
+
+        double median = count % 2 ? sorted[count / 2] : 0.5 * (sorted[count / 2 - 1] + sorted[count / 2]);
+        fprintf(
+            out, "        \"%s\": { \"mean\": %.4f, \"median\": %.4f, \"p95\": %.4f, \"p99\": %.4f",
+            stage_names[stage], sum / count, median, percentile(sorted, count, 0.95), percentile(sorted, count, 0.99)
+        );
+        if(counters) {
+            write_counters_json(out, stats, count, stage);
+        }
+        fprintf(out, " }%s\n", stage == NUM_STAGES - 1 ? "" : ",");
+    }
+    fprintf(out, "      }\n    }%s\n", last ? "" : ",");
+}
+
+// Every level along the same path, timed. Returns 0 if results can't be written.
+static int32_t benchmark(const camera_path_t* path, int32_t frames, int32_t counters, const char* results) {
+    int32_t count = frames - BENCHMARK_WARMUP;
+    frame_stats_t* stats = (frame_stats_t*)malloc(sizeof(frame_stats_t) * count);
+    double* sorted = (double*)malloc(sizeof(double) * count);
+
+    FILE* out = strcmp(results, "-") == 0 ? stdout : fopen(results, "w");
+    if(out == 0) {
+        free(stats);
+        free(sorted);
+        return 0;
+    }
+
+    // After jobs_init, so the workers get counted too
+    if(counters && !timer_counters_enable()) {
+        fprintf(stderr, "No hardware counters available, timing only\n");
+        counters = 0;
+    }
+
+    fprintf(
+        out, "{\n  \"units\": \"ms\",\n  \"threads\": %d,\n  \"warmup\": %d,\n  \"counters\": %s,\n  \"levels\": [\n",
+        jobs_num_threads(), BENCHMARK_WARMUP, counters ? "true" : "false"
+    );
+    for(int32_t level_id = 0; level_id < NUM_LEVELS; level_id++) {
+        render_level(level_id, path, frames, BENCHMARK_WARMUP, 0, stats);
+        write_level_json(out, level_id, stats, count, counters, sorted, level_id == NUM_LEVELS - 1);
+    }
+    fprintf(out, "  ]\n}\n");
+
+    if(counters) {
+        timer_counters_disable();
+    }
+    if(out != stdout) {
+        fclose(out);
+    }
+    free(stats);
+    free(sorted);
+    return 1;
+}
+
+// Render every pose of every level with every variant, into
+// frames[(level * VERIFY_POSES + pose) * NUM_VARIANTS + variant]. Every pose
+// starts from scratch, so frames don't depend on the ones before.
+static void render_poses(const camera_path_t* path, int32_t num_threads, uint8_t** frames) {
+    imat4x4_t projection = imat4x4perspective(INT_FIXED(45), idiv(INT_FIXED(SCREEN_WIDTH), INT_FIXED(SCREEN_HEIGHT)), ZNEAR, ZFAR);
+    double duration = path->keys[path->num_keys - 1].time;
+
+    // Jobs are set up for num_threads on the way in, which gives the CPU count for 0
+    int32_t all_threads = imax(num_threads != 0 ? num_threads : jobs_num_threads(), VERIFY_MIN_THREADS);
+
+    for(int32_t level_id = 0; level_id < NUM_LEVELS; level_id++) {
+        static level_t level;
+        level_load(&level, level_id, RENDER_ENEMIES);
+        prepare_geometry_storage(level.models, level.num_models);
+
+        for(int32_t v = 0; v < NUM_VARIANTS; v++) {
+            jobs_shutdown();
+            jobs_init(variants[v].threads != 0 ? variants[v].threads : all_threads);
+            fixedmath_simd = variants[v].simd;
+
+            for(int32_t pose = 0; pose < VERIFY_POSES; pose++) {
+                imat4x4_t camera;
+                if(pose < VERIFY_PATH_POSES) {
+                    camera = pose_scene(&level, level_id, path, duration * (pose + 0.5) / VERIFY_PATH_POSES);
+                }
+                else {
+                    static camera_path_t fixed;
+                    fixed.num_keys = 1;
+                    fixed.keys[0] = verify_cameras[pose - VERIFY_PATH_POSES];
+                    camera = pose_scene(&level, level_id, &fixed, fixed.keys[0].time);
+                }
+                invalidate_draw_order();
+                uint8_t* framebuffer = frames[(level_id * VERIFY_POSES + pose) * NUM_VARIANTS + v];
+                rasterize(framebuffer, level.models, level.num_models, camera, projection, level.floor_texture, level.sky_color);
+            }
+        }
+
+        free_geometry_storage();
+        level_free(&level);
+    }
+    fixedmath_simd = 1;
+}
+
+// Golden hash of every pose from a file with "level pose hash" lines.
+// Returns 0 if it can't be read or misses any.
+static int32_t read_golden(const char* file_name, uint64_t* hashes) {
+    FILE* golden = fopen(file_name, "r");
+    if(golden == 0) {
+        return 0;
+    }
+
+    uint8_t found[NUM_LEVELS * VERIFY_POSES] = { 0 };
+    char line[VERIFY_MAX_LINE];
+    while(fgets(line, sizeof(line), golden) != 0) {
+        char name[VERIFY_MAX_LINE];
+        int32_t pose;
+        unsigned long long hash;
+        if(line[0] == '#' || sscanf(line, "%255s %d %llx", name, &pose, &hash) != 3) {
+            continue;
+        }
+        int32_t level_id = level_find(name);
+        if(level_id >= 0 && pose >= 0 && pose < VERIFY_POSES) {
+            hashes[level_id * VERIFY_POSES + pose] = (uint64_t)hash;
+            found[level_id * VERIFY_POSES + pose] = 1;
+        }
+    }
+    fclose(golden);
+
+    for(int32_t i = 0; i < NUM_LEVELS * VERIFY_POSES; i++) {
+        if(!found[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int32_t write_golden(const char* file_name, const uint64_t* hashes) {
+    FILE* golden = fopen(file_name, "w");
+    if(golden == 0) {
+        return 0;
+    }
+
+    fprintf(golden, "# Framebuffer hashes (64 bit FNV-1a) for render -verify: level, pose, hash\n");
+    fprintf(golden, "# Written by render -record. Only valid for the default camera path and\n");
+    fprintf(golden, "# the build configuration it was recorded with.\n");
+    for(int32_t level_id = 0; level_id < NUM_LEVELS; level_id++) {
+        for(int32_t pose = 0; pose < VERIFY_POSES; pose++) {
+            fprintf(golden, "%s %d %016llx\n", level_name(level_id), pose, (unsigned long long)hashes[level_id * VERIFY_POSES + pose]);
+        }
+    }
+    fclose(golden);
+    return 1;
+}
+
+// Check all variants against the first one and, unless recording, against
+// the golden hashes. Returns the number of mismatches, or -1 if the golden
+// file can't be read or written.
+static int32_t verify(const camera_path_t* path, int32_t num_threads, const char* golden_file, int32_t record) {
+    static uint64_t golden[NUM_LEVELS * VERIFY_POSES];
+    if(!record && !read_golden(golden_file, golden)) {
+        printf("Could not read golden hashes for every pose from %s\n", golden_file);
+        return -1;
+    }
+
+    int32_t size = SCREEN_WIDTH * SCREEN_HEIGHT;
+    int32_t num_frames = NUM_LEVELS * VERIFY_POSES * NUM_VARIANTS;
+    uint8_t* frame_storage = (uint8_t*)malloc(num_frames * size * sizeof(uint8_t));
+    uint8_t* frames[NUM_LEVELS * VERIFY_POSES * NUM_VARIANTS];
+    for(int32_t i = 0; i < num_frames; i++) {
+        frames[i] = &frame_storage[i * size];
+    }
+    render_poses(path, num_threads, frames);
+
+    int32_t mismatches = 0;
+    static uint64_t hashes[NUM_LEVELS * VERIFY_POSES];
+    for(int32_t level_id = 0; level_id < NUM_LEVELS; level_id++) {
+        for(int32_t pose = 0; pose < VERIFY_POSES; pose++) {
+            int32_t index = level_id * VERIFY_POSES + pose;
+            uint8_t** pose_frames = &frames[index * NUM_VARIANTS];
+            hashes[index] = hash_framebuffer(pose_frames[0], size);
+
+            char file_name[VERIFY_MAX_LINE];
+            if(!record && hashes[index] != golden[index]) {
+                snprintf(file_name, sizeof(file_name), "verify_%s_%d.bmp", level_name(level_id), pose);
+                printf(
+                    "MISMATCH %s pose %d (%s): %016llx, golden %016llx, saved %s\n",
+                    level_name(level_id), pose, variants[0].name, (unsigned long long)hashes[index], (unsigned long long)golden[index], file_name
+                );
+                save_framebuffer(file_name, pose_frames[0], SCREEN_WIDTH, SCREEN_HEIGHT);
+                mismatches++;
+            }
+
+            for(int32_t v = 1; v < NUM_VARIANTS; v++) {
+                uint64_t hash = hash_framebuffer(pose_frames[v], size);
+                if(hash == hashes[index]) {
+                    continue;
+                }
+
+                int32_t differing = 0;
+                for(int32_t i = 0; i < size; i++) {
+                    differing += pose_frames[0][i] != pose_frames[v][i];
+                }
+                snprintf(file_name, sizeof(file_name), "verify_%s_%d_%d_diff.bmp", level_name(level_id), pose, v);
+                printf(
+                    "MISMATCH %s pose %d: %s draws %016llx, %s %016llx, %d pixels differ, saved %s\n",
+                    level_name(level_id), pose, variants[v].name, (unsigned long long)hash, variants[0].name,
+                    (unsigned long long)hashes[index], differing, file_name
+                );
+                save_framebuffer_diff(file_name, pose_frames[0], pose_frames[v], SCREEN_WIDTH, SCREEN_HEIGHT);
+                snprintf(file_name, sizeof(file_name), "verify_%s_%d_%d.bmp", level_name(level_id), pose, v);
+                save_framebuffer(file_name, pose_frames[v], SCREEN_WIDTH, SCREEN_HEIGHT);
+                mismatches++;
+            }
+        }
+    }
+    free(frame_storage);
+
+    if(record) {
+        if(mismatches != 0) {
+            printf("Not recording, variants disagree\n");
+        }
+        else if(!write_golden(golden_file, hashes)) {
+            printf("Could not write %s\n", golden_file);
+            return -1;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char** argv) {
+    int32_t level_id = LEVEL_CITY;
+    int32_t frames = -1;
+    int32_t num_threads = 0;
+    const char* camera_script = 0;
+    const char* out_pattern = 0;
+    const char* results = 0;
+    const char* golden_file = 0;
+    const char* trace_path = 0;
+    const char* capture_file = 0;
+    int32_t record = 0;
+    int32_t counters = 0;
+
+    for(int i = 1; i < argc; i += 2) {
+        if(strcmp(argv[i], "-counters") == 0) {
+            counters = 1;
+            i--;
+        }
+        else if(i == argc - 1) {
+            level_id = -1;
+        }
+        else if(strcmp(argv[i], "-level") == 0) {
+            level_id = level_find(argv[i + 1]);
+        }
+        else if(strcmp(argv[i], "-frames") == 0) {
+            frames = atoi(argv[i + 1]);
+        }
+        else if(strcmp(argv[i], "-threads") == 0) {
+            num_threads = atoi(argv[i + 1]);
+        }
+        else if(strcmp(argv[i], "-camera") == 0) {
+            camera_script = argv[i + 1];
+        }
+        else if(strcmp(argv[i], "-out") == 0) {
+            out_pattern = argv[i + 1];
+        }
+        else if(strcmp(argv[i], "-benchmark") == 0) {
+            results = argv[i + 1];
+        }
+        else if(strcmp(argv[i], "-trace") == 0) {
+            trace_path = argv[i + 1];
+        }
+        else if(strcmp(argv[i], "-capture") == 0) {
+            capture_file = argv[i + 1];
+        }
+        else if(strcmp(argv[i], "-verify") == 0 || strcmp(argv[i], "-record") == 0) {
+            golden_file = argv[i + 1];
+            record = strcmp(argv[i], "-record") == 0;
+        }
+        else {
+            level_id = -1;
+        }
+    }
+    if(frames < 0) {
+        frames = results != 0 ? BENCHMARK_FRAMES : RENDER_FRAMES;
+    }
+    if(level_id < 0 || (results != 0 && frames <= BENCHMARK_WARMUP)) {
+        printf(
+            "Usage: %s [-level city|ringworld|core] [-frames n] [-threads n] [-camera script] [-out pattern] [-benchmark results.json] "
+            "[-counters] [-trace trace.json] [-record golden] [-verify golden] [-capture slow_frame.cap]\n",
+            argv[0]
+        );
+        return 1;
+    }
+
+    static camera_path_t path;
+    if(camera_script != 0) {
+        if(!camera_path_load(&path, camera_script)) {
+            printf("Could not read camera script %s\n", camera_script);
+            return 1;
+        }
+    }
+    else {
+        camera_path_flythrough(&path, frames * RENDER_FRAME_TIME);
+    }
+
+    timer_name_thread("main");
+    if(trace_path != 0 && !trace_start(trace_path)) {
+        printf("Could not write trace %s\n", trace_path);
+        return 1;
+    }
+
+    jobs_init(num_threads);
+    int32_t status = 0;
+    if(golden_file != 0) {
+        int32_t mismatches = verify(&path, num_threads, golden_file, record);
+        if(mismatches != 0) {
+            if(mismatches > 0) {
+                printf("FAILED: %d mismatches\n", mismatches);
+            }
+            status = 1;
+        }
+        else {
+            printf("%s %d poses in %d levels, %d ways each\n", record ? "Recorded" : "Verified", VERIFY_POSES, NUM_LEVELS, NUM_VARIANTS);
+        }
+    }
+    else if(results != 0) {
+        if(!benchmark(&path, frames, counters, results)) {
+            printf("Could not write %s\n", results);
+            status = 1;
+        }
+    }
+    else if(capture_file != 0) {
+        if(!render_capture(capture_file, frames, out_pattern)) {
+            status = 1;
+        }
+    }
+    else {
+        render_level(level_id, &path, frames, 0, out_pattern, 0);
+    }
+    jobs_shutdown();
+    trace_stop();
+    return status;
+}
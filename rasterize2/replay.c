@@ -0,0 +1,134 @@
+/**
+* Input recording and replay
+*
+* File layout: "CDRP", version, seed (32 bit each), then one record per step:
+* elapsed (double), a flags byte, the held key bitmask if it changed since
+* the step before, then the number of presses and the pressed keys if there
+* were any. Values are stored in the byte order of the machine recording.
+* Steps are flushed as they are written, so a recording survives the program
+* exiting at any point, minus maybe the last step.
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "replay.h"
+
+#define REPLAY_MAGIC "CDRP"
+#define REPLAY_VERSION 1
+
+#define STEP_HELD_CHANGED 1
+#define STEP_PRESSES 2
+
+struct replay {
+    FILE* file;
+    uint32_t seed;
+    int32_t steps;
+
+    // Held keys of the last step, to only store changes
+    uint8_t held[REPLAY_KEYS / 8];
+};
+
+static replay_t* replay_create(FILE* file, uint32_t seed) {
+    replay_t* replay = (replay_t*)malloc(sizeof(replay_t));
+    memset(replay, 0, sizeof(replay_t));
+    replay->file = file;
+    replay->seed = seed;
+    return replay;
+}
+
+replay_t* replay_record(const char* path, uint32_t seed) {
+    FILE* file = fopen(path, "wb");
+    if(file == 0) {
+        return 0;
+    }
+
+    uint32_t version = REPLAY_VERSION;
+    fwrite(REPLAY_MAGIC, 1, 4, file);
+    fwrite(&version, sizeof(uint32_t), 1, file);
+    fwrite(&seed, sizeof(uint32_t), 1, file);
+    return replay_create(file, seed);
+}
+
+replay_t* replay_play(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if(file == 0) {
+        return 0;
+    }
+
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;
+    if(
+        fread(magic, 1, 4, file) != 4 || memcmp(magic, REPLAY_MAGIC, 4) != 0 ||
+        fread(&version, sizeof(uint32_t), 1, file) != 1 || version != REPLAY_VERSION ||
+        fread(&seed, sizeof(uint32_t), 1, file) != 1
+    ) {
+        fclose(file);
+        return 0;
+    }
+    return replay_create(file, seed);
+}
+
+void replay_close(replay_t* replay) {
+    fclose(replay->file);
+    free(replay);
+}
+
+uint32_t replay_seed(replay_t* replay) {
+    return replay->seed;
+}
+
+int32_t replay_steps(replay_t* replay) {
+    return replay->steps;
+}
+
+void replay_write(replay_t* replay, const replay_input_t* input) {
+    uint8_t flags = 0;
+    flags |= memcmp(input->held, replay->held, sizeof(replay->held)) != 0 ? STEP_HELD_CHANGED : 0;
+    flags |= input->num_presses != 0 ? STEP_PRESSES : 0;
+
+    fwrite(&input->elapsed, sizeof(double), 1, replay->file);
+    fwrite(&flags, 1, 1, replay->file);
+    if(flags & STEP_HELD_CHANGED) {
+        fwrite(input->held, 1, sizeof(input->held), replay->file);
+        memcpy(replay->held, input->held, sizeof(replay->held));
+    }
+    if(flags & STEP_PRESSES) {
+        uint8_t num_presses = (uint8_t)input->num_presses;
+        fwrite(&num_presses, 1, 1, replay->file);
+        fwrite(input->presses, 1, num_presses, replay->file);
+    }
+    fflush(replay->file);
+    replay->steps++;
+}
+
+int32_t replay_read(replay_t* replay, replay_input_t* input) {
+    uint8_t flags;
+    if(fread(&input->elapsed, sizeof(double), 1, replay->file) != 1 || fread(&flags, 1, 1, replay->file) != 1) {
+        return 0;
+    }
+
+    if(flags & STEP_HELD_CHANGED) {
+        if(fread(replay->held, 1, sizeof(replay->held), replay->file) != sizeof(replay->held)) {
+            return 0;
+        }
+    }
+    memcpy(input->held, replay->held, sizeof(replay->held));
+
+    input->num_presses = 0;
+    if(flags & STEP_PRESSES) {
+        uint8_t num_presses;
+        if(fread(&num_presses, 1, 1, replay->file) != 1 || fread(input->presses, 1, num_presses, replay->file) != num_presses) {
+            return 0;
+        }
+        input->num_presses = num_presses;
+    }
+    replay->steps++;
+    return 1;
+}
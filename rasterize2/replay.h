@@ -0,0 +1,57 @@
+/**
+* Input recording and replay: Everything a simulation step takes from the
+* outside (elapsed time, keys held, key presses) and the random seed, logged
+* to a compact binary file and read back, so a session plays out the same
+* way again
+*/
+
+#ifndef __REPLAY_H__
+#define __REPLAY_H__
+
+#include <stdint.h>
+
+#define REPLAY_KEYS 256
+#define REPLAY_MAX_PRESSES 255
+
+// Input for one simulation step. Presses are key codes in the order the
+// simulation handled them.
+typedef struct {
+    double elapsed;
+    uint8_t held[REPLAY_KEYS / 8];
+    int32_t num_presses;
+    uint8_t presses[REPLAY_MAX_PRESSES];
+} replay_input_t;
+
+static inline int32_t replay_key_held(const replay_input_t* input, uint8_t key) {
+    return (input->held[key >> 3] >> (key & 7)) & 1;
+}
+
+static inline void replay_set_key_held(replay_input_t* input, uint8_t key, int32_t held) {
+    if(held) {
+        input->held[key >> 3] |= 1 << (key & 7);
+    }
+    else {
+        input->held[key >> 3] &= ~(1 << (key & 7));
+    }
+}
+
+// A file being recorded or played back
+typedef struct replay replay_t;
+
+// Start recording to path, or open path for playback. 0 if the file can't
+// be opened, or isn't a replay of this version.
+replay_t* replay_record(const char* path, uint32_t seed);
+replay_t* replay_play(const char* path);
+void replay_close(replay_t* replay);
+
+uint32_t replay_seed(replay_t* replay);
+
+// Steps written or read so far
+int32_t replay_steps(replay_t* replay);
+
+// Append a step, or read the next one. Read returns 0 once there are none
+// left.
+void replay_write(replay_t* replay, const replay_input_t* input);
+int32_t replay_read(replay_t* replay, replay_input_t* input);
+
+#endif
@@ -0,0 +1,80 @@
+/**
+* Job system scaling benchmark: Renders every levels static geometry along a
+* fixed orbit with 1 to N threads and prints frame times and speedups.
+* Usage: scaling [max threads] [frames per level]
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "rasterize.h"
+#include "levels.h"
+#include "threads.h"
+#include "timing.h"
+
+#define SCALING_FRAMES 200
+
+// Average ms per frame for one level, circling the arena
+static double run_level(level_t* level, uint8_t* framebuffer, int32_t frames) {
+    imat4x4_t projection = imat4x4perspective(INT_FIXED(45), idiv(INT_FIXED(SCREEN_WIDTH), INT_FIXED(SCREEN_HEIGHT)), ZNEAR, ZFAR);
+    prepare_geometry_storage(level->models, level->num_models);
+
+    double start = nanotime();
+    for(int32_t f = 0; f < frames; f++) {
+        double angle = 2.0 * 3.14159265 * f / frames;
+        ivec3_t eye = ivec3(FLOAT_FIXED(200.0 * sin(angle)), FLOAT_FIXED(60.0), FLOAT_FIXED(200.0 * cos(angle)));
+        ivec3_t lookat = ivec3(FLOAT_FIXED(40.0 * sin(angle + 1.0)), FLOAT_FIXED(40.0), FLOAT_FIXED(40.0 * cos(angle + 1.0)));
+        imat4x4_t camera = imat4x4lookat(eye, lookat, ivec3(0, INT_FIXED(1), 0));
+        rasterize(framebuffer, level->models, level->num_models, camera, projection, level->floor_texture, level->sky_color);
+    }
+    return (nanotime() - start) * 1000.0 / frames;
+}
+
+int main(int argc, char** argv) {
+    int32_t max_threads = argc > 1 ? atoi(argv[1]) : JOB_MAX_THREADS;
+    int32_t frames = argc > 2 ? atoi(argv[2]) : SCALING_FRAMES;
+    max_threads = imax(1, imin(max_threads, JOB_MAX_THREADS));
+
+    static level_t levels[NUM_LEVELS];
+    for(int32_t i = 0; i < NUM_LEVELS; i++) {
+        level_load(&levels[i], i, 0);
+    }
+    uint8_t* framebuffer = (uint8_t*)malloc(SCREEN_WIDTH * SCREEN_HEIGHT);
+
+    printf("threads");
+    for(int i = 0; i < NUM_LEVELS; i++) {
+        printf(" %10s ms", level_name(i));
+    }
+    printf("    speedup\n");
+
+    double base_total = 0.0;
+    for(int32_t threads = 1; threads <= max_threads; threads++) {
+        jobs_init(threads);
+
+        double total = 0.0;
+        printf("%7d", threads);
+        for(int i = 0; i < NUM_LEVELS; i++) {
+            double ms = run_level(&levels[i], framebuffer, frames);
+            total += ms;
+            printf(" %13.3f", ms);
+        }
+        if(threads == 1) {
+            base_total = total;
+        }
+        printf(" %10.2fx\n", base_total / total);
+
+        jobs_shutdown();
+    }
+
+    for(int32_t i = 0; i < NUM_LEVELS; i++) {
+        level_free(&levels[i]);
+    }
+    free_geometry_storage();
+    free(framebuffer);
+    return 0;
+}
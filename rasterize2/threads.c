@@ -0,0 +1,625 @@
+/**
+* Minimal threading: Work-stealing jobs, threads, frame ring, swap chain
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "threads.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef HANDLE thread_t;
+typedef CRITICAL_SECTION mutex_t;
+typedef CONDITION_VARIABLE cond_t;
+
+#define mutex_init(m) InitializeCriticalSection(m)
+#define mutex_destroy(m) DeleteCriticalSection(m)
+#define mutex_lock(m) EnterCriticalSection(m)
+#define mutex_unlock(m) LeaveCriticalSection(m)
+#define cond_init(c) InitializeConditionVariable(c)
+#define cond_destroy(c)
+#define cond_wait(c, m) SleepConditionVariableCS(c, m, INFINITE)
+#define cond_broadcast(c) WakeAllConditionVariable(c)
+#define cond_signal(c) WakeConditionVariable(c)
+#define atomic_add(p, v) InterlockedExchangeAdd((volatile LONG*)(p), v)
+#define atomic_swap(p, v) InterlockedExchange((volatile LONG*)(p), v)
+#define atomic_release(p) InterlockedExchange((volatile LONG*)(p), 0)
+#define cpu_relax() YieldProcessor()
+#define thread_yield() SwitchToThread()
+#define THREAD_LOCAL __declspec(thread)
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+typedef pthread_t thread_t;
+typedef pthread_mutex_t mutex_t;
+typedef pthread_cond_t cond_t;
+
+#define mutex_init(m) pthread_mutex_init(m, 0)
+#define mutex_destroy(m) pthread_mutex_destroy(m)
+#define mutex_lock(m) pthread_mutex_lock(m)
+#define mutex_unlock(m) pthread_mutex_unlock(m)
+#define cond_init(c) pthread_cond_init(c, 0)
+#define cond_destroy(c) pthread_cond_destroy(c)
+#define cond_wait(c, m) pthread_cond_wait(c, m)
+#define cond_broadcast(c) pthread_cond_broadcast(c)
+#define cond_signal(c) pthread_cond_signal(c)
+#define atomic_add(p, v) __sync_fetch_and_add(p, v)
+#define atomic_swap(p, v) __sync_lock_test_and_set(p, v)
+#define atomic_release(p) __sync_lock_release(p)
+#define cpu_relax() __builtin_ia32_pause()
+#define thread_yield() sched_yield()
+#define THREAD_LOCAL __thread
+#endif
+
+// Job system. Every thread that takes part has a deque of jobs: It pushes and
+// pops its own jobs at the bottom, others steal the oldest from the top.
+// Workers own the first queues, other threads (main, simulation) get one of
+// the remaining ones the first time they spawn something.
+#define JOB_QUEUE_SIZE 512
+#define JOB_MAX_EXTERNAL 4
+#define JOB_MAX_QUEUES (JOB_MAX_THREADS + JOB_MAX_EXTERNAL)
+#define JOB_SPINS 64
+
+typedef struct {
+    job_func_t func;
+    void* data;
+    int32_t start;
+    int32_t end;
+    job_group_t* group;
+} job_t;
+
+// Deques are short and jobs coarse, a spinlock per deque is plenty
+typedef struct {
+    volatile int32_t lock;
+    int32_t top;
+    int32_t bottom;
+    job_t jobs[JOB_QUEUE_SIZE];
+} job_queue_t;
+
+static struct {
+    int32_t num_threads;
+    thread_t workers[JOB_MAX_THREADS];
+    job_queue_t queues[JOB_MAX_QUEUES];
+    volatile int32_t num_external;
+    int32_t generation;
+
+    // Queued jobs overall, for sleeping when there is nothing to do
+    volatile int32_t queued;
+    volatile int32_t sleeping;
+    mutex_t lock;
+    cond_t wake;
+    volatile int32_t quit;
+} jobs = { .num_threads = 1 };
+
+// Queue of the current thread, -1 until it has one, and for external
+// threads which jobs_init it was claimed after
+static THREAD_LOCAL int32_t job_slot = -1;
+static THREAD_LOCAL int32_t job_slot_generation = -1;
+
+static void queue_lock(job_queue_t* queue) {
+    while(atomic_swap(&queue->lock, 1) != 0) {
+        while(queue->lock != 0) {
+            cpu_relax();
+        }
+    }
+}
+
+static void queue_unlock(job_queue_t* queue) {
+    atomic_release(&queue->lock);
+}
+
+// Own end
+static int32_t queue_push(job_queue_t* queue, const job_t* job) {
+    queue_lock(queue);
+    if(queue->bottom - queue->top == JOB_QUEUE_SIZE) {
+        queue_unlock(queue);
+        return 0;
+    }
+    queue->jobs[queue->bottom % JOB_QUEUE_SIZE] = *job;
+    queue->bottom++;
+    atomic_add(&jobs.queued, 1);
+    queue_unlock(queue);
+    return 1;
+}
+
+static int32_t queue_pop(job_queue_t* queue, job_t* job) {
+    if(queue->bottom == queue->top) {
+        return 0;
+    }
+    queue_lock(queue);
+    int32_t found = queue->bottom != queue->top;
+    if(found) {
+        queue->bottom--;
+        *job = queue->jobs[queue->bottom % JOB_QUEUE_SIZE];
+        atomic_add(&jobs.queued, -1);
+    }
+    queue_unlock(queue);
+    return found;
+}
+
+// Other end
+static int32_t queue_steal(job_queue_t* queue, job_t* job) {
+    if(queue->bottom == queue->top) {
+        return 0;
+    }
+    queue_lock(queue);
+    int32_t found = queue->bottom != queue->top;
+    if(found) {
+        *job = queue->jobs[queue->top % JOB_QUEUE_SIZE];
+        queue->top++;
+        atomic_add(&jobs.queued, -1);
+    }
+    queue_unlock(queue);
+    return found;
+}
+
+// Queues in use are numbered workers first, then external threads
+static int32_t queue_index(int32_t i) {
+    int32_t num_workers = jobs.num_threads - 1;
+    return i < num_workers ? i : JOB_MAX_THREADS + i - num_workers;
+}
+
+static int32_t queue_number(int32_t slot) {
+    int32_t num_workers = jobs.num_threads - 1;
+    return slot < JOB_MAX_THREADS ? slot : num_workers + slot - JOB_MAX_THREADS;
+}
+
+// Own queue first, then everyone elses, starting after our own
+static int32_t job_take(job_t* job) {
+    if(job_slot >= 0 && queue_pop(&jobs.queues[job_slot], job)) {
+        return 1;
+    }
+
+    int32_t num_queues = jobs.num_threads - 1 + jobs.num_external;
+    int32_t own = job_slot >= 0 ? queue_number(job_slot) : -1;
+    for(int32_t i = 1; i <= num_queues; i++) {
+        int32_t victim = (own + i) % num_queues;
+        if(victim != own && queue_steal(&jobs.queues[queue_index(victim)], job)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void job_run(const job_t* job) {
+    job->func(job->data, job->start, job->end);
+    atomic_add(&job->group->pending, -1);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI job_worker(LPVOID arg) {
+#else
+static void* job_worker(void* arg) {
+#endif
+    job_slot = (int32_t)(intptr_t)arg;
+
+    job_t job;
+    while(!jobs.quit) {
+        // Spin a little before going to sleep, jobs come in bursts
+        int32_t found = 0;
+        for(int32_t spin = 0; spin < JOB_SPINS && !found; spin++) {
+            found = job_take(&job);
+            if(!found) {
+                cpu_relax();
+            }
+        }
+        if(found) {
+            job_run(&job);
+            continue;
+        }
+
+        mutex_lock(&jobs.lock);
+        atomic_add(&jobs.sleeping, 1);
+        while(jobs.queued == 0 && !jobs.quit) {
+            cond_wait(&jobs.wake, &jobs.lock);
+        }
+        atomic_add(&jobs.sleeping, -1);
+        mutex_unlock(&jobs.lock);
+    }
+    return 0;
+}
+
+static int32_t cpu_count() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int32_t)info.dwNumberOfProcessors;
+#else
+    return (int32_t)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
+void jobs_init(int32_t num_threads) {
+    if(jobs.num_threads > 1) {
+        return;
+    }
+
+    if(num_threads <= 0) {
+        num_threads = cpu_count();
+    }
+    num_threads = num_threads < 1 ? 1 : num_threads;
+    num_threads = num_threads > JOB_MAX_THREADS ? JOB_MAX_THREADS : num_threads;
+
+    mutex_init(&jobs.lock);
+    cond_init(&jobs.wake);
+    jobs.quit = 0;
+    jobs.queued = 0;
+    jobs.num_external = 0;
+    jobs.generation++;
+
+    jobs.num_threads = num_threads;
+    for(int32_t i = 0; i < num_threads - 1; i++) {
+#ifdef _WIN32
+        jobs.workers[i] = CreateThread(0, 0, job_worker, (LPVOID)(intptr_t)i, 0, 0);
+#else
+        pthread_create(&jobs.workers[i], 0, job_worker, (void*)(intptr_t)i);
+#endif
+    }
+}
+
+void jobs_shutdown() {
+    if(jobs.num_threads <= 1) {
+        return;
+    }
+
+    mutex_lock(&jobs.lock);
+    jobs.quit = 1;
+    cond_broadcast(&jobs.wake);
+    mutex_unlock(&jobs.lock);
+
+    for(int32_t i = 0; i < jobs.num_threads - 1; i++) {
+#ifdef _WIN32
+        WaitForSingleObject(jobs.workers[i], INFINITE);
+        CloseHandle(jobs.workers[i]);
+#else
+        pthread_join(jobs.workers[i], 0);
+#endif
+    }
+
+    cond_destroy(&jobs.wake);
+    mutex_destroy(&jobs.lock);
+    jobs.num_threads = 1;
+}
+
+int32_t jobs_num_threads() {
+    return jobs.num_threads;
+}
+
+// Give a non-worker thread a queue, if there are any left. Slots from
+// before the last jobs_init are stale.
+static void job_claim_slot() {
+    if(job_slot_generation == jobs.generation) {
+        return;
+    }
+    job_slot_generation = jobs.generation;
+
+    int32_t external = atomic_add(&jobs.num_external, 1);
+    if(external >= JOB_MAX_EXTERNAL) {
+        atomic_add(&jobs.num_external, -1);
+        job_slot = -1;
+        return;
+    }
+    job_slot = JOB_MAX_THREADS + external;
+}
+
+void job_spawn(job_group_t* group, job_func_t func, void* data, int32_t start, int32_t end) {
+    job_t job = { func, data, start, end, group };
+    atomic_add(&group->pending, 1);
+
+    // No workers or no queue: Just do it
+    if(jobs.num_threads <= 1) {
+        job_run(&job);
+        return;
+    }
+    if(job_slot < 0 || job_slot >= JOB_MAX_THREADS) {
+        job_claim_slot();
+    }
+    if(job_slot < 0 || !queue_push(&jobs.queues[job_slot], &job)) {
+        job_run(&job);
+        return;
+    }
+
+    // One more job, one more worker that can take it
+    if(jobs.sleeping != 0) {
+        mutex_lock(&jobs.lock);
+        cond_signal(&jobs.wake);
+        mutex_unlock(&jobs.lock);
+    }
+}
+
+void job_wait(job_group_t* group) {
+    // Help out until the group is done
+    job_t job;
+    int32_t idle = 0;
+    while(group->pending != 0) {
+        if(job_take(&job)) {
+            job_run(&job);
+            idle = 0;
+        }
+        else if(++idle < JOB_SPINS) {
+            cpu_relax();
+        }
+        else {
+            thread_yield();
+        }
+    }
+}
+
+void job_parallel_for(job_func_t func, void* data, int32_t count, int32_t grain) {
+    grain = grain < 1 ? 1 : grain;
+    if(jobs.num_threads <= 1 || count <= grain) {
+        if(count > 0) {
+            func(data, 0, count);
+        }
+        return;
+    }
+
+    // A few pieces per thread so stealing can even out the load, but none
+    // smaller than grain
+    int32_t pieces = jobs.num_threads * 4;
+    int32_t size = (count + pieces - 1) / pieces;
+    size = size < grain ? grain : size;
+
+    // Queue all but the first piece, then do that one right away
+    job_group_t group = { 0 };
+    for(int32_t start = count - (count - 1) % size - 1; start >= size; start -= size) {
+        int32_t end = start + size < count ? start + size : count;
+        job_spawn(&group, func, data, start, end);
+    }
+    func(data, 0, size < count ? size : count);
+    job_wait(&group);
+}
+
+// Threads get func and data through a small heap block
+typedef struct {
+    thread_func_t func;
+    void* data;
+} thread_start_t;
+
+#ifdef _WIN32
+static DWORD WINAPI thread_entry(LPVOID arg) {
+#else
+static void* thread_entry(void* arg) {
+#endif
+    thread_start_t start = *(thread_start_t*)arg;
+    free(arg);
+    start.func(start.data);
+    return 0;
+}
+
+void thread_start(thread_func_t func, void* data) {
+    thread_start_t* start = (thread_start_t*)malloc(sizeof(thread_start_t));
+    start->func = func;
+    start->data = data;
+#ifdef _WIN32
+    CloseHandle(CreateThread(0, 0, thread_entry, start, 0, 0));
+#else
+    pthread_t thread;
+    pthread_create(&thread, 0, thread_entry, start);
+    pthread_detach(thread);
+#endif
+}
+
+// Slot i % num_slots holds frame i. written and read count frames that
+// went through end_write / end_read so far.
+struct frame_ring {
+    mutex_t lock;
+    cond_t changed;
+
+    uint8_t* slots;
+    int32_t num_slots;
+    int32_t slot_size;
+
+    int32_t written;
+    int32_t read;
+};
+
+frame_ring_t* frame_ring_create(int32_t num_slots, int32_t slot_size) {
+    frame_ring_t* ring = (frame_ring_t*)malloc(sizeof(frame_ring_t));
+    mutex_init(&ring->lock);
+    cond_init(&ring->changed);
+    ring->slots = (uint8_t*)calloc(num_slots, slot_size);
+    ring->num_slots = num_slots;
+    ring->slot_size = slot_size;
+    ring->written = 0;
+    ring->read = 0;
+    return ring;
+}
+
+void frame_ring_destroy(frame_ring_t* ring) {
+    cond_destroy(&ring->changed);
+    mutex_destroy(&ring->lock);
+    free(ring->slots);
+    free(ring);
+}
+
+void* frame_ring_begin_write(frame_ring_t* ring) {
+    // The oldest slot may still be in use by the reader
+    mutex_lock(&ring->lock);
+    while(ring->written - ring->read >= ring->num_slots) {
+        cond_wait(&ring->changed, &ring->lock);
+    }
+    int32_t slot = ring->written % ring->num_slots;
+    mutex_unlock(&ring->lock);
+    return &ring->slots[slot * ring->slot_size];
+}
+
+void frame_ring_end_write(frame_ring_t* ring) {
+    mutex_lock(&ring->lock);
+    ring->written++;
+    cond_broadcast(&ring->changed);
+    mutex_unlock(&ring->lock);
+}
+
+void* frame_ring_begin_read(frame_ring_t* ring) {
+    mutex_lock(&ring->lock);
+    while(ring->written == ring->read) {
+        cond_wait(&ring->changed, &ring->lock);
+    }
+    int32_t slot = ring->read % ring->num_slots;
+    mutex_unlock(&ring->lock);
+    return &ring->slots[slot * ring->slot_size];
+}
+
+void frame_ring_end_read(frame_ring_t* ring) {
+    mutex_lock(&ring->lock);
+    ring->read++;
+    cond_broadcast(&ring->changed);
+    mutex_unlock(&ring->lock);
+}
+
+void frame_ring_drain(frame_ring_t* ring) {
+    mutex_lock(&ring->lock);
+    while(ring->written != ring->read) {
+        cond_wait(&ring->changed, &ring->lock);
+    }
+    mutex_unlock(&ring->lock);
+}
+
+// Buffers are free, being drawn, finished and queued for presenting (oldest
+// first), or being presented
+#define SWAP_CHAIN_MAX_BUFFERS 8
+#define BUFFER_FREE 0
+#define BUFFER_DRAWING 1
+#define BUFFER_QUEUED 2
+#define BUFFER_PRESENTING 3
+
+struct swap_chain {
+    mutex_t lock;
+    cond_t queued;
+    cond_t freed;
+    int32_t mailbox;
+
+    uint8_t* buffers;
+    int32_t buffer_size;
+    int32_t num_buffers;
+    int32_t state[SWAP_CHAIN_MAX_BUFFERS];
+
+    int32_t queue[SWAP_CHAIN_MAX_BUFFERS];
+    int32_t queue_length;
+    int32_t drawing;
+    int32_t presenting;
+    int32_t closed;
+
+    swap_chain_stats_t stats;
+};
+
+swap_chain_t* swap_chain_create(int32_t num_buffers, int32_t buffer_size, int32_t mailbox) {
+    num_buffers = num_buffers < 3 ? 3 : num_buffers;
+    num_buffers = num_buffers > SWAP_CHAIN_MAX_BUFFERS ? SWAP_CHAIN_MAX_BUFFERS : num_buffers;
+
+    swap_chain_t* chain = (swap_chain_t*)calloc(1, sizeof(swap_chain_t));
+    mutex_init(&chain->lock);
+    cond_init(&chain->queued);
+    cond_init(&chain->freed);
+    chain->mailbox = mailbox;
+    chain->buffers = (uint8_t*)calloc(num_buffers, buffer_size);
+    chain->buffer_size = buffer_size;
+    chain->num_buffers = num_buffers;
+    chain->drawing = -1;
+    chain->presenting = -1;
+    return chain;
+}
+
+void swap_chain_destroy(swap_chain_t* chain) {
+    cond_destroy(&chain->queued);
+    cond_destroy(&chain->freed);
+    mutex_destroy(&chain->lock);
+    free(chain->buffers);
+    free(chain);
+}
+
+void* swap_chain_begin_draw(swap_chain_t* chain) {
+    mutex_lock(&chain->lock);
+    int32_t buffer = -1;
+    while(1) {
+        for(int32_t i = 0; i < chain->num_buffers && buffer == -1; i++) {
+            if(chain->state[i] == BUFFER_FREE) {
+                buffer = i;
+            }
+        }
+        if(buffer != -1) {
+            break;
+        }
+
+        // Nothing free: Wait for the presenting thread, or in mailbox mode drop
+        // the oldest frame nobody has looked at yet. With one buffer presented
+        // and none being drawn, at least two are queued.
+        if(chain->mailbox) {
+            buffer = chain->queue[0];
+            chain->queue_length--;
+            memmove(&chain->queue[0], &chain->queue[1], sizeof(int32_t) * chain->queue_length);
+            chain->stats.dropped++;
+            break;
+        }
+        cond_wait(&chain->freed, &chain->lock);
+    }
+
+    chain->state[buffer] = BUFFER_DRAWING;
+    chain->drawing = buffer;
+    mutex_unlock(&chain->lock);
+    return &chain->buffers[buffer * chain->buffer_size];
+}
+
+void swap_chain_submit(swap_chain_t* chain) {
+    mutex_lock(&chain->lock);
+    chain->state[chain->drawing] = BUFFER_QUEUED;
+    chain->queue[chain->queue_length++] = chain->drawing;
+    chain->drawing = -1;
+    chain->stats.submitted++;
+    cond_signal(&chain->queued);
+    mutex_unlock(&chain->lock);
+}
+
+void swap_chain_close(swap_chain_t* chain) {
+    mutex_lock(&chain->lock);
+    chain->closed = 1;
+    cond_signal(&chain->queued);
+    mutex_unlock(&chain->lock);
+}
+
+void* swap_chain_acquire(swap_chain_t* chain) {
+    mutex_lock(&chain->lock);
+
+    // Done with the last one
+    if(chain->presenting != -1 && chain->state[chain->presenting] == BUFFER_PRESENTING) {
+        chain->state[chain->presenting] = BUFFER_FREE;
+        cond_signal(&chain->freed);
+    }
+    chain->presenting = -1;
+
+    while(chain->queue_length == 0 && !chain->closed) {
+        cond_wait(&chain->queued, &chain->lock);
+    }
+    if(chain->queue_length == 0) {
+        mutex_unlock(&chain->lock);
+        return 0;
+    }
+    int32_t buffer = chain->queue[0];
+    chain->queue_length--;
+    memmove(&chain->queue[0], &chain->queue[1], sizeof(int32_t) * chain->queue_length);
+
+    chain->state[buffer] = BUFFER_PRESENTING;
+    chain->presenting = buffer;
+    chain->stats.presented++;
+    chain->stats.queue_depth_total += chain->queue_length;
+    mutex_unlock(&chain->lock);
+    return &chain->buffers[buffer * chain->buffer_size];
+}
+
+void swap_chain_get_stats(swap_chain_t* chain, swap_chain_stats_t* stats) {
+    mutex_lock(&chain->lock);
+    *stats = chain->stats;
+    mutex_unlock(&chain->lock);
+}
+
+void swap_chain_reset_stats(swap_chain_t* chain) {
+    mutex_lock(&chain->lock);
+    memset(&chain->stats, 0, sizeof(swap_chain_stats_t));
+    mutex_unlock(&chain->lock);
+}
@@ -0,0 +1,94 @@
+/**
+* Minimal threading: A work-stealing job system with fork-join and parallel
+* for helpers, plain long-running threads, a ring of fixed size slots for
+* handing frames from one thread to another, and a swap chain for finished
+* images
+*/
+
+#ifndef __THREADS_H__
+#define __THREADS_H__
+
+#include <stdint.h>
+
+#define JOB_MAX_THREADS 16
+
+// A job: Called with the range it was given, from any thread
+typedef void (*job_func_t)(void* data, int32_t start, int32_t end);
+
+// Jobs spawned into a group that have not finished yet
+typedef struct {
+    volatile int32_t pending;
+} job_group_t;
+
+// Start num_threads - 1 workers, every thread that waits on jobs helps out.
+// 0 picks the number of CPUs. Without workers, everything runs inline.
+void jobs_init(int32_t num_threads);
+void jobs_shutdown();
+
+// Number of threads working on jobs, including the caller
+int32_t jobs_num_threads();
+
+// Fork-join: Queue func(data, start, end) as part of group, then wait until
+// all of the groups jobs are done. Jobs may spawn and wait themselves. Any
+// thread can spawn, a handful of non-worker threads at once.
+void job_spawn(job_group_t* group, job_func_t func, void* data, int32_t start, int32_t end);
+void job_wait(job_group_t* group);
+
+// Run func over [0, count) in pieces of at least grain and wait for it
+void job_parallel_for(job_func_t func, void* data, int32_t count, int32_t grain);
+
+// Start a thread running func(data). It runs until func returns or the
+// program exits.
+typedef void (*thread_func_t)(void* data);
+void thread_start(thread_func_t func, void* data);
+
+// Single producer, single consumer ring of num_slots slots of slot_size bytes.
+// The writer fills a slot between begin_write and end_write, blocking while
+// all other slots are still unread. The reader gets slots in order between
+// begin_read and end_read, blocking while there is nothing new.
+typedef struct frame_ring frame_ring_t;
+
+frame_ring_t* frame_ring_create(int32_t num_slots, int32_t slot_size);
+void frame_ring_destroy(frame_ring_t* ring);
+
+void* frame_ring_begin_write(frame_ring_t* ring);
+void frame_ring_end_write(frame_ring_t* ring);
+void* frame_ring_begin_read(frame_ring_t* ring);
+void frame_ring_end_read(frame_ring_t* ring);
+
+// Wait until the reader has finished everything written so far
+void frame_ring_drain(frame_ring_t* ring);
+
+// Swap chain of num_buffers (at least 3) buffers of buffer_size bytes between
+// a thread that draws frames and one that presents them. If no buffer is
+// free, the drawing thread waits until the presenting thread is done with
+// one, so it runs at most num_buffers - 2 frames ahead of the one shown. In
+// mailbox mode it never waits: The oldest finished frame that was not
+// presented yet is dropped and its buffer reused instead. The buffer being
+// presented is never drawn over. The presenting thread waits for a finished
+// frame and holds on to it until the next acquire. After the drawing thread
+// closes the chain, acquire still hands out the frames that are queued, then
+// returns 0.
+typedef struct swap_chain swap_chain_t;
+
+// Counts since the last reset. queue_depth_total sums up, for every presented
+// frame, how many finished frames were still waiting behind it.
+typedef struct {
+    int32_t submitted;
+    int32_t presented;
+    int32_t dropped;
+    int64_t queue_depth_total;
+} swap_chain_stats_t;
+
+swap_chain_t* swap_chain_create(int32_t num_buffers, int32_t buffer_size, int32_t mailbox);
+void swap_chain_destroy(swap_chain_t* chain);
+
+void* swap_chain_begin_draw(swap_chain_t* chain);
+void swap_chain_submit(swap_chain_t* chain);
+void swap_chain_close(swap_chain_t* chain);
+void* swap_chain_acquire(swap_chain_t* chain);
+
+void swap_chain_get_stats(swap_chain_t* chain, swap_chain_stats_t* stats);
+void swap_chain_reset_stats(swap_chain_t* chain);
+
+#endif
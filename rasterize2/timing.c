@@ -1,4 +1,21 @@
 #include <stdint.h>
+#include <string.h>
+
+#include "timing.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+#ifdef __linux__
+#define TIMER_PERF_EVENT
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -56,3 +73,357 @@ uint64_t time_diff() {
     last = now;
     return delta_us;
 }
+
+// Time in seconds to nanosecond accuracy.
+// qpf every round because it can apparently change?
+#ifdef _WIN32
+double nanotime() {
+    LARGE_INTEGER li;
+    QueryPerformanceFrequency(&li);
+    double qpcFreq = (double)li.QuadPart;
+    QueryPerformanceCounter(&li);
+    double qpcVal = (double)li.QuadPart;
+    double qpcProper = qpcVal / qpcFreq;
+    return qpcProper;
+}
+#else
+double nanotime() {
+    struct timespec curtime;
+    clock_gettime(CLOCK_MONOTONIC, &curtime);
+    return((double)curtime.tv_sec + 1.0e-9 * curtime.tv_nsec);
+}
+#endif
+
+// Tick source and the few atomics the timer rings need
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define TIMER_RDTSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#define atomic_increment(p) (_InterlockedIncrement((volatile long*)(p)) - 1)
+#define load_acquire(p) (_ReadWriteBarrier(), *(p))
+#define store_release(p, v) do { _ReadWriteBarrier(); *(p) = (v); } while(0)
+#define read_fence() _ReadWriteBarrier()
+#else
+#define THREAD_LOCAL __thread
+#define atomic_increment(p) __sync_fetch_and_add(p, 1)
+#define load_acquire(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define store_release(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define read_fence() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#endif
+
+// One writer per ring. Readers copy events, then check the writer has not
+// come around to those slots again in the meantime.
+typedef struct {
+    timer_event_t events[TIMER_RING_SIZE];
+    volatile uint32_t written;
+    const char* volatile name;
+} timer_ring_t;
+
+static timer_ring_t timer_rings[TIMER_MAX_RINGS];
+static volatile int32_t timer_rings_used = 0;
+
+// Per thread: Own ring (0 until the first timer_end, -1 if all were taken),
+// current frame number and the stack of open scopes
+static THREAD_LOCAL timer_ring_t* timer_ring = 0;
+static THREAD_LOCAL int32_t timer_frame = 0;
+static THREAD_LOCAL const char* timer_names[TIMER_MAX_DEPTH];
+static THREAD_LOCAL uint64_t timer_starts[TIMER_MAX_DEPTH];
+static THREAD_LOCAL int32_t timer_depth = 0;
+static THREAD_LOCAL uint64_t timer_counter_starts[TIMER_MAX_DEPTH][TIMER_COUNTERS];
+
+// Counters: One perf_event group per thread, led by the cycle counter, so a
+// single read of the leader gets all of a threads counts
+#define TIMER_MAX_COUNTED_THREADS 64
+
+static int32_t counter_fds[TIMER_MAX_COUNTED_THREADS][TIMER_COUNTERS];
+static int32_t num_counter_groups = 0;
+static volatile int32_t counters_enabled = 0;
+
+uint64_t timer_ticks() {
+#ifdef TIMER_RDTSC
+    return __rdtsc();
+#else
+    struct timespec curtime;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &curtime);
+    return (uint64_t)curtime.tv_sec * 1000000000 + curtime.tv_nsec;
+#endif
+}
+
+// rdtsc runs at a constant rate on anything recent, measure it once against
+// the wall clock
+double timer_ticks_to_seconds(uint64_t ticks) {
+#ifdef TIMER_RDTSC
+    static double seconds_per_tick = 0.0;
+    if(seconds_per_tick == 0.0) {
+        double start_time = nanotime();
+        uint64_t start_ticks = timer_ticks();
+        double end_time;
+        do {
+            end_time = nanotime();
+        } while(end_time - start_time < 0.005);
+        seconds_per_tick = (end_time - start_time) / (double)(timer_ticks() - start_ticks);
+    }
+    return ticks * seconds_per_tick;
+#else
+    return ticks * 1.0e-9;
+#endif
+}
+
+#ifdef TIMER_PERF_EVENT
+static int32_t open_counter(int32_t thread, int32_t group, uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int32_t)syscall(__NR_perf_event_open, &attr, thread, -1, group, 0);
+}
+
+// Group for one thread, 0 if any of the counters can't be opened
+static int32_t open_counter_group(int32_t thread, int32_t* fds) {
+    static const uint64_t configs[TIMER_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    for(int32_t i = 0; i < TIMER_COUNTERS; i++) {
+        fds[i] = open_counter(thread, i == 0 ? -1 : fds[0], PERF_TYPE_HARDWARE, configs[i]);
+        if(fds[i] < 0) {
+            for(int32_t j = i - 1; j >= 0; j--) {
+                close(fds[j]);
+            }
+            return 0;
+        }
+    }
+    return 1;
+}
+#endif
+
+int32_t timer_counters_enable() {
+#ifdef TIMER_PERF_EVENT
+    if(counters_enabled) {
+        return 1;
+    }
+
+    DIR* tasks = opendir("/proc/self/task");
+    if(tasks == 0) {
+        return 0;
+    }
+    struct dirent* entry;
+    while((entry = readdir(tasks)) != 0 && num_counter_groups < TIMER_MAX_COUNTED_THREADS) {
+        if(entry->d_name[0] == '.') {
+            continue;
+        }
+        if(!open_counter_group(atoi(entry->d_name), counter_fds[num_counter_groups])) {
+            closedir(tasks);
+            timer_counters_disable();
+            return 0;
+        }
+        num_counter_groups++;
+    }
+    closedir(tasks);
+
+    store_release(&counters_enabled, 1);
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void timer_counters_disable() {
+    counters_enabled = 0;
+#ifdef TIMER_PERF_EVENT
+    for(int32_t i = 0; i < num_counter_groups; i++) {
+        for(int32_t j = 0; j < TIMER_COUNTERS; j++) {
+            close(counter_fds[i][j]);
+        }
+    }
+#endif
+    num_counter_groups = 0;
+}
+
+// Counts so far, summed over all counted threads
+static void read_counters(uint64_t* counts) {
+    memset(counts, 0, sizeof(uint64_t) * TIMER_COUNTERS);
+#ifdef TIMER_PERF_EVENT
+    for(int32_t i = 0; i < num_counter_groups; i++) {
+        uint64_t values[1 + TIMER_COUNTERS];
+        if(read(counter_fds[i][0], values, sizeof(values)) == (ssize_t)sizeof(values)) {
+            for(int32_t j = 0; j < TIMER_COUNTERS; j++) {
+                counts[j] += values[1 + j];
+            }
+        }
+    }
+#endif
+}
+
+// Calling threads ring, 0 if there are none left
+static timer_ring_t* own_ring() {
+    if(timer_ring == 0) {
+        int32_t ring = atomic_increment(&timer_rings_used);
+        timer_ring = ring < TIMER_MAX_RINGS ? &timer_rings[ring] : (timer_ring_t*)-1;
+    }
+    return timer_ring != (timer_ring_t*)-1 ? timer_ring : 0;
+}
+
+void timer_set_frame(int32_t frame) {
+    timer_frame = frame;
+}
+
+void timer_name_thread(const char* name) {
+    timer_ring_t* ring = own_ring();
+    if(ring != 0) {
+        ring->name = name;
+    }
+}
+
+void timer_begin(const char* name) {
+    if(timer_depth < TIMER_MAX_DEPTH) {
+        timer_names[timer_depth] = name;
+        if(counters_enabled) {
+            read_counters(timer_counter_starts[timer_depth]);
+        }
+        timer_starts[timer_depth] = timer_ticks();
+    }
+    timer_depth++;
+}
+
+double timer_end() {
+    uint64_t end = timer_ticks();
+    timer_depth--;
+    if(timer_depth >= TIMER_MAX_DEPTH) {
+        return 0.0;
+    }
+
+    uint64_t counts[TIMER_COUNTERS] = { 0 };
+    if(counters_enabled) {
+        read_counters(counts);
+        for(int32_t i = 0; i < TIMER_COUNTERS; i++) {
+            counts[i] -= timer_counter_starts[timer_depth][i];
+        }
+    }
+
+    timer_ring_t* ring = own_ring();
+    if(ring != 0) {
+        uint32_t written = ring->written;
+        timer_event_t* event = &ring->events[written % TIMER_RING_SIZE];
+        event->name = timer_names[timer_depth];
+        event->start = timer_starts[timer_depth];
+        event->end = end;
+        event->depth = timer_depth;
+        event->frame = timer_frame;
+        memcpy(event->counters, counts, sizeof(counts));
+        store_release(&ring->written, written + 1);
+    }
+    return timer_ticks_to_seconds(end - timer_starts[timer_depth]);
+}
+
+int32_t timer_num_rings() {
+    int32_t used = load_acquire(&timer_rings_used);
+    return used < TIMER_MAX_RINGS ? used : TIMER_MAX_RINGS;
+}
+
+int32_t timer_read_ring_from(int32_t ring, uint32_t* position, timer_event_t* events, int32_t max) {
+    timer_ring_t* source = &timer_rings[ring];
+    uint32_t written = load_acquire(&source->written);
+    uint32_t first = written - *position > TIMER_RING_SIZE ? written - TIMER_RING_SIZE : *position;
+    uint32_t count = written - first;
+    count = count < (uint32_t)max ? count : (uint32_t)max;
+
+    for(uint32_t i = 0; i < count; i++) {
+        events[i] = source->events[(first + i) % TIMER_RING_SIZE];
+    }
+
+    // Drop whatever got overwritten while copying
+    read_fence();
+    uint32_t now_written = source->written;
+    uint32_t lost = now_written - first > TIMER_RING_SIZE - 1 ? now_written - first - (TIMER_RING_SIZE - 1) : 0;
+    lost = lost < count ? lost : count;
+    memmove(events, &events[lost], sizeof(timer_event_t) * (count - lost));
+    *position = first + count;
+    return count - lost;
+}
+
+int32_t timer_read_ring(int32_t ring, timer_event_t* events, int32_t max) {
+    uint32_t written = load_acquire(&timer_rings[ring].written);
+    uint32_t count = written < (uint32_t)max ? written : (uint32_t)max;
+    uint32_t position = written - count;
+    return timer_read_ring_from(ring, &position, events, max);
+}
+
+const char* timer_ring_name(int32_t ring) {
+    return timer_rings[ring].name;
+}
+
+// Newest event for each of the names over all rings, reading every ring once.
+// best[n].end is 0 where there is none.
+static void timer_find_last(const char* const* names, int32_t count, timer_event_t* best) {
+    static THREAD_LOCAL timer_event_t events[TIMER_RING_SIZE];
+    for(int32_t n = 0; n < count; n++) {
+        best[n].end = 0;
+    }
+    for(int32_t ring = 0; ring < timer_num_rings(); ring++) {
+        int32_t num_events = timer_read_ring(ring, events, TIMER_RING_SIZE);
+
+        // Newest first, each name only once per ring
+        int32_t found[TIMER_LAST_MAX_NAMES] = { 0 };
+        int32_t num_found = 0;
+        for(int32_t i = num_events - 1; i >= 0 && num_found < count; i--) {
+            // Names are usually the same literal, compare strings only if not
+            int32_t n = 0;
+            while(n < count && events[i].name != names[n]) {
+                n++;
+            }
+            for(int32_t m = 0; n == count && m < count; m++) {
+                n = strcmp(events[i].name, names[m]) == 0 ? m : count;
+            }
+            if(n == count || found[n]) {
+                continue;
+            }
+
+            found[n] = 1;
+            num_found++;
+            if(events[i].end > best[n].end) {
+                best[n] = events[i];
+            }
+        }
+    }
+}
+
+double timer_last(const char* name) {
+    timer_event_t best;
+    timer_find_last(&name, 1, &best);
+    return best.end != 0 ? timer_ticks_to_seconds(best.end - best.start) : 0.0;
+}
+
+void timer_last_many(const char* const* names, int32_t count, double* seconds) {
+    timer_event_t best[TIMER_LAST_MAX_NAMES];
+    int32_t num_names = count < TIMER_LAST_MAX_NAMES ? count : TIMER_LAST_MAX_NAMES;
+    timer_find_last(names, num_names, best);
+    for(int32_t n = 0; n < count; n++) {
+        seconds[n] = n < num_names && best[n].end != 0 ? timer_ticks_to_seconds(best[n].end - best[n].start) : 0.0;
+    }
+}
+
+void timer_last_counters(const char* name, uint64_t* counts) {
+    timer_event_t best;
+    timer_find_last(&name, 1, &best);
+    if(best.end != 0) {
+        memcpy(counts, best.counters, sizeof(uint64_t) * TIMER_COUNTERS);
+    }
+    else {
+        memset(counts, 0, sizeof(uint64_t) * TIMER_COUNTERS);
+    }
+}
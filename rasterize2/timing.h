@@ -4,5 +4,78 @@
 #include <stdint.h>
 
 uint64_t time_diff();
+double nanotime();
 
-#endif
\ No newline at end of file
+// Scoped timers: Put timer_begin("name") / timer_end() around a stage, nested
+// as deep as TIMER_MAX_DEPTH. Each thread records finished scopes into its
+// own ring buffer of the last TIMER_RING_SIZE, which any thread can read.
+// Ticks come from rdtsc where there is one, else CLOCK_MONOTONIC_RAW. Names
+// are kept as pointers, so use string literals.
+#define TIMER_RING_SIZE 256
+#define TIMER_MAX_RINGS 32
+#define TIMER_MAX_DEPTH 16
+
+// Optional hardware counters over the same scopes, from perf_event on Linux:
+// Cycles, instructions, cache misses and branch misses. Enabling opens them
+// for every thread the process has at that point, threads started later are
+// not counted. Counts are summed over the whole process, so they only mean
+// something for scopes nothing else runs alongside, like the renderer stages
+// in the offline tools. Without counters, events count all zeros.
+#define TIMER_CYCLES 0
+#define TIMER_INSTRUCTIONS 1
+#define TIMER_CACHE_MISSES 2
+#define TIMER_BRANCH_MISSES 3
+#define TIMER_COUNTERS 4
+
+typedef struct {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+    int32_t depth;
+    int32_t frame;
+    uint64_t counters[TIMER_COUNTERS];
+} timer_event_t;
+
+uint64_t timer_ticks();
+double timer_ticks_to_seconds(uint64_t ticks);
+
+// timer_end returns the seconds since the matching timer_begin
+void timer_begin(const char* name);
+double timer_end();
+
+// Seconds the most recently finished scope with this name took, on any
+// thread, 0 if there is none in the rings
+double timer_last(const char* name);
+
+// timer_last for up to TIMER_LAST_MAX_NAMES names at once, reading every ring
+// only once. Names past that get 0.
+#define TIMER_LAST_MAX_NAMES 32
+void timer_last_many(const char* const* names, int32_t count, double* seconds);
+
+// Returns 0 if there are no counters to be had (not Linux, no PMU, not
+// permitted by perf_event_paranoid)
+int32_t timer_counters_enable();
+void timer_counters_disable();
+
+// Counts of the most recently finished scope with this name, like timer_last
+void timer_last_counters(const char* name, uint64_t* counts);
+
+// Tags for what the calling thread records from here on: The frame number it
+// works on, and a name for its ring (a string literal)
+void timer_set_frame(int32_t frame);
+void timer_name_thread(const char* name);
+
+// Rings handed out so far (one per thread that used timers), and a copy of
+// up to max of the newest events of one of them, oldest first
+int32_t timer_num_rings();
+int32_t timer_read_ring(int32_t ring, timer_event_t* events, int32_t max);
+
+// For following a ring: Events from position (counting every event the ring
+// ever got) on, oldest first, up to max. Moves position past what was read
+// and what was overwritten before it could be, returns how many were read.
+int32_t timer_read_ring_from(int32_t ring, uint32_t* position, timer_event_t* events, int32_t max);
+
+// Name the rings thread gave itself, 0 if none
+const char* timer_ring_name(int32_t ring);
+
+#endif
@@ -1,11490 +0,0 @@
-/**
- * Model: tower
- */
-
-#include "rasterize.h"
-
-#define NUM_VERTICES 2061
-#define NUM_NORMALS 2730
-#define NUM_TEXCOORDS 3305
-#define NUM_FACES 3348
-
-static vertex_t vertices[] = {
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(170.15248), FLOAT_FIXED(-26.90098)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(170.15248), FLOAT_FIXED(-26.90098)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(170.19442), FLOAT_FIXED(-27.05992)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(170.0303), FLOAT_FIXED(-26.43804)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(170.0303), FLOAT_FIXED(-26.43804)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(169.83338), FLOAT_FIXED(-25.69184)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(169.83338), FLOAT_FIXED(-25.69184)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(169.56716), FLOAT_FIXED(-24.68314)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(169.56716), FLOAT_FIXED(-24.68314)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(169.23718), FLOAT_FIXED(-23.43272)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(169.23718), FLOAT_FIXED(-23.43272)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(168.84886), FLOAT_FIXED(-21.96134)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(169.1411), FLOAT_FIXED(-23.06872)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(169.17374), FLOAT_FIXED(-23.19234)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(169.1411), FLOAT_FIXED(-23.06872)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(168.84886), FLOAT_FIXED(-21.96134)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(169.04608), FLOAT_FIXED(-22.70866)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(169.04608), FLOAT_FIXED(-22.70866)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(168.89292), FLOAT_FIXED(-22.12828)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(168.89292), FLOAT_FIXED(-22.12826)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(168.68586), FLOAT_FIXED(-21.34372)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(168.68586), FLOAT_FIXED(-21.34372)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(168.4077), FLOAT_FIXED(-20.28976)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(168.4077), FLOAT_FIXED(-20.28976)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(168.4292), FLOAT_FIXED(-20.37118)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(168.4292), FLOAT_FIXED(-20.37118)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(168.12718), FLOAT_FIXED(-19.22678)}, 
-    {FLOAT_FIXED(-0.89036), FLOAT_FIXED(168.12718), FLOAT_FIXED(-19.22678)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(167.91922), FLOAT_FIXED(-18.43876)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(167.91922), FLOAT_FIXED(-18.43876)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(167.78406), FLOAT_FIXED(-17.92666)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(167.78406), FLOAT_FIXED(-17.92666)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(167.38884), FLOAT_FIXED(-16.4291)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(167.38884), FLOAT_FIXED(-16.4291)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(167.40412), FLOAT_FIXED(-16.487)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(167.40412), FLOAT_FIXED(-16.487)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(166.99162), FLOAT_FIXED(-14.92392)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(166.99162), FLOAT_FIXED(-14.92392)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(166.8221), FLOAT_FIXED(-14.28154)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(166.8221), FLOAT_FIXED(-14.28154)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(166.55078), FLOAT_FIXED(-13.2536)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(166.55078), FLOAT_FIXED(-13.2536)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(166.2244), FLOAT_FIXED(-12.01686)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(166.2244), FLOAT_FIXED(-12.01686)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(166.08594), FLOAT_FIXED(-11.49218)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(166.08592), FLOAT_FIXED(-11.49218)}, 
-    {FLOAT_FIXED(27.0083), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(-8.9917), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(23.0083), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(-4.9917), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(164.9782), FLOAT_FIXED(-7.29476)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(165.11668), FLOAT_FIXED(-7.81944)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(165.11668), FLOAT_FIXED(-7.81944)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(164.9782), FLOAT_FIXED(-7.29476)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(164.65182), FLOAT_FIXED(-6.05802)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(164.65182), FLOAT_FIXED(-6.058)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(164.38054), FLOAT_FIXED(-5.03006)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(164.38052), FLOAT_FIXED(-5.03006)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(164.21098), FLOAT_FIXED(-4.38768)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(164.21098), FLOAT_FIXED(-4.38768)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(163.81376), FLOAT_FIXED(-2.88252)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(163.81376), FLOAT_FIXED(-2.8825)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(163.79848), FLOAT_FIXED(-2.82462)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(163.79848), FLOAT_FIXED(-2.82462)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(163.28338), FLOAT_FIXED(-0.87286)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(163.28338), FLOAT_FIXED(-0.87286)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(163.41854), FLOAT_FIXED(-1.38496)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(163.41854), FLOAT_FIXED(-1.38496)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(163.07542), FLOAT_FIXED(-0.08484)}, 
-    {FLOAT_FIXED(-0.89034), FLOAT_FIXED(163.07542), FLOAT_FIXED(-0.08484)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(162.7949), FLOAT_FIXED(0.97814)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(162.7949), FLOAT_FIXED(0.97814)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(162.7734), FLOAT_FIXED(1.05956)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(162.7734), FLOAT_FIXED(1.05956)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(162.35374), FLOAT_FIXED(2.64972)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(162.35374), FLOAT_FIXED(2.64972)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(162.51674), FLOAT_FIXED(2.03212)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(162.51674), FLOAT_FIXED(2.03212)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(162.30968), FLOAT_FIXED(2.81666)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(162.30968), FLOAT_FIXED(2.81666)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(161.96544), FLOAT_FIXED(4.1211)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(161.96544), FLOAT_FIXED(4.1211)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(162.15652), FLOAT_FIXED(3.39704)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(162.15652), FLOAT_FIXED(3.39704)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(162.0615), FLOAT_FIXED(3.75712)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(162.0615), FLOAT_FIXED(3.75712)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(162.02886), FLOAT_FIXED(3.88072)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(161.63544), FLOAT_FIXED(5.37152)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(161.63544), FLOAT_FIXED(5.37152)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(161.36922), FLOAT_FIXED(6.38022)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(161.36922), FLOAT_FIXED(6.38022)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(161.1723), FLOAT_FIXED(7.12642)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(161.1723), FLOAT_FIXED(7.12642)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(161.05012), FLOAT_FIXED(7.58938)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(161.05012), FLOAT_FIXED(7.58938)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(161.00818), FLOAT_FIXED(7.7483)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(168.60544), FLOAT_FIXED(-27.30926)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(168.60544), FLOAT_FIXED(-27.30926)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(168.64738), FLOAT_FIXED(-27.4682)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(168.48328), FLOAT_FIXED(-26.84632)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(168.48328), FLOAT_FIXED(-26.84632)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(168.28634), FLOAT_FIXED(-26.1001)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(168.28634), FLOAT_FIXED(-26.1001)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(168.02014), FLOAT_FIXED(-25.0914)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(168.02014), FLOAT_FIXED(-25.0914)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(167.69012), FLOAT_FIXED(-23.84098)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(167.69012), FLOAT_FIXED(-23.84098)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(167.59408), FLOAT_FIXED(-23.477)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(167.30182), FLOAT_FIXED(-22.36962)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(167.6267), FLOAT_FIXED(-23.60062)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(167.59408), FLOAT_FIXED(-23.477)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(167.30182), FLOAT_FIXED(-22.36962)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(167.49904), FLOAT_FIXED(-23.11694)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(167.49904), FLOAT_FIXED(-23.11692)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(167.34588), FLOAT_FIXED(-22.53654)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(167.34588), FLOAT_FIXED(-22.53654)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(167.13882), FLOAT_FIXED(-21.752)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(167.13882), FLOAT_FIXED(-21.752)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(166.86068), FLOAT_FIXED(-20.69804)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(166.86068), FLOAT_FIXED(-20.69804)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(166.88218), FLOAT_FIXED(-20.77946)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(166.88218), FLOAT_FIXED(-20.77946)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(166.58014), FLOAT_FIXED(-19.63506)}, 
-    {FLOAT_FIXED(-0.89036), FLOAT_FIXED(166.58014), FLOAT_FIXED(-19.63504)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(166.37218), FLOAT_FIXED(-18.84704)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(166.37218), FLOAT_FIXED(-18.84704)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(166.23704), FLOAT_FIXED(-18.33494)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(166.23704), FLOAT_FIXED(-18.33494)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(165.8418), FLOAT_FIXED(-16.83738)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(165.8418), FLOAT_FIXED(-16.83738)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(165.85708), FLOAT_FIXED(-16.89528)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(165.85708), FLOAT_FIXED(-16.89528)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(165.44458), FLOAT_FIXED(-15.3322)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(165.44458), FLOAT_FIXED(-15.3322)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(165.27506), FLOAT_FIXED(-14.68982)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(165.27504), FLOAT_FIXED(-14.68982)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(165.00376), FLOAT_FIXED(-13.66188)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(165.00376), FLOAT_FIXED(-13.66188)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(164.67738), FLOAT_FIXED(-12.42514)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(164.67738), FLOAT_FIXED(-12.42514)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(164.5389), FLOAT_FIXED(-11.90046)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(164.5389), FLOAT_FIXED(-11.90046)}, 
-    {FLOAT_FIXED(27.0083), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(-8.9917), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(23.0083), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(-4.9917), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(163.43116), FLOAT_FIXED(-7.70302)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(163.56962), FLOAT_FIXED(-8.2277)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(163.56964), FLOAT_FIXED(-8.22772)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(163.43116), FLOAT_FIXED(-7.70304)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(163.10478), FLOAT_FIXED(-6.46628)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(163.10478), FLOAT_FIXED(-6.46628)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(162.83348), FLOAT_FIXED(-5.43834)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(162.83348), FLOAT_FIXED(-5.43834)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(162.66396), FLOAT_FIXED(-4.79596)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(162.66396), FLOAT_FIXED(-4.79596)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(162.26674), FLOAT_FIXED(-3.29078)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(162.26674), FLOAT_FIXED(-3.29078)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(162.25146), FLOAT_FIXED(-3.2329)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(162.25146), FLOAT_FIXED(-3.2329)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(161.73636), FLOAT_FIXED(-1.28112)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(161.73636), FLOAT_FIXED(-1.28112)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(161.8715), FLOAT_FIXED(-1.79324)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(161.8715), FLOAT_FIXED(-1.79322)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(161.5284), FLOAT_FIXED(-0.49312)}, 
-    {FLOAT_FIXED(-0.89034), FLOAT_FIXED(161.5284), FLOAT_FIXED(-0.49312)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(161.24786), FLOAT_FIXED(0.56988)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(161.24786), FLOAT_FIXED(0.56988)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(161.22636), FLOAT_FIXED(0.65128)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(161.22636), FLOAT_FIXED(0.65128)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(160.80672), FLOAT_FIXED(2.24144)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(160.80672), FLOAT_FIXED(2.24144)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(160.96972), FLOAT_FIXED(1.62384)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(160.96972), FLOAT_FIXED(1.62384)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(160.76266), FLOAT_FIXED(2.40838)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(160.76266), FLOAT_FIXED(2.40838)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(160.4184), FLOAT_FIXED(3.71282)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(160.4184), FLOAT_FIXED(3.71282)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(160.6095), FLOAT_FIXED(2.98876)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(160.6095), FLOAT_FIXED(2.98876)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(160.51446), FLOAT_FIXED(3.34884)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(160.51446), FLOAT_FIXED(3.34884)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(160.48184), FLOAT_FIXED(3.47244)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(160.0884), FLOAT_FIXED(4.96324)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(160.0884), FLOAT_FIXED(4.96324)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(159.8222), FLOAT_FIXED(5.97194)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(159.8222), FLOAT_FIXED(5.97194)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(159.62528), FLOAT_FIXED(6.71814)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(159.62528), FLOAT_FIXED(6.71814)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(159.50308), FLOAT_FIXED(7.1811)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(159.50308), FLOAT_FIXED(7.1811)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(159.46114), FLOAT_FIXED(7.34004)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(162.0615), FLOAT_FIXED(3.75712)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(162.15652), FLOAT_FIXED(3.39704)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(160.6095), FLOAT_FIXED(2.98876)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(160.51446), FLOAT_FIXED(3.34884)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(162.30968), FLOAT_FIXED(2.81666)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(160.76266), FLOAT_FIXED(2.40838)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(162.51674), FLOAT_FIXED(2.03212)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(160.96972), FLOAT_FIXED(1.62384)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(162.7734), FLOAT_FIXED(1.05956)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(161.22636), FLOAT_FIXED(0.65128)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(163.07542), FLOAT_FIXED(-0.08484)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(161.5284), FLOAT_FIXED(-0.49312)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(163.41854), FLOAT_FIXED(-1.38496)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(161.8715), FLOAT_FIXED(-1.79324)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(163.79848), FLOAT_FIXED(-2.82462)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(162.25146), FLOAT_FIXED(-3.2329)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(164.21098), FLOAT_FIXED(-4.38768)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(162.66396), FLOAT_FIXED(-4.79596)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(164.65182), FLOAT_FIXED(-6.05802)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(163.10478), FLOAT_FIXED(-6.46628)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(165.11668), FLOAT_FIXED(-7.81944)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(163.56964), FLOAT_FIXED(-8.22772)}, 
-    {FLOAT_FIXED(23.0083), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(23.0083), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(166.08594), FLOAT_FIXED(-11.49218)}, 
-    {FLOAT_FIXED(22.88046), FLOAT_FIXED(164.5389), FLOAT_FIXED(-11.90046)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(166.55078), FLOAT_FIXED(-13.2536)}, 
-    {FLOAT_FIXED(22.50806), FLOAT_FIXED(165.00376), FLOAT_FIXED(-13.66188)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(166.99162), FLOAT_FIXED(-14.92392)}, 
-    {FLOAT_FIXED(21.9078), FLOAT_FIXED(165.44458), FLOAT_FIXED(-15.3322)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(167.40412), FLOAT_FIXED(-16.487)}, 
-    {FLOAT_FIXED(21.0964), FLOAT_FIXED(165.85708), FLOAT_FIXED(-16.89528)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(167.78406), FLOAT_FIXED(-17.92666)}, 
-    {FLOAT_FIXED(20.09056), FLOAT_FIXED(166.23704), FLOAT_FIXED(-18.33494)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(168.12718), FLOAT_FIXED(-19.22678)}, 
-    {FLOAT_FIXED(18.90696), FLOAT_FIXED(166.58014), FLOAT_FIXED(-19.63506)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(168.4292), FLOAT_FIXED(-20.37118)}, 
-    {FLOAT_FIXED(17.56234), FLOAT_FIXED(166.88218), FLOAT_FIXED(-20.77946)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(168.68586), FLOAT_FIXED(-21.34372)}, 
-    {FLOAT_FIXED(16.07338), FLOAT_FIXED(167.13882), FLOAT_FIXED(-21.752)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(168.89292), FLOAT_FIXED(-22.12828)}, 
-    {FLOAT_FIXED(14.4568), FLOAT_FIXED(167.34588), FLOAT_FIXED(-22.53654)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(169.04608), FLOAT_FIXED(-22.70866)}, 
-    {FLOAT_FIXED(12.72928), FLOAT_FIXED(167.49904), FLOAT_FIXED(-23.11694)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(169.1411), FLOAT_FIXED(-23.06872)}, 
-    {FLOAT_FIXED(10.90756), FLOAT_FIXED(167.59408), FLOAT_FIXED(-23.477)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(169.17374), FLOAT_FIXED(-23.19234)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(167.6267), FLOAT_FIXED(-23.60062)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(169.1411), FLOAT_FIXED(-23.06872)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(167.59408), FLOAT_FIXED(-23.477)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(169.04608), FLOAT_FIXED(-22.70866)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(167.49904), FLOAT_FIXED(-23.11692)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(168.89292), FLOAT_FIXED(-22.12826)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(167.34588), FLOAT_FIXED(-22.53654)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(168.68586), FLOAT_FIXED(-21.34372)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(167.13882), FLOAT_FIXED(-21.752)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(168.4292), FLOAT_FIXED(-20.37118)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(166.88218), FLOAT_FIXED(-20.77946)}, 
-    {FLOAT_FIXED(-0.89036), FLOAT_FIXED(168.12718), FLOAT_FIXED(-19.22678)}, 
-    {FLOAT_FIXED(-0.89036), FLOAT_FIXED(166.58014), FLOAT_FIXED(-19.63504)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(167.78406), FLOAT_FIXED(-17.92666)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(166.23704), FLOAT_FIXED(-18.33494)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(167.40412), FLOAT_FIXED(-16.487)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(165.85708), FLOAT_FIXED(-16.89528)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(166.99162), FLOAT_FIXED(-14.92392)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(165.44458), FLOAT_FIXED(-15.3322)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(166.55078), FLOAT_FIXED(-13.2536)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(165.00376), FLOAT_FIXED(-13.66188)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(166.08592), FLOAT_FIXED(-11.49218)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(164.5389), FLOAT_FIXED(-11.90046)}, 
-    {FLOAT_FIXED(-4.9917), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(-4.9917), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(165.11668), FLOAT_FIXED(-7.81944)}, 
-    {FLOAT_FIXED(-4.86384), FLOAT_FIXED(163.56962), FLOAT_FIXED(-8.2277)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(164.65182), FLOAT_FIXED(-6.058)}, 
-    {FLOAT_FIXED(-4.49144), FLOAT_FIXED(163.10478), FLOAT_FIXED(-6.46628)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(164.21098), FLOAT_FIXED(-4.38768)}, 
-    {FLOAT_FIXED(-3.89118), FLOAT_FIXED(162.66396), FLOAT_FIXED(-4.79596)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(163.79848), FLOAT_FIXED(-2.82462)}, 
-    {FLOAT_FIXED(-3.07978), FLOAT_FIXED(162.25146), FLOAT_FIXED(-3.2329)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(163.41854), FLOAT_FIXED(-1.38496)}, 
-    {FLOAT_FIXED(-2.07394), FLOAT_FIXED(161.8715), FLOAT_FIXED(-1.79322)}, 
-    {FLOAT_FIXED(-0.89034), FLOAT_FIXED(163.07542), FLOAT_FIXED(-0.08484)}, 
-    {FLOAT_FIXED(-0.89034), FLOAT_FIXED(161.5284), FLOAT_FIXED(-0.49312)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(162.7734), FLOAT_FIXED(1.05956)}, 
-    {FLOAT_FIXED(0.45428), FLOAT_FIXED(161.22636), FLOAT_FIXED(0.65128)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(162.51674), FLOAT_FIXED(2.03212)}, 
-    {FLOAT_FIXED(1.94324), FLOAT_FIXED(160.96972), FLOAT_FIXED(1.62384)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(162.30968), FLOAT_FIXED(2.81666)}, 
-    {FLOAT_FIXED(3.55982), FLOAT_FIXED(160.76266), FLOAT_FIXED(2.40838)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(162.15652), FLOAT_FIXED(3.39704)}, 
-    {FLOAT_FIXED(5.28732), FLOAT_FIXED(160.6095), FLOAT_FIXED(2.98876)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(162.0615), FLOAT_FIXED(3.75712)}, 
-    {FLOAT_FIXED(7.10906), FLOAT_FIXED(160.51446), FLOAT_FIXED(3.34884)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(162.02886), FLOAT_FIXED(3.88072)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(160.48184), FLOAT_FIXED(3.47244)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(161.00818), FLOAT_FIXED(7.7483)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(161.05012), FLOAT_FIXED(7.58938)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(159.50308), FLOAT_FIXED(7.1811)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(159.46114), FLOAT_FIXED(7.34004)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(161.1723), FLOAT_FIXED(7.12642)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(159.62528), FLOAT_FIXED(6.71814)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(161.36922), FLOAT_FIXED(6.38022)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(159.8222), FLOAT_FIXED(5.97194)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(161.63544), FLOAT_FIXED(5.37152)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(160.0884), FLOAT_FIXED(4.96324)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(161.96544), FLOAT_FIXED(4.1211)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(160.4184), FLOAT_FIXED(3.71282)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(162.35374), FLOAT_FIXED(2.64972)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(160.80672), FLOAT_FIXED(2.24144)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(162.7949), FLOAT_FIXED(0.97814)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(161.24786), FLOAT_FIXED(0.56988)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(163.28338), FLOAT_FIXED(-0.87286)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(161.73636), FLOAT_FIXED(-1.28112)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(163.81376), FLOAT_FIXED(-2.8825)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(162.26674), FLOAT_FIXED(-3.29078)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(164.38052), FLOAT_FIXED(-5.03006)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(162.83348), FLOAT_FIXED(-5.43834)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(164.9782), FLOAT_FIXED(-7.29476)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(163.43116), FLOAT_FIXED(-7.70302)}, 
-    {FLOAT_FIXED(-8.9917), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(-8.9917), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(166.2244), FLOAT_FIXED(-12.01686)}, 
-    {FLOAT_FIXED(-8.82732), FLOAT_FIXED(164.67738), FLOAT_FIXED(-12.42514)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(166.8221), FLOAT_FIXED(-14.28154)}, 
-    {FLOAT_FIXED(-8.34852), FLOAT_FIXED(165.27504), FLOAT_FIXED(-14.68982)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(167.38884), FLOAT_FIXED(-16.4291)}, 
-    {FLOAT_FIXED(-7.57676), FLOAT_FIXED(165.8418), FLOAT_FIXED(-16.83738)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(167.91922), FLOAT_FIXED(-18.43876)}, 
-    {FLOAT_FIXED(-6.53352), FLOAT_FIXED(166.37218), FLOAT_FIXED(-18.84704)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(168.4077), FLOAT_FIXED(-20.28976)}, 
-    {FLOAT_FIXED(-5.2403), FLOAT_FIXED(166.86068), FLOAT_FIXED(-20.69804)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(168.84886), FLOAT_FIXED(-21.96134)}, 
-    {FLOAT_FIXED(-3.71854), FLOAT_FIXED(167.30182), FLOAT_FIXED(-22.36962)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(169.23718), FLOAT_FIXED(-23.43272)}, 
-    {FLOAT_FIXED(-1.98974), FLOAT_FIXED(167.69012), FLOAT_FIXED(-23.84098)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(169.56716), FLOAT_FIXED(-24.68314)}, 
-    {FLOAT_FIXED(-0.07536), FLOAT_FIXED(168.02014), FLOAT_FIXED(-25.0914)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(169.83338), FLOAT_FIXED(-25.69184)}, 
-    {FLOAT_FIXED(2.0031), FLOAT_FIXED(168.28634), FLOAT_FIXED(-26.1001)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(170.0303), FLOAT_FIXED(-26.43804)}, 
-    {FLOAT_FIXED(4.2242), FLOAT_FIXED(168.48328), FLOAT_FIXED(-26.84632)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(170.15248), FLOAT_FIXED(-26.90098)}, 
-    {FLOAT_FIXED(6.56642), FLOAT_FIXED(168.60544), FLOAT_FIXED(-27.30926)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(170.19442), FLOAT_FIXED(-27.05992)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(168.64738), FLOAT_FIXED(-27.4682)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(170.15248), FLOAT_FIXED(-26.90098)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(168.60544), FLOAT_FIXED(-27.30926)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(170.0303), FLOAT_FIXED(-26.43804)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(168.48328), FLOAT_FIXED(-26.84632)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(169.83338), FLOAT_FIXED(-25.69184)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(168.28634), FLOAT_FIXED(-26.1001)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(169.56716), FLOAT_FIXED(-24.68314)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(168.02014), FLOAT_FIXED(-25.0914)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(169.23718), FLOAT_FIXED(-23.43272)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(167.69012), FLOAT_FIXED(-23.84098)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(168.84886), FLOAT_FIXED(-21.96134)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(167.30182), FLOAT_FIXED(-22.36962)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(168.4077), FLOAT_FIXED(-20.28976)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(166.86068), FLOAT_FIXED(-20.69804)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(167.91922), FLOAT_FIXED(-18.43876)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(166.37218), FLOAT_FIXED(-18.84704)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(167.38884), FLOAT_FIXED(-16.4291)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(165.8418), FLOAT_FIXED(-16.83738)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(166.8221), FLOAT_FIXED(-14.28154)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(165.27506), FLOAT_FIXED(-14.68982)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(166.2244), FLOAT_FIXED(-12.01686)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(164.67738), FLOAT_FIXED(-12.42514)}, 
-    {FLOAT_FIXED(27.0083), FLOAT_FIXED(165.60132), FLOAT_FIXED(-9.6558)}, 
-    {FLOAT_FIXED(27.0083), FLOAT_FIXED(164.05426), FLOAT_FIXED(-10.06408)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(164.9782), FLOAT_FIXED(-7.29476)}, 
-    {FLOAT_FIXED(26.84394), FLOAT_FIXED(163.43116), FLOAT_FIXED(-7.70304)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(164.38054), FLOAT_FIXED(-5.03006)}, 
-    {FLOAT_FIXED(26.36512), FLOAT_FIXED(162.83348), FLOAT_FIXED(-5.43834)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(163.81376), FLOAT_FIXED(-2.88252)}, 
-    {FLOAT_FIXED(25.59338), FLOAT_FIXED(162.26674), FLOAT_FIXED(-3.29078)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(163.28338), FLOAT_FIXED(-0.87286)}, 
-    {FLOAT_FIXED(24.55014), FLOAT_FIXED(161.73636), FLOAT_FIXED(-1.28112)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(162.7949), FLOAT_FIXED(0.97814)}, 
-    {FLOAT_FIXED(23.2569), FLOAT_FIXED(161.24786), FLOAT_FIXED(0.56988)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(162.35374), FLOAT_FIXED(2.64972)}, 
-    {FLOAT_FIXED(21.73516), FLOAT_FIXED(160.80672), FLOAT_FIXED(2.24144)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(161.96544), FLOAT_FIXED(4.1211)}, 
-    {FLOAT_FIXED(20.00634), FLOAT_FIXED(160.4184), FLOAT_FIXED(3.71282)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(161.63544), FLOAT_FIXED(5.37152)}, 
-    {FLOAT_FIXED(18.09198), FLOAT_FIXED(160.0884), FLOAT_FIXED(4.96324)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(161.36922), FLOAT_FIXED(6.38022)}, 
-    {FLOAT_FIXED(16.0135), FLOAT_FIXED(159.8222), FLOAT_FIXED(5.97194)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(161.1723), FLOAT_FIXED(7.12642)}, 
-    {FLOAT_FIXED(13.79242), FLOAT_FIXED(159.62528), FLOAT_FIXED(6.71814)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(161.05012), FLOAT_FIXED(7.58938)}, 
-    {FLOAT_FIXED(11.4502), FLOAT_FIXED(159.50308), FLOAT_FIXED(7.1811)}, 
-    {FLOAT_FIXED(16.10702), FLOAT_FIXED(159.03154), FLOAT_FIXED(-4.7025)}, 
-    {FLOAT_FIXED(13.1808), FLOAT_FIXED(155.07378), FLOAT_FIXED(-6.8285)}, 
-    {FLOAT_FIXED(17.3533), FLOAT_FIXED(158.26128), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(18.33834), FLOAT_FIXED(163.41884), FLOAT_FIXED(-6.82848)}, 
-    {FLOAT_FIXED(6.2969), FLOAT_FIXED(159.03154), FLOAT_FIXED(-1.51494)}, 
-    {FLOAT_FIXED(11.5871), FLOAT_FIXED(158.26126), FLOAT_FIXED(-1.9234)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(163.41884), FLOAT_FIXED(-0.04978)}, 
-    {FLOAT_FIXED(0.23384), FLOAT_FIXED(159.03158), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(2.25706), FLOAT_FIXED(158.26128), FLOAT_FIXED(-4.9549)}, 
-    {FLOAT_FIXED(-0.32174), FLOAT_FIXED(163.41884), FLOAT_FIXED(-6.82848)}, 
-    {FLOAT_FIXED(6.2969), FLOAT_FIXED(159.03154), FLOAT_FIXED(-18.20496)}, 
-    {FLOAT_FIXED(2.25706), FLOAT_FIXED(158.26128), FLOAT_FIXED(-14.765)}, 
-    {FLOAT_FIXED(3.24202), FLOAT_FIXED(163.41884), FLOAT_FIXED(-17.79654)}, 
-    {FLOAT_FIXED(16.10702), FLOAT_FIXED(159.03154), FLOAT_FIXED(-15.0174)}, 
-    {FLOAT_FIXED(11.5871), FLOAT_FIXED(158.26126), FLOAT_FIXED(-17.79648)}, 
-    {FLOAT_FIXED(14.77458), FLOAT_FIXED(163.41884), FLOAT_FIXED(-17.79654)}, 
-    {FLOAT_FIXED(14.77458), FLOAT_FIXED(163.41884), FLOAT_FIXED(-1.92336)}, 
-    {FLOAT_FIXED(3.24202), FLOAT_FIXED(163.41884), FLOAT_FIXED(-1.92336)}, 
-    {FLOAT_FIXED(-0.32174), FLOAT_FIXED(163.41884), FLOAT_FIXED(-12.89142)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(163.41884), FLOAT_FIXED(-19.67012)}, 
-    {FLOAT_FIXED(18.33834), FLOAT_FIXED(163.41884), FLOAT_FIXED(-12.89142)}, 
-    {FLOAT_FIXED(11.71972), FLOAT_FIXED(167.80612), FLOAT_FIXED(-1.51494)}, 
-    {FLOAT_FIXED(15.75956), FLOAT_FIXED(168.5764), FLOAT_FIXED(-4.9549)}, 
-    {FLOAT_FIXED(10.60202), FLOAT_FIXED(171.76392), FLOAT_FIXED(-4.9549)}, 
-    {FLOAT_FIXED(1.9096), FLOAT_FIXED(167.80612), FLOAT_FIXED(-4.7025)}, 
-    {FLOAT_FIXED(6.42952), FLOAT_FIXED(168.57642), FLOAT_FIXED(-1.9234)}, 
-    {FLOAT_FIXED(4.83582), FLOAT_FIXED(171.76392), FLOAT_FIXED(-6.8285)}, 
-    {FLOAT_FIXED(1.9096), FLOAT_FIXED(167.80612), FLOAT_FIXED(-15.0174)}, 
-    {FLOAT_FIXED(0.6633), FLOAT_FIXED(168.5764), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(4.83582), FLOAT_FIXED(171.76392), FLOAT_FIXED(-12.8914)}, 
-    {FLOAT_FIXED(11.71972), FLOAT_FIXED(167.80612), FLOAT_FIXED(-18.20496)}, 
-    {FLOAT_FIXED(6.42952), FLOAT_FIXED(168.57642), FLOAT_FIXED(-17.79648)}, 
-    {FLOAT_FIXED(10.60202), FLOAT_FIXED(171.76392), FLOAT_FIXED(-14.76498)}, 
-    {FLOAT_FIXED(17.78278), FLOAT_FIXED(167.8061), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(15.75956), FLOAT_FIXED(168.5764), FLOAT_FIXED(-14.765)}, 
-    {FLOAT_FIXED(14.1658), FLOAT_FIXED(171.76388), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(173.229), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(13.1808), FLOAT_FIXED(155.07378), FLOAT_FIXED(-12.8914)}, 
-    {FLOAT_FIXED(10.9587), FLOAT_FIXED(155.07378), FLOAT_FIXED(-13.61342)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(155.60592), FLOAT_FIXED(-14.97962)}, 
-    {FLOAT_FIXED(8.26334), FLOAT_FIXED(155.07378), FLOAT_FIXED(-14.4892)}, 
-    {FLOAT_FIXED(7.41458), FLOAT_FIXED(155.07378), FLOAT_FIXED(-14.76498)}, 
-    {FLOAT_FIXED(6.04124), FLOAT_FIXED(155.07378), FLOAT_FIXED(-12.87476)}, 
-    {FLOAT_FIXED(4.1392), FLOAT_FIXED(155.60596), FLOAT_FIXED(-11.44202)}, 
-    {FLOAT_FIXED(4.3754), FLOAT_FIXED(155.0738), FLOAT_FIXED(-10.58198)}, 
-    {FLOAT_FIXED(3.8508), FLOAT_FIXED(155.0738), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(5.2242), FLOAT_FIXED(155.0738), FLOAT_FIXED(-7.96968)}, 
-    {FLOAT_FIXED(5.99904), FLOAT_FIXED(155.60594), FLOAT_FIXED(-5.71804)}, 
-    {FLOAT_FIXED(6.89002), FLOAT_FIXED(155.07378), FLOAT_FIXED(-5.67692)}, 
-    {FLOAT_FIXED(7.41458), FLOAT_FIXED(155.07378), FLOAT_FIXED(-4.9549)}, 
-    {FLOAT_FIXED(13.1808), FLOAT_FIXED(155.07378), FLOAT_FIXED(-9.16496)}, 
-    {FLOAT_FIXED(13.8774), FLOAT_FIXED(155.60596), FLOAT_FIXED(-11.44202)}, 
-    {FLOAT_FIXED(13.1808), FLOAT_FIXED(155.07378), FLOAT_FIXED(-11.99898)}, 
-    {FLOAT_FIXED(12.58048), FLOAT_FIXED(154.863), FLOAT_FIXED(-7.26464)}, 
-    {FLOAT_FIXED(9.63666), FLOAT_FIXED(155.07378), FLOAT_FIXED(-5.67692)}, 
-    {FLOAT_FIXED(12.01758), FLOAT_FIXED(155.60598), FLOAT_FIXED(-5.71804)}, 
-    {FLOAT_FIXED(12.33202), FLOAT_FIXED(155.07378), FLOAT_FIXED(-6.5527)}, 
-    {FLOAT_FIXED(4.59288), FLOAT_FIXED(154.863), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(7.64388), FLOAT_FIXED(154.86298), FLOAT_FIXED(-5.66062)}, 
-    {FLOAT_FIXED(7.64388), FLOAT_FIXED(154.863), FLOAT_FIXED(-14.05928)}, 
-    {FLOAT_FIXED(12.58048), FLOAT_FIXED(154.863), FLOAT_FIXED(-12.45526)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-29.85996)}, 
-    {FLOAT_FIXED(28.02944), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-16.0403)}, 
-    {FLOAT_FIXED(20.764), FLOAT_FIXED(-0.14724), FLOAT_FIXED(6.32038)}, 
-    {FLOAT_FIXED(-2.7474), FLOAT_FIXED(-0.14724), FLOAT_FIXED(6.32038)}, 
-    {FLOAT_FIXED(-10.01282), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-16.0403)}, 
-    {FLOAT_FIXED(6.06592), FLOAT_FIXED(166.34532), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(12.29836), FLOAT_FIXED(164.45878), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(9.18214), FLOAT_FIXED(165.40206), FLOAT_FIXED(-33.85994)}, 
-    {FLOAT_FIXED(3.0769), FLOAT_FIXED(167.25012), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(15.28738), FLOAT_FIXED(163.55398), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(0.24246), FLOAT_FIXED(168.1081), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(18.12182), FLOAT_FIXED(162.696), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(-2.40998), FLOAT_FIXED(168.911), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(20.77426), FLOAT_FIXED(161.8931), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(-4.853), FLOAT_FIXED(169.65052), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(7.70888), FLOAT_FIXED(165.848), FLOAT_FIXED(-29.83986)}, 
-    {FLOAT_FIXED(11.455), FLOAT_FIXED(164.71406), FLOAT_FIXED(-29.79058)}, 
-    {FLOAT_FIXED(23.21728), FLOAT_FIXED(161.1536), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(6.03862), FLOAT_FIXED(166.35358), FLOAT_FIXED(-29.69052)}, 
-    {FLOAT_FIXED(13.2869), FLOAT_FIXED(164.15954), FLOAT_FIXED(-29.51716)}, 
-    {FLOAT_FIXED(4.00954), FLOAT_FIXED(166.96782), FLOAT_FIXED(-29.2443)}, 
-    {FLOAT_FIXED(15.54034), FLOAT_FIXED(163.47742), FLOAT_FIXED(-28.84214)}, 
-    {FLOAT_FIXED(-7.05922), FLOAT_FIXED(170.31834), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(25.4235), FLOAT_FIXED(160.48576), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(1.51898), FLOAT_FIXED(167.72172), FLOAT_FIXED(-28.27946)}, 
-    {FLOAT_FIXED(18.25808), FLOAT_FIXED(162.65474), FLOAT_FIXED(-27.52666)}, 
-    {FLOAT_FIXED(-1.38302), FLOAT_FIXED(168.60014), FLOAT_FIXED(-26.56248)}, 
-    {FLOAT_FIXED(19.7474), FLOAT_FIXED(162.20394), FLOAT_FIXED(-26.56242)}, 
-    {FLOAT_FIXED(-9.0012), FLOAT_FIXED(170.90618), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(27.36548), FLOAT_FIXED(159.89792), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(-2.89506), FLOAT_FIXED(169.05784), FLOAT_FIXED(-25.38128)}, 
-    {FLOAT_FIXED(21.25944), FLOAT_FIXED(161.74624), FLOAT_FIXED(-25.3812)}, 
-    {FLOAT_FIXED(-4.35346), FLOAT_FIXED(169.4993), FLOAT_FIXED(-24.0021)}, 
-    {FLOAT_FIXED(22.71782), FLOAT_FIXED(161.30478), FLOAT_FIXED(-24.002)}, 
-    {FLOAT_FIXED(-10.65156), FLOAT_FIXED(171.40574), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(29.01584), FLOAT_FIXED(159.39836), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(-5.6735), FLOAT_FIXED(169.89888), FLOAT_FIXED(-22.47836)}, 
-    {FLOAT_FIXED(24.03784), FLOAT_FIXED(160.9052), FLOAT_FIXED(-22.47826)}, 
-    {FLOAT_FIXED(-6.80404), FLOAT_FIXED(170.24108), FLOAT_FIXED(-20.89856)}, 
-    {FLOAT_FIXED(25.16838), FLOAT_FIXED(160.563), FLOAT_FIXED(-20.89846)}, 
-    {FLOAT_FIXED(-11.98288), FLOAT_FIXED(171.80874), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(30.34716), FLOAT_FIXED(158.99538), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(-8.44738), FLOAT_FIXED(170.73852), FLOAT_FIXED(-17.86654)}, 
-    {FLOAT_FIXED(26.8117), FLOAT_FIXED(160.06556), FLOAT_FIXED(-17.86644)}, 
-    {FLOAT_FIXED(-12.96776), FLOAT_FIXED(172.10686), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(31.33204), FLOAT_FIXED(158.69724), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(-9.37084), FLOAT_FIXED(171.01806), FLOAT_FIXED(-15.26434)}, 
-    {FLOAT_FIXED(27.73514), FLOAT_FIXED(159.78604), FLOAT_FIXED(-15.26426)}, 
-    {FLOAT_FIXED(-13.57878), FLOAT_FIXED(172.29182), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(31.94306), FLOAT_FIXED(158.51228), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(-9.79794), FLOAT_FIXED(171.14734), FLOAT_FIXED(-13.14434)}, 
-    {FLOAT_FIXED(28.16222), FLOAT_FIXED(159.65676), FLOAT_FIXED(-13.14428)}, 
-    {FLOAT_FIXED(-13.78854), FLOAT_FIXED(172.3553), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(32.15282), FLOAT_FIXED(158.4488), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(-9.94088), FLOAT_FIXED(171.19062), FLOAT_FIXED(-11.39924)}, 
-    {FLOAT_FIXED(-13.57878), FLOAT_FIXED(172.29182), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(31.94306), FLOAT_FIXED(158.51228), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(28.30516), FLOAT_FIXED(159.61348), FLOAT_FIXED(-8.3206)}, 
-    {FLOAT_FIXED(-9.79794), FLOAT_FIXED(171.14734), FLOAT_FIXED(-6.57554)}, 
-    {FLOAT_FIXED(28.1622), FLOAT_FIXED(159.65676), FLOAT_FIXED(-6.57548)}, 
-    {FLOAT_FIXED(-12.96776), FLOAT_FIXED(172.10686), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(31.33204), FLOAT_FIXED(158.69724), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(-9.37084), FLOAT_FIXED(171.01806), FLOAT_FIXED(-4.45554)}, 
-    {FLOAT_FIXED(27.7351), FLOAT_FIXED(159.78604), FLOAT_FIXED(-4.45548)}, 
-    {FLOAT_FIXED(-11.98288), FLOAT_FIXED(171.80874), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(30.34716), FLOAT_FIXED(158.99538), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(-8.44738), FLOAT_FIXED(170.73852), FLOAT_FIXED(-1.85336)}, 
-    {FLOAT_FIXED(26.81162), FLOAT_FIXED(160.06558), FLOAT_FIXED(-1.8533)}, 
-    {FLOAT_FIXED(-10.65156), FLOAT_FIXED(171.40574), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(29.01584), FLOAT_FIXED(159.39836), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(-6.80404), FLOAT_FIXED(170.24108), FLOAT_FIXED(1.17866)}, 
-    {FLOAT_FIXED(25.16828), FLOAT_FIXED(160.56304), FLOAT_FIXED(1.17872)}, 
-    {FLOAT_FIXED(-5.6735), FLOAT_FIXED(169.89888), FLOAT_FIXED(2.75846)}, 
-    {FLOAT_FIXED(24.03774), FLOAT_FIXED(160.90524), FLOAT_FIXED(2.75852)}, 
-    {FLOAT_FIXED(-9.0012), FLOAT_FIXED(170.90618), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(27.36548), FLOAT_FIXED(159.89792), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(-4.35346), FLOAT_FIXED(169.4993), FLOAT_FIXED(4.2822)}, 
-    {FLOAT_FIXED(22.7177), FLOAT_FIXED(161.30482), FLOAT_FIXED(4.28224)}, 
-    {FLOAT_FIXED(-2.895), FLOAT_FIXED(169.05782), FLOAT_FIXED(5.66144)}, 
-    {FLOAT_FIXED(21.25932), FLOAT_FIXED(161.74628), FLOAT_FIXED(5.66142)}, 
-    {FLOAT_FIXED(-7.05922), FLOAT_FIXED(170.31834), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(25.4235), FLOAT_FIXED(160.48576), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(19.74728), FLOAT_FIXED(162.20398), FLOAT_FIXED(6.84262)}, 
-    {FLOAT_FIXED(-1.38296), FLOAT_FIXED(168.60012), FLOAT_FIXED(6.84264)}, 
-    {FLOAT_FIXED(0.10634), FLOAT_FIXED(168.14932), FLOAT_FIXED(7.80686)}, 
-    {FLOAT_FIXED(-4.853), FLOAT_FIXED(169.65052), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(23.21728), FLOAT_FIXED(161.1536), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(16.8453), FLOAT_FIXED(163.0824), FLOAT_FIXED(8.55956)}, 
-    {FLOAT_FIXED(1.519), FLOAT_FIXED(167.7217), FLOAT_FIXED(8.55958)}, 
-    {FLOAT_FIXED(14.35474), FLOAT_FIXED(163.8363), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(4.00956), FLOAT_FIXED(166.9678), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(-2.40998), FLOAT_FIXED(168.911), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(20.77426), FLOAT_FIXED(161.8931), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(12.32566), FLOAT_FIXED(164.4505), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(6.03862), FLOAT_FIXED(166.35358), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(10.65542), FLOAT_FIXED(164.9561), FLOAT_FIXED(10.11998)}, 
-    {FLOAT_FIXED(0.24246), FLOAT_FIXED(168.1081), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(18.12182), FLOAT_FIXED(162.696), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(3.0769), FLOAT_FIXED(167.25012), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(15.28738), FLOAT_FIXED(163.55398), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(6.06592), FLOAT_FIXED(166.34532), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(12.29836), FLOAT_FIXED(164.45878), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(9.18214), FLOAT_FIXED(165.40206), FLOAT_FIXED(14.14006)}, 
-    {FLOAT_FIXED(11.9507), FLOAT_FIXED(163.31024), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(5.71826), FLOAT_FIXED(165.1968), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(8.83448), FLOAT_FIXED(164.25352), FLOAT_FIXED(-33.85994)}, 
-    {FLOAT_FIXED(2.72922), FLOAT_FIXED(166.10158), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(14.93972), FLOAT_FIXED(162.40546), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(-0.1052), FLOAT_FIXED(166.95958), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(17.77416), FLOAT_FIXED(161.54748), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(-2.75764), FLOAT_FIXED(167.76248), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(20.4266), FLOAT_FIXED(160.74458), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(-5.20066), FLOAT_FIXED(168.50196), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(10.30778), FLOAT_FIXED(163.80754), FLOAT_FIXED(-29.83986)}, 
-    {FLOAT_FIXED(22.86962), FLOAT_FIXED(160.00506), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(5.69096), FLOAT_FIXED(165.20506), FLOAT_FIXED(-29.69052)}, 
-    {FLOAT_FIXED(11.97804), FLOAT_FIXED(163.30196), FLOAT_FIXED(-29.6905)}, 
-    {FLOAT_FIXED(3.66188), FLOAT_FIXED(165.81926), FLOAT_FIXED(-29.2443)}, 
-    {FLOAT_FIXED(14.00714), FLOAT_FIXED(162.68774), FLOAT_FIXED(-29.24426)}, 
-    {FLOAT_FIXED(-7.40688), FLOAT_FIXED(169.1698), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(25.07582), FLOAT_FIXED(159.33724), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(1.1713), FLOAT_FIXED(166.57316), FLOAT_FIXED(-28.27946)}, 
-    {FLOAT_FIXED(16.49774), FLOAT_FIXED(161.93384), FLOAT_FIXED(-28.27942)}, 
-    {FLOAT_FIXED(-1.73068), FLOAT_FIXED(167.45162), FLOAT_FIXED(-26.56248)}, 
-    {FLOAT_FIXED(19.39974), FLOAT_FIXED(161.0554), FLOAT_FIXED(-26.56242)}, 
-    {FLOAT_FIXED(-9.34886), FLOAT_FIXED(169.75764), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(27.01782), FLOAT_FIXED(158.7494), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(-3.24272), FLOAT_FIXED(167.9093), FLOAT_FIXED(-25.38128)}, 
-    {FLOAT_FIXED(20.91178), FLOAT_FIXED(160.5977), FLOAT_FIXED(-25.3812)}, 
-    {FLOAT_FIXED(-4.70112), FLOAT_FIXED(168.35076), FLOAT_FIXED(-24.0021)}, 
-    {FLOAT_FIXED(22.37016), FLOAT_FIXED(160.15624), FLOAT_FIXED(-24.002)}, 
-    {FLOAT_FIXED(-10.99922), FLOAT_FIXED(170.2572), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(28.66818), FLOAT_FIXED(158.24982), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(-6.02116), FLOAT_FIXED(168.75034), FLOAT_FIXED(-22.47836)}, 
-    {FLOAT_FIXED(23.69018), FLOAT_FIXED(159.75666), FLOAT_FIXED(-22.47826)}, 
-    {FLOAT_FIXED(-7.1517), FLOAT_FIXED(169.09256), FLOAT_FIXED(-20.89856)}, 
-    {FLOAT_FIXED(24.82072), FLOAT_FIXED(159.41446), FLOAT_FIXED(-20.89846)}, 
-    {FLOAT_FIXED(-12.33054), FLOAT_FIXED(170.6602), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(29.9995), FLOAT_FIXED(157.84684), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(-8.79504), FLOAT_FIXED(169.59), FLOAT_FIXED(-17.86654)}, 
-    {FLOAT_FIXED(26.46404), FLOAT_FIXED(158.91702), FLOAT_FIXED(-17.86644)}, 
-    {FLOAT_FIXED(-13.31542), FLOAT_FIXED(170.95832), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(30.98438), FLOAT_FIXED(157.54872), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(-9.7185), FLOAT_FIXED(169.86954), FLOAT_FIXED(-15.26434)}, 
-    {FLOAT_FIXED(27.38748), FLOAT_FIXED(158.6375), FLOAT_FIXED(-15.26426)}, 
-    {FLOAT_FIXED(-13.92644), FLOAT_FIXED(171.14328), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(31.5954), FLOAT_FIXED(157.36376), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(-10.1456), FLOAT_FIXED(169.99882), FLOAT_FIXED(-13.14434)}, 
-    {FLOAT_FIXED(27.81456), FLOAT_FIXED(158.50822), FLOAT_FIXED(-13.14428)}, 
-    {FLOAT_FIXED(-14.1362), FLOAT_FIXED(171.20678), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(31.80516), FLOAT_FIXED(157.30026), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(27.9575), FLOAT_FIXED(158.46496), FLOAT_FIXED(-11.39918)}, 
-    {FLOAT_FIXED(-13.92644), FLOAT_FIXED(171.14328), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(31.5954), FLOAT_FIXED(157.36376), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(-10.28854), FLOAT_FIXED(170.04208), FLOAT_FIXED(-8.32064)}, 
-    {FLOAT_FIXED(-10.1456), FLOAT_FIXED(169.99882), FLOAT_FIXED(-6.57554)}, 
-    {FLOAT_FIXED(27.81454), FLOAT_FIXED(158.50822), FLOAT_FIXED(-6.57548)}, 
-    {FLOAT_FIXED(-13.31542), FLOAT_FIXED(170.95832), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(30.98438), FLOAT_FIXED(157.54872), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(-9.7185), FLOAT_FIXED(169.86954), FLOAT_FIXED(-4.45554)}, 
-    {FLOAT_FIXED(27.38744), FLOAT_FIXED(158.63752), FLOAT_FIXED(-4.45548)}, 
-    {FLOAT_FIXED(-12.33054), FLOAT_FIXED(170.6602), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(29.9995), FLOAT_FIXED(157.84684), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(-8.79504), FLOAT_FIXED(169.59), FLOAT_FIXED(-1.85336)}, 
-    {FLOAT_FIXED(26.46396), FLOAT_FIXED(158.91704), FLOAT_FIXED(-1.8533)}, 
-    {FLOAT_FIXED(-10.99922), FLOAT_FIXED(170.2572), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(28.66818), FLOAT_FIXED(158.24982), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(-7.1517), FLOAT_FIXED(169.09256), FLOAT_FIXED(1.17866)}, 
-    {FLOAT_FIXED(24.82062), FLOAT_FIXED(159.4145), FLOAT_FIXED(1.17872)}, 
-    {FLOAT_FIXED(-6.02116), FLOAT_FIXED(168.75034), FLOAT_FIXED(2.75846)}, 
-    {FLOAT_FIXED(23.69006), FLOAT_FIXED(159.7567), FLOAT_FIXED(2.75852)}, 
-    {FLOAT_FIXED(-9.34886), FLOAT_FIXED(169.75764), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(27.01782), FLOAT_FIXED(158.7494), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(-4.70112), FLOAT_FIXED(168.35078), FLOAT_FIXED(4.2822)}, 
-    {FLOAT_FIXED(22.37004), FLOAT_FIXED(160.15628), FLOAT_FIXED(4.28224)}, 
-    {FLOAT_FIXED(-3.24266), FLOAT_FIXED(167.90928), FLOAT_FIXED(5.66144)}, 
-    {FLOAT_FIXED(20.91166), FLOAT_FIXED(160.59774), FLOAT_FIXED(5.66142)}, 
-    {FLOAT_FIXED(-7.40688), FLOAT_FIXED(169.1698), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(25.07582), FLOAT_FIXED(159.33724), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(19.3996), FLOAT_FIXED(161.05544), FLOAT_FIXED(6.84262)}, 
-    {FLOAT_FIXED(-1.73062), FLOAT_FIXED(167.4516), FLOAT_FIXED(6.84264)}, 
-    {FLOAT_FIXED(-5.20066), FLOAT_FIXED(168.50196), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(22.86962), FLOAT_FIXED(160.00506), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(16.49764), FLOAT_FIXED(161.93386), FLOAT_FIXED(8.55956)}, 
-    {FLOAT_FIXED(1.17134), FLOAT_FIXED(166.57316), FLOAT_FIXED(8.55958)}, 
-    {FLOAT_FIXED(14.00708), FLOAT_FIXED(162.68776), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(3.6619), FLOAT_FIXED(165.81926), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(-2.75764), FLOAT_FIXED(167.76248), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(20.4266), FLOAT_FIXED(160.74458), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(11.978), FLOAT_FIXED(163.30196), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(5.69096), FLOAT_FIXED(165.20506), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(10.30776), FLOAT_FIXED(163.80756), FLOAT_FIXED(10.11998)}, 
-    {FLOAT_FIXED(-0.1052), FLOAT_FIXED(166.95958), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(17.77416), FLOAT_FIXED(161.54748), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(2.72922), FLOAT_FIXED(166.10158), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(14.93972), FLOAT_FIXED(162.40546), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(5.71826), FLOAT_FIXED(165.1968), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(11.9507), FLOAT_FIXED(163.31024), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(8.83448), FLOAT_FIXED(164.25352), FLOAT_FIXED(14.14006)}, 
-    {FLOAT_FIXED(-2.895), FLOAT_FIXED(169.05782), FLOAT_FIXED(5.66144)}, 
-    {FLOAT_FIXED(-1.38296), FLOAT_FIXED(168.60012), FLOAT_FIXED(6.84264)}, 
-    {FLOAT_FIXED(-1.73062), FLOAT_FIXED(167.4516), FLOAT_FIXED(6.84264)}, 
-    {FLOAT_FIXED(-3.24266), FLOAT_FIXED(167.90928), FLOAT_FIXED(5.66144)}, 
-    {FLOAT_FIXED(1.519), FLOAT_FIXED(167.7217), FLOAT_FIXED(8.55958)}, 
-    {FLOAT_FIXED(1.17134), FLOAT_FIXED(166.57316), FLOAT_FIXED(8.55958)}, 
-    {FLOAT_FIXED(4.00956), FLOAT_FIXED(166.9678), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(3.6619), FLOAT_FIXED(165.81926), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(6.03862), FLOAT_FIXED(166.35358), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(5.69096), FLOAT_FIXED(165.20506), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(7.70888), FLOAT_FIXED(165.848), FLOAT_FIXED(10.11998)}, 
-    {FLOAT_FIXED(7.36122), FLOAT_FIXED(164.69948), FLOAT_FIXED(10.11998)}, 
-    {FLOAT_FIXED(12.32566), FLOAT_FIXED(164.4505), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(11.978), FLOAT_FIXED(163.30196), FLOAT_FIXED(9.97062)}, 
-    {FLOAT_FIXED(14.35474), FLOAT_FIXED(163.8363), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(14.00708), FLOAT_FIXED(162.68776), FLOAT_FIXED(9.5244)}, 
-    {FLOAT_FIXED(16.8453), FLOAT_FIXED(163.0824), FLOAT_FIXED(8.55956)}, 
-    {FLOAT_FIXED(16.49764), FLOAT_FIXED(161.93386), FLOAT_FIXED(8.55956)}, 
-    {FLOAT_FIXED(19.74728), FLOAT_FIXED(162.20398), FLOAT_FIXED(6.84262)}, 
-    {FLOAT_FIXED(19.3996), FLOAT_FIXED(161.05544), FLOAT_FIXED(6.84262)}, 
-    {FLOAT_FIXED(21.25932), FLOAT_FIXED(161.74628), FLOAT_FIXED(5.66142)}, 
-    {FLOAT_FIXED(20.91166), FLOAT_FIXED(160.59774), FLOAT_FIXED(5.66142)}, 
-    {FLOAT_FIXED(22.7177), FLOAT_FIXED(161.30482), FLOAT_FIXED(4.28224)}, 
-    {FLOAT_FIXED(22.37004), FLOAT_FIXED(160.15628), FLOAT_FIXED(4.28224)}, 
-    {FLOAT_FIXED(24.03774), FLOAT_FIXED(160.90524), FLOAT_FIXED(2.75852)}, 
-    {FLOAT_FIXED(23.69006), FLOAT_FIXED(159.7567), FLOAT_FIXED(2.75852)}, 
-    {FLOAT_FIXED(25.16828), FLOAT_FIXED(160.56304), FLOAT_FIXED(1.17872)}, 
-    {FLOAT_FIXED(24.82062), FLOAT_FIXED(159.4145), FLOAT_FIXED(1.17872)}, 
-    {FLOAT_FIXED(26.81162), FLOAT_FIXED(160.06558), FLOAT_FIXED(-1.8533)}, 
-    {FLOAT_FIXED(26.46396), FLOAT_FIXED(158.91704), FLOAT_FIXED(-1.8533)}, 
-    {FLOAT_FIXED(27.7351), FLOAT_FIXED(159.78604), FLOAT_FIXED(-4.45548)}, 
-    {FLOAT_FIXED(27.38744), FLOAT_FIXED(158.63752), FLOAT_FIXED(-4.45548)}, 
-    {FLOAT_FIXED(28.1622), FLOAT_FIXED(159.65676), FLOAT_FIXED(-6.57548)}, 
-    {FLOAT_FIXED(27.81454), FLOAT_FIXED(158.50822), FLOAT_FIXED(-6.57548)}, 
-    {FLOAT_FIXED(28.30516), FLOAT_FIXED(159.61348), FLOAT_FIXED(-11.39918)}, 
-    {FLOAT_FIXED(27.9575), FLOAT_FIXED(158.46496), FLOAT_FIXED(-11.39918)}, 
-    {FLOAT_FIXED(28.16222), FLOAT_FIXED(159.65676), FLOAT_FIXED(-13.14428)}, 
-    {FLOAT_FIXED(27.81456), FLOAT_FIXED(158.50822), FLOAT_FIXED(-13.14428)}, 
-    {FLOAT_FIXED(27.73514), FLOAT_FIXED(159.78604), FLOAT_FIXED(-15.26426)}, 
-    {FLOAT_FIXED(27.38748), FLOAT_FIXED(158.6375), FLOAT_FIXED(-15.26426)}, 
-    {FLOAT_FIXED(26.8117), FLOAT_FIXED(160.06556), FLOAT_FIXED(-17.86644)}, 
-    {FLOAT_FIXED(26.46404), FLOAT_FIXED(158.91702), FLOAT_FIXED(-17.86644)}, 
-    {FLOAT_FIXED(25.16838), FLOAT_FIXED(160.563), FLOAT_FIXED(-20.89846)}, 
-    {FLOAT_FIXED(24.82072), FLOAT_FIXED(159.41446), FLOAT_FIXED(-20.89846)}, 
-    {FLOAT_FIXED(24.03784), FLOAT_FIXED(160.9052), FLOAT_FIXED(-22.47826)}, 
-    {FLOAT_FIXED(23.69018), FLOAT_FIXED(159.75666), FLOAT_FIXED(-22.47826)}, 
-    {FLOAT_FIXED(22.71782), FLOAT_FIXED(161.30478), FLOAT_FIXED(-24.002)}, 
-    {FLOAT_FIXED(22.37016), FLOAT_FIXED(160.15624), FLOAT_FIXED(-24.002)}, 
-    {FLOAT_FIXED(21.25944), FLOAT_FIXED(161.74624), FLOAT_FIXED(-25.3812)}, 
-    {FLOAT_FIXED(20.91178), FLOAT_FIXED(160.5977), FLOAT_FIXED(-25.3812)}, 
-    {FLOAT_FIXED(19.7474), FLOAT_FIXED(162.20394), FLOAT_FIXED(-26.56242)}, 
-    {FLOAT_FIXED(19.39974), FLOAT_FIXED(161.0554), FLOAT_FIXED(-26.56242)}, 
-    {FLOAT_FIXED(16.8454), FLOAT_FIXED(163.08238), FLOAT_FIXED(-28.27942)}, 
-    {FLOAT_FIXED(16.49774), FLOAT_FIXED(161.93384), FLOAT_FIXED(-28.27942)}, 
-    {FLOAT_FIXED(14.3548), FLOAT_FIXED(163.83626), FLOAT_FIXED(-29.24426)}, 
-    {FLOAT_FIXED(14.00714), FLOAT_FIXED(162.68774), FLOAT_FIXED(-29.24426)}, 
-    {FLOAT_FIXED(12.32572), FLOAT_FIXED(164.4505), FLOAT_FIXED(-29.6905)}, 
-    {FLOAT_FIXED(11.97804), FLOAT_FIXED(163.30196), FLOAT_FIXED(-29.6905)}, 
-    {FLOAT_FIXED(10.65544), FLOAT_FIXED(164.95608), FLOAT_FIXED(-29.83986)}, 
-    {FLOAT_FIXED(10.30778), FLOAT_FIXED(163.80754), FLOAT_FIXED(-29.83986)}, 
-    {FLOAT_FIXED(6.03862), FLOAT_FIXED(166.35358), FLOAT_FIXED(-29.69052)}, 
-    {FLOAT_FIXED(5.69096), FLOAT_FIXED(165.20506), FLOAT_FIXED(-29.69052)}, 
-    {FLOAT_FIXED(4.00954), FLOAT_FIXED(166.96782), FLOAT_FIXED(-29.2443)}, 
-    {FLOAT_FIXED(3.66188), FLOAT_FIXED(165.81926), FLOAT_FIXED(-29.2443)}, 
-    {FLOAT_FIXED(1.51898), FLOAT_FIXED(167.72172), FLOAT_FIXED(-28.27946)}, 
-    {FLOAT_FIXED(1.1713), FLOAT_FIXED(166.57316), FLOAT_FIXED(-28.27946)}, 
-    {FLOAT_FIXED(-1.38302), FLOAT_FIXED(168.60014), FLOAT_FIXED(-26.56248)}, 
-    {FLOAT_FIXED(-1.73068), FLOAT_FIXED(167.45162), FLOAT_FIXED(-26.56248)}, 
-    {FLOAT_FIXED(-2.89506), FLOAT_FIXED(169.05784), FLOAT_FIXED(-25.38128)}, 
-    {FLOAT_FIXED(-3.24272), FLOAT_FIXED(167.9093), FLOAT_FIXED(-25.38128)}, 
-    {FLOAT_FIXED(-4.35346), FLOAT_FIXED(169.4993), FLOAT_FIXED(-24.0021)}, 
-    {FLOAT_FIXED(-4.70112), FLOAT_FIXED(168.35076), FLOAT_FIXED(-24.0021)}, 
-    {FLOAT_FIXED(-5.6735), FLOAT_FIXED(169.89888), FLOAT_FIXED(-22.47836)}, 
-    {FLOAT_FIXED(-6.02116), FLOAT_FIXED(168.75034), FLOAT_FIXED(-22.47836)}, 
-    {FLOAT_FIXED(-6.80404), FLOAT_FIXED(170.24108), FLOAT_FIXED(-20.89856)}, 
-    {FLOAT_FIXED(-7.1517), FLOAT_FIXED(169.09256), FLOAT_FIXED(-20.89856)}, 
-    {FLOAT_FIXED(-8.44738), FLOAT_FIXED(170.73852), FLOAT_FIXED(-17.86654)}, 
-    {FLOAT_FIXED(-8.79504), FLOAT_FIXED(169.59), FLOAT_FIXED(-17.86654)}, 
-    {FLOAT_FIXED(-9.37084), FLOAT_FIXED(171.01806), FLOAT_FIXED(-15.26434)}, 
-    {FLOAT_FIXED(-9.7185), FLOAT_FIXED(169.86954), FLOAT_FIXED(-15.26434)}, 
-    {FLOAT_FIXED(-9.79794), FLOAT_FIXED(171.14734), FLOAT_FIXED(-13.14434)}, 
-    {FLOAT_FIXED(-10.1456), FLOAT_FIXED(169.99882), FLOAT_FIXED(-13.14434)}, 
-    {FLOAT_FIXED(-9.94088), FLOAT_FIXED(171.19062), FLOAT_FIXED(-11.39924)}, 
-    {FLOAT_FIXED(-10.28854), FLOAT_FIXED(170.04208), FLOAT_FIXED(-11.39924)}, 
-    {FLOAT_FIXED(-9.79794), FLOAT_FIXED(171.14734), FLOAT_FIXED(-6.57554)}, 
-    {FLOAT_FIXED(-10.1456), FLOAT_FIXED(169.99882), FLOAT_FIXED(-6.57554)}, 
-    {FLOAT_FIXED(-9.37084), FLOAT_FIXED(171.01806), FLOAT_FIXED(-4.45554)}, 
-    {FLOAT_FIXED(-9.7185), FLOAT_FIXED(169.86954), FLOAT_FIXED(-4.45554)}, 
-    {FLOAT_FIXED(-8.44738), FLOAT_FIXED(170.73852), FLOAT_FIXED(-1.85336)}, 
-    {FLOAT_FIXED(-8.79504), FLOAT_FIXED(169.59), FLOAT_FIXED(-1.85336)}, 
-    {FLOAT_FIXED(-6.80404), FLOAT_FIXED(170.24108), FLOAT_FIXED(1.17866)}, 
-    {FLOAT_FIXED(-7.1517), FLOAT_FIXED(169.09256), FLOAT_FIXED(1.17866)}, 
-    {FLOAT_FIXED(-5.6735), FLOAT_FIXED(169.89888), FLOAT_FIXED(2.75846)}, 
-    {FLOAT_FIXED(-6.02116), FLOAT_FIXED(168.75034), FLOAT_FIXED(2.75846)}, 
-    {FLOAT_FIXED(-4.35346), FLOAT_FIXED(169.4993), FLOAT_FIXED(4.2822)}, 
-    {FLOAT_FIXED(-4.70112), FLOAT_FIXED(168.35078), FLOAT_FIXED(4.2822)}, 
-    {FLOAT_FIXED(9.18214), FLOAT_FIXED(165.40206), FLOAT_FIXED(14.14006)}, 
-    {FLOAT_FIXED(6.06592), FLOAT_FIXED(166.34532), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(5.71826), FLOAT_FIXED(165.1968), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(8.83448), FLOAT_FIXED(164.25352), FLOAT_FIXED(14.14006)}, 
-    {FLOAT_FIXED(3.0769), FLOAT_FIXED(167.25012), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(2.72922), FLOAT_FIXED(166.10158), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(0.24246), FLOAT_FIXED(168.1081), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(-0.1052), FLOAT_FIXED(166.95958), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(-2.40998), FLOAT_FIXED(168.911), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(-2.75764), FLOAT_FIXED(167.76248), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(-4.853), FLOAT_FIXED(169.65052), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(-5.20066), FLOAT_FIXED(168.50196), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(-7.05922), FLOAT_FIXED(170.31834), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(-7.40688), FLOAT_FIXED(169.1698), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(-9.0012), FLOAT_FIXED(170.90618), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(-9.34886), FLOAT_FIXED(169.75764), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(-10.65156), FLOAT_FIXED(171.40574), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(-10.99922), FLOAT_FIXED(170.2572), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(-11.98288), FLOAT_FIXED(171.80874), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(-12.33054), FLOAT_FIXED(170.6602), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(-12.96776), FLOAT_FIXED(172.10686), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(-13.31542), FLOAT_FIXED(170.95832), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(-13.57878), FLOAT_FIXED(172.29182), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(-13.92644), FLOAT_FIXED(171.14328), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(-13.78854), FLOAT_FIXED(172.3553), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(-14.1362), FLOAT_FIXED(171.20678), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(-13.57878), FLOAT_FIXED(172.29182), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(-13.92644), FLOAT_FIXED(171.14328), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(-12.96776), FLOAT_FIXED(172.10686), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(-13.31542), FLOAT_FIXED(170.95832), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(-11.98288), FLOAT_FIXED(171.80874), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(-12.33054), FLOAT_FIXED(170.6602), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(-10.65156), FLOAT_FIXED(171.40574), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(-10.99922), FLOAT_FIXED(170.2572), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(-9.0012), FLOAT_FIXED(170.90618), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(-9.34886), FLOAT_FIXED(169.75764), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(-7.05922), FLOAT_FIXED(170.31834), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(-7.40688), FLOAT_FIXED(169.1698), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(-4.853), FLOAT_FIXED(169.65052), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(-5.20066), FLOAT_FIXED(168.50196), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(-2.40998), FLOAT_FIXED(168.911), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(-2.75764), FLOAT_FIXED(167.76248), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(0.24246), FLOAT_FIXED(168.1081), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(-0.1052), FLOAT_FIXED(166.95958), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(3.0769), FLOAT_FIXED(167.25012), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(2.72922), FLOAT_FIXED(166.10158), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(6.06592), FLOAT_FIXED(166.34532), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(5.71826), FLOAT_FIXED(165.1968), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(9.18214), FLOAT_FIXED(165.40206), FLOAT_FIXED(-33.85994)}, 
-    {FLOAT_FIXED(8.83448), FLOAT_FIXED(164.25352), FLOAT_FIXED(-33.85994)}, 
-    {FLOAT_FIXED(12.29836), FLOAT_FIXED(164.45878), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(11.9507), FLOAT_FIXED(163.31024), FLOAT_FIXED(-33.64078)}, 
-    {FLOAT_FIXED(15.28738), FLOAT_FIXED(163.55398), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(14.93972), FLOAT_FIXED(162.40546), FLOAT_FIXED(-33.00238)}, 
-    {FLOAT_FIXED(18.12182), FLOAT_FIXED(162.696), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(17.77416), FLOAT_FIXED(161.54748), FLOAT_FIXED(-31.97338)}, 
-    {FLOAT_FIXED(20.77426), FLOAT_FIXED(161.8931), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(20.4266), FLOAT_FIXED(160.74458), FLOAT_FIXED(-30.5824)}, 
-    {FLOAT_FIXED(23.21728), FLOAT_FIXED(161.1536), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(22.86962), FLOAT_FIXED(160.00506), FLOAT_FIXED(-28.85808)}, 
-    {FLOAT_FIXED(25.4235), FLOAT_FIXED(160.48576), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(25.07582), FLOAT_FIXED(159.33724), FLOAT_FIXED(-26.82908)}, 
-    {FLOAT_FIXED(27.36548), FLOAT_FIXED(159.89792), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(27.01782), FLOAT_FIXED(158.7494), FLOAT_FIXED(-24.524)}, 
-    {FLOAT_FIXED(29.01584), FLOAT_FIXED(159.39836), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(28.66818), FLOAT_FIXED(158.24982), FLOAT_FIXED(-21.9715)}, 
-    {FLOAT_FIXED(30.34716), FLOAT_FIXED(158.99538), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(29.9995), FLOAT_FIXED(157.84684), FLOAT_FIXED(-19.20022)}, 
-    {FLOAT_FIXED(31.33204), FLOAT_FIXED(158.69724), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(30.98438), FLOAT_FIXED(157.54872), FLOAT_FIXED(-16.23876)}, 
-    {FLOAT_FIXED(31.94306), FLOAT_FIXED(158.51228), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(31.5954), FLOAT_FIXED(157.36376), FLOAT_FIXED(-13.1158)}, 
-    {FLOAT_FIXED(32.15282), FLOAT_FIXED(158.4488), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(31.80516), FLOAT_FIXED(157.30026), FLOAT_FIXED(-9.85994)}, 
-    {FLOAT_FIXED(31.94306), FLOAT_FIXED(158.51228), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(31.5954), FLOAT_FIXED(157.36376), FLOAT_FIXED(-6.6041)}, 
-    {FLOAT_FIXED(31.33204), FLOAT_FIXED(158.69724), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(30.98438), FLOAT_FIXED(157.54872), FLOAT_FIXED(-3.48112)}, 
-    {FLOAT_FIXED(30.34716), FLOAT_FIXED(158.99538), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(29.9995), FLOAT_FIXED(157.84684), FLOAT_FIXED(-0.51968)}, 
-    {FLOAT_FIXED(29.01584), FLOAT_FIXED(159.39836), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(28.66818), FLOAT_FIXED(158.24982), FLOAT_FIXED(2.25162)}, 
-    {FLOAT_FIXED(27.36548), FLOAT_FIXED(159.89792), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(27.01782), FLOAT_FIXED(158.7494), FLOAT_FIXED(4.80412)}, 
-    {FLOAT_FIXED(25.4235), FLOAT_FIXED(160.48576), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(25.07582), FLOAT_FIXED(159.33724), FLOAT_FIXED(7.10918)}, 
-    {FLOAT_FIXED(23.21728), FLOAT_FIXED(161.1536), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(22.86962), FLOAT_FIXED(160.00506), FLOAT_FIXED(9.1382)}, 
-    {FLOAT_FIXED(20.77426), FLOAT_FIXED(161.8931), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(20.4266), FLOAT_FIXED(160.74458), FLOAT_FIXED(10.8625)}, 
-    {FLOAT_FIXED(18.12182), FLOAT_FIXED(162.696), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(17.77416), FLOAT_FIXED(161.54748), FLOAT_FIXED(12.25348)}, 
-    {FLOAT_FIXED(15.28738), FLOAT_FIXED(163.55398), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(14.93972), FLOAT_FIXED(162.40546), FLOAT_FIXED(13.28248)}, 
-    {FLOAT_FIXED(12.29836), FLOAT_FIXED(164.45878), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(11.9507), FLOAT_FIXED(163.31024), FLOAT_FIXED(13.9209)}, 
-    {FLOAT_FIXED(14.21654), FLOAT_FIXED(148.1193), FLOAT_FIXED(-11.91088)}, 
-    {FLOAT_FIXED(3.58748), FLOAT_FIXED(128.83588), FLOAT_FIXED(-13.59872)}, 
-    {FLOAT_FIXED(4.6931), FLOAT_FIXED(143.43774), FLOAT_FIXED(-13.00696)}, 
-    {FLOAT_FIXED(0.66918), FLOAT_FIXED(60.69384), FLOAT_FIXED(1.61788)}, 
-    {FLOAT_FIXED(2.92238), FLOAT_FIXED(126.40222), FLOAT_FIXED(-7.88252)}, 
-    {FLOAT_FIXED(17.77044), FLOAT_FIXED(102.06582), FLOAT_FIXED(-10.03198)}, 
-    {FLOAT_FIXED(-6.45972), FLOAT_FIXED(21.75556), FLOAT_FIXED(-10.58334)}, 
-    {FLOAT_FIXED(3.583), FLOAT_FIXED(143.43774), FLOAT_FIXED(-10.11032)}, 
-    {FLOAT_FIXED(13.5291), FLOAT_FIXED(155.33988), FLOAT_FIXED(-11.7205)}, 
-    {FLOAT_FIXED(-2.53374), FLOAT_FIXED(31.49012), FLOAT_FIXED(-0.93524)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(4.72006), FLOAT_FIXED(-29.39496)}, 
-    {FLOAT_FIXED(-4.04244), FLOAT_FIXED(65.56114), FLOAT_FIXED(-14.1004)}, 
-    {FLOAT_FIXED(24.17074), FLOAT_FIXED(24.1892), FLOAT_FIXED(-10.25154)}, 
-    {FLOAT_FIXED(3.9113), FLOAT_FIXED(141.00408), FLOAT_FIXED(-8.49122)}, 
-    {FLOAT_FIXED(13.79974), FLOAT_FIXED(143.43776), FLOAT_FIXED(-8.15942)}, 
-    {FLOAT_FIXED(22.02886), FLOAT_FIXED(31.49014), FLOAT_FIXED(-5.48562)}, 
-    {FLOAT_FIXED(-5.14806), FLOAT_FIXED(53.39292), FLOAT_FIXED(-14.45964)}, 
-    {FLOAT_FIXED(1.3525), FLOAT_FIXED(72.86206), FLOAT_FIXED(0.67738)}, 
-    {FLOAT_FIXED(16.30762), FLOAT_FIXED(43.65834), FLOAT_FIXED(-20.3716)}, 
-    {FLOAT_FIXED(-4.26356), FLOAT_FIXED(63.1275), FLOAT_FIXED(-14.17224)}, 
-    {FLOAT_FIXED(14.31748), FLOAT_FIXED(89.89758), FLOAT_FIXED(-17.39992)}, 
-    {FLOAT_FIXED(2.14908), FLOAT_FIXED(133.70318), FLOAT_FIXED(-12.08864)}, 
-    {FLOAT_FIXED(6.41036), FLOAT_FIXED(111.80036), FLOAT_FIXED(-2.33224)}, 
-    {FLOAT_FIXED(4.90708), FLOAT_FIXED(60.69386), FLOAT_FIXED(1.61788)}, 
-    {FLOAT_FIXED(1.93348), FLOAT_FIXED(111.80036), FLOAT_FIXED(-7.2738)}, 
-    {FLOAT_FIXED(7.2288), FLOAT_FIXED(148.11928), FLOAT_FIXED(-14.40198)}, 
-    {FLOAT_FIXED(2.81462), FLOAT_FIXED(75.29572), FLOAT_FIXED(-18.15232)}, 
-    {FLOAT_FIXED(14.21654), FLOAT_FIXED(148.1193), FLOAT_FIXED(-10.61322)}, 
-    {FLOAT_FIXED(2.78572), FLOAT_FIXED(123.96858), FLOAT_FIXED(-7.69442)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(77.72936), FLOAT_FIXED(0.30118)}, 
-    {FLOAT_FIXED(12.7696), FLOAT_FIXED(121.53494), FLOAT_FIXED(-15.50194)}, 
-    {FLOAT_FIXED(-3.5178), FLOAT_FIXED(38.79106), FLOAT_FIXED(-5.78998)}, 
-    {FLOAT_FIXED(5.46812), FLOAT_FIXED(128.83586), FLOAT_FIXED(-14.96508)}, 
-    {FLOAT_FIXED(24.03894), FLOAT_FIXED(4.72004), FLOAT_FIXED(-4.97622)}, 
-    {FLOAT_FIXED(22.74444), FLOAT_FIXED(21.75556), FLOAT_FIXED(-5.25312)}, 
-    {FLOAT_FIXED(24.93368), FLOAT_FIXED(33.92378), FLOAT_FIXED(-15.03442)}, 
-    {FLOAT_FIXED(15.8098), FLOAT_FIXED(116.66768), FLOAT_FIXED(-7.65)}, 
-    {FLOAT_FIXED(15.20416), FLOAT_FIXED(141.0041), FLOAT_FIXED(-11.8731)}, 
-    {FLOAT_FIXED(12.87908), FLOAT_FIXED(33.92378), FLOAT_FIXED(-23.7926)}, 
-    {FLOAT_FIXED(1.47406), FLOAT_FIXED(92.33122), FLOAT_FIXED(-3.81812)}, 
-    {FLOAT_FIXED(18.63052), FLOAT_FIXED(65.56114), FLOAT_FIXED(-16.59138)}, 
-    {FLOAT_FIXED(15.45478), FLOAT_FIXED(131.26954), FLOAT_FIXED(-10.2096)}, 
-    {FLOAT_FIXED(17.01982), FLOAT_FIXED(99.63216), FLOAT_FIXED(-7.11316)}, 
-    {FLOAT_FIXED(7.096), FLOAT_FIXED(152.61508), FLOAT_FIXED(-5.48686)}, 
-    {FLOAT_FIXED(-2.9368), FLOAT_FIXED(77.72936), FLOAT_FIXED(-13.74116)}, 
-    {FLOAT_FIXED(11.99458), FLOAT_FIXED(77.72934), FLOAT_FIXED(-20.25014)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(77.72934), FLOAT_FIXED(-22.41978)}, 
-    {FLOAT_FIXED(-1.94998), FLOAT_FIXED(60.69386), FLOAT_FIXED(-6.44308)}, 
-    {FLOAT_FIXED(1.62582), FLOAT_FIXED(77.72934), FLOAT_FIXED(0.30118)}, 
-    {FLOAT_FIXED(19.40554), FLOAT_FIXED(94.76488), FLOAT_FIXED(-13.23822)}, 
-    {FLOAT_FIXED(17.7354), FLOAT_FIXED(89.8976), FLOAT_FIXED(-6.88064)}, 
-    {FLOAT_FIXED(13.52364), FLOAT_FIXED(138.57048), FLOAT_FIXED(-6.09228)}, 
-    {FLOAT_FIXED(8.63582), FLOAT_FIXED(150.47256), FLOAT_FIXED(-15.19942)}, 
-    {FLOAT_FIXED(7.09368), FLOAT_FIXED(143.43772), FLOAT_FIXED(-4.77754)}, 
-    {FLOAT_FIXED(22.57066), FLOAT_FIXED(43.65836), FLOAT_FIXED(-10.19666)}, 
-    {FLOAT_FIXED(-2.2384), FLOAT_FIXED(72.86208), FLOAT_FIXED(-10.37428)}, 
-    {FLOAT_FIXED(4.25084), FLOAT_FIXED(138.57046), FLOAT_FIXED(-13.15066)}, 
-    {FLOAT_FIXED(17.75742), FLOAT_FIXED(53.39294), FLOAT_FIXED(2.18218)}, 
-    {FLOAT_FIXED(4.7704), FLOAT_FIXED(53.39292), FLOAT_FIXED(2.18218)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(36.35742), FLOAT_FIXED(3.49888)}, 
-    {FLOAT_FIXED(12.65796), FLOAT_FIXED(48.52562), FLOAT_FIXED(-22.55822)}, 
-    {FLOAT_FIXED(16.66204), FLOAT_FIXED(104.49946), FLOAT_FIXED(-7.2294)}, 
-    {FLOAT_FIXED(0.24618), FLOAT_FIXED(102.0658), FLOAT_FIXED(-10.03198)}, 
-    {FLOAT_FIXED(20.95342), FLOAT_FIXED(77.72936), FLOAT_FIXED(-13.74116)}, 
-    {FLOAT_FIXED(16.3908), FLOAT_FIXED(77.72938), FLOAT_FIXED(0.30118)}, 
-    {FLOAT_FIXED(15.6759), FLOAT_FIXED(128.83588), FLOAT_FIXED(-10.28146)}, 
-    {FLOAT_FIXED(20.59772), FLOAT_FIXED(50.95928), FLOAT_FIXED(-5.95064)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(80.16298), FLOAT_FIXED(-22.18728)}, 
-    {FLOAT_FIXED(16.19814), FLOAT_FIXED(102.0658), FLOAT_FIXED(-14.87102)}, 
-    {FLOAT_FIXED(-1.81332), FLOAT_FIXED(63.1275), FLOAT_FIXED(-6.63118)}, 
-    {FLOAT_FIXED(1.62512), FLOAT_FIXED(119.1013), FLOAT_FIXED(-10.04894)}, 
-    {FLOAT_FIXED(14.34084), FLOAT_FIXED(114.23402), FLOAT_FIXED(-2.52034)}, 
-    {FLOAT_FIXED(18.0932), FLOAT_FIXED(85.0303), FLOAT_FIXED(-6.7644)}, 
-    {FLOAT_FIXED(17.05486), FLOAT_FIXED(111.80038), FLOAT_FIXED(-10.2645)}, 
-    {FLOAT_FIXED(25.59706), FLOAT_FIXED(26.62284), FLOAT_FIXED(-15.24996)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(21.75556), FLOAT_FIXED(-27.76742)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(67.99478), FLOAT_FIXED(1.05358)}, 
-    {FLOAT_FIXED(12.32736), FLOAT_FIXED(136.1368), FLOAT_FIXED(-14.42822)}, 
-    {FLOAT_FIXED(-4.67562), FLOAT_FIXED(24.1892), FLOAT_FIXED(-5.70116)}, 
-    {FLOAT_FIXED(6.88768), FLOAT_FIXED(150.3672), FLOAT_FIXED(-13.9394)}, 
-    {FLOAT_FIXED(6.6854), FLOAT_FIXED(109.36672), FLOAT_FIXED(-17.70954)}, 
-    {FLOAT_FIXED(-2.20074), FLOAT_FIXED(9.58734), FLOAT_FIXED(5.56798)}, 
-    {FLOAT_FIXED(-6.91706), FLOAT_FIXED(33.92378), FLOAT_FIXED(-15.03442)}, 
-    {FLOAT_FIXED(16.74986), FLOAT_FIXED(33.92378), FLOAT_FIXED(-20.98032)}, 
-    {FLOAT_FIXED(2.81244), FLOAT_FIXED(141.0041), FLOAT_FIXED(-11.8731)}, 
-    {FLOAT_FIXED(12.32736), FLOAT_FIXED(138.57044), FLOAT_FIXED(-14.19572)}, 
-    {FLOAT_FIXED(21.17454), FLOAT_FIXED(75.29572), FLOAT_FIXED(-13.813)}, 
-    {FLOAT_FIXED(14.208), FLOAT_FIXED(131.26952), FLOAT_FIXED(-13.52686)}, 
-    {FLOAT_FIXED(1.04562), FLOAT_FIXED(31.49012), FLOAT_FIXED(-21.05216)}, 
-    {FLOAT_FIXED(0.62182), FLOAT_FIXED(80.163), FLOAT_FIXED(-3.39752)}, 
-    {FLOAT_FIXED(12.43684), FLOAT_FIXED(55.82656), FLOAT_FIXED(-22.02136)}, 
-    {FLOAT_FIXED(-6.47482), FLOAT_FIXED(38.79106), FLOAT_FIXED(-14.89072)}, 
-    {FLOAT_FIXED(21.80774), FLOAT_FIXED(33.92378), FLOAT_FIXED(-5.41378)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(38.79106), FLOAT_FIXED(-26.13988)}, 
-    {FLOAT_FIXED(-0.94668), FLOAT_FIXED(99.63216), FLOAT_FIXED(-13.09452)}, 
-    {FLOAT_FIXED(13.21186), FLOAT_FIXED(114.234), FLOAT_FIXED(-15.87814)}, 
-    {FLOAT_FIXED(-0.5608), FLOAT_FIXED(38.79106), FLOAT_FIXED(3.31078)}, 
-    {FLOAT_FIXED(-4.8123), FLOAT_FIXED(21.75556), FLOAT_FIXED(-5.51306)}, 
-    {FLOAT_FIXED(0.60396), FLOAT_FIXED(106.93308), FLOAT_FIXED(-10.14824)}, 
-    {FLOAT_FIXED(2.0358), FLOAT_FIXED(85.03028), FLOAT_FIXED(-0.26312)}, 
-    {FLOAT_FIXED(11.11008), FLOAT_FIXED(114.234), FLOAT_FIXED(-17.40518)}, 
-    {FLOAT_FIXED(16.40588), FLOAT_FIXED(94.76488), FLOAT_FIXED(-4.00622)}, 
-    {FLOAT_FIXED(13.54462), FLOAT_FIXED(143.43774), FLOAT_FIXED(-12.84632)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(9.58734), FLOAT_FIXED(5.56798)}, 
-    {FLOAT_FIXED(-4.09672), FLOAT_FIXED(31.49012), FLOAT_FIXED(-5.74558)}, 
-    {FLOAT_FIXED(13.98688), FLOAT_FIXED(133.70316), FLOAT_FIXED(-13.45502)}, 
-    {FLOAT_FIXED(18.96328), FLOAT_FIXED(99.63216), FLOAT_FIXED(-13.09452)}, 
-    {FLOAT_FIXED(14.47752), FLOAT_FIXED(111.80038), FLOAT_FIXED(-2.33224)}, 
-    {FLOAT_FIXED(15.86536), FLOAT_FIXED(58.2602), FLOAT_FIXED(-19.29788)}, 
-    {FLOAT_FIXED(13.6712), FLOAT_FIXED(150.3672), FLOAT_FIXED(-9.49702)}, 
-    {FLOAT_FIXED(0.38006), FLOAT_FIXED(114.23402), FLOAT_FIXED(-12.66344)}, 
-    {FLOAT_FIXED(1.61072), FLOAT_FIXED(94.76486), FLOAT_FIXED(-4.00622)}, 
-    {FLOAT_FIXED(24.49142), FLOAT_FIXED(38.79106), FLOAT_FIXED(-14.89072)}, 
-    {FLOAT_FIXED(18.5774), FLOAT_FIXED(38.79106), FLOAT_FIXED(3.31078)}, 
-    {FLOAT_FIXED(20.39952), FLOAT_FIXED(41.2247), FLOAT_FIXED(-17.63116)}, 
-    {FLOAT_FIXED(18.29774), FLOAT_FIXED(4.72006), FLOAT_FIXED(-22.64578)}, 
-    {FLOAT_FIXED(1.04622), FLOAT_FIXED(111.80036), FLOAT_FIXED(-10.00454)}, 
-    {FLOAT_FIXED(11.55232), FLOAT_FIXED(97.1985), FLOAT_FIXED(-18.7114)}, 
-    {FLOAT_FIXED(-8.0227), FLOAT_FIXED(21.75556), FLOAT_FIXED(-15.39366)}, 
-    {FLOAT_FIXED(2.0396), FLOAT_FIXED(106.93308), FLOAT_FIXED(-14.56666)}, 
-    {FLOAT_FIXED(-0.16104), FLOAT_FIXED(85.03028), FLOAT_FIXED(-7.02434)}, 
-    {FLOAT_FIXED(13.65618), FLOAT_FIXED(46.092), FLOAT_FIXED(2.74648)}, 
-    {FLOAT_FIXED(-0.77498), FLOAT_FIXED(89.89758), FLOAT_FIXED(-10.13128)}, 
-    {FLOAT_FIXED(4.9164), FLOAT_FIXED(26.62284), FLOAT_FIXED(-24.32946)}, 
-    {FLOAT_FIXED(2.4458), FLOAT_FIXED(92.3312), FLOAT_FIXED(-0.82742)}, 
-    {FLOAT_FIXED(6.00038), FLOAT_FIXED(99.63214), FLOAT_FIXED(-1.39172)}, 
-    {FLOAT_FIXED(19.2939), FLOAT_FIXED(55.82656), FLOAT_FIXED(-17.03942)}, 
-    {FLOAT_FIXED(2.20404), FLOAT_FIXED(126.40224), FLOAT_FIXED(-10.09336)}, 
-    {FLOAT_FIXED(13.12584), FLOAT_FIXED(152.6151), FLOAT_FIXED(-8.38082)}, 
-    {FLOAT_FIXED(4.02972), FLOAT_FIXED(136.1368), FLOAT_FIXED(-13.22252)}, 
-    {FLOAT_FIXED(-8.19646), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-10.45012)}, 
-    {FLOAT_FIXED(3.25688), FLOAT_FIXED(85.03028), FLOAT_FIXED(-17.54362)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(46.092), FLOAT_FIXED(2.74648)}, 
-    {FLOAT_FIXED(21.19172), FLOAT_FIXED(60.69386), FLOAT_FIXED(-10.21362)}, 
-    {FLOAT_FIXED(0.6012), FLOAT_FIXED(116.66766), FLOAT_FIXED(-12.59158)}, 
-    {FLOAT_FIXED(14.37864), FLOAT_FIXED(136.13682), FLOAT_FIXED(-8.11502)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(116.66764), FLOAT_FIXED(-18.6997)}, 
-    {FLOAT_FIXED(10.88896), FLOAT_FIXED(123.96858), FLOAT_FIXED(-16.63582)}, 
-    {FLOAT_FIXED(3.81242), FLOAT_FIXED(116.66764), FLOAT_FIXED(-2.70844)}, 
-    {FLOAT_FIXED(13.43298), FLOAT_FIXED(109.36672), FLOAT_FIXED(-16.1825)}, 
-    {FLOAT_FIXED(-0.99612), FLOAT_FIXED(87.46394), FLOAT_FIXED(-10.20314)}, 
-    {FLOAT_FIXED(6.44452), FLOAT_FIXED(155.33986), FLOAT_FIXED(-5.69748)}, 
-    {FLOAT_FIXED(19.53404), FLOAT_FIXED(21.75556), FLOAT_FIXED(4.62748)}, 
-    {FLOAT_FIXED(22.7918), FLOAT_FIXED(41.2247), FLOAT_FIXED(-10.2685)}, 
-    {FLOAT_FIXED(-2.08664), FLOAT_FIXED(58.2602), FLOAT_FIXED(-6.25498)}, 
-    {FLOAT_FIXED(-3.70966), FLOAT_FIXED(21.75556), FLOAT_FIXED(-18.52726)}, 
-    {FLOAT_FIXED(6.95702), FLOAT_FIXED(141.00408), FLOAT_FIXED(-4.58944)}, 
-    {FLOAT_FIXED(1.92794), FLOAT_FIXED(131.26954), FLOAT_FIXED(-12.1605)}, 
-    {FLOAT_FIXED(-0.50226), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-22.95012)}, 
-    {FLOAT_FIXED(14.09636), FLOAT_FIXED(92.33122), FLOAT_FIXED(-17.32806)}, 
-    {FLOAT_FIXED(19.39738), FLOAT_FIXED(24.1892), FLOAT_FIXED(4.43938)}, 
-    {FLOAT_FIXED(14.98302), FLOAT_FIXED(143.43774), FLOAT_FIXED(-11.80126)}, 
-    {FLOAT_FIXED(2.59132), FLOAT_FIXED(138.57046), FLOAT_FIXED(-11.94496)}, 
-    {FLOAT_FIXED(17.4154), FLOAT_FIXED(116.66766), FLOAT_FIXED(-12.59158)}, 
-    {FLOAT_FIXED(14.20418), FLOAT_FIXED(116.66768), FLOAT_FIXED(-2.70844)}, 
-    {FLOAT_FIXED(13.76576), FLOAT_FIXED(141.0041), FLOAT_FIXED(-12.91816)}, 
-    {FLOAT_FIXED(12.2157), FLOAT_FIXED(65.56114), FLOAT_FIXED(-21.252)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(21.75556), FLOAT_FIXED(4.62748)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(138.57042), FLOAT_FIXED(-16.60716)}, 
-    {FLOAT_FIXED(1.49124), FLOAT_FIXED(106.93308), FLOAT_FIXED(-7.4175)}, 
-    {FLOAT_FIXED(17.34742), FLOAT_FIXED(60.69386), FLOAT_FIXED(1.61788)}, 
-    {FLOAT_FIXED(-5.21744), FLOAT_FIXED(36.35742), FLOAT_FIXED(-10.4122)}, 
-    {FLOAT_FIXED(14.06752), FLOAT_FIXED(119.10134), FLOAT_FIXED(-2.89654)}, 
-    {FLOAT_FIXED(16.97098), FLOAT_FIXED(31.49012), FLOAT_FIXED(-21.05216)}, 
-    {FLOAT_FIXED(22.5013), FLOAT_FIXED(60.69386), FLOAT_FIXED(-14.2441)}, 
-    {FLOAT_FIXED(-0.17166), FLOAT_FIXED(75.29572), FLOAT_FIXED(-15.98266)}, 
-    {FLOAT_FIXED(9.28164), FLOAT_FIXED(72.86208), FLOAT_FIXED(0.67738)}, 
-    {FLOAT_FIXED(12.32736), FLOAT_FIXED(131.26952), FLOAT_FIXED(-14.89324)}, 
-    {FLOAT_FIXED(-4.23338), FLOAT_FIXED(29.05648), FLOAT_FIXED(-5.55748)}, 
-    {FLOAT_FIXED(17.24096), FLOAT_FIXED(97.19852), FLOAT_FIXED(-7.185)}, 
-    {FLOAT_FIXED(1.89914), FLOAT_FIXED(82.59664), FLOAT_FIXED(-0.07502)}, 
-    {FLOAT_FIXED(5.86372), FLOAT_FIXED(92.33122), FLOAT_FIXED(-0.82742)}, 
-    {FLOAT_FIXED(5.44928), FLOAT_FIXED(150.3672), FLOAT_FIXED(-12.89434)}, 
-    {FLOAT_FIXED(15.4231), FLOAT_FIXED(67.99478), FLOAT_FIXED(-18.68918)}, 
-    {FLOAT_FIXED(17.21076), FLOAT_FIXED(63.1275), FLOAT_FIXED(1.42978)}, 
-    {FLOAT_FIXED(12.43684), FLOAT_FIXED(58.2602), FLOAT_FIXED(-21.78886)}, 
-    {FLOAT_FIXED(5.57978), FLOAT_FIXED(60.69384), FLOAT_FIXED(-21.55636)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(26.62284), FLOAT_FIXED(4.25128)}, 
-    {FLOAT_FIXED(3.95042), FLOAT_FIXED(24.1892), FLOAT_FIXED(4.43938)}, 
-    {FLOAT_FIXED(20.17056), FLOAT_FIXED(72.86208), FLOAT_FIXED(-10.11432)}, 
-    {FLOAT_FIXED(11.77346), FLOAT_FIXED(82.59664), FLOAT_FIXED(-19.94578)}, 
-    {FLOAT_FIXED(-8.24382), FLOAT_FIXED(19.32192), FLOAT_FIXED(-15.46552)}, 
-    {FLOAT_FIXED(-1.71954), FLOAT_FIXED(53.39292), FLOAT_FIXED(-16.95062)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(19.32192), FLOAT_FIXED(-27.99992)}, 
-    {FLOAT_FIXED(18.40938), FLOAT_FIXED(70.42842), FLOAT_FIXED(-16.28702)}, 
-    {FLOAT_FIXED(23.59184), FLOAT_FIXED(31.49014), FLOAT_FIXED(-10.29594)}, 
-    {FLOAT_FIXED(-1.6541), FLOAT_FIXED(19.3219), FLOAT_FIXED(4.81558)}, 
-    {FLOAT_FIXED(20.1784), FLOAT_FIXED(43.65836), FLOAT_FIXED(-17.55932)}, 
-    {FLOAT_FIXED(4.13242), FLOAT_FIXED(143.43772), FLOAT_FIXED(-8.41936)}, 
-    {FLOAT_FIXED(8.87164), FLOAT_FIXED(143.43774), FLOAT_FIXED(-4.77754)}, 
-    {FLOAT_FIXED(9.28164), FLOAT_FIXED(82.59664), FLOAT_FIXED(-0.07502)}, 
-    {FLOAT_FIXED(17.0741), FLOAT_FIXED(65.56116), FLOAT_FIXED(1.24168)}, 
-    {FLOAT_FIXED(1.709), FLOAT_FIXED(43.65834), FLOAT_FIXED(-20.3716)}, 
-    {FLOAT_FIXED(24.39188), FLOAT_FIXED(21.75556), FLOAT_FIXED(-10.3234)}, 
-    {FLOAT_FIXED(16.25204), FLOAT_FIXED(111.80038), FLOAT_FIXED(-7.7937)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(24.1892), FLOAT_FIXED(-27.5349)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(53.39292), FLOAT_FIXED(-24.74484)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(50.95928), FLOAT_FIXED(-22.32572)}, 
-    {FLOAT_FIXED(12.87908), FLOAT_FIXED(36.35742), FLOAT_FIXED(-23.5601)}, 
-    {FLOAT_FIXED(18.1674), FLOAT_FIXED(46.092), FLOAT_FIXED(2.74648)}, 
-    {FLOAT_FIXED(5.91038), FLOAT_FIXED(138.57044), FLOAT_FIXED(-14.35638)}, 
-    {FLOAT_FIXED(0.60336), FLOAT_FIXED(21.75556), FLOAT_FIXED(-21.66086)}, 
-    {FLOAT_FIXED(26.26044), FLOAT_FIXED(19.32192), FLOAT_FIXED(-15.46552)}, 
-    {FLOAT_FIXED(19.6707), FLOAT_FIXED(19.32192), FLOAT_FIXED(4.81558)}, 
-    {FLOAT_FIXED(2.20682), FLOAT_FIXED(116.66766), FLOAT_FIXED(-7.65)}, 
-    {FLOAT_FIXED(5.7904), FLOAT_FIXED(148.11928), FLOAT_FIXED(-13.35694)}, 
-    {FLOAT_FIXED(-9.57056), FLOAT_FIXED(4.72006), FLOAT_FIXED(-15.8966)}, 
-    {FLOAT_FIXED(5.8009), FLOAT_FIXED(72.86206), FLOAT_FIXED(-20.55448)}, 
-    {FLOAT_FIXED(5.8009), FLOAT_FIXED(70.42842), FLOAT_FIXED(-20.78698)}, 
-    {FLOAT_FIXED(9.28162), FLOAT_FIXED(53.39292), FLOAT_FIXED(2.18218)}, 
-    {FLOAT_FIXED(12.7696), FLOAT_FIXED(126.40222), FLOAT_FIXED(-15.03694)}, 
-    {FLOAT_FIXED(-3.96006), FLOAT_FIXED(33.92378), FLOAT_FIXED(-5.93368)}, 
-    {FLOAT_FIXED(16.7987), FLOAT_FIXED(102.06582), FLOAT_FIXED(-7.0413)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(43.65834), FLOAT_FIXED(-25.67486)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(92.3312), FLOAT_FIXED(-21.02476)}, 
-    {FLOAT_FIXED(10.7944), FLOAT_FIXED(150.36718), FLOAT_FIXED(-14.18244)}, 
-    {FLOAT_FIXED(17.63436), FLOAT_FIXED(19.32192), FLOAT_FIXED(-21.73272)}, 
-    {FLOAT_FIXED(-6.3801), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-4.85996)}, 
-    {FLOAT_FIXED(8.6672), FLOAT_FIXED(148.11926), FLOAT_FIXED(-15.44704)}, 
-    {FLOAT_FIXED(5.68924), FLOAT_FIXED(133.70316), FLOAT_FIXED(-14.66074)}, 
-    {FLOAT_FIXED(12.32736), FLOAT_FIXED(133.70316), FLOAT_FIXED(-14.66074)}, 
-    {FLOAT_FIXED(21.50514), FLOAT_FIXED(24.1892), FLOAT_FIXED(-18.45542)}, 
-    {FLOAT_FIXED(4.47198), FLOAT_FIXED(141.0041), FLOAT_FIXED(-13.07882)}, 
-    {FLOAT_FIXED(13.76358), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-26.40504)}, 
-    {FLOAT_FIXED(-1.1678), FLOAT_FIXED(97.19852), FLOAT_FIXED(-13.16638)}, 
-    {FLOAT_FIXED(20.37658), FLOAT_FIXED(53.39292), FLOAT_FIXED(-5.87878)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(97.19848), FLOAT_FIXED(-20.55974)}, 
-    {FLOAT_FIXED(3.14352), FLOAT_FIXED(128.83586), FLOAT_FIXED(-7.81066)}, 
-    {FLOAT_FIXED(2.71912), FLOAT_FIXED(97.1985), FLOAT_FIXED(-1.20362)}, 
-    {FLOAT_FIXED(-0.69746), FLOAT_FIXED(36.35742), FLOAT_FIXED(3.49888)}, 
-    {FLOAT_FIXED(16.25482), FLOAT_FIXED(121.53496), FLOAT_FIXED(-10.23704)}, 
-    {FLOAT_FIXED(20.84178), FLOAT_FIXED(33.92378), FLOAT_FIXED(-18.00736)}, 
-    {FLOAT_FIXED(9.28164), FLOAT_FIXED(111.80036), FLOAT_FIXED(-2.33224)}, 
-    {FLOAT_FIXED(0.38224), FLOAT_FIXED(19.32192), FLOAT_FIXED(-21.73272)}, 
-    {FLOAT_FIXED(23.68114), FLOAT_FIXED(9.58734), FLOAT_FIXED(-5.09246)}, 
-    {FLOAT_FIXED(22.96556), FLOAT_FIXED(19.32192), FLOAT_FIXED(-5.32496)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(121.53492), FLOAT_FIXED(-18.2347)}, 
-    {FLOAT_FIXED(2.37236), FLOAT_FIXED(65.56114), FLOAT_FIXED(-18.76102)}, 
-    {FLOAT_FIXED(0.15894), FLOAT_FIXED(111.80038), FLOAT_FIXED(-12.73528)}, 
-    {FLOAT_FIXED(14.09636), FLOAT_FIXED(97.1985), FLOAT_FIXED(-16.86306)}, 
-    {FLOAT_FIXED(13.6712), FLOAT_FIXED(150.3672), FLOAT_FIXED(-12.09234)}, 
-    {FLOAT_FIXED(20.39168), FLOAT_FIXED(70.42842), FLOAT_FIXED(-10.18618)}, 
-    {FLOAT_FIXED(-6.01748), FLOAT_FIXED(26.62284), FLOAT_FIXED(-10.43964)}, 
-    {FLOAT_FIXED(19.18442), FLOAT_FIXED(97.19852), FLOAT_FIXED(-13.16638)}, 
-    {FLOAT_FIXED(15.29748), FLOAT_FIXED(97.19852), FLOAT_FIXED(-1.20362)}, 
-    {FLOAT_FIXED(3.92024), FLOAT_FIXED(99.63214), FLOAT_FIXED(-16.63056)}, 
-    {FLOAT_FIXED(15.007), FLOAT_FIXED(116.66768), FLOAT_FIXED(-5.17922)}, 
-    {FLOAT_FIXED(4.3625), FLOAT_FIXED(109.36672), FLOAT_FIXED(-16.02184)}, 
-    {FLOAT_FIXED(6.02202), FLOAT_FIXED(80.16298), FLOAT_FIXED(-20.01762)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(104.49942), FLOAT_FIXED(-19.86222)}, 
-    {FLOAT_FIXED(21.72628), FLOAT_FIXED(21.75556), FLOAT_FIXED(-18.52726)}, 
-    {FLOAT_FIXED(13.11366), FLOAT_FIXED(145.87142), FLOAT_FIXED(-6.65658)}, 
-    {FLOAT_FIXED(17.19428), FLOAT_FIXED(119.10132), FLOAT_FIXED(-12.51974)}, 
-    {FLOAT_FIXED(-1.38894), FLOAT_FIXED(94.76488), FLOAT_FIXED(-13.23822)}, 
-    {FLOAT_FIXED(15.36478), FLOAT_FIXED(111.80038), FLOAT_FIXED(-5.06296)}, 
-    {FLOAT_FIXED(6.46428), FLOAT_FIXED(102.06578), FLOAT_FIXED(-18.24638)}, 
-    {FLOAT_FIXED(15.23366), FLOAT_FIXED(133.70318), FLOAT_FIXED(-10.13776)}, 
-    {FLOAT_FIXED(20.68702), FLOAT_FIXED(29.0565), FLOAT_FIXED(-0.74714)}, 
-    {FLOAT_FIXED(9.14498), FLOAT_FIXED(119.1013), FLOAT_FIXED(-2.89654)}, 
-    {FLOAT_FIXED(19.661), FLOAT_FIXED(63.1275), FLOAT_FIXED(-6.11128)}, 
-    {FLOAT_FIXED(-6.03256), FLOAT_FIXED(43.65836), FLOAT_FIXED(-14.74704)}, 
-    {FLOAT_FIXED(27.14494), FLOAT_FIXED(9.58734), FLOAT_FIXED(-15.7529)}, 
-    {FLOAT_FIXED(3.14522), FLOAT_FIXED(123.9686), FLOAT_FIXED(-13.74242)}, 
-    {FLOAT_FIXED(2.42794), FLOAT_FIXED(119.1013), FLOAT_FIXED(-7.57816)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(43.65834), FLOAT_FIXED(-23.02324)}, 
-    {FLOAT_FIXED(5.13752), FLOAT_FIXED(33.92378), FLOAT_FIXED(-23.7926)}, 
-    {FLOAT_FIXED(-1.05616), FLOAT_FIXED(63.1275), FLOAT_FIXED(-16.50256)}, 
-    {FLOAT_FIXED(4.9164), FLOAT_FIXED(24.1892), FLOAT_FIXED(-24.56196)}, 
-    {FLOAT_FIXED(7.34878), FLOAT_FIXED(133.70314), FLOAT_FIXED(-15.86644)}, 
-    {FLOAT_FIXED(19.88214), FLOAT_FIXED(60.69386), FLOAT_FIXED(-6.18314)}, 
-    {FLOAT_FIXED(4.13866), FLOAT_FIXED(148.11928), FLOAT_FIXED(-9.5711)}, 
-    {FLOAT_FIXED(-4.70582), FLOAT_FIXED(58.26022), FLOAT_FIXED(-14.31594)}, 
-    {FLOAT_FIXED(21.53442), FLOAT_FIXED(38.79106), FLOAT_FIXED(-5.78998)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(58.2602), FLOAT_FIXED(-24.27984)}, 
-    {FLOAT_FIXED(-2.66556), FLOAT_FIXED(50.95928), FLOAT_FIXED(-6.21058)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(26.62284), FLOAT_FIXED(-27.3024)}, 
-    {FLOAT_FIXED(0.53252), FLOAT_FIXED(58.2602), FLOAT_FIXED(1.80598)}, 
-    {FLOAT_FIXED(6.02202), FLOAT_FIXED(85.03026), FLOAT_FIXED(-19.55262)}, 
-    {FLOAT_FIXED(10.88896), FLOAT_FIXED(121.53492), FLOAT_FIXED(-16.86832)}, 
-    {FLOAT_FIXED(21.94924), FLOAT_FIXED(9.58734), FLOAT_FIXED(0.23776)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(116.66766), FLOAT_FIXED(-2.70844)}, 
-    {FLOAT_FIXED(11.55232), FLOAT_FIXED(92.3312), FLOAT_FIXED(-19.17642)}, 
-    {FLOAT_FIXED(1.26674), FLOAT_FIXED(33.92378), FLOAT_FIXED(-20.98032)}, 
-    {FLOAT_FIXED(18.07662), FLOAT_FIXED(9.58734), FLOAT_FIXED(-22.34142)}, 
-    {FLOAT_FIXED(18.6721), FLOAT_FIXED(77.72936), FLOAT_FIXED(-6.72)}, 
-    {FLOAT_FIXED(4.08576), FLOAT_FIXED(121.53492), FLOAT_FIXED(-3.08464)}, 
-    {FLOAT_FIXED(23.16468), FLOAT_FIXED(53.39292), FLOAT_FIXED(-14.45964)}, 
-    {FLOAT_FIXED(17.85766), FLOAT_FIXED(111.80038), FLOAT_FIXED(-12.73528)}, 
-    {FLOAT_FIXED(15.86536), FLOAT_FIXED(53.39292), FLOAT_FIXED(-19.7629)}, 
-    {FLOAT_FIXED(2.99246), FLOAT_FIXED(102.06578), FLOAT_FIXED(-1.57982)}, 
-    {FLOAT_FIXED(18.29922), FLOAT_FIXED(65.56116), FLOAT_FIXED(-2.52886)}, 
-    {FLOAT_FIXED(16.75204), FLOAT_FIXED(123.9686), FLOAT_FIXED(-12.37604)}, 
-    {FLOAT_FIXED(22.72242), FLOAT_FIXED(58.26022), FLOAT_FIXED(-14.31594)}, 
-    {FLOAT_FIXED(17.4841), FLOAT_FIXED(58.26022), FLOAT_FIXED(1.80598)}, 
-    {FLOAT_FIXED(3.36464), FLOAT_FIXED(131.26952), FLOAT_FIXED(-7.73882)}, 
-    {FLOAT_FIXED(15.0925), FLOAT_FIXED(119.1013), FLOAT_FIXED(-14.04676)}, 
-    {FLOAT_FIXED(3.81376), FLOAT_FIXED(21.75556), FLOAT_FIXED(4.62748)}, 
-    {FLOAT_FIXED(13.2462), FLOAT_FIXED(58.26022), FLOAT_FIXED(1.80598)}, 
-    {FLOAT_FIXED(15.42528), FLOAT_FIXED(138.57046), FLOAT_FIXED(-11.94496)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(87.46394), FLOAT_FIXED(-0.45122)}, 
-    {FLOAT_FIXED(13.21186), FLOAT_FIXED(116.66766), FLOAT_FIXED(-15.64564)}, 
-    {FLOAT_FIXED(4.35354), FLOAT_FIXED(145.87138), FLOAT_FIXED(-8.34752)}, 
-    {FLOAT_FIXED(14.8209), FLOAT_FIXED(131.26954), FLOAT_FIXED(-8.25872)}, 
-    {FLOAT_FIXED(8.32608), FLOAT_FIXED(150.36718), FLOAT_FIXED(-14.98446)}, 
-    {FLOAT_FIXED(6.6837), FLOAT_FIXED(121.53494), FLOAT_FIXED(-3.08464)}, 
-    {FLOAT_FIXED(21.39566), FLOAT_FIXED(72.86208), FLOAT_FIXED(-13.88486)}, 
-    {FLOAT_FIXED(16.30762), FLOAT_FIXED(48.52564), FLOAT_FIXED(-19.9066)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(63.12748), FLOAT_FIXED(-23.81482)}, 
-    {FLOAT_FIXED(3.69912), FLOAT_FIXED(94.76486), FLOAT_FIXED(-16.9349)}, 
-    {FLOAT_FIXED(2.85578), FLOAT_FIXED(99.63214), FLOAT_FIXED(-1.39172)}, 
-    {FLOAT_FIXED(-2.71568), FLOAT_FIXED(80.16302), FLOAT_FIXED(-13.6693)}, 
-    {FLOAT_FIXED(-2.38292), FLOAT_FIXED(41.2247), FLOAT_FIXED(-17.63116)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(80.163), FLOAT_FIXED(0.11308)}, 
-    {FLOAT_FIXED(6.24314), FLOAT_FIXED(92.3312), FLOAT_FIXED(-19.01576)}, 
-    {FLOAT_FIXED(2.3702), FLOAT_FIXED(136.13682), FLOAT_FIXED(-12.0168)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(131.2695), FLOAT_FIXED(-16.09896)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(136.13678), FLOAT_FIXED(-16.83966)}, 
-    {FLOAT_FIXED(-1.51744), FLOAT_FIXED(21.75556), FLOAT_FIXED(4.62748)}, 
-    {FLOAT_FIXED(4.90574), FLOAT_FIXED(136.13678), FLOAT_FIXED(-4.21324)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(70.42842), FLOAT_FIXED(0.86548)}, 
-    {FLOAT_FIXED(13.38698), FLOAT_FIXED(141.00412), FLOAT_FIXED(-6.28038)}, 
-    {FLOAT_FIXED(20.32922), FLOAT_FIXED(33.92378), FLOAT_FIXED(-0.8634)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(145.8714), FLOAT_FIXED(-4.96564)}, 
-    {FLOAT_FIXED(6.1315), FLOAT_FIXED(141.00408), FLOAT_FIXED(-14.28454)}, 
-    {FLOAT_FIXED(6.46428), FLOAT_FIXED(99.63214), FLOAT_FIXED(-18.4789)}, 
-    {FLOAT_FIXED(13.66306), FLOAT_FIXED(145.8714), FLOAT_FIXED(-8.34752)}, 
-    {FLOAT_FIXED(24.04918), FLOAT_FIXED(43.65836), FLOAT_FIXED(-14.74704)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(131.2695), FLOAT_FIXED(-17.30466)}, 
-    {FLOAT_FIXED(-4.48468), FLOAT_FIXED(60.69386), FLOAT_FIXED(-14.2441)}, 
-    {FLOAT_FIXED(2.6463), FLOAT_FIXED(131.26952), FLOAT_FIXED(-9.94966)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(46.09198), FLOAT_FIXED(-22.79072)}, 
-    {FLOAT_FIXED(19.067), FLOAT_FIXED(53.39294), FLOAT_FIXED(-1.8483)}, 
-    {FLOAT_FIXED(14.65026), FLOAT_FIXED(123.9686), FLOAT_FIXED(-13.90308)}, 
-    {FLOAT_FIXED(15.6464), FLOAT_FIXED(136.13682), FLOAT_FIXED(-12.0168)}, 
-    {FLOAT_FIXED(13.11088), FLOAT_FIXED(136.13684), FLOAT_FIXED(-4.21324)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(133.70314), FLOAT_FIXED(-15.86644)}, 
-    {FLOAT_FIXED(-0.51884), FLOAT_FIXED(80.163), FLOAT_FIXED(-6.9081)}, 
-    {FLOAT_FIXED(14.57028), FLOAT_FIXED(141.0041), FLOAT_FIXED(-9.92222)}, 
-    {FLOAT_FIXED(13.1002), FLOAT_FIXED(26.62284), FLOAT_FIXED(-24.32946)}, 
-    {FLOAT_FIXED(2.64906), FLOAT_FIXED(121.53494), FLOAT_FIXED(-7.50632)}, 
-    {FLOAT_FIXED(3.478), FLOAT_FIXED(92.33122), FLOAT_FIXED(-17.00676)}, 
-    {FLOAT_FIXED(14.20284), FLOAT_FIXED(26.62284), FLOAT_FIXED(4.25128)}, 
-    {FLOAT_FIXED(3.50408), FLOAT_FIXED(123.96858), FLOAT_FIXED(-5.48358)}, 
-    {FLOAT_FIXED(-6.25368), FLOAT_FIXED(41.22472), FLOAT_FIXED(-14.81888)}, 
-    {FLOAT_FIXED(15.4231), FLOAT_FIXED(65.56114), FLOAT_FIXED(-18.92168)}, 
-    {FLOAT_FIXED(11.3312), FLOAT_FIXED(104.49942), FLOAT_FIXED(-18.17454)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(58.26022), FLOAT_FIXED(1.80598)}, 
-    {FLOAT_FIXED(1.709), FLOAT_FIXED(48.52564), FLOAT_FIXED(-19.9066)}, 
-    {FLOAT_FIXED(-2.5289), FLOAT_FIXED(53.39292), FLOAT_FIXED(-6.39868)}, 
-    {FLOAT_FIXED(6.24314), FLOAT_FIXED(89.89756), FLOAT_FIXED(-19.24826)}, 
-    {FLOAT_FIXED(-3.0282), FLOAT_FIXED(24.1892), FLOAT_FIXED(-0.6309)}, 
-    {FLOAT_FIXED(-9.12832), FLOAT_FIXED(9.58734), FLOAT_FIXED(-15.7529)}, 
-    {FLOAT_FIXED(13.3842), FLOAT_FIXED(131.26956), FLOAT_FIXED(-3.83704)}, 
-    {FLOAT_FIXED(15.42312), FLOAT_FIXED(63.1275), FLOAT_FIXED(-19.15418)}, 
-    {FLOAT_FIXED(22.28018), FLOAT_FIXED(63.1275), FLOAT_FIXED(-14.17224)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(4.72004), FLOAT_FIXED(5.94418)}, 
-    {FLOAT_FIXED(7.5699), FLOAT_FIXED(143.43772), FLOAT_FIXED(-15.09708)}, 
-    {FLOAT_FIXED(6.1315), FLOAT_FIXED(143.43772), FLOAT_FIXED(-14.05202)}, 
-    {FLOAT_FIXED(10.78628), FLOAT_FIXED(141.00412), FLOAT_FIXED(-4.58944)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(29.05648), FLOAT_FIXED(4.06318)}, 
-    {FLOAT_FIXED(1.59734), FLOAT_FIXED(102.0658), FLOAT_FIXED(-14.71036)}, 
-    {FLOAT_FIXED(-2.49456), FLOAT_FIXED(82.59666), FLOAT_FIXED(-13.59746)}, 
-    {FLOAT_FIXED(22.52332), FLOAT_FIXED(24.1892), FLOAT_FIXED(-5.18128)}, 
-    {FLOAT_FIXED(10.10406), FLOAT_FIXED(150.3672), FLOAT_FIXED(-5.31312)}, 
-    {FLOAT_FIXED(5.1804), FLOAT_FIXED(70.42842), FLOAT_FIXED(0.86548)}, 
-    {FLOAT_FIXED(11.33974), FLOAT_FIXED(148.11928), FLOAT_FIXED(-14.00098)}, 
-    {FLOAT_FIXED(15.16082), FLOAT_FIXED(99.63216), FLOAT_FIXED(-1.39172)}, 
-    {FLOAT_FIXED(-5.81144), FLOAT_FIXED(46.092), FLOAT_FIXED(-14.67518)}, 
-    {FLOAT_FIXED(17.80478), FLOAT_FIXED(72.86208), FLOAT_FIXED(-2.8332)}, 
-    {FLOAT_FIXED(3.03574), FLOAT_FIXED(80.163), FLOAT_FIXED(-17.84796)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(55.82656), FLOAT_FIXED(-21.8607)}, 
-    {FLOAT_FIXED(17.66812), FLOAT_FIXED(75.29572), FLOAT_FIXED(-3.0213)}, 
-    {FLOAT_FIXED(1.709), FLOAT_FIXED(50.95928), FLOAT_FIXED(-19.67408)}, 
-    {FLOAT_FIXED(-1.09774), FLOAT_FIXED(72.86206), FLOAT_FIXED(-6.86368)}, 
-    {FLOAT_FIXED(20.23992), FLOAT_FIXED(55.82656), FLOAT_FIXED(-6.06688)}, 
-    {FLOAT_FIXED(2.10518), FLOAT_FIXED(102.0658), FLOAT_FIXED(-4.31056)}, 
-    {FLOAT_FIXED(18.43588), FLOAT_FIXED(63.1275), FLOAT_FIXED(-2.34076)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(72.86206), FLOAT_FIXED(-22.8848)}, 
-    {FLOAT_FIXED(17.19212), FLOAT_FIXED(29.05648), FLOAT_FIXED(-21.124)}, 
-    {FLOAT_FIXED(15.02416), FLOAT_FIXED(102.06582), FLOAT_FIXED(-1.57982)}, 
-    {FLOAT_FIXED(-3.83848), FLOAT_FIXED(53.39292), FLOAT_FIXED(-10.42916)}, 
-    {FLOAT_FIXED(4.80474), FLOAT_FIXED(116.66766), FLOAT_FIXED(-15.64564)}, 
-    {FLOAT_FIXED(5.31706), FLOAT_FIXED(72.86206), FLOAT_FIXED(0.67738)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(82.59662), FLOAT_FIXED(-21.95478)}, 
-    {FLOAT_FIXED(21.0629), FLOAT_FIXED(31.49014), FLOAT_FIXED(-18.07922)}, 
-    {FLOAT_FIXED(6.54704), FLOAT_FIXED(119.1013), FLOAT_FIXED(-2.89654)}, 
-    {FLOAT_FIXED(17.53144), FLOAT_FIXED(77.72936), FLOAT_FIXED(-3.2094)}, 
-    {FLOAT_FIXED(12.65796), FLOAT_FIXED(46.09198), FLOAT_FIXED(-22.79072)}, 
-    {FLOAT_FIXED(16.03092), FLOAT_FIXED(114.23402), FLOAT_FIXED(-7.72186)}, 
-    {FLOAT_FIXED(4.47414), FLOAT_FIXED(9.58734), FLOAT_FIXED(-25.63568)}, 
-    {FLOAT_FIXED(16.83372), FLOAT_FIXED(114.23402), FLOAT_FIXED(-10.19264)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(138.57044), FLOAT_FIXED(-15.40144)}, 
-    {FLOAT_FIXED(24.2703), FLOAT_FIXED(41.22472), FLOAT_FIXED(-14.81888)}, 
-    {FLOAT_FIXED(6.90652), FLOAT_FIXED(119.10128), FLOAT_FIXED(-16.94016)}, 
-    {FLOAT_FIXED(-1.61006), FLOAT_FIXED(92.33122), FLOAT_FIXED(-13.31006)}, 
-    {FLOAT_FIXED(6.02202), FLOAT_FIXED(82.59662), FLOAT_FIXED(-19.78512)}, 
-    {FLOAT_FIXED(-0.83504), FLOAT_FIXED(65.56114), FLOAT_FIXED(-16.43072)}, 
-    {FLOAT_FIXED(10.92294), FLOAT_FIXED(138.57048), FLOAT_FIXED(-4.40134)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(89.89758), FLOAT_FIXED(-0.63932)}, 
-    {FLOAT_FIXED(0.2706), FLOAT_FIXED(82.59664), FLOAT_FIXED(-15.60646)}, 
-    {FLOAT_FIXED(1.709), FLOAT_FIXED(53.39292), FLOAT_FIXED(-19.44158)}, 
-    {FLOAT_FIXED(0.82232), FLOAT_FIXED(119.10132), FLOAT_FIXED(-12.51974)}, 
-    {FLOAT_FIXED(-6.02232), FLOAT_FIXED(4.72004), FLOAT_FIXED(-4.97622)}, 
-    {FLOAT_FIXED(5.09022), FLOAT_FIXED(155.33988), FLOAT_FIXED(-12.15838)}, 
-    {FLOAT_FIXED(-2.0523), FLOAT_FIXED(87.46394), FLOAT_FIXED(-13.45376)}, 
-    {FLOAT_FIXED(20.81884), FLOAT_FIXED(48.52564), FLOAT_FIXED(-6.02248)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(87.46392), FLOAT_FIXED(-21.48976)}, 
-    {FLOAT_FIXED(-3.93264), FLOAT_FIXED(9.58734), FLOAT_FIXED(0.23776)}, 
-    {FLOAT_FIXED(2.17248), FLOAT_FIXED(87.46392), FLOAT_FIXED(-0.45122)}, 
-    {FLOAT_FIXED(17.19212), FLOAT_FIXED(26.62284), FLOAT_FIXED(-21.35652)}, 
-    {FLOAT_FIXED(2.5935), FLOAT_FIXED(67.99478), FLOAT_FIXED(-18.68918)}, 
-    {FLOAT_FIXED(16.52746), FLOAT_FIXED(75.29572), FLOAT_FIXED(0.48928)}, 
-    {FLOAT_FIXED(15.31534), FLOAT_FIXED(123.9686), FLOAT_FIXED(-7.95436)}, 
-    {FLOAT_FIXED(6.6854), FLOAT_FIXED(111.80036), FLOAT_FIXED(-17.47702)}, 
-    {FLOAT_FIXED(-5.66454), FLOAT_FIXED(9.58734), FLOAT_FIXED(-5.09246)}, 
-    {FLOAT_FIXED(11.3312), FLOAT_FIXED(102.06578), FLOAT_FIXED(-18.40704)}, 
-    {FLOAT_FIXED(17.37762), FLOAT_FIXED(94.76488), FLOAT_FIXED(-6.9969)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(-0.14724), FLOAT_FIXED(6.32038)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(111.80034), FLOAT_FIXED(-19.16472)}, 
-    {FLOAT_FIXED(14.5386), FLOAT_FIXED(82.59664), FLOAT_FIXED(-17.93678)}, 
-    {FLOAT_FIXED(-0.72556), FLOAT_FIXED(102.0658), FLOAT_FIXED(-13.02268)}, 
-    {FLOAT_FIXED(-3.16486), FLOAT_FIXED(21.75556), FLOAT_FIXED(-0.4428)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(109.36672), FLOAT_FIXED(-2.14414)}, 
-    {FLOAT_FIXED(20.06892), FLOAT_FIXED(87.46394), FLOAT_FIXED(-13.45376)}, 
-    {FLOAT_FIXED(15.84414), FLOAT_FIXED(87.46396), FLOAT_FIXED(-0.45122)}, 
-    {FLOAT_FIXED(12.43684), FLOAT_FIXED(53.39292), FLOAT_FIXED(-22.25386)}, 
-    {FLOAT_FIXED(3.12912), FLOAT_FIXED(104.49942), FLOAT_FIXED(-1.76792)}, 
-    {FLOAT_FIXED(6.54814), FLOAT_FIXED(150.36716), FLOAT_FIXED(-5.31312)}, 
-    {FLOAT_FIXED(5.68924), FLOAT_FIXED(131.26952), FLOAT_FIXED(-14.89324)}, 
-    {FLOAT_FIXED(-2.80222), FLOAT_FIXED(48.52564), FLOAT_FIXED(-6.02248)}, 
-    {FLOAT_FIXED(14.98086), FLOAT_FIXED(75.29572), FLOAT_FIXED(-18.31298)}, 
-    {FLOAT_FIXED(11.55232), FLOAT_FIXED(94.76486), FLOAT_FIXED(-18.9439)}, 
-    {FLOAT_FIXED(-7.58044), FLOAT_FIXED(26.62284), FLOAT_FIXED(-15.24996)}, 
-    {FLOAT_FIXED(0.75848), FLOAT_FIXED(82.59664), FLOAT_FIXED(-3.58562)}, 
-    {FLOAT_FIXED(2.5935), FLOAT_FIXED(72.86206), FLOAT_FIXED(-18.22416)}, 
-    {FLOAT_FIXED(17.08264), FLOAT_FIXED(89.89758), FLOAT_FIXED(-15.39092)}, 
-    {FLOAT_FIXED(9.28164), FLOAT_FIXED(102.0658), FLOAT_FIXED(-1.57982)}, 
-    {FLOAT_FIXED(13.6541), FLOAT_FIXED(102.0658), FLOAT_FIXED(-16.71936)}, 
-    {FLOAT_FIXED(0.77566), FLOAT_FIXED(97.1985), FLOAT_FIXED(-7.185)}, 
-    {FLOAT_FIXED(19.38768), FLOAT_FIXED(67.9948), FLOAT_FIXED(-6.48748)}, 
-    {FLOAT_FIXED(16.11746), FLOAT_FIXED(82.59666), FLOAT_FIXED(-0.07502)}, 
-    {FLOAT_FIXED(-3.04628), FLOAT_FIXED(31.49014), FLOAT_FIXED(-18.07922)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(33.92376), FLOAT_FIXED(-26.60488)}, 
-    {FLOAT_FIXED(16.74986), FLOAT_FIXED(38.79106), FLOAT_FIXED(-20.5153)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(141.00406), FLOAT_FIXED(-16.37464)}, 
-    {FLOAT_FIXED(-1.21724), FLOAT_FIXED(85.03028), FLOAT_FIXED(-10.27498)}, 
-    {FLOAT_FIXED(-0.42412), FLOAT_FIXED(41.2247), FLOAT_FIXED(3.12268)}, 
-    {FLOAT_FIXED(6.1712), FLOAT_FIXED(150.47256), FLOAT_FIXED(-5.32128)}, 
-    {FLOAT_FIXED(-7.39642), FLOAT_FIXED(9.58734), FLOAT_FIXED(-10.42268)}, 
-    {FLOAT_FIXED(1.48786), FLOAT_FIXED(41.2247), FLOAT_FIXED(-20.44346)}, 
-    {FLOAT_FIXED(9.28162), FLOAT_FIXED(33.92378), FLOAT_FIXED(3.68698)}, 
-    {FLOAT_FIXED(-5.59032), FLOAT_FIXED(48.52564), FLOAT_FIXED(-14.60334)}, 
-    {FLOAT_FIXED(14.5386), FLOAT_FIXED(85.03028), FLOAT_FIXED(-17.70426)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(48.52562), FLOAT_FIXED(-25.20986)}, 
-    {FLOAT_FIXED(5.68924), FLOAT_FIXED(136.1368), FLOAT_FIXED(-14.42822)}, 
-    {FLOAT_FIXED(7.5699), FLOAT_FIXED(141.00408), FLOAT_FIXED(-15.3296)}, 
-    {FLOAT_FIXED(-0.01414), FLOAT_FIXED(48.52562), FLOAT_FIXED(2.55838)}, 
-    {FLOAT_FIXED(2.42516), FLOAT_FIXED(128.83588), FLOAT_FIXED(-10.0215)}, 
-    {FLOAT_FIXED(3.478), FLOAT_FIXED(87.46394), FLOAT_FIXED(-17.47176)}, 
-    {FLOAT_FIXED(-2.39708), FLOAT_FIXED(33.92376), FLOAT_FIXED(-1.12334)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(126.40224), FLOAT_FIXED(-3.46084)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(53.39292), FLOAT_FIXED(-22.09322)}, 
-    {FLOAT_FIXED(0.8245), FLOAT_FIXED(29.05648), FLOAT_FIXED(-21.124)}, 
-    {FLOAT_FIXED(13.1002), FLOAT_FIXED(24.1892), FLOAT_FIXED(-24.56196)}, 
-    {FLOAT_FIXED(17.95652), FLOAT_FIXED(87.46396), FLOAT_FIXED(-6.9525)}, 
-    {FLOAT_FIXED(16.97316), FLOAT_FIXED(121.53496), FLOAT_FIXED(-12.4479)}, 
-    {FLOAT_FIXED(12.57236), FLOAT_FIXED(150.3672), FLOAT_FIXED(-6.11514)}, 
-    {FLOAT_FIXED(14.09636), FLOAT_FIXED(94.76486), FLOAT_FIXED(-17.09556)}, 
-    {FLOAT_FIXED(0.02506), FLOAT_FIXED(99.63214), FLOAT_FIXED(-10.10384)}, 
-    {FLOAT_FIXED(26.0393), FLOAT_FIXED(21.75556), FLOAT_FIXED(-15.39366)}, 
-    {FLOAT_FIXED(18.79368), FLOAT_FIXED(58.26022), FLOAT_FIXED(-2.2245)}, 
-    {FLOAT_FIXED(0.16112), FLOAT_FIXED(14.45462), FLOAT_FIXED(-22.03706)}, 
-    {FLOAT_FIXED(23.60692), FLOAT_FIXED(48.52564), FLOAT_FIXED(-14.60334)}, 
-    {FLOAT_FIXED(18.03074), FLOAT_FIXED(48.52564), FLOAT_FIXED(2.55838)}, 
-    {FLOAT_FIXED(0.06008), FLOAT_FIXED(87.46394), FLOAT_FIXED(-6.9525)}, 
-    {FLOAT_FIXED(14.7914), FLOAT_FIXED(138.57046), FLOAT_FIXED(-9.99406)}, 
-    {FLOAT_FIXED(11.11008), FLOAT_FIXED(111.80036), FLOAT_FIXED(-17.63768)}, 
-    {FLOAT_FIXED(4.80474), FLOAT_FIXED(121.53494), FLOAT_FIXED(-15.18064)}, 
-    {FLOAT_FIXED(4.36042), FLOAT_FIXED(41.2247), FLOAT_FIXED(3.12268)}, 
-    {FLOAT_FIXED(9.28164), FLOAT_FIXED(92.33122), FLOAT_FIXED(-0.82742)}, 
-    {FLOAT_FIXED(13.21186), FLOAT_FIXED(111.80036), FLOAT_FIXED(-16.11066)}, 
-    {FLOAT_FIXED(-0.6555), FLOAT_FIXED(77.72936), FLOAT_FIXED(-6.72)}, 
-    {FLOAT_FIXED(15.09422), FLOAT_FIXED(126.40226), FLOAT_FIXED(-7.88252)}, 
-    {FLOAT_FIXED(13.93086), FLOAT_FIXED(121.53498), FLOAT_FIXED(-3.08464)}, 
-    {FLOAT_FIXED(19.62666), FLOAT_FIXED(92.33122), FLOAT_FIXED(-13.31006)}, 
-    {FLOAT_FIXED(16.66412), FLOAT_FIXED(72.86208), FLOAT_FIXED(0.67738)}, 
-    {FLOAT_FIXED(12.32736), FLOAT_FIXED(141.00408), FLOAT_FIXED(-13.96322)}, 
-    {FLOAT_FIXED(0.80584), FLOAT_FIXED(63.12748), FLOAT_FIXED(1.42978)}, 
-    {FLOAT_FIXED(15.77476), FLOAT_FIXED(104.49946), FLOAT_FIXED(-4.49866)}, 
-    {FLOAT_FIXED(11.99458), FLOAT_FIXED(75.2957), FLOAT_FIXED(-20.48264)}, 
-    {FLOAT_FIXED(4.2573), FLOAT_FIXED(155.33988), FLOAT_FIXED(-11.012)}, 
-    {FLOAT_FIXED(25.41304), FLOAT_FIXED(9.58734), FLOAT_FIXED(-10.42268)}, 
-    {FLOAT_FIXED(9.28162), FLOAT_FIXED(24.1892), FLOAT_FIXED(4.43938)}, 
-    {FLOAT_FIXED(0.12738), FLOAT_FIXED(72.86206), FLOAT_FIXED(-3.09316)}, 
-    {FLOAT_FIXED(1.4857), FLOAT_FIXED(126.40224), FLOAT_FIXED(-12.3042)}, 
-    {FLOAT_FIXED(13.9364), FLOAT_FIXED(141.00412), FLOAT_FIXED(-7.97132)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(126.4022), FLOAT_FIXED(-17.76968)}, 
-    {FLOAT_FIXED(15.64424), FLOAT_FIXED(60.69386), FLOAT_FIXED(-19.22604)}, 
-    {FLOAT_FIXED(4.35908), FLOAT_FIXED(126.40222), FLOAT_FIXED(-3.46084)}, 
-    {FLOAT_FIXED(-2.47408), FLOAT_FIXED(4.72004), FLOAT_FIXED(5.94418)}, 
-    {FLOAT_FIXED(4.0871), FLOAT_FIXED(31.49012), FLOAT_FIXED(3.87508)}, 
-    {FLOAT_FIXED(11.77346), FLOAT_FIXED(85.03028), FLOAT_FIXED(-19.71328)}, 
-    {FLOAT_FIXED(8.73498), FLOAT_FIXED(131.26954), FLOAT_FIXED(-3.83704)}, 
-    {FLOAT_FIXED(6.1315), FLOAT_FIXED(145.87138), FLOAT_FIXED(-13.81952)}, 
-    {FLOAT_FIXED(-4.94896), FLOAT_FIXED(19.32192), FLOAT_FIXED(-5.32496)}, 
-    {FLOAT_FIXED(18.94544), FLOAT_FIXED(72.86208), FLOAT_FIXED(-6.3438)}, 
-    {FLOAT_FIXED(18.30406), FLOAT_FIXED(43.65836), FLOAT_FIXED(2.93458)}, 
-    {FLOAT_FIXED(11.10044), FLOAT_FIXED(150.4726), FLOAT_FIXED(-5.32128)}, 
-    {FLOAT_FIXED(18.85072), FLOAT_FIXED(33.92378), FLOAT_FIXED(3.68698)}, 
-    {FLOAT_FIXED(14.98086), FLOAT_FIXED(77.72936), FLOAT_FIXED(-18.08048)}, 
-    {FLOAT_FIXED(25.81818), FLOAT_FIXED(24.1892), FLOAT_FIXED(-15.32182)}, 
-    {FLOAT_FIXED(-6.2386), FLOAT_FIXED(24.1892), FLOAT_FIXED(-10.5115)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(104.49944), FLOAT_FIXED(-1.76792)}, 
-    {FLOAT_FIXED(16.5309), FLOAT_FIXED(126.40224), FLOAT_FIXED(-12.3042)}, 
-    {FLOAT_FIXED(13.65754), FLOAT_FIXED(126.40226), FLOAT_FIXED(-3.46084)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(60.69384), FLOAT_FIXED(-24.04732)}, 
-    {FLOAT_FIXED(11.11008), FLOAT_FIXED(116.66764), FLOAT_FIXED(-17.17268)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(106.93308), FLOAT_FIXED(-1.95602)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(48.52564), FLOAT_FIXED(2.55838)}, 
-    {FLOAT_FIXED(13.54246), FLOAT_FIXED(9.58734), FLOAT_FIXED(-25.63568)}, 
-    {FLOAT_FIXED(15.20198), FLOAT_FIXED(70.42842), FLOAT_FIXED(-18.61732)}, 
-    {FLOAT_FIXED(-5.30674), FLOAT_FIXED(14.45462), FLOAT_FIXED(-5.20872)}, 
-    {FLOAT_FIXED(17.96714), FLOAT_FIXED(75.29572), FLOAT_FIXED(-16.14332)}, 
-    {FLOAT_FIXED(3.8086), FLOAT_FIXED(131.26952), FLOAT_FIXED(-13.52686)}, 
-    {FLOAT_FIXED(4.3625), FLOAT_FIXED(106.93308), FLOAT_FIXED(-16.25434)}, 
-    {FLOAT_FIXED(1.1551), FLOAT_FIXED(94.76486), FLOAT_FIXED(-15.08656)}, 
-    {FLOAT_FIXED(18.44074), FLOAT_FIXED(41.22472), FLOAT_FIXED(3.12268)}, 
-    {FLOAT_FIXED(3.40378), FLOAT_FIXED(9.58734), FLOAT_FIXED(5.56798)}, 
-    {FLOAT_FIXED(6.2737), FLOAT_FIXED(109.36672), FLOAT_FIXED(-2.14414)}, 
-    {FLOAT_FIXED(17.51428), FLOAT_FIXED(92.33124), FLOAT_FIXED(-6.8088)}, 
-    {FLOAT_FIXED(20.51116), FLOAT_FIXED(82.59666), FLOAT_FIXED(-13.59746)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(9.58734), FLOAT_FIXED(-28.92994)}, 
-    {FLOAT_FIXED(16.86152), FLOAT_FIXED(92.33122), FLOAT_FIXED(-15.31906)}, 
-    {FLOAT_FIXED(19.83478), FLOAT_FIXED(41.2247), FLOAT_FIXED(-1.16776)}, 
-    {FLOAT_FIXED(18.57048), FLOAT_FIXED(92.33124), FLOAT_FIXED(-10.05944)}, 
-    {FLOAT_FIXED(6.90652), FLOAT_FIXED(121.53492), FLOAT_FIXED(-16.70766)}, 
-    {FLOAT_FIXED(13.6541), FLOAT_FIXED(104.49944), FLOAT_FIXED(-16.48686)}, 
-    {FLOAT_FIXED(5.0424), FLOAT_FIXED(138.57044), FLOAT_FIXED(-4.40134)}, 
-    {FLOAT_FIXED(13.11772), FLOAT_FIXED(148.1193), FLOAT_FIXED(-7.23132)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(141.00408), FLOAT_FIXED(-15.16894)}, 
-    {FLOAT_FIXED(9.28162), FLOAT_FIXED(43.65834), FLOAT_FIXED(2.93458)}, 
-    {FLOAT_FIXED(-7.35932), FLOAT_FIXED(29.05648), FLOAT_FIXED(-15.17812)}, 
-    {FLOAT_FIXED(22.24998), FLOAT_FIXED(29.05648), FLOAT_FIXED(-5.55748)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(29.05648), FLOAT_FIXED(-27.0699)}, 
-    {FLOAT_FIXED(4.3625), FLOAT_FIXED(111.80036), FLOAT_FIXED(-15.78934)}, 
-    {FLOAT_FIXED(16.30762), FLOAT_FIXED(46.092), FLOAT_FIXED(-20.1391)}, 
-    {FLOAT_FIXED(-1.10744), FLOAT_FIXED(29.05648), FLOAT_FIXED(4.06318)}, 
-    {FLOAT_FIXED(-3.38114), FLOAT_FIXED(41.2247), FLOAT_FIXED(-5.97808)}, 
-    {FLOAT_FIXED(3.03574), FLOAT_FIXED(82.59664), FLOAT_FIXED(-17.61546)}, 
-    {FLOAT_FIXED(0.99678), FLOAT_FIXED(99.63214), FLOAT_FIXED(-7.11316)}, 
-    {FLOAT_FIXED(9.28164), FLOAT_FIXED(121.53494), FLOAT_FIXED(-3.08464)}, 
-    {FLOAT_FIXED(14.3395), FLOAT_FIXED(24.1892), FLOAT_FIXED(4.43938)}, 
-    {FLOAT_FIXED(1.26674), FLOAT_FIXED(38.79106), FLOAT_FIXED(-20.5153)}, 
-    {FLOAT_FIXED(3.63796), FLOAT_FIXED(136.1368), FLOAT_FIXED(-8.11502)}, 
-    {FLOAT_FIXED(18.22986), FLOAT_FIXED(82.59666), FLOAT_FIXED(-6.5763)}, 
-    {FLOAT_FIXED(-7.80156), FLOAT_FIXED(24.1892), FLOAT_FIXED(-15.32182)}, 
-    {FLOAT_FIXED(0.25918), FLOAT_FIXED(53.39292), FLOAT_FIXED(2.18218)}, 
-    {FLOAT_FIXED(-3.37906), FLOAT_FIXED(72.86208), FLOAT_FIXED(-13.88486)}, 
-    {FLOAT_FIXED(17.19212), FLOAT_FIXED(24.1892), FLOAT_FIXED(-21.58902)}, 
-    {FLOAT_FIXED(18.74216), FLOAT_FIXED(102.0658), FLOAT_FIXED(-13.02268)}, 
-    {FLOAT_FIXED(16.74986), FLOAT_FIXED(36.35742), FLOAT_FIXED(-20.7478)}, 
-    {FLOAT_FIXED(14.42914), FLOAT_FIXED(128.83588), FLOAT_FIXED(-13.59872)}, 
-    {FLOAT_FIXED(25.37594), FLOAT_FIXED(29.05648), FLOAT_FIXED(-15.17812)}, 
-    {FLOAT_FIXED(19.12404), FLOAT_FIXED(29.0565), FLOAT_FIXED(4.06318)}, 
-    {FLOAT_FIXED(0.50234), FLOAT_FIXED(92.33122), FLOAT_FIXED(-6.8088)}, 
-    {FLOAT_FIXED(0.93396), FLOAT_FIXED(92.33122), FLOAT_FIXED(-15.15842)}, 
-    {FLOAT_FIXED(19.01272), FLOAT_FIXED(87.46396), FLOAT_FIXED(-10.20314)}, 
-    {FLOAT_FIXED(3.03574), FLOAT_FIXED(77.72936), FLOAT_FIXED(-18.08048)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(41.2247), FLOAT_FIXED(3.12268)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(97.1985), FLOAT_FIXED(-1.20362)}, 
-    {FLOAT_FIXED(11.8851), FLOAT_FIXED(145.87138), FLOAT_FIXED(-13.81952)}, 
-    {FLOAT_FIXED(-0.38216), FLOAT_FIXED(82.59664), FLOAT_FIXED(-7.0962)}, 
-    {FLOAT_FIXED(16.52538), FLOAT_FIXED(106.9331), FLOAT_FIXED(-7.4175)}, 
-    {FLOAT_FIXED(-0.28746), FLOAT_FIXED(43.65834), FLOAT_FIXED(2.93458)}, 
-    {FLOAT_FIXED(3.478), FLOAT_FIXED(89.89758), FLOAT_FIXED(-17.23926)}, 
-    {FLOAT_FIXED(18.51886), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-22.95012)}, 
-    {FLOAT_FIXED(3.92378), FLOAT_FIXED(150.3672), FLOAT_FIXED(-10.79468)}, 
-    {FLOAT_FIXED(12.83756), FLOAT_FIXED(141.00412), FLOAT_FIXED(-4.58944)}, 
-    {FLOAT_FIXED(5.02588), FLOAT_FIXED(123.96858), FLOAT_FIXED(-15.10878)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(41.2247), FLOAT_FIXED(-25.90736)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(31.49014), FLOAT_FIXED(3.87508)}, 
-    {FLOAT_FIXED(15.86536), FLOAT_FIXED(55.82656), FLOAT_FIXED(-19.5304)}, 
-    {FLOAT_FIXED(8.73498), FLOAT_FIXED(141.0041), FLOAT_FIXED(-4.58944)}, 
-    {FLOAT_FIXED(5.57978), FLOAT_FIXED(65.56114), FLOAT_FIXED(-21.09134)}, 
-    {FLOAT_FIXED(-0.2833), FLOAT_FIXED(106.93308), FLOAT_FIXED(-12.87898)}, 
-    {FLOAT_FIXED(-2.30778), FLOAT_FIXED(55.82656), FLOAT_FIXED(-6.32684)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(106.93306), FLOAT_FIXED(-19.62972)}, 
-    {FLOAT_FIXED(7.34878), FLOAT_FIXED(131.2695), FLOAT_FIXED(-16.09896)}, 
-    {FLOAT_FIXED(3.26578), FLOAT_FIXED(106.93306), FLOAT_FIXED(-1.95602)}, 
-    {FLOAT_FIXED(12.65796), FLOAT_FIXED(43.65834), FLOAT_FIXED(-23.02324)}, 
-    {FLOAT_FIXED(2.15124), FLOAT_FIXED(63.1275), FLOAT_FIXED(-18.83288)}, 
-    {FLOAT_FIXED(22.94356), FLOAT_FIXED(55.82656), FLOAT_FIXED(-14.3878)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(136.13682), FLOAT_FIXED(-4.21324)}, 
-    {FLOAT_FIXED(0.8245), FLOAT_FIXED(24.1892), FLOAT_FIXED(-21.58902)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(14.45462), FLOAT_FIXED(5.19178)}, 
-    {FLOAT_FIXED(5.02264), FLOAT_FIXED(150.36718), FLOAT_FIXED(-7.41278)}, 
-    {FLOAT_FIXED(1.04344), FLOAT_FIXED(121.53496), FLOAT_FIXED(-12.4479)}, 
-    {FLOAT_FIXED(24.39672), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-4.85996)}, 
-    {FLOAT_FIXED(-2.16178), FLOAT_FIXED(43.65836), FLOAT_FIXED(-17.55932)}, 
-    {FLOAT_FIXED(2.9241), FLOAT_FIXED(121.53494), FLOAT_FIXED(-13.81426)}, 
-    {FLOAT_FIXED(18.7916), FLOAT_FIXED(89.8976), FLOAT_FIXED(-10.13128)}, 
-    {FLOAT_FIXED(0.8251), FLOAT_FIXED(109.36672), FLOAT_FIXED(-10.0764)}, 
-    {FLOAT_FIXED(-3.48854), FLOAT_FIXED(24.1892), FLOAT_FIXED(-18.45542)}, 
-    {FLOAT_FIXED(18.29992), FLOAT_FIXED(106.93308), FLOAT_FIXED(-12.87898)}, 
-    {FLOAT_FIXED(14.75084), FLOAT_FIXED(106.9331), FLOAT_FIXED(-1.95602)}, 
-    {FLOAT_FIXED(3.92024), FLOAT_FIXED(97.1985), FLOAT_FIXED(-16.86306)}, 
-    {FLOAT_FIXED(2.58246), FLOAT_FIXED(94.76486), FLOAT_FIXED(-1.01552)}, 
-    {FLOAT_FIXED(4.49708), FLOAT_FIXED(43.65834), FLOAT_FIXED(2.93458)}, 
-    {FLOAT_FIXED(1.26674), FLOAT_FIXED(36.35742), FLOAT_FIXED(-20.7478)}, 
-    {FLOAT_FIXED(-1.37108), FLOAT_FIXED(67.99478), FLOAT_FIXED(-6.48748)}, 
-    {FLOAT_FIXED(1.709), FLOAT_FIXED(46.092), FLOAT_FIXED(-20.1391)}, 
-    {FLOAT_FIXED(23.32336), FLOAT_FIXED(14.45462), FLOAT_FIXED(-5.20872)}, 
-    {FLOAT_FIXED(5.04374), FLOAT_FIXED(63.1275), FLOAT_FIXED(1.42978)}, 
-    {FLOAT_FIXED(11.33414), FLOAT_FIXED(148.1193), FLOAT_FIXED(-5.13938)}, 
-    {FLOAT_FIXED(2.26072), FLOAT_FIXED(111.80036), FLOAT_FIXED(-14.26232)}, 
-    {FLOAT_FIXED(23.94962), FLOAT_FIXED(26.62284), FLOAT_FIXED(-10.1797)}, 
-    {FLOAT_FIXED(9.28162), FLOAT_FIXED(63.1275), FLOAT_FIXED(1.42978)}, 
-    {FLOAT_FIXED(13.6541), FLOAT_FIXED(106.93308), FLOAT_FIXED(-16.25434)}, 
-    {FLOAT_FIXED(1.2179), FLOAT_FIXED(102.0658), FLOAT_FIXED(-7.0413)}, 
-    {FLOAT_FIXED(2.15124), FLOAT_FIXED(60.69386), FLOAT_FIXED(-19.06538)}, 
-    {FLOAT_FIXED(14.59976), FLOAT_FIXED(133.70318), FLOAT_FIXED(-8.18686)}, 
-    {FLOAT_FIXED(20.21734), FLOAT_FIXED(9.58734), FLOAT_FIXED(5.56798)}, 
-    {FLOAT_FIXED(-0.83412), FLOAT_FIXED(33.92376), FLOAT_FIXED(3.68698)}, 
-    {FLOAT_FIXED(15.53648), FLOAT_FIXED(121.53496), FLOAT_FIXED(-8.0262)}, 
-    {FLOAT_FIXED(5.17906), FLOAT_FIXED(141.00408), FLOAT_FIXED(-4.58944)}, 
-    {FLOAT_FIXED(20.9555), FLOAT_FIXED(46.092), FLOAT_FIXED(-5.83438)}, 
-    {FLOAT_FIXED(-1.40818), FLOAT_FIXED(48.52562), FLOAT_FIXED(-1.73206)}, 
-    {FLOAT_FIXED(2.15124), FLOAT_FIXED(58.2602), FLOAT_FIXED(-19.29788)}, 
-    {FLOAT_FIXED(18.57254), FLOAT_FIXED(60.69386), FLOAT_FIXED(-2.15266)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(14.45462), FLOAT_FIXED(-28.46492)}, 
-    {FLOAT_FIXED(19.56146), FLOAT_FIXED(46.092), FLOAT_FIXED(-1.54396)}, 
-    {FLOAT_FIXED(-3.82132), FLOAT_FIXED(67.99478), FLOAT_FIXED(-14.02856)}, 
-    {FLOAT_FIXED(21.09216), FLOAT_FIXED(43.65836), FLOAT_FIXED(-5.64628)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(67.99478), FLOAT_FIXED(-23.3498)}, 
-    {FLOAT_FIXED(13.79284), FLOAT_FIXED(43.65836), FLOAT_FIXED(2.93458)}, 
-    {FLOAT_FIXED(2.5935), FLOAT_FIXED(70.42842), FLOAT_FIXED(-18.45668)}, 
-    {FLOAT_FIXED(1.07916), FLOAT_FIXED(67.99478), FLOAT_FIXED(1.05358)}, 
-    {FLOAT_FIXED(17.8555), FLOAT_FIXED(14.45462), FLOAT_FIXED(-22.03706)}, 
-    {FLOAT_FIXED(12.97422), FLOAT_FIXED(138.57048), FLOAT_FIXED(-4.40134)}, 
-    {FLOAT_FIXED(0.71284), FLOAT_FIXED(87.46394), FLOAT_FIXED(-15.46276)}, 
-    {FLOAT_FIXED(12.99072), FLOAT_FIXED(119.1013), FLOAT_FIXED(-15.5738)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(19.32192), FLOAT_FIXED(4.81558)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(99.63212), FLOAT_FIXED(-20.32724)}, 
-    {FLOAT_FIXED(-0.06), FLOAT_FIXED(9.58734), FLOAT_FIXED(-22.34142)}, 
-    {FLOAT_FIXED(12.10622), FLOAT_FIXED(143.43772), FLOAT_FIXED(-13.89138)}, 
-    {FLOAT_FIXED(20.19256), FLOAT_FIXED(36.35742), FLOAT_FIXED(-1.0515)}, 
-    {FLOAT_FIXED(-3.73892), FLOAT_FIXED(36.35742), FLOAT_FIXED(-5.86182)}, 
-    {FLOAT_FIXED(3.5391), FLOAT_FIXED(111.80036), FLOAT_FIXED(-2.33224)}, 
-    {FLOAT_FIXED(14.5386), FLOAT_FIXED(87.46394), FLOAT_FIXED(-17.47176)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(102.06578), FLOAT_FIXED(-20.09474)}, 
-    {FLOAT_FIXED(6.82036), FLOAT_FIXED(123.96858), FLOAT_FIXED(-3.27274)}, 
-    {FLOAT_FIXED(12.7696), FLOAT_FIXED(123.96858), FLOAT_FIXED(-15.26944)}, 
-    {FLOAT_FIXED(21.83792), FLOAT_FIXED(67.99478), FLOAT_FIXED(-14.02856)}, 
-    {FLOAT_FIXED(16.93744), FLOAT_FIXED(67.9948), FLOAT_FIXED(1.05358)}, 
-    {FLOAT_FIXED(4.58362), FLOAT_FIXED(114.234), FLOAT_FIXED(-15.7175)}, 
-    {FLOAT_FIXED(-1.2344), FLOAT_FIXED(70.42842), FLOAT_FIXED(-6.67558)}, 
-    {FLOAT_FIXED(4.9164), FLOAT_FIXED(29.05648), FLOAT_FIXED(-24.09696)}, 
-    {FLOAT_FIXED(-4.92694), FLOAT_FIXED(55.82656), FLOAT_FIXED(-14.3878)}, 
-    {FLOAT_FIXED(5.45372), FLOAT_FIXED(80.163), FLOAT_FIXED(0.11308)}, 
-    {FLOAT_FIXED(11.0596), FLOAT_FIXED(136.13682), FLOAT_FIXED(-4.21324)}, 
-    {FLOAT_FIXED(18.45098), FLOAT_FIXED(80.16302), FLOAT_FIXED(-6.64814)}, 
-    {FLOAT_FIXED(12.2157), FLOAT_FIXED(63.12748), FLOAT_FIXED(-21.4845)}, 
-    {FLOAT_FIXED(19.52434), FLOAT_FIXED(65.56114), FLOAT_FIXED(-6.29938)}, 
-    {FLOAT_FIXED(-4.59416), FLOAT_FIXED(9.58734), FLOAT_FIXED(-19.04716)}, 
-    {FLOAT_FIXED(15.57082), FLOAT_FIXED(92.33124), FLOAT_FIXED(-0.82742)}, 
-    {FLOAT_FIXED(16.25412), FLOAT_FIXED(80.16302), FLOAT_FIXED(0.11308)}, 
-    {FLOAT_FIXED(15.75588), FLOAT_FIXED(109.36672), FLOAT_FIXED(-14.49482)}, 
-    {FLOAT_FIXED(5.72706), FLOAT_FIXED(89.89758), FLOAT_FIXED(-0.63932)}, 
-    {FLOAT_FIXED(-4.85964), FLOAT_FIXED(41.2247), FLOAT_FIXED(-10.52846)}, 
-    {FLOAT_FIXED(5.247), FLOAT_FIXED(126.40222), FLOAT_FIXED(-15.03694)}, 
-    {FLOAT_FIXED(5.59038), FLOAT_FIXED(82.59664), FLOAT_FIXED(-0.07502)}, 
-    {FLOAT_FIXED(20.7323), FLOAT_FIXED(80.16302), FLOAT_FIXED(-13.6693)}, 
-    {FLOAT_FIXED(1.76248), FLOAT_FIXED(80.163), FLOAT_FIXED(0.11308)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(38.79106), FLOAT_FIXED(3.31078)}, 
-    {FLOAT_FIXED(3.2547), FLOAT_FIXED(145.8714), FLOAT_FIXED(-11.7294)}, 
-    {FLOAT_FIXED(20.10326), FLOAT_FIXED(58.26022), FLOAT_FIXED(-6.25498)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(145.87136), FLOAT_FIXED(-15.90964)}, 
-    {FLOAT_FIXED(11.99458), FLOAT_FIXED(72.86206), FLOAT_FIXED(-20.71514)}, 
-    {FLOAT_FIXED(5.45238), FLOAT_FIXED(145.87136), FLOAT_FIXED(-4.96564)}, 
-    {FLOAT_FIXED(3.3674), FLOAT_FIXED(121.53494), FLOAT_FIXED(-5.29548)}, 
-    {FLOAT_FIXED(3.92024), FLOAT_FIXED(102.0658), FLOAT_FIXED(-16.39804)}, 
-    {FLOAT_FIXED(3.9491), FLOAT_FIXED(119.10128), FLOAT_FIXED(-2.89654)}, 
-    {FLOAT_FIXED(6.13704), FLOAT_FIXED(102.0658), FLOAT_FIXED(-1.57982)}, 
-    {FLOAT_FIXED(14.06618), FLOAT_FIXED(33.92378), FLOAT_FIXED(3.68698)}, 
-    {FLOAT_FIXED(-3.24448), FLOAT_FIXED(43.65834), FLOAT_FIXED(-6.16618)}, 
-    {FLOAT_FIXED(-0.55386), FLOAT_FIXED(92.33122), FLOAT_FIXED(-10.05944)}, 
-    {FLOAT_FIXED(0.2812), FLOAT_FIXED(89.89758), FLOAT_FIXED(-6.88064)}, 
-    {FLOAT_FIXED(4.6324), FLOAT_FIXED(131.2695), FLOAT_FIXED(-3.83704)}, 
-    {FLOAT_FIXED(16.08866), FLOAT_FIXED(131.26954), FLOAT_FIXED(-12.1605)}, 
-    {FLOAT_FIXED(14.98086), FLOAT_FIXED(72.86206), FLOAT_FIXED(-18.54548)}, 
-    {FLOAT_FIXED(-1.38076), FLOAT_FIXED(24.1892), FLOAT_FIXED(4.43938)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(119.10128), FLOAT_FIXED(-18.4672)}, 
-    {FLOAT_FIXED(13.24754), FLOAT_FIXED(133.7032), FLOAT_FIXED(-4.02514)}, 
-    {FLOAT_FIXED(14.7619), FLOAT_FIXED(145.8714), FLOAT_FIXED(-11.7294)}, 
-    {FLOAT_FIXED(12.56424), FLOAT_FIXED(145.87142), FLOAT_FIXED(-4.96564)}, 
-    {FLOAT_FIXED(13.25032), FLOAT_FIXED(143.43776), FLOAT_FIXED(-6.46848)}, 
-    {FLOAT_FIXED(3.36188), FLOAT_FIXED(141.0041), FLOAT_FIXED(-10.18216)}, 
-    {FLOAT_FIXED(5.31572), FLOAT_FIXED(143.43772), FLOAT_FIXED(-4.77754)}, 
-    {FLOAT_FIXED(15.86754), FLOAT_FIXED(133.70318), FLOAT_FIXED(-12.08864)}, 
-    {FLOAT_FIXED(11.3312), FLOAT_FIXED(106.93306), FLOAT_FIXED(-17.94204)}, 
-    {FLOAT_FIXED(4.22242), FLOAT_FIXED(123.96858), FLOAT_FIXED(-3.27274)}, 
-    {FLOAT_FIXED(-0.28114), FLOAT_FIXED(4.72006), FLOAT_FIXED(-22.64578)}, 
-    {FLOAT_FIXED(-1.13486), FLOAT_FIXED(53.39292), FLOAT_FIXED(-2.10826)}, 
-    {FLOAT_FIXED(27.58718), FLOAT_FIXED(4.72006), FLOAT_FIXED(-15.8966)}, 
-    {FLOAT_FIXED(20.49068), FLOAT_FIXED(4.72004), FLOAT_FIXED(5.94418)}, 
-    {FLOAT_FIXED(15.01252), FLOAT_FIXED(136.13682), FLOAT_FIXED(-10.0659)}, 
-    {FLOAT_FIXED(19.73614), FLOAT_FIXED(50.95928), FLOAT_FIXED(-17.18312)}, 
-    {FLOAT_FIXED(13.92952), FLOAT_FIXED(36.35742), FLOAT_FIXED(3.49888)}, 
-    {FLOAT_FIXED(16.03368), FLOAT_FIXED(123.9686), FLOAT_FIXED(-10.1652)}, 
-    {FLOAT_FIXED(12.77814), FLOAT_FIXED(148.11928), FLOAT_FIXED(-12.95592)}, 
-    {FLOAT_FIXED(9.90134), FLOAT_FIXED(148.11926), FLOAT_FIXED(-15.04604)}, 
-    {FLOAT_FIXED(1.37622), FLOAT_FIXED(97.1985), FLOAT_FIXED(-15.01472)}, 
-    {FLOAT_FIXED(3.23074), FLOAT_FIXED(119.1013), FLOAT_FIXED(-5.10738)}, 
-    {FLOAT_FIXED(19.16656), FLOAT_FIXED(70.42844), FLOAT_FIXED(-6.41564)}, 
-    {FLOAT_FIXED(-0.87662), FLOAT_FIXED(75.29572), FLOAT_FIXED(-6.79184)}, 
-    {FLOAT_FIXED(0.9425), FLOAT_FIXED(65.56114), FLOAT_FIXED(1.24168)}, 
-    {FLOAT_FIXED(7.95362), FLOAT_FIXED(154.9684), FLOAT_FIXED(-14.27424)}, 
-    {FLOAT_FIXED(17.30376), FLOAT_FIXED(85.03028), FLOAT_FIXED(-15.69528)}, 
-    {FLOAT_FIXED(12.88064), FLOAT_FIXED(154.9684), FLOAT_FIXED(-12.22712)}, 
-    {FLOAT_FIXED(-2.45952), FLOAT_FIXED(70.42842), FLOAT_FIXED(-10.44612)}, 
-    {FLOAT_FIXED(1.35458), FLOAT_FIXED(104.49944), FLOAT_FIXED(-7.2294)}, 
-    {FLOAT_FIXED(-1.43836), FLOAT_FIXED(82.59664), FLOAT_FIXED(-10.34682)}, 
-    {FLOAT_FIXED(15.50144), FLOAT_FIXED(109.36674), FLOAT_FIXED(-4.87486)}, 
-    {FLOAT_FIXED(-4.63852), FLOAT_FIXED(43.65836), FLOAT_FIXED(-10.4566)}, 
-    {FLOAT_FIXED(4.22376), FLOAT_FIXED(33.92378), FLOAT_FIXED(3.68698)}, 
-    {FLOAT_FIXED(-1.83118), FLOAT_FIXED(89.89758), FLOAT_FIXED(-13.38192)}, 
-    {FLOAT_FIXED(17.41264), FLOAT_FIXED(106.9331), FLOAT_FIXED(-10.14824)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(89.89756), FLOAT_FIXED(-21.25726)}, 
-    {FLOAT_FIXED(13.87524), FLOAT_FIXED(99.63214), FLOAT_FIXED(-16.7912)}, 
-    {FLOAT_FIXED(2.30914), FLOAT_FIXED(89.89756), FLOAT_FIXED(-0.63932)}, 
-    {FLOAT_FIXED(4.13518), FLOAT_FIXED(133.70316), FLOAT_FIXED(-5.97602)}, 
-    {FLOAT_FIXED(4.63374), FLOAT_FIXED(46.09198), FLOAT_FIXED(2.74648)}, 
-    {FLOAT_FIXED(13.66714), FLOAT_FIXED(148.1193), FLOAT_FIXED(-8.92228)}, 
-    {FLOAT_FIXED(21.67108), FLOAT_FIXED(36.35742), FLOAT_FIXED(-5.60188)}, 
-    {FLOAT_FIXED(5.8009), FLOAT_FIXED(75.2957), FLOAT_FIXED(-20.32198)}, 
-    {FLOAT_FIXED(-4.0596), FLOAT_FIXED(50.95928), FLOAT_FIXED(-10.501)}, 
-    {FLOAT_FIXED(20.9706), FLOAT_FIXED(63.1275), FLOAT_FIXED(-10.14176)}, 
-    {FLOAT_FIXED(-2.01728), FLOAT_FIXED(75.29572), FLOAT_FIXED(-10.30242)}, 
-    {FLOAT_FIXED(-1.92742), FLOAT_FIXED(14.45462), FLOAT_FIXED(5.19178)}, 
-    {FLOAT_FIXED(14.88616), FLOAT_FIXED(-0.14724), FLOAT_FIXED(6.32038)}, 
-    {FLOAT_FIXED(-1.94066), FLOAT_FIXED(46.092), FLOAT_FIXED(-17.48748)}, 
-    {FLOAT_FIXED(-0.1508), FLOAT_FIXED(46.09198), FLOAT_FIXED(2.74648)}, 
-    {FLOAT_FIXED(5.57978), FLOAT_FIXED(63.12748), FLOAT_FIXED(-21.32384)}, 
-    {FLOAT_FIXED(1.81848), FLOAT_FIXED(104.49944), FLOAT_FIXED(-14.63852)}, 
-    {FLOAT_FIXED(19.8478), FLOAT_FIXED(89.89758), FLOAT_FIXED(-13.38192)}, 
-    {FLOAT_FIXED(15.70748), FLOAT_FIXED(89.8976), FLOAT_FIXED(-0.63932)}, 
-    {FLOAT_FIXED(-0.00928), FLOAT_FIXED(70.42842), FLOAT_FIXED(-2.90506)}, 
-    {FLOAT_FIXED(4.47322), FLOAT_FIXED(150.3672), FLOAT_FIXED(-9.10372)}, 
-    {FLOAT_FIXED(11.60624), FLOAT_FIXED(116.66768), FLOAT_FIXED(-2.70844)}, 
-    {FLOAT_FIXED(1.93012), FLOAT_FIXED(55.82656), FLOAT_FIXED(-19.36974)}, 
-    {FLOAT_FIXED(12.88064), FLOAT_FIXED(154.9684), FLOAT_FIXED(-8.2148)}, 
-    {FLOAT_FIXED(4.80474), FLOAT_FIXED(119.1013), FLOAT_FIXED(-15.41314)}, 
-    {FLOAT_FIXED(16.08648), FLOAT_FIXED(50.95928), FLOAT_FIXED(-19.83474)}, 
-    {FLOAT_FIXED(3.77462), FLOAT_FIXED(138.57044), FLOAT_FIXED(-8.30312)}, 
-    {FLOAT_FIXED(2.7363), FLOAT_FIXED(111.80036), FLOAT_FIXED(-4.80302)}, 
-    {FLOAT_FIXED(14.06618), FLOAT_FIXED(29.05648), FLOAT_FIXED(4.06318)}, 
-    {FLOAT_FIXED(14.61282), FLOAT_FIXED(9.58734), FLOAT_FIXED(5.56798)}, 
-    {FLOAT_FIXED(4.48414), FLOAT_FIXED(154.9684), FLOAT_FIXED(-10.22096)}, 
-    {FLOAT_FIXED(-1.27728), FLOAT_FIXED(58.26022), FLOAT_FIXED(-16.80692)}, 
-    {FLOAT_FIXED(1.3374), FLOAT_FIXED(89.89758), FLOAT_FIXED(-3.63002)}, 
-    {FLOAT_FIXED(13.1002), FLOAT_FIXED(29.05648), FLOAT_FIXED(-24.09696)}, 
-    {FLOAT_FIXED(4.64796), FLOAT_FIXED(150.47258), FLOAT_FIXED(-12.30208)}, 
-    {FLOAT_FIXED(14.8875), FLOAT_FIXED(104.49946), FLOAT_FIXED(-1.76792)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(55.82656), FLOAT_FIXED(-24.51234)}, 
-    {FLOAT_FIXED(11.7696), FLOAT_FIXED(154.9684), FLOAT_FIXED(-13.03434)}, 
-    {FLOAT_FIXED(19.26072), FLOAT_FIXED(26.62284), FLOAT_FIXED(4.25128)}, 
-    {FLOAT_FIXED(4.27186), FLOAT_FIXED(136.1368), FLOAT_FIXED(-6.16412)}, 
-    {FLOAT_FIXED(18.93034), FLOAT_FIXED(55.82658), FLOAT_FIXED(-2.0364)}, 
-    {FLOAT_FIXED(-1.27152), FLOAT_FIXED(50.95928), FLOAT_FIXED(-1.92016)}, 
-    {FLOAT_FIXED(4.54518), FLOAT_FIXED(141.00408), FLOAT_FIXED(-6.54032)}, 
-    {FLOAT_FIXED(-2.81732), FLOAT_FIXED(65.56114), FLOAT_FIXED(-10.32986)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(50.95928), FLOAT_FIXED(2.37028)}, 
-    {FLOAT_FIXED(-5.36918), FLOAT_FIXED(50.95928), FLOAT_FIXED(-14.53148)}, 
-    {FLOAT_FIXED(17.27598), FLOAT_FIXED(109.36674), FLOAT_FIXED(-10.33634)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(50.95926), FLOAT_FIXED(-24.97734)}, 
-    {FLOAT_FIXED(12.69954), FLOAT_FIXED(77.72936), FLOAT_FIXED(0.30118)}, 
-    {FLOAT_FIXED(17.74602), FLOAT_FIXED(80.163), FLOAT_FIXED(-15.83896)}, 
-    {FLOAT_FIXED(0.12252), FLOAT_FIXED(50.95928), FLOAT_FIXED(2.37028)}, 
-    {FLOAT_FIXED(14.75974), FLOAT_FIXED(80.163), FLOAT_FIXED(-18.00862)}, 
-    {FLOAT_FIXED(19.69812), FLOAT_FIXED(43.65836), FLOAT_FIXED(-1.35586)}, 
-    {FLOAT_FIXED(16.54254), FLOAT_FIXED(92.33124), FLOAT_FIXED(-3.81812)}, 
-    {FLOAT_FIXED(3.67576), FLOAT_FIXED(114.234), FLOAT_FIXED(-2.52034)}, 
-    {FLOAT_FIXED(-4.4174), FLOAT_FIXED(46.092), FLOAT_FIXED(-10.38476)}, 
-    {FLOAT_FIXED(0.04946), FLOAT_FIXED(77.72936), FLOAT_FIXED(-15.91082)}, 
-    {FLOAT_FIXED(-2.67042), FLOAT_FIXED(29.05648), FLOAT_FIXED(-0.74714)}, 
-    {FLOAT_FIXED(20.62064), FLOAT_FIXED(36.35742), FLOAT_FIXED(-17.93552)}, 
-    {FLOAT_FIXED(12.5683), FLOAT_FIXED(148.1193), FLOAT_FIXED(-5.54038)}, 
-    {FLOAT_FIXED(-4.56376), FLOAT_FIXED(-0.14724), FLOAT_FIXED(0.7302)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(133.70314), FLOAT_FIXED(-17.07216)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(136.13678), FLOAT_FIXED(-15.63394)}, 
-    {FLOAT_FIXED(1.26458), FLOAT_FIXED(123.9686), FLOAT_FIXED(-12.37604)}, 
-    {FLOAT_FIXED(16.52874), FLOAT_FIXED(41.2247), FLOAT_FIXED(-20.44346)}, 
-    {FLOAT_FIXED(-1.76596), FLOAT_FIXED(43.65834), FLOAT_FIXED(-1.6158)}, 
-    {FLOAT_FIXED(23.3858), FLOAT_FIXED(50.95928), FLOAT_FIXED(-14.53148)}, 
-    {FLOAT_FIXED(17.89408), FLOAT_FIXED(50.9593), FLOAT_FIXED(2.37028)}, 
-    {FLOAT_FIXED(5.23752), FLOAT_FIXED(148.11928), FLOAT_FIXED(-6.1892)}, 
-    {FLOAT_FIXED(18.18826), FLOAT_FIXED(72.86208), FLOAT_FIXED(-16.21516)}, 
-    {FLOAT_FIXED(3.13046), FLOAT_FIXED(-0.14724), FLOAT_FIXED(6.32038)}, 
-    {FLOAT_FIXED(5.13752), FLOAT_FIXED(36.35742), FLOAT_FIXED(-23.5601)}, 
-    {FLOAT_FIXED(10.6496), FLOAT_FIXED(143.43776), FLOAT_FIXED(-4.77754)}, 
-    {FLOAT_FIXED(19.59164), FLOAT_FIXED(80.16302), FLOAT_FIXED(-10.15872)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(75.2957), FLOAT_FIXED(-22.6523)}, 
-    {FLOAT_FIXED(-3.26742), FLOAT_FIXED(26.62284), FLOAT_FIXED(-18.38356)}, 
-    {FLOAT_FIXED(-0.14596), FLOAT_FIXED(67.99478), FLOAT_FIXED(-2.71696)}, 
-    {FLOAT_FIXED(4.25834), FLOAT_FIXED(152.6151), FLOAT_FIXED(-10.3273)}, 
-    {FLOAT_FIXED(-2.27344), FLOAT_FIXED(85.0303), FLOAT_FIXED(-13.52562)}, 
-    {FLOAT_FIXED(3.03358), FLOAT_FIXED(143.43774), FLOAT_FIXED(-11.80126)}, 
-    {FLOAT_FIXED(-6.69594), FLOAT_FIXED(36.35742), FLOAT_FIXED(-14.96258)}, 
-    {FLOAT_FIXED(13.3235), FLOAT_FIXED(145.87138), FLOAT_FIXED(-12.77446)}, 
-    {FLOAT_FIXED(7.98498), FLOAT_FIXED(152.61508), FLOAT_FIXED(-14.52186)}, 
-    {FLOAT_FIXED(17.41324), FLOAT_FIXED(21.75556), FLOAT_FIXED(-21.66086)}, 
-    {FLOAT_FIXED(21.99176), FLOAT_FIXED(50.95928), FLOAT_FIXED(-10.24106)}, 
-    {FLOAT_FIXED(22.58036), FLOAT_FIXED(-0.14724), FLOAT_FIXED(0.7302)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(60.69386), FLOAT_FIXED(1.61788)}, 
-    {FLOAT_FIXED(3.99852), FLOAT_FIXED(131.26952), FLOAT_FIXED(-5.78792)}, 
-    {FLOAT_FIXED(5.72706), FLOAT_FIXED(85.03028), FLOAT_FIXED(-0.26312)}, 
-    {FLOAT_FIXED(12.1529), FLOAT_FIXED(97.19852), FLOAT_FIXED(-1.20362)}, 
-    {FLOAT_FIXED(1.70682), FLOAT_FIXED(128.83588), FLOAT_FIXED(-12.23234)}, 
-    {FLOAT_FIXED(20.6128), FLOAT_FIXED(67.99478), FLOAT_FIXED(-10.25802)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(128.83584), FLOAT_FIXED(-17.53718)}, 
-    {FLOAT_FIXED(10.82712), FLOAT_FIXED(155.33988), FLOAT_FIXED(-5.69748)}, 
-    {FLOAT_FIXED(4.49574), FLOAT_FIXED(128.83586), FLOAT_FIXED(-3.64894)}, 
-    {FLOAT_FIXED(19.07276), FLOAT_FIXED(60.69386), FLOAT_FIXED(-16.73506)}, 
-    {FLOAT_FIXED(4.36042), FLOAT_FIXED(36.35742), FLOAT_FIXED(3.49888)}, 
-    {FLOAT_FIXED(14.23922), FLOAT_FIXED(128.8359), FLOAT_FIXED(-5.85978)}, 
-    {FLOAT_FIXED(18.71406), FLOAT_FIXED(36.35742), FLOAT_FIXED(3.49888)}, 
-    {FLOAT_FIXED(7.12764), FLOAT_FIXED(126.40222), FLOAT_FIXED(-16.4033)}, 
-    {FLOAT_FIXED(23.14958), FLOAT_FIXED(36.35742), FLOAT_FIXED(-10.15226)}, 
-    {FLOAT_FIXED(18.21268), FLOAT_FIXED(97.19852), FLOAT_FIXED(-10.17568)}, 
-    {FLOAT_FIXED(9.9835), FLOAT_FIXED(150.47256), FLOAT_FIXED(-14.76152)}, 
-    {FLOAT_FIXED(19.94402), FLOAT_FIXED(14.45462), FLOAT_FIXED(5.19178)}, 
-    {FLOAT_FIXED(12.57642), FLOAT_FIXED(152.6151), FLOAT_FIXED(-6.68988)}, 
-    {FLOAT_FIXED(-2.60404), FLOAT_FIXED(36.35742), FLOAT_FIXED(-17.93552)}, 
-    {FLOAT_FIXED(15.9808), FLOAT_FIXED(85.0303), FLOAT_FIXED(-0.26312)}, 
-    {FLOAT_FIXED(-2.0393), FLOAT_FIXED(38.79106), FLOAT_FIXED(-1.2396)}, 
-    {FLOAT_FIXED(-0.39278), FLOAT_FIXED(72.86208), FLOAT_FIXED(-16.05452)}, 
-    {FLOAT_FIXED(16.30978), FLOAT_FIXED(128.83588), FLOAT_FIXED(-12.23234)}, 
-    {FLOAT_FIXED(13.52088), FLOAT_FIXED(128.8359), FLOAT_FIXED(-3.64894)}, 
-    {FLOAT_FIXED(22.61078), FLOAT_FIXED(9.58734), FLOAT_FIXED(-19.04716)}, 
-    {FLOAT_FIXED(9.9835), FLOAT_FIXED(155.33986), FLOAT_FIXED(-14.29652)}, 
-    {FLOAT_FIXED(6.54704), FLOAT_FIXED(114.234), FLOAT_FIXED(-2.52034)}, 
-    {FLOAT_FIXED(5.45372), FLOAT_FIXED(75.29572), FLOAT_FIXED(0.48928)}, 
-    {FLOAT_FIXED(19.42478), FLOAT_FIXED(48.52564), FLOAT_FIXED(-1.73206)}, 
-    {FLOAT_FIXED(-0.6404), FLOAT_FIXED(60.69384), FLOAT_FIXED(-2.4126)}, 
-    {FLOAT_FIXED(-0.19608), FLOAT_FIXED(97.1985), FLOAT_FIXED(-10.17568)}, 
-    {FLOAT_FIXED(4.68808), FLOAT_FIXED(148.11928), FLOAT_FIXED(-7.88016)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(99.63214), FLOAT_FIXED(-1.39172)}, 
-    {FLOAT_FIXED(14.3395), FLOAT_FIXED(19.32192), FLOAT_FIXED(4.81558)}, 
-    {FLOAT_FIXED(14.87138), FLOAT_FIXED(121.53494), FLOAT_FIXED(-13.97492)}, 
-    {FLOAT_FIXED(6.54704), FLOAT_FIXED(128.83586), FLOAT_FIXED(-3.64894)}, 
-    {FLOAT_FIXED(-0.6139), FLOAT_FIXED(67.99478), FLOAT_FIXED(-16.35886)}, 
-    {FLOAT_FIXED(3.86186), FLOAT_FIXED(128.83586), FLOAT_FIXED(-5.59982)}, 
-    {FLOAT_FIXED(21.28402), FLOAT_FIXED(26.62284), FLOAT_FIXED(-18.38356)}, 
-    {FLOAT_FIXED(6.54658), FLOAT_FIXED(152.6151), FLOAT_FIXED(-13.4768)}, 
-    {FLOAT_FIXED(18.52104), FLOAT_FIXED(104.49944), FLOAT_FIXED(-12.95082)}, 
-    {FLOAT_FIXED(15.43416), FLOAT_FIXED(94.76488), FLOAT_FIXED(-1.01552)}, 
-    {FLOAT_FIXED(16.64038), FLOAT_FIXED(94.76486), FLOAT_FIXED(-15.24722)}, 
-    {FLOAT_FIXED(-1.2441), FLOAT_FIXED(26.62284), FLOAT_FIXED(4.25128)}, 
-    {FLOAT_FIXED(5.61162), FLOAT_FIXED(155.33988), FLOAT_FIXED(-6.84386)}, 
-    {FLOAT_FIXED(21.77062), FLOAT_FIXED(53.39292), FLOAT_FIXED(-10.16922)}, 
-    {FLOAT_FIXED(2.48184), FLOAT_FIXED(114.234), FLOAT_FIXED(-14.19046)}, 
-    {FLOAT_FIXED(4.40852), FLOAT_FIXED(138.57044), FLOAT_FIXED(-6.35222)}, 
-    {FLOAT_FIXED(-3.03844), FLOAT_FIXED(63.1275), FLOAT_FIXED(-10.40172)}, 
-    {FLOAT_FIXED(4.90708), FLOAT_FIXED(55.82656), FLOAT_FIXED(1.99408)}, 
-    {FLOAT_FIXED(-7.1382), FLOAT_FIXED(31.49014), FLOAT_FIXED(-15.10628)}, 
-    {FLOAT_FIXED(17.31032), FLOAT_FIXED(80.16302), FLOAT_FIXED(-3.13756)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(31.49012), FLOAT_FIXED(-26.8374)}, 
-    {FLOAT_FIXED(5.1804), FLOAT_FIXED(65.56114), FLOAT_FIXED(1.24168)}, 
-    {FLOAT_FIXED(17.52488), FLOAT_FIXED(82.59664), FLOAT_FIXED(-15.76712)}, 
-    {FLOAT_FIXED(-0.97078), FLOAT_FIXED(31.49012), FLOAT_FIXED(3.87508)}, 
-    {FLOAT_FIXED(13.5291), FLOAT_FIXED(155.33988), FLOAT_FIXED(-10.30348)}, 
-    {FLOAT_FIXED(13.79284), FLOAT_FIXED(38.79106), FLOAT_FIXED(3.31078)}, 
-    {FLOAT_FIXED(17.037), FLOAT_FIXED(85.0303), FLOAT_FIXED(-3.51376)}, 
-    {FLOAT_FIXED(17.63654), FLOAT_FIXED(114.23402), FLOAT_FIXED(-12.66344)}, 
-    {FLOAT_FIXED(-3.02336), FLOAT_FIXED(46.092), FLOAT_FIXED(-6.09432)}, 
-    {FLOAT_FIXED(6.90652), FLOAT_FIXED(123.96858), FLOAT_FIXED(-16.47516)}, 
-    {FLOAT_FIXED(-3.30152), FLOAT_FIXED(19.3219), FLOAT_FIXED(-0.2547)}, 
-    {FLOAT_FIXED(12.2157), FLOAT_FIXED(67.99478), FLOAT_FIXED(-21.0195)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(85.03026), FLOAT_FIXED(-21.72226)}, 
-    {FLOAT_FIXED(12.7009), FLOAT_FIXED(143.43776), FLOAT_FIXED(-4.77754)}, 
-    {FLOAT_FIXED(4.76908), FLOAT_FIXED(133.70314), FLOAT_FIXED(-4.02514)}, 
-    {FLOAT_FIXED(15.977), FLOAT_FIXED(104.49944), FLOAT_FIXED(-14.79918)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(123.96856), FLOAT_FIXED(-18.00218)}, 
-    {FLOAT_FIXED(-1.79616), FLOAT_FIXED(77.72936), FLOAT_FIXED(-10.23058)}, 
-    {FLOAT_FIXED(12.97288), FLOAT_FIXED(67.9948), FLOAT_FIXED(1.05358)}, 
-    {FLOAT_FIXED(25.1548), FLOAT_FIXED(31.49014), FLOAT_FIXED(-15.10628)}, 
-    {FLOAT_FIXED(18.98738), FLOAT_FIXED(31.49014), FLOAT_FIXED(3.87508)}, 
-    {FLOAT_FIXED(17.94144), FLOAT_FIXED(70.42844), FLOAT_FIXED(-2.6451)}, 
-    {FLOAT_FIXED(15.53476), FLOAT_FIXED(111.80036), FLOAT_FIXED(-14.42296)}, 
-    {FLOAT_FIXED(14.87032), FLOAT_FIXED(119.10132), FLOAT_FIXED(-5.36732)}, 
-    {FLOAT_FIXED(4.0871), FLOAT_FIXED(26.62284), FLOAT_FIXED(4.25128)}, 
-    {FLOAT_FIXED(17.99156), FLOAT_FIXED(99.63216), FLOAT_FIXED(-10.10384)}, 
-    {FLOAT_FIXED(1.48916), FLOAT_FIXED(75.2957), FLOAT_FIXED(0.48928)}, 
-    {FLOAT_FIXED(7.5699), FLOAT_FIXED(145.87136), FLOAT_FIXED(-14.86458)}, 
-    {FLOAT_FIXED(2.59964), FLOAT_FIXED(109.36672), FLOAT_FIXED(-4.61492)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(143.43772), FLOAT_FIXED(-14.93642)}, 
-    {FLOAT_FIXED(8.87396), FLOAT_FIXED(152.61508), FLOAT_FIXED(-5.48686)}, 
-    {FLOAT_FIXED(22.05904), FLOAT_FIXED(65.56114), FLOAT_FIXED(-14.1004)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(36.35742), FLOAT_FIXED(-26.37238)}, 
-    {FLOAT_FIXED(15.31364), FLOAT_FIXED(114.234), FLOAT_FIXED(-14.35112)}, 
-    {FLOAT_FIXED(-0.50444), FLOAT_FIXED(104.49944), FLOAT_FIXED(-12.95082)}, 
-    {FLOAT_FIXED(3.14074), FLOAT_FIXED(138.57046), FLOAT_FIXED(-10.254)}, 
-    {FLOAT_FIXED(12.1748), FLOAT_FIXED(155.33988), FLOAT_FIXED(-6.13536)}, 
-    {FLOAT_FIXED(-5.25754), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-19.49522)}, 
-    {FLOAT_FIXED(-5.43856), FLOAT_FIXED(33.92378), FLOAT_FIXED(-10.48404)}, 
-    {FLOAT_FIXED(3.5013), FLOAT_FIXED(133.70316), FLOAT_FIXED(-7.92692)}, 
-    {FLOAT_FIXED(12.42622), FLOAT_FIXED(87.46394), FLOAT_FIXED(-0.45122)}, 
-    {FLOAT_FIXED(-2.82516), FLOAT_FIXED(33.92378), FLOAT_FIXED(-18.00736)}, 
-    {FLOAT_FIXED(-0.06218), FLOAT_FIXED(109.36674), FLOAT_FIXED(-12.80712)}, 
-    {FLOAT_FIXED(16.0481), FLOAT_FIXED(99.63216), FLOAT_FIXED(-4.12246)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(109.3667), FLOAT_FIXED(-19.39722)}, 
-    {FLOAT_FIXED(12.54848), FLOAT_FIXED(128.83586), FLOAT_FIXED(-14.96508)}, 
-    {FLOAT_FIXED(3.40244), FLOAT_FIXED(109.36672), FLOAT_FIXED(-2.14414)}, 
-    {FLOAT_FIXED(8.87164), FLOAT_FIXED(138.57046), FLOAT_FIXED(-4.40134)}, 
-    {FLOAT_FIXED(23.3707), FLOAT_FIXED(33.92378), FLOAT_FIXED(-10.2241)}, 
-    {FLOAT_FIXED(14.73366), FLOAT_FIXED(121.53496), FLOAT_FIXED(-5.55542)}, 
-    {FLOAT_FIXED(4.25302), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-26.40504)}, 
-    {FLOAT_FIXED(6.46428), FLOAT_FIXED(104.49942), FLOAT_FIXED(-18.01388)}, 
-    {FLOAT_FIXED(-0.77706), FLOAT_FIXED(58.2602), FLOAT_FIXED(-2.2245)}, 
-    {FLOAT_FIXED(16.47594), FLOAT_FIXED(119.10132), FLOAT_FIXED(-10.3089)}, 
-    {FLOAT_FIXED(13.97136), FLOAT_FIXED(150.47258), FLOAT_FIXED(-10.44718)}, 
-    {FLOAT_FIXED(26.70268), FLOAT_FIXED(14.45462), FLOAT_FIXED(-15.60922)}, 
-    {FLOAT_FIXED(17.62076), FLOAT_FIXED(55.82658), FLOAT_FIXED(1.99408)}, 
-    {FLOAT_FIXED(-2.60404), FLOAT_FIXED(38.79106), FLOAT_FIXED(-17.70302)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(46.09198), FLOAT_FIXED(-25.44236)}, 
-    {FLOAT_FIXED(-5.65968), FLOAT_FIXED(31.49014), FLOAT_FIXED(-10.5559)}, 
-    {FLOAT_FIXED(-1.90264), FLOAT_FIXED(41.2247), FLOAT_FIXED(-1.4277)}, 
-    {FLOAT_FIXED(18.07878), FLOAT_FIXED(109.36674), FLOAT_FIXED(-12.80712)}, 
-    {FLOAT_FIXED(14.61418), FLOAT_FIXED(109.36674), FLOAT_FIXED(-2.14414)}, 
-    {FLOAT_FIXED(6.6854), FLOAT_FIXED(114.234), FLOAT_FIXED(-17.24452)}, 
-    {FLOAT_FIXED(0.49172), FLOAT_FIXED(85.03028), FLOAT_FIXED(-15.53462)}, 
-    {FLOAT_FIXED(-3.61736), FLOAT_FIXED(55.82656), FLOAT_FIXED(-10.35732)}, 
-    {FLOAT_FIXED(-1.4984), FLOAT_FIXED(55.82656), FLOAT_FIXED(-16.87876)}, 
-    {FLOAT_FIXED(19.20366), FLOAT_FIXED(50.95928), FLOAT_FIXED(-1.6602)}, 
-    {FLOAT_FIXED(-0.50374), FLOAT_FIXED(63.12748), FLOAT_FIXED(-2.6007)}, 
-    {FLOAT_FIXED(19.51502), FLOAT_FIXED(53.39292), FLOAT_FIXED(-17.11126)}, 
-    {FLOAT_FIXED(17.17366), FLOAT_FIXED(82.59666), FLOAT_FIXED(-3.32566)}, 
-    {FLOAT_FIXED(2.87296), FLOAT_FIXED(114.234), FLOAT_FIXED(-4.99112)}, 
-    {FLOAT_FIXED(14.15752), FLOAT_FIXED(138.57048), FLOAT_FIXED(-8.04316)}, 
-    {FLOAT_FIXED(12.2328), FLOAT_FIXED(150.3672), FLOAT_FIXED(-13.13738)}, 
-    {FLOAT_FIXED(7.23034), FLOAT_FIXED(145.87138), FLOAT_FIXED(-4.96564)}, 
-    {FLOAT_FIXED(6.24314), FLOAT_FIXED(94.76486), FLOAT_FIXED(-18.78324)}, 
-    {FLOAT_FIXED(1.404), FLOAT_FIXED(116.66766), FLOAT_FIXED(-10.1208)}, 
-    {FLOAT_FIXED(19.95728), FLOAT_FIXED(46.092), FLOAT_FIXED(-17.48748)}, 
-    {FLOAT_FIXED(13.97136), FLOAT_FIXED(150.47258), FLOAT_FIXED(-11.8642)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(65.56112), FLOAT_FIXED(-23.58232)}, 
-    {FLOAT_FIXED(0.39586), FLOAT_FIXED(55.82656), FLOAT_FIXED(1.99408)}, 
-    {FLOAT_FIXED(11.77346), FLOAT_FIXED(87.46392), FLOAT_FIXED(-19.48076)}, 
-    {FLOAT_FIXED(13.12584), FLOAT_FIXED(152.6151), FLOAT_FIXED(-12.2738)}, 
-    {FLOAT_FIXED(0.8245), FLOAT_FIXED(26.62284), FLOAT_FIXED(-21.35652)}, 
-    {FLOAT_FIXED(0.639), FLOAT_FIXED(94.76486), FLOAT_FIXED(-6.9969)}, 
-    {FLOAT_FIXED(7.34878), FLOAT_FIXED(128.83586), FLOAT_FIXED(-16.33146)}, 
-    {FLOAT_FIXED(16.38872), FLOAT_FIXED(109.36674), FLOAT_FIXED(-7.6056)}, 
-    {FLOAT_FIXED(-1.5922), FLOAT_FIXED(65.56114), FLOAT_FIXED(-6.55934)}, 
-    {FLOAT_FIXED(4.63374), FLOAT_FIXED(50.95928), FLOAT_FIXED(2.37028)}, 
-    {FLOAT_FIXED(-3.60018), FLOAT_FIXED(70.42842), FLOAT_FIXED(-13.9567)}, 
-    {FLOAT_FIXED(14.37588), FLOAT_FIXED(126.40226), FLOAT_FIXED(-5.67168)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(70.42842), FLOAT_FIXED(-23.1173)}, 
-    {FLOAT_FIXED(1.71236), FLOAT_FIXED(109.36672), FLOAT_FIXED(-7.34566)}, 
-    {FLOAT_FIXED(16.41926), FLOAT_FIXED(99.63214), FLOAT_FIXED(-14.94286)}, 
-    {FLOAT_FIXED(1.21584), FLOAT_FIXED(70.42842), FLOAT_FIXED(0.86548)}, 
-    {FLOAT_FIXED(2.07014), FLOAT_FIXED(114.234), FLOAT_FIXED(-7.4619)}, 
-    {FLOAT_FIXED(8.63582), FLOAT_FIXED(155.33986), FLOAT_FIXED(-14.7344)}, 
-    {FLOAT_FIXED(13.12178), FLOAT_FIXED(150.3672), FLOAT_FIXED(-7.80608)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(114.23398), FLOAT_FIXED(-18.9322)}, 
-    {FLOAT_FIXED(6.6837), FLOAT_FIXED(126.40222), FLOAT_FIXED(-3.46084)}, 
-    {FLOAT_FIXED(18.80876), FLOAT_FIXED(75.29572), FLOAT_FIXED(-6.5319)}, 
-    {FLOAT_FIXED(6.84256), FLOAT_FIXED(154.9684), FLOAT_FIXED(-13.46702)}, 
-    {FLOAT_FIXED(12.87908), FLOAT_FIXED(38.79106), FLOAT_FIXED(-23.32758)}, 
-    {FLOAT_FIXED(12.44812), FLOAT_FIXED(150.4726), FLOAT_FIXED(-5.75916)}, 
-    {FLOAT_FIXED(-8.68606), FLOAT_FIXED(14.45462), FLOAT_FIXED(-15.60922)}, 
-    {FLOAT_FIXED(26.21308), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-10.45012)}, 
-    {FLOAT_FIXED(-1.94066), FLOAT_FIXED(48.52564), FLOAT_FIXED(-17.25496)}, 
-    {FLOAT_FIXED(23.82806), FLOAT_FIXED(46.092), FLOAT_FIXED(-14.67518)}, 
-    {FLOAT_FIXED(-1.65948), FLOAT_FIXED(80.163), FLOAT_FIXED(-10.41868)}, 
-    {FLOAT_FIXED(4.14138), FLOAT_FIXED(104.49944), FLOAT_FIXED(-16.3262)}, 
-    {FLOAT_FIXED(21.6168), FLOAT_FIXED(70.42842), FLOAT_FIXED(-13.9567)}, 
-    {FLOAT_FIXED(16.80078), FLOAT_FIXED(70.42844), FLOAT_FIXED(0.86548)}, 
-    {FLOAT_FIXED(24.613), FLOAT_FIXED(19.32192), FLOAT_FIXED(-10.39524)}, 
-    {FLOAT_FIXED(1.96852), FLOAT_FIXED(99.63214), FLOAT_FIXED(-4.12246)}, 
-    {FLOAT_FIXED(15.67314), FLOAT_FIXED(119.10132), FLOAT_FIXED(-7.8381)}, 
-    {FLOAT_FIXED(21.31328), FLOAT_FIXED(41.2247), FLOAT_FIXED(-5.71812)}, 
-    {FLOAT_FIXED(19.37052), FLOAT_FIXED(82.59666), FLOAT_FIXED(-10.08688)}, 
-    {FLOAT_FIXED(-3.15794), FLOAT_FIXED(75.29572), FLOAT_FIXED(-13.813)}, 
-    {FLOAT_FIXED(4.90854), FLOAT_FIXED(154.9684), FLOAT_FIXED(-8.9148)}, 
-    {FLOAT_FIXED(-3.25956), FLOAT_FIXED(60.69386), FLOAT_FIXED(-10.47356)}, 
-    {FLOAT_FIXED(13.32134), FLOAT_FIXED(19.32192), FLOAT_FIXED(-24.86632)}, 
-    {FLOAT_FIXED(7.26696), FLOAT_FIXED(154.96838), FLOAT_FIXED(-5.66876)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(143.4377), FLOAT_FIXED(-16.14214)}, 
-    {FLOAT_FIXED(4.352), FLOAT_FIXED(148.1193), FLOAT_FIXED(-12.31188)}, 
-    {FLOAT_FIXED(10.88896), FLOAT_FIXED(126.40222), FLOAT_FIXED(-16.4033)}, 
-    {FLOAT_FIXED(13.7942), FLOAT_FIXED(123.96862), FLOAT_FIXED(-3.27274)}, 
-    {FLOAT_FIXED(4.90296), FLOAT_FIXED(145.87138), FLOAT_FIXED(-6.65658)}, 
-    {FLOAT_FIXED(6.2737), FLOAT_FIXED(104.49944), FLOAT_FIXED(-1.76792)}, 
-    {FLOAT_FIXED(13.51952), FLOAT_FIXED(48.52564), FLOAT_FIXED(2.55838)}, 
-    {FLOAT_FIXED(1.84626), FLOAT_FIXED(121.53494), FLOAT_FIXED(-9.9771)}, 
-    {FLOAT_FIXED(-4.4545), FLOAT_FIXED(26.62284), FLOAT_FIXED(-5.62932)}, 
-    {FLOAT_FIXED(23.27416), FLOAT_FIXED(-0.14724), FLOAT_FIXED(-19.49522)}, 
-    {FLOAT_FIXED(6.00038), FLOAT_FIXED(94.76486), FLOAT_FIXED(-1.01552)}, 
-    {FLOAT_FIXED(3.69694), FLOAT_FIXED(150.73868), FLOAT_FIXED(-11.58572)}, 
-    {FLOAT_FIXED(16.6792), FLOAT_FIXED(89.8976), FLOAT_FIXED(-3.63002)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(150.73864), FLOAT_FIXED(-15.44462)}, 
-    {FLOAT_FIXED(15.91144), FLOAT_FIXED(102.06582), FLOAT_FIXED(-4.31056)}, 
-    {FLOAT_FIXED(5.72572), FLOAT_FIXED(150.73864), FLOAT_FIXED(-5.34184)}, 
-    {FLOAT_FIXED(18.85164), FLOAT_FIXED(63.1275), FLOAT_FIXED(-16.66322)}, 
-    {FLOAT_FIXED(11.87958), FLOAT_FIXED(106.93308), FLOAT_FIXED(-1.95602)}, 
-    {FLOAT_FIXED(14.95756), FLOAT_FIXED(128.8359), FLOAT_FIXED(-8.07062)}, 
-    {FLOAT_FIXED(24.71256), FLOAT_FIXED(36.35742), FLOAT_FIXED(-14.96258)}, 
-    {FLOAT_FIXED(2.70298), FLOAT_FIXED(116.66766), FLOAT_FIXED(-14.11862)}, 
-    {FLOAT_FIXED(20.0559), FLOAT_FIXED(38.79106), FLOAT_FIXED(-1.2396)}, 
-    {FLOAT_FIXED(8.64028), FLOAT_FIXED(154.96838), FLOAT_FIXED(-5.66876)}, 
-    {FLOAT_FIXED(11.68744), FLOAT_FIXED(152.61508), FLOAT_FIXED(-13.31884)}, 
-    {FLOAT_FIXED(12.45626), FLOAT_FIXED(154.9684), FLOAT_FIXED(-6.90866)}, 
-    {FLOAT_FIXED(9.0083), FLOAT_FIXED(94.76484), FLOAT_FIXED(-20.79226)}, 
-    {FLOAT_FIXED(4.69528), FLOAT_FIXED(19.32192), FLOAT_FIXED(-24.86632)}, 
-    {FLOAT_FIXED(20.29004), FLOAT_FIXED(85.0303), FLOAT_FIXED(-13.52562)}, 
-    {FLOAT_FIXED(14.10256), FLOAT_FIXED(131.26956), FLOAT_FIXED(-6.04788)}, 
-    {FLOAT_FIXED(2.24184), FLOAT_FIXED(104.49944), FLOAT_FIXED(-4.49866)}, 
-    {FLOAT_FIXED(14.31966), FLOAT_FIXED(150.73868), FLOAT_FIXED(-11.58572)}, 
-    {FLOAT_FIXED(12.2909), FLOAT_FIXED(150.7387), FLOAT_FIXED(-5.34184)}, 
-    {FLOAT_FIXED(10.78628), FLOAT_FIXED(145.8714), FLOAT_FIXED(-4.96564)}, 
-    {FLOAT_FIXED(10.92294), FLOAT_FIXED(133.70318), FLOAT_FIXED(-4.02514)}, 
-    {FLOAT_FIXED(6.95702), FLOAT_FIXED(136.1368), FLOAT_FIXED(-4.21324)}, 
-    {FLOAT_FIXED(12.01624), FLOAT_FIXED(109.36674), FLOAT_FIXED(-2.14414)}, 
-    {FLOAT_FIXED(6.41036), FLOAT_FIXED(116.66766), FLOAT_FIXED(-2.70844)}, 
-    {FLOAT_FIXED(11.33292), FLOAT_FIXED(126.40226), FLOAT_FIXED(-3.46084)}, 
-    {FLOAT_FIXED(11.7429), FLOAT_FIXED(119.10132), FLOAT_FIXED(-2.89654)}, 
-    {FLOAT_FIXED(12.83622), FLOAT_FIXED(80.16302), FLOAT_FIXED(0.11308)}, 
-    {FLOAT_FIXED(5.59038), FLOAT_FIXED(87.46394), FLOAT_FIXED(-0.45122)}, 
-    {FLOAT_FIXED(12.56288), FLOAT_FIXED(89.89758), FLOAT_FIXED(-0.63932)}, 
-    {FLOAT_FIXED(5.86372), FLOAT_FIXED(97.1985), FLOAT_FIXED(-1.20362)}, 
-    {FLOAT_FIXED(13.65618), FLOAT_FIXED(50.95928), FLOAT_FIXED(2.37028)}, 
-    {FLOAT_FIXED(4.7704), FLOAT_FIXED(58.2602), FLOAT_FIXED(1.80598)}, 
-    {FLOAT_FIXED(13.10954), FLOAT_FIXED(70.42844), FLOAT_FIXED(0.86548)}, 
-    {FLOAT_FIXED(5.31706), FLOAT_FIXED(77.72936), FLOAT_FIXED(0.30118)}, 
-    {FLOAT_FIXED(13.38286), FLOAT_FIXED(60.69386), FLOAT_FIXED(1.61788)}, 
-    {FLOAT_FIXED(5.04374), FLOAT_FIXED(67.99478), FLOAT_FIXED(1.05358)}, 
-    {FLOAT_FIXED(12.28956), FLOAT_FIXED(99.63216), FLOAT_FIXED(-1.39172)}, 
-    {FLOAT_FIXED(6.13704), FLOAT_FIXED(106.93308), FLOAT_FIXED(-1.95602)}, 
-    {FLOAT_FIXED(6.00026), FLOAT_FIXED(148.11926), FLOAT_FIXED(-5.13938)}, 
-    {FLOAT_FIXED(3.6771), FLOAT_FIXED(19.3219), FLOAT_FIXED(4.81558)}, 
-    {FLOAT_FIXED(3.95044), FLOAT_FIXED(29.05648), FLOAT_FIXED(4.06318)}, 
-    {FLOAT_FIXED(14.47616), FLOAT_FIXED(21.75556), FLOAT_FIXED(4.62748)}, 
-    {FLOAT_FIXED(6.82036), FLOAT_FIXED(138.57044), FLOAT_FIXED(-4.40134)}, 
-    {FLOAT_FIXED(4.22376), FLOAT_FIXED(38.79106), FLOAT_FIXED(3.31078)}, 
-    {FLOAT_FIXED(14.20284), FLOAT_FIXED(31.49014), FLOAT_FIXED(3.87508)}, 
-    {FLOAT_FIXED(13.92952), FLOAT_FIXED(41.2247), FLOAT_FIXED(3.12268)}, 
-    {FLOAT_FIXED(4.49708), FLOAT_FIXED(48.52564), FLOAT_FIXED(2.55838)}, 
-    {FLOAT_FIXED(12.1529), FLOAT_FIXED(102.0658), FLOAT_FIXED(-1.57982)}, 
-    {FLOAT_FIXED(4.02972), FLOAT_FIXED(133.70316), FLOAT_FIXED(-13.45502)}, 
-    {FLOAT_FIXED(7.34878), FLOAT_FIXED(136.13678), FLOAT_FIXED(-15.63394)}, 
-    {FLOAT_FIXED(2.0396), FLOAT_FIXED(109.36672), FLOAT_FIXED(-14.33416)}, 
-    {FLOAT_FIXED(6.90652), FLOAT_FIXED(116.66764), FLOAT_FIXED(-17.17268)}, 
-    {FLOAT_FIXED(3.36634), FLOAT_FIXED(126.40224), FLOAT_FIXED(-13.67056)}, 
-    {FLOAT_FIXED(1.37622), FLOAT_FIXED(99.63214), FLOAT_FIXED(-14.7822)}, 
-    {FLOAT_FIXED(6.6854), FLOAT_FIXED(106.93306), FLOAT_FIXED(-17.94204)}, 
-    {FLOAT_FIXED(-0.6139), FLOAT_FIXED(70.42842), FLOAT_FIXED(-16.12636)}, 
-    {FLOAT_FIXED(6.02202), FLOAT_FIXED(77.72934), FLOAT_FIXED(-20.25014)}, 
-    {FLOAT_FIXED(2.70298), FLOAT_FIXED(119.1013), FLOAT_FIXED(-13.8861)}, 
-    {FLOAT_FIXED(0.04946), FLOAT_FIXED(80.163), FLOAT_FIXED(-15.6783)}, 
-    {FLOAT_FIXED(6.24314), FLOAT_FIXED(87.46392), FLOAT_FIXED(-19.48076)}, 
-    {FLOAT_FIXED(-1.27728), FLOAT_FIXED(60.69386), FLOAT_FIXED(-16.57442)}, 
-    {FLOAT_FIXED(5.8009), FLOAT_FIXED(67.99478), FLOAT_FIXED(-21.0195)}, 
-    {FLOAT_FIXED(-1.94066), FLOAT_FIXED(50.95928), FLOAT_FIXED(-17.02246)}, 
-    {FLOAT_FIXED(5.57978), FLOAT_FIXED(58.2602), FLOAT_FIXED(-21.78886)}, 
-    {FLOAT_FIXED(0.71284), FLOAT_FIXED(89.89758), FLOAT_FIXED(-15.23026)}, 
-    {FLOAT_FIXED(6.46428), FLOAT_FIXED(97.1985), FLOAT_FIXED(-18.7114)}, 
-    {FLOAT_FIXED(7.5699), FLOAT_FIXED(138.57044), FLOAT_FIXED(-15.5621)}, 
-    {FLOAT_FIXED(4.6931), FLOAT_FIXED(145.87138), FLOAT_FIXED(-12.77446)}, 
-    {FLOAT_FIXED(12.01624), FLOAT_FIXED(104.49944), FLOAT_FIXED(-1.76792)}, 
-    {FLOAT_FIXED(3.81504), FLOAT_FIXED(150.4726), FLOAT_FIXED(-11.15568)}, 
-    {FLOAT_FIXED(4.9164), FLOAT_FIXED(21.75556), FLOAT_FIXED(-24.79448)}, 
-    {FLOAT_FIXED(-3.93078), FLOAT_FIXED(19.32192), FLOAT_FIXED(-18.59912)}, 
-    {FLOAT_FIXED(5.13752), FLOAT_FIXED(31.49012), FLOAT_FIXED(-24.0251)}, 
-    {FLOAT_FIXED(-3.26742), FLOAT_FIXED(29.05648), FLOAT_FIXED(-18.15106)}, 
-    {FLOAT_FIXED(5.13752), FLOAT_FIXED(38.79106), FLOAT_FIXED(-23.32758)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(41.2247), FLOAT_FIXED(-23.25574)}, 
-    {FLOAT_FIXED(5.35864), FLOAT_FIXED(48.52562), FLOAT_FIXED(-22.55822)}, 
-    {FLOAT_FIXED(10.66782), FLOAT_FIXED(128.83586), FLOAT_FIXED(-16.33146)}, 
-    {FLOAT_FIXED(13.98688), FLOAT_FIXED(136.1368), FLOAT_FIXED(-13.22252)}, 
-    {FLOAT_FIXED(11.3312), FLOAT_FIXED(99.63214), FLOAT_FIXED(-18.63956)}, 
-    {FLOAT_FIXED(15.977), FLOAT_FIXED(106.93308), FLOAT_FIXED(-14.56666)}, 
-    {FLOAT_FIXED(10.88896), FLOAT_FIXED(119.10128), FLOAT_FIXED(-17.10082)}, 
-    {FLOAT_FIXED(14.65026), FLOAT_FIXED(126.40224), FLOAT_FIXED(-13.67056)}, 
-    {FLOAT_FIXED(10.4467), FLOAT_FIXED(145.87136), FLOAT_FIXED(-14.86458)}, 
-    {FLOAT_FIXED(11.11008), FLOAT_FIXED(109.36672), FLOAT_FIXED(-17.87018)}, 
-    {FLOAT_FIXED(15.31364), FLOAT_FIXED(116.66766), FLOAT_FIXED(-14.11862)}, 
-    {FLOAT_FIXED(11.99458), FLOAT_FIXED(70.42842), FLOAT_FIXED(-20.94764)}, 
-    {FLOAT_FIXED(17.96714), FLOAT_FIXED(77.72936), FLOAT_FIXED(-15.91082)}, 
-    {FLOAT_FIXED(11.55232), FLOAT_FIXED(89.89756), FLOAT_FIXED(-19.40892)}, 
-    {FLOAT_FIXED(16.64038), FLOAT_FIXED(97.1985), FLOAT_FIXED(-15.01472)}, 
-    {FLOAT_FIXED(11.77346), FLOAT_FIXED(80.163), FLOAT_FIXED(-20.17828)}, 
-    {FLOAT_FIXED(17.30376), FLOAT_FIXED(87.46394), FLOAT_FIXED(-15.46276)}, 
-    {FLOAT_FIXED(12.43684), FLOAT_FIXED(50.95928), FLOAT_FIXED(-22.48638)}, 
-    {FLOAT_FIXED(19.2939), FLOAT_FIXED(58.26022), FLOAT_FIXED(-16.80692)}, 
-    {FLOAT_FIXED(13.1002), FLOAT_FIXED(21.75556), FLOAT_FIXED(-24.79448)}, 
-    {FLOAT_FIXED(21.28402), FLOAT_FIXED(29.05648), FLOAT_FIXED(-18.15106)}, 
-    {FLOAT_FIXED(12.65796), FLOAT_FIXED(41.2247), FLOAT_FIXED(-23.25574)}, 
-    {FLOAT_FIXED(19.95728), FLOAT_FIXED(48.52564), FLOAT_FIXED(-17.25496)}, 
-    {FLOAT_FIXED(13.98688), FLOAT_FIXED(138.57046), FLOAT_FIXED(-12.99)}, 
-    {FLOAT_FIXED(3.58924), FLOAT_FIXED(148.1193), FLOAT_FIXED(-11.26204)}, 
-    {FLOAT_FIXED(21.9474), FLOAT_FIXED(19.32192), FLOAT_FIXED(-18.59912)}, 
-    {FLOAT_FIXED(12.2157), FLOAT_FIXED(60.69384), FLOAT_FIXED(-21.717)}, 
-    {FLOAT_FIXED(18.63052), FLOAT_FIXED(67.99478), FLOAT_FIXED(-16.35886)}, 
-    {FLOAT_FIXED(12.87908), FLOAT_FIXED(31.49012), FLOAT_FIXED(-24.0251)}, 
-    {FLOAT_FIXED(20.62064), FLOAT_FIXED(38.79106), FLOAT_FIXED(-17.70302)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(65.56114), FLOAT_FIXED(1.24168)}, 
-    {FLOAT_FIXED(16.6126), FLOAT_FIXED(116.66768), FLOAT_FIXED(-10.1208)}, 
-    {FLOAT_FIXED(14.597), FLOAT_FIXED(123.96862), FLOAT_FIXED(-5.74352)}, 
-    {FLOAT_FIXED(16.26922), FLOAT_FIXED(97.19852), FLOAT_FIXED(-4.19432)}, 
-    {FLOAT_FIXED(18.34934), FLOAT_FIXED(94.76488), FLOAT_FIXED(-9.98758)}, 
-    {FLOAT_FIXED(18.16256), FLOAT_FIXED(67.9948), FLOAT_FIXED(-2.71696)}, 
-    {FLOAT_FIXED(20.74946), FLOAT_FIXED(65.56114), FLOAT_FIXED(-10.06992)}, 
-    {FLOAT_FIXED(17.5493), FLOAT_FIXED(104.49946), FLOAT_FIXED(-9.96014)}, 
-    {FLOAT_FIXED(15.6381), FLOAT_FIXED(106.9331), FLOAT_FIXED(-4.68676)}, 
-    {FLOAT_FIXED(15.81256), FLOAT_FIXED(126.40224), FLOAT_FIXED(-10.09336)}, 
-    {FLOAT_FIXED(13.96588), FLOAT_FIXED(133.7032), FLOAT_FIXED(-6.23598)}, 
-    {FLOAT_FIXED(15.22812), FLOAT_FIXED(114.23402), FLOAT_FIXED(-5.25106)}, 
-    {FLOAT_FIXED(19.14938), FLOAT_FIXED(85.0303), FLOAT_FIXED(-10.01502)}, 
-    {FLOAT_FIXED(16.90034), FLOAT_FIXED(87.46396), FLOAT_FIXED(-3.70186)}, 
-    {FLOAT_FIXED(19.81276), FLOAT_FIXED(77.72936), FLOAT_FIXED(-10.23058)}, 
-    {FLOAT_FIXED(21.31814), FLOAT_FIXED(19.32192), FLOAT_FIXED(-0.2547)}, 
-    {FLOAT_FIXED(4.80776), FLOAT_FIXED(152.61508), FLOAT_FIXED(-8.63636)}, 
-    {FLOAT_FIXED(19.94942), FLOAT_FIXED(75.29572), FLOAT_FIXED(-10.04248)}, 
-    {FLOAT_FIXED(14.21248), FLOAT_FIXED(145.8714), FLOAT_FIXED(-10.03846)}, 
-    {FLOAT_FIXED(21.41284), FLOAT_FIXED(58.26022), FLOAT_FIXED(-10.28546)}, 
-    {FLOAT_FIXED(14.34914), FLOAT_FIXED(143.43774), FLOAT_FIXED(-9.85036)}, 
-    {FLOAT_FIXED(13.74476), FLOAT_FIXED(136.13684), FLOAT_FIXED(-6.16412)}, 
-    {FLOAT_FIXED(21.5495), FLOAT_FIXED(55.82656), FLOAT_FIXED(-10.09736)}, 
-    {FLOAT_FIXED(22.21288), FLOAT_FIXED(48.52564), FLOAT_FIXED(-10.3129)}, 
-    {FLOAT_FIXED(22.34954), FLOAT_FIXED(46.092), FLOAT_FIXED(-10.1248)}, 
-    {FLOAT_FIXED(23.01292), FLOAT_FIXED(38.79106), FLOAT_FIXED(-10.34036)}, 
-    {FLOAT_FIXED(20.4659), FLOAT_FIXED(31.49014), FLOAT_FIXED(-0.6753)}, 
-    {FLOAT_FIXED(23.81296), FLOAT_FIXED(29.05648), FLOAT_FIXED(-10.3678)}, 
-    {FLOAT_FIXED(21.097), FLOAT_FIXED(21.75556), FLOAT_FIXED(-0.18284)}, 
-    {FLOAT_FIXED(13.2462), FLOAT_FIXED(63.1275), FLOAT_FIXED(1.42978)}, 
-    {FLOAT_FIXED(3.64074), FLOAT_FIXED(126.40222), FLOAT_FIXED(-5.67168)}, 
-    {FLOAT_FIXED(2.86742), FLOAT_FIXED(133.70316), FLOAT_FIXED(-9.8778)}, 
-    {FLOAT_FIXED(1.11628), FLOAT_FIXED(87.46394), FLOAT_FIXED(-3.70186)}, 
-    {FLOAT_FIXED(-0.33274), FLOAT_FIXED(94.76486), FLOAT_FIXED(-9.98758)}, 
-    {FLOAT_FIXED(3.00962), FLOAT_FIXED(116.66766), FLOAT_FIXED(-5.17922)}, 
-    {FLOAT_FIXED(2.06738), FLOAT_FIXED(123.9686), FLOAT_FIXED(-9.90526)}, 
-    {FLOAT_FIXED(2.3785), FLOAT_FIXED(106.93308), FLOAT_FIXED(-4.68676)}, 
-    {FLOAT_FIXED(1.26734), FLOAT_FIXED(114.234), FLOAT_FIXED(-9.9327)}, 
-    {FLOAT_FIXED(-2.5962), FLOAT_FIXED(67.99478), FLOAT_FIXED(-10.25802)}, 
-    {FLOAT_FIXED(-0.36708), FLOAT_FIXED(65.56114), FLOAT_FIXED(-2.7888)}, 
-    {FLOAT_FIXED(-4.19626), FLOAT_FIXED(48.52564), FLOAT_FIXED(-10.3129)}, 
-    {FLOAT_FIXED(-1.6293), FLOAT_FIXED(46.09198), FLOAT_FIXED(-1.8039)}, 
-    {FLOAT_FIXED(-6.59638), FLOAT_FIXED(19.32192), FLOAT_FIXED(-10.39524)}, 
-    {FLOAT_FIXED(5.3383), FLOAT_FIXED(150.47258), FLOAT_FIXED(-6.46766)}, 
-    {FLOAT_FIXED(-3.39624), FLOAT_FIXED(58.26022), FLOAT_FIXED(-10.28546)}, 
-    {FLOAT_FIXED(-0.9982), FLOAT_FIXED(55.82656), FLOAT_FIXED(-2.29636)}, 
-    {FLOAT_FIXED(-5.79634), FLOAT_FIXED(29.05648), FLOAT_FIXED(-10.3678)}, 
-    {FLOAT_FIXED(-2.89154), FLOAT_FIXED(26.62284), FLOAT_FIXED(-0.819)}, 
-    {FLOAT_FIXED(1.7474), FLOAT_FIXED(97.1985), FLOAT_FIXED(-4.19432)}, 
-    {FLOAT_FIXED(0.4673), FLOAT_FIXED(104.49944), FLOAT_FIXED(-9.96014)}, 
-    {FLOAT_FIXED(-4.9963), FLOAT_FIXED(38.79106), FLOAT_FIXED(-10.34036)}, 
-    {FLOAT_FIXED(-2.26042), FLOAT_FIXED(36.35742), FLOAT_FIXED(-1.31144)}, 
-    {FLOAT_FIXED(0.89516), FLOAT_FIXED(85.03028), FLOAT_FIXED(-3.77372)}, 
-    {FLOAT_FIXED(0.48516), FLOAT_FIXED(77.72936), FLOAT_FIXED(-3.20942)}, 
-    {FLOAT_FIXED(3.80412), FLOAT_FIXED(145.87138), FLOAT_FIXED(-10.03846)}, 
-    {FLOAT_FIXED(4.68184), FLOAT_FIXED(143.43772), FLOAT_FIXED(-6.72842)}, 
-    {FLOAT_FIXED(0.26404), FLOAT_FIXED(75.2957), FLOAT_FIXED(-3.28126)}, 
-    {FLOAT_FIXED(13.10954), FLOAT_FIXED(65.56114), FLOAT_FIXED(1.24168)}, 
-    {FLOAT_FIXED(3.00408), FLOAT_FIXED(136.1368), FLOAT_FIXED(-10.0659)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(75.29572), FLOAT_FIXED(0.48928)}, 
-    {FLOAT_FIXED(12.97288), FLOAT_FIXED(72.86208), FLOAT_FIXED(0.67738)}, 
-    {FLOAT_FIXED(12.83622), FLOAT_FIXED(75.29572), FLOAT_FIXED(0.48928)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(55.82656), FLOAT_FIXED(1.99408)}, 
-    {FLOAT_FIXED(13.51952), FLOAT_FIXED(53.39294), FLOAT_FIXED(2.18218)}, 
-    {FLOAT_FIXED(13.38286), FLOAT_FIXED(55.82658), FLOAT_FIXED(1.99408)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(94.76486), FLOAT_FIXED(-1.01552)}, 
-    {FLOAT_FIXED(12.42622), FLOAT_FIXED(92.33122), FLOAT_FIXED(-0.82742)}, 
-    {FLOAT_FIXED(12.28956), FLOAT_FIXED(94.76488), FLOAT_FIXED(-1.01552)}, 
-    {FLOAT_FIXED(9.14496), FLOAT_FIXED(85.03028), FLOAT_FIXED(-0.26312)}, 
-    {FLOAT_FIXED(12.69954), FLOAT_FIXED(82.59666), FLOAT_FIXED(-0.07502)}, 
-    {FLOAT_FIXED(12.56288), FLOAT_FIXED(85.0303), FLOAT_FIXED(-0.26312)}, 
-    {FLOAT_FIXED(9.14498), FLOAT_FIXED(123.9686), FLOAT_FIXED(-3.27274)}, 
-    {FLOAT_FIXED(11.60624), FLOAT_FIXED(121.53496), FLOAT_FIXED(-3.08464)}, 
-    {FLOAT_FIXED(11.46958), FLOAT_FIXED(123.96862), FLOAT_FIXED(-3.27274)}, 
-    {FLOAT_FIXED(8.87164), FLOAT_FIXED(128.83588), FLOAT_FIXED(-3.64894)}, 
-    {FLOAT_FIXED(11.19626), FLOAT_FIXED(128.8359), FLOAT_FIXED(-3.64894)}, 
-    {FLOAT_FIXED(11.0596), FLOAT_FIXED(131.26954), FLOAT_FIXED(-3.83704)}, 
-    {FLOAT_FIXED(9.14498), FLOAT_FIXED(114.234), FLOAT_FIXED(-2.52034)}, 
-    {FLOAT_FIXED(11.87958), FLOAT_FIXED(111.80038), FLOAT_FIXED(-2.33224)}, 
-    {FLOAT_FIXED(11.7429), FLOAT_FIXED(114.23402), FLOAT_FIXED(-2.52034)}, 
-    {FLOAT_FIXED(6.6837), FLOAT_FIXED(131.26952), FLOAT_FIXED(-3.83704)}, 
-    {FLOAT_FIXED(8.87164), FLOAT_FIXED(133.70318), FLOAT_FIXED(-4.02514)}, 
-    {FLOAT_FIXED(6.82036), FLOAT_FIXED(133.70316), FLOAT_FIXED(-4.02514)}, 
-    {FLOAT_FIXED(7.77822), FLOAT_FIXED(148.11928), FLOAT_FIXED(-5.13938)}, 
-    {FLOAT_FIXED(9.55618), FLOAT_FIXED(148.1193), FLOAT_FIXED(-5.13938)}, 
-    {FLOAT_FIXED(8.3261), FLOAT_FIXED(150.36718), FLOAT_FIXED(-5.31312)}, 
-    {FLOAT_FIXED(20.96034), FLOAT_FIXED(24.1892), FLOAT_FIXED(-0.37094)}, 
-    {FLOAT_FIXED(22.38666), FLOAT_FIXED(26.62284), FLOAT_FIXED(-5.36938)}, 
-    {FLOAT_FIXED(20.82368), FLOAT_FIXED(26.62284), FLOAT_FIXED(-0.55904)}, 
-    {FLOAT_FIXED(-4.26248), FLOAT_FIXED(14.45462), FLOAT_FIXED(-18.82314)}, 
-    {FLOAT_FIXED(-4.92586), FLOAT_FIXED(4.72006), FLOAT_FIXED(-19.27118)}, 
-    {FLOAT_FIXED(4.36358), FLOAT_FIXED(4.72006), FLOAT_FIXED(-26.02036)}, 
-    {FLOAT_FIXED(13.4319), FLOAT_FIXED(14.45462), FLOAT_FIXED(-25.251)}, 
-    {FLOAT_FIXED(13.65302), FLOAT_FIXED(4.72006), FLOAT_FIXED(-26.02036)}, 
-    {FLOAT_FIXED(22.94246), FLOAT_FIXED(4.72006), FLOAT_FIXED(-19.27118)}, 
-    {FLOAT_FIXED(-3.61708), FLOAT_FIXED(14.45462), FLOAT_FIXED(-0.00846)}, 
-    {FLOAT_FIXED(-4.2482), FLOAT_FIXED(4.72004), FLOAT_FIXED(0.48398)}, 
-    {FLOAT_FIXED(-7.79644), FLOAT_FIXED(4.72004), FLOAT_FIXED(-10.4364)}, 
-    {FLOAT_FIXED(25.01302), FLOAT_FIXED(14.45462), FLOAT_FIXED(-10.40896)}, 
-    {FLOAT_FIXED(25.81306), FLOAT_FIXED(4.72004), FLOAT_FIXED(-10.4364)}, 
-    {FLOAT_FIXED(22.2648), FLOAT_FIXED(4.72004), FLOAT_FIXED(0.48398)}, 
-    {FLOAT_FIXED(14.47616), FLOAT_FIXED(14.45462), FLOAT_FIXED(5.19178)}, 
-    {FLOAT_FIXED(14.74948), FLOAT_FIXED(4.72004), FLOAT_FIXED(5.94418)}, 
-    {FLOAT_FIXED(3.26712), FLOAT_FIXED(4.72004), FLOAT_FIXED(5.94418)}, 
-    {FLOAT_FIXED(13.5486), FLOAT_FIXED(151.54384), FLOAT_FIXED(-9.414)}, 
-    {FLOAT_FIXED(13.5486), FLOAT_FIXED(151.54384), FLOAT_FIXED(-12.069)}, 
-    {FLOAT_FIXED(8.3104), FLOAT_FIXED(151.54382), FLOAT_FIXED(-14.86064)}, 
-    {FLOAT_FIXED(3.54044), FLOAT_FIXED(14.45462), FLOAT_FIXED(5.19178)}, 
-    {FLOAT_FIXED(21.63368), FLOAT_FIXED(14.45462), FLOAT_FIXED(-0.00846)}, 
-    {FLOAT_FIXED(12.51228), FLOAT_FIXED(151.54384), FLOAT_FIXED(-6.22452)}, 
-    {FLOAT_FIXED(-6.9964), FLOAT_FIXED(14.45462), FLOAT_FIXED(-10.40896)}, 
-    {FLOAT_FIXED(10.83546), FLOAT_FIXED(151.54382), FLOAT_FIXED(-14.04018)}, 
-    {FLOAT_FIXED(4.0367), FLOAT_FIXED(151.54384), FLOAT_FIXED(-10.7415)}, 
-    {FLOAT_FIXED(22.27908), FLOAT_FIXED(14.45462), FLOAT_FIXED(-18.82314)}, 
-    {FLOAT_FIXED(5.59728), FLOAT_FIXED(151.54384), FLOAT_FIXED(-12.88944)}, 
-    {FLOAT_FIXED(5.07302), FLOAT_FIXED(151.54384), FLOAT_FIXED(-7.552)}, 
-    {FLOAT_FIXED(9.9872), FLOAT_FIXED(151.54384), FLOAT_FIXED(-5.40408)}, 
-    {FLOAT_FIXED(4.5847), FLOAT_FIXED(14.45462), FLOAT_FIXED(-25.251)}, 
-    {FLOAT_FIXED(6.6336), FLOAT_FIXED(151.54382), FLOAT_FIXED(-5.40408)}, 
-};
-
-static vertex_t normals[] = {
-    {FLOAT_FIXED(-0.289717759795457), FLOAT_FIXED(-0.957112124913444), FLOAT_FIXED(1.6655007646595e-06)}, 
-    {FLOAT_FIXED(-0.289711233707329), FLOAT_FIXED(-0.957114100334652), FLOAT_FIXED(2.08969216330407e-06)}, 
-    {FLOAT_FIXED(0.289718894127382), FLOAT_FIXED(0.957111781547779), FLOAT_FIXED(2.83609377373155e-06)}, 
-    {FLOAT_FIXED(0.289716855073197), FLOAT_FIXED(0.957112398767722), FLOAT_FIXED(3.40475482889444e-06)}, 
-    {FLOAT_FIXED(-0.289716549182333), FLOAT_FIXED(-0.95711249136652), FLOAT_FIXED(2.30615511363911e-07)}, 
-    {FLOAT_FIXED(2.51894693755849e-06), FLOAT_FIXED(0.966894696842587), FLOAT_FIXED(0.255175714383906)}, 
-    {FLOAT_FIXED(0.289719429697725), FLOAT_FIXED(0.957111619427012), FLOAT_FIXED(-3.66438588033753e-06)}, 
-    {FLOAT_FIXED(0.289724223914728), FLOAT_FIXED(0.957110168198641), FLOAT_FIXED(2.78887926936338e-06)}, 
-    {FLOAT_FIXED(-0.289721068772074), FLOAT_FIXED(-0.957111123256929), FLOAT_FIXED(6.8866813955986e-06)}, 
-    {FLOAT_FIXED(0.289722065215749), FLOAT_FIXED(0.957110821643494), FLOAT_FIXED(4.47619558905904e-06)}, 
-    {FLOAT_FIXED(0.289715631125186), FLOAT_FIXED(0.957112769258567), FLOAT_FIXED(-1.98278133881544e-06)}, 
-    {FLOAT_FIXED(0.289723857017649), FLOAT_FIXED(0.957110279265042), FLOAT_FIXED(1.00032136608672e-07)}, 
-    {FLOAT_FIXED(0.289718325220024), FLOAT_FIXED(0.957111953741669), FLOAT_FIXED(-6.04231363148036e-06)}, 
-    {FLOAT_FIXED(-0.289719711636653), FLOAT_FIXED(-0.957111534087401), FLOAT_FIXED(2.4568944811902e-06)}, 
-    {FLOAT_FIXED(-0.289723370139944), FLOAT_FIXED(-0.957110426589928), FLOAT_FIXED(-1.03730497482396e-05)}, 
-    {FLOAT_FIXED(8.08631072976876e-06), FLOAT_FIXED(0.966892347402032), FLOAT_FIXED(0.255184616444642)}, 
-    {FLOAT_FIXED(2.05233744707169e-06), FLOAT_FIXED(0.966896585295799), FLOAT_FIXED(0.255168558680555)}, 
-    {FLOAT_FIXED(0.289721878367581), FLOAT_FIXED(0.957110878213029), FLOAT_FIXED(-1.20217476989045e-06)}, 
-    {FLOAT_FIXED(0.289722117828269), FLOAT_FIXED(0.957110805727505), FLOAT_FIXED(8.6579037569827e-07)}, 
-    {FLOAT_FIXED(-0.289727149548733), FLOAT_FIXED(-0.957109282579235), FLOAT_FIXED(3.87660547139935e-06)}, 
-    {FLOAT_FIXED(-0.289719000051329), FLOAT_FIXED(-0.957111749487569), FLOAT_FIXED(-1.44997478287202e-06)}, 
-    {FLOAT_FIXED(0.289718041254157), FLOAT_FIXED(0.957112039702845), FLOAT_FIXED(-5.26436169104058e-06)}, 
-    {FLOAT_FIXED(-0.289716988299538), FLOAT_FIXED(-0.95711235844555), FLOAT_FIXED(-1.20133921909457e-06)}, 
-    {FLOAT_FIXED(-0.289711088131832), FLOAT_FIXED(-0.957114144398693), FLOAT_FIXED(2.32991063098329e-06)}, 
-    {FLOAT_FIXED(0.289720353780002), FLOAT_FIXED(0.957111339710183), FLOAT_FIXED(1.94141958736787e-06)}, 
-    {FLOAT_FIXED(0.28971370281841), FLOAT_FIXED(0.957113352951633), FLOAT_FIXED(9.63365482305939e-07)}, 
-    {FLOAT_FIXED(0.289719558251231), FLOAT_FIXED(0.957111580520561), FLOAT_FIXED(3.8096333316452e-07)}, 
-    {FLOAT_FIXED(0.289715361138605), FLOAT_FIXED(0.957112850960485), FLOAT_FIXED(6.82794213377813e-06)}, 
-    {FLOAT_FIXED(-0.289713704856933), FLOAT_FIXED(-0.957113352334497), FLOAT_FIXED(-1.04444913440754e-06)}, 
-    {FLOAT_FIXED(-0.289715720580339), FLOAT_FIXED(-0.957112742182278), FLOAT_FIXED(-9.66486108538678e-07)}, 
-    {FLOAT_FIXED(-0.289716422225232), FLOAT_FIXED(-0.957112529795246), FLOAT_FIXED(1.39829346655857e-06)}, 
-    {FLOAT_FIXED(0.289717195490507), FLOAT_FIXED(0.957112295726728), FLOAT_FIXED(2.41396348228345e-06)}, 
-    {FLOAT_FIXED(-0.289715881553702), FLOAT_FIXED(-0.95711269345645), FLOAT_FIXED(-3.17833560360767e-07)}, 
-    {FLOAT_FIXED(-0.289721577253244), FLOAT_FIXED(-0.957110969353583), FLOAT_FIXED(4.11552231481881e-06)}, 
-    {FLOAT_FIXED(-0.289717302210936), FLOAT_FIXED(-0.957112263425151), FLOAT_FIXED(-8.94891593608943e-07)}, 
-    {FLOAT_FIXED(-5.79062596198893e-06), FLOAT_FIXED(0.966892897758675), FLOAT_FIXED(0.255182531201298)}, 
-    {FLOAT_FIXED(-0.289717801416737), FLOAT_FIXED(-0.957112112306245), FLOAT_FIXED(4.35078571461687e-06)}, 
-    {FLOAT_FIXED(4.32149656817972e-06), FLOAT_FIXED(0.966895862264493), FLOAT_FIXED(0.255171298380378)}, 
-    {FLOAT_FIXED(-0.28972009990883), FLOAT_FIXED(-0.957111416558333), FLOAT_FIXED(-1.58705131109424e-06)}, 
-    {FLOAT_FIXED(-0.289717235280507), FLOAT_FIXED(-0.957112283685025), FLOAT_FIXED(8.09286935245981e-07)}, 
-    {FLOAT_FIXED(0.289713060827764), FLOAT_FIXED(0.957113547278302), FLOAT_FIXED(-1.46745535484643e-06)}, 
-    {FLOAT_FIXED(0.289713861587267), FLOAT_FIXED(0.957113304893124), FLOAT_FIXED(8.68935947322747e-07)}, 
-    {FLOAT_FIXED(-0.289723688273724), FLOAT_FIXED(-0.957110330343135), FLOAT_FIXED(1.87763110739866e-06)}, 
-    {FLOAT_FIXED(-7.77946147925598e-07), FLOAT_FIXED(0.96689205405201), FLOAT_FIXED(0.255185728069735)}, 
-    {FLOAT_FIXED(-0.289715398858464), FLOAT_FIXED(-0.957112839564434), FLOAT_FIXED(-2.2774249864368e-06)}, 
-    {FLOAT_FIXED(-1.0762520048783e-05), FLOAT_FIXED(0.966896126414904), FLOAT_FIXED(0.255170297268358)}, 
-    {FLOAT_FIXED(1.62588103396745e-06), FLOAT_FIXED(0.966894709330878), FLOAT_FIXED(0.255175667071361)}, 
-    {FLOAT_FIXED(1.07626333837989e-05), FLOAT_FIXED(0.966896126414903), FLOAT_FIXED(0.255170297268358)}, 
-    {FLOAT_FIXED(-4.89932158696567e-06), FLOAT_FIXED(0.966894979037235), FLOAT_FIXED(0.255174645073882)}, 
-    {FLOAT_FIXED(-0.289717270461786), FLOAT_FIXED(-0.957112273012005), FLOAT_FIXED(-6.77982802641943e-06)}, 
-    {FLOAT_FIXED(0.289721009432178), FLOAT_FIXED(0.957111141242822), FLOAT_FIXED(1.56909929408433e-06)}, 
-    {FLOAT_FIXED(-0.289719146649594), FLOAT_FIXED(-0.95711170511316), FLOAT_FIXED(1.05713878197905e-07)}, 
-    {FLOAT_FIXED(0.289721626936598), FLOAT_FIXED(0.957110954322688), FLOAT_FIXED(8.50829418748512e-07)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.966894512640244), FLOAT_FIXED(0.255176412362478)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966904110347614), FLOAT_FIXED(-0.255140042707704)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966902791568263), FLOAT_FIXED(-0.255145040432886)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966902791568264), FLOAT_FIXED(-0.255145040432886)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966893698312284), FLOAT_FIXED(-0.255179497930367)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966893698312284), FLOAT_FIXED(-0.255179497930366)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966896745295013), FLOAT_FIXED(-0.255167952411564)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966891190247778), FLOAT_FIXED(-0.255189000980126)}, 
-    {FLOAT_FIXED(1.65689590042305e-06), FLOAT_FIXED(-0.966896875533019), FLOAT_FIXED(-0.255167458900505)}, 
-    {FLOAT_FIXED(2.99642395308243e-07), FLOAT_FIXED(-0.966905246019081), FLOAT_FIXED(-0.255135738815031)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966908628241695), FLOAT_FIXED(-0.255122920631926)}, 
-    {FLOAT_FIXED(-2.99641602152859e-07), FLOAT_FIXED(-0.966905246028034), FLOAT_FIXED(-0.255135738781101)}, 
-    {FLOAT_FIXED(-1.65689851844308e-06), FLOAT_FIXED(-0.966896875539334), FLOAT_FIXED(-0.255167458876574)}, 
-    {FLOAT_FIXED(7.32877512459199e-06), FLOAT_FIXED(-0.966875195492992), FLOAT_FIXED(-0.255249596055856)}, 
-    {FLOAT_FIXED(-4.32419814243766e-06), FLOAT_FIXED(-0.966882445525235), FLOAT_FIXED(-0.255222131713617)}, 
-    {FLOAT_FIXED(-1.70897866658979e-06), FLOAT_FIXED(-0.966902069912701), FLOAT_FIXED(-0.255147775211963)}, 
-    {FLOAT_FIXED(1.49255706552601e-06), FLOAT_FIXED(-0.966899741825589), FLOAT_FIXED(-0.2551565975149)}, 
-    {FLOAT_FIXED(-7.77946149143982e-07), FLOAT_FIXED(-0.966892054052021), FLOAT_FIXED(-0.255185728069692)}, 
-    {FLOAT_FIXED(7.77946149145721e-07), FLOAT_FIXED(-0.966892054052021), FLOAT_FIXED(-0.255185728069692)}, 
-    {FLOAT_FIXED(9.90057811460951e-07), FLOAT_FIXED(-0.966896052920516), FLOAT_FIXED(-0.255170575979573)}, 
-    {FLOAT_FIXED(-9.90056635985609e-07), FLOAT_FIXED(-0.966896052917857), FLOAT_FIXED(-0.255170575989647)}, 
-    {FLOAT_FIXED(-2.49558024770836e-06), FLOAT_FIXED(-0.96690191413353), FLOAT_FIXED(-0.255148365541868)}, 
-    {FLOAT_FIXED(2.49557128678875e-06), FLOAT_FIXED(-0.966901914130146), FLOAT_FIXED(-0.255148365554694)}, 
-    {FLOAT_FIXED(-1.88676887501422e-06), FLOAT_FIXED(-0.966891409001291), FLOAT_FIXED(-0.25518817213174)}, 
-    {FLOAT_FIXED(1.95161820633296e-06), FLOAT_FIXED(-0.966892528182581), FLOAT_FIXED(-0.25518393158835)}, 
-    {FLOAT_FIXED(1.41652994447898e-06), FLOAT_FIXED(-0.966894744298021), FLOAT_FIXED(-0.255175534577391)}, 
-    {FLOAT_FIXED(-4.14393857637002e-07), FLOAT_FIXED(-0.966894917049671), FLOAT_FIXED(-0.255174880000632)}, 
-    {FLOAT_FIXED(-4.97210159162252e-07), FLOAT_FIXED(-0.966898125555042), FLOAT_FIXED(-0.255162722194877)}, 
-    {FLOAT_FIXED(9.05294455612505e-07), FLOAT_FIXED(-0.966897248775403), FLOAT_FIXED(-0.255166044586142)}, 
-    {FLOAT_FIXED(-2.25477748583002e-06), FLOAT_FIXED(-0.966894349293857), FLOAT_FIXED(-0.255177031291074)}, 
-    {FLOAT_FIXED(2.25477748584215e-06), FLOAT_FIXED(-0.966894349293857), FLOAT_FIXED(-0.255177031291074)}, 
-    {FLOAT_FIXED(2.5306023991063e-07), FLOAT_FIXED(-0.966892075625808), FLOAT_FIXED(-0.255185646328224)}, 
-    {FLOAT_FIXED(-2.53060239910445e-07), FLOAT_FIXED(-0.966892075625808), FLOAT_FIXED(-0.255185646328224)}, 
-    {FLOAT_FIXED(-1.55652781108209e-08), FLOAT_FIXED(-0.966897223281426), FLOAT_FIXED(-0.255166141191709)}, 
-    {FLOAT_FIXED(1.5565278102189e-08), FLOAT_FIXED(-0.966897223281426), FLOAT_FIXED(-0.255166141191709)}, 
-    {FLOAT_FIXED(8.59667135915e-07), FLOAT_FIXED(-0.96689775202142), FLOAT_FIXED(-0.255164137635337)}, 
-    {FLOAT_FIXED(2.34714510310962e-06), FLOAT_FIXED(-0.966895814717964), FLOAT_FIXED(-0.25517147856956)}, 
-    {FLOAT_FIXED(2.91801293404574e-06), FLOAT_FIXED(-0.966894228208741), FLOAT_FIXED(-0.255177490088975)}, 
-    {FLOAT_FIXED(1.65740315828906e-06), FLOAT_FIXED(-0.966894633897935), FLOAT_FIXED(-0.255175952896489)}, 
-    {FLOAT_FIXED(2.98694228732818e-06), FLOAT_FIXED(-0.96689429202207), FLOAT_FIXED(-0.255177248292668)}, 
-    {FLOAT_FIXED(-3.95048147300326e-07), FLOAT_FIXED(-0.966896534002436), FLOAT_FIXED(-0.255168753051622)}, 
-    {FLOAT_FIXED(2.51894694007331e-06), FLOAT_FIXED(-0.966894696842592), FLOAT_FIXED(-0.255175714383888)}, 
-    {FLOAT_FIXED(-2.51894694007609e-06), FLOAT_FIXED(-0.966894696842592), FLOAT_FIXED(-0.255175714383888)}, 
-    {FLOAT_FIXED(2.14865095825226e-06), FLOAT_FIXED(-0.966894006683412), FLOAT_FIXED(-0.255178329477802)}, 
-    {FLOAT_FIXED(-2.14864857085664e-06), FLOAT_FIXED(-0.966894006678962), FLOAT_FIXED(-0.255178329494662)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.96689519832688), FLOAT_FIXED(-0.255173814198132)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966896064368367), FLOAT_FIXED(-0.255170532603124)}, 
-    {FLOAT_FIXED(-2.07191243584529e-06), FLOAT_FIXED(-0.966895233917346), FLOAT_FIXED(-0.255173679331604)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966897110787004), FLOAT_FIXED(-0.255166567464751)}, 
-    {FLOAT_FIXED(-2.93945640449609e-06), FLOAT_FIXED(-0.966895480581114), FLOAT_FIXED(-0.255172744671479)}, 
-    {FLOAT_FIXED(-2.89205448783939e-06), FLOAT_FIXED(-0.966895392234676), FLOAT_FIXED(-0.25517307943235)}, 
-    {FLOAT_FIXED(-8.13478612334551e-07), FLOAT_FIXED(-0.966897579346587), FLOAT_FIXED(-0.255164791954235)}, 
-    {FLOAT_FIXED(-3.55549062741094e-06), FLOAT_FIXED(-0.96689481836955), FLOAT_FIXED(-0.255175253889309)}, 
-    {FLOAT_FIXED(2.98693428049568e-06), FLOAT_FIXED(-0.966894292028996), FLOAT_FIXED(-0.255177248266425)}, 
-    {FLOAT_FIXED(-2.91801293407144e-06), FLOAT_FIXED(-0.966894228208741), FLOAT_FIXED(-0.255177490088975)}, 
-    {FLOAT_FIXED(2.91799912586636e-06), FLOAT_FIXED(-0.966894228209965), FLOAT_FIXED(-0.255177490084336)}, 
-    {FLOAT_FIXED(-8.59667135914083e-07), FLOAT_FIXED(-0.96689775202142), FLOAT_FIXED(-0.255164137635337)}, 
-    {FLOAT_FIXED(8.5966428472413e-07), FLOAT_FIXED(-0.966897752019698), FLOAT_FIXED(-0.255164137641864)}, 
-    {FLOAT_FIXED(1.11572565908946e-06), FLOAT_FIXED(-0.9668965586524), FLOAT_FIXED(-0.255168659644755)}, 
-    {FLOAT_FIXED(-1.11572565909009e-06), FLOAT_FIXED(-0.9668965586524), FLOAT_FIXED(-0.255168659644755)}, 
-    {FLOAT_FIXED(9.92031222205315e-07), FLOAT_FIXED(-0.966894187562807), FLOAT_FIXED(-0.255177644115381)}, 
-    {FLOAT_FIXED(-9.92031222190069e-07), FLOAT_FIXED(-0.966894187562807), FLOAT_FIXED(-0.255177644115381)}, 
-    {FLOAT_FIXED(4.10753701190265e-06), FLOAT_FIXED(-0.966892827321542), FLOAT_FIXED(-0.255182798121822)}, 
-    {FLOAT_FIXED(-2.67126553968485e-06), FLOAT_FIXED(-0.966893454407519), FLOAT_FIXED(-0.255180422087511)}, 
-    {FLOAT_FIXED(1.53323550119919e-06), FLOAT_FIXED(-0.966898358250097), FLOAT_FIXED(-0.255161840428613)}, 
-    {FLOAT_FIXED(-9.05293005024602e-07), FLOAT_FIXED(-0.96689724877852), FLOAT_FIXED(-0.255166044574332)}, 
-    {FLOAT_FIXED(-4.14392929778575e-07), FLOAT_FIXED(-0.966894917048727), FLOAT_FIXED(-0.255174880004212)}, 
-    {FLOAT_FIXED(4.14392236977568e-07), FLOAT_FIXED(-0.966894917049951), FLOAT_FIXED(-0.255174879999574)}, 
-    {FLOAT_FIXED(2.79833200468371e-06), FLOAT_FIXED(-0.966891673267849), FLOAT_FIXED(-0.255187170832447)}, 
-    {FLOAT_FIXED(-2.79832200873784e-06), FLOAT_FIXED(-0.966891673264951), FLOAT_FIXED(-0.255187170843427)}, 
-    {FLOAT_FIXED(3.0611578464458e-06), FLOAT_FIXED(-0.966896209592176), FLOAT_FIXED(-0.255169982299861)}, 
-    {FLOAT_FIXED(-3.06114748405774e-06), FLOAT_FIXED(-0.966896209598885), FLOAT_FIXED(-0.255169982274439)}, 
-    {FLOAT_FIXED(-3.97473402870457e-06), FLOAT_FIXED(-0.966900764748956), FLOAT_FIXED(-0.255152721153597)}, 
-    {FLOAT_FIXED(3.97473402870488e-06), FLOAT_FIXED(-0.966900764748956), FLOAT_FIXED(-0.255152721153597)}, 
-    {FLOAT_FIXED(4.19437784980642e-08), FLOAT_FIXED(-0.966891679858383), FLOAT_FIXED(-0.255187145876576)}, 
-    {FLOAT_FIXED(-4.19437784989879e-08), FLOAT_FIXED(-0.966891679858383), FLOAT_FIXED(-0.255187145876576)}, 
-    {FLOAT_FIXED(2.65555194407772e-07), FLOAT_FIXED(-0.96689408530514), FLOAT_FIXED(-0.255178031581613)}, 
-    {FLOAT_FIXED(-2.65555109330372e-07), FLOAT_FIXED(-0.966894085304224), FLOAT_FIXED(-0.255178031585081)}, 
-    {FLOAT_FIXED(-2.40005295071309e-06), FLOAT_FIXED(-0.96689688326866), FLOAT_FIXED(-0.255167429582208)}, 
-    {FLOAT_FIXED(2.4000592996637e-06), FLOAT_FIXED(-0.966896883284403), FLOAT_FIXED(-0.255167429522554)}, 
-    {FLOAT_FIXED(8.28223671820889e-07), FLOAT_FIXED(-0.966888877914574), FLOAT_FIXED(-0.255197762067793)}, 
-    {FLOAT_FIXED(-8.2822062726478e-07), FLOAT_FIXED(-0.966888877922124), FLOAT_FIXED(-0.255197762039187)}, 
-    {FLOAT_FIXED(6.17652882617002e-09), FLOAT_FIXED(-0.966893948309297), FLOAT_FIXED(-0.255178550671599)}, 
-    {FLOAT_FIXED(-6.17654517701397e-09), FLOAT_FIXED(-0.966893948309113), FLOAT_FIXED(-0.255178550672299)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966894018033612), FLOAT_FIXED(-0.255178286479901)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966895006004281), FLOAT_FIXED(-0.255174542938713)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966896745295018), FLOAT_FIXED(-0.255167952411548)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966898404744715), FLOAT_FIXED(-0.255161664248621)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966884899151202), FLOAT_FIXED(-0.255212836262931)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-0.966904110347588), FLOAT_FIXED(-0.255140042707803)}, 
-    {FLOAT_FIXED(0.700224238852801), FLOAT_FIXED(-0.66169873678316), FLOAT_FIXED(0.268031335971347)}, 
-    {FLOAT_FIXED(0.904989521583974), FLOAT_FIXED(-0.330383941681275), FLOAT_FIXED(0.268030626799167)}, 
-    {FLOAT_FIXED(0.02474411447213), FLOAT_FIXED(-0.330385725370234), FLOAT_FIXED(0.943521595550719)}, 
-    {FLOAT_FIXED(-0.889696183119598), FLOAT_FIXED(-0.330387388256289), FLOAT_FIXED(0.315095026021687)}, 
-    {FLOAT_FIXED(-0.574601251035736), FLOAT_FIXED(-0.330389977561263), FLOAT_FIXED(-0.748782922505071)}, 
-    {FLOAT_FIXED(0.534575551824466), FLOAT_FIXED(-0.330386644863937), FLOAT_FIXED(-0.777864798205394)}, 
-    {FLOAT_FIXED(0.802609045932625), FLOAT_FIXED(-0.125626717795071), FLOAT_FIXED(0.583126613320949)}, 
-    {FLOAT_FIXED(-0.306568990079245), FLOAT_FIXED(-0.125630457756652), FLOAT_FIXED(0.943521299391617)}, 
-    {FLOAT_FIXED(-0.992076973914541), FLOAT_FIXED(-0.125631516064113), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.306568990079244), FLOAT_FIXED(-0.125630457756652), FLOAT_FIXED(-0.943521299391617)}, 
-    {FLOAT_FIXED(0.802609045932625), FLOAT_FIXED(-0.125626717795071), FLOAT_FIXED(-0.583126613320949)}, 
-    {FLOAT_FIXED(0.408947361084921), FLOAT_FIXED(0.661693847470737), FLOAT_FIXED(0.62842923872227)}, 
-    {FLOAT_FIXED(-0.47130445705576), FLOAT_FIXED(0.661695387159342), FLOAT_FIXED(0.583122048435338)}, 
-    {FLOAT_FIXED(-0.700225798054669), FLOAT_FIXED(0.661695416733175), FLOAT_FIXED(-0.268035458872537)}, 
-    {FLOAT_FIXED(0.0385320387969895), FLOAT_FIXED(0.661696014630882), FLOAT_FIXED(-0.748781454235984)}, 
-    {FLOAT_FIXED(0.724042011958397), FLOAT_FIXED(0.661695565800343), FLOAT_FIXED(-0.194736085817189)}, 
-    {FLOAT_FIXED(0.268032235276648), FLOAT_FIXED(0.943524252920786), FLOAT_FIXED(-0.194732393306495)}, 
-    {FLOAT_FIXED(0.491121223889366), FLOAT_FIXED(0.794656815787099), FLOAT_FIXED(-0.356819966605738)}, 
-    {FLOAT_FIXED(0.408946067192361), FLOAT_FIXED(0.661695696952476), FLOAT_FIXED(-0.628428133331472)}, 
-    {FLOAT_FIXED(-0.102378773573425), FLOAT_FIXED(0.943525403801903), FLOAT_FIXED(-0.315084749078812)}, 
-    {FLOAT_FIXED(-0.187594363892359), FLOAT_FIXED(0.794656079964353), FLOAT_FIXED(-0.577347442370285)}, 
-    {FLOAT_FIXED(-0.471302841308378), FLOAT_FIXED(0.661695080788827), FLOAT_FIXED(-0.583123702000285)}, 
-    {FLOAT_FIXED(-0.331299502789268), FLOAT_FIXED(0.943525643240068), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.607061800669874), FLOAT_FIXED(0.794654623196424), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.700225304692414), FLOAT_FIXED(0.661695557557793), FLOAT_FIXED(0.268036400096513)}, 
-    {FLOAT_FIXED(-0.102379969824679), FLOAT_FIXED(0.943525167747844), FLOAT_FIXED(0.315085067251848)}, 
-    {FLOAT_FIXED(-0.187595905167831), FLOAT_FIXED(0.794656747460118), FLOAT_FIXED(0.577346022832381)}, 
-    {FLOAT_FIXED(0.0385344922618755), FLOAT_FIXED(0.66169420435618), FLOAT_FIXED(0.748782927708398)}, 
-    {FLOAT_FIXED(0.268032235276649), FLOAT_FIXED(0.943524252920786), FLOAT_FIXED(0.194732393306495)}, 
-    {FLOAT_FIXED(0.491122097652059), FLOAT_FIXED(0.794655990715164), FLOAT_FIXED(0.356820601448882)}, 
-    {FLOAT_FIXED(0.724041900003043), FLOAT_FIXED(0.66169546348534), FLOAT_FIXED(0.194736849730358)}, 
-    {FLOAT_FIXED(0.889697333994606), FLOAT_FIXED(0.330384651788376), FLOAT_FIXED(-0.31509464569485)}, 
-    {FLOAT_FIXED(0.794655448322719), FLOAT_FIXED(0.187595273948193), FLOAT_FIXED(-0.577348016055586)}, 
-    {FLOAT_FIXED(0.574600786793021), FLOAT_FIXED(0.330388444922088), FLOAT_FIXED(-0.748783955008924)}, 
-    {FLOAT_FIXED(-0.024746000781171), FLOAT_FIXED(0.330388203713519), FLOAT_FIXED(-0.943520678253684)}, 
-    {FLOAT_FIXED(-0.303530870876623), FLOAT_FIXED(0.187599746620635), FLOAT_FIXED(-0.934170940188546)}, 
-    {FLOAT_FIXED(-0.534576413331347), FLOAT_FIXED(0.330389250245202), FLOAT_FIXED(-0.777863099544005)}, 
-    {FLOAT_FIXED(-0.904987419457686), FLOAT_FIXED(0.330386730706539), FLOAT_FIXED(-0.268034286605954)}, 
-    {FLOAT_FIXED(-0.982245764114619), FLOAT_FIXED(0.187598664384605), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.904987324779098), FLOAT_FIXED(0.330386226459873), FLOAT_FIXED(0.268035227824211)}, 
-    {FLOAT_FIXED(-0.534578926211338), FLOAT_FIXED(0.33038778686485), FLOAT_FIXED(0.777861994148885)}, 
-    {FLOAT_FIXED(-0.303531077149318), FLOAT_FIXED(0.187596251590175), FLOAT_FIXED(0.934171575029925)}, 
-    {FLOAT_FIXED(-0.024742746761037), FLOAT_FIXED(0.330386428733737), FLOAT_FIXED(0.943521385126636)}, 
-    {FLOAT_FIXED(0.574600786793021), FLOAT_FIXED(0.330388444922088), FLOAT_FIXED(0.748783955008924)}, 
-    {FLOAT_FIXED(0.794655448322719), FLOAT_FIXED(0.187595273948192), FLOAT_FIXED(0.577348016055586)}, 
-    {FLOAT_FIXED(0.889697097518424), FLOAT_FIXED(0.330384069017652), FLOAT_FIXED(0.315095924452589)}, 
-    {FLOAT_FIXED(0.306569021847072), FLOAT_FIXED(0.125629645942475), FLOAT_FIXED(-0.943521397162829)}, 
-    {FLOAT_FIXED(0.303530937899149), FLOAT_FIXED(-0.187598611015935), FLOAT_FIXED(-0.934171146462443)}, 
-    {FLOAT_FIXED(0.0247473685022683), FLOAT_FIXED(-0.33038750033398), FLOAT_FIXED(-0.943520888679884)}, 
-    {FLOAT_FIXED(-0.802608619268653), FLOAT_FIXED(0.125630882496441), FLOAT_FIXED(-0.583126303333018)}, 
-    {FLOAT_FIXED(-0.794654988946488), FLOAT_FIXED(-0.187598247017936), FLOAT_FIXED(-0.577347682300929)}, 
-    {FLOAT_FIXED(-0.889696419592312), FLOAT_FIXED(-0.330387971025286), FLOAT_FIXED(-0.315093747266452)}, 
-    {FLOAT_FIXED(-0.802608619268653), FLOAT_FIXED(0.125630882496441), FLOAT_FIXED(0.583126303333018)}, 
-    {FLOAT_FIXED(-0.794654988946488), FLOAT_FIXED(-0.187598247017936), FLOAT_FIXED(0.577347682300929)}, 
-    {FLOAT_FIXED(-0.574601251035736), FLOAT_FIXED(-0.330389977561263), FLOAT_FIXED(0.748782922505071)}, 
-    {FLOAT_FIXED(0.306569021847072), FLOAT_FIXED(0.125629645942475), FLOAT_FIXED(0.94352139716283)}, 
-    {FLOAT_FIXED(0.303531144170685), FLOAT_FIXED(-0.18759511598316), FLOAT_FIXED(0.934171781300259)}, 
-    {FLOAT_FIXED(0.534578064715044), FLOAT_FIXED(-0.330385181473796), FLOAT_FIXED(0.777863692807451)}, 
-    {FLOAT_FIXED(0.992077537576228), FLOAT_FIXED(0.125627064905169), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.982245764114619), FLOAT_FIXED(-0.187598664384605), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.904989616258937), FLOAT_FIXED(-0.330384445917059), FLOAT_FIXED(-0.268029685593928)}, 
-    {FLOAT_FIXED(0.47129963595298), FLOAT_FIXED(-0.661698627916568), FLOAT_FIXED(-0.583122267593958)}, 
-    {FLOAT_FIXED(0.187573559119585), FLOAT_FIXED(-0.79464973862722), FLOAT_FIXED(-0.577362929896701)}, 
-    {FLOAT_FIXED(-0.0385302644221261), FLOAT_FIXED(-0.661699448358876), FLOAT_FIXED(-0.748778511153412)}, 
-    {FLOAT_FIXED(-0.408946535484434), FLOAT_FIXED(-0.661698040532984), FLOAT_FIXED(-0.628425360938026)}, 
-    {FLOAT_FIXED(-0.491117791579843), FLOAT_FIXED(-0.794657374173613), FLOAT_FIXED(-0.356823447190954)}, 
-    {FLOAT_FIXED(-0.724043683871866), FLOAT_FIXED(-0.661693434909769), FLOAT_FIXED(-0.194737110080662)}, 
-    {FLOAT_FIXED(-0.724043571915077), FLOAT_FIXED(-0.661693332594019), FLOAT_FIXED(0.194737873997532)}, 
-    {FLOAT_FIXED(-0.491118195772604), FLOAT_FIXED(-0.794651581823093), FLOAT_FIXED(0.356835790367387)}, 
-    {FLOAT_FIXED(-0.408947829377773), FLOAT_FIXED(-0.661696191050178), FLOAT_FIXED(0.628426466340251)}, 
-    {FLOAT_FIXED(0.700224732204489), FLOAT_FIXED(-0.661698595957679), FLOAT_FIXED(-0.268030394762959)}, 
-    {FLOAT_FIXED(0.607051177478682), FLOAT_FIXED(-0.794662738173497), FLOAT_FIXED(2.19167985828725e-05)}, 
-    {FLOAT_FIXED(0.331257604288063), FLOAT_FIXED(-0.943540353986692), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(-0.0385327178811806), FLOAT_FIXED(-0.661697638084228), FLOAT_FIXED(0.748779984645986)}, 
-    {FLOAT_FIXED(0.187578225606704), FLOAT_FIXED(-0.794664016435795), FLOAT_FIXED(0.577341762096222)}, 
-    {FLOAT_FIXED(0.471301251695713), FLOAT_FIXED(-0.66169893428911), FLOAT_FIXED(0.583120614033418)}, 
-    {FLOAT_FIXED(-0.268024037370984), FLOAT_FIXED(-0.943525985067666), FLOAT_FIXED(0.194735284151198)}, 
-    {FLOAT_FIXED(-0.268042873822252), FLOAT_FIXED(-0.943520119512696), FLOAT_FIXED(0.194737777197585)}, 
-    {FLOAT_FIXED(-0.268027669869328), FLOAT_FIXED(-0.943526949026302), FLOAT_FIXED(-0.194725613737736)}, 
-    {FLOAT_FIXED(-0.268024128058612), FLOAT_FIXED(-0.943526304315731), FLOAT_FIXED(-0.194733612513916)}, 
-    {FLOAT_FIXED(0.10238058996365), FLOAT_FIXED(-0.943521173335157), FLOAT_FIXED(0.315096826811925)}, 
-    {FLOAT_FIXED(0.102374543206226), FLOAT_FIXED(-0.943534228011886), FLOAT_FIXED(0.315059698268966)}, 
-    {FLOAT_FIXED(0.102371683858408), FLOAT_FIXED(-0.943526426852192), FLOAT_FIXED(-0.315083989081531)}, 
-    {FLOAT_FIXED(0.102368221029018), FLOAT_FIXED(-0.943536260725955), FLOAT_FIXED(-0.315055664952459)}, 
-    {FLOAT_FIXED(0.289721001031651), FLOAT_FIXED(0.957111143786774), FLOAT_FIXED(-6.24757261428423e-07)}, 
-    {FLOAT_FIXED(0.289722440641901), FLOAT_FIXED(0.957110707999791), FLOAT_FIXED(-4.54301020622775e-06)}, 
-    {FLOAT_FIXED(0.289720186627008), FLOAT_FIXED(0.957111390304643), FLOAT_FIXED(-3.15026882019198e-06)}, 
-    {FLOAT_FIXED(-4.32149656813788e-06), FLOAT_FIXED(0.966895862264493), FLOAT_FIXED(0.255171298380378)}, 
-    {FLOAT_FIXED(-0.289710603564974), FLOAT_FIXED(-0.957114291052047), FLOAT_FIXED(-6.77906596454427e-06)}, 
-    {FLOAT_FIXED(-0.289721934600705), FLOAT_FIXED(-0.957110861182722), FLOAT_FIXED(-4.15842901420531e-06)}, 
-    {FLOAT_FIXED(-0.289719528554969), FLOAT_FIXED(-0.957111589509636), FLOAT_FIXED(-4.74214957048333e-07)}, 
-    {FLOAT_FIXED(0.289720138202234), FLOAT_FIXED(0.957111404968109), FLOAT_FIXED(2.24981068731363e-07)}, 
-    {FLOAT_FIXED(0.289719146649583), FLOAT_FIXED(0.957111705113163), FLOAT_FIXED(-1.05713882230538e-07)}, 
-    {FLOAT_FIXED(1.62588103387914e-06), FLOAT_FIXED(0.966894709330878), FLOAT_FIXED(0.255175667071361)}, 
-    {FLOAT_FIXED(2.17415010372319e-06), FLOAT_FIXED(0.966894883839809), FLOAT_FIXED(0.255175005828697)}, 
-    {FLOAT_FIXED(-0.289720536638604), FLOAT_FIXED(-0.957111284356525), FLOAT_FIXED(2.69099685037144e-06)}, 
-    {FLOAT_FIXED(-0.289719529208664), FLOAT_FIXED(-0.95711158930935), FLOAT_FIXED(-2.20001021510523e-06)}, 
-    {FLOAT_FIXED(0.289718944110147), FLOAT_FIXED(0.95711176642067), FLOAT_FIXED(1.67540876177412e-06)}, 
-    {FLOAT_FIXED(0.289723972683061), FLOAT_FIXED(0.957110244247651), FLOAT_FIXED(-2.99102066583688e-06)}, 
-    {FLOAT_FIXED(-8.07555540502697e-06), FLOAT_FIXED(0.966896126439373), FLOAT_FIXED(0.255170297274824)}, 
-    {FLOAT_FIXED(-8.08631074541301e-06), FLOAT_FIXED(0.966892347402029), FLOAT_FIXED(0.255184616444656)}, 
-    {FLOAT_FIXED(9.27335964659023e-07), FLOAT_FIXED(0.966895593257506), FLOAT_FIXED(0.255172317735203)}, 
-    {FLOAT_FIXED(-0.28971414303228), FLOAT_FIXED(-0.957113219688446), FLOAT_FIXED(-4.96877238596388e-06)}, 
-    {FLOAT_FIXED(-0.289721039075724), FLOAT_FIXED(-0.957111132265496), FLOAT_FIXED(3.21596481841085e-06)}, 
-    {FLOAT_FIXED(-0.289715488312121), FLOAT_FIXED(-0.957112812486726), FLOAT_FIXED(-2.41221178261774e-06)}, 
-    {FLOAT_FIXED(8.07547036606472e-06), FLOAT_FIXED(0.966896126439373), FLOAT_FIXED(0.255170297274824)}, 
-    {FLOAT_FIXED(-5.74809398331788e-06), FLOAT_FIXED(0.966896485093006), FLOAT_FIXED(0.255168938316851)}, 
-    {FLOAT_FIXED(-0.289721329736889), FLOAT_FIXED(-0.957111044278436), FLOAT_FIXED(-3.96630825550365e-06)}, 
-    {FLOAT_FIXED(0.28971642222523), FLOAT_FIXED(0.957112529795247), FLOAT_FIXED(-1.39829347235062e-06)}, 
-    {FLOAT_FIXED(-0.289715631125176), FLOAT_FIXED(-0.95711276925857), FLOAT_FIXED(1.98278133613502e-06)}, 
-    {FLOAT_FIXED(0.289722366347477), FLOAT_FIXED(0.957110730479735), FLOAT_FIXED(-6.21017102994298e-06)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.966897796422576), FLOAT_FIXED(0.255163969386682)}, 
-    {FLOAT_FIXED(-0.289719658115741), FLOAT_FIXED(-0.957111550288679), FLOAT_FIXED(2.30201340481765e-06)}, 
-    {FLOAT_FIXED(0.289724955960418), FLOAT_FIXED(0.957109946606359), FLOAT_FIXED(-9.52625826799902e-07)}, 
-    {FLOAT_FIXED(0.289716888890546), FLOAT_FIXED(0.957112388490795), FLOAT_FIXED(-9.43549503018488e-06)}, 
-    {FLOAT_FIXED(0.289720295787576), FLOAT_FIXED(0.957111357266092), FLOAT_FIXED(1.00927686526174e-06)}, 
-    {FLOAT_FIXED(-0.289717762208839), FLOAT_FIXED(-0.957112124183457), FLOAT_FIXED(1.31651513871884e-06)}, 
-    {FLOAT_FIXED(-3.55548109254265e-06), FLOAT_FIXED(0.966894818377791), FLOAT_FIXED(0.255175253858084)}, 
-    {FLOAT_FIXED(-0.289719146650318), FLOAT_FIXED(-0.957111705112941), FLOAT_FIXED(-1.05713626593074e-07)}, 
-    {FLOAT_FIXED(0.289719353397546), FLOAT_FIXED(0.957111642529412), FLOAT_FIXED(-1.24808486969537e-06)}, 
-    {FLOAT_FIXED(0.289720541506126), FLOAT_FIXED(0.957111282880853), FLOAT_FIXED(-3.40074596468013e-06)}, 
-    {FLOAT_FIXED(0.289723179768138), FLOAT_FIXED(0.957110484271228), FLOAT_FIXED(-1.77038551645317e-06)}, 
-    {FLOAT_FIXED(0.289720158364277), FLOAT_FIXED(0.957111398865), FLOAT_FIXED(-2.46046778119006e-07)}, 
-    {FLOAT_FIXED(-0.289717245862829), FLOAT_FIXED(-0.957112280465517), FLOAT_FIXED(5.63514168217847e-06)}, 
-    {FLOAT_FIXED(-5.89608486991796e-06), FLOAT_FIXED(0.966896549702904), FLOAT_FIXED(0.255168693490906)}, 
-    {FLOAT_FIXED(-0.289716355164238), FLOAT_FIXED(-0.957112550093894), FLOAT_FIXED(1.76429790951736e-06)}, 
-    {FLOAT_FIXED(0.289722407050975), FLOAT_FIXED(0.957110718178667), FLOAT_FIXED(3.24458710407008e-07)}, 
-    {FLOAT_FIXED(-0.289722335879151), FLOAT_FIXED(-0.957110739722272), FLOAT_FIXED(-1.00665937164489e-06)}, 
-    {FLOAT_FIXED(-0.289720323974041), FLOAT_FIXED(-0.957111348733349), FLOAT_FIXED(-1.48517365222919e-06)}, 
-    {FLOAT_FIXED(0.289724085883749), FLOAT_FIXED(0.957110209985373), FLOAT_FIXED(-7.62335375787484e-07)}, 
-    {FLOAT_FIXED(-0.289716680134578), FLOAT_FIXED(-0.957112451727247), FLOAT_FIXED(6.75354380510525e-07)}, 
-    {FLOAT_FIXED(0.289720541519846), FLOAT_FIXED(0.9571112828767), FLOAT_FIXED(3.40075564837596e-06)}, 
-    {FLOAT_FIXED(5.27137018613832e-06), FLOAT_FIXED(0.966894695178156), FLOAT_FIXED(0.25517572064864)}, 
-    {FLOAT_FIXED(0.289722440730204), FLOAT_FIXED(0.957110707973061), FLOAT_FIXED(-4.54304432842656e-06)}, 
-    {FLOAT_FIXED(-0.28971705023175), FLOAT_FIXED(-0.957112339699168), FLOAT_FIXED(7.73389395436959e-07)}, 
-    {FLOAT_FIXED(0.289717195516848), FLOAT_FIXED(0.957112295718755), FLOAT_FIXED(2.41397263895011e-06)}, 
-    {FLOAT_FIXED(-0.289719827211567), FLOAT_FIXED(-0.957111499101557), FLOAT_FIXED(-2.84077513631555e-06)}, 
-    {FLOAT_FIXED(0.289720343424468), FLOAT_FIXED(0.957111342844747), FLOAT_FIXED(1.98314794037451e-06)}, 
-    {FLOAT_FIXED(-0.289717922176806), FLOAT_FIXED(-0.957112075761938), FLOAT_FIXED(-4.77373053557373e-07)}, 
-    {FLOAT_FIXED(0.289717857675643), FLOAT_FIXED(0.957112095277257), FLOAT_FIXED(4.22072885466388e-06)}, 
-    {FLOAT_FIXED(0.289722385974413), FLOAT_FIXED(0.95711072455866), FLOAT_FIXED(3.00884440772828e-07)}, 
-    {FLOAT_FIXED(0.289727149548732), FLOAT_FIXED(0.957109282579235), FLOAT_FIXED(-3.87660547984942e-06)}, 
-    {FLOAT_FIXED(0.289722618260971), FLOAT_FIXED(0.957110654241227), FLOAT_FIXED(2.43689932225619e-06)}, 
-    {FLOAT_FIXED(-0.289720323999244), FLOAT_FIXED(-0.95711134872572), FLOAT_FIXED(-1.48516275146096e-06)}, 
-    {FLOAT_FIXED(-0.28971509541841), FLOAT_FIXED(-0.957112931414996), FLOAT_FIXED(-2.21258283976036e-06)}, 
-    {FLOAT_FIXED(8.5327443275897e-07), FLOAT_FIXED(0.96689574355266), FLOAT_FIXED(0.255171748238361)}, 
-    {FLOAT_FIXED(-0.289717762202508), FLOAT_FIXED(-0.957112124185373), FLOAT_FIXED(-1.31650805966042e-06)}, 
-    {FLOAT_FIXED(0.289712319465585), FLOAT_FIXED(0.957113771685026), FLOAT_FIXED(-8.57298037667872e-07)}, 
-    {FLOAT_FIXED(9.27332095850918e-07), FLOAT_FIXED(0.966895593256845), FLOAT_FIXED(0.255172317737707)}, 
-    {FLOAT_FIXED(-0.289715061527025), FLOAT_FIXED(-0.957112941675693), FLOAT_FIXED(1.13756221123419e-06)}, 
-    {FLOAT_FIXED(-4.02173071185851e-06), FLOAT_FIXED(0.966895250018672), FLOAT_FIXED(0.25517361829773)}, 
-    {FLOAT_FIXED(0.289718827624265), FLOAT_FIXED(0.957111801682534), FLOAT_FIXED(1.87686024293812e-07)}, 
-    {FLOAT_FIXED(-0.289717801332352), FLOAT_FIXED(-0.957112112331789), FLOAT_FIXED(4.35077815966664e-06)}, 
-    {FLOAT_FIXED(-0.289720262244326), FLOAT_FIXED(-0.957111367418831), FLOAT_FIXED(-1.65361251229786e-06)}, 
-    {FLOAT_FIXED(-0.289711365022841), FLOAT_FIXED(-0.957114060581531), FLOAT_FIXED(3.70621718594969e-06)}, 
-    {FLOAT_FIXED(3.81891728280443e-06), FLOAT_FIXED(0.966895205076996), FLOAT_FIXED(0.255173788592264)}, 
-    {FLOAT_FIXED(-0.289721809900614), FLOAT_FIXED(-0.957110898933687), FLOAT_FIXED(-3.20340909586198e-06)}, 
-    {FLOAT_FIXED(0.289721069732363), FLOAT_FIXED(0.957111122990973), FLOAT_FIXED(3.06300106037834e-07)}, 
-    {FLOAT_FIXED(0.289721006462134), FLOAT_FIXED(0.957111142136968), FLOAT_FIXED(3.44033878523428e-06)}, 
-    {FLOAT_FIXED(-0.28971832810397), FLOAT_FIXED(-0.957111952881793), FLOAT_FIXED(-3.38234389563907e-06)}, 
-    {FLOAT_FIXED(0.289720594952962), FLOAT_FIXED(0.957111266691784), FLOAT_FIXED(5.63478623621971e-06)}, 
-    {FLOAT_FIXED(0.289727663778606), FLOAT_FIXED(0.957109126922595), FLOAT_FIXED(1.69080673521691e-06)}, 
-    {FLOAT_FIXED(-2.51124556235786e-06), FLOAT_FIXED(0.966895117272297), FLOAT_FIXED(0.25517412131461)}, 
-    {FLOAT_FIXED(0.289717922176806), FLOAT_FIXED(0.957112075761938), FLOAT_FIXED(4.77373044980802e-07)}, 
-    {FLOAT_FIXED(0.289719149362841), FLOAT_FIXED(0.957111704287529), FLOAT_FIXED(-2.87988782342207e-06)}, 
-    {FLOAT_FIXED(-2.17417332313154e-06), FLOAT_FIXED(0.96689488384062), FLOAT_FIXED(0.255175005825623)}, 
-    {FLOAT_FIXED(0.2897231564669), FLOAT_FIXED(0.95711049132483), FLOAT_FIXED(-1.6730263270874e-06)}, 
-    {FLOAT_FIXED(0.289721500671412), FLOAT_FIXED(0.957110992543528), FLOAT_FIXED(1.02338075663405e-06)}, 
-    {FLOAT_FIXED(0.289724085885535), FLOAT_FIXED(0.957110209984832), FLOAT_FIXED(7.62340543140102e-07)}, 
-    {FLOAT_FIXED(0.289723857017861), FLOAT_FIXED(0.957110279264978), FLOAT_FIXED(-1.00032747765643e-07)}, 
-    {FLOAT_FIXED(0.289722407057251), FLOAT_FIXED(0.957110718176767), FLOAT_FIXED(3.24459437082683e-07)}, 
-    {FLOAT_FIXED(0.289722407052535), FLOAT_FIXED(0.957110718178195), FLOAT_FIXED(-3.24460455067142e-07)}, 
-    {FLOAT_FIXED(-1.62588103396745e-06), FLOAT_FIXED(0.966894709330878), FLOAT_FIXED(0.255175667071361)}, 
-    {FLOAT_FIXED(0.289720353777017), FLOAT_FIXED(0.957111339711086), FLOAT_FIXED(-1.94143161505718e-06)}, 
-    {FLOAT_FIXED(-0.28971598041523), FLOAT_FIXED(-0.95711266352759), FLOAT_FIXED(2.67670464825634e-06)}, 
-    {FLOAT_FIXED(2.18393951044263e-06), FLOAT_FIXED(0.966895211904289), FLOAT_FIXED(0.255173762741765)}, 
-    {FLOAT_FIXED(-0.289710445294505), FLOAT_FIXED(-0.957114338978085), FLOAT_FIXED(3.13106204038377e-06)}, 
-    {FLOAT_FIXED(0.289715095418406), FLOAT_FIXED(0.957112931414997), FLOAT_FIXED(2.21258283740131e-06)}, 
-    {FLOAT_FIXED(0.289717282833034), FLOAT_FIXED(0.957112269287543), FLOAT_FIXED(2.66338232542625e-06)}, 
-    {FLOAT_FIXED(-0.28972410789222), FLOAT_FIXED(-0.957110203323279), FLOAT_FIXED(7.2746310284381e-07)}, 
-    {FLOAT_FIXED(-0.289718705992108), FLOAT_FIXED(-0.957111838500206), FLOAT_FIXED(-1.00666305756898e-06)}, 
-    {FLOAT_FIXED(0.289719947123342), FLOAT_FIXED(0.957111462807066), FLOAT_FIXED(-1.47206036654022e-06)}, 
-    {FLOAT_FIXED(0.289715980415231), FLOAT_FIXED(0.95711266352759), FLOAT_FIXED(-2.67670464787945e-06)}, 
-    {FLOAT_FIXED(0.289722786011076), FLOAT_FIXED(0.957110603464163), FLOAT_FIXED(1.56387694519468e-06)}, 
-    {FLOAT_FIXED(0.289723179117813), FLOAT_FIXED(0.957110484463336), FLOAT_FIXED(3.4966497425149e-06)}, 
-    {FLOAT_FIXED(0.289718572026933), FLOAT_FIXED(0.957111879017459), FLOAT_FIXED(8.14518559920131e-06)}, 
-    {FLOAT_FIXED(0.289724006432055), FLOAT_FIXED(0.95711023402832), FLOAT_FIXED(-3.9003215414246e-06)}, 
-    {FLOAT_FIXED(0.289719028147442), FLOAT_FIXED(0.957111740909568), FLOAT_FIXED(1.19313513278848e-05)}, 
-    {FLOAT_FIXED(-3.18983416045447e-06), FLOAT_FIXED(0.966894469053567), FLOAT_FIXED(0.255176577497711)}, 
-    {FLOAT_FIXED(-5.6863607607666e-06), FLOAT_FIXED(0.966894549490275), FLOAT_FIXED(0.255176272669823)}, 
-    {FLOAT_FIXED(4.89937391040123e-06), FLOAT_FIXED(0.966894979039063), FLOAT_FIXED(0.255174645066956)}, 
-    {FLOAT_FIXED(-0.289717763124881), FLOAT_FIXED(-0.95711212390617), FLOAT_FIXED(-1.31751394060701e-06)}, 
-    {FLOAT_FIXED(-0.289723637501712), FLOAT_FIXED(-0.957110345711605), FLOAT_FIXED(-2.14189793850391e-06)}, 
-    {FLOAT_FIXED(-0.289716680137303), FLOAT_FIXED(-0.957112451726423), FLOAT_FIXED(-6.75356303566346e-07)}, 
-    {FLOAT_FIXED(-4.46471107951514e-06), FLOAT_FIXED(0.96689442381995), FLOAT_FIXED(0.255176748874096)}, 
-    {FLOAT_FIXED(-0.289719711642408), FLOAT_FIXED(-0.957111534085659), FLOAT_FIXED(-2.4569111350922e-06)}, 
-    {FLOAT_FIXED(-0.2897208229725), FLOAT_FIXED(-0.957111197684395), FLOAT_FIXED(1.81099972463865e-06)}, 
-    {FLOAT_FIXED(-0.289717302215542), FLOAT_FIXED(-0.957112263423757), FLOAT_FIXED(8.94887097580099e-07)}, 
-    {FLOAT_FIXED(0.289717857624637), FLOAT_FIXED(0.957112095292697), FLOAT_FIXED(4.22069934583843e-06)}, 
-    {FLOAT_FIXED(1.21259977913389e-07), FLOAT_FIXED(0.966895356984431), FLOAT_FIXED(0.255173213018013)}, 
-    {FLOAT_FIXED(-0.289717762228006), FLOAT_FIXED(-0.957112124177655), FLOAT_FIXED(-1.31651105040461e-06)}, 
-    {FLOAT_FIXED(-0.289721069732358), FLOAT_FIXED(-0.957111122990974), FLOAT_FIXED(-3.06300103054822e-07)}, 
-    {FLOAT_FIXED(-0.289718360707557), FLOAT_FIXED(-0.957111943017902), FLOAT_FIXED(-1.19215391120343e-06)}, 
-    {FLOAT_FIXED(0.289720158364277), FLOAT_FIXED(0.957111398865001), FLOAT_FIXED(2.46046778115476e-07)}, 
-    {FLOAT_FIXED(-0.289718131135409), FLOAT_FIXED(-0.957112012502114), FLOAT_FIXED(3.94465291242847e-06)}, 
-    {FLOAT_FIXED(-0.289725790079534), FLOAT_FIXED(-0.957109694108776), FLOAT_FIXED(2.40747811878586e-06)}, 
-    {FLOAT_FIXED(-0.289719658110881), FLOAT_FIXED(-0.95711155029015), FLOAT_FIXED(-2.3019993403414e-06)}, 
-    {FLOAT_FIXED(0.28971502465746), FLOAT_FIXED(0.957112952814153), FLOAT_FIXED(-6.56508623215372e-06)}, 
-    {FLOAT_FIXED(-0.289723972683055), FLOAT_FIXED(-0.957110244247653), FLOAT_FIXED(2.99102065801209e-06)}, 
-    {FLOAT_FIXED(-0.289715720580339), FLOAT_FIXED(-0.957112742182278), FLOAT_FIXED(9.664861084717e-07)}, 
-    {FLOAT_FIXED(0.289720984467435), FLOAT_FIXED(0.957111148796283), FLOAT_FIXED(-3.01330593217106e-06)}, 
-    {FLOAT_FIXED(0.289720343424468), FLOAT_FIXED(0.957111342844747), FLOAT_FIXED(-1.98314794037451e-06)}, 
-    {FLOAT_FIXED(1.70511648549229e-07), FLOAT_FIXED(0.966895080707708), FLOAT_FIXED(0.255174259875884)}, 
-    {FLOAT_FIXED(4.01643361712133e-06), FLOAT_FIXED(0.966895696226494), FLOAT_FIXED(0.255171927536222)}, 
-    {FLOAT_FIXED(-1.86511432641793e-06), FLOAT_FIXED(0.966893478221796), FLOAT_FIXED(0.255180331860979)}, 
-    {FLOAT_FIXED(-0.289719970803662), FLOAT_FIXED(-0.957111455634265), FLOAT_FIXED(-3.3441006902743e-06)}, 
-    {FLOAT_FIXED(0.289720516531803), FLOAT_FIXED(0.957111290445725), FLOAT_FIXED(1.36556914153457e-06)}, 
-    {FLOAT_FIXED(0.28971781054438), FLOAT_FIXED(0.957112109552374), FLOAT_FIXED(1.25535664789448e-06)}, 
-    {FLOAT_FIXED(0.289715337024435), FLOAT_FIXED(0.957112858280141), FLOAT_FIXED(2.76347813294494e-06)}, 
-    {FLOAT_FIXED(-0.289715523350296), FLOAT_FIXED(-0.957112801880726), FLOAT_FIXED(2.427159051344e-06)}, 
-    {FLOAT_FIXED(-0.289717861250285), FLOAT_FIXED(-0.957112094201221), FLOAT_FIXED(-2.51291892765364e-06)}, 
-    {FLOAT_FIXED(0.289716384837256), FLOAT_FIXED(0.957112541112342), FLOAT_FIXED(-1.51898524025756e-06)}, 
-    {FLOAT_FIXED(-0.289716356187074), FLOAT_FIXED(-0.957112549784544), FLOAT_FIXED(1.61680533670375e-06)}, 
-    {FLOAT_FIXED(-0.289716814529918), FLOAT_FIXED(-0.957112411046182), FLOAT_FIXED(-3.42481978629555e-08)}, 
-    {FLOAT_FIXED(-0.289721078057263), FLOAT_FIXED(-0.957111120469508), FLOAT_FIXED(1.71476991877522e-06)}, 
-    {FLOAT_FIXED(-0.289719558251237), FLOAT_FIXED(-0.957111580520559), FLOAT_FIXED(-3.80963315047668e-07)}, 
-    {FLOAT_FIXED(0.289719748106692), FLOAT_FIXED(0.9571115230509), FLOAT_FIXED(4.26454346619797e-07)}, 
-    {FLOAT_FIXED(0.289719146650306), FLOAT_FIXED(0.957111705112944), FLOAT_FIXED(1.05713630600838e-07)}, 
-    {FLOAT_FIXED(-0.289718325220013), FLOAT_FIXED(-0.957111953741672), FLOAT_FIXED(6.04231362741843e-06)}, 
-    {FLOAT_FIXED(0.28971680529864), FLOAT_FIXED(0.957112413807412), FLOAT_FIXED(7.95610675395121e-06)}, 
-    {FLOAT_FIXED(-0.289721048991999), FLOAT_FIXED(-0.957111129259549), FLOAT_FIXED(4.29958479697404e-06)}, 
-    {FLOAT_FIXED(-0.289721887514619), FLOAT_FIXED(-0.957110875438028), FLOAT_FIXED(-3.63561749082089e-06)}, 
-    {FLOAT_FIXED(0.289732699417697), FLOAT_FIXED(0.957107602542413), FLOAT_FIXED(-6.60672130224592e-06)}, 
-    {FLOAT_FIXED(-2.19758117582091e-06), FLOAT_FIXED(0.966896613905598), FLOAT_FIXED(0.255168450269739)}, 
-    {FLOAT_FIXED(-2.02977802710948e-06), FLOAT_FIXED(0.966893876916128), FLOAT_FIXED(0.255178821178366)}, 
-    {FLOAT_FIXED(5.68636076081279e-06), FLOAT_FIXED(0.966894549490275), FLOAT_FIXED(0.255176272669823)}, 
-    {FLOAT_FIXED(8.13478612322776e-07), FLOAT_FIXED(0.966897579346587), FLOAT_FIXED(0.255164791954235)}, 
-    {FLOAT_FIXED(-0.289718966918465), FLOAT_FIXED(-0.95711175951801), FLOAT_FIXED(-1.92422776964847e-07)}, 
-    {FLOAT_FIXED(-0.289710993920023), FLOAT_FIXED(-0.95711417291717), FLOAT_FIXED(-1.71880955562175e-06)}, 
-    {FLOAT_FIXED(2.51894694007609e-06), FLOAT_FIXED(0.966894696842592), FLOAT_FIXED(0.255175714383888)}, 
-    {FLOAT_FIXED(-0.289717949390165), FLOAT_FIXED(-0.957112067524147), FLOAT_FIXED(-8.99773838131829e-07)}, 
-    {FLOAT_FIXED(0.289712365690214), FLOAT_FIXED(0.957113757692209), FLOAT_FIXED(1.57478744204934e-06)}, 
-    {FLOAT_FIXED(0.289720471478091), FLOAT_FIXED(0.957111304074111), FLOAT_FIXED(-4.47966101372368e-06)}, 
-    {FLOAT_FIXED(0.289719007347927), FLOAT_FIXED(0.95711174727947), FLOAT_FIXED(9.85357694885024e-07)}, 
-    {FLOAT_FIXED(8.08631074544201e-06), FLOAT_FIXED(0.966892347402029), FLOAT_FIXED(0.255184616444656)}, 
-    {FLOAT_FIXED(-3.77681136761623e-06), FLOAT_FIXED(0.96689563114071), FLOAT_FIXED(0.255172174162355)}, 
-    {FLOAT_FIXED(-0.28971770260357), FLOAT_FIXED(-0.957112142222384), FLOAT_FIXED(-2.93077314512473e-06)}, 
-    {FLOAT_FIXED(-0.289722098878578), FLOAT_FIXED(-0.957110811453636), FLOAT_FIXED(-4.46694660528306e-06)}, 
-    {FLOAT_FIXED(-0.289717050234949), FLOAT_FIXED(-0.9571123396982), FLOAT_FIXED(-7.73387502629777e-07)}, 
-    {FLOAT_FIXED(0.289716714697281), FLOAT_FIXED(0.95711244126455), FLOAT_FIXED(-1.27546200015693e-06)}, 
-    {FLOAT_FIXED(0.28972268365382), FLOAT_FIXED(0.957110634449531), FLOAT_FIXED(-2.12660429112371e-07)}, 
-    {FLOAT_FIXED(0.289717185074997), FLOAT_FIXED(0.95711229887876), FLOAT_FIXED(2.68986586180881e-06)}, 
-    {FLOAT_FIXED(0.289719456184792), FLOAT_FIXED(0.957111611412083), FLOAT_FIXED(2.85550461480152e-06)}, 
-    {FLOAT_FIXED(-0.289720295787586), FLOAT_FIXED(-0.957111357266089), FLOAT_FIXED(-1.00927688084345e-06)}, 
-    {FLOAT_FIXED(0.289721009425687), FLOAT_FIXED(0.957111141244787), FLOAT_FIXED(-1.5690954537899e-06)}, 
-    {FLOAT_FIXED(0.289718868514058), FLOAT_FIXED(0.957111789301777), FLOAT_FIXED(2.54655572855809e-06)}, 
-    {FLOAT_FIXED(0.289715361112498), FLOAT_FIXED(0.957112850968387), FLOAT_FIXED(-6.8279217388747e-06)}, 
-    {FLOAT_FIXED(0.289724955955515), FLOAT_FIXED(0.957109946607843), FLOAT_FIXED(9.52630612890619e-07)}, 
-    {FLOAT_FIXED(5.89608486989134e-06), FLOAT_FIXED(0.966896549702904), FLOAT_FIXED(0.255168693490906)}, 
-    {FLOAT_FIXED(-0.289720158364259), FLOAT_FIXED(-0.957111398865006), FLOAT_FIXED(2.46046772115393e-07)}, 
-    {FLOAT_FIXED(-0.289719174356932), FLOAT_FIXED(-0.957111696725658), FLOAT_FIXED(-9.3274215667742e-07)}, 
-    {FLOAT_FIXED(0.289717245862829), FLOAT_FIXED(0.957112280465517), FLOAT_FIXED(-5.63514168220419e-06)}, 
-    {FLOAT_FIXED(-0.289720099902762), FLOAT_FIXED(-0.95711141656017), FLOAT_FIXED(1.58705605157222e-06)}, 
-    {FLOAT_FIXED(0.289718256088897), FLOAT_FIXED(0.957111974680252), FLOAT_FIXED(3.53225089804137e-06)}, 
-    {FLOAT_FIXED(0.289720798660886), FLOAT_FIXED(0.957111205045268), FLOAT_FIXED(-3.0658823463455e-07)}, 
-    {FLOAT_FIXED(-0.28971630980615), FLOAT_FIXED(-0.957112563822883), FLOAT_FIXED(2.1666410510915e-06)}, 
-    {FLOAT_FIXED(-0.289710836590893), FLOAT_FIXED(-0.957114220538955), FLOAT_FIXED(-1.97841401628512e-06)}, 
-    {FLOAT_FIXED(-0.289717949389871), FLOAT_FIXED(-0.957112067524236), FLOAT_FIXED(8.99769280479703e-07)}, 
-    {FLOAT_FIXED(-0.289720180342131), FLOAT_FIXED(-0.957111392198202), FLOAT_FIXED(-5.19068266050449e-06)}, 
-    {FLOAT_FIXED(-0.289715881553213), FLOAT_FIXED(-0.957112693456598), FLOAT_FIXED(3.17835529438443e-07)}, 
-    {FLOAT_FIXED(0.289713641801904), FLOAT_FIXED(0.957113371369601), FLOAT_FIXED(-9.96971187085812e-06)}, 
-    {FLOAT_FIXED(-2.43179481919889e-06), FLOAT_FIXED(0.966894892840332), FLOAT_FIXED(0.255174971722091)}, 
-    {FLOAT_FIXED(2.4466638138427e-06), FLOAT_FIXED(0.96689789742008), FLOAT_FIXED(0.255163586662835)}, 
-    {FLOAT_FIXED(-1.21259856212581e-07), FLOAT_FIXED(0.966895356984278), FLOAT_FIXED(0.255173213018589)}, 
-    {FLOAT_FIXED(1.8651163988063e-06), FLOAT_FIXED(0.966893478225658), FLOAT_FIXED(0.255180331846343)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.966900394431989), FLOAT_FIXED(0.25515412449589)}, 
-    {FLOAT_FIXED(-7.43205778622899e-07), FLOAT_FIXED(0.966895286736419), FLOAT_FIXED(0.255173479198655)}, 
-    {FLOAT_FIXED(1.7051166209352e-07), FLOAT_FIXED(0.966895080707705), FLOAT_FIXED(0.255174259875897)}, 
-    {FLOAT_FIXED(-9.27332114610586e-07), FLOAT_FIXED(0.966895593256843), FLOAT_FIXED(0.255172317737717)}, 
-    {FLOAT_FIXED(-5.89611068094169e-06), FLOAT_FIXED(0.966896549714172), FLOAT_FIXED(0.255168693448206)}, 
-    {FLOAT_FIXED(4.46467054879341e-06), FLOAT_FIXED(0.966894423824026), FLOAT_FIXED(0.25517674885865)}, 
-    {FLOAT_FIXED(3.77681136752232e-06), FLOAT_FIXED(0.96689563114071), FLOAT_FIXED(0.255172174162355)}, 
-    {FLOAT_FIXED(-5.78323896628829e-06), FLOAT_FIXED(0.966896637120906), FLOAT_FIXED(0.255168362245082)}, 
-    {FLOAT_FIXED(4.46471109530125e-06), FLOAT_FIXED(0.966894423819948), FLOAT_FIXED(0.255176748874102)}, 
-    {FLOAT_FIXED(1.26183847564927e-06), FLOAT_FIXED(0.966894374125554), FLOAT_FIXED(0.255176937207815)}, 
-    {FLOAT_FIXED(-2.89205447941169e-06), FLOAT_FIXED(0.966895392234676), FLOAT_FIXED(0.255173079432348)}, 
-    {FLOAT_FIXED(5.89611068094963e-06), FLOAT_FIXED(0.966896549714172), FLOAT_FIXED(0.255168693448206)}, 
-    {FLOAT_FIXED(5.37165009750579e-07), FLOAT_FIXED(0.966898094320017), FLOAT_FIXED(0.255162840554874)}, 
-    {FLOAT_FIXED(5.57880839809101e-06), FLOAT_FIXED(0.966892049984815), FLOAT_FIXED(0.255185743420434)}, 
-    {FLOAT_FIXED(5.27134017180132e-06), FLOAT_FIXED(0.966894695188693), FLOAT_FIXED(0.255175720608715)}, 
-    {FLOAT_FIXED(-9.27335945837235e-07), FLOAT_FIXED(0.966895593257509), FLOAT_FIXED(0.255172317735193)}, 
-    {FLOAT_FIXED(7.43200212049757e-07), FLOAT_FIXED(0.966895286737249), FLOAT_FIXED(0.255173479195509)}, 
-    {FLOAT_FIXED(-4.01646756200001e-06), FLOAT_FIXED(0.966895696235714), FLOAT_FIXED(0.255171927501285)}, 
-    {FLOAT_FIXED(-5.27134018158714e-06), FLOAT_FIXED(0.96689469518869), FLOAT_FIXED(0.255175720608728)}, 
-    {FLOAT_FIXED(-2.18394170187732e-06), FLOAT_FIXED(0.966895211907024), FLOAT_FIXED(0.2551737627314)}, 
-    {FLOAT_FIXED(-9.86169522477579e-07), FLOAT_FIXED(0.966894294206621), FLOAT_FIXED(0.255177240030745)}, 
-    {FLOAT_FIXED(-3.77683619391102e-06), FLOAT_FIXED(0.966895631147454), FLOAT_FIXED(0.255172174136803)}, 
-    {FLOAT_FIXED(-3.60910801040177e-07), FLOAT_FIXED(0.966894820494522), FLOAT_FIXED(0.255175245862007)}, 
-    {FLOAT_FIXED(1.07871994585921e-05), FLOAT_FIXED(0.966896871763624), FLOAT_FIXED(0.255167472961102)}, 
-    {FLOAT_FIXED(2.19757331319382e-06), FLOAT_FIXED(0.966896613900507), FLOAT_FIXED(0.255168450289028)}, 
-    {FLOAT_FIXED(3.77683619402229e-06), FLOAT_FIXED(0.966895631147454), FLOAT_FIXED(0.255172174136803)}, 
-    {FLOAT_FIXED(5.74809398332591e-06), FLOAT_FIXED(0.966896485093006), FLOAT_FIXED(0.255168938316851)}, 
-    {FLOAT_FIXED(-2.80201773950357e-06), FLOAT_FIXED(0.966894973495786), FLOAT_FIXED(0.255174666102911)}, 
-    {FLOAT_FIXED(-2.0523316910933e-06), FLOAT_FIXED(0.966896585297973), FLOAT_FIXED(0.255168558672317)}, 
-    {FLOAT_FIXED(-1.07872749382832e-05), FLOAT_FIXED(0.966896871781716), FLOAT_FIXED(0.255167472892541)}, 
-    {FLOAT_FIXED(-5.84482658945617e-06), FLOAT_FIXED(0.966894986713936), FLOAT_FIXED(0.255174615965805)}, 
-    {FLOAT_FIXED(-4.01643363142606e-06), FLOAT_FIXED(0.966895696226498), FLOAT_FIXED(0.255171927536207)}, 
-    {FLOAT_FIXED(-2.88959716720212e-07), FLOAT_FIXED(0.966897125653572), FLOAT_FIXED(0.25516651113102)}, 
-    {FLOAT_FIXED(5.18805972322457e-06), FLOAT_FIXED(0.966894098406175), FLOAT_FIXED(0.255177981887925)}, 
-    {FLOAT_FIXED(-4.52927229343004e-06), FLOAT_FIXED(0.966893200145573), FLOAT_FIXED(0.255181385472645)}, 
-    {FLOAT_FIXED(-2.13250139950697e-06), FLOAT_FIXED(0.966895649479649), FLOAT_FIXED(0.255172104691676)}, 
-    {FLOAT_FIXED(6.17303338674443e-06), FLOAT_FIXED(0.966896281993092), FLOAT_FIXED(0.255169707900111)}, 
-    {FLOAT_FIXED(2.43181455470283e-06), FLOAT_FIXED(0.966894892841021), FLOAT_FIXED(0.255174971719479)}, 
-    {FLOAT_FIXED(3.60907872048798e-07), FLOAT_FIXED(0.96689482049442), FLOAT_FIXED(0.255175245862395)}, 
-    {FLOAT_FIXED(-5.57882335277312e-06), FLOAT_FIXED(0.966892049971878), FLOAT_FIXED(0.255185743469449)}, 
-    {FLOAT_FIXED(-4.33234710255796e-06), FLOAT_FIXED(0.966894615382319), FLOAT_FIXED(0.255176023023144)}, 
-    {FLOAT_FIXED(4.29731494272546e-06), FLOAT_FIXED(0.966898011271821), FLOAT_FIXED(0.255163155216679)}, 
-    {FLOAT_FIXED(-1.7051166209352e-07), FLOAT_FIXED(0.966895080707705), FLOAT_FIXED(0.255174259875897)}, 
-    {FLOAT_FIXED(4.33234710258001e-06), FLOAT_FIXED(0.966894615382319), FLOAT_FIXED(0.255176023023144)}, 
-    {FLOAT_FIXED(0.187595007103766), FLOAT_FIXED(-0.794657472776565), FLOAT_FIXED(-0.577345316314336)}, 
-    {FLOAT_FIXED(0.187602662768244), FLOAT_FIXED(-0.794703331978153), FLOAT_FIXED(-0.577279702626972)}, 
-    {FLOAT_FIXED(0.187607044304441), FLOAT_FIXED(-0.794658266054073), FLOAT_FIXED(-0.577340313090369)}, 
-    {FLOAT_FIXED(-0.491119721822953), FLOAT_FIXED(-0.794656289932677), FLOAT_FIXED(-0.356823205112809)}, 
-    {FLOAT_FIXED(-0.491118546863726), FLOAT_FIXED(-0.794656914929528), FLOAT_FIXED(-0.356823430398212)}, 
-    {FLOAT_FIXED(-0.491113767161194), FLOAT_FIXED(-0.794658451324711), FLOAT_FIXED(-0.356826587354352)}, 
-    {FLOAT_FIXED(-0.491113705135855), FLOAT_FIXED(-0.794658361945531), FLOAT_FIXED(0.356826871770859)}, 
-    {FLOAT_FIXED(-0.491111916307385), FLOAT_FIXED(-0.794664846197301), FLOAT_FIXED(0.356814893017525)}, 
-    {FLOAT_FIXED(-0.491128838751515), FLOAT_FIXED(-0.794658159886055), FLOAT_FIXED(0.356806491915572)}, 
-    {FLOAT_FIXED(0.607061232854626), FLOAT_FIXED(-0.79465505696813), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.607056574533442), FLOAT_FIXED(-0.794658615380568), FLOAT_FIXED(1.78090723231038e-05)}, 
-    {FLOAT_FIXED(0.607058465725051), FLOAT_FIXED(-0.794657170847728), FLOAT_FIXED(-3.4398502688321e-06)}, 
-    {FLOAT_FIXED(0.187595771425782), FLOAT_FIXED(-0.794659358687747), FLOAT_FIXED(0.57734247218886)}, 
-    {FLOAT_FIXED(0.187623477067569), FLOAT_FIXED(-0.794630547712075), FLOAT_FIXED(0.57737312328847)}, 
-    {FLOAT_FIXED(0.18759896313112), FLOAT_FIXED(-0.794659637898686), FLOAT_FIXED(0.577341050789616)}, 
-    {FLOAT_FIXED(0.94822773176745), FLOAT_FIXED(0.0770608907260883), FLOAT_FIXED(0.308100288587431)}, 
-    {FLOAT_FIXED(-8.34893096750154e-05), FLOAT_FIXED(0.0770796348740705), FLOAT_FIXED(0.997024935955573)}, 
-    {FLOAT_FIXED(-8.66839520019863e-07), FLOAT_FIXED(0.0770602996399545), FLOAT_FIXED(0.997026434062131)}, 
-    {FLOAT_FIXED(-7.51353596146262e-07), FLOAT_FIXED(0.0770618302928183), FLOAT_FIXED(0.997026315756689)}, 
-    {FLOAT_FIXED(-9.80564617616554e-18), FLOAT_FIXED(0.0770699333895151), FLOAT_FIXED(0.99702568942196)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-6.62999731121728e-07), FLOAT_FIXED(0.0770611218036493), FLOAT_FIXED(0.99702637051681)}, 
-    {FLOAT_FIXED(-4.90121230056271e-07), FLOAT_FIXED(0.0770617609923512), FLOAT_FIXED(0.997026321113198)}, 
-    {FLOAT_FIXED(-3.63676059012141e-07), FLOAT_FIXED(0.0770611385120996), FLOAT_FIXED(0.997026369225552)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(-1), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(1.87522570965939e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-0.586035826985261), FLOAT_FIXED(0.0770601397149179), FLOAT_FIXED(-0.806612511901978)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770611588127345), FLOAT_FIXED(0.997026367656562)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.41642126752706e-07), FLOAT_FIXED(0.0770611397420483), FLOAT_FIXED(0.997026369130496)}, 
-    {FLOAT_FIXED(-8.66856810626772e-07), FLOAT_FIXED(0.0770618367403272), FLOAT_FIXED(0.997026315258256)}, 
-    {FLOAT_FIXED(-4.17533211607314e-07), FLOAT_FIXED(0.0770611821231092), FLOAT_FIXED(0.997026365854793)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514624), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(2.20413934753777e-05), FLOAT_FIXED(0.0770680111005933), FLOAT_FIXED(0.9970258377691)}, 
-    {FLOAT_FIXED(8.31546445882456e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.88753405487766e-07), FLOAT_FIXED(0.0770618100520961), FLOAT_FIXED(0.997026317321335)}, 
-    {FLOAT_FIXED(-0.948231982751245), FLOAT_FIXED(0.0770599353982169), FLOAT_FIXED(0.308087444151925)}, 
-    {FLOAT_FIXED(-4.90124695322875e-07), FLOAT_FIXED(0.077061815710749), FLOAT_FIXED(0.997026316883924)}, 
-    {FLOAT_FIXED(9.27296477630439e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-0.586039421259818), FLOAT_FIXED(0.0770602062711088), FLOAT_FIXED(-0.806609894148907)}, 
-    {FLOAT_FIXED(-0.586038650734455), FLOAT_FIXED(0.0770641202148285), FLOAT_FIXED(-0.806610080039206)}, 
-    {FLOAT_FIXED(-0.586035853892933), FLOAT_FIXED(0.0770645581839486), FLOAT_FIXED(-0.806612070219566)}, 
-    {FLOAT_FIXED(-0.586035525927689), FLOAT_FIXED(0.0770645354850064), FLOAT_FIXED(-0.80661231066798)}, 
-    {FLOAT_FIXED(-0.586037120874028), FLOAT_FIXED(0.0770694484608404), FLOAT_FIXED(-0.80661068246808)}, 
-    {FLOAT_FIXED(-0.586031580880631), FLOAT_FIXED(0.0770570207209854), FLOAT_FIXED(-0.80661589481497)}, 
-    {FLOAT_FIXED(-0.586038460747402), FLOAT_FIXED(0.0770641070656919), FLOAT_FIXED(-0.806610219329623)}, 
-    {FLOAT_FIXED(-0.586038548044061), FLOAT_FIXED(0.0770629370593445), FLOAT_FIXED(-0.806610267687064)}, 
-    {FLOAT_FIXED(-0.586039230973139), FLOAT_FIXED(0.0770695945207484), FLOAT_FIXED(-0.806609135431046)}, 
-    {FLOAT_FIXED(-0.58603779999286), FLOAT_FIXED(0.0770580826772662), FLOAT_FIXED(-0.806611274948244)}, 
-    {FLOAT_FIXED(-0.586054254674581), FLOAT_FIXED(0.0770740064107774), FLOAT_FIXED(-0.80659779823256)}, 
-    {FLOAT_FIXED(-0.586033504968724), FLOAT_FIXED(0.0770637640720715), FLOAT_FIXED(-0.806613852671225)}, 
-    {FLOAT_FIXED(1.22828132550488e-05), FLOAT_FIXED(0.0770607879377224), FLOAT_FIXED(0.997026396246133)}, 
-    {FLOAT_FIXED(-0.586038456386949), FLOAT_FIXED(0.0770581281111118), FLOAT_FIXED(-0.806610793708846)}, 
-    {FLOAT_FIXED(-0.586037317252795), FLOAT_FIXED(0.0770646594650938), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(-0.586039308342894), FLOAT_FIXED(0.0770602140379245), FLOAT_FIXED(-0.806609975446257)}, 
-    {FLOAT_FIXED(-0.586037513605962), FLOAT_FIXED(0.0770603374858212), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(0.586035790947893), FLOAT_FIXED(0.0770609329651742), FLOAT_FIXED(-0.806612462300586)}, 
-    {FLOAT_FIXED(-0.586039211239122), FLOAT_FIXED(0.0770623514410284), FLOAT_FIXED(-0.806609841795032)}, 
-    {FLOAT_FIXED(-0.586037912732535), FLOAT_FIXED(0.0770596824729757), FLOAT_FIXED(-0.806611040202933)}, 
-    {FLOAT_FIXED(-0.586039358876135), FLOAT_FIXED(0.0770667794348354), FLOAT_FIXED(-0.806609311473399)}, 
-    {FLOAT_FIXED(-0.586035216931458), FLOAT_FIXED(0.0770670643548385), FLOAT_FIXED(-0.806612293551137)}, 
-    {FLOAT_FIXED(-0.586035516304495), FLOAT_FIXED(0.0770604748660944), FLOAT_FIXED(-0.806612705604825)}, 
-    {FLOAT_FIXED(-0.586039812422853), FLOAT_FIXED(0.0770667482356502), FLOAT_FIXED(-0.806608984931218)}, 
-    {FLOAT_FIXED(-0.586036146656821), FLOAT_FIXED(0.0770604315086832), FLOAT_FIXED(-0.806612251771147)}, 
-    {FLOAT_FIXED(-0.58603296821051), FLOAT_FIXED(0.0770606501304624), FLOAT_FIXED(-0.806614540144083)}, 
-    {FLOAT_FIXED(-0.586037000973475), FLOAT_FIXED(0.0770669416328467), FLOAT_FIXED(-0.806611009097554)}, 
-    {FLOAT_FIXED(-0.948206065224237), FLOAT_FIXED(0.0770526804941516), FLOAT_FIXED(0.308169015802426)}, 
-    {FLOAT_FIXED(-0.586039001473931), FLOAT_FIXED(0.07706023514542), FLOAT_FIXED(-0.806610196384084)}, 
-    {FLOAT_FIXED(-0.586033787269207), FLOAT_FIXED(0.0770605937936544), FLOAT_FIXED(-0.806613950451565)}, 
-    {FLOAT_FIXED(-0.586037545573471), FLOAT_FIXED(0.0770677639697597), FLOAT_FIXED(-0.80661053485243)}, 
-    {FLOAT_FIXED(0.586041174556692), FLOAT_FIXED(0.0770533526445697), FLOAT_FIXED(-0.806609275033733)}, 
-    {FLOAT_FIXED(0.58603942125982), FLOAT_FIXED(0.0770602062711081), FLOAT_FIXED(-0.806609894148906)}, 
-    {FLOAT_FIXED(0.586035711037962), FLOAT_FIXED(0.0770604614717848), FLOAT_FIXED(-0.806612565402986)}, 
-    {FLOAT_FIXED(0.586037581157919), FLOAT_FIXED(0.0770603328393863), FLOAT_FIXED(-0.806611218973093)}, 
-    {FLOAT_FIXED(0.586038826716069), FLOAT_FIXED(0.077060247165855), FLOAT_FIXED(-0.806610322205209)}, 
-    {FLOAT_FIXED(0.586037534876954), FLOAT_FIXED(0.0770603360227357), FLOAT_FIXED(-0.806611252294069)}, 
-    {FLOAT_FIXED(0.586037698134945), FLOAT_FIXED(0.0770603247933402), FLOAT_FIXED(-0.806611134752949)}, 
-    {FLOAT_FIXED(0.586035852541243), FLOAT_FIXED(0.077060451738791), FLOAT_FIXED(-0.806612463525126)}, 
-    {FLOAT_FIXED(0.586033729888184), FLOAT_FIXED(0.0770671666462288), FLOAT_FIXED(-0.806613364170508)}, 
-    {FLOAT_FIXED(0.586037513605962), FLOAT_FIXED(0.0770603374858211), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(0.586035216931459), FLOAT_FIXED(0.0770670643548385), FLOAT_FIXED(-0.806612293551137)}, 
-    {FLOAT_FIXED(0.586040031007674), FLOAT_FIXED(0.0770601643305067), FLOAT_FIXED(-0.806609455145351)}, 
-    {FLOAT_FIXED(0.586037984828752), FLOAT_FIXED(0.0770580954711151), FLOAT_FIXED(-0.806611139434747)}, 
-    {FLOAT_FIXED(-0.948228922857829), FLOAT_FIXED(0.0770594006105909), FLOAT_FIXED(0.308096995495602)}, 
-    {FLOAT_FIXED(0.586038370384801), FLOAT_FIXED(0.0770668474323897), FLOAT_FIXED(-0.806610023160858)}, 
-    {FLOAT_FIXED(0.586039308342894), FLOAT_FIXED(0.0770602140379245), FLOAT_FIXED(-0.806609975446257)}, 
-    {FLOAT_FIXED(0.586035308385518), FLOAT_FIXED(0.0770693230011738), FLOAT_FIXED(-0.806612011302604)}, 
-    {FLOAT_FIXED(0.586036931541), FLOAT_FIXED(0.0770628251560773), FLOAT_FIXED(-0.806611452837717)}, 
-    {FLOAT_FIXED(0.586034092647327), FLOAT_FIXED(0.0770644362855612), FLOAT_FIXED(-0.806613361478108)}, 
-    {FLOAT_FIXED(0.586035965944908), FLOAT_FIXED(0.0770579557292394), FLOAT_FIXED(-0.806612619587525)}, 
-    {FLOAT_FIXED(0.586037404736196), FLOAT_FIXED(0.0770580553186448), FLOAT_FIXED(-0.806611564732724)}, 
-    {FLOAT_FIXED(0.586037001641769), FLOAT_FIXED(0.0770646376212315), FLOAT_FIXED(-0.80661122874346)}, 
-    {FLOAT_FIXED(0.586039747857301), FLOAT_FIXED(0.0770582175031673), FLOAT_FIXED(-0.806609846856946)}, 
-    {FLOAT_FIXED(0.586039182637767), FLOAT_FIXED(0.0770629809893844), FLOAT_FIXED(-0.806609802428837)}, 
-    {FLOAT_FIXED(0.586036683321521), FLOAT_FIXED(0.0770580053842046), FLOAT_FIXED(-0.806612093640877)}, 
-    {FLOAT_FIXED(0.586035143525229), FLOAT_FIXED(0.0770686800100846), FLOAT_FIXED(-0.806612192515627)}, 
-    {FLOAT_FIXED(0.586035184520511), FLOAT_FIXED(0.0770645118557233), FLOAT_FIXED(-0.806612560971158)}, 
-    {FLOAT_FIXED(-0.948226278094412), FLOAT_FIXED(0.0770644361722391), FLOAT_FIXED(0.308103875679411)}, 
-    {FLOAT_FIXED(0.586037317252795), FLOAT_FIXED(0.0770646594650928), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(0.948235350637797), FLOAT_FIXED(0.0770563210264299), FLOAT_FIXED(0.308077982320526)}, 
-    {FLOAT_FIXED(0.948228497956322), FLOAT_FIXED(0.0770604434904797), FLOAT_FIXED(0.308098042370522)}, 
-    {FLOAT_FIXED(0.94822679494652), FLOAT_FIXED(0.0770604364547752), FLOAT_FIXED(0.308103285407428)}, 
-    {FLOAT_FIXED(0.948227632011351), FLOAT_FIXED(0.0770685533823765), FLOAT_FIXED(0.308098678948309)}, 
-    {FLOAT_FIXED(0.948228656097089), FLOAT_FIXED(0.0770607259389273), FLOAT_FIXED(0.308097485017443)}, 
-    {FLOAT_FIXED(0.948227544218525), FLOAT_FIXED(0.077060924161576), FLOAT_FIXED(0.308100857435792)}, 
-    {FLOAT_FIXED(0.948229150564704), FLOAT_FIXED(0.0770606377856018), FLOAT_FIXED(0.308095985243912)}, 
-    {FLOAT_FIXED(0.948229427341776), FLOAT_FIXED(0.0770630723856119), FLOAT_FIXED(0.308094524452443)}, 
-    {FLOAT_FIXED(0.94822762701833), FLOAT_FIXED(0.0770627720886231), FLOAT_FIXED(0.30810014040439)}, 
-    {FLOAT_FIXED(0.948228869083815), FLOAT_FIXED(0.0770584343518479), FLOAT_FIXED(0.308097402668816)}, 
-    {FLOAT_FIXED(0.948228382414192), FLOAT_FIXED(0.077058345247941), FLOAT_FIXED(0.308098922769641)}, 
-    {FLOAT_FIXED(0.948228185339957), FLOAT_FIXED(0.077060860005154), FLOAT_FIXED(0.308098900326109)}, 
-    {FLOAT_FIXED(0.948229964251685), FLOAT_FIXED(0.0770598714423841), FLOAT_FIXED(0.308093672620083)}, 
-    {FLOAT_FIXED(0.948228825135335), FLOAT_FIXED(0.0770584263053507), FLOAT_FIXED(0.308097539941176)}, 
-    {FLOAT_FIXED(0.948228601842607), FLOAT_FIXED(0.0770609362514799), FLOAT_FIXED(0.308097599392886)}, 
-    {FLOAT_FIXED(0.94822682896203), FLOAT_FIXED(0.077059973703148), FLOAT_FIXED(0.308103296459942)}, 
-    {FLOAT_FIXED(0.948228451074871), FLOAT_FIXED(0.0770601412092903), FLOAT_FIXED(0.308098262262148)}, 
-    {FLOAT_FIXED(0.948228533945077), FLOAT_FIXED(0.077058372991569), FLOAT_FIXED(0.308098449467474)}, 
-    {FLOAT_FIXED(0.948228776934847), FLOAT_FIXED(0.0770600831159469), FLOAT_FIXED(0.308097273897073)}, 
-    {FLOAT_FIXED(0.948229169698419), FLOAT_FIXED(0.077058489391231), FLOAT_FIXED(0.30809646370218)}, 
-    {FLOAT_FIXED(0.948229009934269), FLOAT_FIXED(0.0770606628571563), FLOAT_FIXED(0.308096411791976)}, 
-    {FLOAT_FIXED(0.948229264871075), FLOAT_FIXED(0.0770610576279951), FLOAT_FIXED(0.308095528431225)}, 
-    {FLOAT_FIXED(0.948229167906046), FLOAT_FIXED(0.077060401873179), FLOAT_FIXED(0.308095990878413)}, 
-    {FLOAT_FIXED(0.9482289310967), FLOAT_FIXED(0.0770609965259308), FLOAT_FIXED(0.308096570973517)}, 
-    {FLOAT_FIXED(0.948227740018164), FLOAT_FIXED(0.0770607784833019), FLOAT_FIXED(0.308100291268271)}, 
-    {FLOAT_FIXED(0.948227755734725), FLOAT_FIXED(0.0770607813604161), FLOAT_FIXED(0.308100242178431)}, 
-    {FLOAT_FIXED(-0.586027917028897), FLOAT_FIXED(0.0770573986019768), FLOAT_FIXED(-0.806618520605291)}, 
-    {FLOAT_FIXED(0.948227713783952), FLOAT_FIXED(0.0770608939321188), FLOAT_FIXED(0.308100343132628)}, 
-    {FLOAT_FIXED(-0.948229306642909), FLOAT_FIXED(0.077058514464363), FLOAT_FIXED(0.308096035956409)}, 
-    {FLOAT_FIXED(-0.948229327466006), FLOAT_FIXED(0.0770610690868848), FLOAT_FIXED(0.308095332915889)}, 
-    {FLOAT_FIXED(-0.948229054804782), FLOAT_FIXED(0.0770603811685878), FLOAT_FIXED(0.308096344149329)}, 
-    {FLOAT_FIXED(-0.948226824250743), FLOAT_FIXED(0.0770684614701742), FLOAT_FIXED(0.308101187952873)}, 
-    {FLOAT_FIXED(-0.94822864012236), FLOAT_FIXED(0.0770609432591051), FLOAT_FIXED(0.308097479826949)}, 
-    {FLOAT_FIXED(-0.948227702871824), FLOAT_FIXED(0.0770607716831989), FLOAT_FIXED(0.30810040729284)}, 
-    {FLOAT_FIXED(-6.04010188027858e-06), FLOAT_FIXED(0.0770614511602988), FLOAT_FIXED(0.99702634504239)}, 
-    {FLOAT_FIXED(-0.948228833127992), FLOAT_FIXED(0.077057789785212), FLOAT_FIXED(0.308097674541929)}, 
-    {FLOAT_FIXED(-0.948227740018163), FLOAT_FIXED(0.0770607784833024), FLOAT_FIXED(0.308100291268271)}, 
-    {FLOAT_FIXED(-0.948230071846909), FLOAT_FIXED(0.0770586545657286), FLOAT_FIXED(0.308093645831468)}, 
-    {FLOAT_FIXED(-0.948227514818216), FLOAT_FIXED(0.0770581864011799), FLOAT_FIXED(0.308101632664015)}, 
-    {FLOAT_FIXED(-0.948228943044634), FLOAT_FIXED(0.0770662985557502), FLOAT_FIXED(0.308095208011051)}, 
-    {FLOAT_FIXED(-0.948229217793405), FLOAT_FIXED(0.0770682706832761), FLOAT_FIXED(0.308093869099656)}, 
-    {FLOAT_FIXED(-0.948228362394027), FLOAT_FIXED(0.0770577035997053), FLOAT_FIXED(0.308099144866523)}, 
-    {FLOAT_FIXED(-0.948227790648312), FLOAT_FIXED(0.0770660875544631), FLOAT_FIXED(0.308098807513546)}, 
-    {FLOAT_FIXED(-0.948228086648561), FLOAT_FIXED(0.0770684723343519), FLOAT_FIXED(0.308097299992809)}, 
-    {FLOAT_FIXED(-0.948228616787069), FLOAT_FIXED(0.077060732947062), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(-0.948227693621358), FLOAT_FIXED(0.0770608975266307), FLOAT_FIXED(0.308100404287157)}, 
-    {FLOAT_FIXED(-0.94822838545429), FLOAT_FIXED(0.0770684190660701), FLOAT_FIXED(0.30809639368452)}, 
-    {FLOAT_FIXED(-0.948229248885969), FLOAT_FIXED(0.0770644427005066), FLOAT_FIXED(0.308094730932568)}, 
-    {FLOAT_FIXED(-0.948229612358243), FLOAT_FIXED(0.0770605554568311), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(-0.948230089823033), FLOAT_FIXED(0.0770604703336185), FLOAT_FIXED(0.308093136350299)}, 
-    {FLOAT_FIXED(-0.948228109824688), FLOAT_FIXED(0.0770608233272551), FLOAT_FIXED(0.308099141911213)}, 
-    {FLOAT_FIXED(-0.94822581899609), FLOAT_FIXED(0.0770688765828326), FLOAT_FIXED(0.308104177919507)}, 
-    {FLOAT_FIXED(-0.948227778042729), FLOAT_FIXED(0.0770602611946045), FLOAT_FIXED(0.308100303623298)}, 
-    {FLOAT_FIXED(-0.948228895679848), FLOAT_FIXED(0.0770625458850892), FLOAT_FIXED(0.308096292446832)}, 
-    {FLOAT_FIXED(-0.948228357069324), FLOAT_FIXED(0.0770607792490791), FLOAT_FIXED(0.308098391996998)}, 
-    {FLOAT_FIXED(-0.948228168084577), FLOAT_FIXED(0.0770601916597383), FLOAT_FIXED(0.308099120596492)}, 
-    {FLOAT_FIXED(-0.586035337031672), FLOAT_FIXED(0.0770634578521071), FLOAT_FIXED(-0.806612550865687)}, 
-    {FLOAT_FIXED(-0.948228066963593), FLOAT_FIXED(0.0770617225043024), FLOAT_FIXED(0.30809904892284)}, 
-    {FLOAT_FIXED(-0.586048310130909), FLOAT_FIXED(0.0770581714872403), FLOAT_FIXED(-0.806603630291699)}, 
-    {FLOAT_FIXED(0.586040267101519), FLOAT_FIXED(0.0770636440758804), FLOAT_FIXED(-0.806608951163652)}, 
-    {FLOAT_FIXED(0.586037313337477), FLOAT_FIXED(0.0770574401519373), FLOAT_FIXED(-0.806611689906254)}, 
-    {FLOAT_FIXED(0.586035660669782), FLOAT_FIXED(0.0770637493853883), FLOAT_FIXED(-0.806612287876894)}, 
-    {FLOAT_FIXED(0.586014860463473), FLOAT_FIXED(0.0770552286602096), FLOAT_FIXED(-0.806628213647464)}, 
-    {FLOAT_FIXED(0.948230499938022), FLOAT_FIXED(0.0770612837252703), FLOAT_FIXED(0.308091670672711)}, 
-    {FLOAT_FIXED(0.948229258495688), FLOAT_FIXED(0.0770645200683208), FLOAT_FIXED(0.308094682004344)}, 
-    {FLOAT_FIXED(0.948229058908404), FLOAT_FIXED(0.0770606541260661), FLOAT_FIXED(0.308096263247942)}, 
-    {FLOAT_FIXED(0.948228150115687), FLOAT_FIXED(0.0770642353858761), FLOAT_FIXED(0.308098164474528)}, 
-    {FLOAT_FIXED(0.948232069663905), FLOAT_FIXED(0.0770593977423706), FLOAT_FIXED(0.308087311131911)}, 
-    {FLOAT_FIXED(0.948229899260082), FLOAT_FIXED(0.0770550092147134), FLOAT_FIXED(0.308095088737448)}, 
-    {FLOAT_FIXED(0.948228350424589), FLOAT_FIXED(0.0770615104559558), FLOAT_FIXED(0.30809822955887)}, 
-    {FLOAT_FIXED(0.58603044019657), FLOAT_FIXED(0.0770625858286389), FLOAT_FIXED(-0.80661619189576)}, 
-    {FLOAT_FIXED(0.58603070661915), FLOAT_FIXED(0.0770567212462394), FLOAT_FIXED(-0.806616558601569)}, 
-    {FLOAT_FIXED(0.5860369891744), FLOAT_FIXED(0.0770645740928417), FLOAT_FIXED(-0.806611243871106)}, 
-    {FLOAT_FIXED(-0.948225806322804), FLOAT_FIXED(0.0770658494427938), FLOAT_FIXED(0.30810497411293)}, 
-    {FLOAT_FIXED(-0.948225856428022), FLOAT_FIXED(0.0770651678513643), FLOAT_FIXED(0.308104990393511)}, 
-    {FLOAT_FIXED(-0.948228319399078), FLOAT_FIXED(0.0770619325221309), FLOAT_FIXED(0.308098219478066)}, 
-    {FLOAT_FIXED(-0.948228357069324), FLOAT_FIXED(0.0770607792490794), FLOAT_FIXED(0.308098391996998)}, 
-    {FLOAT_FIXED(-0.94822640280012), FLOAT_FIXED(0.0770611276472674), FLOAT_FIXED(0.308104319408989)}, 
-    {FLOAT_FIXED(-0.948228357069324), FLOAT_FIXED(0.0770607792490795), FLOAT_FIXED(0.308098391996998)}, 
-    {FLOAT_FIXED(-0.948228357069324), FLOAT_FIXED(0.0770607792490788), FLOAT_FIXED(0.308098391996998)}, 
-    {FLOAT_FIXED(-0.948229297660478), FLOAT_FIXED(0.0770606115613557), FLOAT_FIXED(0.30809553908505)}, 
-    {FLOAT_FIXED(-0.948224657416537), FLOAT_FIXED(0.0770690836495694), FLOAT_FIXED(0.308107700995457)}, 
-    {FLOAT_FIXED(-0.948229777084828), FLOAT_FIXED(0.0770605260891677), FLOAT_FIXED(0.308094084929456)}, 
-    {FLOAT_FIXED(-0.948226748671078), FLOAT_FIXED(0.0770610659876723), FLOAT_FIXED(0.308103270371346)}, 
-    {FLOAT_FIXED(-0.948229034419425), FLOAT_FIXED(0.0770606584919521), FLOAT_FIXED(0.308096337525767)}, 
-    {FLOAT_FIXED(-0.948228064105553), FLOAT_FIXED(0.0770602101966779), FLOAT_FIXED(0.30809943597332)}, 
-    {FLOAT_FIXED(-0.948228064105553), FLOAT_FIXED(0.0770602101966775), FLOAT_FIXED(0.30809943597332)}, 
-    {FLOAT_FIXED(-0.948228717837112), FLOAT_FIXED(0.0770683598117147), FLOAT_FIXED(0.308095385530065)}, 
-    {FLOAT_FIXED(-0.948228942967753), FLOAT_FIXED(0.0770606747959095), FLOAT_FIXED(0.308096614908791)}, 
-    {FLOAT_FIXED(-0.948229150564704), FLOAT_FIXED(0.077060637785602), FLOAT_FIXED(0.308095985243912)}, 
-    {FLOAT_FIXED(-0.948229196839748), FLOAT_FIXED(0.0770600082561609), FLOAT_FIXED(0.30809600027947)}, 
-    {FLOAT_FIXED(-0.94822886176775), FLOAT_FIXED(0.0770606892721861), FLOAT_FIXED(0.308096861197143)}, 
-    {FLOAT_FIXED(-0.948228292319246), FLOAT_FIXED(0.0770684356693361), FLOAT_FIXED(0.308096676172932)}, 
-    {FLOAT_FIXED(-0.948227703660994), FLOAT_FIXED(0.0770602744549948), FLOAT_FIXED(0.308100529228236)}, 
-    {FLOAT_FIXED(-0.948228047994778), FLOAT_FIXED(0.0770608343501178), FLOAT_FIXED(0.308099329446328)}, 
-    {FLOAT_FIXED(-0.948227587881954), FLOAT_FIXED(0.077060916377438), FLOAT_FIXED(0.308100725001809)}, 
-    {FLOAT_FIXED(-0.948226974769867), FLOAT_FIXED(0.0770686705476795), FLOAT_FIXED(0.308100672408874)}, 
-    {FLOAT_FIXED(-0.948227376142621), FLOAT_FIXED(0.0770609541254137), FLOAT_FIXED(0.308101367220207)}, 
-    {FLOAT_FIXED(-0.948228954902784), FLOAT_FIXED(0.0770606726681394), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(-0.948228954902784), FLOAT_FIXED(0.0770606726681395), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(-0.948228582240323), FLOAT_FIXED(0.077060739106004), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(-0.948228582240323), FLOAT_FIXED(0.0770607391060038), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(-0.94822852154171), FLOAT_FIXED(0.0770601286466957), FLOAT_FIXED(0.308098048529649)}, 
-    {FLOAT_FIXED(-0.948228616787069), FLOAT_FIXED(0.0770607329470619), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(-0.948228616787069), FLOAT_FIXED(0.0770607329470617), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(-0.948227599978475), FLOAT_FIXED(0.0770685590928476), FLOAT_FIXED(0.308098776106646)}, 
-    {FLOAT_FIXED(-0.94822865609709), FLOAT_FIXED(0.0770607259389266), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(-0.948228360078863), FLOAT_FIXED(0.0770583411585916), FLOAT_FIXED(0.308098992533301)}, 
-    {FLOAT_FIXED(-0.948228360078864), FLOAT_FIXED(0.0770583411585921), FLOAT_FIXED(0.308098992533301)}, 
-    {FLOAT_FIXED(-0.948228094029473), FLOAT_FIXED(0.0770602052872762), FLOAT_FIXED(0.3080993451053)}, 
-    {FLOAT_FIXED(-0.948228441686488), FLOAT_FIXED(0.0770602689299039), FLOAT_FIXED(0.308098259211675)}, 
-    {FLOAT_FIXED(-0.948229234119083), FLOAT_FIXED(0.0770604139943034), FLOAT_FIXED(0.3080957840623)}, 
-    {FLOAT_FIXED(-0.948225328026513), FLOAT_FIXED(0.0770577860284602), FLOAT_FIXED(0.308108462885074)}, 
-    {FLOAT_FIXED(-0.948229217793405), FLOAT_FIXED(0.0770682706832762), FLOAT_FIXED(0.308093869099656)}, 
-    {FLOAT_FIXED(-0.948229217793405), FLOAT_FIXED(0.0770682706832756), FLOAT_FIXED(0.308093869099656)}, 
-    {FLOAT_FIXED(-0.948228178523442), FLOAT_FIXED(0.0770608110798229), FLOAT_FIXED(0.308098933542192)}, 
-    {FLOAT_FIXED(-0.948228231615221), FLOAT_FIXED(0.0770602304739196), FLOAT_FIXED(0.308098915361897)}, 
-    {FLOAT_FIXED(-0.948228047847239), FLOAT_FIXED(0.0770608348353309), FLOAT_FIXED(0.308099329779044)}, 
-    {FLOAT_FIXED(-0.9482289310967), FLOAT_FIXED(0.0770609965259304), FLOAT_FIXED(0.308096570973517)}, 
-    {FLOAT_FIXED(-0.948227722505986), FLOAT_FIXED(0.0770607752774783), FLOAT_FIXED(0.308100345966612)}, 
-    {FLOAT_FIXED(-0.948228546676833), FLOAT_FIXED(0.0770662259815025), FLOAT_FIXED(0.308096446068613)}, 
-    {FLOAT_FIXED(-0.948228382414192), FLOAT_FIXED(0.0770583452479414), FLOAT_FIXED(0.308098922769642)}, 
-    {FLOAT_FIXED(-0.948228428686445), FLOAT_FIXED(0.0770577157370049), FLOAT_FIXED(0.308098937804449)}, 
-    {FLOAT_FIXED(-0.94822759990369), FLOAT_FIXED(0.0770607528335974), FLOAT_FIXED(0.308100728907945)}, 
-    {FLOAT_FIXED(-0.948229254768081), FLOAT_FIXED(0.0770610557784988), FLOAT_FIXED(0.308095559987926)}, 
-    {FLOAT_FIXED(-0.948227740018164), FLOAT_FIXED(0.0770607784833025), FLOAT_FIXED(0.308100291268271)}, 
-    {FLOAT_FIXED(-0.948228313848476), FLOAT_FIXED(0.0770687341729088), FLOAT_FIXED(0.308096535243521)}, 
-    {FLOAT_FIXED(-0.948228217423989), FLOAT_FIXED(0.0770661656960104), FLOAT_FIXED(0.308097474487929)}, 
-    {FLOAT_FIXED(-0.948228601842607), FLOAT_FIXED(0.07706093625148), FLOAT_FIXED(0.308097599392886)}, 
-    {FLOAT_FIXED(-0.948227894569907), FLOAT_FIXED(0.0770686574147628), FLOAT_FIXED(0.308097844854206)}, 
-    {FLOAT_FIXED(-0.948228415234875), FLOAT_FIXED(0.0770687527339422), FLOAT_FIXED(0.308096218563603)}, 
-    {FLOAT_FIXED(-0.948228984685871), FLOAT_FIXED(0.0770610063361691), FLOAT_FIXED(0.308096403588325)}, 
-    {FLOAT_FIXED(-0.948228351220898), FLOAT_FIXED(0.0770583395367972), FLOAT_FIXED(0.30809902020086)}, 
-    {FLOAT_FIXED(-0.948228351220897), FLOAT_FIXED(0.0770583395367972), FLOAT_FIXED(0.30809902020086)}, 
-    {FLOAT_FIXED(-0.948228351220898), FLOAT_FIXED(0.077058339536797), FLOAT_FIXED(0.30809902020086)}, 
-    {FLOAT_FIXED(-0.948226987937262), FLOAT_FIXED(0.0770684914363808), FLOAT_FIXED(0.308100676687262)}, 
-    {FLOAT_FIXED(-0.94822957132091), FLOAT_FIXED(0.0770611137280225), FLOAT_FIXED(0.308094571233508)}, 
-    {FLOAT_FIXED(-0.94822957132091), FLOAT_FIXED(0.077061113728022), FLOAT_FIXED(0.308094571233508)}, 
-    {FLOAT_FIXED(-0.948226940603604), FLOAT_FIXED(0.077065931913993), FLOAT_FIXED(0.308101462592692)}, 
-    {FLOAT_FIXED(-0.948226755564677), FLOAT_FIXED(0.0770684488957764), FLOAT_FIXED(0.308101402489644)}, 
-    {FLOAT_FIXED(-0.948229008529297), FLOAT_FIXED(0.0770610107010392), FLOAT_FIXED(0.308096329113608)}, 
-    {FLOAT_FIXED(-0.948227681897687), FLOAT_FIXED(0.0770601298419611), FLOAT_FIXED(0.308100632377927)}, 
-    {FLOAT_FIXED(-0.948227635622571), FLOAT_FIXED(0.0770607593723834), FLOAT_FIXED(0.308100617342095)}, 
-    {FLOAT_FIXED(-0.948228370353497), FLOAT_FIXED(0.0770583430397626), FLOAT_FIXED(0.308098960440825)}, 
-    {FLOAT_FIXED(-0.948229104492901), FLOAT_FIXED(0.0770584774527767), FLOAT_FIXED(0.308096667371216)}, 
-    {FLOAT_FIXED(-0.948226047499632), FLOAT_FIXED(0.0770657683903201), FLOAT_FIXED(0.308104252138193)}, 
-    {FLOAT_FIXED(-0.948229306642909), FLOAT_FIXED(0.0770585144643626), FLOAT_FIXED(0.308096035956409)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681402), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681401), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(0.948228840402632), FLOAT_FIXED(0.077060979923133), FLOAT_FIXED(0.308096854255226)}, 
-    {FLOAT_FIXED(0.948227723750313), FLOAT_FIXED(0.0770660753056267), FLOAT_FIXED(0.308099016467575)}, 
-    {FLOAT_FIXED(0.948228108167058), FLOAT_FIXED(0.0770608458776526), FLOAT_FIXED(0.308099141372614)}, 
-    {FLOAT_FIXED(0.948228883299212), FLOAT_FIXED(0.0770609877759427), FLOAT_FIXED(0.308096720268368)}, 
-    {FLOAT_FIXED(0.948228883299212), FLOAT_FIXED(0.0770609877759412), FLOAT_FIXED(0.308096720268369)}, 
-    {FLOAT_FIXED(0.948227971304387), FLOAT_FIXED(0.0770576319962545), FLOAT_FIXED(0.308100366418311)}, 
-    {FLOAT_FIXED(0.948229116109315), FLOAT_FIXED(0.0770584795796206), FLOAT_FIXED(0.308096631087431)}, 
-    {FLOAT_FIXED(0.948228977372164), FLOAT_FIXED(0.0770603669935933), FLOAT_FIXED(0.308096586009244)}, 
-    {FLOAT_FIXED(0.948229116109315), FLOAT_FIXED(0.0770584795796208), FLOAT_FIXED(0.308096631087431)}, 
-    {FLOAT_FIXED(0.94822875435579), FLOAT_FIXED(0.0770688148176397), FLOAT_FIXED(0.308095159318467)}, 
-    {FLOAT_FIXED(0.948228552179186), FLOAT_FIXED(0.0770687778046586), FLOAT_FIXED(0.30809579081815)}, 
-    {FLOAT_FIXED(0.948226819099602), FLOAT_FIXED(0.0770580590237375), FLOAT_FIXED(0.308103805688512)}, 
-    {FLOAT_FIXED(0.948229725238191), FLOAT_FIXED(0.0770579531200747), FLOAT_FIXED(0.308094888038814)}, 
-    {FLOAT_FIXED(0.948229725238191), FLOAT_FIXED(0.0770579531200748), FLOAT_FIXED(0.308094888038814)}, 
-    {FLOAT_FIXED(0.948227779482368), FLOAT_FIXED(0.0770686363454942), FLOAT_FIXED(0.308098204327423)}, 
-    {FLOAT_FIXED(0.948228628515461), FLOAT_FIXED(0.0770601095757458), FLOAT_FIXED(0.308097724067969)}, 
-    {FLOAT_FIXED(0.948228582240323), FLOAT_FIXED(0.0770607391060045), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(0.948226696468311), FLOAT_FIXED(0.0770687201596884), FLOAT_FIXED(0.308101516513212)}, 
-    {FLOAT_FIXED(0.948227286376932), FLOAT_FIXED(0.0770606954386828), FLOAT_FIXED(0.308101708188622)}, 
-    {FLOAT_FIXED(0.94822856820129), FLOAT_FIXED(0.0770609300929847), FLOAT_FIXED(0.308097704470734)}, 
-    {FLOAT_FIXED(0.948227286376932), FLOAT_FIXED(0.0770606954386827), FLOAT_FIXED(0.308101708188622)}, 
-    {FLOAT_FIXED(0.948228616787069), FLOAT_FIXED(0.0770607329470615), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(0.948228616787069), FLOAT_FIXED(0.0770607329470616), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(0.948228616787068), FLOAT_FIXED(0.0770607329470627), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(0.948227964514082), FLOAT_FIXED(0.0770661193888227), FLOAT_FIXED(0.308098264447934)}, 
-    {FLOAT_FIXED(0.948226445880827), FLOAT_FIXED(0.0770605415760762), FLOAT_FIXED(0.308104333407072)}, 
-    {FLOAT_FIXED(0.948228580217371), FLOAT_FIXED(0.0770577434804096), FLOAT_FIXED(0.308098464502269)}, 
-    {FLOAT_FIXED(0.948227835351146), FLOAT_FIXED(0.0770685171331238), FLOAT_FIXED(0.308098062201277)}, 
-    {FLOAT_FIXED(0.948228404799704), FLOAT_FIXED(0.0770607707398055), FLOAT_FIXED(0.308098247226427)}, 
-    {FLOAT_FIXED(0.948229778005835), FLOAT_FIXED(0.0770605135597502), FLOAT_FIXED(0.308094085228705)}, 
-    {FLOAT_FIXED(0.948229239814287), FLOAT_FIXED(0.0770578642445756), FLOAT_FIXED(0.308096404262181)}, 
-    {FLOAT_FIXED(0.948227505919093), FLOAT_FIXED(0.077060735628555), FLOAT_FIXED(0.308101022463156)}, 
-    {FLOAT_FIXED(0.948228601842607), FLOAT_FIXED(0.0770609362514809), FLOAT_FIXED(0.308097599392887)}, 
-    {FLOAT_FIXED(0.948228601842607), FLOAT_FIXED(0.0770609362514809), FLOAT_FIXED(0.308097599392886)}, 
-    {FLOAT_FIXED(0.948228032392589), FLOAT_FIXED(0.0770686826462107), FLOAT_FIXED(0.30809741436769)}, 
-    {FLOAT_FIXED(0.948227596758428), FLOAT_FIXED(0.077068602893946), FLOAT_FIXED(0.308098775060386)}, 
-    {FLOAT_FIXED(0.948228166207334), FLOAT_FIXED(0.077060856502678), FLOAT_FIXED(0.308098960086123)}, 
-    {FLOAT_FIXED(0.948228758656478), FLOAT_FIXED(0.0770609649583822), FLOAT_FIXED(0.308097109587996)}, 
-    {FLOAT_FIXED(0.948228178523442), FLOAT_FIXED(0.0770608110798227), FLOAT_FIXED(0.308098933542192)}, 
-    {FLOAT_FIXED(0.948230309931276), FLOAT_FIXED(0.0770604310921631), FLOAT_FIXED(0.308092468728995)}, 
-    {FLOAT_FIXED(0.948228178523442), FLOAT_FIXED(0.0770608110798224), FLOAT_FIXED(0.308098933542192)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770614735808166), FLOAT_FIXED(0.997026343327775)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770614735808166), FLOAT_FIXED(0.997026343327774)}, 
-    {FLOAT_FIXED(9.1770272509533e-18), FLOAT_FIXED(0.0770614735808167), FLOAT_FIXED(0.997026343327775)}, 
-    {FLOAT_FIXED(0.948227938424398), FLOAT_FIXED(0.0770661146118693), FLOAT_FIXED(0.30809834593851)}, 
-    {FLOAT_FIXED(0.948229464958399), FLOAT_FIXED(0.0770610942568312), FLOAT_FIXED(0.308094903457764)}, 
-    {FLOAT_FIXED(0.948227635622571), FLOAT_FIXED(0.0770607593723831), FLOAT_FIXED(0.308100617342094)}, 
-    {FLOAT_FIXED(0.948227030456231), FLOAT_FIXED(0.0770684992203621), FLOAT_FIXED(0.308100543881505)}, 
-    {FLOAT_FIXED(0.948227831190049), FLOAT_FIXED(0.0770576063431731), FLOAT_FIXED(0.308100804058147)}, 
-    {FLOAT_FIXED(0.948229438795988), FLOAT_FIXED(0.0770610894674273), FLOAT_FIXED(0.308094985176227)}, 
-    {FLOAT_FIXED(0.948227605616383), FLOAT_FIXED(0.0770686045155842), FLOAT_FIXED(0.308098747392848)}, 
-    {FLOAT_FIXED(0.948229741620925), FLOAT_FIXED(0.0770611449039191), FLOAT_FIXED(0.308094039299059)}, 
-    {FLOAT_FIXED(0.948228175065311), FLOAT_FIXED(0.0770608581242463), FLOAT_FIXED(0.308098932418574)}, 
-    {FLOAT_FIXED(0.94822818907462), FLOAT_FIXED(0.0770608091987854), FLOAT_FIXED(0.308098901539578)}, 
-    {FLOAT_FIXED(0.94822818907462), FLOAT_FIXED(0.0770608091987848), FLOAT_FIXED(0.308098901539578)}, 
-    {FLOAT_FIXED(0.948229972709346), FLOAT_FIXED(0.0770598699345487), FLOAT_FIXED(0.3080936469668)}, 
-    {FLOAT_FIXED(0.948228370937549), FLOAT_FIXED(0.0770684216539838), FLOAT_FIXED(0.308096437715346)}, 
-    {FLOAT_FIXED(0.948228940386045), FLOAT_FIXED(0.0770606752561747), FLOAT_FIXED(0.308096622739396)}, 
-    {FLOAT_FIXED(0.948229612358243), FLOAT_FIXED(0.0770605554568314), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(0.948226596068638), FLOAT_FIXED(0.0770610931926668), FLOAT_FIXED(0.308103733219892)}, 
-    {FLOAT_FIXED(0.948226642344104), FLOAT_FIXED(0.0770604636595497), FLOAT_FIXED(0.308103748256007)}, 
-    {FLOAT_FIXED(0.948229358161037), FLOAT_FIXED(0.0770606007752959), FLOAT_FIXED(0.3080953555795)}, 
-    {FLOAT_FIXED(0.948229612358243), FLOAT_FIXED(0.0770605554568309), FLOAT_FIXED(0.308094584567178)}, 
-    {FLOAT_FIXED(0.948226974769867), FLOAT_FIXED(0.0770686705476781), FLOAT_FIXED(0.308100672408873)}, 
-    {FLOAT_FIXED(0.948229612358242), FLOAT_FIXED(0.0770605554568309), FLOAT_FIXED(0.308094584567178)}, 
-    {FLOAT_FIXED(0.948228824095151), FLOAT_FIXED(0.0770600747083264), FLOAT_FIXED(0.308097130854985)}, 
-    {FLOAT_FIXED(0.948228337426498), FLOAT_FIXED(0.0770601614701201), FLOAT_FIXED(0.30809860696793)}, 
-    {FLOAT_FIXED(0.94822865609709), FLOAT_FIXED(0.0770607259389261), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(0.94822947626648), FLOAT_FIXED(0.077060579719391), FLOAT_FIXED(0.308094997350992)}, 
-    {FLOAT_FIXED(0.948227587881954), FLOAT_FIXED(0.0770609163774379), FLOAT_FIXED(0.308100725001809)}, 
-    {FLOAT_FIXED(0.948230089823034), FLOAT_FIXED(0.0770604703336182), FLOAT_FIXED(0.308093136350298)}, 
-    {FLOAT_FIXED(0.948229220175718), FLOAT_FIXED(0.0770606253753517), FLOAT_FIXED(0.308095774105569)}, 
-    {FLOAT_FIXED(0.948229777084828), FLOAT_FIXED(0.0770605260891675), FLOAT_FIXED(0.308094084929456)}, 
-    {FLOAT_FIXED(0.948228528922701), FLOAT_FIXED(0.0770642603958849), FLOAT_FIXED(0.30809699236884)}, 
-    {FLOAT_FIXED(0.9482283734511), FLOAT_FIXED(0.0770618635428985), FLOAT_FIXED(0.308098070376263)}, 
-    {FLOAT_FIXED(0.948228393437384), FLOAT_FIXED(0.0770618653601446), FLOAT_FIXED(0.308098008410267)}, 
-    {FLOAT_FIXED(0.586037645214714), FLOAT_FIXED(0.0770574404757661), FLOAT_FIXED(-0.806611448752444)}, 
-    {FLOAT_FIXED(0.58603528448755), FLOAT_FIXED(0.0770627111377947), FLOAT_FIXED(-0.80661266038148)}, 
-    {FLOAT_FIXED(0.586038102527303), FLOAT_FIXED(0.0770629062182291), FLOAT_FIXED(-0.806610594321323)}, 
-    {FLOAT_FIXED(0.586036163790969), FLOAT_FIXED(0.0770627720081305), FLOAT_FIXED(-0.806612015717338)}, 
-    {FLOAT_FIXED(0.586035184520511), FLOAT_FIXED(0.077064511855724), FLOAT_FIXED(-0.806612560971158)}, 
-    {FLOAT_FIXED(0.586038452037287), FLOAT_FIXED(0.0770581278100397), FLOAT_FIXED(-0.80661079689783)}, 
-    {FLOAT_FIXED(0.58604061113839), FLOAT_FIXED(0.0770582772570782), FLOAT_FIXED(-0.806609213933683)}, 
-    {FLOAT_FIXED(0.586038515791504), FLOAT_FIXED(0.0770581322229346), FLOAT_FIXED(-0.806610750155987)}, 
-    {FLOAT_FIXED(0.586038515791504), FLOAT_FIXED(0.0770581322229349), FLOAT_FIXED(-0.806610750155987)}, 
-    {FLOAT_FIXED(0.586039123728627), FLOAT_FIXED(0.0770581743026951), FLOAT_FIXED(-0.806610304442312)}, 
-    {FLOAT_FIXED(0.586038456386949), FLOAT_FIXED(0.0770581281111121), FLOAT_FIXED(-0.806610793708845)}, 
-    {FLOAT_FIXED(0.586038456386949), FLOAT_FIXED(0.0770581281111116), FLOAT_FIXED(-0.806610793708845)}, 
-    {FLOAT_FIXED(0.5860363815367), FLOAT_FIXED(0.0770645947029109), FLOAT_FIXED(-0.806611683375989)}, 
-    {FLOAT_FIXED(0.586036121736882), FLOAT_FIXED(0.0770645767218038), FLOAT_FIXED(-0.806611873849055)}, 
-    {FLOAT_FIXED(0.586036421122908), FLOAT_FIXED(0.077057987235494), FLOAT_FIXED(-0.806612285872629)}, 
-    {FLOAT_FIXED(0.586033854695425), FLOAT_FIXED(0.0770644198165485), FLOAT_FIXED(-0.80661353593227)}, 
-    {FLOAT_FIXED(0.586036378491098), FLOAT_FIXED(0.0770645944921211), FLOAT_FIXED(-0.806611685608883)}, 
-    {FLOAT_FIXED(0.586034148006858), FLOAT_FIXED(0.0770644401170776), FLOAT_FIXED(-0.806613320891316)}, 
-    {FLOAT_FIXED(0.586037420256703), FLOAT_FIXED(0.0770628589876917), FLOAT_FIXED(-0.806611094532869)}, 
-    {FLOAT_FIXED(0.586037420256702), FLOAT_FIXED(0.0770628589876917), FLOAT_FIXED(-0.806611094532869)}, 
-    {FLOAT_FIXED(0.586037083515693), FLOAT_FIXED(0.0770628356766126), FLOAT_FIXED(-0.806611341416608)}, 
-    {FLOAT_FIXED(0.586037500628481), FLOAT_FIXED(0.0770646721567669), FLOAT_FIXED(-0.806610862908809)}, 
-    {FLOAT_FIXED(0.586037500628481), FLOAT_FIXED(0.0770646721567677), FLOAT_FIXED(-0.806610862908809)}, 
-    {FLOAT_FIXED(0.586034576524117), FLOAT_FIXED(0.0770626621285453), FLOAT_FIXED(-0.806613179426087)}, 
-    {FLOAT_FIXED(0.586035666550177), FLOAT_FIXED(0.0770645452176901), FLOAT_FIXED(-0.806612207570329)}, 
-    {FLOAT_FIXED(0.586036030228307), FLOAT_FIXED(0.0770645703883679), FLOAT_FIXED(-0.806611940938828)}, 
-    {FLOAT_FIXED(0.586035812712718), FLOAT_FIXED(0.0770693579105028), FLOAT_FIXED(-0.80661164155336)}, 
-    {FLOAT_FIXED(0.586033875133556), FLOAT_FIXED(0.0770692237919667), FLOAT_FIXED(-0.806613062093623)}, 
-    {FLOAT_FIXED(0.586039182456639), FLOAT_FIXED(0.0770629809768452), FLOAT_FIXED(-0.806609802561633)}, 
-    {FLOAT_FIXED(0.586034420607287), FLOAT_FIXED(0.0770572172784944), FLOAT_FIXED(-0.806613812879978)}, 
-    {FLOAT_FIXED(0.586037712344516), FLOAT_FIXED(0.0770574451222749), FLOAT_FIXED(-0.806611399535882)}, 
-    {FLOAT_FIXED(0.586041778642552), FLOAT_FIXED(0.0770577265778964), FLOAT_FIXED(-0.806608418292371)}, 
-    {FLOAT_FIXED(0.586041778642552), FLOAT_FIXED(0.0770577265778969), FLOAT_FIXED(-0.806608418292371)}, 
-    {FLOAT_FIXED(0.58603625821059), FLOAT_FIXED(0.0770579759591219), FLOAT_FIXED(-0.806612405312251)}, 
-    {FLOAT_FIXED(0.586040789424027), FLOAT_FIXED(0.0770582895975081), FLOAT_FIXED(-0.806609083221587)}, 
-    {FLOAT_FIXED(0.586040356543535), FLOAT_FIXED(0.0770582596347373), FLOAT_FIXED(-0.806609400592624)}, 
-    {FLOAT_FIXED(0.586036272631908), FLOAT_FIXED(0.0770669917346099), FLOAT_FIXED(-0.806611533481067)}, 
-    {FLOAT_FIXED(0.586036272631907), FLOAT_FIXED(0.0770669917346099), FLOAT_FIXED(-0.806611533481067)}, 
-    {FLOAT_FIXED(0.586036600604233), FLOAT_FIXED(0.077059772724461), FLOAT_FIXED(-0.806611984897255)}, 
-    {FLOAT_FIXED(0.58603275070826), FLOAT_FIXED(0.0770654376304924), FLOAT_FIXED(-0.806614240774443)}, 
-    {FLOAT_FIXED(0.586035737498093), FLOAT_FIXED(0.0770652322158335), FLOAT_FIXED(-0.806612090387062)}, 
-    {FLOAT_FIXED(0.586038354271062), FLOAT_FIXED(0.0770602796621883), FLOAT_FIXED(-0.806610662353065)}, 
-    {FLOAT_FIXED(-0.948228781657472), FLOAT_FIXED(0.0770596937582609), FLOAT_FIXED(0.308097356746645)}, 
-    {FLOAT_FIXED(-0.948228712661927), FLOAT_FIXED(0.0770617608793489), FLOAT_FIXED(0.308097052069114)}, 
-    {FLOAT_FIXED(-0.948228633955395), FLOAT_FIXED(0.0770633308104988), FLOAT_FIXED(0.308096901625894)}, 
-    {FLOAT_FIXED(0.586037285759957), FLOAT_FIXED(0.0770580470834215), FLOAT_FIXED(-0.806611651960714)}, 
-    {FLOAT_FIXED(0.586037068218156), FLOAT_FIXED(0.0770628346176315), FLOAT_FIXED(-0.806611352632086)}, 
-    {FLOAT_FIXED(0.586037685464278), FLOAT_FIXED(0.0770646849494969), FLOAT_FIXED(-0.806610727395382)}, 
-    {FLOAT_FIXED(0.586033648563645), FLOAT_FIXED(0.0770606033341618), FLOAT_FIXED(-0.806614050314621)}, 
-    {FLOAT_FIXED(0.586035393926052), FLOAT_FIXED(0.0770604832836207), FLOAT_FIXED(-0.806612793713335)}, 
-    {FLOAT_FIXED(0.586033038805369), FLOAT_FIXED(0.0770606452747849), FLOAT_FIXED(-0.806614489318397)}, 
-    {FLOAT_FIXED(0.586035544903811), FLOAT_FIXED(0.0770598453379682), FLOAT_FIXED(-0.806612744968601)}, 
-    {FLOAT_FIXED(0.586038447034385), FLOAT_FIXED(0.0770596457222621), FLOAT_FIXED(-0.806610655520174)}, 
-    {FLOAT_FIXED(0.586038418435077), FLOAT_FIXED(0.077060275248777), FLOAT_FIXED(-0.806610616156703)}, 
-    {FLOAT_FIXED(0.586040102070416), FLOAT_FIXED(0.0770601594425569), FLOAT_FIXED(-0.806609403981868)}, 
-    {FLOAT_FIXED(0.586035632973996), FLOAT_FIXED(0.0770604668412423), FLOAT_FIXED(-0.806612621606542)}, 
-    {FLOAT_FIXED(0.586037513605962), FLOAT_FIXED(0.0770603374858225), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(0.586037413737415), FLOAT_FIXED(0.0770603443550908), FLOAT_FIXED(-0.806611339511066)}, 
-    {FLOAT_FIXED(0.586036568940164), FLOAT_FIXED(0.077060402462804), FLOAT_FIXED(-0.806611947740121)}, 
-    {FLOAT_FIXED(0.586032088642861), FLOAT_FIXED(0.0770672795444772), FLOAT_FIXED(-0.806614545805181)}, 
-    {FLOAT_FIXED(0.586038702100976), FLOAT_FIXED(0.0770668246139111), FLOAT_FIXED(-0.806609784334242)}, 
-    {FLOAT_FIXED(0.586031722661794), FLOAT_FIXED(0.0770673047195756), FLOAT_FIXED(-0.806614809297046)}, 
-    {FLOAT_FIXED(0.586037698134946), FLOAT_FIXED(0.0770603247933386), FLOAT_FIXED(-0.806611134752948)}, 
-    {FLOAT_FIXED(0.58603843888469), FLOAT_FIXED(0.0770602738421854), FLOAT_FIXED(-0.806610601433531)}, 
-    {FLOAT_FIXED(0.586041463760458), FLOAT_FIXED(0.0770600657804694), FLOAT_FIXED(-0.806608423595619)}, 
-    {FLOAT_FIXED(0.586037563476265), FLOAT_FIXED(0.0770597064957306), FLOAT_FIXED(-0.806611291657633)}, 
-    {FLOAT_FIXED(0.586037534876954), FLOAT_FIXED(0.077060336022736), FLOAT_FIXED(-0.806611252294069)}, 
-    {FLOAT_FIXED(0.586033969347195), FLOAT_FIXED(0.0770671501742424), FLOAT_FIXED(-0.806613191768639)}, 
-    {FLOAT_FIXED(0.586033487854713), FLOAT_FIXED(0.0770671832952957), FLOAT_FIXED(-0.806613538425787)}, 
-    {FLOAT_FIXED(0.586031411109684), FLOAT_FIXED(0.0770607572312363), FLOAT_FIXED(-0.80661566119667)}, 
-    {FLOAT_FIXED(0.586041134974582), FLOAT_FIXED(0.0770600883956108), FLOAT_FIXED(-0.806608660314383)}, 
-    {FLOAT_FIXED(0.586031111690265), FLOAT_FIXED(0.077067346747021), FLOAT_FIXED(-0.806615249171776)}, 
-    {FLOAT_FIXED(0.586036146656821), FLOAT_FIXED(0.0770604315086832), FLOAT_FIXED(-0.806612251771147)}, 
-    {FLOAT_FIXED(0.586035711037961), FLOAT_FIXED(0.0770604614717848), FLOAT_FIXED(-0.806612565402986)}, 
-    {FLOAT_FIXED(0.586035847283799), FLOAT_FIXED(0.0770670209937649), FLOAT_FIXED(-0.806611839718155)}, 
-    {FLOAT_FIXED(0.586040031007674), FLOAT_FIXED(0.0770601643305061), FLOAT_FIXED(-0.806609455145351)}, 
-    {FLOAT_FIXED(0.586034784177976), FLOAT_FIXED(0.0770605252237319), FLOAT_FIXED(-0.80661323271176)}, 
-    {FLOAT_FIXED(-0.586036834673315), FLOAT_FIXED(0.0770679740045713), FLOAT_FIXED(-0.806611031283922)}, 
-    {FLOAT_FIXED(-0.586037425328314), FLOAT_FIXED(0.0770549753861436), FLOAT_FIXED(-0.806611844001067)}, 
-    {FLOAT_FIXED(-0.586037869685565), FLOAT_FIXED(0.0770606300190955), FLOAT_FIXED(-0.806610980953932)}, 
-    {FLOAT_FIXED(-0.58604296953841), FLOAT_FIXED(0.0770599622070954), FLOAT_FIXED(-0.806607339465271)}, 
-    {FLOAT_FIXED(-0.586033787269206), FLOAT_FIXED(0.0770605937936544), FLOAT_FIXED(-0.806613950451565)}, 
-    {FLOAT_FIXED(-0.586039308160627), FLOAT_FIXED(0.0770602140504616), FLOAT_FIXED(-0.806609975577485)}, 
-    {FLOAT_FIXED(-0.586038635528185), FLOAT_FIXED(0.0770602603163959), FLOAT_FIXED(-0.806610459855457)}, 
-    {FLOAT_FIXED(-0.586038635528185), FLOAT_FIXED(0.077060260316396), FLOAT_FIXED(-0.806610459855457)}, 
-    {FLOAT_FIXED(-0.586038364730935), FLOAT_FIXED(0.0770662202093892), FLOAT_FIXED(-0.80661008719587)}, 
-    {FLOAT_FIXED(-0.586034673258279), FLOAT_FIXED(0.0770605328530797), FLOAT_FIXED(-0.806613312570194)}, 
-    {FLOAT_FIXED(-0.586034275503924), FLOAT_FIXED(0.0770605602116504), FLOAT_FIXED(-0.806613598939701)}, 
-    {FLOAT_FIXED(-0.586038370384801), FLOAT_FIXED(0.0770668474323897), FLOAT_FIXED(-0.806610023160858)}, 
-    {FLOAT_FIXED(-0.586035367460438), FLOAT_FIXED(0.0770604851039979), FLOAT_FIXED(-0.806612812767716)}, 
-    {FLOAT_FIXED(-0.586038669757764), FLOAT_FIXED(0.0770602579619717), FLOAT_FIXED(-0.806610435211066)}, 
-    {FLOAT_FIXED(-0.58604029935537), FLOAT_FIXED(0.0770595183142644), FLOAT_FIXED(-0.806609321895453)}, 
-    {FLOAT_FIXED(-0.586040706366025), FLOAT_FIXED(0.0770601178769064), FLOAT_FIXED(-0.806608968903029)}, 
-    {FLOAT_FIXED(-0.586036146656821), FLOAT_FIXED(0.0770604315086827), FLOAT_FIXED(-0.806612251771147)}, 
-    {FLOAT_FIXED(-0.586036896626758), FLOAT_FIXED(0.0770669488107425), FLOAT_FIXED(-0.80661108422404)}, 
-    {FLOAT_FIXED(-0.586036896626758), FLOAT_FIXED(0.0770669488107421), FLOAT_FIXED(-0.80661108422404)}, 
-    {FLOAT_FIXED(-0.586037196028904), FLOAT_FIXED(0.0770603593297537), FLOAT_FIXED(-0.806611496254888)}, 
-    {FLOAT_FIXED(-0.586037376171865), FLOAT_FIXED(0.0770597193790071), FLOAT_FIXED(-0.806611426511443)}, 
-    {FLOAT_FIXED(-0.58604022758626), FLOAT_FIXED(0.0770667196767947), FLOAT_FIXED(-0.806608686023714)}, 
-    {FLOAT_FIXED(-0.58604022758626), FLOAT_FIXED(0.077066719676794), FLOAT_FIXED(-0.806608686023714)}, 
-    {FLOAT_FIXED(-0.586038418435076), FLOAT_FIXED(0.077060275248777), FLOAT_FIXED(-0.806610616156704)}, 
-    {FLOAT_FIXED(-0.586035544903811), FLOAT_FIXED(0.0770598453379682), FLOAT_FIXED(-0.806612744968601)}, 
-    {FLOAT_FIXED(-0.586039658249075), FLOAT_FIXED(0.0770601899701621), FLOAT_FIXED(-0.806609723522516)}, 
-    {FLOAT_FIXED(-0.586039358876135), FLOAT_FIXED(0.0770667794348358), FLOAT_FIXED(-0.806609311473399)}, 
-    {FLOAT_FIXED(-0.586036302400643), FLOAT_FIXED(0.0770597932356111), FLOAT_FIXED(-0.806612199594742)}, 
-    {FLOAT_FIXED(-0.586037912732534), FLOAT_FIXED(0.0770596824729757), FLOAT_FIXED(-0.806611040202934)}, 
-    {FLOAT_FIXED(-0.586029517553419), FLOAT_FIXED(0.0770674564040255), FLOAT_FIXED(-0.806616396882384)}, 
-    {FLOAT_FIXED(-0.586036680900512), FLOAT_FIXED(0.0770580052166288), FLOAT_FIXED(-0.806612095415848)}, 
-    {FLOAT_FIXED(-0.586039400137859), FLOAT_FIXED(0.0770581934349858), FLOAT_FIXED(-0.806610101790571)}, 
-    {FLOAT_FIXED(-0.5860363815367), FLOAT_FIXED(0.0770645947029111), FLOAT_FIXED(-0.806611683375989)}, 
-    {FLOAT_FIXED(0.586036636918716), FLOAT_FIXED(0.0770613072767823), FLOAT_FIXED(-0.806611811908178)}, 
-    {FLOAT_FIXED(0.586036630584318), FLOAT_FIXED(0.0770614467070685), FLOAT_FIXED(-0.80661180318961)}, 
-    {FLOAT_FIXED(0.586038171197022), FLOAT_FIXED(0.0770610793619899), FLOAT_FIXED(-0.806610718963996)}, 
-    {FLOAT_FIXED(-0.586035333600961), FLOAT_FIXED(0.0770670563293086), FLOAT_FIXED(-0.806612209552983)}, 
-    {FLOAT_FIXED(-0.586037214232972), FLOAT_FIXED(0.0770669269629583), FLOAT_FIXED(-0.806610855557092)}, 
-    {FLOAT_FIXED(-0.586037214232973), FLOAT_FIXED(0.0770669269629581), FLOAT_FIXED(-0.806610855557091)}, 
-    {FLOAT_FIXED(-0.586036600604233), FLOAT_FIXED(0.077059772724461), FLOAT_FIXED(-0.806611984897255)}, 
-    {FLOAT_FIXED(-0.586036272631907), FLOAT_FIXED(0.0770669917346099), FLOAT_FIXED(-0.806611533481067)}, 
-    {FLOAT_FIXED(-0.586035230859594), FLOAT_FIXED(0.0770693176348602), FLOAT_FIXED(-0.806612068140962)}, 
-    {FLOAT_FIXED(-0.586037317252795), FLOAT_FIXED(0.0770646594650939), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(-0.586037645214714), FLOAT_FIXED(0.0770574404757665), FLOAT_FIXED(-0.806611448752444)}, 
-    {FLOAT_FIXED(-0.586036383957708), FLOAT_FIXED(0.0770645948704725), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(-0.586036465823977), FLOAT_FIXED(0.0770627929165478), FLOAT_FIXED(-0.806611794280523)}, 
-    {FLOAT_FIXED(-0.586038157022236), FLOAT_FIXED(0.0770647175866347), FLOAT_FIXED(-0.806610381669659)}, 
-    {FLOAT_FIXED(-0.586033476366599), FLOAT_FIXED(0.0770643936318288), FLOAT_FIXED(-0.806613813303391)}, 
-    {FLOAT_FIXED(-0.586035292687492), FLOAT_FIXED(0.0770627117054413), FLOAT_FIXED(-0.806612654369673)}, 
-    {FLOAT_FIXED(-0.586040118286342), FLOAT_FIXED(0.0770582431432391), FLOAT_FIXED(-0.806609575273322)}, 
-    {FLOAT_FIXED(-0.586037500628481), FLOAT_FIXED(0.0770646721567685), FLOAT_FIXED(-0.806610862908809)}, 
-    {FLOAT_FIXED(-0.586034494657036), FLOAT_FIXED(0.0770644641092579), FLOAT_FIXED(-0.806613066744908)}, 
-    {FLOAT_FIXED(-0.586034427365804), FLOAT_FIXED(0.0770572177462982), FLOAT_FIXED(-0.806613807924978)}, 
-    {FLOAT_FIXED(-0.586036677854909), FLOAT_FIXED(0.0770580050058201), FLOAT_FIXED(-0.806612097648743)}, 
-    {FLOAT_FIXED(-0.586034447369536), FLOAT_FIXED(0.0770578506172602), FLOAT_FIXED(-0.806613732932022)}, 
-    {FLOAT_FIXED(-0.586034447369536), FLOAT_FIXED(0.0770578506172601), FLOAT_FIXED(-0.806613732932022)}, 
-    {FLOAT_FIXED(-0.58603608192457), FLOAT_FIXED(0.0770645739663392), FLOAT_FIXED(-0.806611903037567)}, 
-    {FLOAT_FIXED(-0.586038466178687), FLOAT_FIXED(0.077064738983748), FLOAT_FIXED(-0.806610155009406)}, 
-    {FLOAT_FIXED(-0.586038765543557), FLOAT_FIXED(0.077058149510098), FLOAT_FIXED(-0.806610567048476)}, 
-    {FLOAT_FIXED(-0.586038514015735), FLOAT_FIXED(0.0770629347037173), FLOAT_FIXED(-0.806610292635223)}, 
-    {FLOAT_FIXED(-0.586038877686864), FLOAT_FIXED(0.0770629598790211), FLOAT_FIXED(-0.806610026006499)}, 
-    {FLOAT_FIXED(-0.586035965944908), FLOAT_FIXED(0.0770579557292384), FLOAT_FIXED(-0.806612619587525)}, 
-    {FLOAT_FIXED(-0.586041233157449), FLOAT_FIXED(0.0770697331106226), FLOAT_FIXED(-0.806607667504812)}, 
-    {FLOAT_FIXED(-0.586041233157449), FLOAT_FIXED(0.0770697331106225), FLOAT_FIXED(-0.806607667504812)}, 
-    {FLOAT_FIXED(-0.58603732963523), FLOAT_FIXED(0.0770574186323643), FLOAT_FIXED(-0.806611680121064)}, 
-    {FLOAT_FIXED(-0.586033804970477), FLOAT_FIXED(0.0770571746659677), FLOAT_FIXED(-0.806614264233112)}, 
-    {FLOAT_FIXED(-0.586037338390844), FLOAT_FIXED(0.0770646609280864), FLOAT_FIXED(-0.806610981854212)}, 
-    {FLOAT_FIXED(-0.586035607804509), FLOAT_FIXED(0.0770627335196215), FLOAT_FIXED(-0.806612423340778)}, 
-    {FLOAT_FIXED(-0.586036040713444), FLOAT_FIXED(0.0770627634880146), FLOAT_FIXED(-0.806612105952112)}, 
-    {FLOAT_FIXED(-0.586037197946416), FLOAT_FIXED(0.0770646512077394), FLOAT_FIXED(-0.806611084821764)}, 
-    {FLOAT_FIXED(-0.586035853892933), FLOAT_FIXED(0.0770645581839484), FLOAT_FIXED(-0.806612070219566)}, 
-    {FLOAT_FIXED(-0.586035319166296), FLOAT_FIXED(0.0770645211747535), FLOAT_FIXED(-0.806612462255428)}, 
-    {FLOAT_FIXED(-0.586031035327482), FLOAT_FIXED(0.0770690272212264), FLOAT_FIXED(-0.806615144090522)}, 
-    {FLOAT_FIXED(-0.586034392009977), FLOAT_FIXED(0.0770578467854073), FLOAT_FIXED(-0.806613773518834)}, 
-    {FLOAT_FIXED(-0.586034392009978), FLOAT_FIXED(0.0770578467854073), FLOAT_FIXED(-0.806613773518834)}, 
-    {FLOAT_FIXED(-0.586033913585044), FLOAT_FIXED(0.0770578136700053), FLOAT_FIXED(-0.806614124275416)}, 
-    {FLOAT_FIXED(-0.586034784177976), FLOAT_FIXED(0.0770605252237318), FLOAT_FIXED(-0.80661323271176)}, 
-    {FLOAT_FIXED(-0.586034784177976), FLOAT_FIXED(0.0770605252237319), FLOAT_FIXED(-0.80661323271176)}, 
-    {FLOAT_FIXED(-0.586034784177976), FLOAT_FIXED(0.0770605252237324), FLOAT_FIXED(-0.80661323271176)}, 
-    {FLOAT_FIXED(-5.93257848422215e-07), FLOAT_FIXED(0.0770618214677499), FLOAT_FIXED(0.997026316438899)}, 
-    {FLOAT_FIXED(-5.93253281274727e-07), FLOAT_FIXED(0.0770618214674949), FLOAT_FIXED(0.997026316438919)}, 
-    {FLOAT_FIXED(-4.90117573734217e-07), FLOAT_FIXED(0.0770611861754051), FLOAT_FIXED(0.997026365541553)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770611588127346), FLOAT_FIXED(0.997026367656562)}, 
-    {FLOAT_FIXED(-5.36776756915908e-07), FLOAT_FIXED(0.0770618183193012), FLOAT_FIXED(0.99702631668228)}, 
-    {FLOAT_FIXED(-3.88748268370521e-07), FLOAT_FIXED(0.077061180516081), FLOAT_FIXED(0.997026365979013)}, 
-    {FLOAT_FIXED(-3.88748268552293e-07), FLOAT_FIXED(0.077061180516081), FLOAT_FIXED(0.997026365979013)}, 
-    {FLOAT_FIXED(-4.50928128991619e-07), FLOAT_FIXED(0.0770618135227552), FLOAT_FIXED(0.997026317053056)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514623), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.63679221442803e-07), FLOAT_FIXED(0.0770618086524287), FLOAT_FIXED(0.997026317429527)}, 
-    {FLOAT_FIXED(7.48192965387313e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(7.6256236494433e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(8.11844006061147e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-8.66849729040686e-07), FLOAT_FIXED(0.0770612072008108), FLOAT_FIXED(0.997026363916222)}, 
-    {FLOAT_FIXED(-3.4164212660255e-07), FLOAT_FIXED(0.0770611397420483), FLOAT_FIXED(0.997026369130496)}, 
-    {FLOAT_FIXED(-1.05103502266111e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-7.51352778969592e-07), FLOAT_FIXED(0.0770617464101083), FLOAT_FIXED(0.99702632224012)}, 
-    {FLOAT_FIXED(-0.586038809071709), FLOAT_FIXED(0.0770635328194031), FLOAT_FIXED(-0.806610021119999)}, 
-    {FLOAT_FIXED(-0.586038845649431), FLOAT_FIXED(0.0770627277065306), FLOAT_FIXED(-0.806610071464714)}, 
-    {FLOAT_FIXED(-0.586035728628069), FLOAT_FIXED(0.0770623047223132), FLOAT_FIXED(-0.806612376524346)}, 
-    {FLOAT_FIXED(9.37617042606728e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-5.36780078437098e-07), FLOAT_FIXED(0.0770617583878009), FLOAT_FIXED(0.997026321314484)}, 
-    {FLOAT_FIXED(-3.88750010710541e-07), FLOAT_FIXED(0.0770611371124548), FLOAT_FIXED(0.997026369333723)}, 
-    {FLOAT_FIXED(8.54765226418354e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(8.5476166051531e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.6367902983575e-07), FLOAT_FIXED(0.077061768050497), FLOAT_FIXED(0.997026320567717)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-4.5093047262159e-07), FLOAT_FIXED(0.0770617631763396), FLOAT_FIXED(0.997026320944412)}, 
-    {FLOAT_FIXED(-8.76764543621019e-18), FLOAT_FIXED(0.0770617883514621), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-6.62999731691703e-07), FLOAT_FIXED(0.0770611218036491), FLOAT_FIXED(0.99702637051681)}, 
-    {FLOAT_FIXED(-6.63005435895226e-07), FLOAT_FIXED(0.0770611218033307), FLOAT_FIXED(0.997026370516835)}, 
-    {FLOAT_FIXED(1.03632447931069e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-6.63010852208788e-07), FLOAT_FIXED(0.0770617513414559), FLOAT_FIXED(0.997026321859031)}, 
-    {FLOAT_FIXED(-6.63005147974198e-07), FLOAT_FIXED(0.0770617513417744), FLOAT_FIXED(0.997026321859006)}, 
-    {FLOAT_FIXED(-6.63010852208789e-07), FLOAT_FIXED(0.0770617513414559), FLOAT_FIXED(0.997026321859031)}, 
-    {FLOAT_FIXED(9.80564344985107e-18), FLOAT_FIXED(0.077061788351462), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-5.93252771397357e-07), FLOAT_FIXED(0.077061755235431), FLOAT_FIXED(0.997026321558103)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-7.51347458798204e-07), FLOAT_FIXED(0.0770612007534076), FLOAT_FIXED(0.997026364414642)}, 
-    {FLOAT_FIXED(-7.51353596813604e-07), FLOAT_FIXED(0.0770618302928189), FLOAT_FIXED(0.997026315756689)}, 
-    {FLOAT_FIXED(-8.66839520106104e-07), FLOAT_FIXED(0.0770602996476211), FLOAT_FIXED(0.997026434061539)}, 
-    {FLOAT_FIXED(-8.66839520096805e-07), FLOAT_FIXED(0.0770602996476211), FLOAT_FIXED(0.997026434061538)}, 
-    {FLOAT_FIXED(-8.6683952001987e-07), FLOAT_FIXED(0.0770602996399551), FLOAT_FIXED(0.997026434062131)}, 
-    {FLOAT_FIXED(0.948228113242439), FLOAT_FIXED(0.0770608227179484), FLOAT_FIXED(0.308099131544894)}, 
-    {FLOAT_FIXED(0.948228113242438), FLOAT_FIXED(0.0770608227179484), FLOAT_FIXED(0.308099131544894)}, 
-    {FLOAT_FIXED(0.948229428971331), FLOAT_FIXED(0.0770599668720274), FLOAT_FIXED(0.308095296196462)}, 
-    {FLOAT_FIXED(0.948228905818861), FLOAT_FIXED(0.0770606814187884), FLOAT_FIXED(0.30809672758541)}, 
-    {FLOAT_FIXED(0.948228952093945), FLOAT_FIXED(0.0770600518889962), FLOAT_FIXED(0.308096742621022)}, 
-    {FLOAT_FIXED(0.948227208603369), FLOAT_FIXED(0.0770680075197551), FLOAT_FIXED(0.30810011859978)}, 
-    {FLOAT_FIXED(0.948228905818861), FLOAT_FIXED(0.0770606814187877), FLOAT_FIXED(0.308096727585409)}, 
-    {FLOAT_FIXED(0.948228113242439), FLOAT_FIXED(0.0770608227179466), FLOAT_FIXED(0.308099131544894)}, 
-    {FLOAT_FIXED(0.948227543793847), FLOAT_FIXED(0.0770685691088224), FLOAT_FIXED(0.308098946519145)}, 
-    {FLOAT_FIXED(0.948228905818861), FLOAT_FIXED(0.0770606814187895), FLOAT_FIXED(0.30809672758541)}, 
-    {FLOAT_FIXED(0.948228905818861), FLOAT_FIXED(0.0770606814187894), FLOAT_FIXED(0.30809672758541)}, 
-    {FLOAT_FIXED(0.948228905818861), FLOAT_FIXED(0.0770606814187884), FLOAT_FIXED(0.308096727585409)}, 
-    {FLOAT_FIXED(-8.66831853426695e-07), FLOAT_FIXED(0.0770596180951551), FLOAT_FIXED(0.997026486738581)}, 
-    {FLOAT_FIXED(2.06304606467106e-17), FLOAT_FIXED(0.077060089627716), FLOAT_FIXED(0.997026450294358)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770689076786453), FLOAT_FIXED(0.997025768708723)}, 
-    {FLOAT_FIXED(-8.66839520106105e-07), FLOAT_FIXED(0.0770602996476212), FLOAT_FIXED(0.997026434061538)}, 
-    {FLOAT_FIXED(-8.66839520106105e-07), FLOAT_FIXED(0.0770602996476211), FLOAT_FIXED(0.997026434061539)}, 
-    {FLOAT_FIXED(-8.66839520076174e-07), FLOAT_FIXED(0.0770602996476211), FLOAT_FIXED(0.997026434061538)}, 
-    {FLOAT_FIXED(-7.5135359687345e-07), FLOAT_FIXED(0.077061830298957), FLOAT_FIXED(0.997026315756214)}, 
-    {FLOAT_FIXED(-7.51346270508812e-07), FLOAT_FIXED(0.0770618302924094), FLOAT_FIXED(0.99702631575672)}, 
-    {FLOAT_FIXED(-7.51353596136038e-07), FLOAT_FIXED(0.0770618302928183), FLOAT_FIXED(0.997026315756689)}, 
-    {FLOAT_FIXED(-5.93247924421513e-07), FLOAT_FIXED(0.0770611256972429), FLOAT_FIXED(0.997026370215915)}, 
-    {FLOAT_FIXED(-9.80567872115329e-18), FLOAT_FIXED(0.0770611588127345), FLOAT_FIXED(0.997026367656562)}, 
-    {FLOAT_FIXED(-5.93252491489106e-07), FLOAT_FIXED(0.0770611256921415), FLOAT_FIXED(0.997026370216309)}, 
-    {FLOAT_FIXED(-5.93257337967736e-07), FLOAT_FIXED(0.0770617552303301), FLOAT_FIXED(0.997026321558498)}, 
-    {FLOAT_FIXED(-5.93247924919796e-07), FLOAT_FIXED(0.0770611256923965), FLOAT_FIXED(0.997026370216289)}, 
-    {FLOAT_FIXED(-6.63010852218493e-07), FLOAT_FIXED(0.077061751341456), FLOAT_FIXED(0.997026321859031)}, 
-    {FLOAT_FIXED(-6.63005147960061e-07), FLOAT_FIXED(0.0770617513417744), FLOAT_FIXED(0.997026321859006)}, 
-    {FLOAT_FIXED(-6.63010852218492e-07), FLOAT_FIXED(0.077061751341456), FLOAT_FIXED(0.997026321859031)}, 
-    {FLOAT_FIXED(-6.63005147945196e-07), FLOAT_FIXED(0.0770617513417744), FLOAT_FIXED(0.997026321859006)}, 
-    {FLOAT_FIXED(-6.63010852162189e-07), FLOAT_FIXED(0.0770617513360396), FLOAT_FIXED(0.99702632185945)}, 
-    {FLOAT_FIXED(-6.62999731693099e-07), FLOAT_FIXED(0.0770611218036491), FLOAT_FIXED(0.99702637051681)}, 
-    {FLOAT_FIXED(-6.63010852152828e-07), FLOAT_FIXED(0.0770617513360396), FLOAT_FIXED(0.99702632185945)}, 
-    {FLOAT_FIXED(8.76764543621018e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-4.50924150662849e-07), FLOAT_FIXED(0.0770611336418526), FLOAT_FIXED(0.997026369601942)}, 
-    {FLOAT_FIXED(-4.50924150668383e-07), FLOAT_FIXED(0.0770611336418526), FLOAT_FIXED(0.997026369601943)}, 
-    {FLOAT_FIXED(-4.50927834419423e-07), FLOAT_FIXED(0.0770617631801702), FLOAT_FIXED(0.997026320944116)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514621), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-4.50926789244946e-07), FLOAT_FIXED(0.0770611336380216), FLOAT_FIXED(0.997026369602238)}, 
-    {FLOAT_FIXED(-4.90121230065309e-07), FLOAT_FIXED(0.0770617609923511), FLOAT_FIXED(0.997026321113198)}, 
-    {FLOAT_FIXED(-1.80765668430087e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-4.90121230065017e-07), FLOAT_FIXED(0.0770617609923511), FLOAT_FIXED(0.997026321113198)}, 
-    {FLOAT_FIXED(-4.90117226132673e-07), FLOAT_FIXED(0.0770611314540687), FLOAT_FIXED(0.99702636977102)}, 
-    {FLOAT_FIXED(-4.90117226132672e-07), FLOAT_FIXED(0.0770611314540687), FLOAT_FIXED(0.99702636977102)}, 
-    {FLOAT_FIXED(9.03822180344261e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.6367605900503e-07), FLOAT_FIXED(0.0770611385120995), FLOAT_FIXED(0.997026369225552)}, 
-    {FLOAT_FIXED(-3.63679029997254e-07), FLOAT_FIXED(0.0770617680504967), FLOAT_FIXED(0.997026320567717)}, 
-    {FLOAT_FIXED(-3.63676059012141e-07), FLOAT_FIXED(0.0770611385120995), FLOAT_FIXED(0.997026369225552)}, 
-    {FLOAT_FIXED(8.54765226418354e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-4.17532959025376e-07), FLOAT_FIXED(0.0770611355057713), FLOAT_FIXED(0.997026369457893)}, 
-    {FLOAT_FIXED(-4.17538632113977e-07), FLOAT_FIXED(0.0770617650439936), FLOAT_FIXED(0.997026320800073)}, 
-    {FLOAT_FIXED(-3.88748049589946e-07), FLOAT_FIXED(0.0770611371125643), FLOAT_FIXED(0.997026369333714)}, 
-    {FLOAT_FIXED(-3.88750010711031e-07), FLOAT_FIXED(0.0770611371124548), FLOAT_FIXED(0.997026369333722)}, 
-    {FLOAT_FIXED(1.87522016558209e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-5.36780078422525e-07), FLOAT_FIXED(0.0770617583878014), FLOAT_FIXED(0.997026321314484)}, 
-    {FLOAT_FIXED(-5.36780078418344e-07), FLOAT_FIXED(0.0770617583878014), FLOAT_FIXED(0.997026321314484)}, 
-    {FLOAT_FIXED(-5.36780077945769e-07), FLOAT_FIXED(0.0770617583878014), FLOAT_FIXED(0.997026321314484)}, 
-    {FLOAT_FIXED(9.37612854829696e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-0.586037426919131), FLOAT_FIXED(0.0770602811519003), FLOAT_FIXED(-0.806611335972161)}, 
-    {FLOAT_FIXED(-0.586037418903236), FLOAT_FIXED(0.0770604575967305), FLOAT_FIXED(-0.806611324939227)}, 
-    {FLOAT_FIXED(-0.586037519698401), FLOAT_FIXED(0.0770610526190983), FLOAT_FIXED(-0.806611194860934)}, 
-    {FLOAT_FIXED(-0.586035841612301), FLOAT_FIXED(0.0770632110189957), FLOAT_FIXED(-0.806612207850342)}, 
-    {FLOAT_FIXED(-0.586038049325276), FLOAT_FIXED(0.0770634905657285), FLOAT_FIXED(-0.806610577146649)}, 
-    {FLOAT_FIXED(-0.586038283368637), FLOAT_FIXED(0.077061421234735), FLOAT_FIXED(-0.806610604804837)}, 
-    {FLOAT_FIXED(-0.586038209000937), FLOAT_FIXED(0.0770599758733221), FLOAT_FIXED(-0.806610796920905)}, 
-    {FLOAT_FIXED(-0.586038158849914), FLOAT_FIXED(0.0770610797873033), FLOAT_FIXED(-0.806610727894081)}, 
-    {FLOAT_FIXED(-0.586036630584318), FLOAT_FIXED(0.0770614467070686), FLOAT_FIXED(-0.80661180318961)}, 
-    {FLOAT_FIXED(-7.88626280718453e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(7.88626280718453e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-3.04718366310808e-07), FLOAT_FIXED(0.0770611418006677), FLOAT_FIXED(0.997026368971395)}, 
-    {FLOAT_FIXED(-7.51352778959081e-07), FLOAT_FIXED(0.0770617464101085), FLOAT_FIXED(0.99702632224012)}, 
-    {FLOAT_FIXED(-7.5135277895636e-07), FLOAT_FIXED(0.0770617464101085), FLOAT_FIXED(0.99702632224012)}, 
-    {FLOAT_FIXED(-7.5134545333485e-07), FLOAT_FIXED(0.0770617464105175), FLOAT_FIXED(0.997026322240088)}, 
-    {FLOAT_FIXED(-7.51345453334848e-07), FLOAT_FIXED(0.0770617464105172), FLOAT_FIXED(0.997026322240088)}, 
-    {FLOAT_FIXED(-7.51345453334849e-07), FLOAT_FIXED(0.0770617464105172), FLOAT_FIXED(0.997026322240088)}, 
-    {FLOAT_FIXED(-7.51352778286416e-07), FLOAT_FIXED(0.077061746410108), FLOAT_FIXED(0.99702632224012)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770611588127347), FLOAT_FIXED(0.997026367656562)}, 
-    {FLOAT_FIXED(1.0510342459304e-17), FLOAT_FIXED(0.0770611588127347), FLOAT_FIXED(0.997026367656562)}, 
-    {FLOAT_FIXED(8.08763513544172e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.41642126754269e-07), FLOAT_FIXED(0.0770611397420483), FLOAT_FIXED(0.997026369130496)}, 
-    {FLOAT_FIXED(-1.21260721348303e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-8.66856810629915e-07), FLOAT_FIXED(0.0770618367403272), FLOAT_FIXED(0.997026315258256)}, 
-    {FLOAT_FIXED(-8.66856810706432e-07), FLOAT_FIXED(0.0770618367474089), FLOAT_FIXED(0.997026315257709)}, 
-    {FLOAT_FIXED(-8.6685681071239e-07), FLOAT_FIXED(0.0770618367474089), FLOAT_FIXED(0.997026315257709)}, 
-    {FLOAT_FIXED(-4.17535473696504e-07), FLOAT_FIXED(0.0770611821198248), FLOAT_FIXED(0.997026365855046)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514621), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(7.62562364944329e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.04718500840607e-07), FLOAT_FIXED(0.077061175822312), FLOAT_FIXED(0.997026366341829)}, 
-    {FLOAT_FIXED(-3.04718500840607e-07), FLOAT_FIXED(0.0770611758223122), FLOAT_FIXED(0.997026366341828)}, 
-    {FLOAT_FIXED(-3.04717295846898e-07), FLOAT_FIXED(0.0770611758222449), FLOAT_FIXED(0.997026366341834)}, 
-    {FLOAT_FIXED(-3.04718500842496e-07), FLOAT_FIXED(0.077061175822312), FLOAT_FIXED(0.997026366341828)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770611588127343), FLOAT_FIXED(0.997026367656562)}, 
-    {FLOAT_FIXED(-3.4164229585655e-07), FLOAT_FIXED(0.0770611778834212), FLOAT_FIXED(0.997026366182511)}, 
-    {FLOAT_FIXED(-2.89095044059532e-07), FLOAT_FIXED(0.0770611749502012), FLOAT_FIXED(0.997026366409239)}, 
-    {FLOAT_FIXED(-3.63676250642962e-07), FLOAT_FIXED(0.077061179116341), FLOAT_FIXED(0.99702636608721)}, 
-    {FLOAT_FIXED(-3.63676250467875e-07), FLOAT_FIXED(0.0770611791163409), FLOAT_FIXED(0.99702636608721)}, 
-    {FLOAT_FIXED(7.82670392647025e-18), FLOAT_FIXED(0.0770617883514624), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.63679221610703e-07), FLOAT_FIXED(0.0770618086524285), FLOAT_FIXED(0.997026317429527)}, 
-    {FLOAT_FIXED(8.31543563316469e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-4.50928129021221e-07), FLOAT_FIXED(0.0770618135264391), FLOAT_FIXED(0.997026317052771)}, 
-    {FLOAT_FIXED(-4.509307676182e-07), FLOAT_FIXED(0.0770618135229026), FLOAT_FIXED(0.997026317053045)}, 
-    {FLOAT_FIXED(-4.50928128999665e-07), FLOAT_FIXED(0.0770618135227553), FLOAT_FIXED(0.997026317053056)}, 
-    {FLOAT_FIXED(-4.50928128991619e-07), FLOAT_FIXED(0.0770618135227553), FLOAT_FIXED(0.997026317053056)}, 
-    {FLOAT_FIXED(-3.88751444180902e-07), FLOAT_FIXED(0.0770618100519869), FLOAT_FIXED(0.997026317321344)}, 
-    {FLOAT_FIXED(-3.88751444352407e-07), FLOAT_FIXED(0.0770618100519866), FLOAT_FIXED(0.997026317321344)}, 
-    {FLOAT_FIXED(-8.87223045872109e-18), FLOAT_FIXED(0.0770699333895151), FLOAT_FIXED(0.99702568942196)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770699333895151), FLOAT_FIXED(0.997025689421961)}, 
-    {FLOAT_FIXED(-5.36832845242482e-07), FLOAT_FIXED(0.0770693337513462), FLOAT_FIXED(0.997025735773573)}, 
-    {FLOAT_FIXED(-5.36829105917292e-07), FLOAT_FIXED(0.0770693337511375), FLOAT_FIXED(0.99702573577359)}, 
-    {FLOAT_FIXED(-8.8722047735372e-18), FLOAT_FIXED(0.0770699333895151), FLOAT_FIXED(0.99702568942196)}, 
-    {FLOAT_FIXED(-8.56117600938224e-18), FLOAT_FIXED(0.077061788351462), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.077061788351462), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.077061788351462), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-4.90120691363213e-07), FLOAT_FIXED(0.0770611861715752), FLOAT_FIXED(0.997026365541849)}, 
-    {FLOAT_FIXED(1.71223520187644e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-4.90121577643591e-07), FLOAT_FIXED(0.0770618157105749), FLOAT_FIXED(0.997026316883937)}, 
-    {FLOAT_FIXED(-4.90121578080786e-07), FLOAT_FIXED(0.0770618157105744), FLOAT_FIXED(0.997026316883937)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514628), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-5.93253281316067e-07), FLOAT_FIXED(0.0770618214723416), FLOAT_FIXED(0.997026316438545)}, 
-    {FLOAT_FIXED(-5.93253281323109e-07), FLOAT_FIXED(0.0770618214723416), FLOAT_FIXED(0.997026316438545)}, 
-    {FLOAT_FIXED(-5.93253281278755e-07), FLOAT_FIXED(0.0770618214674949), FLOAT_FIXED(0.997026316438919)}, 
-    {FLOAT_FIXED(-9.27296477630442e-18), FLOAT_FIXED(0.0770617883514623), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-5.93257848421207e-07), FLOAT_FIXED(0.0770618214677495), FLOAT_FIXED(0.9970263164389)}, 
-    {FLOAT_FIXED(-5.93253280785283e-07), FLOAT_FIXED(0.0770618214723416), FLOAT_FIXED(0.997026316438545)}, 
-    {FLOAT_FIXED(-0.586040031007673), FLOAT_FIXED(0.0770601643305067), FLOAT_FIXED(-0.806609455145351)}, 
-    {FLOAT_FIXED(-0.586033349190563), FLOAT_FIXED(0.0770671928337608), FLOAT_FIXED(-0.806613638258873)}, 
-    {FLOAT_FIXED(-0.586028102295537), FLOAT_FIXED(0.0770675537559765), FLOAT_FIXED(-0.806617415803776)}, 
-    {FLOAT_FIXED(-0.58603942125982), FLOAT_FIXED(0.0770602062711081), FLOAT_FIXED(-0.806609894148906)}, 
-    {FLOAT_FIXED(-0.58603337779476), FLOAT_FIXED(0.0770665632514096), FLOAT_FIXED(-0.806613677629558)}, 
-    {FLOAT_FIXED(-0.586037841610172), FLOAT_FIXED(0.0770622566285854), FLOAT_FIXED(-0.806610845950016)}, 
-    {FLOAT_FIXED(-0.586033724664932), FLOAT_FIXED(0.0770619716327771), FLOAT_FIXED(-0.80661386430151)}, 
-    {FLOAT_FIXED(-0.586038883073071), FLOAT_FIXED(0.0770695704393125), FLOAT_FIXED(-0.806609390497512)}, 
-    {FLOAT_FIXED(-0.586039129194227), FLOAT_FIXED(0.0770641533293543), FLOAT_FIXED(-0.806609729252569)}, 
-    {FLOAT_FIXED(-0.586039100591539), FLOAT_FIXED(0.0770647828922529), FLOAT_FIXED(-0.806609689884538)}, 
-    {FLOAT_FIXED(-0.586038622127883), FLOAT_FIXED(0.0770647497771875), FLOAT_FIXED(-0.806610040674074)}, 
-    {FLOAT_FIXED(-0.586034392009977), FLOAT_FIXED(0.0770578467854079), FLOAT_FIXED(-0.806613773518834)}, 
-    {FLOAT_FIXED(-0.586034392009977), FLOAT_FIXED(0.077057846785408), FLOAT_FIXED(-0.806613773518834)}, 
-    {FLOAT_FIXED(-0.586041750044505), FLOAT_FIXED(0.0770583560889209), FLOAT_FIXED(-0.80660837893097)}, 
-    {FLOAT_FIXED(-0.586041215366329), FLOAT_FIXED(0.0770583190800272), FLOAT_FIXED(-0.806608770937011)}, 
-    {FLOAT_FIXED(-0.586041215366329), FLOAT_FIXED(0.0770583190800264), FLOAT_FIXED(-0.806608770937012)}, 
-    {FLOAT_FIXED(-0.586041778642552), FLOAT_FIXED(0.0770577265778967), FLOAT_FIXED(-0.806608418292371)}, 
-    {FLOAT_FIXED(-0.586035319166296), FLOAT_FIXED(0.0770645211747529), FLOAT_FIXED(-0.806612462255428)}, 
-    {FLOAT_FIXED(-0.586031252872008), FLOAT_FIXED(0.0770642397401865), FLOAT_FIXED(-0.806615443449065)}, 
-    {FLOAT_FIXED(-0.586036931541), FLOAT_FIXED(0.0770628251560788), FLOAT_FIXED(-0.806611452837717)}, 
-    {FLOAT_FIXED(-0.586037466248394), FLOAT_FIXED(0.0770628621714928), FLOAT_FIXED(-0.80661106081376)}, 
-    {FLOAT_FIXED(-0.586037712344516), FLOAT_FIXED(0.0770574451222752), FLOAT_FIXED(-0.806611399535882)}, 
-    {FLOAT_FIXED(-0.586035958846993), FLOAT_FIXED(0.0770645654479664), FLOAT_FIXED(-0.806611993272231)}, 
-    {FLOAT_FIXED(-0.586036040713444), FLOAT_FIXED(0.0770627634880145), FLOAT_FIXED(-0.806612105952112)}, 
-    {FLOAT_FIXED(-0.586035958846993), FLOAT_FIXED(0.0770645654479665), FLOAT_FIXED(-0.806611993272231)}, 
-    {FLOAT_FIXED(-0.586036040713444), FLOAT_FIXED(0.0770627634880147), FLOAT_FIXED(-0.806612105952112)}, 
-    {FLOAT_FIXED(-0.58603625821059), FLOAT_FIXED(0.0770579759591224), FLOAT_FIXED(-0.806612405312251)}, 
-    {FLOAT_FIXED(-0.586035825328304), FLOAT_FIXED(0.0770579459961164), FLOAT_FIXED(-0.806612722680862)}, 
-    {FLOAT_FIXED(-0.58604005714062), FLOAT_FIXED(0.0770648490961675), FLOAT_FIXED(-0.806608988581459)}, 
-    {FLOAT_FIXED(-0.586037637755141), FLOAT_FIXED(0.0770580714476011), FLOAT_FIXED(-0.806611393893708)}, 
-    {FLOAT_FIXED(-0.586039981068724), FLOAT_FIXED(0.0770630362610998), FLOAT_FIXED(-0.806609217050729)}, 
-    {FLOAT_FIXED(-0.586037338390843), FLOAT_FIXED(0.0770646609280862), FLOAT_FIXED(-0.806610981854211)}, 
-    {FLOAT_FIXED(-0.586037338390844), FLOAT_FIXED(0.0770646609280865), FLOAT_FIXED(-0.806610981854211)}, 
-    {FLOAT_FIXED(-0.586034113091826), FLOAT_FIXED(0.0770578274793776), FLOAT_FIXED(-0.806613978007346)}, 
-    {FLOAT_FIXED(-0.586037301034862), FLOAT_FIXED(0.077058048140711), FLOAT_FIXED(-0.806611640761847)}, 
-    {FLOAT_FIXED(-0.586037301034862), FLOAT_FIXED(0.0770580481407106), FLOAT_FIXED(-0.806611640761847)}, 
-    {FLOAT_FIXED(-0.586036849662353), FLOAT_FIXED(0.0770646271025298), FLOAT_FIXED(-0.806611340167848)}, 
-    {FLOAT_FIXED(-0.58604145067812), FLOAT_FIXED(0.0770649455444842), FLOAT_FIXED(-0.806607966893031)}, 
-    {FLOAT_FIXED(-0.586036153256477), FLOAT_FIXED(0.0770579686944671), FLOAT_FIXED(-0.806612482259625)}, 
-    {FLOAT_FIXED(-0.586031552279211), FLOAT_FIXED(0.0770576502260071), FLOAT_FIXED(-0.806615855457146)}, 
-    {FLOAT_FIXED(-0.586036849662354), FLOAT_FIXED(0.0770646271025296), FLOAT_FIXED(-0.806611340167848)}, 
-    {FLOAT_FIXED(-0.586041450678121), FLOAT_FIXED(0.0770649455444841), FLOAT_FIXED(-0.806607966893031)}, 
-    {FLOAT_FIXED(-0.586036058830688), FLOAT_FIXED(0.0770639408271838), FLOAT_FIXED(-0.806611980306751)}, 
-    {FLOAT_FIXED(-0.58603569515551), FLOAT_FIXED(0.077063915656916), FLOAT_FIXED(-0.806612246936049)}, 
-    {FLOAT_FIXED(-0.586038578303451), FLOAT_FIXED(0.0770695493433365), FLOAT_FIXED(-0.806609613942262)}, 
-    {FLOAT_FIXED(-0.586036058830688), FLOAT_FIXED(0.0770639408271839), FLOAT_FIXED(-0.806611980306751)}, 
-    {FLOAT_FIXED(-0.58603632959194), FLOAT_FIXED(0.0770579808999562), FLOAT_FIXED(-0.80661235297882)}, 
-    {FLOAT_FIXED(-0.586035965944909), FLOAT_FIXED(0.0770579557292397), FLOAT_FIXED(-0.806612619587524)}, 
-    {FLOAT_FIXED(-0.586036058830688), FLOAT_FIXED(0.0770639408271846), FLOAT_FIXED(-0.806611980306751)}, 
-    {FLOAT_FIXED(-0.586038460747402), FLOAT_FIXED(0.0770641070656927), FLOAT_FIXED(-0.806610219329623)}, 
-    {FLOAT_FIXED(-0.586038460747402), FLOAT_FIXED(0.0770641070656919), FLOAT_FIXED(-0.806610219329624)}, 
-    {FLOAT_FIXED(-0.586038248660815), FLOAT_FIXED(0.0770695265256575), FLOAT_FIXED(-0.806609855622702)}, 
-    {FLOAT_FIXED(-0.586038248660814), FLOAT_FIXED(0.0770695265256575), FLOAT_FIXED(-0.806609855622702)}, 
-    {FLOAT_FIXED(-0.586033099627555), FLOAT_FIXED(0.0770577573298302), FLOAT_FIXED(-0.806614721026226)}, 
-    {FLOAT_FIXED(-0.586035266387296), FLOAT_FIXED(0.0770627098847922), FLOAT_FIXED(-0.806612673651725)}, 
-    {FLOAT_FIXED(-0.586035483883715), FLOAT_FIXED(0.077057922362186), FLOAT_FIXED(-0.80661297301147)}, 
-    {FLOAT_FIXED(-0.586038765543556), FLOAT_FIXED(0.0770581495100972), FLOAT_FIXED(-0.806610567048476)}, 
-    {FLOAT_FIXED(-0.586035483883715), FLOAT_FIXED(0.0770579223621867), FLOAT_FIXED(-0.80661297301147)}, 
-    {FLOAT_FIXED(-0.58603638128823), FLOAT_FIXED(0.0770579844782403), FLOAT_FIXED(-0.80661231507754)}, 
-    {FLOAT_FIXED(-0.58603854804406), FLOAT_FIXED(0.0770629370593438), FLOAT_FIXED(-0.806610267687064)}, 
-    {FLOAT_FIXED(-0.586036413167364), FLOAT_FIXED(0.0770573551973588), FLOAT_FIXED(-0.806612352032821)}, 
-    {FLOAT_FIXED(-0.586034475966851), FLOAT_FIXED(0.0770572211103154), FLOAT_FIXED(-0.806613772293167)}, 
-    {FLOAT_FIXED(-0.58603724661092), FLOAT_FIXED(0.0770640230344103), FLOAT_FIXED(-0.80661110948117)}, 
-    {FLOAT_FIXED(-0.586039448491933), FLOAT_FIXED(0.0770648069708647), FLOAT_FIXED(-0.806609434818249)}, 
-    {FLOAT_FIXED(-0.586039230973139), FLOAT_FIXED(0.0770695945207493), FLOAT_FIXED(-0.806609135431046)}, 
-    {FLOAT_FIXED(-0.586039530356884), FLOAT_FIXED(0.0770630050603891), FLOAT_FIXED(-0.806609547495035)}, 
-    {FLOAT_FIXED(-0.58603646035737), FLOAT_FIXED(0.0770627925381188), FLOAT_FIXED(-0.806611798288391)}, 
-    {FLOAT_FIXED(-0.58603721800842), FLOAT_FIXED(0.0770646525962577), FLOAT_FIXED(-0.806611070113205)}, 
-    {FLOAT_FIXED(-0.586037799992861), FLOAT_FIXED(0.077058082677267), FLOAT_FIXED(-0.806611274948244)}, 
-    {FLOAT_FIXED(-0.586034398765245), FLOAT_FIXED(0.0770578472529909), FLOAT_FIXED(-0.806613768566216)}, 
-    {FLOAT_FIXED(-0.586037187213271), FLOAT_FIXED(0.0770628428551345), FLOAT_FIXED(-0.806611265390115)}, 
-    {FLOAT_FIXED(-0.586037799992861), FLOAT_FIXED(0.0770580826772662), FLOAT_FIXED(-0.806611274948244)}, 
-    {FLOAT_FIXED(-0.586037283111513), FLOAT_FIXED(0.0770694596908389), FLOAT_FIXED(-0.806610563522595)}, 
-    {FLOAT_FIXED(-0.586041420461831), FLOAT_FIXED(0.0770697460756956), FLOAT_FIXED(-0.806607530179893)}, 
-    {FLOAT_FIXED(-0.586037187213272), FLOAT_FIXED(0.0770628428551345), FLOAT_FIXED(-0.806611265390114)}, 
-    {FLOAT_FIXED(-0.58603758249427), FLOAT_FIXED(0.0770628702186752), FLOAT_FIXED(-0.806610975587322)}, 
-    {FLOAT_FIXED(-0.586034794019889), FLOAT_FIXED(0.077057874611539), FLOAT_FIXED(-0.806613478785483)}, 
-    {FLOAT_FIXED(-0.586034686733568), FLOAT_FIXED(0.0770626697578716), FLOAT_FIXED(-0.806613098625901)}, 
-    {FLOAT_FIXED(-0.586040146884225), FLOAT_FIXED(0.0770576136331259), FLOAT_FIXED(-0.806609614634666)}, 
-    {FLOAT_FIXED(-0.586040146884225), FLOAT_FIXED(0.077057613633126), FLOAT_FIXED(-0.806609614634665)}, 
-    {FLOAT_FIXED(-0.58603951236497), FLOAT_FIXED(0.0770582012030383), FLOAT_FIXED(-0.806610019510284)}, 
-    {FLOAT_FIXED(-0.58603951236497), FLOAT_FIXED(0.0770582012030381), FLOAT_FIXED(-0.806610019510284)}, 
-    {FLOAT_FIXED(-0.586033504968724), FLOAT_FIXED(0.0770637640720717), FLOAT_FIXED(-0.806613852671225)}, 
-    {FLOAT_FIXED(-0.586036465823977), FLOAT_FIXED(0.0770627929165481), FLOAT_FIXED(-0.806611794280522)}, 
-    {FLOAT_FIXED(-0.586036383957708), FLOAT_FIXED(0.0770645948704726), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(-0.586036383957708), FLOAT_FIXED(0.0770645948704723), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(-0.586038456386949), FLOAT_FIXED(0.0770581281111119), FLOAT_FIXED(-0.806610793708845)}, 
-    {FLOAT_FIXED(-0.586038157022236), FLOAT_FIXED(0.0770647175866348), FLOAT_FIXED(-0.806610381669659)}, 
-    {FLOAT_FIXED(-0.586038456386949), FLOAT_FIXED(0.077058128111112), FLOAT_FIXED(-0.806610793708845)}, 
-    {FLOAT_FIXED(-0.586038157022236), FLOAT_FIXED(0.0770647175866344), FLOAT_FIXED(-0.806610381669659)}, 
-    {FLOAT_FIXED(-0.586040188904976), FLOAT_FIXED(0.077058248031264), FLOAT_FIXED(-0.806609523498559)}, 
-    {FLOAT_FIXED(-0.586037317252795), FLOAT_FIXED(0.0770646594650929), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(-0.586037317252795), FLOAT_FIXED(0.077064659465093), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(-0.58603737087767), FLOAT_FIXED(0.0770580529750469), FLOAT_FIXED(-0.806611589556264)}, 
-    {FLOAT_FIXED(-0.586037071492369), FLOAT_FIXED(0.0770646424556859), FLOAT_FIXED(-0.806611177532165)}, 
-    {FLOAT_FIXED(-0.586040217502867), FLOAT_FIXED(0.0770576185211123), FLOAT_FIXED(-0.806609562859905)}, 
-    {FLOAT_FIXED(-0.586037645214715), FLOAT_FIXED(0.0770574404757657), FLOAT_FIXED(-0.806611448752444)}, 
-    {FLOAT_FIXED(-0.586035558842297), FLOAT_FIXED(0.077062098603945), FLOAT_FIXED(-0.806612519572535)}, 
-    {FLOAT_FIXED(-0.586035558842297), FLOAT_FIXED(0.0770620986039449), FLOAT_FIXED(-0.806612519572535)}, 
-    {FLOAT_FIXED(-0.586036600604233), FLOAT_FIXED(0.0770597727244612), FLOAT_FIXED(-0.806611984897255)}, 
-    {FLOAT_FIXED(-0.586039308342894), FLOAT_FIXED(0.0770602140379243), FLOAT_FIXED(-0.806609975446257)}, 
-    {FLOAT_FIXED(-0.586036310585346), FLOAT_FIXED(0.0770604202332051), FLOAT_FIXED(-0.806612133747688)}, 
-    {FLOAT_FIXED(-0.586039336942201), FLOAT_FIXED(0.0770595845119038), FLOAT_FIXED(-0.806610014809634)}, 
-    {FLOAT_FIXED(-0.586036011189839), FLOAT_FIXED(0.0770670097188803), FLOAT_FIXED(-0.806611721711067)}, 
-    {FLOAT_FIXED(-0.586037214232972), FLOAT_FIXED(0.0770669269629596), FLOAT_FIXED(-0.806610855557092)}, 
-    {FLOAT_FIXED(-0.586037513605962), FLOAT_FIXED(0.0770603374858211), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(-0.586037513605962), FLOAT_FIXED(0.0770603374858209), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(-0.586037513605963), FLOAT_FIXED(0.077060337485821), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(-0.586037513605963), FLOAT_FIXED(0.0770603374858212), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(-0.586038221438832), FLOAT_FIXED(0.0770602887988221), FLOAT_FIXED(-0.806610757988667)}, 
-    {FLOAT_FIXED(-0.586038221438832), FLOAT_FIXED(0.0770602887988219), FLOAT_FIXED(-0.806610757988667)}, 
-    {FLOAT_FIXED(0.586037375132735), FLOAT_FIXED(0.0770614210600741), FLOAT_FIXED(-0.806611264694299)}, 
-    {FLOAT_FIXED(0.586037274396795), FLOAT_FIXED(0.0770636383837777), FLOAT_FIXED(-0.80661112604317)}, 
-    {FLOAT_FIXED(0.586035826985261), FLOAT_FIXED(0.0770601397149178), FLOAT_FIXED(-0.806612511901978)}, 
-    {FLOAT_FIXED(0.586038158849914), FLOAT_FIXED(0.0770610797873031), FLOAT_FIXED(-0.806610727894081)}, 
-    {FLOAT_FIXED(0.586038209000937), FLOAT_FIXED(0.0770599758733221), FLOAT_FIXED(-0.806610796920905)}, 
-    {FLOAT_FIXED(0.586038809071709), FLOAT_FIXED(0.0770635328194031), FLOAT_FIXED(-0.806610021119999)}, 
-    {FLOAT_FIXED(0.586038049325276), FLOAT_FIXED(0.0770634905657288), FLOAT_FIXED(-0.806610577146649)}, 
-    {FLOAT_FIXED(0.586034122167421), FLOAT_FIXED(0.0770655491141281), FLOAT_FIXED(-0.806613233709439)}, 
-    {FLOAT_FIXED(0.586038954400663), FLOAT_FIXED(0.07706033393128), FLOAT_FIXED(-0.80661022114735)}, 
-    {FLOAT_FIXED(-0.586036421122909), FLOAT_FIXED(0.077057987235494), FLOAT_FIXED(-0.806612285872629)}, 
-    {FLOAT_FIXED(-0.586039400137859), FLOAT_FIXED(0.0770581934349856), FLOAT_FIXED(-0.806610101790571)}, 
-    {FLOAT_FIXED(-0.586035904204971), FLOAT_FIXED(0.0770693642435577), FLOAT_FIXED(-0.806611574475444)}, 
-    {FLOAT_FIXED(-0.586039211239122), FLOAT_FIXED(0.0770623514410287), FLOAT_FIXED(-0.806609841795032)}, 
-    {FLOAT_FIXED(-0.586036492004052), FLOAT_FIXED(0.0770621632021163), FLOAT_FIXED(-0.806611835421595)}, 
-    {FLOAT_FIXED(-0.586036680900512), FLOAT_FIXED(0.0770580052166289), FLOAT_FIXED(-0.806612095415848)}, 
-    {FLOAT_FIXED(-0.586036164020782), FLOAT_FIXED(0.0770693822278976), FLOAT_FIXED(-0.806611383990343)}, 
-    {FLOAT_FIXED(-0.586037884133225), FLOAT_FIXED(0.0770603119997872), FLOAT_FIXED(-0.806611000839406)}, 
-    {FLOAT_FIXED(-0.586037180646918), FLOAT_FIXED(0.0770603603877738), FLOAT_FIXED(-0.806611507329469)}, 
-    {FLOAT_FIXED(-0.586037584760243), FLOAT_FIXED(0.077066901474771), FLOAT_FIXED(-0.806610588788331)}, 
-    {FLOAT_FIXED(-0.586037584760243), FLOAT_FIXED(0.0770669014747717), FLOAT_FIXED(-0.806610588788332)}, 
-    {FLOAT_FIXED(-0.586036881213405), FLOAT_FIXED(0.0770669498710086), FLOAT_FIXED(-0.806611095321187)}, 
-    {FLOAT_FIXED(-0.586036568940164), FLOAT_FIXED(0.0770604024628037), FLOAT_FIXED(-0.806611947740121)}, 
-    {FLOAT_FIXED(-0.586036568940164), FLOAT_FIXED(0.0770604024628039), FLOAT_FIXED(-0.806611947740121)}, 
-    {FLOAT_FIXED(-0.586037413737415), FLOAT_FIXED(0.0770603443550908), FLOAT_FIXED(-0.806611339511066)}, 
-    {FLOAT_FIXED(-0.586034029286645), FLOAT_FIXED(0.077060577147095), FLOAT_FIXED(-0.806613776207558)}, 
-    {FLOAT_FIXED(-0.586036819200156), FLOAT_FIXED(0.0770669541368296), FLOAT_FIXED(-0.806611139968842)}, 
-    {FLOAT_FIXED(-0.586037147200281), FLOAT_FIXED(0.0770597351282472), FLOAT_FIXED(-0.806611591364345)}, 
-    {FLOAT_FIXED(-0.58603909231853), FLOAT_FIXED(0.0770661701596282), FLOAT_FIXED(-0.806609563352308)}, 
-    {FLOAT_FIXED(-0.586039391711988), FLOAT_FIXED(0.0770595807446793), FLOAT_FIXED(-0.80660997537676)}, 
-    {FLOAT_FIXED(-0.586034057888389), FLOAT_FIXED(0.0770599476179769), FLOAT_FIXED(-0.806613815569745)}, 
-    {FLOAT_FIXED(-0.586038418435077), FLOAT_FIXED(0.077060275248777), FLOAT_FIXED(-0.806610616156703)}, 
-    {FLOAT_FIXED(-0.586035216931458), FLOAT_FIXED(0.0770670643548391), FLOAT_FIXED(-0.806612293551137)}, 
-    {FLOAT_FIXED(-0.586035216931458), FLOAT_FIXED(0.0770670643548393), FLOAT_FIXED(-0.806612293551137)}, 
-    {FLOAT_FIXED(-0.586037347570275), FLOAT_FIXED(0.0770603489062716), FLOAT_FIXED(-0.8066113871495)}, 
-    {FLOAT_FIXED(-0.586037048173431), FLOAT_FIXED(0.0770669383860142), FLOAT_FIXED(-0.806610975115004)}, 
-    {FLOAT_FIXED(-0.586040555558484), FLOAT_FIXED(0.0770595006918247), FLOAT_FIXED(-0.806609137435121)}, 
-    {FLOAT_FIXED(-0.586038418435076), FLOAT_FIXED(0.0770602752487771), FLOAT_FIXED(-0.806610616156704)}, 
-    {FLOAT_FIXED(-0.586035516304496), FLOAT_FIXED(0.0770604748660943), FLOAT_FIXED(-0.806612705604825)}, 
-    {FLOAT_FIXED(-0.586038119062108), FLOAT_FIXED(0.0770668647206558), FLOAT_FIXED(-0.806610204106218)}, 
-    {FLOAT_FIXED(-0.586038418435076), FLOAT_FIXED(0.0770602752487769), FLOAT_FIXED(-0.806610616156704)}, 
-    {FLOAT_FIXED(-0.586035516304496), FLOAT_FIXED(0.0770604748660941), FLOAT_FIXED(-0.806612705604824)}, 
-    {FLOAT_FIXED(-0.586040526959179), FLOAT_FIXED(0.0770601302171685), FLOAT_FIXED(-0.806609098071873)}, 
-    {FLOAT_FIXED(-0.586038119062108), FLOAT_FIXED(0.0770668647206567), FLOAT_FIXED(-0.806610204106218)}, 
-    {FLOAT_FIXED(-0.586035267647238), FLOAT_FIXED(0.0770598644082825), FLOAT_FIXED(-0.806612944584332)}, 
-    {FLOAT_FIXED(-0.586035267647238), FLOAT_FIXED(0.077059864408281), FLOAT_FIXED(-0.806612944584332)}, 
-    {FLOAT_FIXED(-0.586037235503964), FLOAT_FIXED(0.0770669254997495), FLOAT_FIXED(-0.806610840242609)}, 
-    {FLOAT_FIXED(-0.586033988048091), FLOAT_FIXED(0.0770605799835861), FLOAT_FIXED(-0.806613805897868)}, 
-    {FLOAT_FIXED(-0.58603401664741), FLOAT_FIXED(0.0770599504546116), FLOAT_FIXED(-0.806613845261806)}, 
-    {FLOAT_FIXED(-0.586037534876954), FLOAT_FIXED(0.0770603360227353), FLOAT_FIXED(-0.806611252294069)}, 
-    {FLOAT_FIXED(-0.586037196028903), FLOAT_FIXED(0.0770603593297529), FLOAT_FIXED(-0.806611496254888)}, 
-    {FLOAT_FIXED(-0.586037196028904), FLOAT_FIXED(0.0770603593297531), FLOAT_FIXED(-0.806611496254888)}, 
-    {FLOAT_FIXED(-0.58603398804809), FLOAT_FIXED(0.0770605799835858), FLOAT_FIXED(-0.806613805897868)}, 
-    {FLOAT_FIXED(-0.586037235503965), FLOAT_FIXED(0.0770669254997506), FLOAT_FIXED(-0.806610840242608)}, 
-    {FLOAT_FIXED(-0.586037534876954), FLOAT_FIXED(0.0770603360227361), FLOAT_FIXED(-0.806611252294069)}, 
-    {FLOAT_FIXED(-0.586039971342088), FLOAT_FIXED(0.0770667373036891), FLOAT_FIXED(-0.806608870513292)}, 
-    {FLOAT_FIXED(-0.586035711037961), FLOAT_FIXED(0.0770604614717843), FLOAT_FIXED(-0.806612565402986)}, 
-    {FLOAT_FIXED(-0.586035739640856), FLOAT_FIXED(0.0770598319435206), FLOAT_FIXED(-0.806612604764165)}, 
-    {FLOAT_FIXED(-0.586039971342088), FLOAT_FIXED(0.0770667373036889), FLOAT_FIXED(-0.806608870513292)}, 
-    {FLOAT_FIXED(-0.586040406993111), FLOAT_FIXED(0.0770667073354889), FLOAT_FIXED(-0.806608556855068)}, 
-    {FLOAT_FIXED(-0.586035739640857), FLOAT_FIXED(0.0770598319435206), FLOAT_FIXED(-0.806612604764165)}, 
-    {FLOAT_FIXED(-0.586035711037962), FLOAT_FIXED(0.0770604614717848), FLOAT_FIXED(-0.806612565402986)}, 
-    {FLOAT_FIXED(-0.586038669757763), FLOAT_FIXED(0.0770602579619718), FLOAT_FIXED(-0.806610435211066)}, 
-    {FLOAT_FIXED(-0.5860383703848), FLOAT_FIXED(0.0770668474323898), FLOAT_FIXED(-0.806610023160858)}, 
-    {FLOAT_FIXED(-0.586035367460438), FLOAT_FIXED(0.0770604851039982), FLOAT_FIXED(-0.806612812767716)}, 
-    {FLOAT_FIXED(-0.586038370384801), FLOAT_FIXED(0.0770668474323907), FLOAT_FIXED(-0.806610023160858)}, 
-    {FLOAT_FIXED(-0.586035367460437), FLOAT_FIXED(0.0770604851039979), FLOAT_FIXED(-0.806612812767716)}, 
-    {FLOAT_FIXED(-0.5860383703848), FLOAT_FIXED(0.0770668474323897), FLOAT_FIXED(-0.806610023160858)}, 
-    {FLOAT_FIXED(-0.586041562137397), FLOAT_FIXED(0.07706662787357), FLOAT_FIXED(-0.806607725177336)}, 
-    {FLOAT_FIXED(-0.586037698134946), FLOAT_FIXED(0.0770603247933387), FLOAT_FIXED(-0.806611134752949)}, 
-    {FLOAT_FIXED(-0.586037698134946), FLOAT_FIXED(0.0770603247933388), FLOAT_FIXED(-0.806611134752949)}, 
-    {FLOAT_FIXED(-0.586041562137397), FLOAT_FIXED(0.0770666278735699), FLOAT_FIXED(-0.806607725177336)}, 
-    {FLOAT_FIXED(-0.586034373885222), FLOAT_FIXED(0.0770671223467244), FLOAT_FIXED(-0.806612900515576)}, 
-    {FLOAT_FIXED(-0.586034004704106), FLOAT_FIXED(0.0770665201277315), FLOAT_FIXED(-0.806613226277545)}, 
-    {FLOAT_FIXED(-0.586037300380686), FLOAT_FIXED(0.0770603521521172), FLOAT_FIXED(-0.806611421124639)}, 
-    {FLOAT_FIXED(-0.586037300380686), FLOAT_FIXED(0.0770603521521167), FLOAT_FIXED(-0.806611421124639)}, 
-    {FLOAT_FIXED(-0.586037328983266), FLOAT_FIXED(0.077059722624757), FLOAT_FIXED(-0.806611460485874)}, 
-    {FLOAT_FIXED(-0.586036218487068), FLOAT_FIXED(0.0770604265679918), FLOAT_FIXED(-0.806612200055601)}, 
-    {FLOAT_FIXED(-0.586039412179575), FLOAT_FIXED(0.0770661481567899), FLOAT_FIXED(-0.806609333060617)}, 
-    {FLOAT_FIXED(-0.586039383572385), FLOAT_FIXED(0.0770667777359971), FLOAT_FIXED(-0.806609293692733)}, 
-    {FLOAT_FIXED(-0.586036218487068), FLOAT_FIXED(0.0770604265679917), FLOAT_FIXED(-0.806612200055601)}, 
-    {FLOAT_FIXED(-0.586036218487069), FLOAT_FIXED(0.0770604265679932), FLOAT_FIXED(-0.8066122000556)}, 
-    {FLOAT_FIXED(-0.586038527301695), FLOAT_FIXED(0.0770668366382106), FLOAT_FIXED(-0.806609910184992)}, 
-    {FLOAT_FIXED(-0.586039008787679), FLOAT_FIXED(0.0770668035171705), FLOAT_FIXED(-0.806609563527981)}, 
-    {FLOAT_FIXED(-0.586034268720261), FLOAT_FIXED(0.0770605606782479), FLOAT_FIXED(-0.806613603823704)}, 
-    {FLOAT_FIXED(-0.586042670165549), FLOAT_FIXED(0.0770665516525264), FLOAT_FIXED(-0.806606927419807)}, 
-    {FLOAT_FIXED(-0.586037930099499), FLOAT_FIXED(0.0770603088380802), FLOAT_FIXED(-0.806610967744969)}, 
-    {FLOAT_FIXED(-0.586037101176586), FLOAT_FIXED(0.0770621093067823), FLOAT_FIXED(-0.80661139798154)}, 
-    {FLOAT_FIXED(-0.586037189821397), FLOAT_FIXED(0.0770601584806677), FLOAT_FIXED(-0.806611519953177)}, 
-    {FLOAT_FIXED(-0.586037812022119), FLOAT_FIXED(0.0770618992834296), FLOAT_FIXED(-0.806610901587102)}, 
-    {FLOAT_FIXED(-0.586030695606309), FLOAT_FIXED(0.0770569636734558), FLOAT_FIXED(-0.806616543443422)}, 
-    {FLOAT_FIXED(-0.586030429182803), FLOAT_FIXED(0.0770628282576813), FLOAT_FIXED(-0.806616176736338)}, 
-    {FLOAT_FIXED(-0.586037189821397), FLOAT_FIXED(0.0770601584806668), FLOAT_FIXED(-0.806611519953177)}, 
-    {FLOAT_FIXED(-0.586036834673314), FLOAT_FIXED(0.0770679740045711), FLOAT_FIXED(-0.806611031283923)}, 
-    {FLOAT_FIXED(-0.586037545573471), FLOAT_FIXED(0.0770677639697601), FLOAT_FIXED(-0.80661053485243)}, 
-    {FLOAT_FIXED(0.586034784177975), FLOAT_FIXED(0.0770605252237325), FLOAT_FIXED(-0.80661323271176)}, 
-    {FLOAT_FIXED(0.586028102295537), FLOAT_FIXED(0.0770675537559765), FLOAT_FIXED(-0.806617415803776)}, 
-    {FLOAT_FIXED(0.586033349190563), FLOAT_FIXED(0.0770671928337608), FLOAT_FIXED(-0.806613638258872)}, 
-    {FLOAT_FIXED(0.586039421259818), FLOAT_FIXED(0.0770602062711088), FLOAT_FIXED(-0.806609894148907)}, 
-    {FLOAT_FIXED(0.586040270752485), FLOAT_FIXED(0.0770601478399972), FLOAT_FIXED(-0.806609282534755)}, 
-    {FLOAT_FIXED(0.586035411627456), FLOAT_FIXED(0.0770670509619758), FLOAT_FIXED(-0.806612153376493)}, 
-    {FLOAT_FIXED(0.586035711037961), FLOAT_FIXED(0.0770604614717849), FLOAT_FIXED(-0.806612565402986)}, 
-    {FLOAT_FIXED(0.586040706366026), FLOAT_FIXED(0.0770601178769063), FLOAT_FIXED(-0.806608968903028)}, 
-    {FLOAT_FIXED(0.58603253446574), FLOAT_FIXED(0.0770672488771885), FLOAT_FIXED(-0.806614224830038)}, 
-    {FLOAT_FIXED(0.586035741669658), FLOAT_FIXED(0.0770670282588213), FLOAT_FIXED(-0.80661191575692)}, 
-    {FLOAT_FIXED(0.58603704310463), FLOAT_FIXED(0.0770603698483518), FLOAT_FIXED(-0.806611606355882)}, 
-    {FLOAT_FIXED(0.586041673027698), FLOAT_FIXED(0.0770600513862637), FLOAT_FIXED(-0.806608272927598)}, 
-    {FLOAT_FIXED(0.586041701627), FLOAT_FIXED(0.0770594218615565), FLOAT_FIXED(-0.806608312290726)}, 
-    {FLOAT_FIXED(0.58603760975723), FLOAT_FIXED(0.0770597033124073), FLOAT_FIXED(-0.806611258336652)}, 
-    {FLOAT_FIXED(0.586035741669658), FLOAT_FIXED(0.077067028258822), FLOAT_FIXED(-0.80661191575692)}, 
-    {FLOAT_FIXED(0.586031111690265), FLOAT_FIXED(0.0770673467470218), FLOAT_FIXED(-0.806615249171776)}, 
-    {FLOAT_FIXED(0.586037043104631), FLOAT_FIXED(0.0770603698483518), FLOAT_FIXED(-0.806611606355882)}, 
-    {FLOAT_FIXED(0.586033787269206), FLOAT_FIXED(0.0770605937936544), FLOAT_FIXED(-0.806613950451565)}, 
-    {FLOAT_FIXED(0.58603429731958), FLOAT_FIXED(0.0770599311494291), FLOAT_FIXED(-0.806613643187612)}, 
-    {FLOAT_FIXED(0.586039336759934), FLOAT_FIXED(0.0770595845244407), FLOAT_FIXED(-0.806610014940862)}, 
-    {FLOAT_FIXED(0.586039308160627), FLOAT_FIXED(0.0770602140504611), FLOAT_FIXED(-0.806609975577485)}, 
-    {FLOAT_FIXED(0.586038826716069), FLOAT_FIXED(0.0770602471658544), FLOAT_FIXED(-0.806610322205209)}, 
-    {FLOAT_FIXED(0.586042998137708), FLOAT_FIXED(0.0770593326831074), FLOAT_FIXED(-0.806607378828263)}, 
-    {FLOAT_FIXED(0.58603429731958), FLOAT_FIXED(0.0770599311494291), FLOAT_FIXED(-0.806613643187611)}, 
-    {FLOAT_FIXED(0.586037196028904), FLOAT_FIXED(0.0770603593297534), FLOAT_FIXED(-0.806611496254888)}, 
-    {FLOAT_FIXED(0.586033688675017), FLOAT_FIXED(0.0770671694812113), FLOAT_FIXED(-0.806613393842495)}, 
-    {FLOAT_FIXED(0.586037196028903), FLOAT_FIXED(0.0770603593297537), FLOAT_FIXED(-0.806611496254888)}, 
-    {FLOAT_FIXED(0.586034673258279), FLOAT_FIXED(0.0770605328530803), FLOAT_FIXED(-0.806613312570194)}, 
-    {FLOAT_FIXED(0.586037000973475), FLOAT_FIXED(0.0770669416328466), FLOAT_FIXED(-0.806611009097554)}, 
-    {FLOAT_FIXED(0.586034402489416), FLOAT_FIXED(0.0770664927649422), FLOAT_FIXED(-0.806612939886154)}, 
-    {FLOAT_FIXED(0.586037427366147), FLOAT_FIXED(0.0770662846893013), FLOAT_FIXED(-0.806610762071928)}, 
-    {FLOAT_FIXED(0.586034275503924), FLOAT_FIXED(0.0770605602116504), FLOAT_FIXED(-0.806613598939701)}, 
-    {FLOAT_FIXED(0.586038336123742), FLOAT_FIXED(0.0770668497891793), FLOAT_FIXED(-0.806610047827875)}, 
-    {FLOAT_FIXED(0.586031722661794), FLOAT_FIXED(0.0770673047195763), FLOAT_FIXED(-0.806614809297046)}, 
-    {FLOAT_FIXED(0.586036247086383), FLOAT_FIXED(0.0770597970402554), FLOAT_FIXED(-0.806612239419303)}, 
-    {FLOAT_FIXED(0.586042860504197), FLOAT_FIXED(0.0770593421500261), FLOAT_FIXED(-0.80660747792186)}, 
-    {FLOAT_FIXED(0.586042831904898), FLOAT_FIXED(0.0770599716740907), FLOAT_FIXED(-0.806607438558854)}, 
-    {FLOAT_FIXED(0.586035852541243), FLOAT_FIXED(0.0770604517387912), FLOAT_FIXED(-0.806612463525126)}, 
-    {FLOAT_FIXED(0.586035947718238), FLOAT_FIXED(0.0770663864717316), FLOAT_FIXED(-0.806611827373103)}, 
-    {FLOAT_FIXED(0.58603211724706), FLOAT_FIXED(0.077066649961426), FLOAT_FIXED(-0.806614585176)}, 
-    {FLOAT_FIXED(0.586036247086382), FLOAT_FIXED(0.0770597970402554), FLOAT_FIXED(-0.806612239419303)}, 
-    {FLOAT_FIXED(0.586039658249074), FLOAT_FIXED(0.0770601899701621), FLOAT_FIXED(-0.806609723522516)}, 
-    {FLOAT_FIXED(0.586036269567151), FLOAT_FIXED(0.0770669919454316), FLOAT_FIXED(-0.806611535687595)}, 
-    {FLOAT_FIXED(0.586039686848381), FLOAT_FIXED(0.0770595604443355), FLOAT_FIXED(-0.806609762885856)}, 
-    {FLOAT_FIXED(0.586037442336726), FLOAT_FIXED(0.0770597148280181), FLOAT_FIXED(-0.806611378874643)}, 
-    {FLOAT_FIXED(0.586033729888184), FLOAT_FIXED(0.0770671666462284), FLOAT_FIXED(-0.806613364170508)}, 
-    {FLOAT_FIXED(0.586038221438832), FLOAT_FIXED(0.0770602887988221), FLOAT_FIXED(-0.806610757988667)}, 
-    {FLOAT_FIXED(0.586037513605962), FLOAT_FIXED(0.0770603374858212), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(0.586035333600961), FLOAT_FIXED(0.0770670563293086), FLOAT_FIXED(-0.806612209552983)}, 
-    {FLOAT_FIXED(0.586037513605963), FLOAT_FIXED(0.077060337485821), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(0.586035632973996), FLOAT_FIXED(0.0770604668412424), FLOAT_FIXED(-0.806612621606542)}, 
-    {FLOAT_FIXED(0.586040102070415), FLOAT_FIXED(0.077060159442557), FLOAT_FIXED(-0.806609403981868)}, 
-    {FLOAT_FIXED(0.586037214232972), FLOAT_FIXED(0.0770669269629583), FLOAT_FIXED(-0.806610855557092)}, 
-    {FLOAT_FIXED(0.586035239045644), FLOAT_FIXED(0.0770604939367178), FLOAT_FIXED(-0.806612905222167)}, 
-    {FLOAT_FIXED(0.58603493964875), FLOAT_FIXED(0.077067083428714), FLOAT_FIXED(-0.806612493185345)}, 
-    {FLOAT_FIXED(0.586037325456093), FLOAT_FIXED(0.0770669193120382), FLOAT_FIXED(-0.806610775479736)}, 
-    {FLOAT_FIXED(0.586035216931458), FLOAT_FIXED(0.0770670643548393), FLOAT_FIXED(-0.806612293551137)}, 
-    {FLOAT_FIXED(0.586035094553012), FLOAT_FIXED(0.0770670727730768), FLOAT_FIXED(-0.806612381659513)}, 
-    {FLOAT_FIXED(0.586039121834423), FLOAT_FIXED(0.0770667957407684), FLOAT_FIXED(-0.806609482137291)}, 
-    {FLOAT_FIXED(0.586039449864137), FLOAT_FIXED(0.0770595767448059), FLOAT_FIXED(-0.806609933508664)}, 
-    {FLOAT_FIXED(0.586035393926052), FLOAT_FIXED(0.0770604832836206), FLOAT_FIXED(-0.806612793713335)}, 
-    {FLOAT_FIXED(0.586039150443616), FLOAT_FIXED(0.0770661661612777), FLOAT_FIXED(-0.806609521503761)}, 
-    {FLOAT_FIXED(0.586039150443618), FLOAT_FIXED(0.0770661661612776), FLOAT_FIXED(-0.80660952150376)}, 
-    {FLOAT_FIXED(0.586039421259819), FLOAT_FIXED(0.0770602062711087), FLOAT_FIXED(-0.806609894148906)}, 
-    {FLOAT_FIXED(0.586037767329987), FLOAT_FIXED(0.0770628830140247), FLOAT_FIXED(-0.806610840073731)}, 
-    {FLOAT_FIXED(0.586037014943923), FLOAT_FIXED(0.0770640070005574), FLOAT_FIXED(-0.806611279328918)}, 
-    {FLOAT_FIXED(0.586037767329987), FLOAT_FIXED(0.0770628830140246), FLOAT_FIXED(-0.806610840073731)}, 
-    {FLOAT_FIXED(0.586030667200866), FLOAT_FIXED(0.0770575889629003), FLOAT_FIXED(-0.806616504345983)}, 
-    {FLOAT_FIXED(0.586030667200866), FLOAT_FIXED(0.077057588962899), FLOAT_FIXED(-0.806616504345983)}, 
-    {FLOAT_FIXED(0.586037685464278), FLOAT_FIXED(0.0770646849494964), FLOAT_FIXED(-0.806610727395382)}, 
-    {FLOAT_FIXED(-0.94822801024434), FLOAT_FIXED(0.0770621365973727), FLOAT_FIXED(0.308099119912907)}, 
-    {FLOAT_FIXED(-0.948228106740285), FLOAT_FIXED(0.0770608238771339), FLOAT_FIXED(0.308099151266458)}, 
-    {FLOAT_FIXED(-0.948228474818603), FLOAT_FIXED(0.0770607582569684), FLOAT_FIXED(0.308098034852622)}, 
-    {FLOAT_FIXED(-0.948229011111412), FLOAT_FIXED(0.0770620467973936), FLOAT_FIXED(0.30809606201649)}, 
-    {FLOAT_FIXED(-0.948228432199089), FLOAT_FIXED(0.0770607658550958), FLOAT_FIXED(0.308098164121573)}, 
-    {FLOAT_FIXED(-0.948228528922701), FLOAT_FIXED(0.0770642603958845), FLOAT_FIXED(0.30809699236884)}, 
-    {FLOAT_FIXED(-0.948228253026075), FLOAT_FIXED(0.0770632032882303), FLOAT_FIXED(0.308098105904719)}, 
-    {FLOAT_FIXED(-0.948228006713368), FLOAT_FIXED(0.0770621470733403), FLOAT_FIXED(0.308099128159819)}, 
-    {FLOAT_FIXED(-0.9482283734511), FLOAT_FIXED(0.0770618635428979), FLOAT_FIXED(0.308098070376263)}, 
-    {FLOAT_FIXED(0.586038669757763), FLOAT_FIXED(0.0770602579619718), FLOAT_FIXED(-0.806610435211066)}, 
-    {FLOAT_FIXED(0.586035096691589), FLOAT_FIXED(0.0770664450122119), FLOAT_FIXED(-0.806612440084369)}, 
-    {FLOAT_FIXED(0.586038698357072), FLOAT_FIXED(0.0770596284355964), FLOAT_FIXED(-0.80661047457451)}, 
-    {FLOAT_FIXED(0.586035068087397), FLOAT_FIXED(0.0770670745936081), FLOAT_FIXED(-0.806612400713864)}, 
-    {FLOAT_FIXED(0.586032668837413), FLOAT_FIXED(0.0770672396340155), FLOAT_FIXED(-0.806614128087583)}, 
-    {FLOAT_FIXED(0.586036270508461), FLOAT_FIXED(0.0770604229898097), FLOAT_FIXED(-0.806612162601808)}, 
-    {FLOAT_FIXED(0.586036272631907), FLOAT_FIXED(0.07706699173461), FLOAT_FIXED(-0.806611533481067)}, 
-    {FLOAT_FIXED(0.586039308342894), FLOAT_FIXED(0.0770602140379243), FLOAT_FIXED(-0.806609975446257)}, 
-    {FLOAT_FIXED(0.586036310585346), FLOAT_FIXED(0.0770604202332051), FLOAT_FIXED(-0.806612133747688)}, 
-    {FLOAT_FIXED(0.58603657200492), FLOAT_FIXED(0.0770604022520009), FLOAT_FIXED(-0.806611945533589)}, 
-    {FLOAT_FIXED(0.58603625821059), FLOAT_FIXED(0.0770579759591222), FLOAT_FIXED(-0.80661240531225)}, 
-    {FLOAT_FIXED(0.586040356543535), FLOAT_FIXED(0.0770582596347368), FLOAT_FIXED(-0.806609400592624)}, 
-    {FLOAT_FIXED(0.586032477826844), FLOAT_FIXED(0.0770684954927454), FLOAT_FIXED(-0.806614146872353)}, 
-    {FLOAT_FIXED(0.586035958846993), FLOAT_FIXED(0.0770645654479662), FLOAT_FIXED(-0.806611993272231)}, 
-    {FLOAT_FIXED(0.586035525927688), FLOAT_FIXED(0.0770645354850062), FLOAT_FIXED(-0.80661231066798)}, 
-    {FLOAT_FIXED(0.586035987449366), FLOAT_FIXED(0.0770639358868223), FLOAT_FIXED(-0.806612032640152)}, 
-    {FLOAT_FIXED(0.586037149072398), FLOAT_FIXED(0.0770580376222676), FLOAT_FIXED(-0.806611752173808)}, 
-    {FLOAT_FIXED(0.586041750044505), FLOAT_FIXED(0.0770583560889212), FLOAT_FIXED(-0.80660837893097)}, 
-    {FLOAT_FIXED(0.586035853892933), FLOAT_FIXED(0.0770645581839484), FLOAT_FIXED(-0.806612070219566)}, 
-    {FLOAT_FIXED(0.586031252872007), FLOAT_FIXED(0.0770642397401876), FLOAT_FIXED(-0.806615443449065)}, 
-    {FLOAT_FIXED(0.586031035327481), FLOAT_FIXED(0.0770690272212256), FLOAT_FIXED(-0.806615144090523)}, 
-    {FLOAT_FIXED(0.586031035327482), FLOAT_FIXED(0.0770690272212257), FLOAT_FIXED(-0.806615144090522)}, 
-    {FLOAT_FIXED(0.586036931541), FLOAT_FIXED(0.0770628251560791), FLOAT_FIXED(-0.806611452837717)}, 
-    {FLOAT_FIXED(0.586037466248394), FLOAT_FIXED(0.0770628621714931), FLOAT_FIXED(-0.80661106081376)}, 
-    {FLOAT_FIXED(0.586035853892933), FLOAT_FIXED(0.0770645581839489), FLOAT_FIXED(-0.806612070219566)}, 
-    {FLOAT_FIXED(0.58603361418148), FLOAT_FIXED(0.0770644031702106), FLOAT_FIXED(-0.806613712264682)}, 
-    {FLOAT_FIXED(0.586039428554543), FLOAT_FIXED(0.0770575639127371), FLOAT_FIXED(-0.806610141284685)}, 
-    {FLOAT_FIXED(0.58603918245664), FLOAT_FIXED(0.0770629809768445), FLOAT_FIXED(-0.806609802561632)}, 
-    {FLOAT_FIXED(0.586033913585043), FLOAT_FIXED(0.077057813670005), FLOAT_FIXED(-0.806614124275416)}, 
-    {FLOAT_FIXED(0.586039399956731), FLOAT_FIXED(0.0770581934224484), FLOAT_FIXED(-0.806610101923367)}, 
-    {FLOAT_FIXED(0.586034092647328), FLOAT_FIXED(0.0770644362855611), FLOAT_FIXED(-0.806613361478107)}, 
-    {FLOAT_FIXED(0.586043067050752), FLOAT_FIXED(0.0770578157570325), FLOAT_FIXED(-0.806607473677565)}, 
-    {FLOAT_FIXED(0.586033396638256), FLOAT_FIXED(0.0770691906706608), FLOAT_FIXED(-0.806613412902363)}, 
-    {FLOAT_FIXED(0.586033913585044), FLOAT_FIXED(0.0770578136700044), FLOAT_FIXED(-0.806614124275416)}, 
-    {FLOAT_FIXED(0.58603632959194), FLOAT_FIXED(0.0770579808999559), FLOAT_FIXED(-0.80661235297882)}, 
-    {FLOAT_FIXED(0.58603632959194), FLOAT_FIXED(0.0770579808999557), FLOAT_FIXED(-0.80661235297882)}, 
-    {FLOAT_FIXED(0.586036030228307), FLOAT_FIXED(0.0770645703883673), FLOAT_FIXED(-0.806611940938828)}, 
-    {FLOAT_FIXED(0.586038795821633), FLOAT_FIXED(0.07706476179875), FLOAT_FIXED(-0.806609913329134)}, 
-    {FLOAT_FIXED(0.586036112094729), FLOAT_FIXED(0.077062768429427), FLOAT_FIXED(-0.806612053618645)}, 
-    {FLOAT_FIXED(0.586035748425309), FLOAT_FIXED(0.0770627432541851), FLOAT_FIXED(-0.806612320244197)}, 
-    {FLOAT_FIXED(0.586038731537927), FLOAT_FIXED(0.0770581471563201), FLOAT_FIXED(-0.806610591979954)}, 
-    {FLOAT_FIXED(0.586037500628481), FLOAT_FIXED(0.0770646721567681), FLOAT_FIXED(-0.806610862908809)}, 
-    {FLOAT_FIXED(0.586038713877858), FLOAT_FIXED(0.0770629485392668), FLOAT_FIXED(-0.80661014610456)}, 
-    {FLOAT_FIXED(0.58603893137751), FLOAT_FIXED(0.077058160988674), FLOAT_FIXED(-0.806610445466057)}, 
-    {FLOAT_FIXED(0.586037828590512), FLOAT_FIXED(0.0770574531684496), FLOAT_FIXED(-0.806611314309507)}, 
-    {FLOAT_FIXED(0.58603460512501), FLOAT_FIXED(0.077062032582764), FLOAT_FIXED(-0.806613218792121)}, 
-    {FLOAT_FIXED(0.586033881830109), FLOAT_FIXED(0.0770692242555), FLOAT_FIXED(-0.806613057184044)}, 
-    {FLOAT_FIXED(0.586037105338015), FLOAT_FIXED(0.077064644798187), FLOAT_FIXED(-0.806611152718067)}, 
-    {FLOAT_FIXED(0.586037404736196), FLOAT_FIXED(0.0770580553186443), FLOAT_FIXED(-0.806611564732724)}, 
-    {FLOAT_FIXED(0.586037338390844), FLOAT_FIXED(0.0770646609280862), FLOAT_FIXED(-0.806610981854211)}, 
-    {FLOAT_FIXED(0.586037366993355), FLOAT_FIXED(0.0770640313661709), FLOAT_FIXED(-0.806611021222181)}, 
-    {FLOAT_FIXED(0.586037338390843), FLOAT_FIXED(0.0770646609280867), FLOAT_FIXED(-0.806610981854212)}, 
-    {FLOAT_FIXED(0.586037420256702), FLOAT_FIXED(0.0770628589876923), FLOAT_FIXED(-0.806611094532869)}, 
-    {FLOAT_FIXED(0.586037083515694), FLOAT_FIXED(0.0770628356766116), FLOAT_FIXED(-0.806611341416608)}, 
-    {FLOAT_FIXED(0.586033842331476), FLOAT_FIXED(0.077063787421276), FLOAT_FIXED(-0.80661360533436)}, 
-    {FLOAT_FIXED(0.586037366993356), FLOAT_FIXED(0.0770640313661712), FLOAT_FIXED(-0.80661102122218)}, 
-    {FLOAT_FIXED(0.586037001641769), FLOAT_FIXED(0.077064637621232), FLOAT_FIXED(-0.806611228743459)}, 
-    {FLOAT_FIXED(0.586033637163546), FLOAT_FIXED(0.077069207319754), FLOAT_FIXED(-0.806613236561346)}, 
-    {FLOAT_FIXED(0.586033930493034), FLOAT_FIXED(0.0770692276239336), FLOAT_FIXED(-0.806613021506804)}, 
-    {FLOAT_FIXED(0.586039747857301), FLOAT_FIXED(0.077058217503168), FLOAT_FIXED(-0.806609846856946)}, 
-    {FLOAT_FIXED(0.586039776455148), FLOAT_FIXED(0.0770575879932626), FLOAT_FIXED(-0.806609886218276)}, 
-    {FLOAT_FIXED(0.586039747857301), FLOAT_FIXED(0.0770582175031669), FLOAT_FIXED(-0.806609846856945)}, 
-    {FLOAT_FIXED(0.586037517372657), FLOAT_FIXED(0.0770580631150429), FLOAT_FIXED(-0.806611482152747)}, 
-    {FLOAT_FIXED(0.586037000491718), FLOAT_FIXED(0.0770694401280342), FLOAT_FIXED(-0.806610770727134)}, 
-    {FLOAT_FIXED(0.586033637163546), FLOAT_FIXED(0.077069207319753), FLOAT_FIXED(-0.806613236561346)}, 
-    {FLOAT_FIXED(0.586039776455147), FLOAT_FIXED(0.0770575879932626), FLOAT_FIXED(-0.806609886218277)}, 
-    {FLOAT_FIXED(0.5860363815367), FLOAT_FIXED(0.0770645947029119), FLOAT_FIXED(-0.806611683375989)}, 
-    {FLOAT_FIXED(0.586036121736881), FLOAT_FIXED(0.0770645767218048), FLOAT_FIXED(-0.806611873849055)}, 
-    {FLOAT_FIXED(0.58603942873567), FLOAT_FIXED(0.0770575639252747), FLOAT_FIXED(-0.80661014115189)}, 
-    {FLOAT_FIXED(0.586039400137859), FLOAT_FIXED(0.0770581934349861), FLOAT_FIXED(-0.806610101790571)}, 
-    {FLOAT_FIXED(0.586039428735671), FLOAT_FIXED(0.0770575639252738), FLOAT_FIXED(-0.80661014115189)}, 
-    {FLOAT_FIXED(0.586036709498051), FLOAT_FIXED(0.077057375708436), FLOAT_FIXED(-0.806612134777072)}, 
-    {FLOAT_FIXED(0.586036680900512), FLOAT_FIXED(0.0770580052166291), FLOAT_FIXED(-0.806612095415848)}, 
-    {FLOAT_FIXED(0.586036680900512), FLOAT_FIXED(0.0770580052166292), FLOAT_FIXED(-0.806612095415848)}, 
-    {FLOAT_FIXED(0.586036383957708), FLOAT_FIXED(0.0770645948704724), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(0.586038157022236), FLOAT_FIXED(0.0770647175866346), FLOAT_FIXED(-0.806610381669659)}, 
-    {FLOAT_FIXED(0.586036166441788), FLOAT_FIXED(0.0770693823954782), FLOAT_FIXED(-0.806611382215372)}, 
-    {FLOAT_FIXED(0.586036465823977), FLOAT_FIXED(0.0770627929165483), FLOAT_FIXED(-0.806611794280523)}, 
-    {FLOAT_FIXED(0.586036465823977), FLOAT_FIXED(0.0770627929165478), FLOAT_FIXED(-0.806611794280523)}, 
-    {FLOAT_FIXED(0.586038906228795), FLOAT_FIXED(0.0770629618548491), FLOAT_FIXED(-0.806610005080718)}, 
-    {FLOAT_FIXED(0.586038298292242), FLOAT_FIXED(0.0770629197701536), FLOAT_FIXED(-0.806610450794702)}, 
-    {FLOAT_FIXED(0.586037427780774), FLOAT_FIXED(0.0770646671148813), FLOAT_FIXED(-0.806610916317506)}, 
-    {FLOAT_FIXED(0.586035114919375), FLOAT_FIXED(0.077069309609522), FLOAT_FIXED(-0.806612153142851)}, 
-    {FLOAT_FIXED(0.586035332434309), FLOAT_FIXED(0.0770645220930516), FLOAT_FIXED(-0.806612452527965)}, 
-    {FLOAT_FIXED(0.586038544389227), FLOAT_FIXED(0.077057502713718), FLOAT_FIXED(-0.806610789517275)}, 
-    {FLOAT_FIXED(0.586040639736323), FLOAT_FIXED(0.0770576477466909), FLOAT_FIXED(-0.806609253295044)}, 
-    {FLOAT_FIXED(0.58603483936198), FLOAT_FIXED(0.0770692905355399), FLOAT_FIXED(-0.806612355168408)}, 
-    {FLOAT_FIXED(0.586035184520511), FLOAT_FIXED(0.0770645118557237), FLOAT_FIXED(-0.806612560971158)}, 
-    {FLOAT_FIXED(0.586038765543557), FLOAT_FIXED(0.0770581495100975), FLOAT_FIXED(-0.806610567048476)}, 
-    {FLOAT_FIXED(0.586038765543557), FLOAT_FIXED(0.0770581495100977), FLOAT_FIXED(-0.806610567048476)}, 
-    {FLOAT_FIXED(0.586035213122807), FLOAT_FIXED(0.0770638822950124), FLOAT_FIXED(-0.806612600339052)}, 
-    {FLOAT_FIXED(0.586038452037287), FLOAT_FIXED(0.0770581278100391), FLOAT_FIXED(-0.80661079689783)}, 
-    {FLOAT_FIXED(0.586035184520511), FLOAT_FIXED(0.0770645118557235), FLOAT_FIXED(-0.806612560971158)}, 
-    {FLOAT_FIXED(0.586036192392021), FLOAT_FIXED(0.0770621424614633), FLOAT_FIXED(-0.806612055083428)}, 
-    {FLOAT_FIXED(0.586037616617082), FLOAT_FIXED(0.07705806998448), FLOAT_FIXED(-0.806611409391187)}, 
-    {FLOAT_FIXED(0.586035530241308), FLOAT_FIXED(0.0770627281502586), FLOAT_FIXED(-0.806612480206467)}, 
-    {FLOAT_FIXED(0.586035230859594), FLOAT_FIXED(0.0770693176348596), FLOAT_FIXED(-0.806612068140962)}, 
-    {FLOAT_FIXED(0.586037317252795), FLOAT_FIXED(0.0770646594650937), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(0.586035202614992), FLOAT_FIXED(0.0770645131080691), FLOAT_FIXED(-0.806612547705168)}, 
-    {FLOAT_FIXED(0.586038348624085), FLOAT_FIXED(0.0770574891634919), FLOAT_FIXED(-0.80661093304379)}, 
-    {FLOAT_FIXED(0.586035558842297), FLOAT_FIXED(0.0770620986039436), FLOAT_FIXED(-0.806612519572535)}, 
-    {FLOAT_FIXED(0.586037317252795), FLOAT_FIXED(0.0770646594650946), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(0.948228009455931), FLOAT_FIXED(0.077062147322708), FLOAT_FIXED(0.308099119656736)}, 
-    {FLOAT_FIXED(0.948227820446188), FLOAT_FIXED(0.0770647185249468), FLOAT_FIXED(0.308099058243517)}, 
-    {FLOAT_FIXED(0.948228922857829), FLOAT_FIXED(0.0770594006105913), FLOAT_FIXED(0.308096995495602)}, 
-    {FLOAT_FIXED(0.948228006713368), FLOAT_FIXED(0.0770621470733401), FLOAT_FIXED(0.308099128159819)}, 
-    {FLOAT_FIXED(0.948228253026075), FLOAT_FIXED(0.0770632032882306), FLOAT_FIXED(0.308098105904719)}, 
-    {FLOAT_FIXED(0.948228781657472), FLOAT_FIXED(0.0770596937582605), FLOAT_FIXED(0.308097356746645)}, 
-    {FLOAT_FIXED(0.948228432199089), FLOAT_FIXED(0.0770607658550958), FLOAT_FIXED(0.308098164121574)}, 
-    {FLOAT_FIXED(0.948228007465116), FLOAT_FIXED(0.0770621368467285), FLOAT_FIXED(0.308099128404077)}, 
-    {FLOAT_FIXED(0.94822768512491), FLOAT_FIXED(0.0770618530712674), FLOAT_FIXED(0.308100191437586)}, 
-    {FLOAT_FIXED(0.948229777084828), FLOAT_FIXED(0.0770605260891689), FLOAT_FIXED(0.308094084929456)}, 
-    {FLOAT_FIXED(0.948229220175717), FLOAT_FIXED(0.0770606253753512), FLOAT_FIXED(0.30809577410557)}, 
-    {FLOAT_FIXED(0.948226748671078), FLOAT_FIXED(0.0770610659876735), FLOAT_FIXED(0.308103270371346)}, 
-    {FLOAT_FIXED(0.948226748671078), FLOAT_FIXED(0.0770610659876727), FLOAT_FIXED(0.308103270371347)}, 
-    {FLOAT_FIXED(0.948226748671078), FLOAT_FIXED(0.0770610659876722), FLOAT_FIXED(0.308103270371347)}, 
-    {FLOAT_FIXED(0.948229034419425), FLOAT_FIXED(0.0770606584919533), FLOAT_FIXED(0.308096337525767)}, 
-    {FLOAT_FIXED(0.948229080694488), FLOAT_FIXED(0.0770600289623442), FLOAT_FIXED(0.308096352561351)}, 
-    {FLOAT_FIXED(0.948227587881954), FLOAT_FIXED(0.0770609163774388), FLOAT_FIXED(0.308100725001809)}, 
-    {FLOAT_FIXED(0.948230089823033), FLOAT_FIXED(0.0770604703336191), FLOAT_FIXED(0.308093136350299)}, 
-    {FLOAT_FIXED(0.948230089823033), FLOAT_FIXED(0.0770604703336183), FLOAT_FIXED(0.308093136350299)}, 
-    {FLOAT_FIXED(0.948227587881954), FLOAT_FIXED(0.077060916377438), FLOAT_FIXED(0.308100725001809)}, 
-    {FLOAT_FIXED(0.948230089823033), FLOAT_FIXED(0.0770604703336182), FLOAT_FIXED(0.308093136350298)}, 
-    {FLOAT_FIXED(0.948228201459933), FLOAT_FIXED(0.077060806990763), FLOAT_FIXED(0.308098863973877)}, 
-    {FLOAT_FIXED(0.948228169427061), FLOAT_FIXED(0.0770608127015018), FLOAT_FIXED(0.308098961132279)}, 
-    {FLOAT_FIXED(0.948228086648561), FLOAT_FIXED(0.0770684723343522), FLOAT_FIXED(0.308097299992809)}, 
-    {FLOAT_FIXED(0.948228169427061), FLOAT_FIXED(0.0770608127015021), FLOAT_FIXED(0.308098961132279)}, 
-    {FLOAT_FIXED(0.948228702372215), FLOAT_FIXED(0.0770600964087737), FLOAT_FIXED(0.308097500053109)}, 
-    {FLOAT_FIXED(0.94822865609709), FLOAT_FIXED(0.0770607259389273), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(0.948228656097089), FLOAT_FIXED(0.0770607259389273), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(0.94822865609709), FLOAT_FIXED(0.0770607259389265), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(0.948229612358242), FLOAT_FIXED(0.0770605554568324), FLOAT_FIXED(0.308094584567178)}, 
-    {FLOAT_FIXED(0.948227712294023), FLOAT_FIXED(0.0770608941977387), FLOAT_FIXED(0.308100347651683)}, 
-    {FLOAT_FIXED(0.948227544218525), FLOAT_FIXED(0.0770609241615751), FLOAT_FIXED(0.308100857435791)}, 
-    {FLOAT_FIXED(0.948229612358242), FLOAT_FIXED(0.0770605554568323), FLOAT_FIXED(0.308094584567178)}, 
-    {FLOAT_FIXED(0.948229358161037), FLOAT_FIXED(0.0770606007752969), FLOAT_FIXED(0.3080953555795)}, 
-    {FLOAT_FIXED(0.948229150564704), FLOAT_FIXED(0.0770606377856018), FLOAT_FIXED(0.308095985243911)}, 
-    {FLOAT_FIXED(0.948229196839747), FLOAT_FIXED(0.0770600082561607), FLOAT_FIXED(0.308096000279471)}, 
-    {FLOAT_FIXED(0.948229150564704), FLOAT_FIXED(0.0770606377856019), FLOAT_FIXED(0.308095985243912)}, 
-    {FLOAT_FIXED(0.948228581116232), FLOAT_FIXED(0.0770683841851729), FLOAT_FIXED(0.308095800220294)}, 
-    {FLOAT_FIXED(0.948228788733582), FLOAT_FIXED(0.077068347172865), FLOAT_FIXED(0.308095170492635)}, 
-    {FLOAT_FIXED(0.948229042909825), FLOAT_FIXED(0.077068301860274), FLOAT_FIXED(0.308094399544508)}, 
-    {FLOAT_FIXED(0.948229612358243), FLOAT_FIXED(0.0770605554568315), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(0.948227712294023), FLOAT_FIXED(0.0770608941977378), FLOAT_FIXED(0.308100347651683)}, 
-    {FLOAT_FIXED(0.948229042909825), FLOAT_FIXED(0.077068301860274), FLOAT_FIXED(0.308094399544509)}, 
-    {FLOAT_FIXED(0.948227544218525), FLOAT_FIXED(0.0770609241615752), FLOAT_FIXED(0.308100857435792)}, 
-    {FLOAT_FIXED(0.948226918496048), FLOAT_FIXED(0.0770604144292808), FLOAT_FIXED(0.308102910676735)}, 
-    {FLOAT_FIXED(0.948226872220628), FLOAT_FIXED(0.0770610439620005), FLOAT_FIXED(0.308102895640681)}, 
-    {FLOAT_FIXED(0.948229612358243), FLOAT_FIXED(0.0770605554568315), FLOAT_FIXED(0.308094584567178)}, 
-    {FLOAT_FIXED(0.94822818907462), FLOAT_FIXED(0.0770608091987849), FLOAT_FIXED(0.308098901539578)}, 
-    {FLOAT_FIXED(0.948228235349823), FLOAT_FIXED(0.0770601796679606), FLOAT_FIXED(0.308098916575346)}, 
-    {FLOAT_FIXED(0.948227665910516), FLOAT_FIXED(0.0770679259969449), FLOAT_FIXED(0.308098731552767)}, 
-    {FLOAT_FIXED(0.948227619626037), FLOAT_FIXED(0.0770685555902959), FLOAT_FIXED(0.308098716513985)}, 
-    {FLOAT_FIXED(0.94822818907462), FLOAT_FIXED(0.0770608091987853), FLOAT_FIXED(0.308098901539578)}, 
-    {FLOAT_FIXED(0.94822818907462), FLOAT_FIXED(0.0770608091987863), FLOAT_FIXED(0.308098901539578)}, 
-    {FLOAT_FIXED(0.948228915356199), FLOAT_FIXED(0.0770578048401931), FLOAT_FIXED(0.308097417703584)}, 
-    {FLOAT_FIXED(0.948228221340572), FLOAT_FIXED(0.0770602285930273), FLOAT_FIXED(0.308098947454363)}, 
-    {FLOAT_FIXED(0.94822991520626), FLOAT_FIXED(0.0770605386760964), FLOAT_FIXED(0.308093656680689)}, 
-    {FLOAT_FIXED(0.948228406351111), FLOAT_FIXED(0.0770577116476887), FLOAT_FIXED(0.308099007568111)}, 
-    {FLOAT_FIXED(0.948228175065311), FLOAT_FIXED(0.0770608581242461), FLOAT_FIXED(0.308098932418574)}, 
-    {FLOAT_FIXED(0.948228406351111), FLOAT_FIXED(0.0770577116476881), FLOAT_FIXED(0.308099007568111)}, 
-    {FLOAT_FIXED(0.94822840635111), FLOAT_FIXED(0.0770577116476889), FLOAT_FIXED(0.308099007568111)}, 
-    {FLOAT_FIXED(0.948228406351111), FLOAT_FIXED(0.0770577116476889), FLOAT_FIXED(0.308099007568111)}, 
-    {FLOAT_FIXED(0.948229438795988), FLOAT_FIXED(0.077061089467426), FLOAT_FIXED(0.308094985176227)}, 
-    {FLOAT_FIXED(0.948229438795988), FLOAT_FIXED(0.0770610894674274), FLOAT_FIXED(0.308094985176227)}, 
-    {FLOAT_FIXED(0.948227812983584), FLOAT_FIXED(0.0770660916439906), FLOAT_FIXED(0.308098737749914)}, 
-    {FLOAT_FIXED(0.948230416990502), FLOAT_FIXED(0.0770580797723392), FLOAT_FIXED(0.30809272733354)}, 
-    {FLOAT_FIXED(0.948227831190049), FLOAT_FIXED(0.0770576063431723), FLOAT_FIXED(0.308100804058146)}, 
-    {FLOAT_FIXED(0.948227030456231), FLOAT_FIXED(0.0770684992203626), FLOAT_FIXED(0.308100543881504)}, 
-    {FLOAT_FIXED(0.948227749348217), FLOAT_FIXED(0.0770607801912855), FLOAT_FIXED(0.308100262126349)}, 
-    {FLOAT_FIXED(0.948227179915489), FLOAT_FIXED(0.0770685265820046), FLOAT_FIXED(0.308100077052892)}, 
-    {FLOAT_FIXED(0.948230370718943), FLOAT_FIXED(0.0770587092864399), FLOAT_FIXED(0.308092712295057)}, 
-    {FLOAT_FIXED(0.94823006217687), FLOAT_FIXED(0.0770586527952356), FLOAT_FIXED(0.308093676036093)}, 
-    {FLOAT_FIXED(0.948227066175021), FLOAT_FIXED(0.0770685057594321), FLOAT_FIXED(0.308100432315698)}, 
-    {FLOAT_FIXED(0.948227615891003), FLOAT_FIXED(0.077068606396573), FLOAT_FIXED(0.308098715300396)}, 
-    {FLOAT_FIXED(0.948228370353497), FLOAT_FIXED(0.0770583430397631), FLOAT_FIXED(0.308098960440825)}, 
-    {FLOAT_FIXED(0.948228185339957), FLOAT_FIXED(0.0770608600051539), FLOAT_FIXED(0.308098900326109)}, 
-    {FLOAT_FIXED(0.948228185339957), FLOAT_FIXED(0.0770608600051541), FLOAT_FIXED(0.308098900326109)}, 
-    {FLOAT_FIXED(0.948227773116546), FLOAT_FIXED(0.0770607845423783), FLOAT_FIXED(0.308100187887235)}, 
-    {FLOAT_FIXED(0.948228507841424), FLOAT_FIXED(0.0770583682122783), FLOAT_FIXED(0.30809853100151)}, 
-    {FLOAT_FIXED(0.948228370353497), FLOAT_FIXED(0.0770583430397632), FLOAT_FIXED(0.308098960440825)}, 
-    {FLOAT_FIXED(9.07879182720978e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(8.96374890581116e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-9.06045604595484e-18), FLOAT_FIXED(0.0770614735808167), FLOAT_FIXED(0.997026343327774)}, 
-    {FLOAT_FIXED(-8.89997742843801e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(8.78798065877689e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(0.948228701228464), FLOAT_FIXED(0.0770607178929633), FLOAT_FIXED(0.308097348129453)}, 
-    {FLOAT_FIXED(0.94822813177994), FLOAT_FIXED(0.0770684642887677), FLOAT_FIXED(0.308097163104913)}, 
-    {FLOAT_FIXED(0.948230309931276), FLOAT_FIXED(0.0770604310921632), FLOAT_FIXED(0.308092468728995)}, 
-    {FLOAT_FIXED(0.948227609074857), FLOAT_FIXED(0.0770685574712447), FLOAT_FIXED(0.308098748516578)}, 
-    {FLOAT_FIXED(0.948227643042963), FLOAT_FIXED(0.0770679733002134), FLOAT_FIXED(0.308098790099189)}, 
-    {FLOAT_FIXED(0.948228166207334), FLOAT_FIXED(0.0770608565026779), FLOAT_FIXED(0.308098960086123)}, 
-    {FLOAT_FIXED(0.948228825135335), FLOAT_FIXED(0.0770584263053494), FLOAT_FIXED(0.308097539941176)}, 
-    {FLOAT_FIXED(0.948230329950808), FLOAT_FIXED(0.077058063836298), FLOAT_FIXED(0.308092999205082)}, 
-    {FLOAT_FIXED(0.948228989936841), FLOAT_FIXED(0.0770578184950035), FLOAT_FIXED(0.308097184752066)}, 
-    {FLOAT_FIXED(0.948228758656477), FLOAT_FIXED(0.0770609649583834), FLOAT_FIXED(0.308097109587997)}, 
-    {FLOAT_FIXED(0.948228166207334), FLOAT_FIXED(0.0770608565026782), FLOAT_FIXED(0.308098960086123)}, 
-    {FLOAT_FIXED(0.948227596758428), FLOAT_FIXED(0.0770686028939459), FLOAT_FIXED(0.308098775060386)}, 
-    {FLOAT_FIXED(0.948230283678044), FLOAT_FIXED(0.0770586933500439), FLOAT_FIXED(0.308092984170429)}, 
-    {FLOAT_FIXED(0.948226667902216), FLOAT_FIXED(0.0770684328473647), FLOAT_FIXED(0.308101676297796)}, 
-    {FLOAT_FIXED(0.94822803239259), FLOAT_FIXED(0.0770686826462093), FLOAT_FIXED(0.30809741436769)}, 
-    {FLOAT_FIXED(0.948228601842607), FLOAT_FIXED(0.0770609362514802), FLOAT_FIXED(0.308097599392886)}, 
-    {FLOAT_FIXED(0.948226852935309), FLOAT_FIXED(0.0770659158622507), FLOAT_FIXED(0.308101736419503)}, 
-    {FLOAT_FIXED(0.948228786855631), FLOAT_FIXED(0.0770584192967452), FLOAT_FIXED(0.308097659507154)}, 
-    {FLOAT_FIXED(0.94822878685563), FLOAT_FIXED(0.0770584192967453), FLOAT_FIXED(0.308097659507155)}, 
-    {FLOAT_FIXED(0.948228032392589), FLOAT_FIXED(0.0770686826462099), FLOAT_FIXED(0.30809741436769)}, 
-    {FLOAT_FIXED(0.948226667902216), FLOAT_FIXED(0.0770684328473654), FLOAT_FIXED(0.308101676297796)}, 
-    {FLOAT_FIXED(0.948229008529297), FLOAT_FIXED(0.0770610107010395), FLOAT_FIXED(0.308096329113608)}, 
-    {FLOAT_FIXED(0.948229008529297), FLOAT_FIXED(0.0770610107010389), FLOAT_FIXED(0.308096329113608)}, 
-    {FLOAT_FIXED(0.948228670390882), FLOAT_FIXED(0.0770656105845468), FLOAT_FIXED(0.308096219246473)}, 
-    {FLOAT_FIXED(0.948228624109135), FLOAT_FIXED(0.0770662401592081), FLOAT_FIXED(0.308096204208717)}, 
-    {FLOAT_FIXED(0.948228624109135), FLOAT_FIXED(0.0770662401592081), FLOAT_FIXED(0.308096204208718)}, 
-    {FLOAT_FIXED(0.948227505919093), FLOAT_FIXED(0.0770607356285557), FLOAT_FIXED(0.308101022463156)}, 
-    {FLOAT_FIXED(0.9482288050096), FLOAT_FIXED(0.0770662732817593), FLOAT_FIXED(0.308095639165059)}, 
-    {FLOAT_FIXED(0.948227552194174), FLOAT_FIXED(0.0770601060983249), FLOAT_FIXED(0.308101037498999)}, 
-    {FLOAT_FIXED(0.948227505919093), FLOAT_FIXED(0.0770607356285547), FLOAT_FIXED(0.308101022463156)}, 
-    {FLOAT_FIXED(0.948228404799704), FLOAT_FIXED(0.0770607707398046), FLOAT_FIXED(0.308098247226427)}, 
-    {FLOAT_FIXED(0.948228404799704), FLOAT_FIXED(0.0770607707398046), FLOAT_FIXED(0.308098247226426)}, 
-    {FLOAT_FIXED(0.948228404799704), FLOAT_FIXED(0.0770607707398041), FLOAT_FIXED(0.308098247226425)}, 
-    {FLOAT_FIXED(0.948228404799704), FLOAT_FIXED(0.0770607707398047), FLOAT_FIXED(0.308098247226427)}, 
-    {FLOAT_FIXED(0.948228451074871), FLOAT_FIXED(0.0770601412092902), FLOAT_FIXED(0.308098262262146)}, 
-    {FLOAT_FIXED(0.948232062339565), FLOAT_FIXED(0.0770594973888656), FLOAT_FIXED(0.308087308750996)}, 
-    {FLOAT_FIXED(0.948232016067225), FLOAT_FIXED(0.0770601269137856), FLOAT_FIXED(0.308087293709295)}, 
-    {FLOAT_FIXED(0.948229311146629), FLOAT_FIXED(0.0770604280951655), FLOAT_FIXED(0.308095543466926)}, 
-    {FLOAT_FIXED(0.948228533945077), FLOAT_FIXED(0.0770583729915689), FLOAT_FIXED(0.308098449467474)}, 
-    {FLOAT_FIXED(0.948229264871075), FLOAT_FIXED(0.0770610576279943), FLOAT_FIXED(0.308095528431225)}, 
-    {FLOAT_FIXED(0.948226445880827), FLOAT_FIXED(0.0770605415760768), FLOAT_FIXED(0.308104333407072)}, 
-    {FLOAT_FIXED(0.948227964514082), FLOAT_FIXED(0.077066119388823), FLOAT_FIXED(0.308098264447934)}, 
-    {FLOAT_FIXED(0.948228695419364), FLOAT_FIXED(0.0770688040279946), FLOAT_FIXED(0.308095343406851)}, 
-    {FLOAT_FIXED(0.948227964514082), FLOAT_FIXED(0.0770661193888226), FLOAT_FIXED(0.308098264447934)}, 
-    {FLOAT_FIXED(0.948228663062201), FLOAT_FIXED(0.0770601034168517), FLOAT_FIXED(0.308097619284303)}, 
-    {FLOAT_FIXED(0.948228663062201), FLOAT_FIXED(0.0770601034168516), FLOAT_FIXED(0.308097619284302)}, 
-    {FLOAT_FIXED(0.948228776934847), FLOAT_FIXED(0.077060083115946), FLOAT_FIXED(0.308097273897072)}, 
-    {FLOAT_FIXED(0.94822873066067), FLOAT_FIXED(0.0770607126458251), FLOAT_FIXED(0.308097258858584)}, 
-    {FLOAT_FIXED(0.948228730660669), FLOAT_FIXED(0.0770607126458263), FLOAT_FIXED(0.308097258858584)}, 
-    {FLOAT_FIXED(0.948228616787069), FLOAT_FIXED(0.0770607329470618), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(0.948228616787068), FLOAT_FIXED(0.0770607329470628), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(0.948229169698419), FLOAT_FIXED(0.0770584893912307), FLOAT_FIXED(0.30809646370218)}, 
-    {FLOAT_FIXED(0.948227887885962), FLOAT_FIXED(0.0770582547054612), FLOAT_FIXED(0.308100467408076)}, 
-    {FLOAT_FIXED(0.948227364738013), FLOAT_FIXED(0.0770653715248485), FLOAT_FIXED(0.308100297425596)}, 
-    {FLOAT_FIXED(0.948228600265799), FLOAT_FIXED(0.0770662357935393), FLOAT_FIXED(0.30809627868343)}, 
-    {FLOAT_FIXED(0.948227998751358), FLOAT_FIXED(0.0770686764874479), FLOAT_FIXED(0.308097519445495)}, 
-    {FLOAT_FIXED(0.948226716930273), FLOAT_FIXED(0.0770684418229562), FLOAT_FIXED(0.308101523161793)}, 
-    {FLOAT_FIXED(0.948229169698419), FLOAT_FIXED(0.0770584893912309), FLOAT_FIXED(0.30809646370218)}, 
-    {FLOAT_FIXED(0.948227887885962), FLOAT_FIXED(0.0770582547054614), FLOAT_FIXED(0.308100467408076)}, 
-    {FLOAT_FIXED(0.948227318456617), FLOAT_FIXED(0.0770660010975801), FLOAT_FIXED(0.308100282387735)}, 
-    {FLOAT_FIXED(0.948227693621358), FLOAT_FIXED(0.0770608975266302), FLOAT_FIXED(0.308100404287157)}, 
-    {FLOAT_FIXED(0.948227124172718), FLOAT_FIXED(0.0770686439139873), FLOAT_FIXED(0.308100219260546)}, 
-    {FLOAT_FIXED(0.948229009934269), FLOAT_FIXED(0.0770606628571555), FLOAT_FIXED(0.308096411791976)}, 
-    {FLOAT_FIXED(0.948227693621358), FLOAT_FIXED(0.0770608975266301), FLOAT_FIXED(0.308100404287157)}, 
-    {FLOAT_FIXED(0.948228582240323), FLOAT_FIXED(0.0770607391060036), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(0.948228582240323), FLOAT_FIXED(0.077060739106003), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(0.948229163181924), FLOAT_FIXED(0.077060014256625), FLOAT_FIXED(0.308096102367553)}, 
-    {FLOAT_FIXED(0.948229163181924), FLOAT_FIXED(0.0770600142566259), FLOAT_FIXED(0.308096102367553)}, 
-    {FLOAT_FIXED(0.948229109556719), FLOAT_FIXED(0.0770663290438691), FLOAT_FIXED(0.308094687907751)}, 
-    {FLOAT_FIXED(0.94822888044994), FLOAT_FIXED(0.077066287094761), FLOAT_FIXED(0.308095403526377)}, 
-    {FLOAT_FIXED(0.948229496155815), FLOAT_FIXED(0.0770579111777128), FLOAT_FIXED(0.308095603579501)}, 
-    {FLOAT_FIXED(0.948229493963084), FLOAT_FIXED(0.0770610995665556), FLOAT_FIXED(0.308094812861411)}, 
-    {FLOAT_FIXED(0.948229493963083), FLOAT_FIXED(0.0770610995665557), FLOAT_FIXED(0.308094812861412)}, 
-    {FLOAT_FIXED(0.94822834893174), FLOAT_FIXED(0.0770608899527749), FLOAT_FIXED(0.308098389352934)}, 
-    {FLOAT_FIXED(0.94822834893174), FLOAT_FIXED(0.0770608899527752), FLOAT_FIXED(0.308098389352934)}, 
-    {FLOAT_FIXED(0.94822834893174), FLOAT_FIXED(0.0770608899527748), FLOAT_FIXED(0.308098389352934)}, 
-    {FLOAT_FIXED(0.948229323787208), FLOAT_FIXED(0.077061068413428), FLOAT_FIXED(0.308095344406621)}, 
-    {FLOAT_FIXED(0.948226634084137), FLOAT_FIXED(0.0770605760288218), FLOAT_FIXED(0.308103745572127)}, 
-    {FLOAT_FIXED(0.948228552179186), FLOAT_FIXED(0.0770687778046588), FLOAT_FIXED(0.308095790818149)}, 
-    {FLOAT_FIXED(0.948229167906047), FLOAT_FIXED(0.0770604018731782), FLOAT_FIXED(0.308095990878412)}, 
-    {FLOAT_FIXED(0.948228552179186), FLOAT_FIXED(0.0770687778046596), FLOAT_FIXED(0.308095790818149)}, 
-    {FLOAT_FIXED(0.948229360405667), FLOAT_FIXED(0.0770689257689764), FLOAT_FIXED(0.308093266309855)}, 
-    {FLOAT_FIXED(0.948229121630531), FLOAT_FIXED(0.0770610314057966), FLOAT_FIXED(0.308095975842701)}, 
-    {FLOAT_FIXED(0.948229323787208), FLOAT_FIXED(0.0770610684134282), FLOAT_FIXED(0.308095344406621)}, 
-    {FLOAT_FIXED(0.948228832876988), FLOAT_FIXED(0.0770609785454609), FLOAT_FIXED(0.30809687776146)}, 
-    {FLOAT_FIXED(0.948229017892952), FLOAT_FIXED(0.0770584615972295), FLOAT_FIXED(0.3080969378654)}, 
-    {FLOAT_FIXED(0.948228584678854), FLOAT_FIXED(0.0770602951063441), FLOAT_FIXED(0.308097812579156)}, 
-    {FLOAT_FIXED(0.948227199342629), FLOAT_FIXED(0.0770678920721413), FLOAT_FIXED(0.308100175979163)}, 
-    {FLOAT_FIXED(0.948227199342629), FLOAT_FIXED(0.0770678920721413), FLOAT_FIXED(0.308100175979164)}, 
-    {FLOAT_FIXED(0.948227338090704), FLOAT_FIXED(0.0770660046925182), FLOAT_FIXED(0.308100221061509)}, 
-    {FLOAT_FIXED(0.948227153058213), FLOAT_FIXED(0.0770685216652184), FLOAT_FIXED(0.308100160940323)}, 
-    {FLOAT_FIXED(0.9482279075201), FLOAT_FIXED(0.0770582583002431), FLOAT_FIXED(0.308100406081825)}, 
-    {FLOAT_FIXED(0.9482279075201), FLOAT_FIXED(0.077058258300243), FLOAT_FIXED(0.308100406081825)}, 
-    {FLOAT_FIXED(0.948229439780293), FLOAT_FIXED(0.0770585388404729), FLOAT_FIXED(0.308095620101491)}, 
-    {FLOAT_FIXED(0.948229486052831), FLOAT_FIXED(0.0770579093279719), FLOAT_FIXED(0.308095635136214)}, 
-    {FLOAT_FIXED(0.948227216854767), FLOAT_FIXED(0.0770678952780772), FLOAT_FIXED(0.308100121280843)}, 
-    {FLOAT_FIXED(0.948227170570347), FLOAT_FIXED(0.0770685248711803), FLOAT_FIXED(0.308100106242004)}, 
-    {FLOAT_FIXED(0.948227170570347), FLOAT_FIXED(0.0770685248711803), FLOAT_FIXED(0.308100106242005)}, 
-    {FLOAT_FIXED(0.948227971304386), FLOAT_FIXED(0.0770576319962545), FLOAT_FIXED(0.308100366418311)}, 
-    {FLOAT_FIXED(0.948227355602816), FLOAT_FIXED(0.0770660078989275), FLOAT_FIXED(0.308100166363171)}, 
-    {FLOAT_FIXED(0.948227740018163), FLOAT_FIXED(0.0770607784833035), FLOAT_FIXED(0.308100291268271)}, 
-    {FLOAT_FIXED(0.948227740018164), FLOAT_FIXED(0.0770607784833021), FLOAT_FIXED(0.30810029126827)}, 
-    {FLOAT_FIXED(0.948228840402632), FLOAT_FIXED(0.0770609799231332), FLOAT_FIXED(0.308096854255226)}, 
-    {FLOAT_FIXED(0.948227723750314), FLOAT_FIXED(0.0770660753056252), FLOAT_FIXED(0.308099016467575)}, 
-    {FLOAT_FIXED(0.948227723750313), FLOAT_FIXED(0.0770660753056253), FLOAT_FIXED(0.308099016467575)}, 
-    {FLOAT_FIXED(0.948228108167058), FLOAT_FIXED(0.0770608458776527), FLOAT_FIXED(0.308099141372615)}, 
-    {FLOAT_FIXED(0.948227723750313), FLOAT_FIXED(0.0770660753056268), FLOAT_FIXED(0.308099016467575)}, 
-    {FLOAT_FIXED(0.948228840402632), FLOAT_FIXED(0.0770609799231331), FLOAT_FIXED(0.308096854255226)}, 
-    {FLOAT_FIXED(0.948227723750313), FLOAT_FIXED(0.0770660753056255), FLOAT_FIXED(0.308099016467575)}, 
-    {FLOAT_FIXED(0.948228840402632), FLOAT_FIXED(0.0770609799231333), FLOAT_FIXED(0.308096854255226)}, 
-    {FLOAT_FIXED(0.948228108167058), FLOAT_FIXED(0.0770608458776528), FLOAT_FIXED(0.308099141372615)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681383), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681382), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(0.948228551640546), FLOAT_FIXED(0.0770607445612828), FLOAT_FIXED(0.30809780184437)}, 
-    {FLOAT_FIXED(0.948227713783952), FLOAT_FIXED(0.0770608939321179), FLOAT_FIXED(0.308100343132628)}, 
-    {FLOAT_FIXED(0.948227713783952), FLOAT_FIXED(0.0770608939321196), FLOAT_FIXED(0.308100343132628)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681392), FLOAT_FIXED(0.308096578708541)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681384), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(-0.948226047499632), FLOAT_FIXED(0.0770657683903198), FLOAT_FIXED(0.308104252138193)}, 
-    {FLOAT_FIXED(-0.948229104492902), FLOAT_FIXED(0.077058477452776), FLOAT_FIXED(0.308096667371216)}, 
-    {FLOAT_FIXED(-0.948228919473631), FLOAT_FIXED(0.0770609943981667), FLOAT_FIXED(0.308096607278037)}, 
-    {FLOAT_FIXED(-0.948225862458897), FLOAT_FIXED(0.0770682853948273), FLOAT_FIXED(0.308104192036367)}, 
-    {FLOAT_FIXED(-0.948229167906046), FLOAT_FIXED(0.0770604018731784), FLOAT_FIXED(0.308095990878412)}, 
-    {FLOAT_FIXED(-0.948229306642909), FLOAT_FIXED(0.0770585144643634), FLOAT_FIXED(0.308096035956409)}, 
-    {FLOAT_FIXED(-0.948229167906046), FLOAT_FIXED(0.0770604018731787), FLOAT_FIXED(0.308095990878413)}, 
-    {FLOAT_FIXED(-0.948227066175021), FLOAT_FIXED(0.0770685057594322), FLOAT_FIXED(0.308100432315699)}, 
-    {FLOAT_FIXED(-0.948227635622571), FLOAT_FIXED(0.0770607593723833), FLOAT_FIXED(0.308100617342095)}, 
-    {FLOAT_FIXED(-0.948228047847239), FLOAT_FIXED(0.0770608348353311), FLOAT_FIXED(0.308099329779044)}, 
-    {FLOAT_FIXED(-0.948227615891003), FLOAT_FIXED(0.0770686063965732), FLOAT_FIXED(0.308098715300396)}, 
-    {FLOAT_FIXED(-0.948229877165429), FLOAT_FIXED(0.0770611697173358), FLOAT_FIXED(0.308093615923198)}, 
-    {FLOAT_FIXED(-0.94823006217687), FLOAT_FIXED(0.077058652795235), FLOAT_FIXED(0.308093676036093)}, 
-    {FLOAT_FIXED(-0.948227478384732), FLOAT_FIXED(0.0770685812231114), FLOAT_FIXED(0.308099144796587)}, 
-    {FLOAT_FIXED(-0.948228232865467), FLOAT_FIXED(0.0770583178672484), FLOAT_FIXED(0.308099389879797)}, 
-    {FLOAT_FIXED(-0.948228370353497), FLOAT_FIXED(0.0770583430397627), FLOAT_FIXED(0.308098960440825)}, 
-    {FLOAT_FIXED(-0.948229008529297), FLOAT_FIXED(0.0770610107010389), FLOAT_FIXED(0.308096329113608)}, 
-    {FLOAT_FIXED(-0.948229008529297), FLOAT_FIXED(0.077061010701039), FLOAT_FIXED(0.308096329113608)}, 
-    {FLOAT_FIXED(-0.948228827640314), FLOAT_FIXED(0.0770609775868164), FLOAT_FIXED(0.308096894118131)}, 
-    {FLOAT_FIXED(-0.948226213241771), FLOAT_FIXED(0.0770683496125783), FLOAT_FIXED(0.308103096396587)}, 
-    {FLOAT_FIXED(-0.948226782687143), FLOAT_FIXED(0.0770606032323098), FLOAT_FIXED(0.308103281424041)}, 
-    {FLOAT_FIXED(-0.948229008529297), FLOAT_FIXED(0.0770610107010394), FLOAT_FIXED(0.308096329113608)}, 
-    {FLOAT_FIXED(-0.948229054804782), FLOAT_FIXED(0.0770603811685879), FLOAT_FIXED(0.308096344149329)}, 
-    {FLOAT_FIXED(-0.948227393714226), FLOAT_FIXED(0.0770607150880784), FLOAT_FIXED(0.308101372927873)}, 
-    {FLOAT_FIXED(-0.948227393714226), FLOAT_FIXED(0.0770607150880781), FLOAT_FIXED(0.308101372927873)}, 
-    {FLOAT_FIXED(-0.948227009289019), FLOAT_FIXED(0.0770659444900449), FLOAT_FIXED(0.308101248057614)}, 
-    {FLOAT_FIXED(-0.948227578734126), FLOAT_FIXED(0.0770581981034151), FLOAT_FIXED(0.308101433026644)}, 
-    {FLOAT_FIXED(-0.94822975633273), FLOAT_FIXED(0.0770585967980954), FLOAT_FIXED(0.308094631346733)}, 
-    {FLOAT_FIXED(-0.94822975633273), FLOAT_FIXED(0.0770585967980955), FLOAT_FIXED(0.308094631346733)}, 
-    {FLOAT_FIXED(-0.948229802605353), FLOAT_FIXED(0.0770579672851287), FLOAT_FIXED(0.30809464638143)}, 
-    {FLOAT_FIXED(-0.948226169864551), FLOAT_FIXED(0.0770683416715124), FLOAT_FIXED(0.308103231881794)}, 
-    {FLOAT_FIXED(-0.948226739326364), FLOAT_FIXED(0.0770605952946184), FLOAT_FIXED(0.308103416857606)}, 
-    {FLOAT_FIXED(-0.94822864012236), FLOAT_FIXED(0.077060943259105), FLOAT_FIXED(0.308097479826949)}, 
-    {FLOAT_FIXED(-0.948228070672244), FLOAT_FIXED(0.0770686896541391), FLOAT_FIXED(0.3080972948018)}, 
-    {FLOAT_FIXED(-0.948228695319905), FLOAT_FIXED(0.0770577645542495), FLOAT_FIXED(0.308098104982508)}, 
-    {FLOAT_FIXED(-0.948227940855378), FLOAT_FIXED(0.0770680278207468), FLOAT_FIXED(0.308097859890311)}, 
-    {FLOAT_FIXED(-0.948228695319905), FLOAT_FIXED(0.0770577645542494), FLOAT_FIXED(0.308098104982508)}, 
-    {FLOAT_FIXED(-0.948228984685871), FLOAT_FIXED(0.0770610063361686), FLOAT_FIXED(0.308096403588325)}, 
-    {FLOAT_FIXED(-0.948227182204841), FLOAT_FIXED(0.0770606763687281), FLOAT_FIXED(0.308102033562683)}, 
-    {FLOAT_FIXED(-0.948227413495885), FLOAT_FIXED(0.0770575298690154), FLOAT_FIXED(0.308102108700004)}, 
-    {FLOAT_FIXED(-0.948228601842607), FLOAT_FIXED(0.0770609362514798), FLOAT_FIXED(0.308097599392887)}, 
-    {FLOAT_FIXED(-0.948228217423989), FLOAT_FIXED(0.0770661656960103), FLOAT_FIXED(0.308097474487929)}, 
-    {FLOAT_FIXED(-0.948228601842607), FLOAT_FIXED(0.0770609362514803), FLOAT_FIXED(0.308097599392887)}, 
-    {FLOAT_FIXED(-0.948228601842607), FLOAT_FIXED(0.0770609362514805), FLOAT_FIXED(0.308097599392887)}, 
-    {FLOAT_FIXED(-0.948228601842607), FLOAT_FIXED(0.0770609362514806), FLOAT_FIXED(0.308097599392886)}, 
-    {FLOAT_FIXED(-0.948228111495235), FLOAT_FIXED(0.0770608464869187), FLOAT_FIXED(0.308099130977191)}, 
-    {FLOAT_FIXED(-0.948227740018164), FLOAT_FIXED(0.0770607784833022), FLOAT_FIXED(0.308100291268271)}, 
-    {FLOAT_FIXED(-0.948227925032256), FLOAT_FIXED(0.0770582615065154), FLOAT_FIXED(0.308100351383467)}, 
-    {FLOAT_FIXED(-0.948228111495235), FLOAT_FIXED(0.0770608464869186), FLOAT_FIXED(0.308099130977191)}, 
-    {FLOAT_FIXED(-0.948227925032256), FLOAT_FIXED(0.0770582615065153), FLOAT_FIXED(0.308100351383466)}, 
-    {FLOAT_FIXED(-0.948229068311886), FLOAT_FIXED(0.0770584708284091), FLOAT_FIXED(0.308096780382333)}, 
-    {FLOAT_FIXED(-0.948227925032256), FLOAT_FIXED(0.0770582615065158), FLOAT_FIXED(0.308100351383466)}, 
-    {FLOAT_FIXED(-0.948229068311886), FLOAT_FIXED(0.0770584708284094), FLOAT_FIXED(0.308096780382333)}, 
-    {FLOAT_FIXED(-0.948228883299212), FLOAT_FIXED(0.0770609877759414), FLOAT_FIXED(0.308096720268368)}, 
-    {FLOAT_FIXED(-0.948228382414192), FLOAT_FIXED(0.0770583452479408), FLOAT_FIXED(0.308098922769642)}, 
-    {FLOAT_FIXED(-0.948230221282987), FLOAT_FIXED(0.0770586819260828), FLOAT_FIXED(0.308093179063465)}, 
-    {FLOAT_FIXED(-0.948229670080559), FLOAT_FIXED(0.0770579430213379), FLOAT_FIXED(0.308095060324301)}, 
-    {FLOAT_FIXED(-0.948229438795988), FLOAT_FIXED(0.0770610894674263), FLOAT_FIXED(0.308094985176227)}, 
-    {FLOAT_FIXED(-0.948227030456231), FLOAT_FIXED(0.0770684992203628), FLOAT_FIXED(0.308100543881504)}, 
-    {FLOAT_FIXED(-0.94822759990369), FLOAT_FIXED(0.0770607528335979), FLOAT_FIXED(0.308100728907945)}, 
-    {FLOAT_FIXED(-0.948229438795988), FLOAT_FIXED(0.0770610894674269), FLOAT_FIXED(0.308094985176226)}, 
-    {FLOAT_FIXED(-0.948228723416597), FLOAT_FIXED(0.0770584076817415), FLOAT_FIXED(0.308097857657732)}, 
-    {FLOAT_FIXED(-0.9482279075201), FLOAT_FIXED(0.0770582583002435), FLOAT_FIXED(0.308100406081826)}, 
-    {FLOAT_FIXED(-0.948227768781125), FLOAT_FIXED(0.0770601457469275), FLOAT_FIXED(0.308100361002437)}, 
-    {FLOAT_FIXED(-0.948228153985118), FLOAT_FIXED(0.0770661540805015), FLOAT_FIXED(0.308097672638428)}, 
-    {FLOAT_FIXED(-0.948227722505986), FLOAT_FIXED(0.0770607752774785), FLOAT_FIXED(0.308100345966611)}, 
-    {FLOAT_FIXED(-0.9482289310967), FLOAT_FIXED(0.0770609965259305), FLOAT_FIXED(0.308096570973517)}, 
-    {FLOAT_FIXED(-0.9482289310967), FLOAT_FIXED(0.0770609965259302), FLOAT_FIXED(0.308096570973517)}, 
-    {FLOAT_FIXED(-0.948228546676833), FLOAT_FIXED(0.0770662259815027), FLOAT_FIXED(0.308096446068613)}, 
-    {FLOAT_FIXED(-0.948227820636793), FLOAT_FIXED(0.0770582423929251), FLOAT_FIXED(0.308100677457402)}, 
-    {FLOAT_FIXED(-0.948227683147404), FLOAT_FIXED(0.0770582172202405), FLOAT_FIXED(0.308101106897956)}, 
-    {FLOAT_FIXED(-0.948227729420599), FLOAT_FIXED(0.0770575877105448), FLOAT_FIXED(0.308101121929291)}, 
-    {FLOAT_FIXED(-0.948227820636793), FLOAT_FIXED(0.0770582423929254), FLOAT_FIXED(0.308100677457402)}, 
-    {FLOAT_FIXED(-0.948228185339957), FLOAT_FIXED(0.0770608600051542), FLOAT_FIXED(0.308098900326109)}, 
-    {FLOAT_FIXED(-0.948228047847239), FLOAT_FIXED(0.077060834835331), FLOAT_FIXED(0.308099329779044)}, 
-    {FLOAT_FIXED(-0.94822827913881), FLOAT_FIXED(0.0770576883567397), FLOAT_FIXED(0.308099404911088)}, 
-    {FLOAT_FIXED(-0.948227866908895), FLOAT_FIXED(0.0770576128828191), FLOAT_FIXED(0.308100692492255)}, 
-    {FLOAT_FIXED(-0.948228701228464), FLOAT_FIXED(0.0770607178929633), FLOAT_FIXED(0.308097348129454)}, 
-    {FLOAT_FIXED(-0.948228701228464), FLOAT_FIXED(0.0770607178929638), FLOAT_FIXED(0.308097348129453)}, 
-    {FLOAT_FIXED(-0.948228616767582), FLOAT_FIXED(0.0770601116701223), FLOAT_FIXED(0.308097759700434)}, 
-    {FLOAT_FIXED(-0.948228701228464), FLOAT_FIXED(0.0770607178929632), FLOAT_FIXED(0.308097348129454)}, 
-    {FLOAT_FIXED(-0.948228178523442), FLOAT_FIXED(0.0770608110798223), FLOAT_FIXED(0.308098933542192)}, 
-    {FLOAT_FIXED(-0.948228178523442), FLOAT_FIXED(0.0770608110798228), FLOAT_FIXED(0.308098933542192)}, 
-    {FLOAT_FIXED(-0.948229740482939), FLOAT_FIXED(0.0770681775014537), FLOAT_FIXED(0.308092283707759)}, 
-    {FLOAT_FIXED(-0.948228701228464), FLOAT_FIXED(0.0770607178929637), FLOAT_FIXED(0.308097348129454)}, 
-    {FLOAT_FIXED(-0.948227561621783), FLOAT_FIXED(0.0770685964614301), FLOAT_FIXED(0.30809888480855)}, 
-    {FLOAT_FIXED(-0.948228882698004), FLOAT_FIXED(0.0770688383135947), FLOAT_FIXED(0.308094758440139)}, 
-    {FLOAT_FIXED(-0.948229452150193), FLOAT_FIXED(0.0770610919121055), FLOAT_FIXED(0.308094943464281)}, 
-    {FLOAT_FIXED(-0.948228316119619), FLOAT_FIXED(0.0770583331101463), FLOAT_FIXED(0.308099129838494)}, 
-    {FLOAT_FIXED(-0.948229187841378), FLOAT_FIXED(0.0770610435266218), FLOAT_FIXED(0.308095769033378)}, 
-    {FLOAT_FIXED(-0.948225143009198), FLOAT_FIXED(0.0770603030716978), FLOAT_FIXED(0.308108402767084)}, 
-    {FLOAT_FIXED(-0.948228177374749), FLOAT_FIXED(0.0770602205445788), FLOAT_FIXED(0.308099084779853)}, 
-    {FLOAT_FIXED(-0.948228441686488), FLOAT_FIXED(0.0770602689299037), FLOAT_FIXED(0.308098259211675)}, 
-    {FLOAT_FIXED(-0.948228580424448), FLOAT_FIXED(0.0770583815014326), FLOAT_FIXED(0.308098304290395)}, 
-    {FLOAT_FIXED(-0.948228175065311), FLOAT_FIXED(0.0770608581242466), FLOAT_FIXED(0.308098932418574)}, 
-    {FLOAT_FIXED(-0.948228094029474), FLOAT_FIXED(0.0770602052872762), FLOAT_FIXED(0.3080993451053)}, 
-    {FLOAT_FIXED(-0.94822860303636), FLOAT_FIXED(0.0770602984669021), FLOAT_FIXED(0.308097755239965)}, 
-    {FLOAT_FIXED(-0.94822860303636), FLOAT_FIXED(0.077060298466902), FLOAT_FIXED(0.308097755239966)}, 
-    {FLOAT_FIXED(-0.948229172167997), FLOAT_FIXED(0.0770688913077099), FLOAT_FIXED(0.308093854275278)}, 
-    {FLOAT_FIXED(-0.948228175065311), FLOAT_FIXED(0.0770608581242464), FLOAT_FIXED(0.308098932418574)}, 
-    {FLOAT_FIXED(-0.948228169427061), FLOAT_FIXED(0.0770608127015023), FLOAT_FIXED(0.308098961132279)}, 
-    {FLOAT_FIXED(-0.94822865609709), FLOAT_FIXED(0.0770607259389264), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(-0.948228169427061), FLOAT_FIXED(0.0770608127015024), FLOAT_FIXED(0.308098961132279)}, 
-    {FLOAT_FIXED(-0.94822714797007), FLOAT_FIXED(0.0770603735202508), FLOAT_FIXED(0.308102214671472)}, 
-    {FLOAT_FIXED(-0.948228047338535), FLOAT_FIXED(0.0770684793421578), FLOAT_FIXED(0.308097419223914)}, 
-    {FLOAT_FIXED(-0.948228549189369), FLOAT_FIXED(0.0770601237177588), FLOAT_FIXED(0.308097964671674)}, 
-    {FLOAT_FIXED(-0.948228502913282), FLOAT_FIXED(0.0770607532482989), FLOAT_FIXED(0.308097949638812)}, 
-    {FLOAT_FIXED(-0.948228502913282), FLOAT_FIXED(0.0770607532482986), FLOAT_FIXED(0.308097949638813)}, 
-    {FLOAT_FIXED(-0.948228616787069), FLOAT_FIXED(0.0770607329470618), FLOAT_FIXED(0.308097604248628)}, 
-    {FLOAT_FIXED(-0.948229009934269), FLOAT_FIXED(0.0770606628571553), FLOAT_FIXED(0.308096411791977)}, 
-    {FLOAT_FIXED(-0.948229056209336), FLOAT_FIXED(0.0770600333275122), FLOAT_FIXED(0.308096426827566)}, 
-    {FLOAT_FIXED(-0.948229056209336), FLOAT_FIXED(0.0770600333275123), FLOAT_FIXED(0.308096426827566)}, 
-    {FLOAT_FIXED(-0.948228582240323), FLOAT_FIXED(0.0770607391060041), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(-0.948227693621358), FLOAT_FIXED(0.0770608975266306), FLOAT_FIXED(0.308100404287157)}, 
-    {FLOAT_FIXED(-0.948228440485782), FLOAT_FIXED(0.0770684092555477), FLOAT_FIXED(0.30809622676807)}, 
-    {FLOAT_FIXED(-0.948227713783952), FLOAT_FIXED(0.0770608939321192), FLOAT_FIXED(0.308100343132628)}, 
-    {FLOAT_FIXED(-0.948228954902784), FLOAT_FIXED(0.0770606726681396), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(-0.948227713783952), FLOAT_FIXED(0.0770608939321189), FLOAT_FIXED(0.308100343132628)}, 
-    {FLOAT_FIXED(-0.94822838545429), FLOAT_FIXED(0.0770684190660697), FLOAT_FIXED(0.30809639368452)}, 
-    {FLOAT_FIXED(-0.94822838545429), FLOAT_FIXED(0.0770684190660698), FLOAT_FIXED(0.30809639368452)}, 
-    {FLOAT_FIXED(-0.948227310512458), FLOAT_FIXED(0.0770609658256533), FLOAT_FIXED(0.308101566280224)}, 
-    {FLOAT_FIXED(-0.948228954902784), FLOAT_FIXED(0.0770606726681393), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(-0.948229612358242), FLOAT_FIXED(0.0770605554568317), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(-0.948227376142621), FLOAT_FIXED(0.0770609541254135), FLOAT_FIXED(0.308101367220207)}, 
-    {FLOAT_FIXED(-0.948229612358243), FLOAT_FIXED(0.0770605554568317), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(-0.948229612358243), FLOAT_FIXED(0.0770605554568316), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(-0.948227376142621), FLOAT_FIXED(0.0770609541254136), FLOAT_FIXED(0.308101367220207)}, 
-    {FLOAT_FIXED(-0.948229612358242), FLOAT_FIXED(0.0770605554568316), FLOAT_FIXED(0.308094584567177)}, 
-    {FLOAT_FIXED(-0.948227544218525), FLOAT_FIXED(0.0770609241615753), FLOAT_FIXED(0.308100857435791)}, 
-    {FLOAT_FIXED(-0.948227544218525), FLOAT_FIXED(0.0770609241615754), FLOAT_FIXED(0.308100857435791)}, 
-    {FLOAT_FIXED(-0.948229936361055), FLOAT_FIXED(0.0770604976931365), FLOAT_FIXED(0.308093601822556)}, 
-    {FLOAT_FIXED(-0.94822947626648), FLOAT_FIXED(0.0770605797193911), FLOAT_FIXED(0.308094997350992)}, 
-    {FLOAT_FIXED(-0.94822947626648), FLOAT_FIXED(0.077060579719391), FLOAT_FIXED(0.308094997350992)}, 
-    {FLOAT_FIXED(-0.948228047994778), FLOAT_FIXED(0.0770608343501179), FLOAT_FIXED(0.308099329446328)}, 
-    {FLOAT_FIXED(-0.94822947626648), FLOAT_FIXED(0.0770605797193912), FLOAT_FIXED(0.308094997350992)}, 
-    {FLOAT_FIXED(-0.948228654229515), FLOAT_FIXED(0.0770683711511525), FLOAT_FIXED(0.308095578459333)}, 
-    {FLOAT_FIXED(-0.94822926995301), FLOAT_FIXED(0.0770599952216329), FLOAT_FIXED(0.308095778518344)}, 
-    {FLOAT_FIXED(-0.948228109824688), FLOAT_FIXED(0.077060823327255), FLOAT_FIXED(0.308099141911213)}, 
-    {FLOAT_FIXED(-0.948227747907006), FLOAT_FIXED(0.0770608878487866), FLOAT_FIXED(0.308100239635032)}, 
-    {FLOAT_FIXED(-0.948228109824688), FLOAT_FIXED(0.0770608233272552), FLOAT_FIXED(0.308099141911213)}, 
-    {FLOAT_FIXED(-0.948228109824688), FLOAT_FIXED(0.0770608233272548), FLOAT_FIXED(0.308099141911213)}, 
-    {FLOAT_FIXED(-0.948228109824688), FLOAT_FIXED(0.0770608233272549), FLOAT_FIXED(0.308099141911213)}, 
-    {FLOAT_FIXED(-0.948226596068638), FLOAT_FIXED(0.077061093192667), FLOAT_FIXED(0.308103733219893)}, 
-    {FLOAT_FIXED(-0.948226596068638), FLOAT_FIXED(0.0770610931926671), FLOAT_FIXED(0.308103733219893)}, 
-    {FLOAT_FIXED(-0.94822602661987), FLOAT_FIXED(0.0770688395708225), FLOAT_FIXED(0.308103548191027)}, 
-    {FLOAT_FIXED(-0.94822581899609), FLOAT_FIXED(0.0770688765828328), FLOAT_FIXED(0.308104177919507)}, 
-    {FLOAT_FIXED(-0.948229150564704), FLOAT_FIXED(0.0770606377856019), FLOAT_FIXED(0.308095985243911)}, 
-    {FLOAT_FIXED(-0.948228942967754), FLOAT_FIXED(0.0770606747959094), FLOAT_FIXED(0.308096614908791)}, 
-    {FLOAT_FIXED(-0.948228905818861), FLOAT_FIXED(0.0770606814187888), FLOAT_FIXED(0.308096727585409)}, 
-    {FLOAT_FIXED(-0.948228336370361), FLOAT_FIXED(0.0770684278163078), FLOAT_FIXED(0.308096542561289)}, 
-    {FLOAT_FIXED(-0.94822773176745), FLOAT_FIXED(0.0770608907260875), FLOAT_FIXED(0.308100288587431)}, 
-    {FLOAT_FIXED(-0.948228905818861), FLOAT_FIXED(0.0770606814187886), FLOAT_FIXED(0.308096727585409)}, 
-    {FLOAT_FIXED(-0.948228113242439), FLOAT_FIXED(0.0770608227179476), FLOAT_FIXED(0.308099131544894)}, 
-    {FLOAT_FIXED(-0.948228113242439), FLOAT_FIXED(0.0770608227179477), FLOAT_FIXED(0.308099131544894)}, 
-    {FLOAT_FIXED(-0.948228952093945), FLOAT_FIXED(0.0770600518889955), FLOAT_FIXED(0.308096742621022)}, 
-    {FLOAT_FIXED(-0.948228952093945), FLOAT_FIXED(0.0770600518889956), FLOAT_FIXED(0.308096742621022)}, 
-    {FLOAT_FIXED(-0.948229080694488), FLOAT_FIXED(0.0770600289623444), FLOAT_FIXED(0.308096352561351)}, 
-    {FLOAT_FIXED(-0.948228848662638), FLOAT_FIXED(0.0770606916085547), FLOAT_FIXED(0.30809690094634)}, 
-    {FLOAT_FIXED(-0.948226225507045), FLOAT_FIXED(0.0770681827716839), FLOAT_FIXED(0.30810310038189)}, 
-    {FLOAT_FIXED(-0.948226748671079), FLOAT_FIXED(0.0770610659876723), FLOAT_FIXED(0.308103270371346)}, 
-    {FLOAT_FIXED(-0.948229823359768), FLOAT_FIXED(0.0770598965606287), FLOAT_FIXED(0.308094099964878)}, 
-    {FLOAT_FIXED(-0.948226968203802), FLOAT_FIXED(0.0770680503748728), FLOAT_FIXED(0.308100847747036)}, 
-    {FLOAT_FIXED(-0.948225833351329), FLOAT_FIXED(0.0770688740238024), FLOAT_FIXED(0.308104134379726)}, 
-    {FLOAT_FIXED(-0.948224657416538), FLOAT_FIXED(0.0770690836495694), FLOAT_FIXED(0.308107700995457)}, 
-    {FLOAT_FIXED(-0.948228121807429), FLOAT_FIXED(0.0770608211910045), FLOAT_FIXED(0.308099105566574)}, 
-    {FLOAT_FIXED(-0.948229297660477), FLOAT_FIXED(0.0770606115613563), FLOAT_FIXED(0.30809553908505)}, 
-    {FLOAT_FIXED(-0.948229297660477), FLOAT_FIXED(0.0770606115613557), FLOAT_FIXED(0.30809553908505)}, 
-    {FLOAT_FIXED(-0.94822812180743), FLOAT_FIXED(0.0770608211910039), FLOAT_FIXED(0.308099105566573)}, 
-    {FLOAT_FIXED(-0.94822906240342), FLOAT_FIXED(0.0770606535029764), FLOAT_FIXED(0.308096252647163)}, 
-    {FLOAT_FIXED(-0.948228357069324), FLOAT_FIXED(0.0770607792490793), FLOAT_FIXED(0.308098391996998)}, 
-    {FLOAT_FIXED(-0.948229297660478), FLOAT_FIXED(0.0770606115613564), FLOAT_FIXED(0.30809553908505)}, 
-    {FLOAT_FIXED(-0.948228728212023), FLOAT_FIXED(0.0770683579621601), FLOAT_FIXED(0.308095354061734)}, 
-    {FLOAT_FIXED(-0.94822640280012), FLOAT_FIXED(0.077061127647267), FLOAT_FIXED(0.308104319408989)}, 
-    {FLOAT_FIXED(-0.948229108680412), FLOAT_FIXED(0.0770600239730636), FLOAT_FIXED(0.308096267676877)}, 
-    {FLOAT_FIXED(-0.948228168084577), FLOAT_FIXED(0.0770601916597382), FLOAT_FIXED(0.308099120596492)}, 
-    {FLOAT_FIXED(-0.948227552335048), FLOAT_FIXED(0.0770685675861918), FLOAT_FIXED(0.308098920613001)}, 
-    {FLOAT_FIXED(-0.948225806322804), FLOAT_FIXED(0.0770658494427935), FLOAT_FIXED(0.308104974112931)}, 
-    {FLOAT_FIXED(-0.948225806322804), FLOAT_FIXED(0.0770658494427934), FLOAT_FIXED(0.308104974112931)}, 
-    {FLOAT_FIXED(-0.948227650758613), FLOAT_FIXED(0.0770673840145341), FLOAT_FIXED(0.308098913756536)}, 
-    {FLOAT_FIXED(-0.948227650758613), FLOAT_FIXED(0.0770673840145341), FLOAT_FIXED(0.308098913756537)}, 
-    {FLOAT_FIXED(-0.948227953318404), FLOAT_FIXED(0.0770669124505945), FLOAT_FIXED(0.308098100531183)}, 
-    {FLOAT_FIXED(-0.948228319399078), FLOAT_FIXED(0.0770619325221308), FLOAT_FIXED(0.308098219478066)}, 
-    {FLOAT_FIXED(-0.948228066963593), FLOAT_FIXED(0.0770617225043025), FLOAT_FIXED(0.30809904892284)}, 
-    {FLOAT_FIXED(-0.948228016860046), FLOAT_FIXED(0.0770624040698196), FLOAT_FIXED(0.308099032651264)}, 
-    {FLOAT_FIXED(0.586037224695452), FLOAT_FIXED(0.0770593909859453), FLOAT_FIXED(-0.806611567938452)}, 
-    {FLOAT_FIXED(0.5860369891744), FLOAT_FIXED(0.0770645740928419), FLOAT_FIXED(-0.806611243871107)}, 
-    {FLOAT_FIXED(0.58603768095877), FLOAT_FIXED(0.0770647841184195), FLOAT_FIXED(-0.806610721194089)}, 
-    {FLOAT_FIXED(0.586037224695452), FLOAT_FIXED(0.0770593909859454), FLOAT_FIXED(-0.806611567938452)}, 
-    {FLOAT_FIXED(0.586037947396035), FLOAT_FIXED(0.0770589194545374), FLOAT_FIXED(-0.806611087913092)}, 
-    {FLOAT_FIXED(0.58603768095877), FLOAT_FIXED(0.0770647841184191), FLOAT_FIXED(-0.806610721194089)}, 
-    {FLOAT_FIXED(0.58602974842236), FLOAT_FIXED(0.0770623758069855), FLOAT_FIXED(-0.806616714554694)}, 
-    {FLOAT_FIXED(0.586029717451766), FLOAT_FIXED(0.0770630573782118), FLOAT_FIXED(-0.806616671939606)}, 
-    {FLOAT_FIXED(0.586036958201656), FLOAT_FIXED(0.0770652556832782), FLOAT_FIXED(-0.806611201253876)}, 
-    {FLOAT_FIXED(0.948228350424588), FLOAT_FIXED(0.0770615104559561), FLOAT_FIXED(0.308098229558871)}, 
-    {FLOAT_FIXED(0.948228150115686), FLOAT_FIXED(0.0770642353858753), FLOAT_FIXED(0.308098164474529)}, 
-    {FLOAT_FIXED(0.948229282800615), FLOAT_FIXED(0.0770633956988915), FLOAT_FIXED(0.308094888439889)}, 
-    {FLOAT_FIXED(0.948228350424589), FLOAT_FIXED(0.0770615104559552), FLOAT_FIXED(0.30809822955887)}, 
-    {FLOAT_FIXED(0.948228300323548), FLOAT_FIXED(0.0770621920214878), FLOAT_FIXED(0.308098213280048)}, 
-    {FLOAT_FIXED(0.948228766580398), FLOAT_FIXED(0.0770558489128068), FLOAT_FIXED(0.308098364776162)}, 
-    {FLOAT_FIXED(0.94823163617093), FLOAT_FIXED(0.077061651056314), FLOAT_FIXED(0.30808808172514)}, 
-    {FLOAT_FIXED(0.948231836467296), FLOAT_FIXED(0.0770589262144768), FLOAT_FIXED(0.30808814680304)}, 
-    {FLOAT_FIXED(0.948233249185244), FLOAT_FIXED(0.0770599070628267), FLOAT_FIXED(0.308083553379702)}, 
-    {FLOAT_FIXED(0.948229058908403), FLOAT_FIXED(0.0770606541260668), FLOAT_FIXED(0.308096263247946)}, 
-    {FLOAT_FIXED(0.948229479296073), FLOAT_FIXED(0.0770644016236977), FLOAT_FIXED(0.308094032068588)}, 
-    {FLOAT_FIXED(0.948234455121582), FLOAT_FIXED(0.0770642212853651), FLOAT_FIXED(0.308078762523411)}, 
-    {FLOAT_FIXED(0.948222084161528), FLOAT_FIXED(0.0770519710249197), FLOAT_FIXED(0.308119900151779)}, 
-    {FLOAT_FIXED(0.94822909619744), FLOAT_FIXED(0.0770638007355446), FLOAT_FIXED(0.308095361439894)}, 
-    {FLOAT_FIXED(0.948228616433843), FLOAT_FIXED(0.0770632698208568), FLOAT_FIXED(0.308096970807047)}, 
-    {FLOAT_FIXED(0.948230175129813), FLOAT_FIXED(0.077063555188187), FLOAT_FIXED(0.308092102195173)}, 
-    {FLOAT_FIXED(0.94823052054649), FLOAT_FIXED(0.077063937443475), FLOAT_FIXED(0.308090943472606)}, 
-    {FLOAT_FIXED(0.586025813608979), FLOAT_FIXED(0.0770611812048435), FLOAT_FIXED(-0.80661968742106)}, 
-    {FLOAT_FIXED(0.586022758801378), FLOAT_FIXED(0.0770602537726354), FLOAT_FIXED(-0.806621995395191)}, 
-    {FLOAT_FIXED(0.586025929722721), FLOAT_FIXED(0.0770607558213416), FLOAT_FIXED(-0.806619643701332)}, 
-    {FLOAT_FIXED(0.586035174179169), FLOAT_FIXED(0.077060184616541), FLOAT_FIXED(-0.806612981901268)}, 
-    {FLOAT_FIXED(0.58603517417917), FLOAT_FIXED(0.0770601846165409), FLOAT_FIXED(-0.806612981901268)}, 
-    {FLOAT_FIXED(0.586034178967885), FLOAT_FIXED(0.0770605668516437), FLOAT_FIXED(-0.806613668442297)}, 
-    {FLOAT_FIXED(0.586029983930877), FLOAT_FIXED(0.0770571927623625), FLOAT_FIXED(-0.806617038610988)}, 
-    {FLOAT_FIXED(0.58603768095877), FLOAT_FIXED(0.0770647841184192), FLOAT_FIXED(-0.806610721194089)}, 
-    {FLOAT_FIXED(0.586043030971807), FLOAT_FIXED(0.0770584447509792), FLOAT_FIXED(-0.806607439800761)}, 
-    {FLOAT_FIXED(0.586040267101524), FLOAT_FIXED(0.0770636440758808), FLOAT_FIXED(-0.806608951163648)}, 
-    {FLOAT_FIXED(0.586042804988073), FLOAT_FIXED(0.0770641355131283), FLOAT_FIXED(-0.806607060308379)}, 
-    {FLOAT_FIXED(-0.586019484092717), FLOAT_FIXED(0.0770731001562397), FLOAT_FIXED(-0.806623147136265)}, 
-    {FLOAT_FIXED(-0.58602129091354), FLOAT_FIXED(0.0770648556180259), FLOAT_FIXED(-0.806622622187477)}, 
-    {FLOAT_FIXED(-0.586042685212988), FLOAT_FIXED(0.0770623613297972), FLOAT_FIXED(-0.806607316836778)}, 
-    {FLOAT_FIXED(-0.948228066963592), FLOAT_FIXED(0.0770617225043025), FLOAT_FIXED(0.30809904892284)}, 
-    {FLOAT_FIXED(-0.948228319399078), FLOAT_FIXED(0.077061932522131), FLOAT_FIXED(0.308098219478067)}, 
-    {FLOAT_FIXED(-0.586035471248151), FLOAT_FIXED(0.0770637624148888), FLOAT_FIXED(-0.806612424254313)}, 
-    {FLOAT_FIXED(-0.586035337031669), FLOAT_FIXED(0.0770634578521073), FLOAT_FIXED(-0.80661255086569)}, 
-    {FLOAT_FIXED(-0.586059784947422), FLOAT_FIXED(0.0770588055490972), FLOAT_FIXED(-0.806595232415074)}, 
-    {FLOAT_FIXED(-0.94822640280012), FLOAT_FIXED(0.0770611276472673), FLOAT_FIXED(0.308104319408989)}, 
-    {FLOAT_FIXED(-0.948229343935497), FLOAT_FIXED(0.0770599820321268), FLOAT_FIXED(0.308095554120577)}, 
-    {FLOAT_FIXED(-0.948228403344499), FLOAT_FIXED(0.0770601497184963), FLOAT_FIXED(0.308098407032729)}, 
-    {FLOAT_FIXED(-0.948226748671078), FLOAT_FIXED(0.0770610659876729), FLOAT_FIXED(0.308103270371346)}, 
-    {FLOAT_FIXED(-0.948229034419425), FLOAT_FIXED(0.0770606584919527), FLOAT_FIXED(0.308096337525767)}, 
-    {FLOAT_FIXED(-0.948228856682277), FLOAT_FIXED(0.0770600688987725), FLOAT_FIXED(0.308097032014816)}, 
-    {FLOAT_FIXED(-0.948228856682277), FLOAT_FIXED(0.0770600688987723), FLOAT_FIXED(0.308097032014816)}, 
-    {FLOAT_FIXED(-0.948226388465875), FLOAT_FIXED(0.0770611302026754), FLOAT_FIXED(0.308104362885125)}, 
-    {FLOAT_FIXED(-0.948228654229515), FLOAT_FIXED(0.0770683711511526), FLOAT_FIXED(0.308095578459333)}, 
-    {FLOAT_FIXED(-0.948229223677978), FLOAT_FIXED(0.0770606247509687), FLOAT_FIXED(0.3080957634828)}, 
-    {FLOAT_FIXED(-0.948229223677978), FLOAT_FIXED(0.0770606247509688), FLOAT_FIXED(0.308095763482801)}, 
-    {FLOAT_FIXED(-0.948228247735133), FLOAT_FIXED(0.0770601774599562), FLOAT_FIXED(0.308098879009643)}, 
-    {FLOAT_FIXED(-0.948227632011351), FLOAT_FIXED(0.0770685533823775), FLOAT_FIXED(0.30809867894831)}, 
-    {FLOAT_FIXED(-0.948227018433301), FLOAT_FIXED(0.0770686627639084), FLOAT_FIXED(0.308100539974981)}, 
-    {FLOAT_FIXED(-0.948227590493834), FLOAT_FIXED(0.0770602946298226), FLOAT_FIXED(0.3081008724717)}, 
-    {FLOAT_FIXED(-0.94822965863321), FLOAT_FIXED(0.0770599259280551), FLOAT_FIXED(0.308094599602636)}, 
-    {FLOAT_FIXED(-0.948226806676947), FLOAT_FIXED(0.0770687005131388), FLOAT_FIXED(0.308101182244495)}, 
-    {FLOAT_FIXED(-0.948229665919771), FLOAT_FIXED(0.0770602352671761), FLOAT_FIXED(0.30809449980525)}, 
-    {FLOAT_FIXED(-0.948229265565958), FLOAT_FIXED(0.0770603066422226), FLOAT_FIXED(0.308095714128664)}, 
-    {FLOAT_FIXED(-0.948229265565957), FLOAT_FIXED(0.0770603066422229), FLOAT_FIXED(0.308095714128665)}, 
-    {FLOAT_FIXED(-0.948227713783952), FLOAT_FIXED(0.0770608939321188), FLOAT_FIXED(0.308100343132628)}, 
-    {FLOAT_FIXED(-0.948228582240323), FLOAT_FIXED(0.0770607391060039), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(-0.948228582240323), FLOAT_FIXED(0.0770607391060042), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(-0.948228663062201), FLOAT_FIXED(0.0770601034168527), FLOAT_FIXED(0.308097619284303)}, 
-    {FLOAT_FIXED(-0.948228549189369), FLOAT_FIXED(0.0770601237177589), FLOAT_FIXED(0.308097964671674)}, 
-    {FLOAT_FIXED(-0.94822865609709), FLOAT_FIXED(0.0770607259389267), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(-0.948228221340572), FLOAT_FIXED(0.0770602285930272), FLOAT_FIXED(0.308098947454363)}, 
-    {FLOAT_FIXED(-0.948228221340572), FLOAT_FIXED(0.0770602285930267), FLOAT_FIXED(0.308098947454363)}, 
-    {FLOAT_FIXED(-0.94822860303636), FLOAT_FIXED(0.0770602984669019), FLOAT_FIXED(0.308097755239966)}, 
-    {FLOAT_FIXED(-0.948228580424447), FLOAT_FIXED(0.0770583815014325), FLOAT_FIXED(0.308098304290395)}, 
-    {FLOAT_FIXED(-0.948228580424448), FLOAT_FIXED(0.0770583815014325), FLOAT_FIXED(0.308098304290394)}, 
-    {FLOAT_FIXED(-0.948227825961678), FLOAT_FIXED(0.0770686448545377), FLOAT_FIXED(0.308098059150452)}, 
-    {FLOAT_FIXED(-0.948228178523441), FLOAT_FIXED(0.0770608110798229), FLOAT_FIXED(0.308098933542192)}, 
-    {FLOAT_FIXED(-0.948228231615221), FLOAT_FIXED(0.0770602304739194), FLOAT_FIXED(0.308098915361897)}, 
-    {FLOAT_FIXED(-0.948228094123596), FLOAT_FIXED(0.0770602053045062), FLOAT_FIXED(0.308099344811313)}, 
-    {FLOAT_FIXED(-0.948228047847239), FLOAT_FIXED(0.0770608348353308), FLOAT_FIXED(0.308099329779044)}, 
-    {FLOAT_FIXED(-0.948228361645842), FLOAT_FIXED(0.0770687429232771), FLOAT_FIXED(0.308096385948729)}, 
-    {FLOAT_FIXED(-0.948227450459041), FLOAT_FIXED(0.0770607254759104), FLOAT_FIXED(0.308101195689133)}, 
-    {FLOAT_FIXED(-0.948226880996851), FLOAT_FIXED(0.0770684718587206), FLOAT_FIXED(0.30810101070971)}, 
-    {FLOAT_FIXED(-0.948227030456231), FLOAT_FIXED(0.0770684992203622), FLOAT_FIXED(0.308100543881505)}, 
-    {FLOAT_FIXED(-0.948229068311886), FLOAT_FIXED(0.0770584708284089), FLOAT_FIXED(0.308096780382333)}, 
-    {FLOAT_FIXED(-0.948227357749565), FLOAT_FIXED(0.077057519662631), FLOAT_FIXED(0.30810228281972)}, 
-    {FLOAT_FIXED(-0.948228833127992), FLOAT_FIXED(0.0770577897852117), FLOAT_FIXED(0.30809767454193)}, 
-    {FLOAT_FIXED(-0.948228601842607), FLOAT_FIXED(0.0770609362514801), FLOAT_FIXED(0.308097599392887)}, 
-    {FLOAT_FIXED(-6.04010735937697e-06), FLOAT_FIXED(0.0770614511846645), FLOAT_FIXED(0.997026345040506)}, 
-    {FLOAT_FIXED(-6.04010735917579e-06), FLOAT_FIXED(0.0770614511846645), FLOAT_FIXED(0.997026345040506)}, 
-    {FLOAT_FIXED(-6.04010735915367e-06), FLOAT_FIXED(0.0770614511846646), FLOAT_FIXED(0.997026345040506)}, 
-    {FLOAT_FIXED(-0.948228183782799), FLOAT_FIXED(0.0770661595363869), FLOAT_FIXED(0.30809757956577)}, 
-    {FLOAT_FIXED(-0.948228753214355), FLOAT_FIXED(0.0770584131373898), FLOAT_FIXED(0.308097764585038)}, 
-    {FLOAT_FIXED(-0.948226987937262), FLOAT_FIXED(0.0770684914363806), FLOAT_FIXED(0.308100676687262)}, 
-    {FLOAT_FIXED(-0.948227742398931), FLOAT_FIXED(0.0770582280684938), FLOAT_FIXED(0.308100921829146)}, 
-    {FLOAT_FIXED(-0.948229550843527), FLOAT_FIXED(0.0770611099793416), FLOAT_FIXED(0.308094635194829)}, 
-    {FLOAT_FIXED(-0.948229735861316), FLOAT_FIXED(0.0770585930499785), FLOAT_FIXED(0.308094695289512)}, 
-    {FLOAT_FIXED(-0.948227690933476), FLOAT_FIXED(0.0770582186457782), FLOAT_FIXED(0.308101082578603)}, 
-    {FLOAT_FIXED(-0.948228370353497), FLOAT_FIXED(0.0770583430397624), FLOAT_FIXED(0.308098960440825)}, 
-    {FLOAT_FIXED(-0.948227800922919), FLOAT_FIXED(0.077066089435716), FLOAT_FIXED(0.308098775421082)}, 
-    {FLOAT_FIXED(-0.948226249672986), FLOAT_FIXED(0.0770658054073591), FLOAT_FIXED(0.308103620666844)}, 
-    {FLOAT_FIXED(-0.948229167906047), FLOAT_FIXED(0.0770604018731784), FLOAT_FIXED(0.308095990878412)}, 
-    {FLOAT_FIXED(0.948228954902784), FLOAT_FIXED(0.0770606726681393), FLOAT_FIXED(0.30809657870854)}, 
-    {FLOAT_FIXED(0.948227144335313), FLOAT_FIXED(0.0770686403196449), FLOAT_FIXED(0.308100158106059)}, 
-    {FLOAT_FIXED(0.948227144335313), FLOAT_FIXED(0.0770686403196449), FLOAT_FIXED(0.308100158106058)}, 
-    {FLOAT_FIXED(-0.586037503880932), FLOAT_FIXED(0.0770634528110906), FLOAT_FIXED(-0.806610977042737)}, 
-    {FLOAT_FIXED(-0.586026710465646), FLOAT_FIXED(0.077062705707621), FLOAT_FIXED(-0.806618890189062)}, 
-    {FLOAT_FIXED(-0.58602767098887), FLOAT_FIXED(0.0770630879595696), FLOAT_FIXED(-0.806618155826842)}, 
-    {FLOAT_FIXED(0.948228293180694), FLOAT_FIXED(0.0770583289102879), FLOAT_FIXED(0.308099201487414)}, 
-    {FLOAT_FIXED(0.948227755734725), FLOAT_FIXED(0.0770607813604162), FLOAT_FIXED(0.308100242178432)}, 
-    {FLOAT_FIXED(0.948228883299213), FLOAT_FIXED(0.0770609877759413), FLOAT_FIXED(0.308096720268368)}, 
-    {FLOAT_FIXED(0.948228883299212), FLOAT_FIXED(0.0770609877759411), FLOAT_FIXED(0.308096720268368)}, 
-    {FLOAT_FIXED(0.948229578960402), FLOAT_FIXED(0.0770579263382777), FLOAT_FIXED(0.308095344938907)}, 
-    {FLOAT_FIXED(0.948228584678854), FLOAT_FIXED(0.0770602951063423), FLOAT_FIXED(0.308097812579155)}, 
-    {FLOAT_FIXED(0.948228538403496), FLOAT_FIXED(0.0770609246380997), FLOAT_FIXED(0.308097797543396)}, 
-    {FLOAT_FIXED(0.948227338090704), FLOAT_FIXED(0.0770660046925183), FLOAT_FIXED(0.308100221061508)}, 
-    {FLOAT_FIXED(0.948229306642909), FLOAT_FIXED(0.0770585144643626), FLOAT_FIXED(0.30809603595641)}, 
-    {FLOAT_FIXED(0.948229306642909), FLOAT_FIXED(0.0770585144643627), FLOAT_FIXED(0.308096035956409)}, 
-    {FLOAT_FIXED(0.948229929859077), FLOAT_FIXED(0.0770611793636886), FLOAT_FIXED(0.308093451333403)}, 
-    {FLOAT_FIXED(0.94822834893174), FLOAT_FIXED(0.0770608899527756), FLOAT_FIXED(0.308098389352934)}, 
-    {FLOAT_FIXED(0.948229449883275), FLOAT_FIXED(0.077058540690226), FLOAT_FIXED(0.30809558854478)}, 
-    {FLOAT_FIXED(0.948228582240323), FLOAT_FIXED(0.0770607391060046), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(0.948228582240323), FLOAT_FIXED(0.0770607391060048), FLOAT_FIXED(0.308097709032286)}, 
-    {FLOAT_FIXED(0.94822856820129), FLOAT_FIXED(0.0770609300929845), FLOAT_FIXED(0.308097704470734)}, 
-    {FLOAT_FIXED(0.94822856820129), FLOAT_FIXED(0.0770609300929846), FLOAT_FIXED(0.308097704470734)}, 
-    {FLOAT_FIXED(0.94822856820129), FLOAT_FIXED(0.0770609300929843), FLOAT_FIXED(0.308097704470734)}, 
-    {FLOAT_FIXED(0.948228776934847), FLOAT_FIXED(0.0770600831159468), FLOAT_FIXED(0.308097273897073)}, 
-    {FLOAT_FIXED(0.948229493963083), FLOAT_FIXED(0.077061099566555), FLOAT_FIXED(0.308094812861412)}, 
-    {FLOAT_FIXED(0.94822876303305), FLOAT_FIXED(0.077058414935087), FLOAT_FIXED(0.308097733916535)}, 
-    {FLOAT_FIXED(0.948228193624636), FLOAT_FIXED(0.0770661613384038), FLOAT_FIXED(0.308097548824919)}, 
-    {FLOAT_FIXED(0.948232062339565), FLOAT_FIXED(0.0770594973888657), FLOAT_FIXED(0.308087308750996)}, 
-    {FLOAT_FIXED(0.948229239814286), FLOAT_FIXED(0.0770578642445756), FLOAT_FIXED(0.308096404262181)}, 
-    {FLOAT_FIXED(0.948229778005835), FLOAT_FIXED(0.0770605135597501), FLOAT_FIXED(0.308094085228705)}, 
-    {FLOAT_FIXED(0.948229731730156), FLOAT_FIXED(0.07706114309327), FLOAT_FIXED(0.308094070193042)}, 
-    {FLOAT_FIXED(0.948228601842607), FLOAT_FIXED(0.0770609362514818), FLOAT_FIXED(0.308097599392887)}, 
-    {FLOAT_FIXED(0.94822878685563), FLOAT_FIXED(0.0770584192967455), FLOAT_FIXED(0.308097659507155)}, 
-    {FLOAT_FIXED(0.94822864012236), FLOAT_FIXED(0.0770609432591044), FLOAT_FIXED(0.308097479826949)}, 
-    {FLOAT_FIXED(0.948228825135335), FLOAT_FIXED(0.0770584263053508), FLOAT_FIXED(0.308097539941176)}, 
-    {FLOAT_FIXED(0.948228166207334), FLOAT_FIXED(0.0770608565026791), FLOAT_FIXED(0.308098960086123)}, 
-    {FLOAT_FIXED(0.948227609074857), FLOAT_FIXED(0.0770685574712448), FLOAT_FIXED(0.308098748516578)}, 
-    {FLOAT_FIXED(0.948229511232876), FLOAT_FIXED(0.0770604647234998), FLOAT_FIXED(0.308094918496977)}, 
-    {FLOAT_FIXED(0.948227800922919), FLOAT_FIXED(0.077066089435716), FLOAT_FIXED(0.308098775421082)}, 
-    {FLOAT_FIXED(0.948227800922919), FLOAT_FIXED(0.0770660894357159), FLOAT_FIXED(0.308098775421083)}, 
-    {FLOAT_FIXED(0.948230267555734), FLOAT_FIXED(0.07705805241243), FLOAT_FIXED(0.308093194098124)}, 
-    {FLOAT_FIXED(0.948230221282987), FLOAT_FIXED(0.0770586819260831), FLOAT_FIXED(0.308093179063465)}, 
-    {FLOAT_FIXED(0.948227030456231), FLOAT_FIXED(0.0770684992203626), FLOAT_FIXED(0.308100543881505)}, 
-    {FLOAT_FIXED(0.948229741620925), FLOAT_FIXED(0.0770611449039188), FLOAT_FIXED(0.308094039299059)}, 
-    {FLOAT_FIXED(0.948228299651964), FLOAT_FIXED(0.0770661807517656), FLOAT_FIXED(0.308097217649692)}, 
-    {FLOAT_FIXED(0.948227790648312), FLOAT_FIXED(0.0770660875544627), FLOAT_FIXED(0.308098807513546)}, 
-    {FLOAT_FIXED(0.948229361940114), FLOAT_FIXED(0.0770606001015598), FLOAT_FIXED(0.308095344117095)}, 
-    {FLOAT_FIXED(0.948229223201156), FLOAT_FIXED(0.0770624874870756), FLOAT_FIXED(0.308095299038521)}, 
-    {FLOAT_FIXED(0.948228940386045), FLOAT_FIXED(0.0770606752561755), FLOAT_FIXED(0.308096622739395)}, 
-    {FLOAT_FIXED(0.948228940386045), FLOAT_FIXED(0.0770606752561746), FLOAT_FIXED(0.308096622739395)}, 
-    {FLOAT_FIXED(0.948228627400552), FLOAT_FIXED(0.0770677545932055), FLOAT_FIXED(0.308095815258867)}, 
-    {FLOAT_FIXED(0.948229150564704), FLOAT_FIXED(0.0770606377856026), FLOAT_FIXED(0.308095985243911)}, 
-    {FLOAT_FIXED(0.948229150564704), FLOAT_FIXED(0.0770606377856027), FLOAT_FIXED(0.308095985243911)}, 
-    {FLOAT_FIXED(0.948227590493834), FLOAT_FIXED(0.0770602946298224), FLOAT_FIXED(0.308100872471699)}, 
-    {FLOAT_FIXED(0.948227590493834), FLOAT_FIXED(0.0770602946298233), FLOAT_FIXED(0.3081008724717)}, 
-    {FLOAT_FIXED(0.94822965863321), FLOAT_FIXED(0.0770599259280557), FLOAT_FIXED(0.308094599602636)}, 
-    {FLOAT_FIXED(0.94822865609709), FLOAT_FIXED(0.0770607259389264), FLOAT_FIXED(0.308097485017442)}, 
-    {FLOAT_FIXED(0.948229220175718), FLOAT_FIXED(0.0770606253753512), FLOAT_FIXED(0.30809577410557)}, 
-    {FLOAT_FIXED(0.948228650746039), FLOAT_FIXED(0.0770683717721571), FLOAT_FIXED(0.30809558902512)}, 
-    {FLOAT_FIXED(0.94822846497094), FLOAT_FIXED(0.0770684048905494), FLOAT_FIXED(0.308096152501911)}, 
-    {FLOAT_FIXED(0.948228106740285), FLOAT_FIXED(0.0770608238771337), FLOAT_FIXED(0.308099151266458)}, 
-    {FLOAT_FIXED(0.94822801024434), FLOAT_FIXED(0.077062136597372), FLOAT_FIXED(0.308099119912906)}, 
-    {FLOAT_FIXED(0.94822786290437), FLOAT_FIXED(0.077059239666111), FLOAT_FIXED(0.308100297945152)}, 
-    {FLOAT_FIXED(0.94823663573197), FLOAT_FIXED(0.0770579445501258), FLOAT_FIXED(0.30807362080747)}, 
-    {FLOAT_FIXED(0.948214924120664), FLOAT_FIXED(0.0770692487881867), FLOAT_FIXED(0.308137613033637)}, 
-    {FLOAT_FIXED(0.948211602908514), FLOAT_FIXED(0.0770715702711152), FLOAT_FIXED(0.308147252406395)}, 
-    {FLOAT_FIXED(0.586038102527303), FLOAT_FIXED(0.0770629062182293), FLOAT_FIXED(-0.806610594321324)}, 
-    {FLOAT_FIXED(0.586037317252795), FLOAT_FIXED(0.0770646594650929), FLOAT_FIXED(-0.806610997351683)}, 
-    {FLOAT_FIXED(0.586037645214714), FLOAT_FIXED(0.0770574404757663), FLOAT_FIXED(-0.806611448752444)}, 
-    {FLOAT_FIXED(-0.948231330127235), FLOAT_FIXED(0.0770614357045809), FLOAT_FIXED(0.308089077528371)}, 
-    {FLOAT_FIXED(-0.948230358853986), FLOAT_FIXED(0.0770651832273866), FLOAT_FIXED(0.308091129508414)}, 
-    {FLOAT_FIXED(-0.948226593703741), FLOAT_FIXED(0.0770632185142377), FLOAT_FIXED(0.308103208917445)}, 
-    {FLOAT_FIXED(0.586038466178687), FLOAT_FIXED(0.077064738983748), FLOAT_FIXED(-0.806610155009407)}, 
-    {FLOAT_FIXED(0.586038466178687), FLOAT_FIXED(0.0770647389837473), FLOAT_FIXED(-0.806610155009406)}, 
-    {FLOAT_FIXED(0.586038765543557), FLOAT_FIXED(0.0770581495100969), FLOAT_FIXED(-0.806610567048476)}, 
-    {FLOAT_FIXED(0.586035631797589), FLOAT_FIXED(0.0770579326004108), FLOAT_FIXED(-0.806612864568221)}, 
-    {FLOAT_FIXED(0.586035631797589), FLOAT_FIXED(0.077057932600411), FLOAT_FIXED(-0.806612864568221)}, 
-    {FLOAT_FIXED(0.586038157022236), FLOAT_FIXED(0.0770647175866345), FLOAT_FIXED(-0.806610381669659)}, 
-    {FLOAT_FIXED(0.586036383957708), FLOAT_FIXED(0.0770645948704723), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(0.586036383957708), FLOAT_FIXED(0.0770645948704734), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(0.586036421122909), FLOAT_FIXED(0.0770579872354942), FLOAT_FIXED(-0.806612285872629)}, 
-    {FLOAT_FIXED(0.586039400137859), FLOAT_FIXED(0.0770581934349858), FLOAT_FIXED(-0.806610101790571)}, 
-    {FLOAT_FIXED(0.586036677854909), FLOAT_FIXED(0.0770580050058204), FLOAT_FIXED(-0.806612097648743)}, 
-    {FLOAT_FIXED(0.586039747857301), FLOAT_FIXED(0.0770582175031685), FLOAT_FIXED(-0.806609846856945)}, 
-    {FLOAT_FIXED(0.586037299874331), FLOAT_FIXED(0.0770628506541586), FLOAT_FIXED(-0.806611182791969)}, 
-    {FLOAT_FIXED(0.586037637755141), FLOAT_FIXED(0.0770580714476014), FLOAT_FIXED(-0.806611393893708)}, 
-    {FLOAT_FIXED(0.586037301034861), FLOAT_FIXED(0.0770580481407108), FLOAT_FIXED(-0.806611640761847)}, 
-    {FLOAT_FIXED(0.586037301034862), FLOAT_FIXED(0.0770580481407098), FLOAT_FIXED(-0.806611640761847)}, 
-    {FLOAT_FIXED(0.586034494657035), FLOAT_FIXED(0.0770644641092571), FLOAT_FIXED(-0.806613066744909)}, 
-    {FLOAT_FIXED(0.58603893137751), FLOAT_FIXED(0.077058160988674), FLOAT_FIXED(-0.806610445466056)}, 
-    {FLOAT_FIXED(0.586038742479165), FLOAT_FIXED(0.0770623189911734), FLOAT_FIXED(-0.80661018547074)}, 
-    {FLOAT_FIXED(0.586036112094728), FLOAT_FIXED(0.0770627684294281), FLOAT_FIXED(-0.806612053618645)}, 
-    {FLOAT_FIXED(0.586035748425309), FLOAT_FIXED(0.0770627432541863), FLOAT_FIXED(-0.806612320244197)}, 
-    {FLOAT_FIXED(0.586039123784451), FLOAT_FIXED(0.0770575428175573), FLOAT_FIXED(-0.806610364729386)}, 
-    {FLOAT_FIXED(0.586038704004444), FLOAT_FIXED(0.0770629478557753), FLOAT_FIXED(-0.806610153343342)}, 
-    {FLOAT_FIXED(0.586037252674457), FLOAT_FIXED(0.0770646549955401), FLOAT_FIXED(-0.806611044697624)}, 
-    {FLOAT_FIXED(0.586031252872008), FLOAT_FIXED(0.0770642397401871), FLOAT_FIXED(-0.806615443449065)}, 
-    {FLOAT_FIXED(0.586040789424027), FLOAT_FIXED(0.0770582895975083), FLOAT_FIXED(-0.806609083221587)}, 
-    {FLOAT_FIXED(0.586035825328304), FLOAT_FIXED(0.0770579459961161), FLOAT_FIXED(-0.806612722680862)}, 
-    {FLOAT_FIXED(0.586035825328304), FLOAT_FIXED(0.0770579459961162), FLOAT_FIXED(-0.806612722680862)}, 
-    {FLOAT_FIXED(0.586039336942201), FLOAT_FIXED(0.0770595845119038), FLOAT_FIXED(-0.806610014809634)}, 
-    {FLOAT_FIXED(0.586036011189839), FLOAT_FIXED(0.0770670097188803), FLOAT_FIXED(-0.806611721711067)}, 
-    {FLOAT_FIXED(0.586035955021699), FLOAT_FIXED(0.0770604446898951), FLOAT_FIXED(-0.806612389742435)}, 
-    {FLOAT_FIXED(0.586038669757764), FLOAT_FIXED(0.0770602579619718), FLOAT_FIXED(-0.806610435211066)}, 
-    {FLOAT_FIXED(-0.948227820446189), FLOAT_FIXED(0.0770647185249467), FLOAT_FIXED(0.308099058243516)}, 
-    {FLOAT_FIXED(-0.948229048162255), FLOAT_FIXED(0.0770622417671863), FLOAT_FIXED(0.308095899218277)}, 
-    {FLOAT_FIXED(-0.948228393437384), FLOAT_FIXED(0.077061865360145), FLOAT_FIXED(0.308098008410268)}, 
-    {FLOAT_FIXED(0.586030449708962), FLOAT_FIXED(0.0770623764464043), FLOAT_FIXED(-0.806616204988683)}, 
-    {FLOAT_FIXED(0.586030667200865), FLOAT_FIXED(0.0770575889628989), FLOAT_FIXED(-0.806616504345983)}, 
-    {FLOAT_FIXED(0.586034812782303), FLOAT_FIXED(0.0770598956948553), FLOAT_FIXED(-0.806613272072006)}, 
-    {FLOAT_FIXED(0.586038418435076), FLOAT_FIXED(0.0770602752487768), FLOAT_FIXED(-0.806610616156704)}, 
-    {FLOAT_FIXED(0.586035516304496), FLOAT_FIXED(0.0770604748660941), FLOAT_FIXED(-0.806612705604824)}, 
-    {FLOAT_FIXED(0.586035333600961), FLOAT_FIXED(0.0770670563293099), FLOAT_FIXED(-0.806612209552983)}, 
-    {FLOAT_FIXED(0.586037214232972), FLOAT_FIXED(0.0770669269629596), FLOAT_FIXED(-0.806610855557091)}, 
-    {FLOAT_FIXED(0.586037214232973), FLOAT_FIXED(0.0770669269629581), FLOAT_FIXED(-0.806610855557091)}, 
-    {FLOAT_FIXED(0.586036269567151), FLOAT_FIXED(0.077066991945432), FLOAT_FIXED(-0.806611535687595)}, 
-    {FLOAT_FIXED(0.586039001473931), FLOAT_FIXED(0.0770602351454201), FLOAT_FIXED(-0.806610196384084)}, 
-    {FLOAT_FIXED(0.586035852541243), FLOAT_FIXED(0.0770604517387914), FLOAT_FIXED(-0.806612463525126)}, 
-    {FLOAT_FIXED(0.58603843888469), FLOAT_FIXED(0.0770602738421855), FLOAT_FIXED(-0.806610601433531)}, 
-    {FLOAT_FIXED(0.586037698134945), FLOAT_FIXED(0.0770603247933387), FLOAT_FIXED(-0.806611134752949)}, 
-    {FLOAT_FIXED(0.586034268720261), FLOAT_FIXED(0.0770605606782479), FLOAT_FIXED(-0.806613603823704)}, 
-    {FLOAT_FIXED(0.586041134974583), FLOAT_FIXED(0.0770600883956108), FLOAT_FIXED(-0.806608660314383)}, 
-    {FLOAT_FIXED(0.586037581157919), FLOAT_FIXED(0.0770603328393864), FLOAT_FIXED(-0.806611218973093)}, 
-    {FLOAT_FIXED(0.586035411627457), FLOAT_FIXED(0.0770670509619757), FLOAT_FIXED(-0.806612153376492)}, 
-    {FLOAT_FIXED(0.58604073496533), FLOAT_FIXED(0.0770594883516616), FLOAT_FIXED(-0.806609008266258)}, 
-    {FLOAT_FIXED(0.58603337779476), FLOAT_FIXED(0.0770665632514095), FLOAT_FIXED(-0.806613677629558)}, 
-    {FLOAT_FIXED(0.586013952640203), FLOAT_FIXED(0.0770745747732367), FLOAT_FIXED(-0.806627024860022)}, 
-    {FLOAT_FIXED(0.586044427821981), FLOAT_FIXED(0.0770603820874265), FLOAT_FIXED(-0.806606239829166)}, 
-    {FLOAT_FIXED(0.586048165908428), FLOAT_FIXED(0.0770551947823214), FLOAT_FIXED(-0.806604019449709)}, 
-    {FLOAT_FIXED(-0.586037425328314), FLOAT_FIXED(0.0770549753861434), FLOAT_FIXED(-0.806611844001067)}, 
-    {FLOAT_FIXED(-0.586036865648131), FLOAT_FIXED(0.0770672923927071), FLOAT_FIXED(-0.806611073904005)}, 
-    {FLOAT_FIXED(-0.58603686564813), FLOAT_FIXED(0.077067292392707), FLOAT_FIXED(-0.806611073904005)}, 
-    {FLOAT_FIXED(-0.586033815872482), FLOAT_FIXED(0.0770599642642962), FLOAT_FIXED(-0.806613989812676)}, 
-    {FLOAT_FIXED(-0.586033815872483), FLOAT_FIXED(0.0770599642642961), FLOAT_FIXED(-0.806613989812675)}, 
-    {FLOAT_FIXED(-0.586039008787679), FLOAT_FIXED(0.0770668035171698), FLOAT_FIXED(-0.806609563527981)}, 
-    {FLOAT_FIXED(-0.586036218487068), FLOAT_FIXED(0.0770604265679916), FLOAT_FIXED(-0.806612200055601)}, 
-    {FLOAT_FIXED(-0.586036218487069), FLOAT_FIXED(0.0770604265679917), FLOAT_FIXED(-0.806612200055601)}, 
-    {FLOAT_FIXED(-0.948240088953588), FLOAT_FIXED(0.0770777333902652), FLOAT_FIXED(0.308058041149248)}, 
-    {FLOAT_FIXED(-0.948226109178315), FLOAT_FIXED(0.0770600937120713), FLOAT_FIXED(0.308105481661136)}, 
-    {FLOAT_FIXED(-0.948226279724765), FLOAT_FIXED(0.0770590306470436), FLOAT_FIXED(0.308105222667631)}, 
-    {FLOAT_FIXED(-0.586037698134946), FLOAT_FIXED(0.0770603247933381), FLOAT_FIXED(-0.806611134752948)}, 
-    {FLOAT_FIXED(-0.586041562137397), FLOAT_FIXED(0.0770666278735686), FLOAT_FIXED(-0.806607725177336)}, 
-    {FLOAT_FIXED(-0.586041590741575), FLOAT_FIXED(0.0770659982957788), FLOAT_FIXED(-0.806607764547156)}, 
-    {FLOAT_FIXED(-0.586038669757764), FLOAT_FIXED(0.0770602579619715), FLOAT_FIXED(-0.806610435211066)}, 
-    {FLOAT_FIXED(-0.586038370384801), FLOAT_FIXED(0.0770668474323905), FLOAT_FIXED(-0.806610023160858)}, 
-    {FLOAT_FIXED(-0.586036146656821), FLOAT_FIXED(0.0770604315086833), FLOAT_FIXED(-0.806612251771147)}, 
-    {FLOAT_FIXED(-0.586037235503964), FLOAT_FIXED(0.0770669254997501), FLOAT_FIXED(-0.806610840242609)}, 
-    {FLOAT_FIXED(-0.586037235503964), FLOAT_FIXED(0.0770669254997502), FLOAT_FIXED(-0.806610840242609)}, 
-    {FLOAT_FIXED(-0.586037534876954), FLOAT_FIXED(0.0770603360227354), FLOAT_FIXED(-0.806611252294069)}, 
-    {FLOAT_FIXED(-0.586038119062108), FLOAT_FIXED(0.0770668647206565), FLOAT_FIXED(-0.806610204106218)}, 
-    {FLOAT_FIXED(-0.586035516304496), FLOAT_FIXED(0.0770604748660944), FLOAT_FIXED(-0.806612705604824)}, 
-    {FLOAT_FIXED(-0.586035516304496), FLOAT_FIXED(0.077060474866094), FLOAT_FIXED(-0.806612705604824)}, 
-    {FLOAT_FIXED(-0.586035516304496), FLOAT_FIXED(0.0770604748660941), FLOAT_FIXED(-0.806612705604825)}, 
-    {FLOAT_FIXED(-0.58604052695918), FLOAT_FIXED(0.0770601302171685), FLOAT_FIXED(-0.806609098071873)}, 
-    {FLOAT_FIXED(-0.586036568940164), FLOAT_FIXED(0.0770604024628039), FLOAT_FIXED(-0.80661194774012)}, 
-    {FLOAT_FIXED(-0.586037413737415), FLOAT_FIXED(0.0770603443550905), FLOAT_FIXED(-0.806611339511067)}, 
-    {FLOAT_FIXED(-0.5860363815367), FLOAT_FIXED(0.0770645947029122), FLOAT_FIXED(-0.806611683375989)}, 
-    {FLOAT_FIXED(-0.586038097384373), FLOAT_FIXED(0.0770647134590225), FLOAT_FIXED(-0.806610425393562)}, 
-    {FLOAT_FIXED(-0.586038396771403), FLOAT_FIXED(0.0770581239846842), FLOAT_FIXED(-0.806610837416387)}, 
-    {FLOAT_FIXED(0.586037418903236), FLOAT_FIXED(0.0770604575967307), FLOAT_FIXED(-0.806611324939227)}, 
-    {FLOAT_FIXED(0.586037318168541), FLOAT_FIXED(0.0770626749209305), FLOAT_FIXED(-0.806611186289811)}, 
-    {FLOAT_FIXED(0.58603756884571), FLOAT_FIXED(0.0770599707972442), FLOAT_FIXED(-0.806611262506381)}, 
-    {FLOAT_FIXED(-0.586040102070415), FLOAT_FIXED(0.077060159442557), FLOAT_FIXED(-0.806609403981868)}, 
-    {FLOAT_FIXED(-0.586037513605962), FLOAT_FIXED(0.0770603374858225), FLOAT_FIXED(-0.806611267608575)}, 
-    {FLOAT_FIXED(-0.58603657200492), FLOAT_FIXED(0.0770604022520009), FLOAT_FIXED(-0.80661194553359)}, 
-    {FLOAT_FIXED(-0.58603657200492), FLOAT_FIXED(0.077060402252001), FLOAT_FIXED(-0.80661194553359)}, 
-    {FLOAT_FIXED(-0.586037616617082), FLOAT_FIXED(0.0770580699844804), FLOAT_FIXED(-0.806611409391187)}, 
-    {FLOAT_FIXED(-0.586037616617082), FLOAT_FIXED(0.0770580699844803), FLOAT_FIXED(-0.806611409391187)}, 
-    {FLOAT_FIXED(-0.586040188904977), FLOAT_FIXED(0.0770582480312632), FLOAT_FIXED(-0.806609523498558)}, 
-    {FLOAT_FIXED(-0.586038906228795), FLOAT_FIXED(0.0770629618548491), FLOAT_FIXED(-0.806610005080718)}, 
-    {FLOAT_FIXED(-0.586039123728627), FLOAT_FIXED(0.0770581743026949), FLOAT_FIXED(-0.806610304442312)}, 
-    {FLOAT_FIXED(-0.586036383957708), FLOAT_FIXED(0.0770645948704729), FLOAT_FIXED(-0.806611681601019)}, 
-    {FLOAT_FIXED(1.22822797323451e-05), FLOAT_FIXED(0.0770607879675046), FLOAT_FIXED(0.997026396243837)}, 
-    {FLOAT_FIXED(1.22828132549593e-05), FLOAT_FIXED(0.0770607879377224), FLOAT_FIXED(0.997026396246132)}, 
-    {FLOAT_FIXED(1.24657760084534e-05), FLOAT_FIXED(0.0770610924413099), FLOAT_FIXED(0.997026372708544)}, 
-    {FLOAT_FIXED(-0.586035292687492), FLOAT_FIXED(0.0770627117054414), FLOAT_FIXED(-0.806612654369673)}, 
-    {FLOAT_FIXED(-0.586039212947597), FLOAT_FIXED(0.0770647906685542), FLOAT_FIXED(-0.806609607509713)}, 
-    {FLOAT_FIXED(-0.586040337043528), FLOAT_FIXED(0.0770623413255354), FLOAT_FIXED(-0.806609024811485)}, 
-    {FLOAT_FIXED(-0.586026079452202), FLOAT_FIXED(0.0770589062703935), FLOAT_FIXED(-0.806619711615264)}, 
-    {FLOAT_FIXED(-0.586034761128573), FLOAT_FIXED(0.0770591286633174), FLOAT_FIXED(-0.806613382878456)}, 
-    {FLOAT_FIXED(-0.58603479401989), FLOAT_FIXED(0.0770578746115399), FLOAT_FIXED(-0.806613478785482)}, 
-    {FLOAT_FIXED(-0.58603779999286), FLOAT_FIXED(0.077058082677267), FLOAT_FIXED(-0.806611274948244)}, 
-    {FLOAT_FIXED(-0.586041637982678), FLOAT_FIXED(0.0770649585080383), FLOAT_FIXED(-0.806607829568208)}, 
-    {FLOAT_FIXED(-0.586034447369536), FLOAT_FIXED(0.0770578506172591), FLOAT_FIXED(-0.806613732932022)}, 
-    {FLOAT_FIXED(-0.586039747857301), FLOAT_FIXED(0.0770582175031672), FLOAT_FIXED(-0.806609846856946)}, 
-    {FLOAT_FIXED(-0.586039747857301), FLOAT_FIXED(0.077058217503168), FLOAT_FIXED(-0.806609846856946)}, 
-    {FLOAT_FIXED(-0.586038466178687), FLOAT_FIXED(0.0770647389837478), FLOAT_FIXED(-0.806610155009406)}, 
-    {FLOAT_FIXED(-0.586038466178687), FLOAT_FIXED(0.0770647389837469), FLOAT_FIXED(-0.806610155009407)}, 
-    {FLOAT_FIXED(-0.586038877686864), FLOAT_FIXED(0.0770629598790206), FLOAT_FIXED(-0.806610026006499)}, 
-    {FLOAT_FIXED(-0.586038514015735), FLOAT_FIXED(0.0770629347037169), FLOAT_FIXED(-0.806610292635223)}, 
-    {FLOAT_FIXED(-0.586035965944909), FLOAT_FIXED(0.0770579557292396), FLOAT_FIXED(-0.806612619587525)}, 
-    {FLOAT_FIXED(-0.586041750044505), FLOAT_FIXED(0.0770583560889207), FLOAT_FIXED(-0.80660837893097)}, 
-    {FLOAT_FIXED(-0.586031552279212), FLOAT_FIXED(0.0770576502260071), FLOAT_FIXED(-0.806615855457146)}, 
-    {FLOAT_FIXED(-0.586031552279211), FLOAT_FIXED(0.077057650226007), FLOAT_FIXED(-0.806615855457146)}, 
-    {FLOAT_FIXED(-0.586033804970476), FLOAT_FIXED(0.0770571746659671), FLOAT_FIXED(-0.806614264233112)}, 
-    {FLOAT_FIXED(-0.586037666352776), FLOAT_FIXED(0.0770574419388745), FLOAT_FIXED(-0.806611433254965)}, 
-    {FLOAT_FIXED(-0.586037666352776), FLOAT_FIXED(0.0770574419388746), FLOAT_FIXED(-0.806611433254965)}, 
-    {FLOAT_FIXED(-0.586036286808087), FLOAT_FIXED(0.0770573464511666), FLOAT_FIXED(-0.80661244467346)}, 
-    {FLOAT_FIXED(-0.586035853929315), FLOAT_FIXED(0.0770573164886487), FLOAT_FIXED(-0.806612762039448)}, 
-    {FLOAT_FIXED(-0.58603625821059), FLOAT_FIXED(0.0770579759591218), FLOAT_FIXED(-0.806612405312251)}, 
-    {FLOAT_FIXED(-0.586036931541), FLOAT_FIXED(0.0770628251560787), FLOAT_FIXED(-0.806611452837717)}, 
-    {FLOAT_FIXED(-0.586037466248395), FLOAT_FIXED(0.0770628621714927), FLOAT_FIXED(-0.80661106081376)}, 
-    {FLOAT_FIXED(-0.586037712344516), FLOAT_FIXED(0.0770574451222751), FLOAT_FIXED(-0.806611399535882)}, 
-    {FLOAT_FIXED(-0.586034392009978), FLOAT_FIXED(0.0770578467854079), FLOAT_FIXED(-0.806613773518834)}, 
-    {FLOAT_FIXED(-0.586038921533988), FLOAT_FIXED(0.0770581603073325), FLOAT_FIXED(-0.806610452682911)}, 
-    {FLOAT_FIXED(-0.586040031007673), FLOAT_FIXED(0.0770601643305061), FLOAT_FIXED(-0.806609455145351)}, 
-    {FLOAT_FIXED(-5.93248434827876e-07), FLOAT_FIXED(0.0770611919282273), FLOAT_FIXED(0.997026365096856)}, 
-    {FLOAT_FIXED(1.71223117631258e-17), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-4.90124695326692e-07), FLOAT_FIXED(0.077061815710749), FLOAT_FIXED(0.997026316883924)}, 
-    {FLOAT_FIXED(-0.948235283076877), FLOAT_FIXED(0.0770510782764569), FLOAT_FIXED(0.308079501532558)}, 
-    {FLOAT_FIXED(-0.948229991233753), FLOAT_FIXED(0.0770637361549581), FLOAT_FIXED(0.30809262291505)}, 
-    {FLOAT_FIXED(-0.948221611955711), FLOAT_FIXED(0.0770679005280623), FLOAT_FIXED(0.308117369403788)}, 
-    {FLOAT_FIXED(8.87222799192901e-18), FLOAT_FIXED(0.077061788351462), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.88748268528605e-07), FLOAT_FIXED(0.0770611805129053), FLOAT_FIXED(0.997026365979259)}, 
-    {FLOAT_FIXED(-3.88750229653662e-07), FLOAT_FIXED(0.0770611805130147), FLOAT_FIXED(0.99702636597925)}, 
-    {FLOAT_FIXED(-7.95833694473166e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(8.31546445882456e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-4.5092444524972e-07), FLOAT_FIXED(0.0770611839836171), FLOAT_FIXED(0.997026365710977)}, 
-    {FLOAT_FIXED(-3.63676250617662e-07), FLOAT_FIXED(0.0770611791133699), FLOAT_FIXED(0.997026366087439)}, 
-    {FLOAT_FIXED(3.32857941200663e-05), FLOAT_FIXED(0.0770781958281552), FLOAT_FIXED(0.997025050146651)}, 
-    {FLOAT_FIXED(1.1373712282076e-05), FLOAT_FIXED(0.0770669582132693), FLOAT_FIXED(0.99702591933329)}, 
-    {FLOAT_FIXED(-5.35912838710909e-07), FLOAT_FIXED(0.0770631918443936), FLOAT_FIXED(0.997026210519296)}, 
-    {FLOAT_FIXED(7.54805901128889e-18), FLOAT_FIXED(0.0770617883514627), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.04717295853129e-07), FLOAT_FIXED(0.0770611758222451), FLOAT_FIXED(0.997026366341834)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514623), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-4.17533211603099e-07), FLOAT_FIXED(0.0770611821231092), FLOAT_FIXED(0.997026365854793)}, 
-    {FLOAT_FIXED(-4.17536622578675e-07), FLOAT_FIXED(0.0770618116622165), FLOAT_FIXED(0.997026317196875)}, 
-    {FLOAT_FIXED(-8.66849729033074e-07), FLOAT_FIXED(0.0770612072008108), FLOAT_FIXED(0.997026363916222)}, 
-    {FLOAT_FIXED(-3.41642126596475e-07), FLOAT_FIXED(0.0770611397392573), FLOAT_FIXED(0.997026369130712)}, 
-    {FLOAT_FIXED(-3.41642126741896e-07), FLOAT_FIXED(0.0770611397392573), FLOAT_FIXED(0.997026369130712)}, 
-    {FLOAT_FIXED(8.08766611246917e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-7.51345453278475e-07), FLOAT_FIXED(0.0770617464043792), FLOAT_FIXED(0.997026322240563)}, 
-    {FLOAT_FIXED(-0.586037274396795), FLOAT_FIXED(0.0770636383837776), FLOAT_FIXED(-0.80661112604317)}, 
-    {FLOAT_FIXED(-0.586039069684584), FLOAT_FIXED(0.0770613626885982), FLOAT_FIXED(-0.806610039104278)}, 
-    {FLOAT_FIXED(-0.586039799349068), FLOAT_FIXED(0.0770634133007134), FLOAT_FIXED(-0.806609313056419)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770617883514622), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-5.36775692846183e-07), FLOAT_FIXED(0.0770611288495615), FLOAT_FIXED(0.997026369972301)}, 
-    {FLOAT_FIXED(8.54761660515311e-18), FLOAT_FIXED(0.0770617883514623), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-3.63676058847841e-07), FLOAT_FIXED(0.0770611385120995), FLOAT_FIXED(0.997026369225552)}, 
-    {FLOAT_FIXED(-4.90121230056271e-07), FLOAT_FIXED(0.0770617609923511), FLOAT_FIXED(0.997026321113198)}, 
-    {FLOAT_FIXED(-4.5093047262e-07), FLOAT_FIXED(0.0770617631763396), FLOAT_FIXED(0.997026320944413)}, 
-    {FLOAT_FIXED(-6.63010852209912e-07), FLOAT_FIXED(0.0770617513414559), FLOAT_FIXED(0.997026321859031)}, 
-    {FLOAT_FIXED(-6.63005147371195e-07), FLOAT_FIXED(0.0770617513417744), FLOAT_FIXED(0.997026321859006)}, 
-    {FLOAT_FIXED(-6.63005147976288e-07), FLOAT_FIXED(0.0770617513417738), FLOAT_FIXED(0.997026321859006)}, 
-    {FLOAT_FIXED(-6.63005147960062e-07), FLOAT_FIXED(0.0770617513417744), FLOAT_FIXED(0.997026321859006)}, 
-    {FLOAT_FIXED(-9.79995792069865e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(-5.9325277139551e-07), FLOAT_FIXED(0.0770617552354316), FLOAT_FIXED(0.997026321558103)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770600896277154), FLOAT_FIXED(0.997026450294358)}, 
-    {FLOAT_FIXED(-2.06304606467107e-17), FLOAT_FIXED(0.0770600896277154), FLOAT_FIXED(0.997026450294358)}, 
-    {FLOAT_FIXED(1.80649526123062e-05), FLOAT_FIXED(0.0770645308517143), FLOAT_FIXED(0.997026106858924)}, 
-    {FLOAT_FIXED(-3.46177637245593e-05), FLOAT_FIXED(0.0770653104066122), FLOAT_FIXED(0.997026046166068)}, 
-    {FLOAT_FIXED(-9.86401004707836e-06), FLOAT_FIXED(0.0770665476801635), FLOAT_FIXED(0.997025951082198)}, 
-    {FLOAT_FIXED(0.948228905818861), FLOAT_FIXED(0.0770606814187893), FLOAT_FIXED(0.30809672758541)}, 
-    {FLOAT_FIXED(0.948227162318814), FLOAT_FIXED(0.0770686371137641), FLOAT_FIXED(0.308100103560898)}, 
-    {FLOAT_FIXED(0.331290812791053), FLOAT_FIXED(-0.943528694473577), FLOAT_FIXED(-8.07656621904357e-06)}, 
-    {FLOAT_FIXED(-0.268028602260321), FLOAT_FIXED(-0.943523578520564), FLOAT_FIXED(0.194740661255237)}, 
-    {FLOAT_FIXED(-0.26804645806461), FLOAT_FIXED(-0.943518982922655), FLOAT_FIXED(0.19473835057229)}, 
-    {FLOAT_FIXED(-0.267996056058901), FLOAT_FIXED(-0.943538608880779), FLOAT_FIXED(-0.194712627962846)}, 
-    {FLOAT_FIXED(-0.268024128058631), FLOAT_FIXED(-0.943526304315717), FLOAT_FIXED(-0.194733612513954)}, 
-    {FLOAT_FIXED(0.331299265282094), FLOAT_FIXED(-0.943525726398819), FLOAT_FIXED(2.11453290453389e-05)}, 
-    {FLOAT_FIXED(0.102388529434096), FLOAT_FIXED(-0.943516013561592), FLOAT_FIXED(0.315109697078913)}, 
-    {FLOAT_FIXED(0.102370509682373), FLOAT_FIXED(-0.943526071831527), FLOAT_FIXED(0.315085433686706)}, 
-    {FLOAT_FIXED(0.102369382701352), FLOAT_FIXED(-0.943536821869638), FLOAT_FIXED(-0.315053606964729)}, 
-    {FLOAT_FIXED(0.102397625811566), FLOAT_FIXED(-0.943523219646287), FLOAT_FIXED(-0.315085163434362)}, 
-    {FLOAT_FIXED(0.187593591736786), FLOAT_FIXED(-0.794653471616623), FLOAT_FIXED(-0.577351283350909)}, 
-    {FLOAT_FIXED(0.187594528579371), FLOAT_FIXED(-0.794657511870781), FLOAT_FIXED(-0.577345417990325)}, 
-    {FLOAT_FIXED(-0.491118546863762), FLOAT_FIXED(-0.794656914929502), FLOAT_FIXED(-0.356823430398219)}, 
-    {FLOAT_FIXED(-0.491126406313934), FLOAT_FIXED(-0.794657358461633), FLOAT_FIXED(-0.356811624900226)}, 
-    {FLOAT_FIXED(-0.491099483382937), FLOAT_FIXED(-0.794682693379578), FLOAT_FIXED(0.356792256451834)}, 
-    {FLOAT_FIXED(-0.491121713681313), FLOAT_FIXED(-0.79465740568068), FLOAT_FIXED(0.35681797873367)}, 
-    {FLOAT_FIXED(0.607094379273083), FLOAT_FIXED(-0.794629734313428), FLOAT_FIXED(0)}, 
-    {FLOAT_FIXED(0.607059453011356), FLOAT_FIXED(-0.794656416461374), FLOAT_FIXED(-1.69210347890303e-05)}, 
-    {FLOAT_FIXED(0.187602683620485), FLOAT_FIXED(-0.794651531102266), FLOAT_FIXED(0.577351000012311)}, 
-    {FLOAT_FIXED(0.187598963131132), FLOAT_FIXED(-0.794659637898686), FLOAT_FIXED(0.577341050789613)}, 
-    {FLOAT_FIXED(-7.94768415182658e-05), FLOAT_FIXED(0.0770793452077721), FLOAT_FIXED(0.997024958677451)}, 
-    {FLOAT_FIXED(-0.586038213797897), FLOAT_FIXED(0.0770634679109977), FLOAT_FIXED(-0.806610459814464)}, 
-    {FLOAT_FIXED(-6.89998867525122e-06), FLOAT_FIXED(0.0770651543396623), FLOAT_FIXED(0.997026058806386)}, 
-    {FLOAT_FIXED(-0.948228520237539), FLOAT_FIXED(0.0770610160202318), FLOAT_FIXED(0.308097830596154)}, 
-    {FLOAT_FIXED(-0.586044888982163), FLOAT_FIXED(0.0770728571715264), FLOAT_FIXED(-0.806604712845953)}, 
-    {FLOAT_FIXED(0.586036595562275), FLOAT_FIXED(0.0770599371672255), FLOAT_FIXED(-0.806611972850368)}, 
-    {FLOAT_FIXED(-0.948221652025076), FLOAT_FIXED(0.077056385681437), FLOAT_FIXED(0.308120126016703)}, 
-    {FLOAT_FIXED(0.586044127423796), FLOAT_FIXED(0.077052994325795), FLOAT_FIXED(-0.806607163852089)}, 
-    {FLOAT_FIXED(-0.948228035618245), FLOAT_FIXED(0.0770618328255491), FLOAT_FIXED(0.308099117799988)}, 
-    {FLOAT_FIXED(0.948240385671107), FLOAT_FIXED(0.0770551643446373), FLOAT_FIXED(0.308062773846713)}, 
-    {FLOAT_FIXED(0.948228228647389), FLOAT_FIXED(0.0770592068453652), FLOAT_FIXED(0.308099180519193)}, 
-    {FLOAT_FIXED(-9.28179850979785e-18), FLOAT_FIXED(0.0770617883514626), FLOAT_FIXED(0.997026318998689)}, 
-    {FLOAT_FIXED(-0.586079351605342), FLOAT_FIXED(0.0770554120650564), FLOAT_FIXED(-0.806581339415527)}, 
-    {FLOAT_FIXED(0.586036380658387), FLOAT_FIXED(0.0770571569847913), FLOAT_FIXED(-0.806612394587536)}, 
-    {FLOAT_FIXED(0.948228104177264), FLOAT_FIXED(0.077064142501384), FLOAT_FIXED(0.30809832909141)}, 
-    {FLOAT_FIXED(0), FLOAT_FIXED(0.0770614735808167), FLOAT_FIXED(0.997026343327774)}, 
-    {FLOAT_FIXED(0.948228033382876), FLOAT_FIXED(0.0770618218253215), FLOAT_FIXED(0.308099127431101)}, 
-    {FLOAT_FIXED(0.948227936886093), FLOAT_FIXED(0.077063134539862), FLOAT_FIXED(0.308099096077277)}, 
-    {FLOAT_FIXED(0.948227939930072), FLOAT_FIXED(0.0770631345398939), FLOAT_FIXED(0.3080990867089)}, 
-    {FLOAT_FIXED(-0.948228032594474), FLOAT_FIXED(0.0770618325506136), FLOAT_FIXED(0.308099127174932)}, 
-    {FLOAT_FIXED(-0.948228221596446), FLOAT_FIXED(0.0770592613572143), FLOAT_FIXED(0.308099188585628)}, 
-    {FLOAT_FIXED(-0.948227778131873), FLOAT_FIXED(0.0770592613542896), FLOAT_FIXED(0.308100553421481)}, 
-    {FLOAT_FIXED(0.586037426919131), FLOAT_FIXED(0.0770602811519001), FLOAT_FIXED(-0.806611335972161)}, 
-    {FLOAT_FIXED(0.586037326184664), FLOAT_FIXED(0.0770624984761923), FLOAT_FIXED(-0.806611197323058)}, 
-    {FLOAT_FIXED(0.586038313073077), FLOAT_FIXED(0.0770612827395073), FLOAT_FIXED(-0.806610596454698)}, 
-    {FLOAT_FIXED(-0.586037375132735), FLOAT_FIXED(0.0770614210600741), FLOAT_FIXED(-0.806611264694299)}, 
-    {FLOAT_FIXED(-0.586037217430981), FLOAT_FIXED(0.0770648922439886), FLOAT_FIXED(-0.806611047636452)}, 
-    {FLOAT_FIXED(-0.586038421821625), FLOAT_FIXED(0.0770588889757322), FLOAT_FIXED(-0.806610746133874)}, 
-    {FLOAT_FIXED(-0.586035719825464), FLOAT_FIXED(0.0770624984794776), FLOAT_FIXED(-0.806612364408549)}, 
-    {FLOAT_FIXED(-0.586037554545986), FLOAT_FIXED(0.0770602855618247), FLOAT_FIXED(-0.806611242824504)}, 
-    {FLOAT_FIXED(-0.586036486812925), FLOAT_FIXED(0.0770623309231516), FLOAT_FIXED(-0.806611823169395)}, 
-    {FLOAT_FIXED(-0.586039020044551), FLOAT_FIXED(0.0770588889761398), FLOAT_FIXED(-0.806610311498052)}, 
-    {FLOAT_FIXED(-0.586038198357151), FLOAT_FIXED(0.0770632924449084), FLOAT_FIXED(-0.806610487796839)}, 
-    {FLOAT_FIXED(-0.586037318168541), FLOAT_FIXED(0.077062674920931), FLOAT_FIXED(-0.80661118628981)}, 
-    {FLOAT_FIXED(-0.586038921709975), FLOAT_FIXED(0.0770610535094731), FLOAT_FIXED(-0.806610176152657)}, 
-    {FLOAT_FIXED(-0.586036746781757), FLOAT_FIXED(0.077058888974364), FLOAT_FIXED(-0.806611963121978)}, 
-    {FLOAT_FIXED(-0.586038909330372), FLOAT_FIXED(0.0770648922471099), FLOAT_FIXED(-0.806609818396608)}, 
-    {FLOAT_FIXED(0.586038106725408), FLOAT_FIXED(0.0770624984744854), FLOAT_FIXED(-0.80661063022661)}, 
-    {FLOAT_FIXED(0.586035766255795), FLOAT_FIXED(0.0770614764799504), FLOAT_FIXED(-0.806612428314686)}, 
-    {FLOAT_FIXED(0.586036541121384), FLOAT_FIXED(0.0770611355120422), FLOAT_FIXED(-0.806611897918744)}, 
-    {FLOAT_FIXED(0.586036746781757), FLOAT_FIXED(0.077058888974364), FLOAT_FIXED(-0.806611963121978)}, 
-    {FLOAT_FIXED(0.586038921709975), FLOAT_FIXED(0.077061053509473), FLOAT_FIXED(-0.806610176152657)}, 
-    {FLOAT_FIXED(0.586037375132734), FLOAT_FIXED(0.077061421060074), FLOAT_FIXED(-0.806611264694299)}, 
-    {FLOAT_FIXED(0.586036440564756), FLOAT_FIXED(0.0770656292249312), FLOAT_FIXED(-0.806611541649608)}, 
-    {FLOAT_FIXED(0.586039020044552), FLOAT_FIXED(0.0770588889761397), FLOAT_FIXED(-0.806610311498052)}, 
-    {FLOAT_FIXED(-0.948228532731841), FLOAT_FIXED(0.0770647077979403), FLOAT_FIXED(0.308096868736502)}, 
-    {FLOAT_FIXED(-0.948228375910728), FLOAT_FIXED(0.0770621037891807), FLOAT_FIXED(0.308098002715513)}, 
-    {FLOAT_FIXED(-0.948229027353422), FLOAT_FIXED(0.0770632955088269), FLOAT_FIXED(0.308095699693621)}, 
-    {FLOAT_FIXED(-0.94822878075125), FLOAT_FIXED(0.0770608345981354), FLOAT_FIXED(0.308097074192595)}, 
-    {FLOAT_FIXED(-0.948228689523411), FLOAT_FIXED(0.0770620756511544), FLOAT_FIXED(0.308097044550982)}, 
-    {FLOAT_FIXED(-0.948228033382876), FLOAT_FIXED(0.0770618218253212), FLOAT_FIXED(0.308099127431101)}, 
-    {FLOAT_FIXED(-0.948228597368897), FLOAT_FIXED(0.0770622007787414), FLOAT_FIXED(0.30809729687706)}, 
-    {FLOAT_FIXED(-0.948228449086906), FLOAT_FIXED(0.0770608346003132), FLOAT_FIXED(0.308098094951826)}, 
-    {FLOAT_FIXED(-0.948229267245077), FLOAT_FIXED(0.0770592613634823), FLOAT_FIXED(0.308095970402048)}, 
-    {FLOAT_FIXED(0.948228469206784), FLOAT_FIXED(0.0770608346001829), FLOAT_FIXED(0.308098033029232)}, 
-    {FLOAT_FIXED(0.94822871622922), FLOAT_FIXED(0.0770622115861297), FLOAT_FIXED(0.308096928358172)}, 
-    {FLOAT_FIXED(0.948228035618245), FLOAT_FIXED(0.0770618328255487), FLOAT_FIXED(0.308099117799987)}, 
-    {FLOAT_FIXED(0.948228449086906), FLOAT_FIXED(0.0770608346003125), FLOAT_FIXED(0.308098094951826)}, 
-    {FLOAT_FIXED(0.948228597368897), FLOAT_FIXED(0.0770622007787411), FLOAT_FIXED(0.30809729687706)}, 
-    {FLOAT_FIXED(0.948228032594473), FLOAT_FIXED(0.0770618325506141), FLOAT_FIXED(0.308099127174933)}, 
-    {FLOAT_FIXED(0.948228689523411), FLOAT_FIXED(0.0770620756511546), FLOAT_FIXED(0.308097044550982)}, 
-    {FLOAT_FIXED(0.948227759990593), FLOAT_FIXED(0.0770608346045532), FLOAT_FIXED(0.308100215763106)}, 
-    {FLOAT_FIXED(8.98660290213349e-18), FLOAT_FIXED(0.0770617883514625), FLOAT_FIXED(0.997026318998688)}, 
-    {FLOAT_FIXED(0.948228771592186), FLOAT_FIXED(0.0770623620436247), FLOAT_FIXED(0.308096720334753)}, 
-    {FLOAT_FIXED(0.948226773083866), FLOAT_FIXED(0.0770535047651434), FLOAT_FIXED(0.308105086310446)}, 
-    {FLOAT_FIXED(0.948228634598003), FLOAT_FIXED(0.0770636497458348), FLOAT_FIXED(0.308096819873653)}, 
-    {FLOAT_FIXED(0.58605036997122), FLOAT_FIXED(0.0770633817824451), FLOAT_FIXED(-0.806601635905141)}, 
-    {FLOAT_FIXED(0.586024373288363), FLOAT_FIXED(0.0770603984518723), FLOAT_FIXED(-0.806620808622254)}, 
-    {FLOAT_FIXED(0.586024853392251), FLOAT_FIXED(0.077060659367799), FLOAT_FIXED(-0.806620434891399)}, 
-    {FLOAT_FIXED(-0.585957397713351), FLOAT_FIXED(0.0770786182816892), FLOAT_FIXED(-0.806667722590153)}, 
-    {FLOAT_FIXED(-0.586038327525297), FLOAT_FIXED(0.0770633414240687), FLOAT_FIXED(-0.806610389270997)}, 
-    {FLOAT_FIXED(-0.586039709202419), FLOAT_FIXED(0.07706262586495), FLOAT_FIXED(-0.806609453783393)}, 
-    {FLOAT_FIXED(-2.890961643631e-07), FLOAT_FIXED(0.0770614735808135), FLOAT_FIXED(0.997026343327733)}, 
-    {FLOAT_FIXED(0.948228375910728), FLOAT_FIXED(0.07706210378918), FLOAT_FIXED(0.308098002715514)}, 
-    {FLOAT_FIXED(0.948227745665268), FLOAT_FIXED(0.0770608346046373), FLOAT_FIXED(0.308100259851563)}, 
-    {FLOAT_FIXED(0.948228682018359), FLOAT_FIXED(0.0770631345474625), FLOAT_FIXED(0.308096802793286)}, 
-    {FLOAT_FIXED(0.948233488249208), FLOAT_FIXED(0.0770586676584688), FLOAT_FIXED(0.308083127583192)}, 
-    {FLOAT_FIXED(0.948213116033757), FLOAT_FIXED(0.0770696640752073), FLOAT_FIXED(0.308143073037328)}, 
-    {FLOAT_FIXED(0.948217464846867), FLOAT_FIXED(0.0770702239414094), FLOAT_FIXED(0.308129550580598)}, 
-    {FLOAT_FIXED(-0.94822871622922), FLOAT_FIXED(0.0770622115861299), FLOAT_FIXED(0.308096928358171)}, 
-    {FLOAT_FIXED(-0.9482281844893), FLOAT_FIXED(0.0770647077988123), FLOAT_FIXED(0.308097940518936)}, 
-    {FLOAT_FIXED(-0.948229323896473), FLOAT_FIXED(0.0770592613637967), FLOAT_FIXED(0.30809579604549)}, 
-    {FLOAT_FIXED(0.586024667495269), FLOAT_FIXED(0.0770732747197325), FLOAT_FIXED(-0.806619364639255)}, 
-    {FLOAT_FIXED(0.586043805207086), FLOAT_FIXED(0.0770604576438327), FLOAT_FIXED(-0.806606684974853)}, 
-    {FLOAT_FIXED(0.586033521276799), FLOAT_FIXED(0.0770569718835824), FLOAT_FIXED(-0.806614489718632)}, 
-    {FLOAT_FIXED(-0.948250198404996), FLOAT_FIXED(0.0770801372715622), FLOAT_FIXED(0.308026319757067)}, 
-    {FLOAT_FIXED(-0.948229150641081), FLOAT_FIXED(0.0770608166946329), FLOAT_FIXED(0.308095940260255)}, 
-    {FLOAT_FIXED(-0.948207246254633), FLOAT_FIXED(0.0770545064024768), FLOAT_FIXED(0.308164925313178)}, 
-    {FLOAT_FIXED(0.586035714327523), FLOAT_FIXED(0.0770626194963131), FLOAT_FIXED(-0.80661235684125)}, 
-    {FLOAT_FIXED(0.586037454011851), FLOAT_FIXED(0.0770624984759172), FLOAT_FIXED(-0.806611104451183)}, 
-    {FLOAT_FIXED(0.586036534433168), FLOAT_FIXED(0.0770612827307792), FLOAT_FIXED(-0.806611888713184)}, 
-    {FLOAT_FIXED(-0.586027446864944), FLOAT_FIXED(0.0770607598232033), FLOAT_FIXED(-0.806618541081487)}, 
-    {FLOAT_FIXED(-0.586037030313482), FLOAT_FIXED(0.0770602499373575), FLOAT_FIXED(-0.806611627104982)}, 
-    {FLOAT_FIXED(-0.586035907912568), FLOAT_FIXED(0.0770592693785371), FLOAT_FIXED(-0.806612536252654)}, 
-    {FLOAT_FIXED(-0.948235283076878), FLOAT_FIXED(0.0770510782764568), FLOAT_FIXED(0.308079501532557)}, 
-    {FLOAT_FIXED(-0.948222265274373), FLOAT_FIXED(0.0770661474585202), FLOAT_FIXED(0.30811579731302)}, 
-    {FLOAT_FIXED(-0.948226390091951), FLOAT_FIXED(0.0770664093459203), FLOAT_FIXED(0.308103037446426)}, 
-    {FLOAT_FIXED(3.17540541870115e-05), FLOAT_FIXED(0.077078044608398), FLOAT_FIXED(0.997025061887125)}, 
-    {FLOAT_FIXED(2.23689674058562e-06), FLOAT_FIXED(0.077066056254017), FLOAT_FIXED(0.997025989113849)}, 
-    {FLOAT_FIXED(1.31776232118779e-05), FLOAT_FIXED(0.0770645455701585), FLOAT_FIXED(0.997026105797845)}, 
-    {FLOAT_FIXED(-0.586035766255795), FLOAT_FIXED(0.0770614764799505), FLOAT_FIXED(-0.806612428314685)}, 
-    {FLOAT_FIXED(-0.586039840911423), FLOAT_FIXED(0.0770624984704373), FLOAT_FIXED(-0.80660937026172)}, 
-    {FLOAT_FIXED(-0.586036643181057), FLOAT_FIXED(0.0770588889742693), FLOAT_FIXED(-0.806612038392144)}, 
-    {FLOAT_FIXED(-6.17148495703793e-05), FLOAT_FIXED(0.0770702920520084), FLOAT_FIXED(0.997025659787297)}, 
-    {FLOAT_FIXED(-1.38835630097226e-06), FLOAT_FIXED(0.0770629109688084), FLOAT_FIXED(0.997026232228163)}, 
-    {FLOAT_FIXED(-3.37838935114807e-05), FLOAT_FIXED(0.0770682748230503), FLOAT_FIXED(0.997025817055129)}, 
-    {FLOAT_FIXED(-0.937720725791485), FLOAT_FIXED(0.283845567005646), FLOAT_FIXED(0.200278642177178)}, 
-    {FLOAT_FIXED(-0.314140903278222), FLOAT_FIXED(0.0950912708822725), FLOAT_FIXED(0.944602108344851)}, 
-    {FLOAT_FIXED(-0.191694009801762), FLOAT_FIXED(0.0580286044263812), FLOAT_FIXED(0.979737764748531)}, 
-    {FLOAT_FIXED(0.642279428989819), FLOAT_FIXED(-0.194416273079392), FLOAT_FIXED(-0.741403701001304)}, 
-    {FLOAT_FIXED(-0.897413675689451), FLOAT_FIXED(0.271644730257714), FLOAT_FIXED(0.347646135040738)}, 
-    {FLOAT_FIXED(0.0816189876931083), FLOAT_FIXED(-0.0247062804839151), FLOAT_FIXED(-0.996357335774973)}, 
-    {FLOAT_FIXED(0.314139639913033), FLOAT_FIXED(-0.0950908884583307), FLOAT_FIXED(0.944602566991809)}, 
-    {FLOAT_FIXED(-0.448590452454321), FLOAT_FIXED(0.228061078997487), FLOAT_FIXED(-0.864149726733353)}, 
-    {FLOAT_FIXED(0.897409560746907), FLOAT_FIXED(-0.271648214997799), FLOAT_FIXED(-0.347654034305016)}, 
-    {FLOAT_FIXED(0.314139639913031), FLOAT_FIXED(-0.095090888458333), FLOAT_FIXED(-0.94460256699181)}, 
-    {FLOAT_FIXED(-0.559779978104493), FLOAT_FIXED(0.211447493752275), FLOAT_FIXED(-0.801209294441356)}, 
-    {FLOAT_FIXED(-0.31413858221894), FLOAT_FIXED(0.0950943826648438), FLOAT_FIXED(-0.944602566980985)}, 
-    {FLOAT_FIXED(-0.66072757646279), FLOAT_FIXED(0.191542302569996), FLOAT_FIXED(-0.725775871759176)}, 
-    {FLOAT_FIXED(0.97973882128936), FLOAT_FIXED(-0.0511066633862791), FLOAT_FIXED(0.193649040834334)}, 
-    {FLOAT_FIXED(-0.573134614276911), FLOAT_FIXED(0.173486321764603), FLOAT_FIXED(-0.800886515105758)}, 
-    {FLOAT_FIXED(0.632383685638428), FLOAT_FIXED(-0.191435203412013), FLOAT_FIXED(-0.750628694517442)}, 
-    {FLOAT_FIXED(0.954951921371809), FLOAT_FIXED(-0.289061404029575), FLOAT_FIXED(-0.0671590095872525)}, 
-    {FLOAT_FIXED(-0.332740458703296), FLOAT_FIXED(0.100721404827769), FLOAT_FIXED(0.937624117518017)}, 
-    {FLOAT_FIXED(0.750630128091569), FLOAT_FIXED(-0.168601104355449), FLOAT_FIXED(0.6388490263054)}, 
-    {FLOAT_FIXED(0.855408258643316), FLOAT_FIXED(-0.25892980235772), FLOAT_FIXED(-0.448588975004738)}, 
-    {FLOAT_FIXED(0.893739907738367), FLOAT_FIXED(-0.114467246426354), FLOAT_FIXED(0.433735203564783)}, 
-    {FLOAT_FIXED(0.997741580572754), FLOAT_FIXED(-0.0171396789151213), FLOAT_FIXED(0.0649458990458207)}, 
-    {FLOAT_FIXED(-0.828642670959322), FLOAT_FIXED(0.142842351701738), FLOAT_FIXED(-0.54124614218091)}, 
-    {FLOAT_FIXED(-0.429349269883357), FLOAT_FIXED(0.129965143983256), FLOAT_FIXED(-0.893738365406812)}, 
-    {FLOAT_FIXED(0.937719114305272), FLOAT_FIXED(-0.283850022010388), FLOAT_FIXED(-0.200279873355359)}, 
-    {FLOAT_FIXED(-0.750623347072792), FLOAT_FIXED(0.168601032393751), FLOAT_FIXED(-0.638857012722722)}, 
-    {FLOAT_FIXED(-0.0671670676609647), FLOAT_FIXED(-0.254597490119114), FLOAT_FIXED(0.964711720177005)}, 
-    {FLOAT_FIXED(-0.904089858029497), FLOAT_FIXED(0.273665592876645), FLOAT_FIXED(0.328220462317141)}, 
-    {FLOAT_FIXED(-0.855407541585752), FLOAT_FIXED(0.258929585306302), FLOAT_FIXED(-0.448590467633147)}, 
-    {FLOAT_FIXED(-0.718435610177927), FLOAT_FIXED(0.217468546358381), FLOAT_FIXED(-0.660725136023326)}, 
-    {FLOAT_FIXED(0.979738711194529), FLOAT_FIXED(0.0511061831330812), FLOAT_FIXED(-0.193649724586562)}, 
-    {FLOAT_FIXED(-0.535772448087628), FLOAT_FIXED(0.162174069532411), FLOAT_FIXED(0.828641934155813)}, 
-    {FLOAT_FIXED(-0.954950385245202), FLOAT_FIXED(0.289065972672962), FLOAT_FIXED(0.0671611879188692)}, 
-    {FLOAT_FIXED(0.0296176261089974), FLOAT_FIXED(-0.0089653326829782), FLOAT_FIXED(0.9995210948417)}, 
-    {FLOAT_FIXED(-0.429349269883358), FLOAT_FIXED(0.129965143983252), FLOAT_FIXED(0.893738365406812)}, 
-    {FLOAT_FIXED(-0.632391175834906), FLOAT_FIXED(0.191423125176973), FLOAT_FIXED(0.750625464445236)}, 
-    {FLOAT_FIXED(0.709600323514386), FLOAT_FIXED(-0.214797868973125), FLOAT_FIXED(-0.671065761571013)}, 
-    {FLOAT_FIXED(-0.855408783864308), FLOAT_FIXED(0.258929961340721), FLOAT_FIXED(0.448587881699761)}, 
-    {FLOAT_FIXED(-0.893739907738368), FLOAT_FIXED(-0.114467246426356), FLOAT_FIXED(0.433735203564781)}, 
-    {FLOAT_FIXED(0.954950385245203), FLOAT_FIXED(-0.28906597267296), FLOAT_FIXED(0.0671611879188677)}, 
-    {FLOAT_FIXED(0.904089858029499), FLOAT_FIXED(-0.27366559287664), FLOAT_FIXED(0.328220462317141)}, 
-    {FLOAT_FIXED(0.793101737964821), FLOAT_FIXED(-0.240073964946932), FLOAT_FIXED(0.559780425338221)}, 
-    {FLOAT_FIXED(-0.20028617700761), FLOAT_FIXED(0.250003264384921), FLOAT_FIXED(-0.947303444043438)}, 
-    {FLOAT_FIXED(-0.328214540386949), FLOAT_FIXED(0.241040844159445), FLOAT_FIXED(-0.913331553667936)}, 
-    {FLOAT_FIXED(-0.559781928303251), FLOAT_FIXED(0.211449713183984), FLOAT_FIXED(-0.801207346159223)}, 
-    {FLOAT_FIXED(-0.660729181687707), FLOAT_FIXED(0.191539627010519), FLOAT_FIXED(-0.725775116514037)}, 
-    {FLOAT_FIXED(-0.750624590822673), FLOAT_FIXED(0.168602709595441), FLOAT_FIXED(-0.638855108744831)}, 
-    {FLOAT_FIXED(-0.828643560946648), FLOAT_FIXED(0.142840289111013), FLOAT_FIXED(-0.541245323959793)}, 
-    {FLOAT_FIXED(-0.893737756358315), FLOAT_FIXED(0.114469723667607), FLOAT_FIXED(-0.433738982826153)}, 
-    {FLOAT_FIXED(-0.944602207167658), FLOAT_FIXED(0.0837534764430403), FLOAT_FIXED(-0.317351580109024)}, 
-    {FLOAT_FIXED(-0.979739238446477), FLOAT_FIXED(0.0511031845186226), FLOAT_FIXED(-0.193647848375274)}, 
-    {FLOAT_FIXED(-0.997742263019911), FLOAT_FIXED(0.0171372991413671), FLOAT_FIXED(-0.0649360420879307)}, 
-    {FLOAT_FIXED(-0.997742296747805), FLOAT_FIXED(-0.0171369641604896), FLOAT_FIXED(0.0649356122615046)}, 
-    {FLOAT_FIXED(-0.979738711194529), FLOAT_FIXED(-0.0511061831330813), FLOAT_FIXED(0.193649724586562)}, 
-    {FLOAT_FIXED(-0.944600767440527), FLOAT_FIXED(-0.0837545337611697), FLOAT_FIXED(0.31735558640934)}, 
-    {FLOAT_FIXED(-0.893739907738367), FLOAT_FIXED(-0.114467246426354), FLOAT_FIXED(0.433735203564783)}, 
-    {FLOAT_FIXED(-0.828642670961342), FLOAT_FIXED(-0.142840625290404), FLOAT_FIXED(0.541246597798729)}, 
-    {FLOAT_FIXED(-0.750624590822673), FLOAT_FIXED(-0.16860270959544), FLOAT_FIXED(0.638855108744831)}, 
-    {FLOAT_FIXED(-0.660729181687704), FLOAT_FIXED(-0.191539627010519), FLOAT_FIXED(0.72577511651404)}, 
-    {FLOAT_FIXED(-0.559774538590397), FLOAT_FIXED(-0.211450987031988), FLOAT_FIXED(0.801212172916205)}, 
-    {FLOAT_FIXED(-0.448590452440197), FLOAT_FIXED(-0.228058322624504), FLOAT_FIXED(0.864150454180982)}, 
-    {FLOAT_FIXED(-0.328214540427133), FLOAT_FIXED(-0.241026892199599), FLOAT_FIXED(0.913335235654909)}, 
-    {FLOAT_FIXED(-0.200276194072459), FLOAT_FIXED(-0.250003785128867), FLOAT_FIXED(0.947305417227776)}, 
-    {FLOAT_FIXED(-0.0671643987298911), FLOAT_FIXED(-0.254600613100196), FLOAT_FIXED(0.964711081802348)}, 
-    {FLOAT_FIXED(0.0671651028236302), FLOAT_FIXED(-0.25459752387072), FLOAT_FIXED(0.964711848067385)}, 
-    {FLOAT_FIXED(0.200271448935925), FLOAT_FIXED(-0.250007054258487), FLOAT_FIXED(0.94730555765397)}, 
-    {FLOAT_FIXED(0.328217930958564), FLOAT_FIXED(-0.241026591595589), FLOAT_FIXED(0.913334096561107)}, 
-    {FLOAT_FIXED(0.4485904524402), FLOAT_FIXED(-0.228058322624499), FLOAT_FIXED(0.864150454180981)}, 
-    {FLOAT_FIXED(0.559772588350172), FLOAT_FIXED(-0.211448767585568), FLOAT_FIXED(0.801214121204996)}, 
-    {FLOAT_FIXED(0.660722039168685), FLOAT_FIXED(-0.191543546324137), FLOAT_FIXED(0.725780584487039)}, 
-    {FLOAT_FIXED(0.750624171577806), FLOAT_FIXED(-0.168593072042192), FLOAT_FIXED(0.638858144741467)}, 
-    {FLOAT_FIXED(0.828642670959324), FLOAT_FIXED(-0.142842351701736), FLOAT_FIXED(0.541246142180908)}, 
-    {FLOAT_FIXED(0.893739907738367), FLOAT_FIXED(-0.114467246426356), FLOAT_FIXED(0.433735203564782)}, 
-    {FLOAT_FIXED(0.944601068065847), FLOAT_FIXED(-0.0837533007216915), FLOAT_FIXED(0.317355017018927)}, 
-    {FLOAT_FIXED(0.997741604764568), FLOAT_FIXED(-0.0171400015275353), FLOAT_FIXED(0.0649454422531789)}, 
-    {FLOAT_FIXED(0.997741558930269), FLOAT_FIXED(0.0171397609470494), FLOAT_FIXED(-0.0649462098822924)}, 
-    {FLOAT_FIXED(0.979739238444922), FLOAT_FIXED(0.0511025668840729), FLOAT_FIXED(-0.193648011374306)}, 
-    {FLOAT_FIXED(0.944601068065846), FLOAT_FIXED(0.0837533007216933), FLOAT_FIXED(-0.317355017018927)}, 
-    {FLOAT_FIXED(0.893737756358315), FLOAT_FIXED(0.114469723667607), FLOAT_FIXED(-0.433738982826154)}, 
-    {FLOAT_FIXED(0.828642670959322), FLOAT_FIXED(0.142842351701737), FLOAT_FIXED(-0.54124614218091)}, 
-    {FLOAT_FIXED(0.750618634239427), FLOAT_FIXED(0.16859467718023), FLOAT_FIXED(-0.638864227171181)}, 
-    {FLOAT_FIXED(0.66072757646279), FLOAT_FIXED(0.191542302569996), FLOAT_FIXED(-0.725775871759176)}, 
-    {FLOAT_FIXED(0.559779978104493), FLOAT_FIXED(0.211447493752275), FLOAT_FIXED(-0.801209294441356)}, 
-    {FLOAT_FIXED(0.448590452454321), FLOAT_FIXED(0.228061078997487), FLOAT_FIXED(-0.864149726733353)}, 
-    {FLOAT_FIXED(0.328217930918375), FLOAT_FIXED(0.24104054353803), FLOAT_FIXED(-0.913330414578729)}, 
-    {FLOAT_FIXED(0.200284066383827), FLOAT_FIXED(0.25000639609316), FLOAT_FIXED(-0.947303063789656)}, 
-    {FLOAT_FIXED(0.0671576586730908), FLOAT_FIXED(0.254597651735932), FLOAT_FIXED(-0.964712332569714)}, 
-    {FLOAT_FIXED(-0.0671542857364253), FLOAT_FIXED(0.254600786803873), FLOAT_FIXED(-0.964711739985618)}, 
-    {FLOAT_FIXED(-0.0671651028469091), FLOAT_FIXED(-0.254585864181278), FLOAT_FIXED(0.964714925104114)}, 
-    {FLOAT_FIXED(-0.200286058918945), FLOAT_FIXED(-0.250003270544992), FLOAT_FIXED(0.947303467384937)}, 
-    {FLOAT_FIXED(-0.328213115350857), FLOAT_FIXED(-0.241040970509211), FLOAT_FIXED(0.91333203242176)}, 
-    {FLOAT_FIXED(-0.448590597252264), FLOAT_FIXED(-0.228061060451766), FLOAT_FIXED(0.864149656461468)}, 
-    {FLOAT_FIXED(-0.559777899347385), FLOAT_FIXED(-0.211447852087364), FLOAT_FIXED(0.801210652231902)}, 
-    {FLOAT_FIXED(-0.660728275260298), FLOAT_FIXED(-0.191539830606548), FLOAT_FIXED(0.725775887972842)}, 
-    {FLOAT_FIXED(-0.750622171706319), FLOAT_FIXED(-0.168603410882528), FLOAT_FIXED(0.63885776600247)}, 
-    {FLOAT_FIXED(-0.828644566472601), FLOAT_FIXED(-0.142833367710893), FLOAT_FIXED(0.541245611089643)}, 
-    {FLOAT_FIXED(-0.89373724697442), FLOAT_FIXED(-0.114464740314033), FLOAT_FIXED(0.433741347574135)}, 
-    {FLOAT_FIXED(-0.944601297097566), FLOAT_FIXED(-0.0837541447892084), FLOAT_FIXED(0.317354112549725)}, 
-    {FLOAT_FIXED(-0.979738787170286), FLOAT_FIXED(-0.0511060882946794), FLOAT_FIXED(0.193649365228275)}, 
-    {FLOAT_FIXED(-0.997741913668794), FLOAT_FIXED(-0.0171378385723551), FLOAT_FIXED(0.0649412672928441)}, 
-    {FLOAT_FIXED(-0.99774190426236), FLOAT_FIXED(0.017138451981087), FLOAT_FIXED(-0.0649412499310782)}, 
-    {FLOAT_FIXED(-0.979738701539973), FLOAT_FIXED(0.0511068128679261), FLOAT_FIXED(-0.193649607237532)}, 
-    {FLOAT_FIXED(-0.944601063282114), FLOAT_FIXED(0.0837522919931972), FLOAT_FIXED(-0.317355297469864)}, 
-    {FLOAT_FIXED(-0.893737246988798), FLOAT_FIXED(0.114468599129983), FLOAT_FIXED(-0.433740329181071)}, 
-    {FLOAT_FIXED(-0.828643874288136), FLOAT_FIXED(0.142840170750416), FLOAT_FIXED(-0.541244875472037)}, 
-    {FLOAT_FIXED(-0.750626804581031), FLOAT_FIXED(0.168602067835849), FLOAT_FIXED(-0.638852677043734)}, 
-    {FLOAT_FIXED(-0.660723544427074), FLOAT_FIXED(0.191540893208532), FLOAT_FIXED(-0.725779914346355)}, 
-    {FLOAT_FIXED(-0.559779416046889), FLOAT_FIXED(0.211435351616221), FLOAT_FIXED(-0.801212891469632)}, 
-    {FLOAT_FIXED(-0.448590597265823), FLOAT_FIXED(0.228050616057131), FLOAT_FIXED(-0.864152412807287)}, 
-    {FLOAT_FIXED(-0.32821311538682), FLOAT_FIXED(0.241027018542429), FLOAT_FIXED(-0.913335714412081)}, 
-    {FLOAT_FIXED(-0.200276245321198), FLOAT_FIXED(0.250006804069203), FLOAT_FIXED(-0.947304609657921)}, 
-    {FLOAT_FIXED(-0.067165102823634), FLOAT_FIXED(0.254597523870719), FLOAT_FIXED(-0.964711848067385)}, 
-    {FLOAT_FIXED(0.0671645551999427), FLOAT_FIXED(0.254597533277511), FLOAT_FIXED(-0.964711883711298)}, 
-    {FLOAT_FIXED(0.200274196181532), FLOAT_FIXED(0.250003889342423), FLOAT_FIXED(-0.947305812110061)}, 
-    {FLOAT_FIXED(0.328225027281452), FLOAT_FIXED(0.241039914327846), FLOAT_FIXED(-0.91332803042878)}, 
-    {FLOAT_FIXED(0.448588902152737), FLOAT_FIXED(0.228048076888295), FLOAT_FIXED(-0.864153962840507)}, 
-    {FLOAT_FIXED(0.5597803981753), FLOAT_FIXED(0.211440293287568), FLOAT_FIXED(-0.801210901194667)}, 
-    {FLOAT_FIXED(0.660725216917898), FLOAT_FIXED(0.191529430787617), FLOAT_FIXED(-0.72578141673025)}, 
-    {FLOAT_FIXED(0.750631111349787), FLOAT_FIXED(0.168598781577948), FLOAT_FIXED(-0.638848484011831)}, 
-    {FLOAT_FIXED(0.828640550867875), FLOAT_FIXED(0.142843152541396), FLOAT_FIXED(-0.541249176654728)}, 
-    {FLOAT_FIXED(0.893737246988798), FLOAT_FIXED(0.114468599129983), FLOAT_FIXED(-0.433740329181072)}, 
-    {FLOAT_FIXED(0.944603700365352), FLOAT_FIXED(0.0837513675992118), FLOAT_FIXED(-0.317347692100235)}, 
-    {FLOAT_FIXED(0.979737231205469), FLOAT_FIXED(0.0511080305252583), FLOAT_FIXED(-0.193656724659049)}, 
-    {FLOAT_FIXED(0.997742470660332), FLOAT_FIXED(0.0171367190854941), FLOAT_FIXED(-0.0649330047017761)}, 
-    {FLOAT_FIXED(0.99774242562059), FLOAT_FIXED(-0.0171364756055804), FLOAT_FIXED(0.0649337610227526)}, 
-    {FLOAT_FIXED(0.979737470054507), FLOAT_FIXED(-0.051107732387327), FLOAT_FIXED(0.193655594965444)}, 
-    {FLOAT_FIXED(0.944603282035264), FLOAT_FIXED(-0.0837506625962266), FLOAT_FIXED(0.317349123337217)}, 
-    {FLOAT_FIXED(0.893737246974419), FLOAT_FIXED(-0.114464740314033), FLOAT_FIXED(0.433741347574135)}, 
-    {FLOAT_FIXED(0.828639858661823), FLOAT_FIXED(-0.142836872287701), FLOAT_FIXED(0.541251893809141)}, 
-    {FLOAT_FIXED(0.750631111297955), FLOAT_FIXED(-0.168591060349912), FLOAT_FIXED(0.638850521735475)}, 
-    {FLOAT_FIXED(0.660725216992038), FLOAT_FIXED(-0.191542832542576), FLOAT_FIXED(0.725777879886395)}, 
-    {FLOAT_FIXED(0.559781914985837), FLOAT_FIXED(-0.211447159871909), FLOAT_FIXED(0.801208029313793)}, 
-    {FLOAT_FIXED(0.448588902233273), FLOAT_FIXED(-0.228058521172165), FLOAT_FIXED(0.864151206510708)}, 
-    {FLOAT_FIXED(0.32821575241309), FLOAT_FIXED(-0.241040736695568), FLOAT_FIXED(0.913331146474907)}, 
-    {FLOAT_FIXED(0.200284009796506), FLOAT_FIXED(-0.250006399045029), FLOAT_FIXED(0.94730307497462)}, 
-    {FLOAT_FIXED(0.0671645551999395), FLOAT_FIXED(-0.254597533277518), FLOAT_FIXED(0.964711883711296)}, 
-    {FLOAT_FIXED(-0.332745248836491), FLOAT_FIXED(0.100721100885031), FLOAT_FIXED(-0.937622450250232)}, 
-    {FLOAT_FIXED(-0.953625767112257), FLOAT_FIXED(0.288665007308753), FLOAT_FIXED(0.0852666983939058)}, 
-    {FLOAT_FIXED(-0.944601068065847), FLOAT_FIXED(-0.0837533007216912), FLOAT_FIXED(0.317355017018925)}, 
-    {FLOAT_FIXED(0.197134306264827), FLOAT_FIXED(-0.0596730687458906), FLOAT_FIXED(0.978558731073375)}, 
-    {FLOAT_FIXED(0.855409500914647), FLOAT_FIXED(-0.258930178389947), FLOAT_FIXED(0.448586389075622)}, 
-    {FLOAT_FIXED(-0.0816191069884744), FLOAT_FIXED(0.0247058863736681), FLOAT_FIXED(0.99635733577512)}, 
-    {FLOAT_FIXED(-0.954951921371811), FLOAT_FIXED(0.289061404029569), FLOAT_FIXED(-0.0671590095872509)}, 
-    {FLOAT_FIXED(0.944600767440527), FLOAT_FIXED(0.0837545337611704), FLOAT_FIXED(-0.317355586409342)}, 
-    {FLOAT_FIXED(0.328227365797855), FLOAT_FIXED(-0.24103679374015), FLOAT_FIXED(0.913328013588146)}, 
-    {FLOAT_FIXED(-0.90409051578734), FLOAT_FIXED(0.273665791978193), FLOAT_FIXED(-0.328218484495206)}, 
-    {FLOAT_FIXED(-0.997742308839929), FLOAT_FIXED(-0.0171371254391336), FLOAT_FIXED(0.064935383901629)}, 
-    {FLOAT_FIXED(-0.559772588350171), FLOAT_FIXED(-0.211448767585568), FLOAT_FIXED(0.801214121204996)}, 
-    {FLOAT_FIXED(-0.997742250927382), FLOAT_FIXED(0.0171371378616971), FLOAT_FIXED(-0.0649362704524278)}, 
-    {FLOAT_FIXED(-0.979738821289368), FLOAT_FIXED(0.0511060457047282), FLOAT_FIXED(-0.193649203847953)}, 
-    {FLOAT_FIXED(-0.200273559454599), FLOAT_FIXED(-0.250006944170278), FLOAT_FIXED(0.947305140517049)}, 
-    {FLOAT_FIXED(0.936588154430451), FLOAT_FIXED(-0.283507677506088), FLOAT_FIXED(0.20597578929492)}, 
-    {FLOAT_FIXED(-0.956652909970962), FLOAT_FIXED(0.28958133134861), FLOAT_FIXED(-0.0309493518261066)}, 
-    {FLOAT_FIXED(-0.0642802330356968), FLOAT_FIXED(0.0194574553930992), FLOAT_FIXED(-0.997742180661168)}, 
-    {FLOAT_FIXED(0.429349269883356), FLOAT_FIXED(-0.129965143983255), FLOAT_FIXED(-0.893738365406813)}, 
-    {FLOAT_FIXED(-0.944600767429156), FLOAT_FIXED(0.0837496858791254), FLOAT_FIXED(-0.31735686582678)}, 
-    {FLOAT_FIXED(-0.793103732320584), FLOAT_FIXED(0.240070388126299), FLOAT_FIXED(-0.559779133698326)}, 
-    {FLOAT_FIXED(0.937719355188716), FLOAT_FIXED(-0.28385009492644), FLOAT_FIXED(0.200278642183107)}, 
-    {FLOAT_FIXED(0.197136010760684), FLOAT_FIXED(-0.0596735847012327), FLOAT_FIXED(-0.978558356231384)}, 
-    {FLOAT_FIXED(-0.709593739907127), FLOAT_FIXED(0.214804492216996), FLOAT_FIXED(-0.671070603146953)}, 
-    {FLOAT_FIXED(0.535770046807696), FLOAT_FIXED(-0.16217899076478), FLOAT_FIXED(0.828642523587944)}, 
-    {FLOAT_FIXED(0.832845601805089), FLOAT_FIXED(-0.252104536206213), FLOAT_FIXED(-0.492759075388947)}, 
-    {FLOAT_FIXED(0.0642802330356969), FLOAT_FIXED(-0.0194574553930991), FLOAT_FIXED(-0.997742180661168)}, 
-    {FLOAT_FIXED(0.95665302740184), FLOAT_FIXED(-0.289581366895243), FLOAT_FIXED(-0.0309453891553588)}, 
-    {FLOAT_FIXED(0.89741039437722), FLOAT_FIXED(-0.271648467339869), FLOAT_FIXED(0.347651685247782)}, 
-    {FLOAT_FIXED(0.535774261837207), FLOAT_FIXED(-0.162177442553439), FLOAT_FIXED(-0.828640101298279)}, 
-    {FLOAT_FIXED(0.448590452440196), FLOAT_FIXED(-0.228058322624504), FLOAT_FIXED(0.864150454180982)}, 
-    {FLOAT_FIXED(0.953626891954742), FLOAT_FIXED(-0.288660321152926), FLOAT_FIXED(0.0852699826001441)}, 
-    {FLOAT_FIXED(-0.897409371900944), FLOAT_FIXED(0.271643427512396), FLOAT_FIXED(-0.347658262541926)}, 
-    {FLOAT_FIXED(0.766539554268689), FLOAT_FIXED(-0.232033522652679), FLOAT_FIXED(0.598813456851922)}, 
-    {FLOAT_FIXED(0.332743583259902), FLOAT_FIXED(-0.100718842860745), FLOAT_FIXED(0.937623283889726)}, 
-    {FLOAT_FIXED(0.642280060554704), FLOAT_FIXED(-0.194416464252401), FLOAT_FIXED(0.741403103744138)}, 
-    {FLOAT_FIXED(-0.471621099491032), FLOAT_FIXED(0.142758451119727), FLOAT_FIXED(-0.870168698097539)}, 
-    {FLOAT_FIXED(-0.832846136669067), FLOAT_FIXED(0.252100308108009), FLOAT_FIXED(-0.492760334531156)}, 
-    {FLOAT_FIXED(0.718425410704971), FLOAT_FIXED(-0.217481756341988), FLOAT_FIXED(0.660731878231857)}, 
-    {FLOAT_FIXED(-0.642284495763751), FLOAT_FIXED(0.194417806778364), FLOAT_FIXED(-0.741398909433373)}, 
-    {FLOAT_FIXED(0.936588154430451), FLOAT_FIXED(-0.283507677506089), FLOAT_FIXED(-0.205975789294919)}, 
-    {FLOAT_FIXED(0.19169572187803), FLOAT_FIXED(-0.0580257846205749), FLOAT_FIXED(0.979737596774171)}, 
-    {FLOAT_FIXED(0.559781928303252), FLOAT_FIXED(0.211449713183984), FLOAT_FIXED(-0.801207346159222)}, 
-    {FLOAT_FIXED(-0.766540674652726), FLOAT_FIXED(0.232029821294655), FLOAT_FIXED(-0.598813456873603)}, 
-    {FLOAT_FIXED(-0.471628387199617), FLOAT_FIXED(0.142760657089715), FLOAT_FIXED(0.870164386294222)}, 
-    {FLOAT_FIXED(-0.0296219025001589), FLOAT_FIXED(0.00896647101816698), FLOAT_FIXED(-0.999520957904211)}, 
-    {FLOAT_FIXED(0.200281431797821), FLOAT_FIXED(0.250003511914616), FLOAT_FIXED(-0.947304381974122)}, 
-    {FLOAT_FIXED(0.573135124921506), FLOAT_FIXED(-0.173489497379415), FLOAT_FIXED(-0.80088546177356)}, 
-    {FLOAT_FIXED(0.632395030473901), FLOAT_FIXED(-0.19142429196594), FLOAT_FIXED(0.750621919395678)}, 
-    {FLOAT_FIXED(0.471625110226916), FLOAT_FIXED(-0.142762151134931), FLOAT_FIXED(0.870165917286339)}, 
-    {FLOAT_FIXED(0.660729181687707), FLOAT_FIXED(0.191539627010519), FLOAT_FIXED(-0.725775116514038)}, 
-    {FLOAT_FIXED(-0.573140838730073), FLOAT_FIXED(0.17348820589), FLOAT_FIXED(0.80088165255352)}, 
-    {FLOAT_FIXED(0.997741604764059), FLOAT_FIXED(0.0171388022865436), FLOAT_FIXED(-0.0649457587454571)}, 
-    {FLOAT_FIXED(-0.642289615364752), FLOAT_FIXED(0.194419356467956), FLOAT_FIXED(0.74139406783787)}, 
-    {FLOAT_FIXED(0.471620417037856), FLOAT_FIXED(-0.142758244542972), FLOAT_FIXED(-0.870169101869314)}, 
-    {FLOAT_FIXED(-0.709605795903452), FLOAT_FIXED(0.214795785086972), FLOAT_FIXED(0.671060641916287)}, 
-    {FLOAT_FIXED(-0.936587638458308), FLOAT_FIXED(0.28350752131997), FLOAT_FIXED(-0.205978350420855)}, 
-    {FLOAT_FIXED(-0.197141071406568), FLOAT_FIXED(0.0596775103232248), FLOAT_FIXED(0.978557097325594)}, 
-    {FLOAT_FIXED(0.766539326315989), FLOAT_FIXED(-0.232029413156715), FLOAT_FIXED(-0.598815341020235)}, 
-    {FLOAT_FIXED(-0.766540674652723), FLOAT_FIXED(0.232029821294654), FLOAT_FIXED(0.598813456873607)}, 
-    {FLOAT_FIXED(0.660729726719235), FLOAT_FIXED(-0.191530732739617), FLOAT_FIXED(0.725776967563555)}, 
-    {FLOAT_FIXED(0.332739185046025), FLOAT_FIXED(-0.100719265391802), FLOAT_FIXED(-0.937624799327451)}, 
-    {FLOAT_FIXED(-0.632388587931743), FLOAT_FIXED(0.191419008567555), FLOAT_FIXED(-0.750628694503954)}, 
-    {FLOAT_FIXED(-0.937720484907685), FLOAT_FIXED(0.28384549409077), FLOAT_FIXED(-0.200279873349425)}, 
-    {FLOAT_FIXED(0.718434560088292), FLOAT_FIXED(-0.21747201542881), FLOAT_FIXED(-0.66072513602562)}, 
-    {FLOAT_FIXED(-0.191689677262534), FLOAT_FIXED(0.0580249653441763), FLOAT_FIXED(-0.979738827967838)}, 
-    {FLOAT_FIXED(0.904089194342067), FLOAT_FIXED(-0.273670157511378), FLOAT_FIXED(-0.328218484491063)}, 
-    {FLOAT_FIXED(0.832845601805089), FLOAT_FIXED(-0.252104536206213), FLOAT_FIXED(0.492759075388947)}, 
-    {FLOAT_FIXED(-0.535773478721051), FLOAT_FIXED(0.1621800296139), FLOAT_FIXED(-0.8286401013067)}, 
-    {FLOAT_FIXED(-0.832849073682249), FLOAT_FIXED(0.252101197134076), FLOAT_FIXED(0.49275491562255)}, 
-    {FLOAT_FIXED(0.709601360693881), FLOAT_FIXED(-0.214794442560844), FLOAT_FIXED(0.671065761566158)}, 
-    {FLOAT_FIXED(-0.328223975192507), FLOAT_FIXED(-0.241037094374179), FLOAT_FIXED(0.913329152739844)}, 
-    {FLOAT_FIXED(-0.448598992008459), FLOAT_FIXED(-0.228046784641822), FLOAT_FIXED(0.864149066066452)}, 
-    {FLOAT_FIXED(0.200284066285897), FLOAT_FIXED(-0.249991925196792), FLOAT_FIXED(0.947306882762069)}, 
-    {FLOAT_FIXED(-0.200283542397805), FLOAT_FIXED(0.25000642342676), FLOAT_FIXED(-0.94730316735982)}, 
-    {FLOAT_FIXED(0.559774538590397), FLOAT_FIXED(-0.211450987031988), FLOAT_FIXED(0.801212172916205)}, 
-    {FLOAT_FIXED(0.828646933143861), FLOAT_FIXED(0.142832473766096), FLOAT_FIXED(-0.541242223620009)}, 
-    {FLOAT_FIXED(0.793102897199242), FLOAT_FIXED(-0.240070135337291), FLOAT_FIXED(-0.559780425321663)}, 
-    {FLOAT_FIXED(0.750624590822674), FLOAT_FIXED(0.168602709595441), FLOAT_FIXED(-0.63885510874483)}, 
-    {FLOAT_FIXED(-0.828643560955386), FLOAT_FIXED(-0.142842015514221), FLOAT_FIXED(0.541244868327648)}, 
-    {FLOAT_FIXED(-0.197134594401833), FLOAT_FIXED(0.0596721168524737), FLOAT_FIXED(-0.978558731073598)}, 
-    {FLOAT_FIXED(0.573134614276914), FLOAT_FIXED(-0.173486321764597), FLOAT_FIXED(0.800886515105757)}, 
-    {FLOAT_FIXED(0.191689677262535), FLOAT_FIXED(-0.0580249653441743), FLOAT_FIXED(-0.979738827967838)}, 
-    {FLOAT_FIXED(0.0671677717991416), FLOAT_FIXED(-0.254600555157547), FLOAT_FIXED(0.964710862250969)}, 
-    {FLOAT_FIXED(0.944600767440527), FLOAT_FIXED(-0.08375453376117), FLOAT_FIXED(0.317355586409342)}, 
-    {FLOAT_FIXED(0.828643560946648), FLOAT_FIXED(-0.142840289111015), FLOAT_FIXED(0.541245323959793)}, 
-    {FLOAT_FIXED(-0.979738821289359), FLOAT_FIXED(-0.0511066633862793), FLOAT_FIXED(0.193649040834335)}, 
-    {FLOAT_FIXED(-0.660727576462787), FLOAT_FIXED(-0.191542302569996), FLOAT_FIXED(0.725775871759179)}, 
-    {FLOAT_FIXED(-0.0642802529643494), FLOAT_FIXED(0.0194578002521384), FLOAT_FIXED(0.997742172651927)}, 
-    {FLOAT_FIXED(-0.718432888876268), FLOAT_FIXED(0.217467722627621), FLOAT_FIXED(0.660728366120341)}, 
-    {FLOAT_FIXED(0.429349269883357), FLOAT_FIXED(-0.129965143983255), FLOAT_FIXED(0.893738365406812)}, 
-    {FLOAT_FIXED(-0.793103732320585), FLOAT_FIXED(0.240070388126293), FLOAT_FIXED(0.559779133698326)}, 
-    {FLOAT_FIXED(-0.0671569546644533), FLOAT_FIXED(0.254597663827672), FLOAT_FIXED(-0.964712378387304)}, 
-    {FLOAT_FIXED(-0.750623347072794), FLOAT_FIXED(-0.168601032393754), FLOAT_FIXED(0.638857012722719)}, 
-    {FLOAT_FIXED(0.0671549897173378), FLOAT_FIXED(0.254600774712945), FLOAT_FIXED(-0.9647116941717)}, 
-    {FLOAT_FIXED(0.573134614276914), FLOAT_FIXED(-0.173486321764602), FLOAT_FIXED(-0.800886515105756)}, 
-    {FLOAT_FIXED(0.832845601805089), FLOAT_FIXED(-0.252104536206212), FLOAT_FIXED(0.492759075388946)}, 
-    {FLOAT_FIXED(-0.897413675689453), FLOAT_FIXED(0.27164473025771), FLOAT_FIXED(0.347646135040736)}, 
-    {FLOAT_FIXED(-0.0296218236548084), FLOAT_FIXED(0.0089666032910445), FLOAT_FIXED(-0.999520959054278)}, 
-    {FLOAT_FIXED(0.081618987693109), FLOAT_FIXED(-0.0247062804839146), FLOAT_FIXED(-0.996357335774973)}, 
-    {FLOAT_FIXED(0.197133850662678), FLOAT_FIXED(-0.0596708526514825), FLOAT_FIXED(0.978558957992185)}, 
-    {FLOAT_FIXED(0.332739185046026), FLOAT_FIXED(-0.100719265391805), FLOAT_FIXED(-0.93762479932745)}, 
-    {FLOAT_FIXED(-0.832846136669068), FLOAT_FIXED(0.252100308108001), FLOAT_FIXED(-0.492760334531158)}, 
-    {FLOAT_FIXED(-0.573127392459988), FLOAT_FIXED(0.173494115843146), FLOAT_FIXED(-0.800889994805666)}, 
-    {FLOAT_FIXED(-0.642284495763752), FLOAT_FIXED(0.194417806778373), FLOAT_FIXED(-0.74139890943337)}, 
-    {FLOAT_FIXED(-0.709601601554903), FLOAT_FIXED(0.214794515468834), FLOAT_FIXED(-0.671065483537356)}, 
-    {FLOAT_FIXED(-0.766532518990984), FLOAT_FIXED(0.232040700543982), FLOAT_FIXED(-0.598819681223317)}, 
-    {FLOAT_FIXED(-0.332741596411779), FLOAT_FIXED(0.100719995305798), FLOAT_FIXED(0.93762386518419)}, 
-    {FLOAT_FIXED(0.936588154430451), FLOAT_FIXED(-0.283507677506089), FLOAT_FIXED(0.205975789294919)}, 
-    {FLOAT_FIXED(-0.0816178241266384), FLOAT_FIXED(0.0247069192995892), FLOAT_FIXED(0.996357415249948)}, 
-    {FLOAT_FIXED(-0.956654272697005), FLOAT_FIXED(0.289576701243179), FLOAT_FIXED(-0.0309505513308394)}, 
-    {FLOAT_FIXED(-0.197140546653725), FLOAT_FIXED(0.0596749577278886), FLOAT_FIXED(0.978557358709874)}, 
-    {FLOAT_FIXED(0.471620410156801), FLOAT_FIXED(-0.142760728411442), FLOAT_FIXED(-0.870168698096504)}, 
-    {FLOAT_FIXED(-0.709605795903452), FLOAT_FIXED(0.214795785086972), FLOAT_FIXED(0.671060641916288)}, 
-    {FLOAT_FIXED(-0.573140838730072), FLOAT_FIXED(0.173488205889994), FLOAT_FIXED(0.800881652553522)}, 
-    {FLOAT_FIXED(0.471623322011904), FLOAT_FIXED(-0.142764850418872), FLOAT_FIXED(0.870166443629799)}, 
-    {FLOAT_FIXED(-0.33274524883649), FLOAT_FIXED(0.10072110088503), FLOAT_FIXED(-0.937622450250232)}, 
-    {FLOAT_FIXED(0.197135782951764), FLOAT_FIXED(-0.0596724766233737), FLOAT_FIXED(-0.978558469695924)}, 
-    {FLOAT_FIXED(0.936588154430451), FLOAT_FIXED(-0.283507677506088), FLOAT_FIXED(-0.20597578929492)}, 
-    {FLOAT_FIXED(-0.953626891954741), FLOAT_FIXED(0.288660321152929), FLOAT_FIXED(0.0852699826001448)}, 
-    {FLOAT_FIXED(0.953625767112257), FLOAT_FIXED(-0.288665007308753), FLOAT_FIXED(0.0852666983939028)}, 
-    {FLOAT_FIXED(-0.936590853051408), FLOAT_FIXED(0.283503557535526), FLOAT_FIXED(0.205969189067532)}, 
-    {FLOAT_FIXED(-0.897407408837103), FLOAT_FIXED(0.271647563609083), FLOAT_FIXED(-0.34766009801173)}, 
-    {FLOAT_FIXED(-0.832849073682249), FLOAT_FIXED(0.252101197134072), FLOAT_FIXED(0.492754915622551)}, 
-    {FLOAT_FIXED(0.573135124921507), FLOAT_FIXED(-0.173489497379421), FLOAT_FIXED(0.800885461773557)}, 
-    {FLOAT_FIXED(0.642280060554703), FLOAT_FIXED(-0.194416464252395), FLOAT_FIXED(0.74140310374414)}, 
-    {FLOAT_FIXED(0.709601360693882), FLOAT_FIXED(-0.214794442560851), FLOAT_FIXED(0.671065761566156)}, 
-    {FLOAT_FIXED(0.766539326315988), FLOAT_FIXED(-0.232029413156715), FLOAT_FIXED(0.598815341020236)}, 
-    {FLOAT_FIXED(-0.471616567678265), FLOAT_FIXED(0.142765291805578), FLOAT_FIXED(-0.870170031974809)}, 
-    {FLOAT_FIXED(0.332744128495037), FLOAT_FIXED(-0.100724802008737), FLOAT_FIXED(0.937622450249768)}, 
-    {FLOAT_FIXED(-0.197134594401833), FLOAT_FIXED(0.0596721168524762), FLOAT_FIXED(-0.978558731073597)}, 
-    {FLOAT_FIXED(0.95665439013277), FLOAT_FIXED(-0.289576736790669), FLOAT_FIXED(-0.0309465886547423)}, 
-    {FLOAT_FIXED(-0.936589523377357), FLOAT_FIXED(0.283503155046731), FLOAT_FIXED(-0.205975789301374)}, 
-    {FLOAT_FIXED(0.0296177049425598), FLOAT_FIXED(-0.0089652004286575), FLOAT_FIXED(0.999521093691979)}, 
-    {FLOAT_FIXED(0.766539554268689), FLOAT_FIXED(-0.232033522652679), FLOAT_FIXED(-0.598813456851921)}, 
-    {FLOAT_FIXED(0.70960270321773), FLOAT_FIXED(-0.214794848939239), FLOAT_FIXED(-0.671064211871904)}, 
-    {FLOAT_FIXED(0.642279832670082), FLOAT_FIXED(-0.194419780784037), FLOAT_FIXED(-0.741402431466999)}, 
-    {FLOAT_FIXED(-0.0642802330356968), FLOAT_FIXED(0.0194574553930992), FLOAT_FIXED(0.997742180661168)}, 
-    {FLOAT_FIXED(-0.191695441683175), FLOAT_FIXED(0.0580267102493411), FLOAT_FIXED(0.979737596775551)}, 
-    {FLOAT_FIXED(-0.31413858221894), FLOAT_FIXED(0.0950943826648438), FLOAT_FIXED(0.944602566980985)}, 
-    {FLOAT_FIXED(-0.429349269883358), FLOAT_FIXED(0.129965143983256), FLOAT_FIXED(0.893738365406811)}, 
-    {FLOAT_FIXED(-0.535769211672314), FLOAT_FIXED(0.162178737967116), FLOAT_FIXED(0.828643113032034)}, 
-    {FLOAT_FIXED(-0.632392995789827), FLOAT_FIXED(0.191420342791227), FLOAT_FIXED(0.750624640710427)}, 
-    {FLOAT_FIXED(-0.718432888876268), FLOAT_FIXED(0.217467722627615), FLOAT_FIXED(0.660728366120343)}, 
-    {FLOAT_FIXED(-0.793103732320585), FLOAT_FIXED(0.2400703881263), FLOAT_FIXED(0.559779133698324)}, 
-    {FLOAT_FIXED(-0.855408783864311), FLOAT_FIXED(0.258929961340715), FLOAT_FIXED(0.448587881699758)}, 
-    {FLOAT_FIXED(-0.937720725791483), FLOAT_FIXED(0.283845567005655), FLOAT_FIXED(0.200278642177175)}, 
-    {FLOAT_FIXED(-0.954951894913731), FLOAT_FIXED(0.289061396020779), FLOAT_FIXED(0.0671594202714205)}, 
-    {FLOAT_FIXED(-0.954950411704634), FLOAT_FIXED(0.289065980682301), FLOAT_FIXED(-0.0671607772239883)}, 
-    {FLOAT_FIXED(-0.937720484907687), FLOAT_FIXED(0.283845494090762), FLOAT_FIXED(-0.200279873349428)}, 
-    {FLOAT_FIXED(-0.855407541585751), FLOAT_FIXED(0.25892958530631), FLOAT_FIXED(-0.448590467633144)}, 
-    {FLOAT_FIXED(-0.793103732320587), FLOAT_FIXED(0.240070388126293), FLOAT_FIXED(-0.559779133698324)}, 
-    {FLOAT_FIXED(-0.718435610177927), FLOAT_FIXED(0.217468546358388), FLOAT_FIXED(-0.660725136023324)}, 
-    {FLOAT_FIXED(-0.632388559309703), FLOAT_FIXED(0.191422333161761), FLOAT_FIXED(-0.750627870799576)}, 
-    {FLOAT_FIXED(-0.53577671515), FLOAT_FIXED(0.162175361138338), FLOAT_FIXED(-0.828638922415985)}, 
-    {FLOAT_FIXED(-0.429349269883357), FLOAT_FIXED(0.129965143983252), FLOAT_FIXED(-0.893738365406813)}, 
-    {FLOAT_FIXED(-0.314140903278222), FLOAT_FIXED(0.0950912708822725), FLOAT_FIXED(-0.944602108344851)}, 
-    {FLOAT_FIXED(-0.191688245422202), FLOAT_FIXED(0.0580268594636588), FLOAT_FIXED(-0.979738995930928)}, 
-    {FLOAT_FIXED(-0.0642802529643494), FLOAT_FIXED(0.0194578002521384), FLOAT_FIXED(-0.997742172651927)}, 
-    {FLOAT_FIXED(0.0642802330356969), FLOAT_FIXED(-0.0194574553930992), FLOAT_FIXED(-0.997742180661168)}, 
-    {FLOAT_FIXED(0.191690298842676), FLOAT_FIXED(-0.0580241430822119), FLOAT_FIXED(-0.979738755051152)}, 
-    {FLOAT_FIXED(0.314139639913033), FLOAT_FIXED(-0.0950908884583307), FLOAT_FIXED(-0.944602566991809)}, 
-    {FLOAT_FIXED(0.535774313857014), FLOAT_FIXED(-0.162180282411739), FLOAT_FIXED(-0.828639511855363)}, 
-    {FLOAT_FIXED(0.632391518288735), FLOAT_FIXED(-0.191423228836841), FLOAT_FIXED(-0.750625149497502)}, 
-    {FLOAT_FIXED(0.718428132007234), FLOAT_FIXED(-0.21748258013467), FLOAT_FIXED(-0.660728648144277)}, 
-    {FLOAT_FIXED(0.793102573098264), FLOAT_FIXED(-0.240074217744004), FLOAT_FIXED(-0.559779133694279)}, 
-    {FLOAT_FIXED(0.855408258643315), FLOAT_FIXED(-0.258929802357723), FLOAT_FIXED(-0.448588975004739)}, 
-    {FLOAT_FIXED(0.904089967358336), FLOAT_FIXED(-0.273665625970188), FLOAT_FIXED(-0.328220133575544)}, 
-    {FLOAT_FIXED(0.937719114305271), FLOAT_FIXED(-0.283850022010392), FLOAT_FIXED(-0.200279873355357)}, 
-    {FLOAT_FIXED(0.954950411704635), FLOAT_FIXED(-0.289065980682299), FLOAT_FIXED(-0.0671607772239867)}, 
-    {FLOAT_FIXED(0.954951894913729), FLOAT_FIXED(-0.289061396020784), FLOAT_FIXED(0.0671594202714221)}, 
-    {FLOAT_FIXED(0.937719355188717), FLOAT_FIXED(-0.283850094926436), FLOAT_FIXED(0.200278642183109)}, 
-    {FLOAT_FIXED(0.904087988142022), FLOAT_FIXED(-0.273669792391478), FLOAT_FIXED(0.328222111427181)}, 
-    {FLOAT_FIXED(0.855409500914648), FLOAT_FIXED(-0.258930178389945), FLOAT_FIXED(0.448586389075621)}, 
-    {FLOAT_FIXED(0.793103732320585), FLOAT_FIXED(-0.240070388126298), FLOAT_FIXED(0.559779133698325)}, 
-    {FLOAT_FIXED(0.718431838790611), FLOAT_FIXED(-0.217471191684903), FLOAT_FIXED(0.660728366122637)}, 
-    {FLOAT_FIXED(0.632387197813267), FLOAT_FIXED(-0.191436266617659), FLOAT_FIXED(0.75062546443974)}, 
-    {FLOAT_FIXED(0.535769994782234), FLOAT_FIXED(-0.162176150927259), FLOAT_FIXED(0.828643113023613)}, 
-    {FLOAT_FIXED(0.314139639913031), FLOAT_FIXED(-0.095090888458333), FLOAT_FIXED(0.94460256699181)}, 
-    {FLOAT_FIXED(0.191695783091242), FLOAT_FIXED(-0.0580268135944515), FLOAT_FIXED(0.979737523854788)}, 
-    {FLOAT_FIXED(0.0642802330356969), FLOAT_FIXED(-0.0194574553930991), FLOAT_FIXED(0.997742180661168)}, 
-    {FLOAT_FIXED(-0.93659085305141), FLOAT_FIXED(0.283503557535522), FLOAT_FIXED(0.20596918906753)}, 
-    {FLOAT_FIXED(0.0642802330356969), FLOAT_FIXED(-0.0194574553930992), FLOAT_FIXED(0.997742180661168)}, 
-    {FLOAT_FIXED(-0.0671572370755034), FLOAT_FIXED(-0.254597658977126), FLOAT_FIXED(0.964712360007765)}, 
-    {FLOAT_FIXED(-0.200284009796507), FLOAT_FIXED(-0.250006399045029), FLOAT_FIXED(0.94730307497462)}, 
-    {FLOAT_FIXED(-0.448592350145843), FLOAT_FIXED(-0.228058079568665), FLOAT_FIXED(0.86414953320249)}, 
-    {FLOAT_FIXED(-0.559777899347382), FLOAT_FIXED(-0.211447852087369), FLOAT_FIXED(0.801210652231902)}, 
-    {FLOAT_FIXED(-0.660729523767159), FLOAT_FIXED(-0.191541865173648), FLOAT_FIXED(0.725774214413975)}, 
-    {FLOAT_FIXED(-0.750626804523503), FLOAT_FIXED(-0.168592308806555), FLOAT_FIXED(0.638855252574563)}, 
-    {FLOAT_FIXED(-0.828643874299113), FLOAT_FIXED(-0.142835355495823), FLOAT_FIXED(0.541246146228255)}, 
-    {FLOAT_FIXED(-0.893735573663442), FLOAT_FIXED(-0.114470833333693), FLOAT_FIXED(0.433743187478913)}, 
-    {FLOAT_FIXED(-0.944601063279312), FLOAT_FIXED(-0.0837533042368092), FLOAT_FIXED(0.317355030338278)}, 
-    {FLOAT_FIXED(-0.979739111626221), FLOAT_FIXED(-0.0511033428192481), FLOAT_FIXED(0.193648448231741)}, 
-    {FLOAT_FIXED(-0.997741887431788), FLOAT_FIXED(-0.0171385157789518), FLOAT_FIXED(0.0649414916747949)}, 
-    {FLOAT_FIXED(-0.997741923075647), FLOAT_FIXED(0.0171387949456899), FLOAT_FIXED(-0.0649408703754318)}, 
-    {FLOAT_FIXED(-0.979738872797592), FLOAT_FIXED(0.0511053637419459), FLOAT_FIXED(-0.193649123225765)}, 
-    {FLOAT_FIXED(-0.944601297098578), FLOAT_FIXED(0.0837531325253717), FLOAT_FIXED(-0.317354379695431)}, 
-    {FLOAT_FIXED(-0.828644566493818), FLOAT_FIXED(0.142841635680293), FLOAT_FIXED(-0.541243429093093)}, 
-    {FLOAT_FIXED(-0.750625837220278), FLOAT_FIXED(0.168600310521231), FLOAT_FIXED(-0.638854277429134)}, 
-    {FLOAT_FIXED(-0.660729523693019), FLOAT_FIXED(0.191528463486373), FLOAT_FIXED(-0.725777751239968)}, 
-    {FLOAT_FIXED(-0.559776382537798), FLOAT_FIXED(0.211440985476798), FLOAT_FIXED(-0.801213524107961)}, 
-    {FLOAT_FIXED(-0.448592350065307), FLOAT_FIXED(0.228047635305019), FLOAT_FIXED(-0.864152289526952)}, 
-    {FLOAT_FIXED(-0.328222390162694), FLOAT_FIXED(0.241040148153905), FLOAT_FIXED(-0.913328916422683)}, 
-    {FLOAT_FIXED(-0.200274196181532), FLOAT_FIXED(0.250003889342423), FLOAT_FIXED(-0.947305812110061)}, 
-    {FLOAT_FIXED(-0.0671651028236286), FLOAT_FIXED(0.254597523870711), FLOAT_FIXED(-0.964711848067388)}, 
-    {FLOAT_FIXED(0.0671645551999372), FLOAT_FIXED(0.25459753327752), FLOAT_FIXED(-0.964711883711296)}, 
-    {FLOAT_FIXED(0.200276245321198), FLOAT_FIXED(0.250006804069203), FLOAT_FIXED(-0.947304609657921)}, 
-    {FLOAT_FIXED(0.328215752449053), FLOAT_FIXED(0.24102678474232), FLOAT_FIXED(-0.913334828461655)}, 
-    {FLOAT_FIXED(0.448587149359936), FLOAT_FIXED(0.228051057642728), FLOAT_FIXED(-0.864154086108004)}, 
-    {FLOAT_FIXED(0.559783431686291), FLOAT_FIXED(0.211434659437933), FLOAT_FIXED(-0.801210268529981)}, 
-    {FLOAT_FIXED(0.660719237630532), FLOAT_FIXED(0.191541860555043), FLOAT_FIXED(-0.725783579781219)}, 
-    {FLOAT_FIXED(0.75063014399751), FLOAT_FIXED(0.168601099744319), FLOAT_FIXED(-0.638849008833295)}, 
-    {FLOAT_FIXED(0.828639858650845), FLOAT_FIXED(0.142841687593429), FLOAT_FIXED(-0.541250623039428)}, 
-    {FLOAT_FIXED(0.893737246988797), FLOAT_FIXED(0.114468599129983), FLOAT_FIXED(-0.433740329181072)}, 
-    {FLOAT_FIXED(0.944603700365352), FLOAT_FIXED(0.0837513675992106), FLOAT_FIXED(-0.317347692100237)}, 
-    {FLOAT_FIXED(0.979737145570005), FLOAT_FIXED(0.0511087551241785), FLOAT_FIXED(-0.19365696667044)}, 
-    {FLOAT_FIXED(0.997742451851592), FLOAT_FIXED(0.0171363761625095), FLOAT_FIXED(-0.0649333842117471)}, 
-    {FLOAT_FIXED(0.997742435025206), FLOAT_FIXED(-0.017136647065602), FLOAT_FIXED(0.0649335712657227)}, 
-    {FLOAT_FIXED(0.979737384421092), FLOAT_FIXED(-0.0511072215887087), FLOAT_FIXED(0.1936561630034)}, 
-    {FLOAT_FIXED(0.944603700370584), FLOAT_FIXED(-0.0837485442732731), FLOAT_FIXED(0.317348437176406)}, 
-    {FLOAT_FIXED(0.828640550846657), FLOAT_FIXED(-0.142834884484197), FLOAT_FIXED(0.541251358674448)}, 
-    {FLOAT_FIXED(0.750626478522803), FLOAT_FIXED(-0.168602162359083), FLOAT_FIXED(0.638853035203166)}, 
-    {FLOAT_FIXED(0.660723968480705), FLOAT_FIXED(-0.191540797961545), FLOAT_FIXED(0.725779553439861)}, 
-    {FLOAT_FIXED(0.559781914985835), FLOAT_FIXED(-0.211447159871905), FLOAT_FIXED(0.801208029313796)}, 
-    {FLOAT_FIXED(0.448587149346378), FLOAT_FIXED(-0.228061502057587), FLOAT_FIXED(0.864151329756847)}, 
-    {FLOAT_FIXED(0.328215752413089), FLOAT_FIXED(-0.241040736695568), FLOAT_FIXED(0.913331146474907)}, 
-    {FLOAT_FIXED(0.200286058918945), FLOAT_FIXED(-0.250003270544992), FLOAT_FIXED(0.947303467384937)}, 
-    {FLOAT_FIXED(0.0671566895135531), FLOAT_FIXED(-0.254586008686101), FLOAT_FIXED(0.964715472683454)}, 
-};
-
-static texcoord_t texcoords[] = {
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1.3305), FLOAT_FIXED(1.7379)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.5827)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1.3305), FLOAT_FIXED(1.7379)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.5827)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1.3305), FLOAT_FIXED(1.7379)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.5827)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.1663), FLOAT_FIXED(1.6431)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1.5)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1.3305), FLOAT_FIXED(1.7379)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.5827)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(2)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.5), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.3757), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.2484), FLOAT_FIXED(1.6905)}, 
-    {FLOAT_FIXED(1.3531), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.3757), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.2484), FLOAT_FIXED(1.6905)}, 
-    {FLOAT_FIXED(1.3531), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.3757), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.2484), FLOAT_FIXED(1.6905)}, 
-    {FLOAT_FIXED(1.3531), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.3757), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3305), FLOAT_FIXED(1.7379)}, 
-    {FLOAT_FIXED(1.1458), FLOAT_FIXED(1.6129)}, 
-    {FLOAT_FIXED(1.2484), FLOAT_FIXED(1.6905)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.3757), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.2484), FLOAT_FIXED(1.6905)}, 
-    {FLOAT_FIXED(1.3531), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.2951), FLOAT_FIXED(1.8648)}, 
-    {FLOAT_FIXED(1.2549), FLOAT_FIXED(1.84)}, 
-    {FLOAT_FIXED(1.2555), FLOAT_FIXED(1.8425)}, 
-    {FLOAT_FIXED(1.153), FLOAT_FIXED(1.6398)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.6495)}, 
-    {FLOAT_FIXED(1.1897), FLOAT_FIXED(1.6516)}, 
-    {FLOAT_FIXED(1.3172), FLOAT_FIXED(1.8555)}, 
-    {FLOAT_FIXED(1.2922), FLOAT_FIXED(1.805)}, 
-    {FLOAT_FIXED(1.2647), FLOAT_FIXED(1.8029)}, 
-    {FLOAT_FIXED(1.3154), FLOAT_FIXED(1.8563)}, 
-    {FLOAT_FIXED(1.2638), FLOAT_FIXED(1.806)}, 
-    {FLOAT_FIXED(1.2644), FLOAT_FIXED(1.8085)}, 
-    {FLOAT_FIXED(1.3098), FLOAT_FIXED(1.8586)}, 
-    {FLOAT_FIXED(1.3103), FLOAT_FIXED(1.8584)}, 
-    {FLOAT_FIXED(1.2608), FLOAT_FIXED(1.8128)}, 
-    {FLOAT_FIXED(1.3135), FLOAT_FIXED(1.857)}, 
-    {FLOAT_FIXED(1.314), FLOAT_FIXED(1.8568)}, 
-    {FLOAT_FIXED(1.263), FLOAT_FIXED(1.8091)}, 
-    {FLOAT_FIXED(1.3117), FLOAT_FIXED(1.8578)}, 
-    {FLOAT_FIXED(1.3121), FLOAT_FIXED(1.8576)}, 
-    {FLOAT_FIXED(1.2616), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.3043), FLOAT_FIXED(1.8609)}, 
-    {FLOAT_FIXED(1.3048), FLOAT_FIXED(1.8607)}, 
-    {FLOAT_FIXED(1.2584), FLOAT_FIXED(1.8221)}, 
-    {FLOAT_FIXED(1.3061), FLOAT_FIXED(1.8601)}, 
-    {FLOAT_FIXED(1.3066), FLOAT_FIXED(1.8599)}, 
-    {FLOAT_FIXED(1.2592), FLOAT_FIXED(1.819)}, 
-    {FLOAT_FIXED(1.2988), FLOAT_FIXED(1.8632)}, 
-    {FLOAT_FIXED(1.2992), FLOAT_FIXED(1.863)}, 
-    {FLOAT_FIXED(1.256), FLOAT_FIXED(1.8313)}, 
-    {FLOAT_FIXED(1.3025), FLOAT_FIXED(1.8617)}, 
-    {FLOAT_FIXED(1.3029), FLOAT_FIXED(1.8615)}, 
-    {FLOAT_FIXED(1.2576), FLOAT_FIXED(1.8251)}, 
-    {FLOAT_FIXED(1.3006), FLOAT_FIXED(1.8625)}, 
-    {FLOAT_FIXED(1.3011), FLOAT_FIXED(1.8623)}, 
-    {FLOAT_FIXED(1.2568), FLOAT_FIXED(1.8282)}, 
-    {FLOAT_FIXED(1.3348), FLOAT_FIXED(1.7491)}, 
-    {FLOAT_FIXED(1.1889), FLOAT_FIXED(1.6431)}, 
-    {FLOAT_FIXED(1.1046), FLOAT_FIXED(1.6715)}, 
-    {FLOAT_FIXED(1.308), FLOAT_FIXED(1.8594)}, 
-    {FLOAT_FIXED(1.3085), FLOAT_FIXED(1.8592)}, 
-    {FLOAT_FIXED(1.26), FLOAT_FIXED(1.8159)}, 
-    {FLOAT_FIXED(1.1765), FLOAT_FIXED(1.802)}, 
-    {FLOAT_FIXED(1.1367), FLOAT_FIXED(1.7757)}, 
-    {FLOAT_FIXED(1.1378), FLOAT_FIXED(1.7807)}, 
-    {FLOAT_FIXED(1.1344), FLOAT_FIXED(1.7656)}, 
-    {FLOAT_FIXED(1.1741), FLOAT_FIXED(1.7906)}, 
-    {FLOAT_FIXED(1.1746), FLOAT_FIXED(1.7904)}, 
-    {FLOAT_FIXED(1.2652), FLOAT_FIXED(1.8054)}, 
-    {FLOAT_FIXED(1.3168), FLOAT_FIXED(1.8557)}, 
-    {FLOAT_FIXED(1.2969), FLOAT_FIXED(1.864)}, 
-    {FLOAT_FIXED(1.2557), FLOAT_FIXED(1.8369)}, 
-    {FLOAT_FIXED(1.2965), FLOAT_FIXED(1.8642)}, 
-    {FLOAT_FIXED(1.2974), FLOAT_FIXED(1.8638)}, 
-    {FLOAT_FIXED(1.2551), FLOAT_FIXED(1.8344)}, 
-    {FLOAT_FIXED(1.1069), FLOAT_FIXED(1.6453)}, 
-    {FLOAT_FIXED(1.1075), FLOAT_FIXED(1.6478)}, 
-    {FLOAT_FIXED(1.1595), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.259), FLOAT_FIXED(1.8246)}, 
-    {FLOAT_FIXED(1.1321), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1327), FLOAT_FIXED(1.7581)}, 
-    {FLOAT_FIXED(1.1729), FLOAT_FIXED(1.7829)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.2422), FLOAT_FIXED(1.7042)}, 
-    {FLOAT_FIXED(1.2733), FLOAT_FIXED(1.7515)}, 
-    {FLOAT_FIXED(1.1275), FLOAT_FIXED(1.7356)}, 
-    {FLOAT_FIXED(1.1281), FLOAT_FIXED(1.7381)}, 
-    {FLOAT_FIXED(1.1703), FLOAT_FIXED(1.7675)}, 
-    {FLOAT_FIXED(1.135), FLOAT_FIXED(1.7682)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7255)}, 
-    {FLOAT_FIXED(1.1258), FLOAT_FIXED(1.728)}, 
-    {FLOAT_FIXED(1.1691), FLOAT_FIXED(1.7598)}, 
-    {FLOAT_FIXED(1.1184), FLOAT_FIXED(1.6955)}, 
-    {FLOAT_FIXED(1.119), FLOAT_FIXED(1.698)}, 
-    {FLOAT_FIXED(1.1653), FLOAT_FIXED(1.7366)}, 
-    {FLOAT_FIXED(1.123), FLOAT_FIXED(1.7155)}, 
-    {FLOAT_FIXED(1.1235), FLOAT_FIXED(1.718)}, 
-    {FLOAT_FIXED(1.1678), FLOAT_FIXED(1.7521)}, 
-    {FLOAT_FIXED(1.1138), FLOAT_FIXED(1.6754)}, 
-    {FLOAT_FIXED(1.1144), FLOAT_FIXED(1.6779)}, 
-    {FLOAT_FIXED(1.1628), FLOAT_FIXED(1.7212)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.2422), FLOAT_FIXED(1.7042)}, 
-    {FLOAT_FIXED(1.2733), FLOAT_FIXED(1.7515)}, 
-    {FLOAT_FIXED(1.1161), FLOAT_FIXED(1.6854)}, 
-    {FLOAT_FIXED(1.1167), FLOAT_FIXED(1.6879)}, 
-    {FLOAT_FIXED(1.1641), FLOAT_FIXED(1.7289)}, 
-    {FLOAT_FIXED(1.1115), FLOAT_FIXED(1.6654)}, 
-    {FLOAT_FIXED(1.1121), FLOAT_FIXED(1.6679)}, 
-    {FLOAT_FIXED(1.1616), FLOAT_FIXED(1.7135)}, 
-    {FLOAT_FIXED(1.3154), FLOAT_FIXED(1.8563)}, 
-    {FLOAT_FIXED(1.2638), FLOAT_FIXED(1.806)}, 
-    {FLOAT_FIXED(1.2644), FLOAT_FIXED(1.8085)}, 
-    {FLOAT_FIXED(1.3098), FLOAT_FIXED(1.8586)}, 
-    {FLOAT_FIXED(1.3103), FLOAT_FIXED(1.8584)}, 
-    {FLOAT_FIXED(1.2608), FLOAT_FIXED(1.8128)}, 
-    {FLOAT_FIXED(1.3135), FLOAT_FIXED(1.857)}, 
-    {FLOAT_FIXED(1.314), FLOAT_FIXED(1.8568)}, 
-    {FLOAT_FIXED(1.263), FLOAT_FIXED(1.8091)}, 
-    {FLOAT_FIXED(1.308), FLOAT_FIXED(1.8594)}, 
-    {FLOAT_FIXED(1.3085), FLOAT_FIXED(1.8592)}, 
-    {FLOAT_FIXED(1.26), FLOAT_FIXED(1.8159)}, 
-    {FLOAT_FIXED(1.3025), FLOAT_FIXED(1.8617)}, 
-    {FLOAT_FIXED(1.3029), FLOAT_FIXED(1.8615)}, 
-    {FLOAT_FIXED(1.2576), FLOAT_FIXED(1.8251)}, 
-    {FLOAT_FIXED(1.3117), FLOAT_FIXED(1.8578)}, 
-    {FLOAT_FIXED(1.3121), FLOAT_FIXED(1.8576)}, 
-    {FLOAT_FIXED(1.2616), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.3043), FLOAT_FIXED(1.8609)}, 
-    {FLOAT_FIXED(1.3048), FLOAT_FIXED(1.8607)}, 
-    {FLOAT_FIXED(1.2584), FLOAT_FIXED(1.8221)}, 
-    {FLOAT_FIXED(1.3006), FLOAT_FIXED(1.8625)}, 
-    {FLOAT_FIXED(1.3011), FLOAT_FIXED(1.8623)}, 
-    {FLOAT_FIXED(1.2568), FLOAT_FIXED(1.8282)}, 
-    {FLOAT_FIXED(1.2988), FLOAT_FIXED(1.8632)}, 
-    {FLOAT_FIXED(1.2992), FLOAT_FIXED(1.863)}, 
-    {FLOAT_FIXED(1.256), FLOAT_FIXED(1.8313)}, 
-    {FLOAT_FIXED(1.3061), FLOAT_FIXED(1.8601)}, 
-    {FLOAT_FIXED(1.3066), FLOAT_FIXED(1.8599)}, 
-    {FLOAT_FIXED(1.2592), FLOAT_FIXED(1.819)}, 
-    {FLOAT_FIXED(1.2733), FLOAT_FIXED(1.7515)}, 
-    {FLOAT_FIXED(1.2672), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.2922), FLOAT_FIXED(1.805)}, 
-    {FLOAT_FIXED(1.3172), FLOAT_FIXED(1.8555)}, 
-    {FLOAT_FIXED(1.2652), FLOAT_FIXED(1.8054)}, 
-    {FLOAT_FIXED(1.3168), FLOAT_FIXED(1.8557)}, 
-    {FLOAT_FIXED(1.1047), FLOAT_FIXED(1.6353)}, 
-    {FLOAT_FIXED(1.1058), FLOAT_FIXED(1.6403)}, 
-    {FLOAT_FIXED(1.1153), FLOAT_FIXED(1.6229)}, 
-    {FLOAT_FIXED(1.1758), FLOAT_FIXED(1.7981)}, 
-    {FLOAT_FIXED(1.1763), FLOAT_FIXED(1.798)}, 
-    {FLOAT_FIXED(1.2969), FLOAT_FIXED(1.864)}, 
-    {FLOAT_FIXED(1.2563), FLOAT_FIXED(1.8394)}, 
-    {FLOAT_FIXED(1.2965), FLOAT_FIXED(1.8642)}, 
-    {FLOAT_FIXED(1.2557), FLOAT_FIXED(1.8369)}, 
-    {FLOAT_FIXED(1.1344), FLOAT_FIXED(1.7656)}, 
-    {FLOAT_FIXED(1.135), FLOAT_FIXED(1.7682)}, 
-    {FLOAT_FIXED(1.1746), FLOAT_FIXED(1.7904)}, 
-    {FLOAT_FIXED(1.1765), FLOAT_FIXED(1.802)}, 
-    {FLOAT_FIXED(1.1367), FLOAT_FIXED(1.7757)}, 
-    {FLOAT_FIXED(1.1378), FLOAT_FIXED(1.7807)}, 
-    {FLOAT_FIXED(1.2974), FLOAT_FIXED(1.8638)}, 
-    {FLOAT_FIXED(1.1069), FLOAT_FIXED(1.6453)}, 
-    {FLOAT_FIXED(1.1075), FLOAT_FIXED(1.6478)}, 
-    {FLOAT_FIXED(1.1595), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.1275), FLOAT_FIXED(1.7356)}, 
-    {FLOAT_FIXED(1.1708), FLOAT_FIXED(1.7673)}, 
-    {FLOAT_FIXED(1.127), FLOAT_FIXED(1.7331)}, 
-    {FLOAT_FIXED(1.1321), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1738), FLOAT_FIXED(1.7825)}, 
-    {FLOAT_FIXED(1.1316), FLOAT_FIXED(1.7531)}, 
-    {FLOAT_FIXED(1.2565), FLOAT_FIXED(1.8338)}, 
-    {FLOAT_FIXED(1.259), FLOAT_FIXED(1.8246)}, 
-    {FLOAT_FIXED(1.2614), FLOAT_FIXED(1.8153)}, 
-    {FLOAT_FIXED(1.2582), FLOAT_FIXED(1.8277)}, 
-    {FLOAT_FIXED(1.2606), FLOAT_FIXED(1.8184)}, 
-    {FLOAT_FIXED(1.1164), FLOAT_FIXED(1.6279)}, 
-    {FLOAT_FIXED(1.1345), FLOAT_FIXED(1.6474)}, 
-    {FLOAT_FIXED(1.153), FLOAT_FIXED(1.6398)}, 
-    {FLOAT_FIXED(1.2598), FLOAT_FIXED(1.8215)}, 
-    {FLOAT_FIXED(1.1115), FLOAT_FIXED(1.6654)}, 
-    {FLOAT_FIXED(1.1121), FLOAT_FIXED(1.6679)}, 
-    {FLOAT_FIXED(1.1616), FLOAT_FIXED(1.7135)}, 
-    {FLOAT_FIXED(1.1345), FLOAT_FIXED(1.6474)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.2422), FLOAT_FIXED(1.7042)}, 
-    {FLOAT_FIXED(1.2733), FLOAT_FIXED(1.7515)}, 
-    {FLOAT_FIXED(1.3135), FLOAT_FIXED(1.857)}, 
-    {FLOAT_FIXED(1.314), FLOAT_FIXED(1.8568)}, 
-    {FLOAT_FIXED(1.2625), FLOAT_FIXED(1.8066)}, 
-    {FLOAT_FIXED(1.308), FLOAT_FIXED(1.8594)}, 
-    {FLOAT_FIXED(1.3085), FLOAT_FIXED(1.8592)}, 
-    {FLOAT_FIXED(1.26), FLOAT_FIXED(1.8159)}, 
-    {FLOAT_FIXED(1.3117), FLOAT_FIXED(1.8578)}, 
-    {FLOAT_FIXED(1.3121), FLOAT_FIXED(1.8576)}, 
-    {FLOAT_FIXED(1.2616), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.3098), FLOAT_FIXED(1.8586)}, 
-    {FLOAT_FIXED(1.3103), FLOAT_FIXED(1.8584)}, 
-    {FLOAT_FIXED(1.2608), FLOAT_FIXED(1.8128)}, 
-    {FLOAT_FIXED(1.3025), FLOAT_FIXED(1.8617)}, 
-    {FLOAT_FIXED(1.3029), FLOAT_FIXED(1.8615)}, 
-    {FLOAT_FIXED(1.2576), FLOAT_FIXED(1.8251)}, 
-    {FLOAT_FIXED(1.3061), FLOAT_FIXED(1.8601)}, 
-    {FLOAT_FIXED(1.3066), FLOAT_FIXED(1.8599)}, 
-    {FLOAT_FIXED(1.2592), FLOAT_FIXED(1.819)}, 
-    {FLOAT_FIXED(1.3043), FLOAT_FIXED(1.8609)}, 
-    {FLOAT_FIXED(1.3048), FLOAT_FIXED(1.8607)}, 
-    {FLOAT_FIXED(1.2584), FLOAT_FIXED(1.8221)}, 
-    {FLOAT_FIXED(1.2988), FLOAT_FIXED(1.8632)}, 
-    {FLOAT_FIXED(1.2992), FLOAT_FIXED(1.863)}, 
-    {FLOAT_FIXED(1.256), FLOAT_FIXED(1.8313)}, 
-    {FLOAT_FIXED(1.2932), FLOAT_FIXED(1.8656)}, 
-    {FLOAT_FIXED(1.2937), FLOAT_FIXED(1.8654)}, 
-    {FLOAT_FIXED(1.2535), FLOAT_FIXED(1.8406)}, 
-    {FLOAT_FIXED(1.2969), FLOAT_FIXED(1.864)}, 
-    {FLOAT_FIXED(1.2974), FLOAT_FIXED(1.8638)}, 
-    {FLOAT_FIXED(1.2551), FLOAT_FIXED(1.8344)}, 
-    {FLOAT_FIXED(1.3154), FLOAT_FIXED(1.8563)}, 
-    {FLOAT_FIXED(1.3158), FLOAT_FIXED(1.8561)}, 
-    {FLOAT_FIXED(1.2638), FLOAT_FIXED(1.806)}, 
-    {FLOAT_FIXED(1.3172), FLOAT_FIXED(1.8555)}, 
-    {FLOAT_FIXED(1.2647), FLOAT_FIXED(1.8029)}, 
-    {FLOAT_FIXED(1.2652), FLOAT_FIXED(1.8054)}, 
-    {FLOAT_FIXED(1.1765), FLOAT_FIXED(1.802)}, 
-    {FLOAT_FIXED(1.1367), FLOAT_FIXED(1.7757)}, 
-    {FLOAT_FIXED(1.1378), FLOAT_FIXED(1.7807)}, 
-    {FLOAT_FIXED(1.3006), FLOAT_FIXED(1.8625)}, 
-    {FLOAT_FIXED(1.3011), FLOAT_FIXED(1.8623)}, 
-    {FLOAT_FIXED(1.2568), FLOAT_FIXED(1.8282)}, 
-    {FLOAT_FIXED(1.2951), FLOAT_FIXED(1.8648)}, 
-    {FLOAT_FIXED(1.2955), FLOAT_FIXED(1.8646)}, 
-    {FLOAT_FIXED(1.2543), FLOAT_FIXED(1.8375)}, 
-    {FLOAT_FIXED(1.1138), FLOAT_FIXED(1.6754)}, 
-    {FLOAT_FIXED(1.1144), FLOAT_FIXED(1.6779)}, 
-    {FLOAT_FIXED(1.1628), FLOAT_FIXED(1.7212)}, 
-    {FLOAT_FIXED(1.1092), FLOAT_FIXED(1.6554)}, 
-    {FLOAT_FIXED(1.1098), FLOAT_FIXED(1.6579)}, 
-    {FLOAT_FIXED(1.1603), FLOAT_FIXED(1.7058)}, 
-    {FLOAT_FIXED(1.2622), FLOAT_FIXED(1.8122)}, 
-    {FLOAT_FIXED(1.1184), FLOAT_FIXED(1.6955)}, 
-    {FLOAT_FIXED(1.119), FLOAT_FIXED(1.698)}, 
-    {FLOAT_FIXED(1.1653), FLOAT_FIXED(1.7366)}, 
-    {FLOAT_FIXED(1.2606), FLOAT_FIXED(1.8184)}, 
-    {FLOAT_FIXED(1.1207), FLOAT_FIXED(1.7055)}, 
-    {FLOAT_FIXED(1.1213), FLOAT_FIXED(1.708)}, 
-    {FLOAT_FIXED(1.1666), FLOAT_FIXED(1.7443)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7255)}, 
-    {FLOAT_FIXED(1.1258), FLOAT_FIXED(1.728)}, 
-    {FLOAT_FIXED(1.1691), FLOAT_FIXED(1.7598)}, 
-    {FLOAT_FIXED(1.1298), FLOAT_FIXED(1.7456)}, 
-    {FLOAT_FIXED(1.1304), FLOAT_FIXED(1.7481)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.7752)}, 
-    {FLOAT_FIXED(1.1344), FLOAT_FIXED(1.7656)}, 
-    {FLOAT_FIXED(1.135), FLOAT_FIXED(1.7682)}, 
-    {FLOAT_FIXED(1.1741), FLOAT_FIXED(1.7906)}, 
-    {FLOAT_FIXED(1.1275), FLOAT_FIXED(1.7356)}, 
-    {FLOAT_FIXED(1.1281), FLOAT_FIXED(1.7381)}, 
-    {FLOAT_FIXED(1.1703), FLOAT_FIXED(1.7675)}, 
-    {FLOAT_FIXED(1.2582), FLOAT_FIXED(1.8277)}, 
-    {FLOAT_FIXED(1.1259), FLOAT_FIXED(1.6104)}, 
-    {FLOAT_FIXED(1.1153), FLOAT_FIXED(1.6229)}, 
-    {FLOAT_FIXED(1.2549), FLOAT_FIXED(1.84)}, 
-    {FLOAT_FIXED(1.153), FLOAT_FIXED(1.6398)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.6495)}, 
-    {FLOAT_FIXED(1.1897), FLOAT_FIXED(1.6516)}, 
-    {FLOAT_FIXED(1.1765), FLOAT_FIXED(1.802)}, 
-    {FLOAT_FIXED(1.1367), FLOAT_FIXED(1.7757)}, 
-    {FLOAT_FIXED(1.1378), FLOAT_FIXED(1.7807)}, 
-    {FLOAT_FIXED(1.1138), FLOAT_FIXED(1.6754)}, 
-    {FLOAT_FIXED(1.1633), FLOAT_FIXED(1.721)}, 
-    {FLOAT_FIXED(1.1132), FLOAT_FIXED(1.6729)}, 
-    {FLOAT_FIXED(1.1184), FLOAT_FIXED(1.6955)}, 
-    {FLOAT_FIXED(1.119), FLOAT_FIXED(1.698)}, 
-    {FLOAT_FIXED(1.1658), FLOAT_FIXED(1.7364)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7255)}, 
-    {FLOAT_FIXED(1.1258), FLOAT_FIXED(1.728)}, 
-    {FLOAT_FIXED(1.1696), FLOAT_FIXED(1.7596)}, 
-    {FLOAT_FIXED(1.1663), FLOAT_FIXED(1.7362)}, 
-    {FLOAT_FIXED(1.1178), FLOAT_FIXED(1.693)}, 
-    {FLOAT_FIXED(1.1115), FLOAT_FIXED(1.6654)}, 
-    {FLOAT_FIXED(1.162), FLOAT_FIXED(1.7133)}, 
-    {FLOAT_FIXED(1.111), FLOAT_FIXED(1.6629)}, 
-    {FLOAT_FIXED(1.1161), FLOAT_FIXED(1.6854)}, 
-    {FLOAT_FIXED(1.1645), FLOAT_FIXED(1.7287)}, 
-    {FLOAT_FIXED(1.1155), FLOAT_FIXED(1.6829)}, 
-    {FLOAT_FIXED(1.3061), FLOAT_FIXED(1.8601)}, 
-    {FLOAT_FIXED(1.2598), FLOAT_FIXED(1.8215)}, 
-    {FLOAT_FIXED(1.2604), FLOAT_FIXED(1.824)}, 
-    {FLOAT_FIXED(1.3057), FLOAT_FIXED(1.8603)}, 
-    {FLOAT_FIXED(1.308), FLOAT_FIXED(1.8594)}, 
-    {FLOAT_FIXED(1.2612), FLOAT_FIXED(1.8209)}, 
-    {FLOAT_FIXED(1.3075), FLOAT_FIXED(1.8596)}, 
-    {FLOAT_FIXED(1.1765), FLOAT_FIXED(1.802)}, 
-    {FLOAT_FIXED(1.1367), FLOAT_FIXED(1.7757)}, 
-    {FLOAT_FIXED(1.1378), FLOAT_FIXED(1.7807)}, 
-    {FLOAT_FIXED(1.123), FLOAT_FIXED(1.7155)}, 
-    {FLOAT_FIXED(1.1235), FLOAT_FIXED(1.718)}, 
-    {FLOAT_FIXED(1.1683), FLOAT_FIXED(1.7519)}, 
-    {FLOAT_FIXED(1.17), FLOAT_FIXED(1.7594)}, 
-    {FLOAT_FIXED(1.3006), FLOAT_FIXED(1.8625)}, 
-    {FLOAT_FIXED(1.3011), FLOAT_FIXED(1.8623)}, 
-    {FLOAT_FIXED(1.2573), FLOAT_FIXED(1.8307)}, 
-    {FLOAT_FIXED(1.1628), FLOAT_FIXED(1.7212)}, 
-    {FLOAT_FIXED(1.1069), FLOAT_FIXED(1.6453)}, 
-    {FLOAT_FIXED(1.1075), FLOAT_FIXED(1.6478)}, 
-    {FLOAT_FIXED(1.1595), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.1092), FLOAT_FIXED(1.6554)}, 
-    {FLOAT_FIXED(1.1603), FLOAT_FIXED(1.7058)}, 
-    {FLOAT_FIXED(1.1608), FLOAT_FIXED(1.7056)}, 
-    {FLOAT_FIXED(1.1298), FLOAT_FIXED(1.7456)}, 
-    {FLOAT_FIXED(1.1725), FLOAT_FIXED(1.7748)}, 
-    {FLOAT_FIXED(1.1293), FLOAT_FIXED(1.7431)}, 
-    {FLOAT_FIXED(1.2988), FLOAT_FIXED(1.8632)}, 
-    {FLOAT_FIXED(1.2992), FLOAT_FIXED(1.863)}, 
-    {FLOAT_FIXED(1.2565), FLOAT_FIXED(1.8338)}, 
-    {FLOAT_FIXED(1.2571), FLOAT_FIXED(1.8363)}, 
-    {FLOAT_FIXED(1.3154), FLOAT_FIXED(1.8563)}, 
-    {FLOAT_FIXED(1.3158), FLOAT_FIXED(1.8561)}, 
-    {FLOAT_FIXED(1.2638), FLOAT_FIXED(1.806)}, 
-    {FLOAT_FIXED(1.3117), FLOAT_FIXED(1.8578)}, 
-    {FLOAT_FIXED(1.3121), FLOAT_FIXED(1.8576)}, 
-    {FLOAT_FIXED(1.2616), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.1321), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1733), FLOAT_FIXED(1.7827)}, 
-    {FLOAT_FIXED(1.1738), FLOAT_FIXED(1.7825)}, 
-    {FLOAT_FIXED(1.1344), FLOAT_FIXED(1.7656)}, 
-    {FLOAT_FIXED(1.1746), FLOAT_FIXED(1.7904)}, 
-    {FLOAT_FIXED(1.175), FLOAT_FIXED(1.7902)}, 
-    {FLOAT_FIXED(1.2946), FLOAT_FIXED(1.865)}, 
-    {FLOAT_FIXED(1.3181), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3044), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.1338), FLOAT_FIXED(1.7631)}, 
-    {FLOAT_FIXED(1.3135), FLOAT_FIXED(1.857)}, 
-    {FLOAT_FIXED(1.2625), FLOAT_FIXED(1.8066)}, 
-    {FLOAT_FIXED(1.263), FLOAT_FIXED(1.8091)}, 
-    {FLOAT_FIXED(1.1207), FLOAT_FIXED(1.7055)}, 
-    {FLOAT_FIXED(1.167), FLOAT_FIXED(1.7442)}, 
-    {FLOAT_FIXED(1.1201), FLOAT_FIXED(1.703)}, 
-    {FLOAT_FIXED(1.1138), FLOAT_FIXED(1.6754)}, 
-    {FLOAT_FIXED(1.1633), FLOAT_FIXED(1.721)}, 
-    {FLOAT_FIXED(1.1132), FLOAT_FIXED(1.6729)}, 
-    {FLOAT_FIXED(1.3098), FLOAT_FIXED(1.8586)}, 
-    {FLOAT_FIXED(1.2608), FLOAT_FIXED(1.8128)}, 
-    {FLOAT_FIXED(1.2614), FLOAT_FIXED(1.8153)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7255)}, 
-    {FLOAT_FIXED(1.1258), FLOAT_FIXED(1.728)}, 
-    {FLOAT_FIXED(1.1696), FLOAT_FIXED(1.7596)}, 
-    {FLOAT_FIXED(1.1298), FLOAT_FIXED(1.7456)}, 
-    {FLOAT_FIXED(1.1304), FLOAT_FIXED(1.7481)}, 
-    {FLOAT_FIXED(1.1721), FLOAT_FIXED(1.775)}, 
-    {FLOAT_FIXED(1.3181), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3044), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.1275), FLOAT_FIXED(1.7356)}, 
-    {FLOAT_FIXED(1.1281), FLOAT_FIXED(1.7381)}, 
-    {FLOAT_FIXED(1.1708), FLOAT_FIXED(1.7673)}, 
-    {FLOAT_FIXED(1.1344), FLOAT_FIXED(1.7656)}, 
-    {FLOAT_FIXED(1.135), FLOAT_FIXED(1.7682)}, 
-    {FLOAT_FIXED(1.1746), FLOAT_FIXED(1.7904)}, 
-    {FLOAT_FIXED(1.1184), FLOAT_FIXED(1.6955)}, 
-    {FLOAT_FIXED(1.1658), FLOAT_FIXED(1.7364)}, 
-    {FLOAT_FIXED(1.1178), FLOAT_FIXED(1.693)}, 
-    {FLOAT_FIXED(1.1321), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1327), FLOAT_FIXED(1.7581)}, 
-    {FLOAT_FIXED(1.1733), FLOAT_FIXED(1.7827)}, 
-    {FLOAT_FIXED(1.1213), FLOAT_FIXED(1.708)}, 
-    {FLOAT_FIXED(1.123), FLOAT_FIXED(1.7155)}, 
-    {FLOAT_FIXED(1.1683), FLOAT_FIXED(1.7519)}, 
-    {FLOAT_FIXED(1.1688), FLOAT_FIXED(1.7517)}, 
-    {FLOAT_FIXED(1.1069), FLOAT_FIXED(1.6453)}, 
-    {FLOAT_FIXED(1.1075), FLOAT_FIXED(1.6478)}, 
-    {FLOAT_FIXED(1.1595), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.17), FLOAT_FIXED(1.7594)}, 
-    {FLOAT_FIXED(1.1247), FLOAT_FIXED(1.723)}, 
-    {FLOAT_FIXED(1.3025), FLOAT_FIXED(1.8617)}, 
-    {FLOAT_FIXED(1.3029), FLOAT_FIXED(1.8615)}, 
-    {FLOAT_FIXED(1.2582), FLOAT_FIXED(1.8277)}, 
-    {FLOAT_FIXED(1.2587), FLOAT_FIXED(1.8302)}, 
-    {FLOAT_FIXED(1.302), FLOAT_FIXED(1.8619)}, 
-    {FLOAT_FIXED(1.1725), FLOAT_FIXED(1.7748)}, 
-    {FLOAT_FIXED(1.2969), FLOAT_FIXED(1.864)}, 
-    {FLOAT_FIXED(1.2974), FLOAT_FIXED(1.8638)}, 
-    {FLOAT_FIXED(1.2557), FLOAT_FIXED(1.8369)}, 
-    {FLOAT_FIXED(1.3172), FLOAT_FIXED(1.8555)}, 
-    {FLOAT_FIXED(1.3181), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3044), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.308), FLOAT_FIXED(1.8594)}, 
-    {FLOAT_FIXED(1.3085), FLOAT_FIXED(1.8592)}, 
-    {FLOAT_FIXED(1.26), FLOAT_FIXED(1.8159)}, 
-    {FLOAT_FIXED(1.2606), FLOAT_FIXED(1.8184)}, 
-    {FLOAT_FIXED(1.3075), FLOAT_FIXED(1.8596)}, 
-    {FLOAT_FIXED(1.1758), FLOAT_FIXED(1.7981)}, 
-    {FLOAT_FIXED(1.1763), FLOAT_FIXED(1.798)}, 
-    {FLOAT_FIXED(1.3117), FLOAT_FIXED(1.8578)}, 
-    {FLOAT_FIXED(1.3121), FLOAT_FIXED(1.8576)}, 
-    {FLOAT_FIXED(1.2616), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.175), FLOAT_FIXED(1.7902)}, 
-    {FLOAT_FIXED(1.3103), FLOAT_FIXED(1.8584)}, 
-    {FLOAT_FIXED(1.314), FLOAT_FIXED(1.8568)}, 
-    {FLOAT_FIXED(1.3154), FLOAT_FIXED(1.8563)}, 
-    {FLOAT_FIXED(1.3158), FLOAT_FIXED(1.8561)}, 
-    {FLOAT_FIXED(1.2638), FLOAT_FIXED(1.806)}, 
-    {FLOAT_FIXED(1.1259), FLOAT_FIXED(1.6104)}, 
-    {FLOAT_FIXED(1.1153), FLOAT_FIXED(1.6229)}, 
-    {FLOAT_FIXED(1.1164), FLOAT_FIXED(1.6279)}, 
-    {FLOAT_FIXED(1.153), FLOAT_FIXED(1.6398)}, 
-    {FLOAT_FIXED(1.1259), FLOAT_FIXED(1.6104)}, 
-    {FLOAT_FIXED(1.1153), FLOAT_FIXED(1.6229)}, 
-    {FLOAT_FIXED(1.1164), FLOAT_FIXED(1.6279)}, 
-    {FLOAT_FIXED(1.1069), FLOAT_FIXED(1.6453)}, 
-    {FLOAT_FIXED(1.1595), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.1345), FLOAT_FIXED(1.6474)}, 
-    {FLOAT_FIXED(1.3181), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3044), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.153), FLOAT_FIXED(1.6398)}, 
-    {FLOAT_FIXED(1.3172), FLOAT_FIXED(1.8555)}, 
-    {FLOAT_FIXED(1.3181), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3044), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.2422), FLOAT_FIXED(1.7042)}, 
-    {FLOAT_FIXED(1.2733), FLOAT_FIXED(1.7515)}, 
-    {FLOAT_FIXED(1.1047), FLOAT_FIXED(1.6353)}, 
-    {FLOAT_FIXED(1.1058), FLOAT_FIXED(1.6403)}, 
-    {FLOAT_FIXED(1.1153), FLOAT_FIXED(1.6229)}, 
-    {FLOAT_FIXED(1.2922), FLOAT_FIXED(1.805)}, 
-    {FLOAT_FIXED(1.2647), FLOAT_FIXED(1.8029)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7504)}, 
-    {FLOAT_FIXED(1.1871), FLOAT_FIXED(1.7)}, 
-    {FLOAT_FIXED(1.2397), FLOAT_FIXED(1.7525)}, 
-    {FLOAT_FIXED(1.2672), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.7021)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.6495)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.7021)}, 
-    {FLOAT_FIXED(1.1897), FLOAT_FIXED(1.6516)}, 
-    {FLOAT_FIXED(1.1871), FLOAT_FIXED(1.7)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7504)}, 
-    {FLOAT_FIXED(1.2397), FLOAT_FIXED(1.7525)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.6495)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.7021)}, 
-    {FLOAT_FIXED(1.1897), FLOAT_FIXED(1.6516)}, 
-    {FLOAT_FIXED(1.1871), FLOAT_FIXED(1.7)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7504)}, 
-    {FLOAT_FIXED(1.2647), FLOAT_FIXED(1.8029)}, 
-    {FLOAT_FIXED(1.2397), FLOAT_FIXED(1.7525)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7558)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1608), FLOAT_FIXED(1.7056)}, 
-    {FLOAT_FIXED(1.2643), FLOAT_FIXED(1.8058)}, 
-    {FLOAT_FIXED(1.3163), FLOAT_FIXED(1.8559)}, 
-    {FLOAT_FIXED(1.3168), FLOAT_FIXED(1.8557)}, 
-    {FLOAT_FIXED(1.2648), FLOAT_FIXED(1.8056)}, 
-    {FLOAT_FIXED(1.2114), FLOAT_FIXED(1.7562)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.756)}, 
-    {FLOAT_FIXED(1.1603), FLOAT_FIXED(1.7058)}, 
-    {FLOAT_FIXED(1.2629), FLOAT_FIXED(1.8064)}, 
-    {FLOAT_FIXED(1.3145), FLOAT_FIXED(1.8566)}, 
-    {FLOAT_FIXED(1.3149), FLOAT_FIXED(1.8565)}, 
-    {FLOAT_FIXED(1.2634), FLOAT_FIXED(1.8062)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.767)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7668)}, 
-    {FLOAT_FIXED(1.1628), FLOAT_FIXED(1.7212)}, 
-    {FLOAT_FIXED(1.2613), FLOAT_FIXED(1.8126)}, 
-    {FLOAT_FIXED(1.3108), FLOAT_FIXED(1.8582)}, 
-    {FLOAT_FIXED(1.3112), FLOAT_FIXED(1.858)}, 
-    {FLOAT_FIXED(1.2618), FLOAT_FIXED(1.8124)}, 
-    {FLOAT_FIXED(1.2157), FLOAT_FIXED(1.8148)}, 
-    {FLOAT_FIXED(1.2558), FLOAT_FIXED(1.8396)}, 
-    {FLOAT_FIXED(1.2563), FLOAT_FIXED(1.8394)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.815)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.8152)}, 
-    {FLOAT_FIXED(1.2549), FLOAT_FIXED(1.84)}, 
-    {FLOAT_FIXED(1.2554), FLOAT_FIXED(1.8398)}, 
-    {FLOAT_FIXED(1.2116), FLOAT_FIXED(1.7616)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7614)}, 
-    {FLOAT_FIXED(1.1616), FLOAT_FIXED(1.7135)}, 
-    {FLOAT_FIXED(1.2621), FLOAT_FIXED(1.8095)}, 
-    {FLOAT_FIXED(1.3126), FLOAT_FIXED(1.8574)}, 
-    {FLOAT_FIXED(1.3131), FLOAT_FIXED(1.8572)}, 
-    {FLOAT_FIXED(1.2626), FLOAT_FIXED(1.8093)}, 
-    {FLOAT_FIXED(1.2159), FLOAT_FIXED(1.8202)}, 
-    {FLOAT_FIXED(1.255), FLOAT_FIXED(1.8427)}, 
-    {FLOAT_FIXED(1.2555), FLOAT_FIXED(1.8425)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8204)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8206)}, 
-    {FLOAT_FIXED(1.2541), FLOAT_FIXED(1.8431)}, 
-    {FLOAT_FIXED(1.2546), FLOAT_FIXED(1.8429)}, 
-    {FLOAT_FIXED(1.3071), FLOAT_FIXED(1.8597)}, 
-    {FLOAT_FIXED(1.2597), FLOAT_FIXED(1.8188)}, 
-    {FLOAT_FIXED(1.3066), FLOAT_FIXED(1.8599)}, 
-    {FLOAT_FIXED(1.2601), FLOAT_FIXED(1.8186)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7774)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7776)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7724)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7722)}, 
-    {FLOAT_FIXED(1.1641), FLOAT_FIXED(1.7289)}, 
-    {FLOAT_FIXED(1.2605), FLOAT_FIXED(1.8157)}, 
-    {FLOAT_FIXED(1.3089), FLOAT_FIXED(1.859)}, 
-    {FLOAT_FIXED(1.3094), FLOAT_FIXED(1.8588)}, 
-    {FLOAT_FIXED(1.2609), FLOAT_FIXED(1.8155)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.8098)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8096)}, 
-    {FLOAT_FIXED(1.2562), FLOAT_FIXED(1.8367)}, 
-    {FLOAT_FIXED(1.2978), FLOAT_FIXED(1.8636)}, 
-    {FLOAT_FIXED(1.2983), FLOAT_FIXED(1.8634)}, 
-    {FLOAT_FIXED(1.2566), FLOAT_FIXED(1.8365)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.804)}, 
-    {FLOAT_FIXED(1.2575), FLOAT_FIXED(1.8334)}, 
-    {FLOAT_FIXED(1.2579), FLOAT_FIXED(1.8332)}, 
-    {FLOAT_FIXED(1.2148), FLOAT_FIXED(1.8042)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8044)}, 
-    {FLOAT_FIXED(1.2565), FLOAT_FIXED(1.8338)}, 
-    {FLOAT_FIXED(1.257), FLOAT_FIXED(1.8336)}, 
-    {FLOAT_FIXED(1.3015), FLOAT_FIXED(1.8621)}, 
-    {FLOAT_FIXED(1.2578), FLOAT_FIXED(1.8305)}, 
-    {FLOAT_FIXED(1.3011), FLOAT_FIXED(1.8623)}, 
-    {FLOAT_FIXED(1.2583), FLOAT_FIXED(1.8304)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.7986)}, 
-    {FLOAT_FIXED(1.1713), FLOAT_FIXED(1.7671)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.7936)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.7934)}, 
-    {FLOAT_FIXED(1.2586), FLOAT_FIXED(1.8275)}, 
-    {FLOAT_FIXED(1.3034), FLOAT_FIXED(1.8613)}, 
-    {FLOAT_FIXED(1.3038), FLOAT_FIXED(1.8611)}, 
-    {FLOAT_FIXED(1.2591), FLOAT_FIXED(1.8273)}, 
-    {FLOAT_FIXED(1.1241), FLOAT_FIXED(1.7205)}, 
-    {FLOAT_FIXED(1.1689), FLOAT_FIXED(1.7544)}, 
-    {FLOAT_FIXED(1.1235), FLOAT_FIXED(1.718)}, 
-    {FLOAT_FIXED(1.1694), FLOAT_FIXED(1.7569)}, 
-    {FLOAT_FIXED(1.2148), FLOAT_FIXED(1.7932)}, 
-    {FLOAT_FIXED(1.2595), FLOAT_FIXED(1.8271)}, 
-    {FLOAT_FIXED(1.2142), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7529)}, 
-    {FLOAT_FIXED(1.1601), FLOAT_FIXED(1.7004)}, 
-    {FLOAT_FIXED(1.1081), FLOAT_FIXED(1.6503)}, 
-    {FLOAT_FIXED(1.1087), FLOAT_FIXED(1.6529)}, 
-    {FLOAT_FIXED(1.1607), FLOAT_FIXED(1.7029)}, 
-    {FLOAT_FIXED(1.2146), FLOAT_FIXED(1.7878)}, 
-    {FLOAT_FIXED(1.2599), FLOAT_FIXED(1.8242)}, 
-    {FLOAT_FIXED(1.2604), FLOAT_FIXED(1.824)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.788)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7882)}, 
-    {FLOAT_FIXED(1.259), FLOAT_FIXED(1.8246)}, 
-    {FLOAT_FIXED(1.2594), FLOAT_FIXED(1.8244)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7828)}, 
-    {FLOAT_FIXED(1.214), FLOAT_FIXED(1.7853)}, 
-    {FLOAT_FIXED(1.2598), FLOAT_FIXED(1.8215)}, 
-    {FLOAT_FIXED(1.1676), FLOAT_FIXED(1.7467)}, 
-    {FLOAT_FIXED(1.1218), FLOAT_FIXED(1.7105)}, 
-    {FLOAT_FIXED(1.1224), FLOAT_FIXED(1.713)}, 
-    {FLOAT_FIXED(1.1682), FLOAT_FIXED(1.7492)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8123)}, 
-    {FLOAT_FIXED(1.1739), FLOAT_FIXED(1.7852)}, 
-    {FLOAT_FIXED(1.1333), FLOAT_FIXED(1.7606)}, 
-    {FLOAT_FIXED(1.1338), FLOAT_FIXED(1.7631)}, 
-    {FLOAT_FIXED(1.1745), FLOAT_FIXED(1.7877)}, 
-    {FLOAT_FIXED(1.1172), FLOAT_FIXED(1.6904)}, 
-    {FLOAT_FIXED(1.1646), FLOAT_FIXED(1.7314)}, 
-    {FLOAT_FIXED(1.1167), FLOAT_FIXED(1.6879)}, 
-    {FLOAT_FIXED(1.1652), FLOAT_FIXED(1.7339)}, 
-    {FLOAT_FIXED(1.2126), FLOAT_FIXED(1.7749)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8177)}, 
-    {FLOAT_FIXED(1.1751), FLOAT_FIXED(1.7929)}, 
-    {FLOAT_FIXED(1.1356), FLOAT_FIXED(1.7707)}, 
-    {FLOAT_FIXED(1.1361), FLOAT_FIXED(1.7732)}, 
-    {FLOAT_FIXED(1.1757), FLOAT_FIXED(1.7954)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.799)}, 
-    {FLOAT_FIXED(1.2146), FLOAT_FIXED(1.8015)}, 
-    {FLOAT_FIXED(1.2573), FLOAT_FIXED(1.8307)}, 
-    {FLOAT_FIXED(1.1714), FLOAT_FIXED(1.7698)}, 
-    {FLOAT_FIXED(1.1287), FLOAT_FIXED(1.7406)}, 
-    {FLOAT_FIXED(1.1293), FLOAT_FIXED(1.7431)}, 
-    {FLOAT_FIXED(1.172), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(1.2149), FLOAT_FIXED(1.8069)}, 
-    {FLOAT_FIXED(1.1726), FLOAT_FIXED(1.7775)}, 
-    {FLOAT_FIXED(1.131), FLOAT_FIXED(1.7506)}, 
-    {FLOAT_FIXED(1.1316), FLOAT_FIXED(1.7531)}, 
-    {FLOAT_FIXED(1.1732), FLOAT_FIXED(1.78)}, 
-    {FLOAT_FIXED(1.2144), FLOAT_FIXED(1.7961)}, 
-    {FLOAT_FIXED(1.1701), FLOAT_FIXED(1.7621)}, 
-    {FLOAT_FIXED(1.1264), FLOAT_FIXED(1.7306)}, 
-    {FLOAT_FIXED(1.127), FLOAT_FIXED(1.7331)}, 
-    {FLOAT_FIXED(1.1707), FLOAT_FIXED(1.7646)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.772)}, 
-    {FLOAT_FIXED(1.164), FLOAT_FIXED(1.7262)}, 
-    {FLOAT_FIXED(1.1645), FLOAT_FIXED(1.7287)}, 
-    {FLOAT_FIXED(1.2124), FLOAT_FIXED(1.7695)}, 
-    {FLOAT_FIXED(1.1634), FLOAT_FIXED(1.7237)}, 
-    {FLOAT_FIXED(1.1127), FLOAT_FIXED(1.6704)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.716)}, 
-    {FLOAT_FIXED(1.1121), FLOAT_FIXED(1.6679)}, 
-    {FLOAT_FIXED(1.1627), FLOAT_FIXED(1.7185)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7666)}, 
-    {FLOAT_FIXED(1.2622), FLOAT_FIXED(1.8122)}, 
-    {FLOAT_FIXED(1.2122), FLOAT_FIXED(1.7641)}, 
-    {FLOAT_FIXED(1.1195), FLOAT_FIXED(1.7005)}, 
-    {FLOAT_FIXED(1.1659), FLOAT_FIXED(1.7391)}, 
-    {FLOAT_FIXED(1.119), FLOAT_FIXED(1.698)}, 
-    {FLOAT_FIXED(1.1665), FLOAT_FIXED(1.7416)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7803)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7612)}, 
-    {FLOAT_FIXED(1.1615), FLOAT_FIXED(1.7108)}, 
-    {FLOAT_FIXED(1.162), FLOAT_FIXED(1.7133)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7587)}, 
-    {FLOAT_FIXED(1.1609), FLOAT_FIXED(1.7083)}, 
-    {FLOAT_FIXED(1.1333), FLOAT_FIXED(1.7606)}, 
-    {FLOAT_FIXED(1.1739), FLOAT_FIXED(1.7852)}, 
-    {FLOAT_FIXED(1.1327), FLOAT_FIXED(1.7581)}, 
-    {FLOAT_FIXED(1.1745), FLOAT_FIXED(1.7877)}, 
-    {FLOAT_FIXED(1.2157), FLOAT_FIXED(1.8148)}, 
-    {FLOAT_FIXED(1.2563), FLOAT_FIXED(1.8394)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8123)}, 
-    {FLOAT_FIXED(1.2941), FLOAT_FIXED(1.8652)}, 
-    {FLOAT_FIXED(1.2546), FLOAT_FIXED(1.8429)}, 
-    {FLOAT_FIXED(1.2937), FLOAT_FIXED(1.8654)}, 
-    {FLOAT_FIXED(1.255), FLOAT_FIXED(1.8427)}, 
-    {FLOAT_FIXED(1.2159), FLOAT_FIXED(1.8202)}, 
-    {FLOAT_FIXED(1.1763), FLOAT_FIXED(1.798)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8204)}, 
-    {FLOAT_FIXED(1.2558), FLOAT_FIXED(1.8396)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.815)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.8152)}, 
-    {FLOAT_FIXED(1.2554), FLOAT_FIXED(1.8398)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8094)}, 
-    {FLOAT_FIXED(1.2566), FLOAT_FIXED(1.8365)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8096)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.8098)}, 
-    {FLOAT_FIXED(1.2557), FLOAT_FIXED(1.8369)}, 
-    {FLOAT_FIXED(1.2562), FLOAT_FIXED(1.8367)}, 
-    {FLOAT_FIXED(1.2116), FLOAT_FIXED(1.7616)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7614)}, 
-    {FLOAT_FIXED(1.1616), FLOAT_FIXED(1.7135)}, 
-    {FLOAT_FIXED(1.2621), FLOAT_FIXED(1.8095)}, 
-    {FLOAT_FIXED(1.3126), FLOAT_FIXED(1.8574)}, 
-    {FLOAT_FIXED(1.3131), FLOAT_FIXED(1.8572)}, 
-    {FLOAT_FIXED(1.2626), FLOAT_FIXED(1.8093)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7558)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.2643), FLOAT_FIXED(1.8058)}, 
-    {FLOAT_FIXED(1.3163), FLOAT_FIXED(1.8559)}, 
-    {FLOAT_FIXED(1.3168), FLOAT_FIXED(1.8557)}, 
-    {FLOAT_FIXED(1.2648), FLOAT_FIXED(1.8056)}, 
-    {FLOAT_FIXED(1.1732), FLOAT_FIXED(1.78)}, 
-    {FLOAT_FIXED(1.2149), FLOAT_FIXED(1.8069)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8044)}, 
-    {FLOAT_FIXED(1.1721), FLOAT_FIXED(1.775)}, 
-    {FLOAT_FIXED(1.1726), FLOAT_FIXED(1.7775)}, 
-    {FLOAT_FIXED(1.2148), FLOAT_FIXED(1.8042)}, 
-    {FLOAT_FIXED(1.257), FLOAT_FIXED(1.8336)}, 
-    {FLOAT_FIXED(1.2997), FLOAT_FIXED(1.8629)}, 
-    {FLOAT_FIXED(1.3001), FLOAT_FIXED(1.8627)}, 
-    {FLOAT_FIXED(1.2575), FLOAT_FIXED(1.8334)}, 
-    {FLOAT_FIXED(1.1287), FLOAT_FIXED(1.7406)}, 
-    {FLOAT_FIXED(1.1714), FLOAT_FIXED(1.7698)}, 
-    {FLOAT_FIXED(1.1281), FLOAT_FIXED(1.7381)}, 
-    {FLOAT_FIXED(1.172), FLOAT_FIXED(1.7723)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.804)}, 
-    {FLOAT_FIXED(1.2579), FLOAT_FIXED(1.8332)}, 
-    {FLOAT_FIXED(1.2146), FLOAT_FIXED(1.8015)}, 
-    {FLOAT_FIXED(1.2634), FLOAT_FIXED(1.8062)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.756)}, 
-    {FLOAT_FIXED(1.2114), FLOAT_FIXED(1.7562)}, 
-    {FLOAT_FIXED(1.2625), FLOAT_FIXED(1.8066)}, 
-    {FLOAT_FIXED(1.2629), FLOAT_FIXED(1.8064)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7529)}, 
-    {FLOAT_FIXED(1.1601), FLOAT_FIXED(1.7004)}, 
-    {FLOAT_FIXED(1.1081), FLOAT_FIXED(1.6503)}, 
-    {FLOAT_FIXED(1.1087), FLOAT_FIXED(1.6529)}, 
-    {FLOAT_FIXED(1.1607), FLOAT_FIXED(1.7029)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7666)}, 
-    {FLOAT_FIXED(1.2618), FLOAT_FIXED(1.8124)}, 
-    {FLOAT_FIXED(1.2622), FLOAT_FIXED(1.8122)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7668)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.767)}, 
-    {FLOAT_FIXED(1.2608), FLOAT_FIXED(1.8128)}, 
-    {FLOAT_FIXED(1.2613), FLOAT_FIXED(1.8126)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.799)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.7988)}, 
-    {FLOAT_FIXED(1.1708), FLOAT_FIXED(1.7673)}, 
-    {FLOAT_FIXED(1.2578), FLOAT_FIXED(1.8305)}, 
-    {FLOAT_FIXED(1.3015), FLOAT_FIXED(1.8621)}, 
-    {FLOAT_FIXED(1.302), FLOAT_FIXED(1.8619)}, 
-    {FLOAT_FIXED(1.2583), FLOAT_FIXED(1.8304)}, 
-    {FLOAT_FIXED(1.2148), FLOAT_FIXED(1.7932)}, 
-    {FLOAT_FIXED(1.2591), FLOAT_FIXED(1.8273)}, 
-    {FLOAT_FIXED(1.2595), FLOAT_FIXED(1.8271)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.7934)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.7936)}, 
-    {FLOAT_FIXED(1.2582), FLOAT_FIXED(1.8277)}, 
-    {FLOAT_FIXED(1.2586), FLOAT_FIXED(1.8275)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7882)}, 
-    {FLOAT_FIXED(1.2142), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.259), FLOAT_FIXED(1.8246)}, 
-    {FLOAT_FIXED(1.1689), FLOAT_FIXED(1.7544)}, 
-    {FLOAT_FIXED(1.1241), FLOAT_FIXED(1.7205)}, 
-    {FLOAT_FIXED(1.1247), FLOAT_FIXED(1.723)}, 
-    {FLOAT_FIXED(1.1694), FLOAT_FIXED(1.7569)}, 
-    {FLOAT_FIXED(1.1777), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.139), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.1401), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.2533), FLOAT_FIXED(1.8462)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8287)}, 
-    {FLOAT_FIXED(1.2529), FLOAT_FIXED(1.8477)}, 
-    {FLOAT_FIXED(1.2541), FLOAT_FIXED(1.8431)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8233)}, 
-    {FLOAT_FIXED(1.2537), FLOAT_FIXED(1.8446)}, 
-    {FLOAT_FIXED(1.3071), FLOAT_FIXED(1.8597)}, 
-    {FLOAT_FIXED(1.2602), FLOAT_FIXED(1.8213)}, 
-    {FLOAT_FIXED(1.3066), FLOAT_FIXED(1.8599)}, 
-    {FLOAT_FIXED(1.2607), FLOAT_FIXED(1.8211)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.7824)}, 
-    {FLOAT_FIXED(1.1675), FLOAT_FIXED(1.744)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.7826)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.777)}, 
-    {FLOAT_FIXED(1.2615), FLOAT_FIXED(1.818)}, 
-    {FLOAT_FIXED(1.262), FLOAT_FIXED(1.8178)}, 
-    {FLOAT_FIXED(1.2137), FLOAT_FIXED(1.7772)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7774)}, 
-    {FLOAT_FIXED(1.2606), FLOAT_FIXED(1.8184)}, 
-    {FLOAT_FIXED(1.2611), FLOAT_FIXED(1.8182)}, 
-    {FLOAT_FIXED(1.3052), FLOAT_FIXED(1.8605)}, 
-    {FLOAT_FIXED(1.2594), FLOAT_FIXED(1.8244)}, 
-    {FLOAT_FIXED(1.3048), FLOAT_FIXED(1.8607)}, 
-    {FLOAT_FIXED(1.2599), FLOAT_FIXED(1.8242)}, 
-    {FLOAT_FIXED(1.2146), FLOAT_FIXED(1.7878)}, 
-    {FLOAT_FIXED(1.1688), FLOAT_FIXED(1.7517)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.788)}, 
-    {FLOAT_FIXED(1.1682), FLOAT_FIXED(1.7492)}, 
-    {FLOAT_FIXED(1.214), FLOAT_FIXED(1.7853)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7828)}, 
-    {FLOAT_FIXED(1.167), FLOAT_FIXED(1.7442)}, 
-    {FLOAT_FIXED(1.1676), FLOAT_FIXED(1.7467)}, 
-    {FLOAT_FIXED(1.115), FLOAT_FIXED(1.6804)}, 
-    {FLOAT_FIXED(1.1634), FLOAT_FIXED(1.7237)}, 
-    {FLOAT_FIXED(1.1144), FLOAT_FIXED(1.6779)}, 
-    {FLOAT_FIXED(1.164), FLOAT_FIXED(1.7262)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.772)}, 
-    {FLOAT_FIXED(1.2614), FLOAT_FIXED(1.8153)}, 
-    {FLOAT_FIXED(1.2124), FLOAT_FIXED(1.7695)}, 
-    {FLOAT_FIXED(1.1104), FLOAT_FIXED(1.6604)}, 
-    {FLOAT_FIXED(1.1609), FLOAT_FIXED(1.7083)}, 
-    {FLOAT_FIXED(1.1098), FLOAT_FIXED(1.6579)}, 
-    {FLOAT_FIXED(1.1615), FLOAT_FIXED(1.7108)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7612)}, 
-    {FLOAT_FIXED(1.263), FLOAT_FIXED(1.8091)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7587)}, 
-    {FLOAT_FIXED(1.1172), FLOAT_FIXED(1.6904)}, 
-    {FLOAT_FIXED(1.1651), FLOAT_FIXED(1.7312)}, 
-    {FLOAT_FIXED(1.1167), FLOAT_FIXED(1.6879)}, 
-    {FLOAT_FIXED(1.1657), FLOAT_FIXED(1.7337)}, 
-    {FLOAT_FIXED(1.2135), FLOAT_FIXED(1.7745)}, 
-    {FLOAT_FIXED(1.2144), FLOAT_FIXED(1.7961)}, 
-    {FLOAT_FIXED(1.1701), FLOAT_FIXED(1.7621)}, 
-    {FLOAT_FIXED(1.1264), FLOAT_FIXED(1.7306)}, 
-    {FLOAT_FIXED(1.127), FLOAT_FIXED(1.7331)}, 
-    {FLOAT_FIXED(1.1707), FLOAT_FIXED(1.7646)}, 
-    {FLOAT_FIXED(1.2138), FLOAT_FIXED(1.7799)}, 
-    {FLOAT_FIXED(1.1664), FLOAT_FIXED(1.7389)}, 
-    {FLOAT_FIXED(1.1195), FLOAT_FIXED(1.7005)}, 
-    {FLOAT_FIXED(1.1201), FLOAT_FIXED(1.703)}, 
-    {FLOAT_FIXED(1.1669), FLOAT_FIXED(1.7414)}, 
-    {FLOAT_FIXED(1.1127), FLOAT_FIXED(1.6704)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.716)}, 
-    {FLOAT_FIXED(1.1121), FLOAT_FIXED(1.6679)}, 
-    {FLOAT_FIXED(1.1627), FLOAT_FIXED(1.7185)}, 
-    {FLOAT_FIXED(1.2122), FLOAT_FIXED(1.7641)}, 
-    {FLOAT_FIXED(1.1777), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.139), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.1401), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.2533), FLOAT_FIXED(1.8462)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8287)}, 
-    {FLOAT_FIXED(1.2529), FLOAT_FIXED(1.8477)}, 
-    {FLOAT_FIXED(1.2541), FLOAT_FIXED(1.8431)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8233)}, 
-    {FLOAT_FIXED(1.2537), FLOAT_FIXED(1.8446)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.8152)}, 
-    {FLOAT_FIXED(1.174), FLOAT_FIXED(1.7879)}, 
-    {FLOAT_FIXED(1.1746), FLOAT_FIXED(1.7904)}, 
-    {FLOAT_FIXED(1.2142), FLOAT_FIXED(1.8127)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.8102)}, 
-    {FLOAT_FIXED(1.1729), FLOAT_FIXED(1.7829)}, 
-    {FLOAT_FIXED(1.1734), FLOAT_FIXED(1.7854)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.7936)}, 
-    {FLOAT_FIXED(1.169), FLOAT_FIXED(1.7571)}, 
-    {FLOAT_FIXED(1.1696), FLOAT_FIXED(1.7596)}, 
-    {FLOAT_FIXED(1.2133), FLOAT_FIXED(1.7911)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7886)}, 
-    {FLOAT_FIXED(1.1678), FLOAT_FIXED(1.7521)}, 
-    {FLOAT_FIXED(1.1684), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7994)}, 
-    {FLOAT_FIXED(1.2137), FLOAT_FIXED(1.8019)}, 
-    {FLOAT_FIXED(1.1709), FLOAT_FIXED(1.77)}, 
-    {FLOAT_FIXED(1.1287), FLOAT_FIXED(1.7406)}, 
-    {FLOAT_FIXED(1.1293), FLOAT_FIXED(1.7431)}, 
-    {FLOAT_FIXED(1.1715), FLOAT_FIXED(1.7725)}, 
-    {FLOAT_FIXED(1.2138), FLOAT_FIXED(1.8156)}, 
-    {FLOAT_FIXED(1.2144), FLOAT_FIXED(1.8181)}, 
-    {FLOAT_FIXED(1.1747), FLOAT_FIXED(1.7931)}, 
-    {FLOAT_FIXED(1.1356), FLOAT_FIXED(1.7707)}, 
-    {FLOAT_FIXED(1.1361), FLOAT_FIXED(1.7732)}, 
-    {FLOAT_FIXED(1.1753), FLOAT_FIXED(1.7956)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.8048)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.8073)}, 
-    {FLOAT_FIXED(1.1722), FLOAT_FIXED(1.7777)}, 
-    {FLOAT_FIXED(1.131), FLOAT_FIXED(1.7506)}, 
-    {FLOAT_FIXED(1.1316), FLOAT_FIXED(1.7531)}, 
-    {FLOAT_FIXED(1.1727), FLOAT_FIXED(1.7802)}, 
-    {FLOAT_FIXED(1.2129), FLOAT_FIXED(1.794)}, 
-    {FLOAT_FIXED(1.2135), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.1697), FLOAT_FIXED(1.7623)}, 
-    {FLOAT_FIXED(1.1264), FLOAT_FIXED(1.7306)}, 
-    {FLOAT_FIXED(1.127), FLOAT_FIXED(1.7331)}, 
-    {FLOAT_FIXED(1.1702), FLOAT_FIXED(1.7648)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7832)}, 
-    {FLOAT_FIXED(1.2131), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.1672), FLOAT_FIXED(1.7469)}, 
-    {FLOAT_FIXED(1.1218), FLOAT_FIXED(1.7105)}, 
-    {FLOAT_FIXED(1.1224), FLOAT_FIXED(1.713)}, 
-    {FLOAT_FIXED(1.1677), FLOAT_FIXED(1.7494)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7774)}, 
-    {FLOAT_FIXED(1.1652), FLOAT_FIXED(1.7339)}, 
-    {FLOAT_FIXED(1.1658), FLOAT_FIXED(1.7364)}, 
-    {FLOAT_FIXED(1.2126), FLOAT_FIXED(1.7749)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7724)}, 
-    {FLOAT_FIXED(1.1641), FLOAT_FIXED(1.7289)}, 
-    {FLOAT_FIXED(1.1646), FLOAT_FIXED(1.7314)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7778)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7803)}, 
-    {FLOAT_FIXED(1.1659), FLOAT_FIXED(1.7391)}, 
-    {FLOAT_FIXED(1.1195), FLOAT_FIXED(1.7005)}, 
-    {FLOAT_FIXED(1.1201), FLOAT_FIXED(1.703)}, 
-    {FLOAT_FIXED(1.1665), FLOAT_FIXED(1.7416)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7666)}, 
-    {FLOAT_FIXED(1.1627), FLOAT_FIXED(1.7185)}, 
-    {FLOAT_FIXED(1.1633), FLOAT_FIXED(1.721)}, 
-    {FLOAT_FIXED(1.2122), FLOAT_FIXED(1.7641)}, 
-    {FLOAT_FIXED(1.2116), FLOAT_FIXED(1.7616)}, 
-    {FLOAT_FIXED(1.1616), FLOAT_FIXED(1.7135)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.716)}, 
-    {FLOAT_FIXED(1.2114), FLOAT_FIXED(1.7562)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7587)}, 
-    {FLOAT_FIXED(1.1609), FLOAT_FIXED(1.7083)}, 
-    {FLOAT_FIXED(1.1104), FLOAT_FIXED(1.6604)}, 
-    {FLOAT_FIXED(1.111), FLOAT_FIXED(1.6629)}, 
-    {FLOAT_FIXED(1.1615), FLOAT_FIXED(1.7108)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.767)}, 
-    {FLOAT_FIXED(1.2124), FLOAT_FIXED(1.7695)}, 
-    {FLOAT_FIXED(1.1634), FLOAT_FIXED(1.7237)}, 
-    {FLOAT_FIXED(1.115), FLOAT_FIXED(1.6804)}, 
-    {FLOAT_FIXED(1.1155), FLOAT_FIXED(1.6829)}, 
-    {FLOAT_FIXED(1.164), FLOAT_FIXED(1.7262)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.81)}, 
-    {FLOAT_FIXED(1.2548), FLOAT_FIXED(1.8373)}, 
-    {FLOAT_FIXED(1.296), FLOAT_FIXED(1.8644)}, 
-    {FLOAT_FIXED(1.2965), FLOAT_FIXED(1.8642)}, 
-    {FLOAT_FIXED(1.2553), FLOAT_FIXED(1.8371)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7938)}, 
-    {FLOAT_FIXED(1.2572), FLOAT_FIXED(1.828)}, 
-    {FLOAT_FIXED(1.3015), FLOAT_FIXED(1.8621)}, 
-    {FLOAT_FIXED(1.302), FLOAT_FIXED(1.8619)}, 
-    {FLOAT_FIXED(1.2577), FLOAT_FIXED(1.8278)}, 
-    {FLOAT_FIXED(1.1777), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.139), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.1401), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.2533), FLOAT_FIXED(1.8462)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8287)}, 
-    {FLOAT_FIXED(1.2529), FLOAT_FIXED(1.8477)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8233)}, 
-    {FLOAT_FIXED(1.2537), FLOAT_FIXED(1.8446)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7554)}, 
-    {FLOAT_FIXED(1.1607), FLOAT_FIXED(1.7029)}, 
-    {FLOAT_FIXED(1.1612), FLOAT_FIXED(1.7054)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7529)}, 
-    {FLOAT_FIXED(1.1601), FLOAT_FIXED(1.7004)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7558)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1608), FLOAT_FIXED(1.7056)}, 
-    {FLOAT_FIXED(1.2643), FLOAT_FIXED(1.8058)}, 
-    {FLOAT_FIXED(1.3163), FLOAT_FIXED(1.8559)}, 
-    {FLOAT_FIXED(1.3168), FLOAT_FIXED(1.8557)}, 
-    {FLOAT_FIXED(1.2648), FLOAT_FIXED(1.8056)}, 
-    {FLOAT_FIXED(1.2138), FLOAT_FIXED(1.8046)}, 
-    {FLOAT_FIXED(1.2556), FLOAT_FIXED(1.8342)}, 
-    {FLOAT_FIXED(1.2978), FLOAT_FIXED(1.8636)}, 
-    {FLOAT_FIXED(1.2983), FLOAT_FIXED(1.8634)}, 
-    {FLOAT_FIXED(1.2561), FLOAT_FIXED(1.834)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8154)}, 
-    {FLOAT_FIXED(1.254), FLOAT_FIXED(1.8404)}, 
-    {FLOAT_FIXED(1.2941), FLOAT_FIXED(1.8652)}, 
-    {FLOAT_FIXED(1.2946), FLOAT_FIXED(1.865)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.8402)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7992)}, 
-    {FLOAT_FIXED(1.2564), FLOAT_FIXED(1.8311)}, 
-    {FLOAT_FIXED(1.2997), FLOAT_FIXED(1.8629)}, 
-    {FLOAT_FIXED(1.3001), FLOAT_FIXED(1.8627)}, 
-    {FLOAT_FIXED(1.2569), FLOAT_FIXED(1.8309)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.783)}, 
-    {FLOAT_FIXED(1.2589), FLOAT_FIXED(1.8219)}, 
-    {FLOAT_FIXED(1.3052), FLOAT_FIXED(1.8605)}, 
-    {FLOAT_FIXED(1.3057), FLOAT_FIXED(1.8603)}, 
-    {FLOAT_FIXED(1.2593), FLOAT_FIXED(1.8217)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7776)}, 
-    {FLOAT_FIXED(1.2597), FLOAT_FIXED(1.8188)}, 
-    {FLOAT_FIXED(1.3071), FLOAT_FIXED(1.8597)}, 
-    {FLOAT_FIXED(1.3075), FLOAT_FIXED(1.8596)}, 
-    {FLOAT_FIXED(1.2601), FLOAT_FIXED(1.8186)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7884)}, 
-    {FLOAT_FIXED(1.258), FLOAT_FIXED(1.825)}, 
-    {FLOAT_FIXED(1.3034), FLOAT_FIXED(1.8613)}, 
-    {FLOAT_FIXED(1.3038), FLOAT_FIXED(1.8611)}, 
-    {FLOAT_FIXED(1.2585), FLOAT_FIXED(1.8248)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7668)}, 
-    {FLOAT_FIXED(1.2613), FLOAT_FIXED(1.8126)}, 
-    {FLOAT_FIXED(1.3108), FLOAT_FIXED(1.8582)}, 
-    {FLOAT_FIXED(1.3112), FLOAT_FIXED(1.858)}, 
-    {FLOAT_FIXED(1.2618), FLOAT_FIXED(1.8124)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7614)}, 
-    {FLOAT_FIXED(1.2621), FLOAT_FIXED(1.8095)}, 
-    {FLOAT_FIXED(1.3126), FLOAT_FIXED(1.8574)}, 
-    {FLOAT_FIXED(1.3131), FLOAT_FIXED(1.8572)}, 
-    {FLOAT_FIXED(1.2626), FLOAT_FIXED(1.8093)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7722)}, 
-    {FLOAT_FIXED(1.2605), FLOAT_FIXED(1.8157)}, 
-    {FLOAT_FIXED(1.3089), FLOAT_FIXED(1.859)}, 
-    {FLOAT_FIXED(1.3094), FLOAT_FIXED(1.8588)}, 
-    {FLOAT_FIXED(1.2609), FLOAT_FIXED(1.8155)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.756)}, 
-    {FLOAT_FIXED(1.2629), FLOAT_FIXED(1.8064)}, 
-    {FLOAT_FIXED(1.3145), FLOAT_FIXED(1.8566)}, 
-    {FLOAT_FIXED(1.3149), FLOAT_FIXED(1.8565)}, 
-    {FLOAT_FIXED(1.2634), FLOAT_FIXED(1.8062)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.6495)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.7021)}, 
-    {FLOAT_FIXED(1.1897), FLOAT_FIXED(1.6516)}, 
-    {FLOAT_FIXED(1.1871), FLOAT_FIXED(1.7)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7504)}, 
-    {FLOAT_FIXED(1.2647), FLOAT_FIXED(1.8029)}, 
-    {FLOAT_FIXED(1.2397), FLOAT_FIXED(1.7525)}, 
-    {FLOAT_FIXED(1.2116), FLOAT_FIXED(1.7616)}, 
-    {FLOAT_FIXED(1.2122), FLOAT_FIXED(1.7641)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.716)}, 
-    {FLOAT_FIXED(1.1127), FLOAT_FIXED(1.6704)}, 
-    {FLOAT_FIXED(1.1132), FLOAT_FIXED(1.6729)}, 
-    {FLOAT_FIXED(1.1627), FLOAT_FIXED(1.7185)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7828)}, 
-    {FLOAT_FIXED(1.1665), FLOAT_FIXED(1.7416)}, 
-    {FLOAT_FIXED(1.167), FLOAT_FIXED(1.7442)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7803)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7778)}, 
-    {FLOAT_FIXED(1.1653), FLOAT_FIXED(1.7366)}, 
-    {FLOAT_FIXED(1.1659), FLOAT_FIXED(1.7391)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7774)}, 
-    {FLOAT_FIXED(1.1652), FLOAT_FIXED(1.7339)}, 
-    {FLOAT_FIXED(1.1658), FLOAT_FIXED(1.7364)}, 
-    {FLOAT_FIXED(1.2126), FLOAT_FIXED(1.7749)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7724)}, 
-    {FLOAT_FIXED(1.1641), FLOAT_FIXED(1.7289)}, 
-    {FLOAT_FIXED(1.1646), FLOAT_FIXED(1.7314)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.7936)}, 
-    {FLOAT_FIXED(1.169), FLOAT_FIXED(1.7571)}, 
-    {FLOAT_FIXED(1.1696), FLOAT_FIXED(1.7596)}, 
-    {FLOAT_FIXED(1.2133), FLOAT_FIXED(1.7911)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7886)}, 
-    {FLOAT_FIXED(1.1678), FLOAT_FIXED(1.7521)}, 
-    {FLOAT_FIXED(1.1684), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.772)}, 
-    {FLOAT_FIXED(1.164), FLOAT_FIXED(1.7262)}, 
-    {FLOAT_FIXED(1.1645), FLOAT_FIXED(1.7287)}, 
-    {FLOAT_FIXED(1.2124), FLOAT_FIXED(1.7695)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.767)}, 
-    {FLOAT_FIXED(1.1628), FLOAT_FIXED(1.7212)}, 
-    {FLOAT_FIXED(1.1634), FLOAT_FIXED(1.7237)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7882)}, 
-    {FLOAT_FIXED(1.1677), FLOAT_FIXED(1.7494)}, 
-    {FLOAT_FIXED(1.1683), FLOAT_FIXED(1.7519)}, 
-    {FLOAT_FIXED(1.2131), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7832)}, 
-    {FLOAT_FIXED(1.1666), FLOAT_FIXED(1.7443)}, 
-    {FLOAT_FIXED(1.1672), FLOAT_FIXED(1.7469)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8044)}, 
-    {FLOAT_FIXED(1.1715), FLOAT_FIXED(1.7725)}, 
-    {FLOAT_FIXED(1.1721), FLOAT_FIXED(1.775)}, 
-    {FLOAT_FIXED(1.2137), FLOAT_FIXED(1.8019)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7994)}, 
-    {FLOAT_FIXED(1.1703), FLOAT_FIXED(1.7675)}, 
-    {FLOAT_FIXED(1.1709), FLOAT_FIXED(1.77)}, 
-    {FLOAT_FIXED(1.131), FLOAT_FIXED(1.7506)}, 
-    {FLOAT_FIXED(1.1726), FLOAT_FIXED(1.7775)}, 
-    {FLOAT_FIXED(1.1304), FLOAT_FIXED(1.7481)}, 
-    {FLOAT_FIXED(1.1732), FLOAT_FIXED(1.78)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8094)}, 
-    {FLOAT_FIXED(1.2571), FLOAT_FIXED(1.8363)}, 
-    {FLOAT_FIXED(1.2149), FLOAT_FIXED(1.8069)}, 
-    {FLOAT_FIXED(1.1264), FLOAT_FIXED(1.7306)}, 
-    {FLOAT_FIXED(1.1697), FLOAT_FIXED(1.7623)}, 
-    {FLOAT_FIXED(1.1258), FLOAT_FIXED(1.728)}, 
-    {FLOAT_FIXED(1.1702), FLOAT_FIXED(1.7648)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.799)}, 
-    {FLOAT_FIXED(1.2573), FLOAT_FIXED(1.8307)}, 
-    {FLOAT_FIXED(1.2135), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7529)}, 
-    {FLOAT_FIXED(1.1601), FLOAT_FIXED(1.7004)}, 
-    {FLOAT_FIXED(1.1081), FLOAT_FIXED(1.6503)}, 
-    {FLOAT_FIXED(1.1087), FLOAT_FIXED(1.6529)}, 
-    {FLOAT_FIXED(1.1607), FLOAT_FIXED(1.7029)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.8098)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8096)}, 
-    {FLOAT_FIXED(1.1733), FLOAT_FIXED(1.7827)}, 
-    {FLOAT_FIXED(1.2562), FLOAT_FIXED(1.8367)}, 
-    {FLOAT_FIXED(1.2978), FLOAT_FIXED(1.8636)}, 
-    {FLOAT_FIXED(1.2983), FLOAT_FIXED(1.8634)}, 
-    {FLOAT_FIXED(1.2566), FLOAT_FIXED(1.8365)}, 
-    {FLOAT_FIXED(1.1777), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.139), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.1401), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.2533), FLOAT_FIXED(1.8462)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8287)}, 
-    {FLOAT_FIXED(1.2529), FLOAT_FIXED(1.8477)}, 
-    {FLOAT_FIXED(1.2541), FLOAT_FIXED(1.8431)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8233)}, 
-    {FLOAT_FIXED(1.2537), FLOAT_FIXED(1.8446)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.8152)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8177)}, 
-    {FLOAT_FIXED(1.2549), FLOAT_FIXED(1.84)}, 
-    {FLOAT_FIXED(1.1751), FLOAT_FIXED(1.7929)}, 
-    {FLOAT_FIXED(1.1356), FLOAT_FIXED(1.7707)}, 
-    {FLOAT_FIXED(1.1361), FLOAT_FIXED(1.7732)}, 
-    {FLOAT_FIXED(1.1757), FLOAT_FIXED(1.7954)}, 
-    {FLOAT_FIXED(1.2157), FLOAT_FIXED(1.8148)}, 
-    {FLOAT_FIXED(1.1745), FLOAT_FIXED(1.7877)}, 
-    {FLOAT_FIXED(1.175), FLOAT_FIXED(1.7902)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8123)}, 
-    {FLOAT_FIXED(1.1739), FLOAT_FIXED(1.7852)}, 
-    {FLOAT_FIXED(1.296), FLOAT_FIXED(1.8644)}, 
-    {FLOAT_FIXED(1.2554), FLOAT_FIXED(1.8398)}, 
-    {FLOAT_FIXED(1.2955), FLOAT_FIXED(1.8646)}, 
-    {FLOAT_FIXED(1.2558), FLOAT_FIXED(1.8396)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.815)}, 
-    {FLOAT_FIXED(1.2159), FLOAT_FIXED(1.8202)}, 
-    {FLOAT_FIXED(1.255), FLOAT_FIXED(1.8427)}, 
-    {FLOAT_FIXED(1.2555), FLOAT_FIXED(1.8425)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8204)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8206)}, 
-    {FLOAT_FIXED(1.2541), FLOAT_FIXED(1.8431)}, 
-    {FLOAT_FIXED(1.2546), FLOAT_FIXED(1.8429)}, 
-    {FLOAT_FIXED(1.3163), FLOAT_FIXED(1.8559)}, 
-    {FLOAT_FIXED(1.2643), FLOAT_FIXED(1.8058)}, 
-    {FLOAT_FIXED(1.3158), FLOAT_FIXED(1.8561)}, 
-    {FLOAT_FIXED(1.2648), FLOAT_FIXED(1.8056)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7554)}, 
-    {FLOAT_FIXED(1.1612), FLOAT_FIXED(1.7054)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7776)}, 
-    {FLOAT_FIXED(1.2597), FLOAT_FIXED(1.8188)}, 
-    {FLOAT_FIXED(1.3071), FLOAT_FIXED(1.8597)}, 
-    {FLOAT_FIXED(1.3075), FLOAT_FIXED(1.8596)}, 
-    {FLOAT_FIXED(1.2601), FLOAT_FIXED(1.8186)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7992)}, 
-    {FLOAT_FIXED(1.2564), FLOAT_FIXED(1.8311)}, 
-    {FLOAT_FIXED(1.2997), FLOAT_FIXED(1.8629)}, 
-    {FLOAT_FIXED(1.3001), FLOAT_FIXED(1.8627)}, 
-    {FLOAT_FIXED(1.2569), FLOAT_FIXED(1.8309)}, 
-    {FLOAT_FIXED(1.2129), FLOAT_FIXED(1.794)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7938)}, 
-    {FLOAT_FIXED(1.1691), FLOAT_FIXED(1.7598)}, 
-    {FLOAT_FIXED(1.2572), FLOAT_FIXED(1.828)}, 
-    {FLOAT_FIXED(1.3015), FLOAT_FIXED(1.8621)}, 
-    {FLOAT_FIXED(1.302), FLOAT_FIXED(1.8619)}, 
-    {FLOAT_FIXED(1.2577), FLOAT_FIXED(1.8278)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.783)}, 
-    {FLOAT_FIXED(1.2589), FLOAT_FIXED(1.8219)}, 
-    {FLOAT_FIXED(1.3052), FLOAT_FIXED(1.8605)}, 
-    {FLOAT_FIXED(1.3057), FLOAT_FIXED(1.8603)}, 
-    {FLOAT_FIXED(1.2593), FLOAT_FIXED(1.8217)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7614)}, 
-    {FLOAT_FIXED(1.2621), FLOAT_FIXED(1.8095)}, 
-    {FLOAT_FIXED(1.3126), FLOAT_FIXED(1.8574)}, 
-    {FLOAT_FIXED(1.3131), FLOAT_FIXED(1.8572)}, 
-    {FLOAT_FIXED(1.2626), FLOAT_FIXED(1.8093)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7884)}, 
-    {FLOAT_FIXED(1.258), FLOAT_FIXED(1.825)}, 
-    {FLOAT_FIXED(1.3034), FLOAT_FIXED(1.8613)}, 
-    {FLOAT_FIXED(1.3038), FLOAT_FIXED(1.8611)}, 
-    {FLOAT_FIXED(1.2585), FLOAT_FIXED(1.8248)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7722)}, 
-    {FLOAT_FIXED(1.2605), FLOAT_FIXED(1.8157)}, 
-    {FLOAT_FIXED(1.3089), FLOAT_FIXED(1.859)}, 
-    {FLOAT_FIXED(1.3094), FLOAT_FIXED(1.8588)}, 
-    {FLOAT_FIXED(1.2609), FLOAT_FIXED(1.8155)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7612)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.761)}, 
-    {FLOAT_FIXED(1.162), FLOAT_FIXED(1.7133)}, 
-    {FLOAT_FIXED(1.2635), FLOAT_FIXED(1.8089)}, 
-    {FLOAT_FIXED(1.3145), FLOAT_FIXED(1.8566)}, 
-    {FLOAT_FIXED(1.3149), FLOAT_FIXED(1.8565)}, 
-    {FLOAT_FIXED(1.264), FLOAT_FIXED(1.8087)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7668)}, 
-    {FLOAT_FIXED(1.2613), FLOAT_FIXED(1.8126)}, 
-    {FLOAT_FIXED(1.3108), FLOAT_FIXED(1.8582)}, 
-    {FLOAT_FIXED(1.3112), FLOAT_FIXED(1.858)}, 
-    {FLOAT_FIXED(1.2618), FLOAT_FIXED(1.8124)}, 
-    {FLOAT_FIXED(1.2135), FLOAT_FIXED(1.7608)}, 
-    {FLOAT_FIXED(1.1619), FLOAT_FIXED(1.7106)}, 
-    {FLOAT_FIXED(1.1625), FLOAT_FIXED(1.7131)}, 
-    {FLOAT_FIXED(1.2129), FLOAT_FIXED(1.7583)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7558)}, 
-    {FLOAT_FIXED(1.1608), FLOAT_FIXED(1.7056)}, 
-    {FLOAT_FIXED(1.1613), FLOAT_FIXED(1.7081)}, 
-    {FLOAT_FIXED(1.2116), FLOAT_FIXED(1.7616)}, 
-    {FLOAT_FIXED(1.2122), FLOAT_FIXED(1.7641)}, 
-    {FLOAT_FIXED(1.1621), FLOAT_FIXED(1.716)}, 
-    {FLOAT_FIXED(1.1127), FLOAT_FIXED(1.6704)}, 
-    {FLOAT_FIXED(1.1132), FLOAT_FIXED(1.6729)}, 
-    {FLOAT_FIXED(1.1627), FLOAT_FIXED(1.7185)}, 
-    {FLOAT_FIXED(1.212), FLOAT_FIXED(1.7724)}, 
-    {FLOAT_FIXED(1.2126), FLOAT_FIXED(1.7749)}, 
-    {FLOAT_FIXED(1.1646), FLOAT_FIXED(1.7314)}, 
-    {FLOAT_FIXED(1.1172), FLOAT_FIXED(1.6904)}, 
-    {FLOAT_FIXED(1.1178), FLOAT_FIXED(1.693)}, 
-    {FLOAT_FIXED(1.1652), FLOAT_FIXED(1.7339)}, 
-    {FLOAT_FIXED(1.2118), FLOAT_FIXED(1.767)}, 
-    {FLOAT_FIXED(1.2124), FLOAT_FIXED(1.7695)}, 
-    {FLOAT_FIXED(1.1634), FLOAT_FIXED(1.7237)}, 
-    {FLOAT_FIXED(1.115), FLOAT_FIXED(1.6804)}, 
-    {FLOAT_FIXED(1.1155), FLOAT_FIXED(1.6829)}, 
-    {FLOAT_FIXED(1.164), FLOAT_FIXED(1.7262)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7886)}, 
-    {FLOAT_FIXED(1.2133), FLOAT_FIXED(1.7911)}, 
-    {FLOAT_FIXED(1.1684), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.1241), FLOAT_FIXED(1.7205)}, 
-    {FLOAT_FIXED(1.1247), FLOAT_FIXED(1.723)}, 
-    {FLOAT_FIXED(1.169), FLOAT_FIXED(1.7571)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7778)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7803)}, 
-    {FLOAT_FIXED(1.1659), FLOAT_FIXED(1.7391)}, 
-    {FLOAT_FIXED(1.1195), FLOAT_FIXED(1.7005)}, 
-    {FLOAT_FIXED(1.1201), FLOAT_FIXED(1.703)}, 
-    {FLOAT_FIXED(1.1665), FLOAT_FIXED(1.7416)}, 
-    {FLOAT_FIXED(1.2129), FLOAT_FIXED(1.794)}, 
-    {FLOAT_FIXED(1.2135), FLOAT_FIXED(1.7965)}, 
-    {FLOAT_FIXED(1.1697), FLOAT_FIXED(1.7623)}, 
-    {FLOAT_FIXED(1.1264), FLOAT_FIXED(1.7306)}, 
-    {FLOAT_FIXED(1.127), FLOAT_FIXED(1.7331)}, 
-    {FLOAT_FIXED(1.1702), FLOAT_FIXED(1.7648)}, 
-    {FLOAT_FIXED(1.2138), FLOAT_FIXED(1.8156)}, 
-    {FLOAT_FIXED(1.2144), FLOAT_FIXED(1.8181)}, 
-    {FLOAT_FIXED(1.2535), FLOAT_FIXED(1.8406)}, 
-    {FLOAT_FIXED(1.1747), FLOAT_FIXED(1.7931)}, 
-    {FLOAT_FIXED(1.1356), FLOAT_FIXED(1.7707)}, 
-    {FLOAT_FIXED(1.1361), FLOAT_FIXED(1.7732)}, 
-    {FLOAT_FIXED(1.1753), FLOAT_FIXED(1.7956)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7994)}, 
-    {FLOAT_FIXED(1.2137), FLOAT_FIXED(1.8019)}, 
-    {FLOAT_FIXED(1.1709), FLOAT_FIXED(1.77)}, 
-    {FLOAT_FIXED(1.1287), FLOAT_FIXED(1.7406)}, 
-    {FLOAT_FIXED(1.1293), FLOAT_FIXED(1.7431)}, 
-    {FLOAT_FIXED(1.1715), FLOAT_FIXED(1.7725)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.8102)}, 
-    {FLOAT_FIXED(1.2142), FLOAT_FIXED(1.8127)}, 
-    {FLOAT_FIXED(1.2543), FLOAT_FIXED(1.8375)}, 
-    {FLOAT_FIXED(1.1734), FLOAT_FIXED(1.7854)}, 
-    {FLOAT_FIXED(1.1333), FLOAT_FIXED(1.7606)}, 
-    {FLOAT_FIXED(1.1338), FLOAT_FIXED(1.7631)}, 
-    {FLOAT_FIXED(1.174), FLOAT_FIXED(1.7879)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.8098)}, 
-    {FLOAT_FIXED(1.1727), FLOAT_FIXED(1.7802)}, 
-    {FLOAT_FIXED(1.1733), FLOAT_FIXED(1.7827)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.8073)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.8048)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.7752)}, 
-    {FLOAT_FIXED(1.1722), FLOAT_FIXED(1.7777)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7882)}, 
-    {FLOAT_FIXED(1.1677), FLOAT_FIXED(1.7494)}, 
-    {FLOAT_FIXED(1.1683), FLOAT_FIXED(1.7519)}, 
-    {FLOAT_FIXED(1.2131), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7832)}, 
-    {FLOAT_FIXED(1.1666), FLOAT_FIXED(1.7443)}, 
-    {FLOAT_FIXED(1.1672), FLOAT_FIXED(1.7469)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7504)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7529)}, 
-    {FLOAT_FIXED(1.1601), FLOAT_FIXED(1.7004)}, 
-    {FLOAT_FIXED(1.1081), FLOAT_FIXED(1.6503)}, 
-    {FLOAT_FIXED(1.1087), FLOAT_FIXED(1.6529)}, 
-    {FLOAT_FIXED(1.1607), FLOAT_FIXED(1.7029)}, 
-    {FLOAT_FIXED(1.2138), FLOAT_FIXED(1.8046)}, 
-    {FLOAT_FIXED(1.2556), FLOAT_FIXED(1.8342)}, 
-    {FLOAT_FIXED(1.2978), FLOAT_FIXED(1.8636)}, 
-    {FLOAT_FIXED(1.2983), FLOAT_FIXED(1.8634)}, 
-    {FLOAT_FIXED(1.2561), FLOAT_FIXED(1.834)}, 
-    {FLOAT_FIXED(1.296), FLOAT_FIXED(1.8644)}, 
-    {FLOAT_FIXED(1.2548), FLOAT_FIXED(1.8373)}, 
-    {FLOAT_FIXED(1.2955), FLOAT_FIXED(1.8646)}, 
-    {FLOAT_FIXED(1.2553), FLOAT_FIXED(1.8371)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.81)}, 
-    {FLOAT_FIXED(1.3163), FLOAT_FIXED(1.8559)}, 
-    {FLOAT_FIXED(1.2643), FLOAT_FIXED(1.8058)}, 
-    {FLOAT_FIXED(1.3158), FLOAT_FIXED(1.8561)}, 
-    {FLOAT_FIXED(1.2648), FLOAT_FIXED(1.8056)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7554)}, 
-    {FLOAT_FIXED(1.1612), FLOAT_FIXED(1.7054)}, 
-    {FLOAT_FIXED(1.2128), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.8152)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.8402)}, 
-    {FLOAT_FIXED(1.2549), FLOAT_FIXED(1.84)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8154)}, 
-    {FLOAT_FIXED(1.254), FLOAT_FIXED(1.8404)}, 
-    {FLOAT_FIXED(1.1777), FLOAT_FIXED(1.8097)}, 
-    {FLOAT_FIXED(1.139), FLOAT_FIXED(1.7857)}, 
-    {FLOAT_FIXED(1.1401), FLOAT_FIXED(1.7907)}, 
-    {FLOAT_FIXED(1.2533), FLOAT_FIXED(1.8462)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8287)}, 
-    {FLOAT_FIXED(1.2529), FLOAT_FIXED(1.8477)}, 
-    {FLOAT_FIXED(1.2151), FLOAT_FIXED(1.8233)}, 
-    {FLOAT_FIXED(1.2537), FLOAT_FIXED(1.8446)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7722)}, 
-    {FLOAT_FIXED(1.2605), FLOAT_FIXED(1.8157)}, 
-    {FLOAT_FIXED(1.3089), FLOAT_FIXED(1.859)}, 
-    {FLOAT_FIXED(1.3094), FLOAT_FIXED(1.8588)}, 
-    {FLOAT_FIXED(1.2609), FLOAT_FIXED(1.8155)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7938)}, 
-    {FLOAT_FIXED(1.2572), FLOAT_FIXED(1.828)}, 
-    {FLOAT_FIXED(1.3015), FLOAT_FIXED(1.8621)}, 
-    {FLOAT_FIXED(1.302), FLOAT_FIXED(1.8619)}, 
-    {FLOAT_FIXED(1.2577), FLOAT_FIXED(1.8278)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7884)}, 
-    {FLOAT_FIXED(1.258), FLOAT_FIXED(1.825)}, 
-    {FLOAT_FIXED(1.3034), FLOAT_FIXED(1.8613)}, 
-    {FLOAT_FIXED(1.3038), FLOAT_FIXED(1.8611)}, 
-    {FLOAT_FIXED(1.2585), FLOAT_FIXED(1.8248)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7992)}, 
-    {FLOAT_FIXED(1.2564), FLOAT_FIXED(1.8311)}, 
-    {FLOAT_FIXED(1.2997), FLOAT_FIXED(1.8629)}, 
-    {FLOAT_FIXED(1.3001), FLOAT_FIXED(1.8627)}, 
-    {FLOAT_FIXED(1.2569), FLOAT_FIXED(1.8309)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7776)}, 
-    {FLOAT_FIXED(1.2597), FLOAT_FIXED(1.8188)}, 
-    {FLOAT_FIXED(1.3071), FLOAT_FIXED(1.8597)}, 
-    {FLOAT_FIXED(1.3075), FLOAT_FIXED(1.8596)}, 
-    {FLOAT_FIXED(1.2601), FLOAT_FIXED(1.8186)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.783)}, 
-    {FLOAT_FIXED(1.2589), FLOAT_FIXED(1.8219)}, 
-    {FLOAT_FIXED(1.3052), FLOAT_FIXED(1.8605)}, 
-    {FLOAT_FIXED(1.3057), FLOAT_FIXED(1.8603)}, 
-    {FLOAT_FIXED(1.2593), FLOAT_FIXED(1.8217)}, 
-    {FLOAT_FIXED(1.2121), FLOAT_FIXED(1.7614)}, 
-    {FLOAT_FIXED(1.2621), FLOAT_FIXED(1.8095)}, 
-    {FLOAT_FIXED(1.3126), FLOAT_FIXED(1.8574)}, 
-    {FLOAT_FIXED(1.3131), FLOAT_FIXED(1.8572)}, 
-    {FLOAT_FIXED(1.2626), FLOAT_FIXED(1.8093)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7612)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.761)}, 
-    {FLOAT_FIXED(1.162), FLOAT_FIXED(1.7133)}, 
-    {FLOAT_FIXED(1.2635), FLOAT_FIXED(1.8089)}, 
-    {FLOAT_FIXED(1.3145), FLOAT_FIXED(1.8566)}, 
-    {FLOAT_FIXED(1.3149), FLOAT_FIXED(1.8565)}, 
-    {FLOAT_FIXED(1.264), FLOAT_FIXED(1.8087)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7668)}, 
-    {FLOAT_FIXED(1.2613), FLOAT_FIXED(1.8126)}, 
-    {FLOAT_FIXED(1.3108), FLOAT_FIXED(1.8582)}, 
-    {FLOAT_FIXED(1.3112), FLOAT_FIXED(1.858)}, 
-    {FLOAT_FIXED(1.2618), FLOAT_FIXED(1.8124)}, 
-    {FLOAT_FIXED(1.2135), FLOAT_FIXED(1.7608)}, 
-    {FLOAT_FIXED(1.1619), FLOAT_FIXED(1.7106)}, 
-    {FLOAT_FIXED(1.1625), FLOAT_FIXED(1.7131)}, 
-    {FLOAT_FIXED(1.2129), FLOAT_FIXED(1.7583)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7558)}, 
-    {FLOAT_FIXED(1.1608), FLOAT_FIXED(1.7056)}, 
-    {FLOAT_FIXED(1.1613), FLOAT_FIXED(1.7081)}, 
-    {FLOAT_FIXED(1.1871), FLOAT_FIXED(1.7)}, 
-    {FLOAT_FIXED(1.2397), FLOAT_FIXED(1.7525)}, 
-    {FLOAT_FIXED(1.2672), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.2147), FLOAT_FIXED(1.7021)}, 
-    {FLOAT_FIXED(1.1757), FLOAT_FIXED(1.7954)}, 
-    {FLOAT_FIXED(1.2153), FLOAT_FIXED(1.8177)}, 
-    {FLOAT_FIXED(1.1751), FLOAT_FIXED(1.7929)}, 
-    {FLOAT_FIXED(1.135), FLOAT_FIXED(1.7682)}, 
-    {FLOAT_FIXED(1.1356), FLOAT_FIXED(1.7707)}, 
-    {FLOAT_FIXED(1.1361), FLOAT_FIXED(1.7732)}, 
-    {FLOAT_FIXED(1.2173), FLOAT_FIXED(1.6537)}, 
-    {FLOAT_FIXED(1.1345), FLOAT_FIXED(1.6474)}, 
-    {FLOAT_FIXED(1.1098), FLOAT_FIXED(1.6579)}, 
-    {FLOAT_FIXED(1.1104), FLOAT_FIXED(1.6604)}, 
-    {FLOAT_FIXED(1.1092), FLOAT_FIXED(1.6554)}, 
-    {FLOAT_FIXED(1.111), FLOAT_FIXED(1.6629)}, 
-    {FLOAT_FIXED(1.2622), FLOAT_FIXED(1.8122)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7666)}, 
-    {FLOAT_FIXED(1.1633), FLOAT_FIXED(1.721)}, 
-    {FLOAT_FIXED(1.2598), FLOAT_FIXED(1.8215)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7828)}, 
-    {FLOAT_FIXED(1.167), FLOAT_FIXED(1.7442)}, 
-    {FLOAT_FIXED(1.1207), FLOAT_FIXED(1.7055)}, 
-    {FLOAT_FIXED(1.2606), FLOAT_FIXED(1.8184)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7774)}, 
-    {FLOAT_FIXED(1.1658), FLOAT_FIXED(1.7364)}, 
-    {FLOAT_FIXED(1.2573), FLOAT_FIXED(1.8307)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.799)}, 
-    {FLOAT_FIXED(1.1708), FLOAT_FIXED(1.7673)}, 
-    {FLOAT_FIXED(1.2582), FLOAT_FIXED(1.8277)}, 
-    {FLOAT_FIXED(1.2139), FLOAT_FIXED(1.7936)}, 
-    {FLOAT_FIXED(1.1696), FLOAT_FIXED(1.7596)}, 
-    {FLOAT_FIXED(1.2614), FLOAT_FIXED(1.8153)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.772)}, 
-    {FLOAT_FIXED(1.1645), FLOAT_FIXED(1.7287)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.826)}, 
-    {FLOAT_FIXED(1.2923), FLOAT_FIXED(1.866)}, 
-    {FLOAT_FIXED(1.2914), FLOAT_FIXED(1.8663)}, 
-    {FLOAT_FIXED(1.2932), FLOAT_FIXED(1.8656)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8314)}, 
-    {FLOAT_FIXED(1.2525), FLOAT_FIXED(1.8493)}, 
-    {FLOAT_FIXED(1.2904), FLOAT_FIXED(1.8667)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.1783), FLOAT_FIXED(1.8136)}, 
-    {FLOAT_FIXED(1.1413), FLOAT_FIXED(1.7957)}, 
-    {FLOAT_FIXED(1.1771), FLOAT_FIXED(1.8059)}, 
-    {FLOAT_FIXED(1.2937), FLOAT_FIXED(1.8654)}, 
-    {FLOAT_FIXED(1.2941), FLOAT_FIXED(1.8652)}, 
-    {FLOAT_FIXED(1.2932), FLOAT_FIXED(1.8656)}, 
-    {FLOAT_FIXED(1.2946), FLOAT_FIXED(1.865)}, 
-    {FLOAT_FIXED(1.2951), FLOAT_FIXED(1.8648)}, 
-    {FLOAT_FIXED(1.2565), FLOAT_FIXED(1.8338)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8044)}, 
-    {FLOAT_FIXED(1.1721), FLOAT_FIXED(1.775)}, 
-    {FLOAT_FIXED(1.1298), FLOAT_FIXED(1.7456)}, 
-    {FLOAT_FIXED(1.1213), FLOAT_FIXED(1.708)}, 
-    {FLOAT_FIXED(1.1218), FLOAT_FIXED(1.7105)}, 
-    {FLOAT_FIXED(1.1224), FLOAT_FIXED(1.713)}, 
-    {FLOAT_FIXED(1.1304), FLOAT_FIXED(1.7481)}, 
-    {FLOAT_FIXED(1.131), FLOAT_FIXED(1.7506)}, 
-    {FLOAT_FIXED(1.1316), FLOAT_FIXED(1.7531)}, 
-    {FLOAT_FIXED(1.1758), FLOAT_FIXED(1.7981)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8206)}, 
-    {FLOAT_FIXED(1.1098), FLOAT_FIXED(1.6579)}, 
-    {FLOAT_FIXED(1.1104), FLOAT_FIXED(1.6604)}, 
-    {FLOAT_FIXED(1.1092), FLOAT_FIXED(1.6554)}, 
-    {FLOAT_FIXED(1.111), FLOAT_FIXED(1.6629)}, 
-    {FLOAT_FIXED(1.2622), FLOAT_FIXED(1.8122)}, 
-    {FLOAT_FIXED(1.2127), FLOAT_FIXED(1.7666)}, 
-    {FLOAT_FIXED(1.1633), FLOAT_FIXED(1.721)}, 
-    {FLOAT_FIXED(1.1138), FLOAT_FIXED(1.6754)}, 
-    {FLOAT_FIXED(1.1161), FLOAT_FIXED(1.6854)}, 
-    {FLOAT_FIXED(1.123), FLOAT_FIXED(1.7155)}, 
-    {FLOAT_FIXED(1.1207), FLOAT_FIXED(1.7055)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.7255)}, 
-    {FLOAT_FIXED(1.1184), FLOAT_FIXED(1.6955)}, 
-    {FLOAT_FIXED(1.2937), FLOAT_FIXED(1.8654)}, 
-    {FLOAT_FIXED(1.2941), FLOAT_FIXED(1.8652)}, 
-    {FLOAT_FIXED(1.2946), FLOAT_FIXED(1.865)}, 
-    {FLOAT_FIXED(1.2951), FLOAT_FIXED(1.8648)}, 
-    {FLOAT_FIXED(1.1327), FLOAT_FIXED(1.7581)}, 
-    {FLOAT_FIXED(1.1333), FLOAT_FIXED(1.7606)}, 
-    {FLOAT_FIXED(1.1338), FLOAT_FIXED(1.7631)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.826)}, 
-    {FLOAT_FIXED(1.2923), FLOAT_FIXED(1.866)}, 
-    {FLOAT_FIXED(1.2914), FLOAT_FIXED(1.8663)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8314)}, 
-    {FLOAT_FIXED(1.2525), FLOAT_FIXED(1.8493)}, 
-    {FLOAT_FIXED(1.2904), FLOAT_FIXED(1.8667)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.1783), FLOAT_FIXED(1.8136)}, 
-    {FLOAT_FIXED(1.1413), FLOAT_FIXED(1.7957)}, 
-    {FLOAT_FIXED(1.1771), FLOAT_FIXED(1.8059)}, 
-    {FLOAT_FIXED(1.1298), FLOAT_FIXED(1.7456)}, 
-    {FLOAT_FIXED(1.1281), FLOAT_FIXED(1.7381)}, 
-    {FLOAT_FIXED(1.1287), FLOAT_FIXED(1.7406)}, 
-    {FLOAT_FIXED(1.1293), FLOAT_FIXED(1.7431)}, 
-    {FLOAT_FIXED(1.1213), FLOAT_FIXED(1.708)}, 
-    {FLOAT_FIXED(1.1218), FLOAT_FIXED(1.7105)}, 
-    {FLOAT_FIXED(1.1224), FLOAT_FIXED(1.713)}, 
-    {FLOAT_FIXED(1.1144), FLOAT_FIXED(1.6779)}, 
-    {FLOAT_FIXED(1.115), FLOAT_FIXED(1.6804)}, 
-    {FLOAT_FIXED(1.1155), FLOAT_FIXED(1.6829)}, 
-    {FLOAT_FIXED(1.1235), FLOAT_FIXED(1.718)}, 
-    {FLOAT_FIXED(1.1241), FLOAT_FIXED(1.7205)}, 
-    {FLOAT_FIXED(1.1247), FLOAT_FIXED(1.723)}, 
-    {FLOAT_FIXED(1.1167), FLOAT_FIXED(1.6879)}, 
-    {FLOAT_FIXED(1.1172), FLOAT_FIXED(1.6904)}, 
-    {FLOAT_FIXED(1.1178), FLOAT_FIXED(1.693)}, 
-    {FLOAT_FIXED(1.119), FLOAT_FIXED(1.698)}, 
-    {FLOAT_FIXED(1.1195), FLOAT_FIXED(1.7005)}, 
-    {FLOAT_FIXED(1.1201), FLOAT_FIXED(1.703)}, 
-    {FLOAT_FIXED(1.2422), FLOAT_FIXED(1.7042)}, 
-    {FLOAT_FIXED(1.2173), FLOAT_FIXED(1.6537)}, 
-    {FLOAT_FIXED(1.2614), FLOAT_FIXED(1.8153)}, 
-    {FLOAT_FIXED(1.213), FLOAT_FIXED(1.772)}, 
-    {FLOAT_FIXED(1.1645), FLOAT_FIXED(1.7287)}, 
-    {FLOAT_FIXED(1.1161), FLOAT_FIXED(1.6854)}, 
-    {FLOAT_FIXED(1.263), FLOAT_FIXED(1.8091)}, 
-    {FLOAT_FIXED(1.2125), FLOAT_FIXED(1.7612)}, 
-    {FLOAT_FIXED(1.162), FLOAT_FIXED(1.7133)}, 
-    {FLOAT_FIXED(1.1115), FLOAT_FIXED(1.6654)}, 
-    {FLOAT_FIXED(1.259), FLOAT_FIXED(1.8246)}, 
-    {FLOAT_FIXED(1.2136), FLOAT_FIXED(1.7882)}, 
-    {FLOAT_FIXED(1.1683), FLOAT_FIXED(1.7519)}, 
-    {FLOAT_FIXED(1.123), FLOAT_FIXED(1.7155)}, 
-    {FLOAT_FIXED(1.2598), FLOAT_FIXED(1.8215)}, 
-    {FLOAT_FIXED(1.2134), FLOAT_FIXED(1.7828)}, 
-    {FLOAT_FIXED(1.167), FLOAT_FIXED(1.7442)}, 
-    {FLOAT_FIXED(1.2573), FLOAT_FIXED(1.8307)}, 
-    {FLOAT_FIXED(1.2141), FLOAT_FIXED(1.799)}, 
-    {FLOAT_FIXED(1.1708), FLOAT_FIXED(1.7673)}, 
-    {FLOAT_FIXED(1.2565), FLOAT_FIXED(1.8338)}, 
-    {FLOAT_FIXED(1.2143), FLOAT_FIXED(1.8044)}, 
-    {FLOAT_FIXED(1.1721), FLOAT_FIXED(1.775)}, 
-    {FLOAT_FIXED(1.1075), FLOAT_FIXED(1.6478)}, 
-    {FLOAT_FIXED(1.1081), FLOAT_FIXED(1.6503)}, 
-    {FLOAT_FIXED(1.1087), FLOAT_FIXED(1.6529)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.826)}, 
-    {FLOAT_FIXED(1.2923), FLOAT_FIXED(1.866)}, 
-    {FLOAT_FIXED(1.2914), FLOAT_FIXED(1.8663)}, 
-    {FLOAT_FIXED(1.2932), FLOAT_FIXED(1.8656)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8314)}, 
-    {FLOAT_FIXED(1.2525), FLOAT_FIXED(1.8493)}, 
-    {FLOAT_FIXED(1.2904), FLOAT_FIXED(1.8667)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.1783), FLOAT_FIXED(1.8136)}, 
-    {FLOAT_FIXED(1.1413), FLOAT_FIXED(1.7957)}, 
-    {FLOAT_FIXED(1.1771), FLOAT_FIXED(1.8059)}, 
-    {FLOAT_FIXED(1.2557), FLOAT_FIXED(1.8369)}, 
-    {FLOAT_FIXED(1.2145), FLOAT_FIXED(1.8098)}, 
-    {FLOAT_FIXED(1.1733), FLOAT_FIXED(1.7827)}, 
-    {FLOAT_FIXED(1.1321), FLOAT_FIXED(1.7556)}, 
-    {FLOAT_FIXED(1.1121), FLOAT_FIXED(1.6679)}, 
-    {FLOAT_FIXED(1.1127), FLOAT_FIXED(1.6704)}, 
-    {FLOAT_FIXED(1.1132), FLOAT_FIXED(1.6729)}, 
-    {FLOAT_FIXED(1.1167), FLOAT_FIXED(1.6879)}, 
-    {FLOAT_FIXED(1.1172), FLOAT_FIXED(1.6904)}, 
-    {FLOAT_FIXED(1.1178), FLOAT_FIXED(1.693)}, 
-    {FLOAT_FIXED(1.1758), FLOAT_FIXED(1.7981)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8206)}, 
-    {FLOAT_FIXED(1.1235), FLOAT_FIXED(1.718)}, 
-    {FLOAT_FIXED(1.1241), FLOAT_FIXED(1.7205)}, 
-    {FLOAT_FIXED(1.1247), FLOAT_FIXED(1.723)}, 
-    {FLOAT_FIXED(1.1327), FLOAT_FIXED(1.7581)}, 
-    {FLOAT_FIXED(1.1333), FLOAT_FIXED(1.7606)}, 
-    {FLOAT_FIXED(1.1338), FLOAT_FIXED(1.7631)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.826)}, 
-    {FLOAT_FIXED(1.2923), FLOAT_FIXED(1.866)}, 
-    {FLOAT_FIXED(1.2914), FLOAT_FIXED(1.8663)}, 
-    {FLOAT_FIXED(1.2932), FLOAT_FIXED(1.8656)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8314)}, 
-    {FLOAT_FIXED(1.2525), FLOAT_FIXED(1.8493)}, 
-    {FLOAT_FIXED(1.2904), FLOAT_FIXED(1.8667)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.1783), FLOAT_FIXED(1.8136)}, 
-    {FLOAT_FIXED(1.1413), FLOAT_FIXED(1.7957)}, 
-    {FLOAT_FIXED(1.1771), FLOAT_FIXED(1.8059)}, 
-    {FLOAT_FIXED(1.1207), FLOAT_FIXED(1.7055)}, 
-    {FLOAT_FIXED(1.1713), FLOAT_FIXED(1.7671)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.7986)}, 
-    {FLOAT_FIXED(1.1275), FLOAT_FIXED(1.7356)}, 
-    {FLOAT_FIXED(1.2587), FLOAT_FIXED(1.8302)}, 
-    {FLOAT_FIXED(1.3025), FLOAT_FIXED(1.8617)}, 
-    {FLOAT_FIXED(1.3098), FLOAT_FIXED(1.8586)}, 
-    {FLOAT_FIXED(1.3135), FLOAT_FIXED(1.857)}, 
-    {FLOAT_FIXED(1.1213), FLOAT_FIXED(1.708)}, 
-    {FLOAT_FIXED(1.1218), FLOAT_FIXED(1.7105)}, 
-    {FLOAT_FIXED(1.1224), FLOAT_FIXED(1.713)}, 
-    {FLOAT_FIXED(1.3043), FLOAT_FIXED(1.8609)}, 
-    {FLOAT_FIXED(1.3085), FLOAT_FIXED(1.8592)}, 
-    {FLOAT_FIXED(1.3089), FLOAT_FIXED(1.859)}, 
-    {FLOAT_FIXED(1.3094), FLOAT_FIXED(1.8588)}, 
-    {FLOAT_FIXED(1.2152), FLOAT_FIXED(1.826)}, 
-    {FLOAT_FIXED(1.2923), FLOAT_FIXED(1.866)}, 
-    {FLOAT_FIXED(1.2914), FLOAT_FIXED(1.8663)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8314)}, 
-    {FLOAT_FIXED(1.2525), FLOAT_FIXED(1.8493)}, 
-    {FLOAT_FIXED(1.2904), FLOAT_FIXED(1.8667)}, 
-    {FLOAT_FIXED(1.2895), FLOAT_FIXED(1.8671)}, 
-    {FLOAT_FIXED(1.1783), FLOAT_FIXED(1.8136)}, 
-    {FLOAT_FIXED(1.1413), FLOAT_FIXED(1.7957)}, 
-    {FLOAT_FIXED(1.1771), FLOAT_FIXED(1.8059)}, 
-    {FLOAT_FIXED(1.3029), FLOAT_FIXED(1.8615)}, 
-    {FLOAT_FIXED(1.3034), FLOAT_FIXED(1.8613)}, 
-    {FLOAT_FIXED(1.3038), FLOAT_FIXED(1.8611)}, 
-    {FLOAT_FIXED(1.3103), FLOAT_FIXED(1.8584)}, 
-    {FLOAT_FIXED(1.3108), FLOAT_FIXED(1.8582)}, 
-    {FLOAT_FIXED(1.3112), FLOAT_FIXED(1.858)}, 
-    {FLOAT_FIXED(1.1612), FLOAT_FIXED(1.7054)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7554)}, 
-    {FLOAT_FIXED(1.2652), FLOAT_FIXED(1.8054)}, 
-    {FLOAT_FIXED(1.314), FLOAT_FIXED(1.8568)}, 
-    {FLOAT_FIXED(1.3145), FLOAT_FIXED(1.8566)}, 
-    {FLOAT_FIXED(1.3149), FLOAT_FIXED(1.8565)}, 
-    {FLOAT_FIXED(1.1304), FLOAT_FIXED(1.7481)}, 
-    {FLOAT_FIXED(1.131), FLOAT_FIXED(1.7506)}, 
-    {FLOAT_FIXED(1.1316), FLOAT_FIXED(1.7531)}, 
-    {FLOAT_FIXED(1.2974), FLOAT_FIXED(1.8638)}, 
-    {FLOAT_FIXED(1.2978), FLOAT_FIXED(1.8636)}, 
-    {FLOAT_FIXED(1.2969), FLOAT_FIXED(1.864)}, 
-    {FLOAT_FIXED(1.2983), FLOAT_FIXED(1.8634)}, 
-    {FLOAT_FIXED(1.2955), FLOAT_FIXED(1.8646)}, 
-    {FLOAT_FIXED(1.296), FLOAT_FIXED(1.8644)}, 
-    {FLOAT_FIXED(1.2965), FLOAT_FIXED(1.8642)}, 
-    {FLOAT_FIXED(1.1758), FLOAT_FIXED(1.7981)}, 
-    {FLOAT_FIXED(1.215), FLOAT_FIXED(1.8206)}, 
-    {FLOAT_FIXED(1.1098), FLOAT_FIXED(1.6579)}, 
-    {FLOAT_FIXED(1.1104), FLOAT_FIXED(1.6604)}, 
-    {FLOAT_FIXED(1.1092), FLOAT_FIXED(1.6554)}, 
-    {FLOAT_FIXED(1.111), FLOAT_FIXED(1.6629)}, 
-    {FLOAT_FIXED(1.1115), FLOAT_FIXED(1.6654)}, 
-    {FLOAT_FIXED(1.2592), FLOAT_FIXED(1.819)}, 
-    {FLOAT_FIXED(1.2123), FLOAT_FIXED(1.7778)}, 
-    {FLOAT_FIXED(1.3061), FLOAT_FIXED(1.8601)}, 
-    {FLOAT_FIXED(1.1653), FLOAT_FIXED(1.7366)}, 
-    {FLOAT_FIXED(1.1144), FLOAT_FIXED(1.6779)}, 
-    {FLOAT_FIXED(1.115), FLOAT_FIXED(1.6804)}, 
-    {FLOAT_FIXED(1.1155), FLOAT_FIXED(1.6829)}, 
-    {FLOAT_FIXED(1.1161), FLOAT_FIXED(1.6854)}, 
-    {FLOAT_FIXED(1.1738), FLOAT_FIXED(1.7825)}, 
-    {FLOAT_FIXED(1.2154), FLOAT_FIXED(1.8094)}, 
-    {FLOAT_FIXED(1.2571), FLOAT_FIXED(1.8363)}, 
-    {FLOAT_FIXED(1.2988), FLOAT_FIXED(1.8632)}, 
-    {FLOAT_FIXED(1.3006), FLOAT_FIXED(1.8625)}, 
-    {FLOAT_FIXED(1.2951), FLOAT_FIXED(1.8648)}, 
-    {FLOAT_FIXED(1.3048), FLOAT_FIXED(1.8607)}, 
-    {FLOAT_FIXED(1.3052), FLOAT_FIXED(1.8605)}, 
-    {FLOAT_FIXED(1.3043), FLOAT_FIXED(1.8609)}, 
-    {FLOAT_FIXED(1.3057), FLOAT_FIXED(1.8603)}, 
-    {FLOAT_FIXED(1.1612), FLOAT_FIXED(1.7054)}, 
-    {FLOAT_FIXED(1.2132), FLOAT_FIXED(1.7554)}, 
-    {FLOAT_FIXED(1.2652), FLOAT_FIXED(1.8054)}, 
-    {FLOAT_FIXED(1.2992), FLOAT_FIXED(1.863)}, 
-    {FLOAT_FIXED(1.2997), FLOAT_FIXED(1.8629)}, 
-    {FLOAT_FIXED(1.3001), FLOAT_FIXED(1.8627)}, 
-    {FLOAT_FIXED(1.2937), FLOAT_FIXED(1.8654)}, 
-    {FLOAT_FIXED(1.2941), FLOAT_FIXED(1.8652)}, 
-    {FLOAT_FIXED(1.2946), FLOAT_FIXED(1.865)}, 
-    {FLOAT_FIXED(1.2955), FLOAT_FIXED(1.8646)}, 
-    {FLOAT_FIXED(1.296), FLOAT_FIXED(1.8644)}, 
-    {FLOAT_FIXED(1.2965), FLOAT_FIXED(1.8642)}, 
-    {FLOAT_FIXED(1.2922), FLOAT_FIXED(1.805)}, 
-    {FLOAT_FIXED(1.2672), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.2173), FLOAT_FIXED(1.6537)}, 
-    {FLOAT_FIXED(1.2922), FLOAT_FIXED(1.805)}, 
-    {FLOAT_FIXED(1.2672), FLOAT_FIXED(1.7546)}, 
-    {FLOAT_FIXED(1.2173), FLOAT_FIXED(1.6537)}, 
-    {FLOAT_FIXED(1.2173), FLOAT_FIXED(1.6537)}, 
-    {FLOAT_FIXED(1.1345), FLOAT_FIXED(1.6474)}, 
-    {FLOAT_FIXED(1.1164), FLOAT_FIXED(1.6279)}, 
-    {FLOAT_FIXED(1.1259), FLOAT_FIXED(1.6104)}, 
-    {FLOAT_FIXED(1.2915), FLOAT_FIXED(1.7421)}, 
-    {FLOAT_FIXED(1.3053), FLOAT_FIXED(1.7984)}, 
-    {FLOAT_FIXED(1.3191), FLOAT_FIXED(1.8547)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.6321)}, 
-    {FLOAT_FIXED(1.3053), FLOAT_FIXED(1.7984)}, 
-    {FLOAT_FIXED(1.2915), FLOAT_FIXED(1.7421)}, 
-    {FLOAT_FIXED(1.3191), FLOAT_FIXED(1.8547)}, 
-    {FLOAT_FIXED(1.1058), FLOAT_FIXED(1.6403)}, 
-    {FLOAT_FIXED(1.1047), FLOAT_FIXED(1.6353)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.6321)}, 
-    {FLOAT_FIXED(1.1058), FLOAT_FIXED(1.6403)}, 
-    {FLOAT_FIXED(1.1047), FLOAT_FIXED(1.6353)}, 
-    {FLOAT_FIXED(1.3053), FLOAT_FIXED(1.7984)}, 
-    {FLOAT_FIXED(1.2915), FLOAT_FIXED(1.7421)}, 
-    {FLOAT_FIXED(1.3191), FLOAT_FIXED(1.8547)}, 
-    {FLOAT_FIXED(1.3053), FLOAT_FIXED(1.7984)}, 
-    {FLOAT_FIXED(1.2915), FLOAT_FIXED(1.7421)}, 
-    {FLOAT_FIXED(1.3191), FLOAT_FIXED(1.8547)}, 
-    {FLOAT_FIXED(1.3053), FLOAT_FIXED(1.7984)}, 
-    {FLOAT_FIXED(1.2915), FLOAT_FIXED(1.7421)}, 
-    {FLOAT_FIXED(1.3191), FLOAT_FIXED(1.8547)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.6321)}, 
-    {FLOAT_FIXED(1.1058), FLOAT_FIXED(1.6403)}, 
-    {FLOAT_FIXED(1.1047), FLOAT_FIXED(1.6353)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.6321)}, 
-    {FLOAT_FIXED(1.1164), FLOAT_FIXED(1.6279)}, 
-    {FLOAT_FIXED(1.1259), FLOAT_FIXED(1.6104)}, 
-    {FLOAT_FIXED(1.2544), FLOAT_FIXED(1.6979)}, 
-    {FLOAT_FIXED(1.1716), FLOAT_FIXED(1.6321)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(2), FLOAT_FIXED(1)}, 
-    {FLOAT_FIXED(1.1663), FLOAT_FIXED(1.6431)}, 
-    {FLOAT_FIXED(1.1663), FLOAT_FIXED(1.6431)}, 
-    {FLOAT_FIXED(1.1663), FLOAT_FIXED(1.6431)}, 
-    {FLOAT_FIXED(1.1253), FLOAT_FIXED(1.5827)}, 
-    {FLOAT_FIXED(1.1663), FLOAT_FIXED(1.6431)}, 
-    {FLOAT_FIXED(1.2444), FLOAT_FIXED(1.8344)}, 
-    {FLOAT_FIXED(1.3151), FLOAT_FIXED(1.8551)}, 
-    {FLOAT_FIXED(1.3407), FLOAT_FIXED(1.843)}, 
-    {FLOAT_FIXED(1.3662), FLOAT_FIXED(1.8309)}, 
-    {FLOAT_FIXED(1.3633), FLOAT_FIXED(1.784)}, 
-    {FLOAT_FIXED(1.1994), FLOAT_FIXED(1.8016)}, 
-    {FLOAT_FIXED(1.1092), FLOAT_FIXED(1.7361)}, 
-    {FLOAT_FIXED(1.1543), FLOAT_FIXED(1.7689)}, 
-    {FLOAT_FIXED(1.1069), FLOAT_FIXED(1.7038)}, 
-    {FLOAT_FIXED(1.3918), FLOAT_FIXED(1.8189)}, 
-    {FLOAT_FIXED(1.3063), FLOAT_FIXED(1.7142)}, 
-    {FLOAT_FIXED(1.2333), FLOAT_FIXED(1.6612)}, 
-    {FLOAT_FIXED(1.1444), FLOAT_FIXED(1.625)}, 
-    {FLOAT_FIXED(1.1), FLOAT_FIXED(1.6069)}, 
-    {FLOAT_FIXED(1.1023), FLOAT_FIXED(1.6392)}, 
-    {FLOAT_FIXED(1.2778), FLOAT_FIXED(1.6793)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.228), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.7486), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.742)}, 
-    {FLOAT_FIXED(1.5577), FLOAT_FIXED(1.933)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.2157)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-    {FLOAT_FIXED(1.0595), FLOAT_FIXED(1.3843)}, 
-};
-
-static triangle_t faces[] = {
-    {594, 590, 592, 0, 0, 1, 2, 0},
-    {632, 626, 625, 1, 3, 4, 5, 0},
-    {537, 531, 527, 2, 6, 7, 8, 0},
-    {527, 532, 537, 3, 9, 10, 11, 0},
-    {571, 575, 565, 4, 12, 13, 14, 0},
-    {53, 52, 54, 5, 15, 16, 17, 0},
-    {461, 462, 458, 6, 18, 19, 20, 0},
-    {454, 451, 461, 7, 21, 22, 23, 0},
-    {605, 601, 603, 8, 24, 25, 26, 0},
-    {516, 520, 514, 9, 27, 28, 29, 0},
-    {453, 455, 465, 10, 30, 31, 32, 0},
-    {509, 513, 511, 11, 33, 34, 35, 0},
-    {455, 469, 465, 12, 36, 37, 32, 0},
-    {582, 584, 588, 13, 38, 39, 40, 0},
-    {618, 620, 622, 14, 41, 42, 43, 0},
-    {59, 55, 61, 15, 44, 45, 46, 0},
-    {72, 76, 80, 16, 47, 48, 49, 0},
-    {530, 528, 523, 17, 50, 51, 52, 0},
-    {468, 476, 478, 18, 53, 54, 55, 0},
-    {642, 636, 634, 19, 56, 57, 58, 0},
-    {603, 607, 605, 20, 59, 60, 61, 0},
-    {461, 456, 454, 21, 18, 62, 63, 0},
-    {551, 560, 562, 22, 64, 65, 66, 0},
-    {620, 625, 626, 23, 67, 68, 69, 0},
-    {485, 489, 491, 24, 70, 71, 72, 0},
-    {469, 457, 471, 25, 73, 74, 75, 0},
-    {477, 475, 467, 26, 76, 77, 78, 0},
-    {483, 481, 473, 27, 79, 80, 81, 0},
-    {561, 558, 548, 28, 82, 83, 84, 0},
-    {586, 588, 592, 29, 85, 86, 2, 0},
-    {583, 589, 585, 30, 87, 88, 89, 0},
-    {503, 499, 497, 31, 90, 91, 92, 0},
-    {586, 582, 588, 32, 85, 93, 40, 0},
-    {627, 633, 624, 33, 94, 95, 96, 0},
-    {551, 549, 560, 34, 64, 97, 98, 0},
-    {60, 54, 58, 35, 99, 100, 101, 0},
-    {597, 599, 600, 36, 102, 103, 104, 0},
-    {58, 62, 64, 37, 105, 106, 107, 0},
-    {612, 614, 616, 38, 108, 109, 110, 0},
-    {589, 583, 587, 39, 111, 112, 113, 0},
-    {540, 539, 547, 40, 114, 115, 116, 0},
-    {463, 460, 450, 41, 117, 118, 119, 0},
-    {611, 617, 613, 42, 120, 121, 122, 0},
-    {21, 19, 11, 43, 123, 124, 125, 0},
-    {554, 567, 563, 44, 126, 127, 128, 0},
-    {84, 86, 95, 45, 129, 130, 131, 0},
-    {69, 67, 75, 46, 132, 133, 134, 0},
-    {86, 85, 95, 47, 135, 136, 131, 0},
-    {85, 83, 93, 48, 137, 138, 139, 0},
-    {579, 575, 571, 49, 140, 13, 141, 0},
-    {487, 483, 479, 50, 142, 143, 144, 0},
-    {622, 616, 614, 51, 145, 146, 147, 0},
-    {471, 459, 475, 52, 148, 149, 150, 0},
-    {46, 48, 52, 53, 151, 152, 153, 0},
-    {96, 97, 98, 54, 154, 155, 156, 0},
-    {96, 99, 97, 55, 154, 157, 158, 0},
-    {100, 99, 96, 56, 159, 157, 160, 0},
-    {100, 101, 99, 57, 159, 161, 162, 0},
-    {102, 101, 100, 58, 163, 161, 164, 0},
-    {102, 103, 101, 59, 163, 165, 166, 0},
-    {104, 103, 102, 59, 167, 165, 168, 0},
-    {104, 105, 103, 60, 167, 169, 170, 0},
-    {106, 105, 104, 60, 171, 169, 172, 0},
-    {107, 108, 105, 61, 173, 174, 175, 0},
-    {109, 107, 105, 62, 176, 177, 175, 0},
-    {106, 109, 105, 63, 171, 178, 175, 0},
-    {110, 109, 106, 64, 179, 178, 180, 0},
-    {111, 110, 106, 65, 181, 182, 180, 0},
-    {111, 112, 110, 66, 181, 183, 184, 0},
-    {113, 108, 107, 67, 185, 174, 186, 0},
-    {111, 114, 112, 68, 181, 187, 188, 0},
-    {115, 108, 113, 69, 189, 174, 190, 0},
-    {111, 116, 114, 70, 181, 191, 192, 0},
-    {117, 108, 115, 71, 193, 174, 194, 0},
-    {118, 116, 111, 72, 195, 191, 196, 0},
-    {117, 119, 108, 73, 193, 197, 198, 0},
-    {118, 120, 116, 74, 195, 199, 200, 0},
-    {121, 119, 117, 75, 201, 197, 202, 0},
-    {118, 122, 120, 76, 195, 203, 204, 0},
-    {123, 119, 121, 77, 205, 197, 206, 0},
-    {124, 122, 118, 78, 207, 203, 208, 0},
-    {123, 125, 119, 79, 205, 209, 210, 0},
-    {124, 126, 122, 80, 207, 211, 212, 0},
-    {127, 125, 123, 81, 213, 209, 214, 0},
-    {128, 126, 124, 82, 215, 211, 216, 0},
-    {127, 129, 125, 83, 213, 217, 218, 0},
-    {128, 130, 126, 84, 215, 219, 220, 0},
-    {131, 129, 127, 85, 221, 217, 222, 0},
-    {128, 132, 130, 86, 215, 223, 224, 0},
-    {133, 129, 131, 87, 225, 217, 226, 0},
-    {134, 132, 128, 88, 227, 223, 228, 0},
-    {133, 135, 129, 89, 225, 229, 230, 0},
-    {134, 136, 132, 90, 227, 231, 232, 0},
-    {137, 135, 133, 91, 233, 229, 234, 0},
-    {138, 136, 134, 92, 235, 231, 236, 0},
-    {137, 139, 135, 93, 233, 237, 238, 0},
-    {138, 140, 136, 94, 235, 239, 240, 0},
-    {141, 139, 137, 95, 241, 237, 242, 0},
-    {142, 140, 138, 96, 243, 239, 244, 0},
-    {141, 143, 139, 97, 241, 245, 246, 0},
-    {142, 144, 140, 98, 243, 247, 248, 0},
-    {145, 143, 141, 98, 249, 245, 250, 0},
-    {145, 146, 143, 99, 249, 251, 252, 0},
-    {147, 146, 145, 100, 253, 251, 254, 0},
-    {142, 148, 144, 101, 243, 255, 256, 0},
-    {149, 148, 142, 102, 257, 255, 258, 0},
-    {149, 150, 148, 103, 257, 259, 260, 0},
-    {151, 146, 147, 104, 261, 251, 262, 0},
-    {152, 150, 149, 105, 263, 259, 264, 0},
-    {151, 153, 146, 106, 261, 265, 266, 0},
-    {152, 154, 150, 107, 263, 267, 268, 0},
-    {155, 153, 151, 108, 269, 265, 270, 0},
-    {156, 154, 152, 109, 271, 267, 272, 0},
-    {155, 157, 153, 110, 269, 273, 274, 0},
-    {156, 158, 154, 111, 271, 275, 276, 0},
-    {159, 157, 155, 112, 277, 273, 278, 0},
-    {160, 158, 156, 113, 279, 275, 280, 0},
-    {159, 161, 157, 114, 277, 281, 282, 0},
-    {160, 162, 158, 115, 279, 283, 284, 0},
-    {163, 161, 159, 116, 285, 281, 286, 0},
-    {160, 164, 162, 117, 279, 287, 288, 0},
-    {165, 161, 163, 118, 289, 281, 290, 0},
-    {166, 164, 160, 119, 291, 287, 292, 0},
-    {165, 167, 161, 120, 289, 293, 294, 0},
-    {166, 168, 164, 121, 291, 295, 296, 0},
-    {169, 167, 165, 122, 297, 293, 298, 0},
-    {170, 168, 166, 123, 299, 295, 300, 0},
-    {169, 171, 167, 124, 297, 301, 302, 0},
-    {170, 172, 168, 125, 299, 303, 304, 0},
-    {173, 171, 169, 126, 305, 301, 306, 0},
-    {170, 174, 172, 127, 299, 307, 308, 0},
-    {175, 171, 173, 128, 309, 301, 310, 0},
-    {176, 174, 170, 129, 311, 307, 312, 0},
-    {175, 177, 171, 130, 309, 313, 314, 0},
-    {176, 178, 174, 131, 311, 315, 316, 0},
-    {179, 177, 175, 132, 317, 313, 318, 0},
-    {176, 180, 178, 133, 311, 319, 320, 0},
-    {181, 177, 179, 134, 321, 313, 322, 0},
-    {176, 182, 180, 135, 311, 323, 324, 0},
-    {182, 177, 181, 136, 325, 313, 326, 0},
-    {176, 177, 182, 137, 311, 313, 327, 0},
-    {176, 183, 177, 138, 311, 328, 329, 0},
-    {184, 183, 176, 138, 330, 328, 331, 0},
-    {184, 185, 183, 139, 330, 332, 333, 0},
-    {186, 185, 184, 139, 334, 332, 335, 0},
-    {186, 187, 185, 140, 334, 336, 337, 0},
-    {188, 187, 186, 140, 338, 336, 339, 0},
-    {188, 189, 187, 141, 338, 340, 341, 0},
-    {190, 189, 188, 141, 342, 340, 343, 0},
-    {190, 191, 189, 142, 342, 344, 345, 0},
-    {384, 385, 386, 143, 346, 347, 348, 0},
-    {384, 386, 387, 144, 346, 349, 350, 0},
-    {388, 389, 390, 145, 351, 352, 353, 0},
-    {391, 392, 393, 146, 354, 355, 356, 0},
-    {394, 395, 396, 147, 357, 358, 359, 0},
-    {397, 398, 399, 148, 360, 361, 362, 0},
-    {384, 387, 400, 149, 346, 363, 364, 0},
-    {388, 390, 401, 150, 351, 365, 366, 0},
-    {391, 393, 402, 151, 354, 367, 368, 0},
-    {394, 396, 403, 152, 357, 369, 370, 0},
-    {397, 399, 404, 153, 360, 371, 372, 0},
-    {405, 406, 407, 154, 373, 374, 375, 0},
-    {408, 409, 410, 155, 376, 377, 378, 0},
-    {411, 412, 413, 156, 379, 380, 381, 0},
-    {414, 415, 416, 157, 382, 383, 384, 0},
-    {417, 418, 419, 158, 385, 386, 387, 0},
-    {419, 416, 420, 159, 388, 389, 390, 0},
-    {419, 418, 416, 160, 388, 386, 384, 0},
-    {418, 414, 416, 161, 391, 392, 384, 0},
-    {416, 413, 420, 162, 393, 394, 390, 0},
-    {416, 415, 413, 163, 393, 383, 381, 0},
-    {415, 411, 413, 164, 395, 396, 381, 0},
-    {413, 410, 420, 165, 397, 398, 390, 0},
-    {413, 412, 410, 166, 397, 380, 378, 0},
-    {412, 408, 410, 167, 399, 400, 378, 0},
-    {410, 407, 420, 168, 401, 402, 390, 0},
-    {410, 409, 407, 169, 401, 377, 375, 0},
-    {409, 405, 407, 170, 403, 404, 375, 0},
-    {407, 419, 420, 171, 405, 406, 390, 0},
-    {407, 406, 419, 172, 405, 374, 387, 0},
-    {406, 417, 419, 173, 407, 408, 387, 0},
-    {404, 418, 417, 174, 409, 386, 410, 0},
-    {404, 399, 418, 175, 409, 371, 411, 0},
-    {399, 414, 418, 176, 412, 392, 411, 0},
-    {403, 415, 414, 177, 413, 383, 414, 0},
-    {403, 396, 415, 178, 413, 369, 415, 0},
-    {396, 411, 415, 179, 416, 396, 415, 0},
-    {402, 412, 411, 180, 417, 380, 418, 0},
-    {402, 393, 412, 181, 417, 367, 419, 0},
-    {393, 408, 412, 182, 420, 400, 419, 0},
-    {401, 409, 408, 183, 421, 377, 422, 0},
-    {401, 390, 409, 184, 421, 365, 423, 0},
-    {390, 405, 409, 185, 424, 404, 423, 0},
-    {400, 406, 405, 186, 425, 374, 426, 0},
-    {400, 387, 406, 187, 425, 363, 427, 0},
-    {387, 417, 406, 188, 428, 408, 427, 0},
-    {399, 403, 414, 189, 412, 429, 414, 0},
-    {399, 398, 403, 190, 412, 361, 370, 0},
-    {398, 394, 403, 191, 430, 431, 370, 0},
-    {396, 402, 411, 192, 416, 432, 418, 0},
-    {396, 395, 402, 193, 416, 358, 368, 0},
-    {395, 391, 402, 194, 433, 434, 368, 0},
-    {393, 401, 408, 195, 420, 435, 422, 0},
-    {393, 392, 401, 196, 420, 355, 366, 0},
-    {392, 388, 401, 197, 436, 437, 366, 0},
-    {390, 400, 405, 198, 424, 438, 426, 0},
-    {390, 389, 400, 199, 424, 352, 364, 0},
-    {389, 384, 400, 200, 439, 440, 364, 0},
-    {387, 404, 417, 201, 428, 441, 410, 0},
-    {387, 386, 404, 202, 428, 349, 372, 0},
-    {386, 397, 404, 203, 442, 443, 372, 0},
-    {421, 398, 397, 204, 444, 361, 445, 0},
-    {423, 425, 398, 205, 446, 447, 448, 0},
-    {425, 394, 398, 206, 449, 431, 450, 0},
-    {425, 395, 394, 207, 449, 358, 451, 0},
-    {427, 429, 395, 208, 452, 453, 454, 0},
-    {429, 391, 395, 209, 455, 434, 456, 0},
-    {429, 392, 391, 210, 455, 355, 457, 0},
-    {431, 433, 392, 211, 458, 459, 460, 0},
-    {433, 388, 392, 212, 461, 437, 462, 0},
-    {386, 421, 397, 213, 442, 463, 445, 0},
-    {386, 435, 421, 214, 464, 465, 466, 0},
-    {385, 1586, 434, 215, 467, 468, 469, 0},
-    {433, 389, 388, 216, 461, 352, 470, 0},
-    {439, 385, 389, 217, 471, 472, 473, 0},
-    {385, 384, 389, 218, 467, 440, 474, 0},
-    {1820, 429, 441, 219, 475, 476, 477, 0},
-    {1823, 433, 432, 220, 478, 479, 480, 0},
-    {1803, 425, 443, 221, 481, 482, 483, 0},
-    {1593, 429, 428, 222, 484, 476, 485, 0},
-    {1554, 421, 436, 215, 486, 487, 488, 0},
-    {1846, 433, 442, 223, 489, 479, 490, 0},
-    {1848, 385, 440, 224, 491, 492, 493, 0},
-    {1600, 421, 444, 225, 494, 487, 495, 0},
-    {1552, 425, 424, 226, 496, 482, 497, 0},
-    {506, 501, 504, 227, 498, 499, 500, 0},
-    {498, 494, 496, 228, 501, 502, 503, 0},
-    {480, 474, 484, 229, 504, 505, 506, 0},
-    {63, 59, 65, 230, 507, 508, 509, 0},
-    {613, 617, 615, 231, 510, 121, 511, 0},
-    {563, 561, 552, 232, 512, 513, 514, 0},
-    {621, 623, 627, 233, 515, 516, 517, 0},
-    {525, 523, 521, 234, 518, 519, 520, 0},
-    {519, 525, 517, 235, 521, 522, 523, 0},
-    {15, 26, 30, 236, 524, 525, 526, 0},
-    {0, 17, 12, 237, 527, 528, 529, 0},
-    {619, 623, 621, 238, 530, 516, 531, 0},
-    {550, 558, 560, 239, 532, 83, 98, 0},
-    {506, 504, 508, 240, 498, 533, 534, 0},
-    {512, 516, 514, 241, 535, 536, 29, 0},
-    {12, 13, 2, 242, 537, 538, 539, 0},
-    {41, 37, 33, 243, 540, 541, 542, 0},
-    {22, 30, 34, 244, 543, 544, 545, 0},
-    {605, 607, 609, 245, 24, 60, 546, 0},
-    {615, 623, 619, 246, 547, 516, 548, 0},
-    {554, 563, 552, 247, 126, 549, 514, 0},
-    {13, 14, 2, 248, 550, 551, 539, 0},
-    {34, 36, 28, 249, 552, 553, 554, 0},
-    {626, 622, 620, 250, 555, 556, 557, 0},
-    {488, 492, 486, 251, 558, 559, 560, 0},
-    {638, 640, 630, 252, 561, 562, 563, 0},
-    {493, 499, 495, 253, 564, 91, 565, 0},
-    {46, 44, 48, 254, 151, 566, 567, 0},
-    {582, 576, 584, 255, 38, 568, 569, 0},
-    {543, 545, 539, 256, 570, 571, 572, 0},
-    {530, 529, 528, 257, 50, 573, 574, 0},
-    {462, 472, 476, 258, 575, 576, 577, 0},
-    {590, 586, 592, 259, 578, 579, 2, 0},
-    {50, 57, 55, 260, 580, 581, 582, 0},
-    {570, 564, 578, 261, 583, 584, 585, 0},
-    {542, 537, 532, 262, 586, 587, 588, 0},
-    {513, 519, 515, 263, 589, 590, 591, 0},
-    {531, 526, 524, 264, 592, 593, 594, 0},
-    {481, 477, 467, 265, 595, 596, 78, 0},
-    {633, 638, 628, 266, 597, 598, 599, 0},
-    {22, 34, 28, 267, 543, 600, 554, 0},
-    {595, 598, 601, 268, 601, 602, 603, 0},
-    {505, 503, 500, 269, 604, 605, 606, 0},
-    {625, 629, 632, 270, 607, 608, 609, 0},
-    {597, 594, 599, 271, 102, 610, 611, 0},
-    {491, 487, 485, 272, 612, 613, 614, 0},
-    {616, 610, 612, 273, 615, 616, 617, 0},
-    {473, 479, 483, 274, 618, 619, 620, 0},
-    {87, 89, 79, 275, 621, 622, 623, 0},
-    {497, 500, 503, 276, 624, 625, 626, 0},
-    {576, 580, 584, 277, 627, 628, 569, 0},
-    {498, 496, 502, 278, 501, 629, 630, 0},
-    {601, 596, 595, 279, 631, 632, 633, 0},
-    {489, 495, 491, 280, 634, 635, 72, 0},
-    {643, 636, 642, 281, 636, 57, 637, 0},
-    {501, 498, 502, 282, 638, 639, 630, 0},
-    {490, 492, 496, 283, 640, 559, 503, 0},
-    {538, 540, 546, 284, 641, 642, 643, 0},
-    {468, 462, 476, 285, 53, 19, 577, 0},
-    {591, 595, 596, 286, 644, 645, 646, 0},
-    {607, 611, 609, 287, 647, 648, 546, 0},
-    {21, 11, 25, 288, 123, 649, 650, 0},
-    {597, 600, 602, 289, 102, 651, 652, 0},
-    {539, 545, 547, 290, 653, 571, 116, 0},
-    {67, 63, 71, 291, 654, 655, 656, 0},
-    {617, 623, 615, 292, 657, 516, 511, 0},
-    {55, 57, 61, 293, 658, 581, 46, 0},
-    {474, 468, 482, 294, 659, 660, 661, 0},
-    {596, 593, 591, 295, 662, 663, 664, 0},
-    {594, 592, 599, 296, 0, 665, 611, 0},
-    {581, 579, 571, 297, 666, 667, 141, 0},
-    {8, 18, 20, 298, 668, 669, 670, 0},
-    {571, 577, 581, 299, 12, 671, 672, 0},
-    {480, 484, 488, 300, 504, 673, 674, 0},
-    {533, 529, 541, 301, 675, 573, 676, 0},
-    {554, 556, 567, 302, 126, 677, 678, 0},
-    {529, 530, 536, 303, 679, 680, 681, 0},
-    {543, 539, 535, 304, 570, 115, 682, 0},
-    {10, 20, 24, 305, 683, 684, 685, 0},
-    {547, 546, 540, 306, 686, 687, 688, 0},
-    {525, 530, 523, 307, 518, 680, 52, 0},
-    {14, 16, 1, 308, 689, 690, 691, 0},
-    {457, 459, 471, 309, 692, 149, 75, 0},
-    {526, 518, 522, 310, 693, 694, 695, 0},
-    {509, 511, 507, 311, 33, 696, 697, 0},
-    {479, 485, 487, 312, 698, 699, 700, 0},
-    {494, 490, 496, 313, 701, 702, 503, 0},
-    {489, 493, 495, 314, 634, 703, 565, 0},
-    {68, 74, 66, 315, 704, 705, 706, 0},
-    {505, 509, 507, 316, 604, 707, 697, 0},
-    {47, 51, 49, 53, 708, 709, 710, 0},
-    {577, 583, 585, 317, 711, 112, 89, 0},
-    {1, 16, 4, 318, 712, 690, 713, 0},
-    {614, 618, 622, 319, 714, 715, 43, 0},
-    {514, 510, 512, 320, 716, 717, 718, 0},
-    {534, 538, 544, 321, 719, 720, 721, 0},
-    {553, 551, 562, 322, 722, 723, 66, 0},
-    {548, 552, 561, 323, 724, 725, 726, 0},
-    {532, 534, 542, 324, 727, 728, 729, 0},
-    {480, 488, 486, 325, 504, 730, 560, 0},
-    {468, 478, 482, 326, 53, 731, 661, 0},
-    {490, 486, 492, 327, 640, 732, 733, 0},
-    {462, 461, 464, 328, 575, 734, 735, 0},
-    {546, 544, 538, 329, 736, 737, 738, 0},
-    {462, 466, 470, 330, 575, 739, 740, 0},
-    {60, 58, 64, 331, 99, 741, 107, 0},
-    {76, 78, 88, 332, 742, 743, 744, 0},
-    {82, 84, 94, 333, 745, 746, 747, 0},
-    {593, 589, 587, 334, 748, 88, 113, 0},
-    {631, 639, 637, 335, 749, 750, 751, 0},
-    {580, 576, 570, 336, 752, 568, 753, 0},
-    {66, 74, 70, 337, 754, 705, 755, 0},
-    {606, 604, 608, 338, 756, 757, 758, 0},
-    {637, 632, 629, 339, 759, 760, 761, 0},
-    {641, 639, 635, 340, 762, 750, 763, 0},
-    {497, 499, 493, 341, 624, 91, 764, 0},
-    {83, 91, 93, 342, 765, 766, 139, 0},
-    {591, 593, 587, 343, 644, 663, 113, 0},
-    {577, 585, 581, 344, 711, 767, 672, 0},
-    {624, 621, 627, 345, 768, 769, 517, 0},
-    {525, 521, 517, 346, 518, 770, 523, 0},
-    {640, 642, 634, 347, 771, 772, 58, 0},
-    {555, 566, 568, 348, 773, 774, 775, 0},
-    {610, 606, 608, 349, 776, 777, 758, 0},
-    {474, 482, 484, 350, 659, 778, 506, 0},
-    {611, 613, 609, 351, 120, 779, 546, 0},
-    {600, 604, 602, 352, 780, 757, 652, 0},
-    {501, 502, 504, 353, 638, 781, 500, 0},
-    {505, 507, 503, 354, 604, 782, 626, 0},
-    {15, 24, 26, 355, 524, 783, 784, 0},
-    {78, 82, 90, 356, 785, 786, 787, 0},
-    {47, 50, 51, 357, 708, 788, 789, 0},
-    {575, 573, 565, 358, 790, 791, 14, 0},
-    {526, 520, 518, 359, 693, 28, 792, 0},
-    {451, 452, 461, 360, 793, 794, 23, 0},
-    {460, 461, 452, 361, 795, 734, 796, 0},
-    {628, 624, 633, 362, 797, 798, 799, 0},
-    {556, 569, 567, 363, 800, 801, 678, 0},
-    {510, 508, 512, 364, 802, 803, 718, 0},
-    {598, 603, 601, 365, 804, 805, 603, 0},
-    {643, 635, 636, 366, 636, 806, 807, 0},
-    {629, 631, 637, 367, 808, 809, 751, 0},
-    {572, 574, 564, 368, 810, 811, 812, 0},
-    {458, 456, 461, 369, 813, 62, 23, 0},
-    {467, 473, 481, 370, 814, 815, 816, 0},
-    {630, 628, 638, 371, 817, 818, 819, 0},
-    {518, 520, 516, 372, 820, 28, 821, 0},
-    {557, 572, 564, 373, 822, 823, 812, 0},
-    {556, 559, 569, 374, 800, 824, 825, 0},
-    {465, 463, 453, 375, 826, 827, 828, 0},
-    {75, 81, 73, 376, 829, 830, 831, 0},
-    {11, 23, 25, 377, 832, 833, 650, 0},
-    {87, 79, 77, 378, 621, 834, 835, 0},
-    {42, 40, 44, 379, 836, 837, 838, 0},
-    {559, 565, 573, 380, 839, 840, 841, 0},
-    {557, 555, 568, 381, 822, 842, 775, 0},
-    {45, 41, 43, 382, 843, 844, 845, 0},
-    {549, 550, 560, 383, 846, 847, 98, 0},
-    {452, 450, 460, 384, 848, 849, 850, 0},
-    {510, 506, 508, 385, 802, 851, 534, 0},
-    {462, 464, 466, 386, 575, 852, 853, 0},
-    {32, 36, 40, 387, 854, 553, 855, 0},
-    {89, 91, 83, 388, 856, 766, 857, 0},
-    {550, 548, 558, 389, 532, 858, 859, 0},
-    {555, 553, 566, 390, 773, 860, 861, 0},
-    {610, 608, 612, 391, 776, 862, 617, 0},
-    {541, 543, 535, 392, 863, 864, 682, 0},
-    {524, 526, 522, 393, 865, 593, 695, 0},
-    {544, 542, 534, 394, 866, 867, 868, 0},
-    {541, 535, 533, 395, 863, 869, 870, 0},
-    {559, 573, 569, 396, 839, 791, 825, 0},
-    {513, 515, 511, 397, 589, 871, 35, 0},
-    {475, 459, 467, 398, 872, 149, 78, 0},
-    {519, 517, 515, 399, 521, 873, 591, 0},
-    {450, 453, 463, 400, 874, 875, 876, 0},
-    {62, 70, 64, 401, 877, 878, 107, 0},
-    {574, 578, 564, 402, 879, 880, 812, 0},
-    {635, 639, 631, 403, 881, 750, 882, 0},
-    {455, 457, 469, 404, 36, 74, 883, 0},
-    {578, 580, 570, 405, 884, 628, 753, 0},
-    {536, 541, 529, 406, 885, 886, 887, 0},
-    {531, 524, 527, 407, 592, 888, 8, 0},
-    {634, 630, 640, 408, 889, 890, 891, 0},
-    {557, 568, 572, 409, 822, 892, 893, 0},
-    {643, 641, 635, 410, 636, 894, 763, 0},
-    {553, 562, 566, 411, 722, 895, 861, 0},
-    {604, 606, 602, 412, 896, 777, 652, 0},
-    {462, 470, 472, 413, 575, 897, 898, 0},
-    {1, 2, 14, 414, 712, 899, 900, 0},
-    {9, 19, 7, 415, 901, 124, 902, 0},
-    {94, 92, 82, 416, 903, 904, 905, 0},
-    {53, 46, 52, 417, 15, 906, 153, 0},
-    {47, 49, 45, 418, 708, 907, 908, 0},
-    {88, 80, 76, 419, 909, 910, 911, 0},
-    {75, 73, 69, 420, 829, 912, 913, 0},
-    {35, 31, 23, 421, 914, 915, 916, 0},
-    {65, 71, 63, 422, 917, 918, 919, 0},
-    {71, 75, 67, 423, 920, 921, 922, 0},
-    {3, 5, 17, 424, 923, 924, 925, 0},
-    {10, 8, 20, 425, 683, 926, 670, 0},
-    {22, 15, 30, 426, 543, 927, 526, 0},
-    {15, 10, 24, 427, 524, 928, 685, 0},
-    {50, 55, 51, 428, 580, 45, 789, 0},
-    {23, 29, 35, 429, 929, 930, 931, 0},
-    {46, 42, 44, 430, 151, 932, 838, 0},
-    {39, 43, 41, 431, 933, 934, 935, 0},
-    {8, 6, 18, 432, 668, 936, 937, 0},
-    {70, 62, 66, 433, 938, 106, 706, 0},
-    {87, 77, 81, 434, 621, 939, 940, 0},
-    {89, 83, 79, 435, 856, 138, 623, 0},
-    {90, 88, 78, 436, 941, 942, 943, 0},
-    {0, 3, 17, 437, 527, 944, 925, 0},
-    {9, 11, 19, 438, 901, 649, 945, 0},
-    {4, 16, 6, 439, 946, 690, 947, 0},
-    {93, 95, 85, 440, 948, 949, 950, 0},
-    {33, 39, 41, 441, 951, 952, 935, 0},
-    {80, 74, 72, 442, 953, 705, 954, 0},
-    {92, 90, 82, 443, 955, 956, 905, 0},
-    {37, 35, 29, 444, 957, 958, 959, 0},
-    {31, 27, 23, 445, 960, 961, 916, 0},
-    {81, 77, 73, 446, 962, 939, 831, 0},
-    {38, 32, 40, 447, 963, 964, 855, 0},
-    {5, 7, 19, 448, 965, 966, 945, 0},
-    {6, 16, 18, 449, 967, 690, 937, 0},
-    {56, 53, 54, 450, 968, 969, 17, 0},
-    {61, 65, 59, 451, 970, 971, 972, 0},
-    {60, 56, 54, 452, 99, 973, 17, 0},
-    {27, 25, 23, 453, 974, 975, 916, 0},
-    {5, 19, 17, 454, 965, 124, 925, 0},
-    {0, 12, 2, 455, 527, 976, 539, 0},
-    {95, 94, 84, 456, 977, 978, 979, 0},
-    {42, 38, 40, 457, 836, 980, 855, 0},
-    {29, 33, 37, 458, 981, 982, 983, 0},
-    {43, 47, 45, 459, 984, 985, 908, 0},
-    {74, 68, 72, 460, 986, 987, 954, 0},
-    {32, 28, 36, 461, 854, 988, 989, 0},
-    {398, 421, 422, 462, 448, 990, 991, 0},
-    {1798, 425, 423, 463, 992, 447, 446, 0},
-    {398, 1675, 423, 464, 448, 993, 446, 0},
-    {395, 425, 426, 465, 454, 994, 995, 0},
-    {1326, 429, 427, 466, 996, 453, 452, 0},
-    {395, 1239, 427, 467, 454, 997, 452, 0},
-    {392, 429, 430, 468, 460, 998, 999, 0},
-    {977, 433, 431, 469, 1000, 459, 458, 0},
-    {392, 1694, 431, 470, 460, 1001, 458, 0},
-    {386, 385, 434, 471, 464, 1002, 1003, 0},
-    {844, 421, 435, 472, 1004, 466, 465, 0},
-    {386, 1706, 435, 473, 464, 1005, 465, 0},
-    {389, 433, 438, 474, 473, 1006, 1007, 0},
-    {1738, 385, 439, 475, 1008, 472, 471, 0},
-    {389, 1656, 439, 476, 473, 1009, 471, 0},
-    {1398, 1969, 1451, 477, 1010, 1011, 1012, 0},
-    {2060, 1263, 879, 478, 1013, 1014, 1015, 0},
-    {1530, 1449, 1856, 479, 1016, 1017, 1018, 0},
-    {1170, 1495, 1857, 480, 1019, 1020, 1021, 0},
-    {1440, 1764, 1859, 481, 1022, 1023, 1024, 0},
-    {1350, 1673, 1861, 482, 1025, 1026, 1027, 0},
-    {990, 998, 1862, 483, 1028, 1029, 1030, 0},
-    {900, 1501, 1863, 482, 1031, 1032, 1033, 0},
-    {1260, 1581, 1865, 484, 1034, 1035, 1036, 0},
-    {1309, 1630, 1867, 485, 1037, 1038, 1039, 0},
-    {1489, 1813, 1869, 482, 1040, 1041, 1042, 0},
-    {1129, 996, 1871, 486, 1043, 1044, 1045, 0},
-    {1433, 1253, 1053, 487, 1046, 1047, 1048, 0},
-    {1080, 1202, 1873, 488, 1049, 1050, 1051, 0},
-    {2059, 1019, 1465, 489, 1052, 1053, 1054, 0},
-    {1382, 1726, 1877, 482, 1055, 1056, 1057, 0},
-    {1530, 1635, 1715, 490, 1016, 1058, 1059, 0},
-    {949, 1707, 1661, 491, 1060, 1061, 1062, 0},
-    {949, 1362, 1882, 492, 1060, 1063, 1064, 0},
-    {1514, 1533, 1776, 493, 1065, 1066, 1067, 0},
-    {900, 1863, 1611, 494, 1031, 1033, 1068, 0},
-    {949, 1882, 1707, 482, 1060, 1064, 1061, 0},
-    {932, 1065, 1659, 495, 1069, 1070, 1071, 0},
-    {1846, 1732, 2058, 496, 1072, 1073, 1074, 0},
-    {1112, 1782, 1699, 482, 1075, 1076, 1077, 0},
-    {1382, 1693, 1726, 482, 1055, 1078, 1056, 0},
-    {1472, 1551, 1703, 486, 1079, 1080, 1081, 0},
-    {1064, 1442, 1834, 497, 1082, 1083, 1084, 0},
-    {884, 1728, 1677, 498, 1085, 1086, 1087, 0},
-    {974, 1617, 1676, 482, 1088, 1089, 1090, 0},
-    {1820, 1958, 2057, 499, 1091, 1092, 1093, 0},
-    {1424, 1262, 1829, 500, 1094, 1095, 1096, 0},
-    {1334, 1536, 1486, 501, 1097, 1098, 1099, 0},
-    {1150, 965, 1885, 502, 1100, 1101, 1102, 0},
-    {1420, 1744, 1887, 503, 1103, 1104, 1105, 0},
-    {1330, 1653, 1889, 504, 1106, 1107, 1108, 0},
-    {1060, 930, 1890, 505, 1109, 1110, 1111, 0},
-    {1467, 1791, 1892, 506, 1112, 1113, 1114, 0},
-    {970, 1237, 1894, 507, 1115, 1116, 1117, 0},
-    {880, 1146, 1895, 508, 1118, 1119, 1120, 0},
-    {1107, 1164, 1897, 509, 1121, 1122, 1123, 0},
-    {1287, 1608, 1899, 510, 1124, 1125, 1126, 0},
-    {1240, 1561, 1901, 511, 1127, 1128, 1129, 0},
-    {2056, 1008, 1825, 512, 1130, 1131, 1132, 0},
-    {1510, 838, 1642, 513, 1133, 1134, 1135, 0},
-    {431, 1839, 977, 514, 1136, 1137, 1138, 0},
-    {1019, 1850, 1907, 515, 1053, 1139, 1140, 0},
-    {927, 1668, 1643, 516, 1141, 1142, 1143, 0},
-    {927, 1759, 1668, 517, 1141, 1144, 1142, 0},
-    {1379, 1111, 1492, 518, 1145, 1146, 1147, 0},
-    {2055, 1038, 1757, 519, 1148, 1149, 1150, 0},
-    {927, 1179, 1759, 520, 1141, 1151, 1144, 0},
-    {1512, 1824, 1729, 521, 1152, 1153, 1154, 0},
-    {1109, 1900, 1351, 522, 1155, 1156, 1157, 0},
-    {929, 1912, 1415, 523, 1158, 1159, 1160, 0},
-    {1287, 1899, 1808, 524, 1124, 1126, 1161, 0},
-    {880, 1895, 1619, 525, 1118, 1120, 1162, 0},
-    {1420, 1887, 955, 526, 1103, 1105, 1163, 0},
-    {1467, 1892, 1686, 527, 1112, 1114, 1164, 0},
-    {1060, 1890, 1547, 528, 1109, 1111, 1165, 0},
-    {1906, 1936, 2054, 529, 1166, 1167, 1168, 0},
-    {1240, 1901, 1475, 530, 1127, 1129, 1169, 0},
-    {1332, 1718, 1711, 531, 1170, 1171, 1172, 0},
-    {1512, 1729, 1054, 532, 1152, 1154, 1173, 0},
-    {1600, 1847, 2053, 533, 1174, 1175, 1176, 0},
-    {1332, 1655, 1914, 534, 1177, 1178, 1179, 0},
-    {1062, 1478, 1916, 535, 1180, 1181, 1182, 0},
-    {972, 1527, 1918, 536, 1183, 1184, 1185, 0},
-    {1422, 1746, 1921, 537, 1186, 1187, 1188, 0},
-    {1469, 1793, 1923, 538, 1189, 1190, 1191, 0},
-    {1242, 1563, 1925, 539, 1192, 1193, 1194, 0},
-    {882, 903, 1927, 540, 1195, 1196, 1197, 0},
-    {1289, 1610, 1929, 541, 1198, 1199, 1200, 0},
-    {1019, 911, 1931, 542, 1201, 1202, 1203, 0},
-    {929, 1415, 1933, 543, 1204, 1205, 1206, 0},
-    {1152, 994, 1625, 544, 1207, 1208, 1209, 0},
-    {1512, 1920, 1731, 545, 1210, 1211, 1212, 0},
-    {2052, 1017, 1806, 546, 1213, 1214, 1215, 0},
-    {1109, 1351, 1938, 547, 1216, 1217, 1218, 0},
-    {1379, 1702, 1940, 548, 1219, 1220, 1221, 0},
-    {989, 1709, 1735, 549, 1222, 1223, 1224, 0},
-    {1169, 1534, 941, 550, 1225, 1226, 1227, 0},
-    {972, 1918, 1352, 551, 1183, 1185, 1228, 0},
-    {1079, 885, 1692, 552, 1229, 1230, 1231, 0},
-    {1062, 1916, 953, 553, 1180, 1182, 1232, 0},
-    {1259, 1851, 1553, 554, 1233, 1234, 1235, 0},
-    {1488, 1733, 876, 555, 1236, 1237, 1238, 0},
-    {1308, 1809, 1779, 556, 1239, 1240, 1241, 0},
-    {1398, 910, 1688, 557, 1242, 1243, 1244, 0},
-    {1128, 1427, 962, 558, 1245, 1246, 1247, 0},
-    {1469, 1923, 1713, 559, 1189, 1191, 1248, 0},
-    {428, 1326, 1906, 560, 1249, 1250, 1166, 0},
-    {1379, 1940, 1596, 561, 1219, 1221, 1251, 0},
-    {2051, 1302, 1667, 562, 1252, 1253, 1254, 0},
-    {2050, 1039, 1666, 563, 1255, 1256, 1257, 0},
-    {990, 1082, 998, 564, 1258, 1259, 1260, 0},
-    {1080, 1691, 1945, 565, 1261, 1262, 1263, 0},
-    {1489, 1027, 1947, 566, 1264, 1265, 1266, 0},
-    {1080, 1745, 1202, 567, 1261, 1267, 1268, 0},
-    {1350, 1792, 1673, 568, 1269, 1270, 1271, 0},
-    {1440, 1950, 1764, 569, 1272, 1273, 1274, 0},
-    {1259, 1402, 1954, 570, 1275, 1276, 1277, 0},
-    {1259, 1954, 1851, 571, 1275, 1277, 1278, 0},
-    {1080, 1945, 1745, 572, 1261, 1263, 1267, 0},
-    {1079, 1946, 885, 573, 1279, 1280, 1281, 0},
-    {2049, 1022, 1574, 482, 1282, 1283, 1284, 0},
-    {900, 1247, 1222, 574, 1285, 1286, 1287, 0},
-    {1489, 1947, 1723, 575, 1264, 1266, 1288, 0},
-    {1128, 1000, 1961, 576, 1289, 1290, 1291, 0},
-    {990, 1953, 1082, 577, 1258, 1292, 1259, 0},
-    {1530, 1715, 1087, 578, 1293, 1294, 1295, 0},
-    {1170, 1952, 1963, 579, 1296, 1297, 1298, 0},
-    {1309, 1769, 1630, 580, 1299, 1300, 1301, 0},
-    {1308, 1629, 1965, 581, 1302, 1303, 1304, 0},
-    {1308, 1965, 1966, 582, 1302, 1304, 1305, 0},
-    {1169, 1134, 1541, 583, 1306, 1307, 1308, 0},
-    {989, 1088, 1755, 584, 1309, 1310, 1311, 0},
-    {949, 1845, 1369, 585, 1312, 1313, 1314, 0},
-    {1399, 1093, 1968, 586, 1315, 1316, 1317, 0},
-    {1398, 1451, 910, 587, 1010, 1012, 1318, 0},
-    {1510, 1835, 1597, 588, 1133, 1319, 1320, 0},
-    {1399, 1968, 1722, 589, 1315, 1317, 1321, 0},
-    {1334, 1687, 1972, 590, 1322, 1323, 1324, 0},
-    {1240, 976, 1561, 591, 1325, 1326, 1327, 0},
-    {970, 1778, 1237, 592, 1328, 1329, 1330, 0},
-    {1424, 1730, 1978, 593, 1331, 1332, 1333, 0},
-    {1467, 847, 1980, 594, 1334, 1335, 1336, 0},
-    {1287, 1203, 1982, 595, 1337, 1338, 1339, 0},
-    {1530, 1855, 1343, 596, 1016, 1340, 1341, 0},
-    {1107, 1493, 1986, 597, 1342, 1343, 1344, 0},
-    {1377, 1268, 1988, 598, 1345, 1346, 1347, 0},
-    {1060, 1680, 930, 599, 1348, 1349, 1350, 0},
-    {927, 1643, 1992, 600, 1351, 1352, 1353, 0},
-    {1240, 1641, 976, 601, 1325, 1354, 1326, 0},
-    {880, 1719, 1810, 602, 1355, 1356, 1357, 0},
-    {1510, 1642, 1996, 603, 1358, 1359, 1360, 0},
-    {1467, 1555, 1791, 604, 1334, 1361, 1362, 0},
-    {1472, 1796, 1639, 605, 1363, 1364, 1365, 0},
-    {1472, 1981, 1551, 606, 1363, 1366, 1367, 0},
-    {1287, 1982, 1571, 607, 1337, 1339, 1368, 0},
-    {932, 1282, 1670, 608, 1369, 1370, 1371, 0},
-    {1514, 1839, 1985, 609, 1372, 1373, 1374, 0},
-    {1064, 1145, 1815, 610, 1375, 1376, 1377, 0},
-    {1064, 1990, 1442, 611, 1375, 1378, 1379, 0},
-    {1017, 1984, 842, 612, 1214, 1380, 1381, 0},
-    {974, 1517, 1548, 613, 1382, 1383, 1384, 0},
-    {1377, 1988, 1761, 614, 1345, 1347, 1385, 0},
-    {1424, 1748, 1730, 615, 1331, 1386, 1332, 0},
-    {1334, 1657, 1687, 616, 1322, 1387, 1323, 0},
-    {1154, 1373, 1602, 617, 1388, 1389, 1390, 0},
-    {424, 1798, 888, 618, 1391, 1392, 1393, 0},
-    {1510, 1996, 1936, 619, 1358, 1360, 1167, 0},
-    {888, 1054, 2048, 620, 1393, 1173, 1394, 0},
-    {436, 844, 1780, 621, 1395, 1396, 1397, 0},
-    {1529, 1644, 836, 622, 1398, 1399, 1400, 0},
-    {1512, 1837, 1665, 623, 1210, 1401, 1402, 0},
-    {1780, 836, 2047, 624, 1397, 1400, 1403, 0},
-    {1529, 1854, 1756, 625, 1404, 1405, 1406, 0},
-    {1586, 964, 2046, 626, 1407, 1408, 1409, 0},
-    {439, 1855, 1738, 627, 1410, 1411, 1412, 0},
-    {1529, 863, 1960, 628, 1404, 1413, 1414, 0},
-    {1161, 1374, 1087, 629, 1415, 1416, 1295, 0},
-    {1161, 1568, 1374, 630, 1415, 1417, 1416, 0},
-    {945, 964, 1799, 631, 1418, 1408, 1419, 0},
-    {1076, 1775, 1784, 632, 1420, 1421, 1422, 0},
-    {1076, 1545, 1775, 633, 1420, 1423, 1421, 0},
-    {1406, 1920, 1201, 634, 1424, 1211, 1425, 0},
-    {1412, 1583, 1640, 635, 1426, 1427, 1428, 0},
-    {1412, 1106, 1583, 636, 1426, 1429, 1427, 0},
-    {1137, 1828, 1681, 637, 1430, 1431, 1432, 0},
-    {1389, 1589, 2000, 638, 1433, 1434, 1435, 0},
-    {1389, 1697, 1589, 639, 1433, 1436, 1434, 0},
-    {1460, 1533, 1605, 640, 1437, 1438, 1439, 0},
-    {1130, 1741, 1973, 641, 1440, 1441, 1442, 0},
-    {1130, 1650, 1741, 642, 1440, 1443, 1441, 0},
-    {1523, 1716, 1566, 643, 1444, 1445, 1446, 0},
-    {860, 1797, 1979, 644, 1447, 1448, 1449, 0},
-    {860, 1590, 1797, 645, 1447, 1450, 1448, 0},
-    {1483, 1617, 1773, 646, 1451, 1452, 1453, 0},
-    {1047, 1295, 1993, 647, 1454, 1455, 1456, 0},
-    {1047, 940, 1295, 648, 1454, 1457, 1455, 0},
-    {1004, 1620, 845, 649, 1458, 1459, 1460, 0},
-    {1175, 864, 1977, 650, 1461, 1462, 1463, 0},
-    {1175, 1515, 864, 651, 1461, 1464, 1462, 0},
-    {1121, 1536, 1178, 652, 1465, 1466, 1467, 0},
-    {914, 1186, 1989, 653, 1468, 1469, 1470, 0},
-    {914, 933, 1186, 654, 1468, 1471, 1469, 0},
-    {1340, 1712, 1257, 655, 1472, 1473, 1474, 0},
-    {960, 875, 1565, 656, 1475, 1476, 1477, 0},
-    {960, 947, 875, 656, 1475, 1478, 1476, 0},
-    {1274, 1680, 1786, 657, 1479, 1349, 1480, 0},
-    {1454, 1556, 1991, 658, 1481, 1482, 1483, 0},
-    {1454, 1211, 1556, 658, 1481, 1484, 1482, 0},
-    {1125, 1262, 1853, 659, 1485, 1486, 1487, 0},
-    {867, 1383, 1992, 660, 1488, 1489, 1353, 0},
-    {867, 1762, 1383, 660, 1488, 1490, 1489, 0},
-    {1409, 1577, 1628, 661, 1491, 1492, 1493, 0},
-    {1184, 1538, 1987, 662, 1494, 1495, 1496, 0},
-    {1184, 1110, 1538, 663, 1494, 1497, 1495, 0},
-    {1265, 1462, 1604, 664, 1498, 1499, 1500, 0},
-    {1323, 1679, 839, 606, 1501, 1502, 1503, 0},
-    {1323, 1770, 1679, 665, 1501, 1504, 1502, 0},
-    {905, 1821, 883, 666, 1505, 1506, 1507, 0},
-    {1445, 1491, 1980, 605, 1508, 1509, 1336, 0},
-    {1445, 1582, 1491, 667, 1508, 1510, 1509, 0},
-    {853, 1728, 1329, 668, 1511, 1512, 1513, 0},
-    {1393, 1573, 1819, 669, 1514, 1515, 1516, 0},
-    {1393, 891, 1573, 670, 1514, 1517, 1515, 0},
-    {1209, 1998, 1550, 671, 1518, 1519, 1520, 0},
-    {1137, 1024, 1828, 672, 1430, 1521, 1431, 0},
-    {1137, 843, 1024, 673, 1430, 1522, 1521, 0},
-    {920, 988, 1532, 674, 1523, 1524, 1525, 0},
-    {1407, 1269, 1994, 675, 1526, 1527, 1528, 0},
-    {1407, 1172, 1269, 676, 1526, 1529, 1527, 0},
-    {1317, 1995, 925, 677, 1530, 1531, 1532, 0},
-    {1310, 956, 1974, 678, 1533, 1534, 1535, 0},
-    {1310, 1281, 956, 678, 1533, 1536, 1534, 0},
-    {1197, 1146, 1557, 679, 1537, 1538, 1539, 0},
-    {867, 1482, 1670, 680, 1488, 1540, 1371, 0},
-    {867, 997, 1482, 681, 1488, 1541, 1540, 0},
-    {918, 1700, 1740, 682, 1542, 1543, 1544, 0},
-    {1256, 898, 1736, 683, 1545, 1546, 1547, 0},
-    {1256, 1304, 898, 684, 1545, 1548, 1546, 0},
-    {1274, 1990, 1385, 685, 1479, 1378, 1549, 0},
-    {1004, 1832, 1620, 686, 1458, 1550, 1459, 0},
-    {1004, 1078, 1832, 687, 1458, 1551, 1550, 0},
-    {1391, 954, 1347, 688, 1552, 1553, 1554, 0},
-    {980, 1421, 1754, 689, 1555, 1556, 1557, 0},
-    {980, 1767, 1421, 689, 1555, 1558, 1556, 0},
-    {852, 1608, 1216, 690, 1559, 1560, 1561, 0},
-    {1265, 1710, 1462, 691, 1498, 1562, 1499, 0},
-    {1265, 1618, 1710, 692, 1498, 1563, 1562, 0},
-    {1096, 1179, 1559, 693, 1564, 1565, 1566, 0},
-    {1445, 1789, 1639, 694, 1508, 1567, 1365, 0},
-    {1445, 1606, 1789, 695, 1508, 1568, 1567, 0},
-    {855, 1164, 1698, 696, 1569, 1570, 1571, 0},
-    {995, 1437, 934, 697, 1572, 1573, 1574, 0},
-    {995, 1794, 1437, 698, 1572, 1575, 1573, 0},
-    {860, 1979, 952, 699, 1447, 1449, 1576, 0},
-    {1432, 1831, 1626, 700, 1577, 1578, 1579, 0},
-    {1432, 906, 1831, 701, 1577, 1580, 1578, 0},
-    {1040, 1976, 1099, 702, 1581, 1582, 1583, 0},
-    {1230, 1521, 1089, 703, 1584, 1585, 1586, 0},
-    {1230, 958, 1521, 704, 1584, 1587, 1585, 0},
-    {1310, 1974, 1522, 705, 1533, 1535, 1588, 0},
-    {840, 1293, 963, 706, 1589, 1590, 1591, 0},
-    {840, 1063, 1293, 707, 1589, 1592, 1590, 0},
-    {1130, 1973, 1165, 708, 1440, 1442, 1593, 0},
-    {1344, 1481, 1661, 709, 1594, 1595, 1596, 0},
-    {1344, 1157, 1481, 710, 1594, 1597, 1595, 0},
-    {928, 1663, 1569, 710, 1598, 1599, 1600, 0},
-    {1346, 1029, 1305, 711, 1601, 1602, 1603, 0},
-    {1346, 848, 1029, 712, 1601, 1604, 1602, 0},
-    {1198, 1970, 870, 713, 1605, 1606, 1607, 0},
-    {928, 1750, 1663, 714, 1598, 1608, 1599, 0},
-    {928, 851, 1750, 715, 1598, 1609, 1608, 0},
-    {1378, 1969, 1021, 716, 1610, 1011, 1611, 0},
-    {1468, 890, 1966, 717, 1612, 1613, 1305, 0},
-    {1468, 1817, 890, 718, 1612, 1614, 1613, 0},
-    {1108, 1967, 979, 719, 1615, 1616, 1617, 0},
-    {1459, 1248, 1944, 720, 1618, 1619, 1620, 0},
-    {1459, 1066, 1248, 721, 1618, 1621, 1619, 0},
-    {1301, 1127, 1544, 722, 1622, 1623, 1624, 0},
-    {971, 1774, 1963, 723, 1625, 1626, 1298, 0},
-    {971, 1311, 1774, 724, 1625, 1627, 1626, 0},
-    {873, 987, 1173, 725, 1628, 1629, 1630, 0},
-    {1468, 1615, 1369, 726, 1612, 1631, 1314, 0},
-    {1468, 1461, 1615, 727, 1612, 1632, 1631, 0},
-    {1241, 1678, 1466, 728, 1633, 1634, 1635, 0},
-    {1241, 902, 1678, 729, 1633, 1636, 1634, 0},
-    {1241, 1647, 902, 730, 1633, 1637, 1636, 0},
-    {1122, 1427, 1695, 731, 1638, 1639, 1640, 0},
-    {893, 1603, 1758, 732, 1641, 1642, 1643, 0},
-    {893, 1167, 1603, 733, 1641, 1644, 1642, 0},
-    {1061, 1964, 1210, 734, 1645, 1646, 1647, 0},
-    {971, 1092, 1541, 735, 1625, 1648, 1308, 0},
-    {971, 1456, 1092, 736, 1625, 1649, 1648, 0},
-    {1138, 901, 877, 737, 1650, 1651, 1652, 0},
-    {1161, 850, 1960, 738, 1415, 1653, 1414, 0},
-    {1161, 1531, 850, 738, 1415, 1654, 1653, 0},
-    {1413, 1474, 1156, 739, 1655, 1656, 1657, 0},
-    {872, 1226, 1943, 740, 1658, 1659, 1660, 0},
-    {872, 1224, 1226, 741, 1658, 1661, 1659, 0},
-    {1030, 1609, 909, 742, 1662, 1663, 1664, 0},
-    {1511, 1105, 1306, 743, 1665, 1666, 1667, 0},
-    {1511, 969, 1105, 744, 1665, 1668, 1666, 0},
-    {1190, 1733, 1572, 745, 1669, 1670, 1671, 0},
-    {1341, 1015, 1959, 746, 1672, 1673, 1674, 0},
-    {1341, 1549, 1015, 747, 1672, 1675, 1673, 0},
-    {1275, 1654, 1077, 748, 1676, 1677, 1678, 0},
-    {1120, 1802, 1956, 749, 1679, 1680, 1681, 0},
-    {1120, 1207, 1802, 750, 1679, 1682, 1680, 0},
-    {1321, 1813, 1204, 751, 1683, 1684, 1685, 0},
-    {2045, 917, 1335, 752, 1686, 1687, 1688, 0},
-    {1592, 1191, 2044, 753, 1689, 1690, 1691, 0},
-    {1683, 1430, 2043, 754, 1692, 1693, 1694, 0},
-    {1320, 1436, 1580, 755, 1695, 1696, 1697, 0},
-    {1320, 1370, 1436, 756, 1695, 1698, 1696, 0},
-    {1365, 1836, 886, 757, 1699, 1700, 1701, 0},
-    {1048, 841, 1949, 758, 1702, 1703, 1704, 0},
-    {1048, 878, 841, 759, 1702, 1705, 1703, 0},
-    {1005, 1664, 1727, 760, 1706, 1707, 1708, 0},
-    {1366, 1636, 1507, 761, 1709, 1710, 1711, 0},
-    {1366, 1818, 1636, 762, 1709, 1712, 1710, 0},
-    {1390, 1701, 1496, 763, 1713, 1714, 1715, 0},
-    {1390, 1772, 1701, 764, 1713, 1716, 1714, 0},
-    {1390, 908, 1772, 765, 1713, 1717, 1716, 0},
-    {1300, 1955, 1708, 766, 1718, 1719, 1720, 0},
-    {943, 1090, 907, 767, 1721, 1722, 1723, 0},
-    {943, 1558, 1090, 768, 1721, 1724, 1722, 0},
-    {1408, 1562, 1788, 769, 1725, 1726, 1727, 0},
-    {1188, 1852, 1528, 770, 1728, 1729, 1730, 0},
-    {1188, 1660, 1852, 771, 1728, 1731, 1729, 0},
-    {1318, 1951, 1842, 772, 1732, 1733, 1734, 0},
-    {1215, 1324, 1598, 773, 1735, 1736, 1737, 0},
-    {1215, 1838, 1324, 774, 1735, 1738, 1736, 0},
-    {1048, 1949, 897, 775, 1702, 1704, 1739, 0},
-    {1275, 1498, 1654, 776, 1676, 1740, 1677, 0},
-    {1275, 1126, 1498, 777, 1676, 1741, 1740, 0},
-    {1010, 996, 1212, 778, 1742, 1743, 1744, 0},
-    {1005, 1252, 1664, 779, 1706, 1745, 1707, 0},
-    {1005, 937, 1252, 780, 1706, 1746, 1745, 0},
-    {1500, 1581, 1616, 781, 1747, 1748, 1749, 0},
-    {1319, 1751, 1827, 782, 1750, 1751, 1752, 0},
-    {1319, 1725, 1751, 782, 1750, 1753, 1751, 0},
-    {872, 1943, 1816, 783, 1658, 1660, 1754, 0},
-    {2042, 1457, 1540, 784, 1755, 1756, 1757, 0},
-    {1327, 869, 2041, 785, 1758, 1759, 1760, 0},
-    {1814, 1447, 2040, 786, 1761, 1762, 1763, 0},
-    {1214, 1220, 1932, 787, 1764, 1765, 1766, 0},
-    {1214, 999, 1220, 788, 1764, 1767, 1765, 0},
-    {919, 1621, 1067, 789, 1768, 1769, 1770, 0},
-    {1009, 1020, 1939, 790, 1771, 1772, 1773, 0},
-    {1009, 1356, 1020, 791, 1771, 1774, 1772, 0},
-    {1525, 1358, 1632, 792, 1775, 1776, 1777, 0},
-    {1124, 1588, 1929, 793, 1778, 1779, 1200, 0},
-    {1124, 1771, 1588, 794, 1778, 1780, 1779, 0},
-    {1122, 1629, 1542, 795, 1781, 1782, 1783, 0},
-    {1394, 1646, 1931, 796, 1784, 1785, 1203, 0},
-    {1394, 1057, 1646, 797, 1784, 1786, 1785, 0},
-    {1346, 1305, 1086, 798, 1787, 1788, 1789, 0},
-    {854, 1627, 1933, 799, 1790, 1791, 1206, 0},
-    {854, 1023, 1627, 800, 1790, 1792, 1791, 0},
-    {1162, 1228, 950, 801, 1793, 1794, 1795, 0},
-    {1189, 1333, 1938, 802, 1796, 1797, 1218, 0},
-    {1189, 1840, 1333, 803, 1796, 1798, 1797, 0},
-    {1190, 1000, 1658, 804, 1799, 1800, 1801, 0},
-    {1255, 1614, 1927, 805, 1802, 1803, 1197, 0},
-    {1255, 1704, 1614, 806, 1802, 1804, 1803, 0},
-    {1366, 1507, 1612, 807, 1805, 1806, 1807, 0},
-    {1075, 1795, 1926, 808, 1808, 1809, 1810, 0},
-    {1075, 1564, 1795, 809, 1808, 1811, 1809, 0},
-    {1273, 1717, 904, 810, 1812, 1813, 1814, 0},
-    {985, 856, 1925, 811, 1815, 1816, 1194, 0},
-    {985, 1368, 856, 812, 1815, 1817, 1816, 0},
-    {1320, 1580, 1271, 813, 1818, 1819, 1820, 0},
-    {1136, 1131, 1922, 814, 1821, 1822, 1823, 0},
-    {1136, 1476, 1131, 815, 1821, 1824, 1822, 0},
-    {866, 1168, 1684, 816, 1825, 1826, 1827, 0},
-    {1003, 1747, 1914, 817, 1828, 1829, 1179, 0},
-    {1003, 923, 1747, 818, 1828, 1830, 1829, 0},
-    {1524, 1672, 1397, 819, 1831, 1832, 1833, 0},
-    {1316, 975, 1921, 820, 1834, 1835, 1188, 0},
-    {1316, 1724, 975, 821, 1834, 1836, 1835, 0},
-    {1123, 1763, 1502, 822, 1837, 1838, 1839, 0},
-    {919, 1396, 1621, 823, 1768, 1840, 1769, 0},
-    {919, 874, 1396, 824, 1768, 1841, 1840, 0},
-    {1278, 1734, 1034, 825, 1842, 1843, 1844, 0},
-    {1189, 1180, 876, 826, 1796, 1845, 1238, 0},
-    {1189, 1497, 1180, 827, 1796, 1846, 1845, 0},
-    {1143, 1781, 992, 828, 1847, 1848, 1849, 0},
-    {2039, 1187, 1042, 829, 1850, 1851, 1852, 0},
-    {1243, 1238, 2038, 830, 1853, 1854, 1855, 0},
-    {1712, 1357, 2037, 831, 1473, 1856, 1857, 0},
-    {1322, 991, 1935, 832, 1858, 1859, 1860, 0},
-    {1322, 1480, 991, 833, 1858, 1861, 1859, 0},
-    {1406, 1644, 938, 834, 1424, 1399, 1862, 0},
-    {913, 921, 1915, 835, 1863, 1864, 1865, 0},
-    {913, 1227, 921, 836, 1863, 1866, 1864, 0},
-    {1280, 1824, 1375, 837, 1867, 1868, 1869, 0},
-    {854, 1381, 1779, 838, 1790, 1870, 1241, 0},
-    {854, 1425, 1381, 839, 1790, 1871, 1870, 0},
-    {1049, 1760, 1223, 840, 1872, 1873, 1874, 0},
-    {1394, 1245, 1688, 841, 1784, 1875, 1244, 0},
-    {1394, 1299, 1245, 842, 1784, 1876, 1875, 0},
-    {1031, 1111, 1174, 843, 1877, 1878, 1879, 0},
-    {1124, 1417, 962, 844, 1778, 1880, 1247, 0},
-    {1124, 1261, 1417, 845, 1778, 1881, 1880, 0},
-    {1032, 1599, 926, 844, 1882, 1883, 1884, 0},
-    {1255, 1288, 1553, 846, 1802, 1885, 1235, 0},
-    {1255, 1016, 1288, 847, 1802, 1886, 1885, 0},
-    {1219, 1714, 1337, 848, 1887, 1888, 1889, 0},
-    {985, 1303, 1692, 849, 1815, 1890, 1231, 0},
-    {985, 1117, 1303, 850, 1815, 1891, 1890, 0},
-    {1050, 1849, 1267, 851, 1892, 1893, 1894, 0},
-    {1525, 1266, 1358, 852, 1775, 1895, 1776, 0},
-    {1525, 1513, 1266, 852, 1775, 1896, 1895, 0},
-    {1213, 1637, 1325, 853, 1897, 1898, 1899, 0},
-    {1316, 931, 1735, 854, 1834, 1900, 1224, 0},
-    {1316, 1312, 931, 854, 1834, 1901, 1900, 0},
-    {1254, 1800, 936, 855, 1902, 1903, 1904, 0},
-    {866, 1487, 1168, 856, 1825, 1905, 1826, 0},
-    {866, 1114, 1487, 857, 1825, 1906, 1905, 0},
-    {1072, 1718, 973, 858, 1907, 1908, 1909, 0},
-    {1273, 1372, 1717, 859, 1812, 1910, 1813, 0},
-    {1273, 1251, 1372, 860, 1812, 1911, 1910, 0},
-    {1485, 1085, 1181, 861, 1912, 1913, 1914, 0},
-    {1003, 1056, 941, 862, 1828, 1915, 1227, 0},
-    {1003, 1151, 1056, 863, 1828, 1916, 1915, 0},
-    {1163, 1624, 1171, 544, 1917, 1918, 1919, 0},
-    {1139, 915, 1645, 864, 1920, 1921, 1922, 0},
-    {1139, 861, 915, 865, 1920, 1923, 1921, 0},
-    {1339, 1904, 1041, 866, 1924, 1925, 1926, 0},
-    {1313, 1587, 1894, 867, 1927, 1928, 1117, 0},
-    {1313, 1371, 1587, 868, 1927, 1929, 1928, 0},
-    {1072, 1527, 1229, 869, 1930, 1931, 1932, 0},
-    {1294, 1185, 1896, 870, 1933, 1934, 1935, 0},
-    {1294, 1410, 1185, 871, 1933, 1936, 1934, 0},
-    {1176, 1777, 1149, 872, 1937, 1938, 1939, 0},
-    {1441, 1160, 1902, 873, 1940, 1941, 1942, 0},
-    {1441, 1081, 1160, 873, 1940, 1943, 1941, 0},
-    {1516, 1753, 1091, 874, 1944, 1945, 1946, 0},
-    {1246, 1044, 1898, 875, 1947, 1948, 1949, 0},
-    {1246, 1471, 1044, 876, 1947, 1950, 1948, 0},
-    {1270, 1570, 1043, 877, 1951, 1952, 1953, 0},
-    {1360, 916, 1891, 878, 1954, 1955, 1956, 0},
-    {1360, 1083, 916, 879, 1954, 1957, 1955, 0},
-    {1380, 1765, 1249, 880, 1958, 1959, 1960, 0},
-    {1403, 1084, 1893, 881, 1961, 1962, 1963, 0},
-    {1403, 1205, 1084, 882, 1961, 1964, 1962, 0},
-    {1384, 1113, 1231, 883, 1965, 1966, 1967, 0},
-    {1183, 1033, 1913, 884, 1968, 1969, 1970, 0},
-    {1183, 1208, 1033, 885, 1968, 1971, 1969, 0},
-    {1236, 1206, 1297, 886, 1972, 1973, 1974, 0},
-    {1049, 1166, 1760, 887, 1975, 1976, 1977, 0},
-    {1049, 1100, 1166, 523, 1975, 1978, 1976, 0},
-    {1028, 1576, 1446, 888, 1979, 1980, 1981, 0},
-    {1143, 1578, 1781, 889, 1982, 1983, 1984, 0},
-    {1143, 1012, 1578, 890, 1982, 1985, 1983, 0},
-    {1463, 1594, 1455, 891, 1986, 1987, 1988, 0},
-    {1339, 1193, 1904, 521, 1924, 1989, 1925, 0},
-    {1339, 1192, 1193, 892, 1924, 1990, 1989, 0},
-    {1280, 994, 1291, 893, 1991, 1992, 1993, 0},
-    {1388, 1285, 1911, 894, 1994, 1995, 1996, 0},
-    {1388, 1147, 1285, 895, 1994, 1997, 1995, 0},
-    {1096, 1203, 1434, 896, 1998, 1999, 2000, 0},
-    {2036, 1097, 1539, 897, 2001, 2002, 2003, 0},
-    {1355, 951, 2035, 898, 2004, 2005, 2006, 0},
-    {1822, 1473, 2034, 899, 2007, 2008, 2009, 0},
-    {1298, 1785, 1910, 900, 2010, 2011, 2012, 0},
-    {1298, 959, 1785, 901, 2010, 2013, 2011, 0},
-    {1031, 911, 1103, 902, 2014, 2015, 2016, 0},
-    {1118, 1101, 1909, 903, 2017, 2018, 2019, 0},
-    {1118, 1444, 1101, 904, 2017, 2020, 2018, 0},
-    {1388, 1911, 1634, 904, 1994, 1996, 2021, 0},
-    {918, 1277, 1700, 905, 2022, 2023, 2024, 0},
-    {918, 1743, 1277, 906, 2022, 2025, 2023, 0},
-    {1118, 1909, 924, 907, 2017, 2019, 2026, 0},
-    {1429, 1438, 1638, 908, 2027, 2028, 2029, 0},
-    {1429, 1037, 1438, 909, 2027, 2030, 2028, 0},
-    {1069, 1908, 981, 910, 2031, 2032, 2033, 0},
-    {920, 892, 988, 911, 2034, 2035, 2036, 0},
-    {920, 1058, 892, 912, 2034, 2037, 2035, 0},
-    {1159, 1903, 1036, 913, 2038, 2039, 2040, 0},
-    {1176, 1144, 1777, 914, 1937, 2041, 1938, 0},
-    {1176, 1401, 1144, 915, 1937, 2042, 2041, 0},
-    {1230, 1089, 1361, 916, 2043, 2044, 2045, 0},
-    {1236, 1585, 1206, 917, 1972, 2046, 1973, 0},
-    {1236, 1018, 1585, 918, 1972, 2047, 2046, 0},
-    {852, 1493, 1768, 919, 2048, 2049, 2050, 0},
-    {1426, 1073, 1419, 920, 2051, 2052, 2053, 0},
-    {1426, 1102, 1073, 921, 2051, 2054, 2052, 0},
-    {855, 847, 1232, 922, 2055, 2056, 2057, 0},
-    {1384, 967, 1113, 923, 1965, 2058, 1966, 0},
-    {1384, 1235, 967, 924, 1965, 2059, 2058, 0},
-    {1197, 1641, 1766, 925, 2060, 2061, 2062, 0},
-    {1313, 1414, 1711, 926, 1927, 2063, 1172, 0},
-    {1313, 1435, 1414, 926, 1927, 2064, 2063, 0},
-    {1432, 1626, 1098, 927, 2065, 2066, 2067, 0},
-    {1270, 862, 1570, 928, 1951, 2068, 1952, 0},
-    {1270, 1671, 862, 929, 1951, 2069, 2068, 0},
-    {1393, 1819, 1001, 930, 2070, 2071, 2072, 0},
-    {1516, 1811, 1753, 931, 1944, 2073, 1945, 0},
-    {1516, 1196, 1811, 932, 1944, 2074, 2073, 0},
-    {1256, 1736, 1579, 933, 2075, 2076, 2077, 0},
-    {1505, 868, 1662, 934, 2078, 2079, 2080, 0},
-    {1505, 837, 868, 935, 2078, 2081, 2079, 0},
-    {983, 857, 1359, 936, 2082, 2083, 2084, 0},
-    {1380, 1490, 1765, 937, 1958, 2085, 1959, 0},
-    {1380, 1450, 1490, 938, 1958, 2086, 2085, 0},
-    {1074, 946, 1696, 939, 2087, 2088, 2089, 0},
-    {1264, 1423, 1787, 940, 2090, 2091, 2092, 0},
-    {1264, 1055, 1423, 941, 2090, 2093, 2091, 0},
-    {1290, 1886, 1104, 942, 2094, 2095, 2096, 0},
-    {1386, 1094, 1862, 943, 2097, 2098, 1030, 0},
-    {1386, 1140, 1094, 482, 2097, 2099, 2098, 0},
-    {1121, 1517, 1221, 944, 2100, 2101, 2102, 0},
-    {1272, 1682, 1873, 945, 2103, 2104, 1051, 0},
-    {1272, 1518, 1682, 946, 2103, 2105, 2104, 0},
-    {1125, 1145, 961, 486, 2106, 2107, 2108, 0},
-    {1068, 1258, 1859, 947, 2109, 2110, 1024, 0},
-    {1068, 858, 1258, 482, 2109, 2111, 2110, 0},
-    {1483, 1748, 1364, 482, 2112, 2113, 2114, 0},
-    {1002, 1155, 1869, 948, 2115, 2116, 1042, 0},
-    {1002, 1218, 1155, 949, 2115, 2117, 2116, 0},
-    {853, 1796, 1200, 482, 2118, 2119, 2120, 0},
-    {1315, 1234, 1865, 482, 2121, 2122, 1036, 0},
-    {1315, 1007, 1234, 482, 2121, 2123, 2122, 0},
-    {960, 1565, 1503, 950, 2124, 2125, 2126, 0},
-    {1452, 1649, 1871, 951, 2127, 2128, 1045, 0},
-    {1452, 1448, 1649, 951, 2127, 2129, 2128, 0},
-    {1323, 839, 859, 952, 2130, 2131, 2132, 0},
-    {1328, 993, 1878, 491, 2133, 2134, 2135, 0},
-    {1328, 1014, 993, 491, 2133, 2136, 2134, 0},
-    {1526, 1153, 1132, 953, 2137, 2138, 2139, 0},
-    {1045, 1607, 1867, 951, 2140, 2141, 1039, 0},
-    {1045, 894, 1607, 951, 2140, 2142, 2141, 0},
-    {1392, 1613, 1790, 951, 2143, 2144, 2145, 0},
-    {1286, 1416, 1881, 482, 2146, 2147, 2148, 0},
-    {1286, 1560, 1416, 482, 2146, 2149, 2147, 0},
-    {1458, 1705, 1336, 495, 2150, 2151, 2152, 0},
-    {1509, 1314, 1880, 482, 2153, 2154, 2155, 0},
-    {1509, 1404, 1314, 954, 2153, 2156, 2154, 0},
-    {1376, 1567, 1443, 482, 2157, 2158, 2159, 0},
-    {865, 1494, 1870, 482, 2160, 2161, 2162, 0},
-    {865, 1148, 1494, 955, 2160, 2163, 2161, 0},
-    {1026, 1651, 1506, 482, 2164, 2165, 2166, 0},
-    {1158, 1025, 1856, 490, 2167, 2168, 1018, 0},
-    {1158, 889, 1025, 956, 2167, 2169, 2168, 0},
-    {1460, 1373, 982, 482, 2170, 2171, 2172, 0},
-    {1376, 968, 1567, 492, 2157, 2173, 2158, 0},
-    {1376, 1470, 968, 957, 2157, 2174, 2173, 0},
-    {1342, 1035, 957, 951, 2175, 2176, 2177, 0},
-    {1344, 1519, 1722, 482, 2178, 2179, 2180, 0},
-    {1344, 1543, 1519, 486, 2178, 2181, 2179, 0},
-    {1509, 1880, 895, 491, 2153, 2155, 2182, 0},
-    {1413, 1233, 1474, 958, 2183, 2184, 2185, 0},
-    {1413, 1194, 1233, 482, 2183, 2186, 2184, 0},
-    {1418, 1879, 1749, 959, 2187, 2188, 2189, 0},
-    {1195, 1177, 1591, 482, 2190, 2191, 2192, 0},
-    {1195, 1013, 1177, 482, 2190, 2193, 2191, 0},
-    {1328, 1878, 1387, 491, 2133, 2135, 2194, 0},
-    {2033, 1367, 846, 960, 2195, 2196, 2197, 0},
-    {1499, 1537, 2032, 961, 2198, 2199, 2200, 0},
-    {1908, 1307, 2031, 962, 2032, 2201, 2202, 0},
-    {1272, 1348, 1829, 963, 2103, 2203, 1096, 0},
-    {1272, 1884, 1348, 482, 2103, 2204, 2203, 0},
-    {1215, 1598, 1905, 964, 2205, 2206, 2207, 0},
-    {1452, 1942, 1703, 482, 2127, 2208, 1081, 0},
-    {1452, 1971, 1942, 482, 2127, 2209, 2208, 0},
-    {1010, 1027, 1999, 965, 2210, 2211, 2212, 0},
-    {1002, 2001, 1677, 966, 2115, 2213, 1087, 0},
-    {1002, 2002, 2001, 486, 2115, 2214, 2213, 0},
-    {1321, 1247, 2003, 967, 2215, 2216, 2217, 0},
-    {1045, 2004, 1699, 482, 2140, 2218, 1077, 0},
-    {1045, 2005, 2004, 968, 2140, 2219, 2218, 0},
-    {893, 1758, 2006, 951, 2220, 2221, 2222, 0},
-    {1315, 2007, 1834, 969, 2121, 2223, 1084, 0},
-    {1315, 2008, 2007, 486, 2121, 2224, 2223, 0},
-    {1500, 1691, 2009, 486, 2225, 2226, 2227, 0},
-    {1026, 2010, 1651, 482, 2164, 2228, 2165, 0},
-    {1026, 2011, 2010, 970, 2164, 2229, 2228, 0},
-    {1276, 1669, 2012, 971, 2230, 2231, 2232, 0},
-    {1386, 2013, 1486, 972, 2097, 2233, 1099, 0},
-    {1386, 2014, 2013, 973, 2097, 2234, 2233, 0},
-    {1319, 1827, 2015, 974, 2235, 2236, 2237, 0},
-    {1296, 2016, 1801, 975, 2238, 2239, 2240, 0},
-    {1296, 2017, 2016, 976, 2238, 2241, 2239, 0},
-    {1188, 1528, 2018, 977, 2242, 2243, 2244, 0},
-    {1068, 2019, 1676, 978, 2109, 2245, 1090, 0},
-    {1068, 2020, 2019, 979, 2109, 2246, 2245, 0},
-    {943, 907, 2021, 980, 2247, 2248, 2249, 0},
-    {1338, 2022, 1685, 981, 2250, 2251, 2252, 0},
-    {1338, 2023, 2022, 982, 2250, 2253, 2251, 0},
-    {1428, 1858, 2024, 982, 2254, 2255, 2256, 0},
-    {1158, 2025, 1776, 983, 2167, 2257, 1067, 0},
-    {1158, 2026, 2025, 984, 2167, 2258, 2257, 0},
-    {1199, 1732, 2027, 985, 2259, 1073, 2260, 0},
-    {1198, 2028, 1970, 986, 1605, 2261, 1606, 0},
-    {1198, 2029, 2028, 987, 1605, 2262, 2261, 0},
-    {1378, 1093, 2030, 988, 1610, 1316, 2263, 0},
-    {2030, 1601, 986, 989, 2263, 2264, 2265, 0},
-    {2030, 1093, 1601, 990, 2263, 1316, 2264, 0},
-    {1093, 1399, 1601, 991, 1316, 1315, 2264, 0},
-    {2028, 2030, 986, 992, 2261, 2263, 2265, 0},
-    {2028, 2029, 2030, 993, 2261, 2262, 2263, 0},
-    {2029, 1378, 2030, 994, 2262, 1610, 2263, 0},
-    {1970, 978, 1039, 995, 1606, 2266, 1256, 0},
-    {1970, 2028, 978, 996, 1606, 2261, 2266, 0},
-    {2028, 986, 978, 997, 2261, 2265, 2266, 0},
-    {2027, 879, 1263, 998, 2260, 1015, 1014, 0},
-    {2027, 1732, 879, 999, 2260, 1073, 1015, 0},
-    {1732, 442, 879, 1000, 1073, 2267, 1015, 0},
-    {2025, 2027, 1263, 984, 2257, 2260, 1014, 0},
-    {2025, 2026, 2027, 1001, 2257, 2258, 2260, 0},
-    {2026, 1199, 2027, 984, 2258, 2259, 2260, 0},
-    {1776, 1875, 1514, 1002, 1067, 2268, 1065, 0},
-    {1776, 2025, 1875, 1003, 1067, 2257, 2268, 0},
-    {2025, 1263, 1875, 983, 2257, 1014, 2268, 0},
-    {2024, 1716, 1523, 1004, 2256, 2269, 2270, 0},
-    {2024, 1858, 1716, 982, 2256, 2255, 2269, 0},
-    {1858, 1154, 1716, 982, 2255, 2271, 2269, 0},
-    {2022, 2024, 1523, 1005, 2251, 2256, 2270, 0},
-    {2022, 2023, 2024, 1006, 2251, 2253, 2256, 0},
-    {2023, 1428, 2024, 480, 2253, 2254, 2256, 0},
-    {1685, 1657, 1334, 482, 2252, 2272, 1097, 0},
-    {1685, 2022, 1657, 490, 2252, 2251, 2272, 0},
-    {2022, 1523, 1657, 1005, 2251, 2270, 2272, 0},
-    {2021, 1584, 1116, 1007, 2249, 2273, 2274, 0},
-    {2021, 907, 1584, 490, 2249, 2248, 2273, 0},
-    {907, 990, 1584, 1008, 2248, 1028, 2273, 0},
-    {2019, 2021, 1116, 1009, 2245, 2249, 2274, 0},
-    {2019, 2020, 2021, 1010, 2245, 2246, 2249, 0},
-    {2020, 943, 2021, 482, 2246, 2247, 2249, 0},
-    {1676, 1860, 974, 1011, 1090, 2275, 1088, 0},
-    {1676, 2019, 1860, 490, 1090, 2245, 2275, 0},
-    {2019, 1116, 1860, 490, 2245, 2274, 2275, 0},
-    {2018, 1857, 1338, 482, 2244, 1021, 2250, 0},
-    {2018, 1528, 1857, 1012, 2244, 2243, 1021, 0},
-    {1528, 1170, 1857, 977, 2243, 1019, 1021, 0},
-    {2016, 2018, 1338, 490, 2239, 2244, 2250, 0},
-    {2016, 2017, 2018, 1013, 2239, 2241, 2244, 0},
-    {2017, 1188, 2018, 1012, 2241, 2242, 2244, 0},
-    {1801, 1685, 1334, 482, 2240, 2252, 1097, 0},
-    {1801, 2016, 1685, 1014, 2240, 2239, 2252, 0},
-    {2016, 1338, 1685, 973, 2239, 2250, 2252, 0},
-    {2015, 1861, 1296, 1015, 2237, 1027, 2238, 0},
-    {2015, 1827, 1861, 482, 2237, 2236, 1027, 0},
-    {1827, 1350, 1861, 974, 2236, 1025, 1027, 0},
-    {2013, 2015, 1296, 1016, 2233, 2237, 2238, 0},
-    {2013, 2014, 2015, 973, 2233, 2234, 2237, 0},
-    {2014, 1319, 2015, 1017, 2234, 2235, 2237, 0},
-    {1486, 1801, 1334, 974, 1099, 2240, 1097, 0},
-    {1486, 2013, 1801, 1013, 1099, 2233, 2240, 0},
-    {2013, 1296, 1801, 1018, 2233, 2238, 2240, 0},
-    {2012, 1742, 1135, 1019, 2232, 2276, 2277, 0},
-    {2012, 1669, 1742, 486, 2232, 2231, 2276, 0},
-    {1669, 1260, 1742, 1020, 2231, 1034, 2276, 0},
-    {2010, 2012, 1135, 1021, 2228, 2232, 2277, 0},
-    {2010, 2011, 2012, 1022, 2228, 2229, 2232, 0},
-    {2011, 1276, 2012, 1023, 2229, 2230, 2232, 0},
-    {1651, 1864, 1244, 1024, 2165, 2278, 2279, 0},
-    {1651, 2010, 1864, 490, 2165, 2228, 2278, 0},
-    {2010, 1135, 1864, 490, 2228, 2277, 2278, 0},
-    {2009, 1652, 1405, 1025, 2227, 2280, 2281, 0},
-    {2009, 1691, 1652, 482, 2227, 2226, 2280, 0},
-    {1691, 1080, 1652, 1026, 2226, 1049, 2280, 0},
-    {2007, 2009, 1405, 1027, 2223, 2227, 2281, 0},
-    {2007, 2008, 2009, 1028, 2223, 2224, 2227, 0},
-    {2008, 1500, 2009, 1029, 2224, 2225, 2227, 0},
-    {1834, 1866, 1064, 1030, 1084, 2282, 1082, 0},
-    {1834, 2007, 1866, 482, 1084, 2223, 2282, 0},
-    {2007, 1405, 1866, 482, 2223, 2281, 2282, 0},
-    {2006, 1133, 1182, 482, 2222, 2283, 2284, 0},
-    {2006, 1758, 1133, 482, 2222, 2221, 2283, 0},
-    {1758, 1129, 1133, 482, 2221, 1043, 2283, 0},
-    {2004, 2006, 1182, 1031, 2218, 2222, 2284, 0},
-    {2004, 2005, 2006, 1032, 2218, 2219, 2222, 0},
-    {2005, 893, 2006, 951, 2219, 2220, 2222, 0},
-    {1699, 1868, 1112, 482, 1077, 2285, 1075, 0},
-    {1699, 2004, 1868, 482, 1077, 2218, 2285, 0},
-    {2004, 1182, 1868, 1033, 2218, 2284, 2285, 0},
-    {2003, 1611, 865, 1034, 2217, 1068, 2160, 0},
-    {2003, 1247, 1611, 482, 2217, 2216, 1068, 0},
-    {1247, 900, 1611, 1035, 2216, 1031, 1068, 0},
-    {2001, 2003, 865, 482, 2213, 2217, 2160, 0},
-    {2001, 2002, 2003, 486, 2213, 2214, 2217, 0},
-    {2002, 1321, 2003, 486, 2214, 2215, 2217, 0},
-    {1677, 1870, 884, 1036, 1087, 2162, 1085, 0},
-    {1677, 2001, 1870, 482, 1087, 2213, 2162, 0},
-    {2001, 865, 1870, 482, 2213, 2160, 2162, 0},
-    {1999, 1720, 912, 1037, 2212, 2286, 2287, 0},
-    {1999, 1027, 1720, 1038, 2212, 2211, 2286, 0},
-    {1027, 1489, 1720, 486, 2211, 1040, 2286, 0},
-    {1942, 1999, 912, 486, 2208, 2212, 2287, 0},
-    {1942, 1971, 1999, 482, 2208, 2209, 2212, 0},
-    {1971, 1010, 1999, 482, 2209, 2210, 2212, 0},
-    {1703, 1872, 1472, 969, 1081, 2288, 1079, 0},
-    {1703, 1942, 1872, 486, 1081, 2208, 2288, 0},
-    {1942, 912, 1872, 486, 2208, 2287, 2288, 0},
-    {1905, 1841, 1353, 1039, 2207, 2289, 2290, 0},
-    {1905, 1598, 1841, 1040, 2207, 2206, 2289, 0},
-    {1598, 1440, 1841, 1041, 2206, 1022, 2289, 0},
-    {1348, 1905, 1353, 482, 2203, 2207, 2290, 0},
-    {1348, 1884, 1905, 482, 2203, 2204, 2207, 0},
-    {1884, 1215, 1905, 1042, 2204, 2205, 2207, 0},
-    {1829, 1874, 1424, 1041, 1096, 2291, 1094, 0},
-    {1829, 1348, 1874, 482, 1096, 2203, 2291, 0},
-    {1348, 1353, 1874, 1043, 2203, 2290, 2291, 0},
-    {2031, 1479, 1499, 1044, 2202, 2292, 2198, 0},
-    {1806, 1499, 1187, 1045, 2293, 2198, 2294, 0},
-    {1017, 2031, 1806, 1046, 2295, 2202, 2293, 0},
-    {2032, 984, 1739, 1047, 2200, 2296, 2297, 0},
-    {1042, 1739, 449, 1048, 2298, 2297, 2299, 0},
-    {1187, 2032, 1042, 1049, 2294, 2200, 2298, 0},
-    {1752, 846, 445, 1050, 2300, 2197, 2301, 0},
-    {984, 2033, 1752, 1051, 2296, 2195, 2300, 0},
-    {1537, 1225, 2033, 1052, 2199, 2302, 2195, 0},
-    {1387, 978, 986, 491, 2194, 2303, 2304, 0},
-    {1387, 1878, 978, 1053, 2194, 2135, 2303, 0},
-    {1878, 1039, 978, 491, 2135, 2305, 2303, 0},
-    {1177, 1387, 986, 1053, 2191, 2194, 2304, 0},
-    {1177, 1013, 1387, 491, 2191, 2193, 2194, 0},
-    {1013, 1328, 1387, 1054, 2193, 2133, 2194, 0},
-    {1591, 1601, 1399, 1055, 2192, 2306, 2307, 0},
-    {1591, 1177, 1601, 482, 2192, 2191, 2306, 0},
-    {1177, 986, 1601, 491, 2191, 2304, 2306, 0},
-    {1749, 1858, 1428, 1056, 2189, 2255, 2254, 0},
-    {1749, 1879, 1858, 1057, 2189, 2188, 2255, 0},
-    {1879, 1154, 1858, 1056, 2188, 2271, 2255, 0},
-    {1233, 1749, 1428, 1058, 2184, 2189, 2254, 0},
-    {1233, 1194, 1749, 1059, 2184, 2186, 2189, 0},
-    {1194, 1418, 1749, 1060, 2186, 2187, 2189, 0},
-    {1474, 1495, 1170, 1061, 2185, 1020, 1019, 0},
-    {1474, 1233, 1495, 1062, 2185, 2184, 1020, 0},
-    {1233, 1428, 1495, 1063, 2184, 2254, 1020, 0},
-    {895, 1659, 1286, 486, 2182, 1071, 2146, 0},
-    {895, 1880, 1659, 491, 2182, 2155, 1071, 0},
-    {1880, 932, 1659, 491, 2155, 1069, 1071, 0},
-    {1519, 895, 1286, 486, 2179, 2182, 2146, 0},
-    {1519, 1543, 895, 486, 2179, 2181, 2182, 0},
-    {1543, 1509, 895, 491, 2181, 2153, 2182, 0},
-    {1722, 1881, 1399, 491, 2180, 2148, 2307, 0},
-    {1722, 1519, 1881, 482, 2180, 2179, 2148, 0},
-    {1519, 1286, 1881, 482, 2179, 2146, 2148, 0},
-    {957, 1830, 1354, 1064, 2177, 2308, 2309, 0},
-    {957, 1035, 1830, 482, 2177, 2176, 2308, 0},
-    {1035, 1309, 1830, 1064, 2176, 1037, 2308, 0},
-    {968, 957, 1354, 482, 2173, 2177, 2309, 0},
-    {968, 1470, 957, 951, 2173, 2174, 2177, 0},
-    {1470, 1342, 957, 951, 2174, 2175, 2177, 0},
-    {1567, 1883, 1292, 492, 2158, 2310, 2311, 0},
-    {1567, 968, 1883, 1065, 2158, 2173, 2310, 0},
-    {968, 1354, 1883, 1064, 2173, 2309, 2310, 0},
-    {982, 1879, 1418, 493, 2172, 2188, 2187, 0},
-    {982, 1373, 1879, 1066, 2172, 2171, 2188, 0},
-    {1373, 1154, 1879, 1062, 2171, 2271, 2188, 0},
-    {1025, 982, 1418, 1067, 2168, 2172, 2187, 0},
-    {1025, 889, 982, 493, 2168, 2169, 2172, 0},
-    {889, 1460, 982, 1066, 2169, 2170, 2172, 0},
-    {1856, 1635, 1530, 1068, 1018, 1058, 1016, 0},
-    {1856, 1025, 1635, 1069, 1018, 2168, 1058, 0},
-    {1025, 1418, 1635, 493, 2168, 2187, 1058, 0},
-    {1506, 935, 1006, 482, 2166, 2312, 2313, 0},
-    {1506, 1651, 935, 486, 2166, 2165, 2312, 0},
-    {1651, 1244, 935, 486, 2165, 2279, 2312, 0},
-    {1494, 1506, 1006, 1023, 2161, 2166, 2313, 0},
-    {1494, 1148, 1506, 1023, 2161, 2163, 2166, 0},
-    {1148, 1026, 1506, 1023, 2163, 2164, 2166, 0},
-    {1870, 1508, 884, 1070, 2162, 2314, 1085, 0},
-    {1870, 1494, 1508, 955, 2162, 2161, 2314, 0},
-    {1494, 1006, 1508, 1071, 2161, 2313, 2314, 0},
-    {1443, 1577, 1409, 482, 2159, 2315, 2316, 0},
-    {1443, 1567, 1577, 1072, 2159, 2158, 2315, 0},
-    {1567, 1292, 1577, 482, 2158, 2311, 2315, 0},
-    {1314, 1443, 1409, 951, 2154, 2159, 2316, 0},
-    {1314, 1404, 1443, 951, 2154, 2156, 2159, 0},
-    {1404, 1376, 1443, 951, 2156, 2157, 2159, 0},
-    {1880, 1282, 932, 482, 2155, 2317, 1069, 0},
-    {1880, 1314, 1282, 1072, 2155, 2154, 2317, 0},
-    {1314, 1409, 1282, 951, 2154, 2316, 2317, 0},
-    {1336, 1877, 1195, 491, 2152, 1057, 2190, 0},
-    {1336, 1705, 1877, 491, 2152, 2151, 1057, 0},
-    {1705, 1382, 1877, 495, 2151, 1055, 1057, 0},
-    {1416, 1336, 1195, 1073, 2147, 2152, 2190, 0},
-    {1416, 1560, 1336, 1074, 2147, 2149, 2152, 0},
-    {1560, 1458, 1336, 1075, 2149, 2150, 2152, 0},
-    {1881, 1591, 1399, 1076, 2148, 2192, 2307, 0},
-    {1881, 1416, 1591, 1077, 2148, 2147, 2192, 0},
-    {1416, 1195, 1591, 1077, 2147, 2190, 2192, 0},
-    {1790, 1883, 1354, 486, 2145, 2310, 2309, 0},
-    {1790, 1613, 1883, 486, 2145, 2144, 2310, 0},
-    {1613, 1292, 1883, 1078, 2144, 2311, 2310, 0},
-    {1607, 1790, 1354, 486, 2141, 2145, 2309, 0},
-    {1607, 894, 1790, 951, 2141, 2142, 2145, 0},
-    {894, 1392, 1790, 951, 2142, 2143, 2145, 0},
-    {1867, 1830, 1309, 486, 1039, 2308, 1037, 0},
-    {1867, 1607, 1830, 486, 1039, 2141, 2308, 0},
-    {1607, 1354, 1830, 486, 2141, 2309, 2308, 0},
-    {1132, 1876, 1477, 1079, 2139, 2318, 2319, 0},
-    {1132, 1153, 1876, 490, 2139, 2138, 2318, 0},
-    {1153, 1022, 1876, 490, 2138, 1283, 2318, 0},
-    {993, 1132, 1477, 491, 2134, 2139, 2319, 0},
-    {993, 1014, 1132, 491, 2134, 2136, 2139, 0},
-    {1014, 1526, 1132, 491, 2136, 2137, 2139, 0},
-    {1878, 1683, 1039, 491, 2135, 1692, 2305, 0},
-    {1878, 993, 1683, 491, 2135, 2134, 1692, 0},
-    {993, 1477, 1683, 491, 2134, 2319, 1692, 0},
-    {859, 1868, 1182, 1080, 2132, 2285, 2284, 0},
-    {859, 839, 1868, 1081, 2132, 2131, 2285, 0},
-    {839, 1112, 1868, 1082, 2131, 1075, 2285, 0},
-    {1649, 859, 1182, 486, 2128, 2132, 2284, 0},
-    {1649, 1448, 859, 951, 2128, 2129, 2132, 0},
-    {1448, 1323, 859, 1083, 2129, 2130, 2132, 0},
-    {1871, 1133, 1129, 486, 1045, 2283, 1043, 0},
-    {1871, 1649, 1133, 486, 1045, 2128, 2283, 0},
-    {1649, 1182, 1133, 486, 2128, 2284, 2283, 0},
-    {1503, 1864, 1135, 1084, 2126, 2278, 2277, 0},
-    {1503, 1565, 1864, 1085, 2126, 2125, 2278, 0},
-    {1565, 1244, 1864, 1086, 2125, 2279, 2278, 0},
-    {1234, 1503, 1135, 482, 2122, 2126, 2277, 0},
-    {1234, 1007, 1503, 482, 2122, 2123, 2126, 0},
-    {1007, 960, 1503, 1087, 2123, 2124, 2126, 0},
-    {1865, 1742, 1260, 1088, 1036, 2276, 1034, 0},
-    {1865, 1234, 1742, 482, 1036, 2122, 2276, 0},
-    {1234, 1135, 1742, 482, 2122, 2277, 2276, 0},
-    {1200, 1872, 912, 951, 2120, 2288, 2287, 0},
-    {1200, 1796, 1872, 951, 2120, 2119, 2288, 0},
-    {1796, 1472, 1872, 951, 2119, 1079, 2288, 0},
-    {1155, 1200, 912, 951, 2116, 2120, 2287, 0},
-    {1155, 1218, 1200, 482, 2116, 2117, 2120, 0},
-    {1218, 853, 1200, 482, 2117, 2118, 2120, 0},
-    {1869, 1720, 1489, 482, 1042, 2286, 1040, 0},
-    {1869, 1155, 1720, 1089, 1042, 2116, 2286, 0},
-    {1155, 912, 1720, 1090, 2116, 2287, 2286, 0},
-    {1364, 1874, 1353, 1091, 2114, 2291, 2290, 0},
-    {1364, 1748, 1874, 1092, 2114, 2113, 2291, 0},
-    {1748, 1424, 1874, 1093, 2113, 1094, 2291, 0},
-    {1258, 1364, 1353, 1092, 2110, 2114, 2290, 0},
-    {1258, 858, 1364, 482, 2110, 2111, 2114, 0},
-    {858, 1483, 1364, 482, 2111, 2112, 2114, 0},
-    {1859, 1841, 1440, 1093, 1024, 2289, 1022, 0},
-    {1859, 1258, 1841, 1094, 1024, 2110, 2289, 0},
-    {1258, 1353, 1841, 1095, 2110, 2290, 2289, 0},
-    {961, 1866, 1405, 1096, 2108, 2282, 2281, 0},
-    {961, 1145, 1866, 1097, 2108, 2107, 2282, 0},
-    {1145, 1064, 1866, 1098, 2107, 1082, 2282, 0},
-    {1682, 961, 1405, 1097, 2104, 2108, 2281, 0},
-    {1682, 1518, 961, 946, 2104, 2105, 2108, 0},
-    {1518, 1125, 961, 1099, 2105, 2106, 2108, 0},
-    {1873, 1652, 1080, 1100, 1051, 2280, 1049, 0},
-    {1873, 1682, 1652, 1101, 1051, 2104, 2280, 0},
-    {1682, 1405, 1652, 1102, 2104, 2281, 2280, 0},
-    {1221, 1860, 1116, 1103, 2102, 2275, 2274, 0},
-    {1221, 1517, 1860, 1104, 2102, 2101, 2275, 0},
-    {1517, 974, 1860, 1105, 2101, 1088, 2275, 0},
-    {1094, 1221, 1116, 1103, 2098, 2102, 2274, 0},
-    {1094, 1140, 1221, 482, 2098, 2099, 2102, 0},
-    {1140, 1121, 1221, 1106, 2099, 2100, 2102, 0},
-    {1862, 1584, 990, 1107, 1030, 2273, 1028, 0},
-    {1862, 1094, 1584, 1108, 1030, 2098, 2273, 0},
-    {1094, 1116, 1584, 1109, 2098, 2274, 2273, 0},
-    {1104, 1624, 1163, 1110, 2096, 2320, 2321, 0},
-    {1104, 1886, 1624, 1110, 2096, 2095, 2320, 0},
-    {1886, 1152, 1624, 1110, 2095, 2322, 2320, 0},
-    {1423, 1104, 1163, 1111, 2091, 2096, 2321, 0},
-    {1423, 1055, 1104, 1112, 2091, 2093, 2096, 0},
-    {1055, 1290, 1104, 1112, 2093, 2094, 2096, 0},
-    {1787, 1655, 1332, 1113, 2092, 2323, 1170, 0},
-    {1787, 1423, 1655, 1113, 2092, 2091, 2323, 0},
-    {1423, 1163, 1655, 1114, 2091, 2321, 2323, 0},
-    {1696, 1844, 1217, 1115, 2089, 2324, 2325, 0},
-    {1696, 946, 1844, 1116, 2089, 2088, 2324, 0},
-    {946, 970, 1844, 1117, 2088, 1115, 2324, 0},
-    {1490, 1696, 1217, 1118, 2085, 2089, 2325, 0},
-    {1490, 1450, 1696, 1119, 2085, 2086, 2089, 0},
-    {1450, 1074, 1696, 1120, 2086, 2087, 2089, 0},
-    {1765, 1888, 972, 1121, 1959, 2326, 2327, 0},
-    {1765, 1490, 1888, 1122, 1959, 2085, 2326, 0},
-    {1490, 1217, 1888, 503, 2085, 2325, 2326, 0},
-    {1359, 1885, 1264, 1123, 2084, 1102, 2090, 0},
-    {1359, 857, 1885, 1124, 2084, 2083, 1102, 0},
-    {857, 1150, 1885, 1125, 2083, 1100, 1102, 0},
-    {868, 1359, 1264, 1126, 2079, 2084, 2090, 0},
-    {868, 837, 1359, 1127, 2079, 2081, 2084, 0},
-    {837, 983, 1359, 1128, 2081, 2082, 2084, 0},
-    {1662, 1787, 1332, 1129, 2080, 2092, 1170, 0},
-    {1662, 868, 1787, 1130, 2080, 2079, 2092, 0},
-    {868, 1264, 1787, 1131, 2079, 2090, 2092, 0},
-    {1579, 955, 1360, 1132, 2077, 1163, 1954, 0},
-    {1579, 1736, 955, 933, 2077, 2076, 1163, 0},
-    {1736, 1420, 955, 1133, 2076, 1103, 1163, 0},
-    {1811, 1579, 1360, 1134, 2073, 2077, 1954, 0},
-    {1811, 1196, 1579, 1135, 2073, 2074, 2077, 0},
-    {1196, 1256, 1579, 932, 2074, 2075, 2077, 0},
-    {1753, 1891, 1422, 1136, 1945, 1956, 2328, 0},
-    {1753, 1811, 1891, 1137, 1945, 2073, 1956, 0},
-    {1811, 1360, 1891, 1138, 2073, 1954, 1956, 0},
-    {1001, 1619, 1403, 1139, 2072, 1162, 1961, 0},
-    {1001, 1819, 1619, 1139, 2072, 2071, 1162, 0},
-    {1819, 880, 1619, 1140, 2071, 1118, 1162, 0},
-    {862, 1001, 1403, 1139, 2068, 2072, 1961, 0},
-    {862, 1671, 1001, 1141, 2068, 2069, 2072, 0},
-    {1671, 1393, 1001, 1142, 2069, 2070, 2072, 0},
-    {1570, 1893, 882, 1143, 1952, 1963, 2329, 0},
-    {1570, 862, 1893, 1144, 1952, 2068, 1963, 0},
-    {862, 1403, 1893, 1145, 2068, 1961, 1963, 0},
-    {1098, 1889, 1505, 1146, 2067, 1108, 2078, 0},
-    {1098, 1626, 1889, 1147, 2067, 2066, 1108, 0},
-    {1626, 1330, 1889, 1148, 2066, 1106, 1108, 0},
-    {1414, 1098, 1505, 1149, 2063, 2067, 2078, 0},
-    {1414, 1435, 1098, 507, 2063, 2064, 2067, 0},
-    {1435, 1432, 1098, 507, 2064, 2065, 2067, 0},
-    {1711, 1662, 1332, 1150, 1172, 2080, 1170, 0},
-    {1711, 1414, 1662, 1151, 1172, 2063, 2080, 0},
-    {1414, 1505, 1662, 1148, 2063, 2078, 2080, 0},
-    {1766, 1475, 1294, 1152, 2062, 1169, 1933, 0},
-    {1766, 1641, 1475, 1153, 2062, 2061, 1169, 0},
-    {1641, 1240, 1475, 1154, 2061, 1127, 1169, 0},
-    {967, 1766, 1294, 1155, 2058, 2062, 1933, 0},
-    {967, 1235, 1766, 1156, 2058, 2059, 2062, 0},
-    {1235, 1197, 1766, 1157, 2059, 2060, 2062, 0},
-    {1113, 1896, 1242, 1158, 1966, 1935, 2330, 0},
-    {1113, 967, 1896, 1159, 1966, 2058, 1935, 0},
-    {967, 1294, 1896, 1160, 2058, 1933, 1935, 0},
-    {1232, 1686, 1246, 1161, 2057, 1164, 1947, 0},
-    {1232, 847, 1686, 1162, 2057, 2056, 1164, 0},
-    {847, 1467, 1686, 1163, 2056, 1112, 1164, 0},
-    {1073, 1232, 1246, 1164, 2052, 2057, 1947, 0},
-    {1073, 1102, 1232, 1165, 2052, 2054, 2057, 0},
-    {1102, 855, 1232, 1166, 2054, 2055, 2057, 0},
-    {1419, 1898, 1469, 1167, 2053, 1949, 2331, 0},
-    {1419, 1073, 1898, 1168, 2053, 2052, 1949, 0},
-    {1073, 1246, 1898, 1169, 2052, 1947, 1949, 0},
-    {1768, 1594, 1463, 1170, 2050, 1987, 1986, 0},
-    {1768, 1493, 1594, 1171, 2050, 2049, 1987, 0},
-    {1493, 1107, 1594, 1172, 2049, 1121, 1987, 0},
-    {1585, 1768, 1463, 1173, 2046, 2050, 1986, 0},
-    {1585, 1018, 1768, 1174, 2046, 2047, 2050, 0},
-    {1018, 852, 1768, 1174, 2047, 2048, 2050, 0},
-    {1206, 1900, 1109, 1175, 1973, 1156, 1155, 0},
-    {1206, 1585, 1900, 1176, 1973, 2046, 1156, 0},
-    {1585, 1463, 1900, 1177, 2046, 1986, 1156, 0},
-    {1361, 1547, 1441, 1178, 2045, 1165, 1940, 0},
-    {1361, 1089, 1547, 1179, 2045, 2044, 1165, 0},
-    {1089, 1060, 1547, 1180, 2044, 1109, 1165, 0},
-    {1144, 1361, 1441, 1181, 2041, 2045, 1940, 0},
-    {1144, 1401, 1361, 1182, 2041, 2042, 2045, 0},
-    {1401, 1230, 1361, 1183, 2042, 2043, 2045, 0},
-    {1777, 1902, 1062, 1184, 1938, 1942, 2332, 0},
-    {1777, 1144, 1902, 1185, 1938, 2041, 1942, 0},
-    {1144, 1441, 1902, 1186, 2041, 1940, 1942, 0},
-    {1036, 1886, 1290, 1187, 2040, 2095, 2094, 0},
-    {1036, 1903, 1886, 1188, 2040, 2039, 2095, 0},
-    {1903, 1152, 1886, 1189, 2039, 2322, 2095, 0},
-    {892, 1036, 1290, 1187, 2035, 2040, 2094, 0},
-    {892, 1058, 1036, 1187, 2035, 2037, 2040, 0},
-    {1058, 1159, 1036, 1190, 2037, 2038, 2040, 0},
-    {988, 965, 1150, 1191, 2036, 1101, 1100, 0},
-    {988, 892, 965, 1192, 2036, 2035, 1101, 0},
-    {892, 1290, 965, 1192, 2035, 2094, 1101, 0},
-    {981, 954, 1391, 1193, 2033, 2333, 2334, 0},
-    {981, 1908, 954, 1194, 2033, 2032, 2333, 0},
-    {1908, 1017, 954, 1195, 2032, 2295, 2333, 0},
-    {1438, 981, 1391, 1196, 2028, 2033, 2334, 0},
-    {1438, 1037, 981, 515, 2028, 2030, 2033, 0},
-    {1037, 1069, 981, 1197, 2030, 2031, 2033, 0},
-    {1638, 1268, 1377, 1198, 2029, 2335, 2336, 0},
-    {1638, 1438, 1268, 1197, 2029, 2028, 2335, 0},
-    {1438, 1391, 1268, 1199, 2028, 2334, 2335, 0},
-    {924, 1492, 1298, 1200, 2026, 1147, 2010, 0},
-    {924, 1909, 1492, 1201, 2026, 2019, 1147, 0},
-    {1909, 1379, 1492, 1202, 2019, 1145, 1147, 0},
-    {1277, 924, 1298, 1203, 2023, 2026, 2010, 0},
-    {1277, 1743, 924, 1204, 2023, 2025, 2026, 0},
-    {1743, 1118, 924, 1205, 2025, 2017, 2026, 0},
-    {1700, 1910, 1377, 1206, 2024, 2012, 2336, 0},
-    {1700, 1277, 1910, 1207, 2024, 2023, 2012, 0},
-    {1277, 1298, 1910, 1208, 2023, 2010, 2012, 0},
-    {1634, 1734, 1278, 1209, 2021, 2337, 2338, 0},
-    {1634, 1911, 1734, 904, 2021, 1996, 2337, 0},
-    {1911, 929, 1734, 1210, 1996, 1158, 2337, 0},
-    {1101, 1634, 1278, 1211, 2018, 2021, 2338, 0},
-    {1101, 1444, 1634, 517, 2018, 2020, 2021, 0},
-    {1444, 1388, 1634, 517, 2020, 1994, 2021, 0},
-    {1909, 1702, 1379, 1210, 2019, 2339, 1145, 0},
-    {1909, 1101, 1702, 1212, 2019, 2018, 2339, 0},
-    {1101, 1278, 1702, 1213, 2018, 2338, 2339, 0},
-    {1103, 1907, 1429, 1214, 2016, 1140, 2027, 0},
-    {1103, 911, 1907, 1214, 2016, 2015, 1140, 0},
-    {911, 1019, 1907, 1215, 2015, 1053, 1140, 0},
-    {1785, 1103, 1429, 1215, 2011, 2016, 2027, 0},
-    {1785, 959, 1103, 1216, 2011, 2013, 2016, 0},
-    {959, 1031, 1103, 1217, 2013, 2014, 2016, 0},
-    {1910, 1638, 1377, 1218, 2012, 2029, 2336, 0},
-    {1910, 1785, 1638, 1219, 2012, 2011, 2029, 0},
-    {1785, 1429, 1638, 1220, 2011, 2027, 2029, 0},
-    {2034, 1119, 1355, 1221, 2009, 2340, 2004, 0},
-    {1465, 1355, 1367, 1222, 2341, 2004, 2342, 0},
-    {1019, 2034, 1465, 1223, 1201, 2009, 2341, 0},
-    {2035, 1411, 1059, 1224, 2006, 2343, 2344, 0},
-    {846, 1059, 445, 1225, 2345, 2344, 2346, 0},
-    {1367, 2035, 846, 1226, 2342, 2006, 2345, 0},
-    {1833, 1539, 446, 1227, 2347, 2003, 2348, 0},
-    {1411, 2036, 1833, 1228, 2343, 2001, 2347, 0},
-    {951, 1674, 2036, 1229, 2005, 2349, 2001, 0},
-    {1434, 1576, 1028, 1230, 2000, 1980, 1979, 0},
-    {1434, 1203, 1576, 1231, 2000, 1999, 1980, 0},
-    {1203, 1287, 1576, 895, 1999, 1124, 1980, 0},
-    {1285, 1434, 1028, 1232, 1995, 2000, 1979, 0},
-    {1285, 1147, 1434, 1233, 1995, 1997, 2000, 0},
-    {1147, 1096, 1434, 1234, 1997, 1998, 2000, 0},
-    {1911, 1912, 929, 895, 1996, 1159, 1158, 0},
-    {1911, 1285, 1912, 1235, 1996, 1995, 1159, 0},
-    {1285, 1028, 1912, 1236, 1995, 1979, 1159, 0},
-    {1291, 1903, 1159, 1237, 1993, 2039, 2038, 0},
-    {1291, 994, 1903, 1238, 1993, 1992, 2039, 0},
-    {994, 1152, 1903, 1238, 1992, 2322, 2039, 0},
-    {1193, 1291, 1159, 1239, 1989, 1993, 2038, 0},
-    {1193, 1192, 1291, 1240, 1989, 1990, 1993, 0},
-    {1192, 1280, 1291, 893, 1990, 1991, 1993, 0},
-    {1904, 838, 1510, 1238, 1925, 1134, 1133, 0},
-    {1904, 1193, 838, 1238, 1925, 1989, 1134, 0},
-    {1193, 1159, 838, 1241, 1989, 2038, 1134, 0},
-    {1455, 1897, 1426, 1242, 1988, 1123, 2051, 0},
-    {1455, 1594, 1897, 1243, 1988, 1987, 1123, 0},
-    {1594, 1107, 1897, 1244, 1987, 1121, 1123, 0},
-    {1578, 1455, 1426, 1245, 1983, 1988, 2051, 0},
-    {1578, 1012, 1455, 1246, 1983, 1985, 1988, 0},
-    {1012, 1463, 1455, 1247, 1985, 1986, 1988, 0},
-    {1781, 1419, 1469, 1248, 1984, 2053, 2331, 0},
-    {1781, 1578, 1419, 1249, 1984, 1983, 2053, 0},
-    {1578, 1426, 1419, 1250, 1983, 2051, 2053, 0},
-    {1446, 1808, 1183, 1251, 1981, 1161, 1968, 0},
-    {1446, 1576, 1808, 1252, 1981, 1980, 1161, 0},
-    {1576, 1287, 1808, 1253, 1980, 1124, 1161, 0},
-    {1166, 1446, 1183, 1254, 1976, 1981, 1968, 0},
-    {1166, 1100, 1446, 1255, 1976, 1978, 1981, 0},
-    {1100, 1028, 1446, 1256, 1978, 1979, 1981, 0},
-    {1760, 1913, 1289, 887, 1977, 1970, 2350, 0},
-    {1760, 1166, 1913, 1257, 1977, 1976, 1970, 0},
-    {1166, 1183, 1913, 1254, 1976, 1968, 1970, 0},
-    {1297, 1599, 1032, 1258, 1974, 2351, 2352, 0},
-    {1297, 1206, 1599, 1259, 1974, 1973, 2351, 0},
-    {1206, 1109, 1599, 1260, 1973, 1155, 2351, 0},
-    {1033, 1297, 1032, 1261, 1969, 1974, 2352, 0},
-    {1033, 1208, 1297, 1262, 1969, 1971, 1974, 0},
-    {1208, 1236, 1297, 1262, 1971, 1972, 1974, 0},
-    {1913, 1610, 1289, 1263, 1970, 2353, 2350, 0},
-    {1913, 1033, 1610, 1264, 1970, 1969, 2353, 0},
-    {1033, 1032, 1610, 1265, 1969, 2352, 2353, 0},
-    {1231, 1714, 1219, 1266, 1967, 2354, 2355, 0},
-    {1231, 1113, 1714, 1267, 1967, 1966, 2354, 0},
-    {1113, 1242, 1714, 1268, 1966, 2330, 2354, 0},
-    {1084, 1231, 1219, 1269, 1962, 1967, 2355, 0},
-    {1084, 1205, 1231, 1270, 1962, 1964, 1967, 0},
-    {1205, 1384, 1231, 1271, 1964, 1965, 1967, 0},
-    {1893, 903, 882, 1272, 1963, 2356, 2329, 0},
-    {1893, 1084, 903, 1273, 1963, 1962, 2356, 0},
-    {1084, 1219, 903, 1274, 1962, 2355, 2356, 0},
-    {1249, 1800, 1254, 1275, 1960, 2357, 2358, 0},
-    {1249, 1765, 1800, 1276, 1960, 1959, 2357, 0},
-    {1765, 972, 1800, 1277, 1959, 2327, 2357, 0},
-    {916, 1249, 1254, 1278, 1955, 1960, 2358, 0},
-    {916, 1083, 1249, 1279, 1955, 1957, 1960, 0},
-    {1083, 1380, 1249, 526, 1957, 1958, 1960, 0},
-    {1891, 1746, 1422, 526, 1956, 2359, 2328, 0},
-    {1891, 916, 1746, 1280, 1956, 1955, 2359, 0},
-    {916, 1254, 1746, 1281, 1955, 2358, 2359, 0},
-    {1043, 1637, 1213, 1282, 1953, 2360, 2361, 0},
-    {1043, 1570, 1637, 1282, 1953, 1952, 2360, 0},
-    {1570, 882, 1637, 1283, 1952, 2329, 2360, 0},
-    {1044, 1043, 1213, 1282, 1948, 1953, 2361, 0},
-    {1044, 1471, 1043, 1284, 1948, 1950, 1953, 0},
-    {1471, 1270, 1043, 1285, 1950, 1951, 1953, 0},
-    {1898, 1793, 1469, 1286, 1949, 2362, 2331, 0},
-    {1898, 1044, 1793, 1287, 1949, 1948, 2362, 0},
-    {1044, 1213, 1793, 1282, 1948, 2361, 2362, 0},
-    {1091, 1085, 1485, 1288, 1946, 2363, 2364, 0},
-    {1091, 1753, 1085, 1289, 1946, 1945, 2363, 0},
-    {1753, 1422, 1085, 1290, 1945, 2328, 2363, 0},
-    {1160, 1091, 1485, 1291, 1941, 1946, 2364, 0},
-    {1160, 1081, 1091, 1292, 1941, 1943, 1946, 0},
-    {1081, 1516, 1091, 1293, 1943, 1944, 1946, 0},
-    {1902, 1478, 1062, 1294, 1942, 2365, 2332, 0},
-    {1902, 1160, 1478, 1295, 1942, 1941, 2365, 0},
-    {1160, 1485, 1478, 1296, 1941, 2364, 2365, 0},
-    {1149, 1849, 1050, 1297, 1939, 2366, 2367, 0},
-    {1149, 1777, 1849, 1298, 1939, 1938, 2366, 0},
-    {1777, 1062, 1849, 1299, 1938, 2332, 2366, 0},
-    {1185, 1149, 1050, 1300, 1934, 1939, 2367, 0},
-    {1185, 1410, 1149, 871, 1934, 1936, 1939, 0},
-    {1410, 1176, 1149, 871, 1936, 1937, 1939, 0},
-    {1896, 1563, 1242, 1301, 1935, 2368, 2330, 0},
-    {1896, 1185, 1563, 1300, 1935, 1934, 2368, 0},
-    {1185, 1050, 1563, 1297, 1934, 2367, 2368, 0},
-    {1229, 1888, 1217, 1302, 1932, 2326, 2325, 0},
-    {1229, 1527, 1888, 1303, 1932, 1931, 2326, 0},
-    {1527, 972, 1888, 1304, 1931, 2327, 2326, 0},
-    {1587, 1229, 1217, 868, 1928, 1932, 2325, 0},
-    {1587, 1371, 1229, 868, 1928, 1929, 1932, 0},
-    {1371, 1072, 1229, 869, 1929, 1930, 1932, 0},
-    {1894, 1844, 970, 1303, 1117, 2324, 1115, 0},
-    {1894, 1587, 1844, 1305, 1117, 1928, 2324, 0},
-    {1587, 1217, 1844, 1306, 1928, 2325, 2324, 0},
-    {1041, 1825, 1008, 1307, 1926, 1132, 1131, 0},
-    {1041, 1904, 1825, 1308, 1926, 1925, 1132, 0},
-    {1904, 1510, 1825, 1308, 1925, 1133, 1132, 0},
-    {915, 1041, 1008, 1309, 1921, 1926, 1131, 0},
-    {915, 861, 1041, 1310, 1921, 1923, 1926, 0},
-    {861, 1339, 1041, 1311, 1923, 1924, 1926, 0},
-    {1645, 1689, 443, 1312, 1922, 2369, 2370, 0},
-    {1645, 915, 1689, 1313, 1922, 1921, 2369, 0},
-    {915, 1008, 1689, 1314, 1921, 1131, 2369, 0},
-    {1171, 1625, 913, 1315, 1919, 1209, 1863, 0},
-    {1171, 1624, 1625, 544, 1919, 1918, 1209, 0},
-    {1624, 1152, 1625, 544, 1918, 1207, 1209, 0},
-    {1056, 1171, 913, 1316, 1915, 1919, 1863, 0},
-    {1056, 1151, 1171, 1316, 1915, 1916, 1919, 0},
-    {1151, 1163, 1171, 1317, 1916, 1917, 1919, 0},
-    {941, 1915, 1169, 1318, 1227, 1865, 1225, 0},
-    {941, 1056, 1915, 544, 1227, 1915, 1865, 0},
-    {1056, 913, 1915, 1317, 1915, 1863, 1865, 0},
-    {1181, 1535, 1453, 1319, 1914, 2371, 2372, 0},
-    {1181, 1085, 1535, 859, 1914, 1913, 2371, 0},
-    {1085, 1422, 1535, 859, 1913, 1186, 2371, 0},
-    {1372, 1181, 1453, 1320, 1910, 1914, 2372, 0},
-    {1372, 1251, 1181, 1321, 1910, 1911, 1914, 0},
-    {1251, 1485, 1181, 1322, 1911, 1912, 1914, 0},
-    {1717, 1917, 1439, 1323, 1813, 2373, 2374, 0},
-    {1717, 1372, 1917, 861, 1813, 1910, 2373, 0},
-    {1372, 1453, 1917, 861, 1910, 2372, 2373, 0},
-    {973, 1826, 1046, 1324, 1909, 2375, 2376, 0},
-    {973, 1718, 1826, 858, 1909, 1908, 2375, 0},
-    {1718, 1332, 1826, 1325, 1908, 1177, 2375, 0},
-    {1487, 973, 1046, 1326, 1905, 1909, 2376, 0},
-    {1487, 1114, 973, 1327, 1905, 1906, 1909, 0},
-    {1114, 1072, 973, 1328, 1906, 1907, 1909, 0},
-    {1168, 1919, 1349, 1329, 1826, 2377, 2378, 0},
-    {1168, 1487, 1919, 1330, 1826, 1905, 2377, 0},
-    {1487, 1046, 1919, 1331, 1905, 2376, 2377, 0},
-    {936, 1352, 1136, 537, 1904, 1228, 1821, 0},
-    {936, 1800, 1352, 1332, 1904, 1903, 1228, 0},
-    {1800, 972, 1352, 1333, 1903, 1183, 1228, 0},
-    {931, 936, 1136, 1334, 1900, 1904, 1821, 0},
-    {931, 1312, 936, 1335, 1900, 1901, 1904, 0},
-    {1312, 1254, 936, 1336, 1901, 1902, 1904, 0},
-    {1735, 1922, 989, 1337, 1224, 1823, 1222, 0},
-    {1735, 931, 1922, 1338, 1224, 1900, 1823, 0},
-    {931, 1136, 1922, 1338, 1900, 1821, 1823, 0},
-    {1325, 881, 1345, 1339, 1899, 2379, 2380, 0},
-    {1325, 1637, 881, 538, 1899, 1898, 2379, 0},
-    {1637, 882, 881, 1340, 1898, 1195, 2379, 0},
-    {1266, 1325, 1345, 1341, 1895, 1899, 2380, 0},
-    {1266, 1513, 1325, 1341, 1895, 1896, 1899, 0},
-    {1513, 1213, 1325, 853, 1896, 1897, 1899, 0},
-    {1358, 1924, 899, 853, 1776, 2381, 2382, 0},
-    {1358, 1266, 1924, 853, 1776, 1895, 2381, 0},
-    {1266, 1345, 1924, 853, 1895, 2380, 2381, 0},
-    {1267, 953, 1075, 1342, 1894, 1232, 1808, 0},
-    {1267, 1849, 953, 851, 1894, 1893, 1232, 0},
-    {1849, 1062, 953, 1343, 1893, 1180, 1232, 0},
-    {1303, 1267, 1075, 1342, 1890, 1894, 1808, 0},
-    {1303, 1117, 1267, 1344, 1890, 1891, 1894, 0},
-    {1117, 1050, 1267, 1345, 1891, 1892, 1894, 0},
-    {1692, 1926, 1079, 1346, 1231, 1810, 1229, 0},
-    {1692, 1303, 1926, 849, 1231, 1890, 1810, 0},
-    {1303, 1075, 1926, 849, 1890, 1808, 1810, 0},
-    {1337, 1783, 1484, 1347, 1889, 2383, 2384, 0},
-    {1337, 1714, 1783, 1348, 1889, 1888, 2383, 0},
-    {1714, 1242, 1783, 1349, 1888, 1192, 2383, 0},
-    {1288, 1337, 1484, 1350, 1885, 1889, 2384, 0},
-    {1288, 1016, 1337, 1351, 1885, 1886, 1889, 0},
-    {1016, 1219, 1337, 1352, 1886, 1887, 1889, 0},
-    {1553, 1928, 1259, 1353, 1235, 2385, 1233, 0},
-    {1553, 1288, 1928, 1354, 1235, 1885, 2385, 0},
-    {1288, 1484, 1928, 1355, 1885, 2384, 2385, 0},
-    {926, 1011, 944, 1356, 1884, 2386, 2387, 0},
-    {926, 1599, 1011, 844, 1884, 1883, 2386, 0},
-    {1599, 1109, 1011, 844, 1883, 1216, 2386, 0},
-    {1417, 926, 944, 1357, 1880, 1884, 2387, 0},
-    {1417, 1261, 926, 845, 1880, 1881, 1884, 0},
-    {1261, 1032, 926, 844, 1881, 1882, 1884, 0},
-    {962, 1930, 1128, 1358, 1247, 2388, 1245, 0},
-    {962, 1417, 1930, 1359, 1247, 1880, 2388, 0},
-    {1417, 944, 1930, 1360, 1880, 2387, 2388, 0},
-    {1174, 1596, 1214, 1361, 1879, 1251, 1764, 0},
-    {1174, 1111, 1596, 1362, 1879, 1878, 1251, 0},
-    {1111, 1379, 1596, 1362, 1878, 1219, 1251, 0},
-    {1245, 1174, 1214, 1363, 1875, 1879, 1764, 0},
-    {1245, 1299, 1174, 842, 1875, 1876, 1879, 0},
-    {1299, 1031, 1174, 1364, 1876, 1877, 1879, 0},
-    {1688, 1932, 1398, 1365, 1244, 1766, 1242, 0},
-    {1688, 1245, 1932, 1366, 1244, 1875, 1766, 0},
-    {1245, 1214, 1932, 1367, 1875, 1764, 1766, 0},
-    {1223, 896, 1142, 1368, 1874, 2389, 2390, 0},
-    {1223, 1760, 896, 840, 1874, 1873, 2389, 0},
-    {1760, 1289, 896, 840, 1873, 1198, 2389, 0},
-    {1381, 1223, 1142, 1368, 1870, 1874, 2390, 0},
-    {1381, 1425, 1223, 1369, 1870, 1871, 1874, 0},
-    {1425, 1049, 1223, 543, 1871, 1872, 1874, 0},
-    {1779, 1934, 1308, 1370, 1241, 2391, 1239, 0},
-    {1779, 1381, 1934, 1371, 1241, 1870, 2391, 0},
-    {1381, 1142, 1934, 840, 1870, 2390, 2391, 0},
-    {1375, 1731, 1322, 1372, 1869, 1212, 1858, 0},
-    {1375, 1824, 1731, 1373, 1869, 1868, 1212, 0},
-    {1824, 1512, 1731, 1374, 1868, 1210, 1212, 0},
-    {921, 1375, 1322, 836, 1864, 1869, 1858, 0},
-    {921, 1227, 1375, 1375, 1864, 1866, 1869, 0},
-    {1227, 1280, 1375, 837, 1866, 1867, 1869, 0},
-    {1915, 1935, 1169, 1376, 1865, 1860, 1225, 0},
-    {1915, 921, 1935, 1377, 1865, 1864, 1860, 0},
-    {921, 1322, 1935, 1378, 1864, 1858, 1860, 0},
-    {938, 987, 873, 1379, 1862, 2392, 2393, 0},
-    {938, 1644, 987, 834, 1862, 1399, 2392, 0},
-    {1644, 1529, 987, 1380, 1399, 1398, 2392, 0},
-    {991, 938, 873, 1381, 1859, 1862, 2393, 0},
-    {991, 1480, 938, 833, 1859, 1861, 1862, 0},
-    {1480, 1406, 938, 1380, 1861, 1424, 1862, 0},
-    {1935, 1134, 1169, 1382, 1860, 2394, 1225, 0},
-    {1935, 991, 1134, 1383, 1860, 1859, 2394, 0},
-    {991, 873, 1134, 1384, 1859, 2393, 2394, 0},
-    {2037, 1250, 1243, 1385, 1857, 2395, 1853, 0},
-    {1574, 1243, 917, 1386, 2396, 1853, 2397, 0},
-    {1022, 2037, 1574, 1387, 2398, 1857, 2396, 0},
-    {2038, 1053, 1623, 1388, 1855, 2399, 2400, 0},
-    {1335, 1623, 448, 1389, 2401, 2400, 2402, 0},
-    {917, 2038, 1335, 1390, 2397, 1855, 2401, 0},
-    {966, 1042, 449, 1391, 2403, 1852, 2404, 0},
-    {1053, 2039, 966, 1392, 2399, 1850, 2403, 0},
-    {1238, 1284, 2039, 1393, 1854, 2405, 1850, 0},
-    {992, 1713, 1009, 1394, 1849, 1248, 1771, 0},
-    {992, 1781, 1713, 828, 1849, 1848, 1248, 0},
-    {1781, 1469, 1713, 1395, 1848, 1189, 1248, 0},
-    {1180, 992, 1009, 1394, 1845, 1849, 1771, 0},
-    {1180, 1497, 992, 1396, 1845, 1846, 1849, 0},
-    {1497, 1143, 992, 1396, 1846, 1847, 1849, 0},
-    {876, 1939, 1488, 1397, 1238, 1773, 1236, 0},
-    {876, 1180, 1939, 1398, 1238, 1845, 1773, 0},
-    {1180, 1009, 1939, 1399, 1845, 1771, 1773, 0},
-    {1034, 1804, 1279, 1400, 1844, 2406, 2407, 0},
-    {1034, 1734, 1804, 824, 1844, 1843, 2406, 0},
-    {1734, 929, 1804, 548, 1843, 1204, 2406, 0},
-    {1396, 1034, 1279, 548, 1840, 1844, 2407, 0},
-    {1396, 874, 1034, 1401, 1840, 1841, 1844, 0},
-    {874, 1278, 1034, 1402, 1841, 1842, 1844, 0},
-    {1621, 1941, 948, 548, 1769, 2408, 2409, 0},
-    {1621, 1396, 1941, 1403, 1769, 1840, 2408, 0},
-    {1396, 1279, 1941, 1403, 1840, 2407, 2408, 0},
-    {1502, 1917, 1453, 1404, 1839, 2373, 2372, 0},
-    {1502, 1763, 1917, 1405, 1839, 1838, 2373, 0},
-    {1763, 1439, 1917, 1406, 1838, 2374, 2373, 0},
-    {975, 1502, 1453, 1404, 1835, 1839, 2372, 0},
-    {975, 1724, 1502, 1407, 1835, 1836, 1839, 0},
-    {1724, 1123, 1502, 1408, 1836, 1837, 1839, 0},
-    {1921, 1535, 1422, 1409, 1188, 2371, 1186, 0},
-    {1921, 975, 1535, 1409, 1188, 1835, 2371, 0},
-    {975, 1453, 1535, 1405, 1835, 2372, 2371, 0},
-    {1397, 1919, 1046, 1410, 1833, 2377, 2376, 0},
-    {1397, 1672, 1919, 1411, 1833, 1832, 2377, 0},
-    {1672, 1349, 1919, 1412, 1832, 2378, 2377, 0},
-    {1747, 1397, 1046, 1413, 1829, 1833, 2376, 0},
-    {1747, 923, 1397, 1414, 1829, 1830, 1833, 0},
-    {923, 1524, 1397, 1415, 1830, 1831, 1833, 0},
-    {1914, 1826, 1332, 1416, 1179, 2375, 1177, 0},
-    {1914, 1747, 1826, 1417, 1179, 1829, 2375, 0},
-    {1747, 1046, 1826, 1418, 1829, 2376, 2375, 0},
-    {1684, 1127, 1301, 1419, 1827, 2410, 2411, 0},
-    {1684, 1168, 1127, 1420, 1827, 1826, 2410, 0},
-    {1168, 1349, 1127, 1421, 1826, 2378, 2410, 0},
-    {1131, 1684, 1301, 1422, 1822, 1827, 2411, 0},
-    {1131, 1476, 1684, 1423, 1822, 1824, 1827, 0},
-    {1476, 866, 1684, 1424, 1824, 1825, 1827, 0},
-    {1922, 1088, 989, 1425, 1823, 2412, 1222, 0},
-    {1922, 1131, 1088, 1426, 1823, 1822, 2412, 0},
-    {1131, 1301, 1088, 1427, 1822, 2411, 2412, 0},
-    {1271, 1928, 1484, 1428, 1820, 2385, 2384, 0},
-    {1271, 1580, 1928, 1428, 1820, 1819, 2385, 0},
-    {1580, 1259, 1928, 1429, 1819, 1233, 2385, 0},
-    {856, 1271, 1484, 1428, 1816, 1820, 2384, 0},
-    {856, 1368, 1271, 1430, 1816, 1817, 1820, 0},
-    {1368, 1320, 1271, 1431, 1817, 1818, 1820, 0},
-    {1925, 1783, 1242, 1432, 1194, 2383, 1192, 0},
-    {1925, 856, 1783, 1433, 1194, 1816, 2383, 0},
-    {856, 1484, 1783, 1434, 1816, 2384, 2383, 0},
-    {904, 1690, 1395, 1435, 1814, 2413, 2414, 0},
-    {904, 1717, 1690, 1436, 1814, 1813, 2413, 0},
-    {1717, 1439, 1690, 1437, 1813, 2374, 2413, 0},
-    {1795, 904, 1395, 1438, 1809, 1814, 2414, 0},
-    {1795, 1564, 904, 1438, 1809, 1811, 1814, 0},
-    {1564, 1273, 904, 1439, 1811, 1812, 1814, 0},
-    {1926, 942, 1079, 1440, 1810, 2415, 1229, 0},
-    {1926, 1795, 942, 1441, 1810, 1809, 2415, 0},
-    {1795, 1395, 942, 1442, 1809, 2414, 2415, 0},
-    {1612, 1924, 1345, 1443, 1807, 2381, 2380, 0},
-    {1612, 1507, 1924, 554, 1807, 1806, 2381, 0},
-    {1507, 899, 1924, 1444, 1806, 2382, 2381, 0},
-    {1614, 1612, 1345, 1445, 1803, 1807, 2380, 0},
-    {1614, 1704, 1612, 1446, 1803, 1804, 1807, 0},
-    {1704, 1366, 1612, 1447, 1804, 1805, 1807, 0},
-    {1927, 881, 882, 1448, 1197, 2379, 1195, 0},
-    {1927, 1614, 881, 1449, 1197, 1803, 2379, 0},
-    {1614, 1345, 881, 1450, 1803, 2380, 2379, 0},
-    {1658, 1930, 944, 1451, 1801, 2388, 2387, 0},
-    {1658, 1000, 1930, 1452, 1801, 1800, 2388, 0},
-    {1000, 1128, 1930, 1453, 1800, 1245, 2388, 0},
-    {1333, 1658, 944, 1454, 1797, 1801, 2387, 0},
-    {1333, 1840, 1658, 1455, 1797, 1798, 1801, 0},
-    {1840, 1190, 1658, 1456, 1798, 1799, 1801, 0},
-    {1938, 1011, 1109, 1457, 1218, 2386, 1216, 0},
-    {1938, 1333, 1011, 1458, 1218, 1797, 2386, 0},
-    {1333, 944, 1011, 1459, 1797, 2387, 2386, 0},
-    {950, 1941, 1279, 1460, 1795, 2408, 2407, 0},
-    {950, 1228, 1941, 1461, 1795, 1794, 2408, 0},
-    {1228, 948, 1941, 1462, 1794, 2409, 2408, 0},
-    {1627, 950, 1279, 1463, 1791, 1795, 2407, 0},
-    {1627, 1023, 950, 1464, 1791, 1792, 1795, 0},
-    {1023, 1162, 950, 1465, 1792, 1793, 1795, 0},
-    {1933, 1804, 929, 1463, 1206, 2406, 1204, 0},
-    {1933, 1627, 1804, 1466, 1206, 1791, 2406, 0},
-    {1627, 1279, 1804, 1467, 1791, 2407, 2406, 0},
-    {1086, 1937, 1052, 1468, 1789, 2416, 2417, 0},
-    {1086, 1305, 1937, 1469, 1789, 1788, 2416, 0},
-    {1305, 1038, 1937, 1470, 1788, 1149, 2416, 0},
-    {1646, 1086, 1052, 1468, 1785, 1789, 2417, 0},
-    {1646, 1057, 1086, 1471, 1785, 1786, 1789, 0},
-    {1057, 1346, 1086, 1471, 1786, 1787, 1789, 0},
-    {1931, 1822, 1019, 1472, 1203, 2007, 1201, 0},
-    {1931, 1646, 1822, 1473, 1203, 1785, 2007, 0},
-    {1646, 1052, 1822, 1469, 1785, 2417, 2007, 0},
-    {1542, 1934, 1142, 1474, 1783, 2391, 2390, 0},
-    {1542, 1629, 1934, 1474, 1783, 1782, 2391, 0},
-    {1629, 1308, 1934, 1475, 1782, 1239, 2391, 0},
-    {1588, 1542, 1142, 1476, 1779, 1783, 2390, 0},
-    {1588, 1771, 1542, 1477, 1779, 1780, 1783, 0},
-    {1771, 1122, 1542, 1477, 1780, 1781, 1783, 0},
-    {1929, 896, 1289, 1478, 1200, 2389, 1198, 0},
-    {1929, 1588, 896, 1479, 1200, 1779, 2389, 0},
-    {1588, 1142, 896, 1480, 1779, 2390, 2389, 0},
-    {1632, 922, 1141, 1481, 1777, 2418, 2419, 0},
-    {1632, 1358, 922, 1482, 1777, 1776, 2418, 0},
-    {1358, 899, 922, 1483, 1776, 2382, 2418, 0},
-    {1020, 1632, 1141, 1484, 1772, 1777, 2419, 0},
-    {1020, 1356, 1632, 1484, 1772, 1774, 1777, 0},
-    {1356, 1525, 1632, 1485, 1774, 1775, 1777, 0},
-    {1939, 1812, 1488, 1486, 1773, 2420, 1236, 0},
-    {1939, 1020, 1812, 790, 1773, 1772, 2420, 0},
-    {1020, 1141, 1812, 1487, 1772, 2419, 2420, 0},
-    {1067, 1843, 871, 1488, 1770, 2421, 2422, 0},
-    {1067, 1621, 1843, 1489, 1770, 1769, 2421, 0},
-    {1621, 948, 1843, 1490, 1769, 2409, 2421, 0},
-    {1220, 1067, 871, 1491, 1765, 1770, 2422, 0},
-    {1220, 999, 1067, 1492, 1765, 1767, 1770, 0},
-    {999, 919, 1067, 1493, 1767, 1768, 1770, 0},
-    {1932, 1721, 1398, 1494, 1766, 2423, 1242, 0},
-    {1932, 1220, 1721, 787, 1766, 1765, 2423, 0},
-    {1220, 871, 1721, 1495, 1765, 2422, 2423, 0},
-    {2040, 1070, 1327, 1496, 1763, 2424, 1758, 0},
-    {1757, 1327, 1097, 1497, 2425, 1758, 2426, 0},
-    {1038, 2040, 1757, 1498, 2427, 1763, 2425, 0},
-    {2041, 1433, 1807, 1499, 1760, 2428, 2429, 0},
-    {1539, 1807, 446, 1500, 2430, 2429, 2431, 0},
-    {1097, 2041, 1539, 1501, 2426, 1760, 2430, 0},
-    {1648, 1540, 447, 1502, 2432, 1757, 2433, 0},
-    {1433, 2042, 1648, 1503, 2428, 1755, 2432, 0},
-    {869, 1115, 2042, 1504, 1759, 2434, 1755, 0},
-    {1816, 1755, 1459, 1505, 1754, 1311, 1618, 0},
-    {1816, 1943, 1755, 783, 1754, 1660, 1311, 0},
-    {1943, 989, 1755, 1506, 1660, 1309, 1311, 0},
-    {1751, 1816, 1459, 1507, 1751, 1754, 1618, 0},
-    {1751, 1725, 1816, 1508, 1751, 1753, 1754, 0},
-    {1725, 872, 1816, 1509, 1753, 1658, 1754, 0},
-    {1827, 1944, 1350, 1510, 1752, 1620, 1269, 0},
-    {1827, 1751, 1944, 1511, 1752, 1751, 1620, 0},
-    {1751, 1459, 1944, 564, 1751, 1618, 1620, 0},
-    {1616, 1836, 1365, 1512, 1749, 1700, 1699, 0},
-    {1616, 1581, 1836, 1513, 1749, 1748, 1700, 0},
-    {1581, 1260, 1836, 1514, 1748, 2435, 1700, 0},
-    {1252, 1616, 1365, 780, 1745, 1749, 1699, 0},
-    {1252, 937, 1616, 1515, 1745, 1746, 1749, 0},
-    {937, 1500, 1616, 1516, 1746, 1747, 1749, 0},
-    {1664, 1946, 1079, 1517, 1707, 1280, 1279, 0},
-    {1664, 1252, 1946, 779, 1707, 1745, 1280, 0},
-    {1252, 1365, 1946, 779, 1745, 1699, 1280, 0},
-    {1212, 1464, 1095, 1518, 1744, 2436, 2437, 0},
-    {1212, 996, 1464, 778, 1744, 1743, 2436, 0},
-    {996, 1129, 1464, 1519, 1743, 2438, 2436, 0},
-    {1498, 1212, 1095, 1520, 1740, 1744, 2437, 0},
-    {1498, 1126, 1212, 777, 1740, 1741, 1744, 0},
-    {1126, 1010, 1212, 1521, 1741, 1742, 1744, 0},
-    {1654, 1948, 1488, 1522, 1677, 2439, 2440, 0},
-    {1654, 1498, 1948, 1523, 1677, 1740, 2439, 0},
-    {1498, 1095, 1948, 1524, 1740, 2437, 2439, 0},
-    {897, 1562, 1408, 769, 1739, 1726, 1725, 0},
-    {897, 1949, 1562, 1525, 1739, 1704, 1726, 0},
-    {1949, 1439, 1562, 1526, 1704, 2441, 1726, 0},
-    {1324, 897, 1408, 1527, 1736, 1739, 1725, 0},
-    {1324, 1838, 897, 774, 1736, 1738, 1739, 0},
-    {1838, 1048, 897, 775, 1738, 1702, 1739, 0},
-    {1598, 1950, 1440, 769, 1737, 1273, 1272, 0},
-    {1598, 1324, 1950, 1528, 1737, 1736, 1273, 0},
-    {1324, 1408, 1950, 567, 1736, 1725, 1273, 0},
-    {1842, 901, 1138, 1529, 1734, 1651, 1650, 0},
-    {1842, 1951, 901, 772, 1734, 1733, 1651, 0},
-    {1951, 1349, 901, 1530, 1733, 2442, 1651, 0},
-    {1852, 1842, 1138, 1529, 1729, 1734, 1650, 0},
-    {1852, 1660, 1842, 1531, 1729, 1731, 1734, 0},
-    {1660, 1318, 1842, 1532, 1731, 1732, 1734, 0},
-    {1528, 1952, 1170, 1530, 1730, 1297, 1296, 0},
-    {1528, 1852, 1952, 1533, 1730, 1729, 1297, 0},
-    {1852, 1138, 1952, 1534, 1729, 1650, 1297, 0},
-    {1788, 1609, 1030, 1535, 1727, 1663, 1662, 0},
-    {1788, 1562, 1609, 1536, 1727, 1726, 1663, 0},
-    {1562, 1439, 1609, 1537, 1726, 2441, 1663, 0},
-    {1090, 1788, 1030, 1538, 1722, 1727, 1662, 0},
-    {1090, 1558, 1788, 1539, 1722, 1724, 1727, 0},
-    {1558, 1408, 1788, 1539, 1724, 1725, 1727, 0},
-    {907, 1953, 990, 1540, 1723, 1292, 1258, 0},
-    {907, 1090, 1953, 1541, 1723, 1722, 1292, 0},
-    {1090, 1030, 1953, 1542, 1722, 1662, 1292, 0},
-    {1708, 1669, 1276, 1543, 1720, 2443, 2444, 0},
-    {1708, 1955, 1669, 1544, 1720, 1719, 2443, 0},
-    {1955, 1260, 1669, 1544, 1719, 2435, 2443, 0},
-    {1772, 1708, 1276, 1543, 1716, 1720, 2444, 0},
-    {1772, 908, 1708, 1543, 1716, 1717, 1720, 0},
-    {908, 1300, 1708, 1545, 1717, 1718, 1720, 0},
-    {1701, 1501, 900, 1546, 1714, 2445, 1285, 0},
-    {1701, 1772, 1501, 1547, 1714, 1716, 2445, 0},
-    {1772, 1276, 1501, 1548, 1716, 2444, 2445, 0},
-    {1496, 1222, 1120, 1549, 1715, 1287, 1679, 0},
-    {1496, 1701, 1222, 1550, 1715, 1714, 1287, 0},
-    {1701, 900, 1222, 1551, 1714, 1285, 1287, 0},
-    {1636, 1496, 1120, 1552, 1710, 1715, 1679, 0},
-    {1636, 1818, 1496, 1553, 1710, 1712, 1715, 0},
-    {1818, 1390, 1496, 763, 1712, 1713, 1715, 0},
-    {1507, 1956, 899, 1554, 1711, 1681, 2446, 0},
-    {1507, 1636, 1956, 1555, 1711, 1710, 1681, 0},
-    {1636, 1120, 1956, 1556, 1710, 1679, 1681, 0},
-    {1727, 942, 1395, 1557, 1708, 2447, 2448, 0},
-    {1727, 1664, 942, 1558, 1708, 1707, 2447, 0},
-    {1664, 1079, 942, 1559, 1707, 1279, 2447, 0},
-    {841, 1727, 1395, 1560, 1703, 1708, 2448, 0},
-    {841, 878, 1727, 1561, 1703, 1705, 1708, 0},
-    {878, 1005, 1727, 1562, 1705, 1706, 1708, 0},
-    {1949, 1690, 1439, 1563, 1704, 2449, 2441, 0},
-    {1949, 841, 1690, 1564, 1704, 1703, 2449, 0},
-    {841, 1395, 1690, 1565, 1703, 2448, 2449, 0},
-    {886, 1955, 1300, 1566, 1701, 1719, 1718, 0},
-    {886, 1836, 1955, 1567, 1701, 1700, 1719, 0},
-    {1836, 1260, 1955, 1568, 1700, 2435, 1719, 0},
-    {1436, 886, 1300, 1569, 1696, 1701, 1718, 0},
-    {1436, 1370, 886, 1570, 1696, 1698, 1701, 0},
-    {1370, 1365, 886, 1571, 1698, 1699, 1701, 0},
-    {1580, 1402, 1259, 1572, 1697, 1276, 1275, 0},
-    {1580, 1436, 1402, 1573, 1697, 1696, 1276, 0},
-    {1436, 1300, 1402, 1574, 1696, 1718, 1276, 0},
-    {2043, 939, 1592, 1575, 1694, 2450, 1689, 0},
-    {1666, 1592, 1457, 1576, 2451, 1689, 2452, 0},
-    {1039, 2043, 1666, 1577, 2305, 1694, 2451, 0},
-    {2044, 1253, 1575, 1578, 1691, 2453, 2454, 0},
-    {1540, 1575, 447, 1579, 2455, 2454, 2456, 0},
-    {1457, 2044, 1540, 753, 2452, 1691, 2455, 0},
-    {1633, 1335, 448, 491, 2457, 1688, 2458, 0},
-    {1253, 2045, 1633, 491, 2453, 1686, 2457, 0},
-    {1191, 1363, 2045, 752, 1690, 2459, 1686, 0},
-    {1204, 1723, 1341, 1580, 1685, 1288, 1672, 0},
-    {1204, 1813, 1723, 751, 1685, 1684, 1288, 0},
-    {1813, 1489, 1723, 749, 1684, 1264, 1288, 0},
-    {1802, 1204, 1341, 1581, 1680, 1685, 1672, 0},
-    {1802, 1207, 1204, 1582, 1680, 1682, 1685, 0},
-    {1207, 1321, 1204, 749, 1682, 1683, 1685, 0},
-    {1956, 1959, 899, 749, 1681, 1674, 2446, 0},
-    {1956, 1802, 1959, 749, 1681, 1680, 1674, 0},
-    {1802, 1341, 1959, 1583, 1680, 1672, 1674, 0},
-    {1077, 1812, 1141, 1584, 1678, 2460, 2461, 0},
-    {1077, 1654, 1812, 1585, 1678, 1677, 2460, 0},
-    {1654, 1488, 1812, 1586, 1677, 2440, 2460, 0},
-    {1015, 1077, 1141, 1587, 1673, 1678, 2461, 0},
-    {1015, 1549, 1077, 1588, 1673, 1675, 1678, 0},
-    {1549, 1275, 1077, 1589, 1675, 1676, 1678, 0},
-    {1959, 922, 899, 1590, 1674, 2462, 2446, 0},
-    {1959, 1015, 922, 1591, 1674, 1673, 2462, 0},
-    {1015, 1141, 922, 1592, 1673, 2461, 2462, 0},
-    {1572, 1948, 1095, 1593, 1671, 2439, 2437, 0},
-    {1572, 1733, 1948, 1594, 1671, 1670, 2439, 0},
-    {1733, 1488, 1948, 1595, 1670, 2440, 2439, 0},
-    {1105, 1572, 1095, 1596, 1666, 1671, 2437, 0},
-    {1105, 969, 1572, 1597, 1666, 1668, 1671, 0},
-    {969, 1190, 1572, 1598, 1668, 1669, 1671, 0},
-    {1306, 1464, 1129, 1599, 1667, 2436, 2438, 0},
-    {1306, 1105, 1464, 1600, 1667, 1666, 2436, 0},
-    {1105, 1095, 1464, 1596, 1666, 2437, 2436, 0},
-    {909, 1763, 1123, 1601, 1664, 2463, 2464, 0},
-    {909, 1609, 1763, 1602, 1664, 1663, 2463, 0},
-    {1609, 1439, 1763, 1603, 1663, 2441, 2463, 0},
-    {1226, 909, 1123, 1604, 1659, 1664, 2464, 0},
-    {1226, 1224, 909, 1605, 1659, 1661, 1664, 0},
-    {1224, 1030, 909, 1606, 1661, 1662, 1664, 0},
-    {1943, 1709, 989, 1607, 1660, 2465, 1309, 0},
-    {1943, 1226, 1709, 1608, 1660, 1659, 2465, 0},
-    {1226, 1123, 1709, 1609, 1659, 2464, 2465, 0},
-    {1156, 887, 1331, 1610, 1657, 2466, 2467, 0},
-    {1156, 1474, 887, 1611, 1657, 1656, 2466, 0},
-    {1474, 1170, 887, 1612, 1656, 1296, 2466, 0},
-    {850, 1156, 1331, 1610, 1653, 1657, 2467, 0},
-    {850, 1531, 1156, 1613, 1653, 1654, 1657, 0},
-    {1531, 1413, 1156, 1610, 1654, 1655, 1657, 0},
-    {1960, 1962, 1529, 1614, 1414, 2468, 1404, 0},
-    {1960, 850, 1962, 1615, 1414, 1653, 2468, 0},
-    {850, 1331, 1962, 1616, 1653, 2467, 2468, 0},
-    {877, 1672, 1524, 1617, 1652, 2469, 2470, 0},
-    {877, 901, 1672, 737, 1652, 1651, 2469, 0},
-    {901, 1349, 1672, 1618, 1651, 2442, 2469, 0},
-    {1092, 877, 1524, 1619, 1648, 1652, 2470, 0},
-    {1092, 1456, 877, 1620, 1648, 1649, 1652, 0},
-    {1456, 1138, 877, 1621, 1649, 1650, 1652, 0},
-    {1541, 1534, 1169, 1622, 1308, 2471, 1306, 0},
-    {1541, 1092, 1534, 1623, 1308, 1648, 2471, 0},
-    {1092, 1524, 1534, 1618, 1648, 2470, 2471, 0},
-    {1210, 1961, 1511, 1624, 1647, 1291, 1665, 0},
-    {1210, 1964, 1961, 1624, 1647, 1646, 1291, 0},
-    {1964, 1128, 1961, 1625, 1646, 1289, 1291, 0},
-    {1603, 1210, 1511, 1626, 1642, 1647, 1665, 0},
-    {1603, 1167, 1210, 1627, 1642, 1644, 1647, 0},
-    {1167, 1061, 1210, 1628, 1644, 1645, 1647, 0},
-    {1758, 1306, 1129, 1629, 1643, 1667, 2438, 0},
-    {1758, 1603, 1306, 1630, 1643, 1642, 1667, 0},
-    {1603, 1511, 1306, 734, 1642, 1665, 1667, 0},
-    {1695, 1964, 1061, 1631, 1640, 1646, 1645, 0},
-    {1695, 1427, 1964, 1632, 1640, 1639, 1646, 0},
-    {1427, 1128, 1964, 1633, 1639, 1289, 1646, 0},
-    {902, 1695, 1061, 1634, 1636, 1640, 1645, 0},
-    {902, 1647, 1695, 1635, 1636, 1637, 1640, 0},
-    {1647, 1122, 1695, 1636, 1637, 1638, 1640, 0},
-    {1678, 1769, 1309, 1637, 1634, 1300, 1299, 0},
-    {1678, 902, 1769, 1638, 1634, 1636, 1300, 0},
-    {902, 1061, 1769, 1639, 1636, 1645, 1300, 0},
-    {1466, 1035, 1342, 1640, 1635, 2472, 2473, 0},
-    {1466, 1678, 1035, 1641, 1635, 1634, 2472, 0},
-    {1678, 1309, 1035, 1642, 1634, 1299, 2472, 0},
-    {1615, 1466, 1342, 1643, 1631, 1635, 2473, 0},
-    {1615, 1461, 1466, 1644, 1631, 1632, 1635, 0},
-    {1461, 1241, 1466, 1645, 1632, 1633, 1635, 0},
-    {1369, 1362, 949, 1646, 1314, 2474, 1312, 0},
-    {1369, 1615, 1362, 1647, 1314, 1631, 2474, 0},
-    {1615, 1342, 1362, 1641, 1631, 2473, 2474, 0},
-    {1173, 1962, 1331, 1648, 1630, 2468, 2467, 0},
-    {1173, 987, 1962, 1649, 1630, 1629, 2468, 0},
-    {987, 1529, 1962, 1650, 1629, 1404, 2468, 0},
-    {1774, 1173, 1331, 1651, 1626, 1630, 2467, 0},
-    {1774, 1311, 1173, 1652, 1626, 1627, 1630, 0},
-    {1311, 873, 1173, 1653, 1627, 1628, 1630, 0},
-    {1963, 887, 1170, 1654, 1298, 2466, 1296, 0},
-    {1963, 1774, 887, 1654, 1298, 1626, 2466, 0},
-    {1774, 1331, 887, 1655, 1626, 2467, 2466, 0},
-    {1544, 1951, 1318, 1656, 1624, 1733, 1732, 0},
-    {1544, 1127, 1951, 1657, 1624, 1623, 1733, 0},
-    {1127, 1349, 1951, 1658, 1623, 2442, 1733, 0},
-    {1248, 1544, 1318, 1659, 1619, 1624, 1732, 0},
-    {1248, 1066, 1544, 1660, 1619, 1621, 1624, 0},
-    {1066, 1301, 1544, 1661, 1621, 1622, 1624, 0},
-    {1944, 1792, 1350, 1662, 1620, 1270, 1269, 0},
-    {1944, 1248, 1792, 1663, 1620, 1619, 1270, 0},
-    {1248, 1318, 1792, 1659, 1619, 1732, 1270, 0},
-    {979, 1228, 1162, 1664, 1617, 2475, 2476, 0},
-    {979, 1967, 1228, 1665, 1617, 1616, 2475, 0},
-    {1967, 948, 1228, 1666, 1616, 2477, 2475, 0},
-    {890, 979, 1162, 1667, 1613, 1617, 2476, 0},
-    {890, 1817, 979, 1668, 1613, 1614, 1617, 0},
-    {1817, 1108, 979, 1669, 1614, 1615, 1617, 0},
-    {1966, 1809, 1308, 1670, 1305, 2478, 1302, 0},
-    {1966, 890, 1809, 1671, 1305, 1613, 2478, 0},
-    {890, 1162, 1809, 1672, 1613, 2476, 2478, 0},
-    {1021, 1721, 871, 1673, 1611, 2479, 2480, 0},
-    {1021, 1969, 1721, 1674, 1611, 1011, 2479, 0},
-    {1969, 1398, 1721, 1675, 1011, 1010, 2479, 0},
-    {1750, 1021, 871, 1676, 1608, 1611, 2480, 0},
-    {1750, 851, 1021, 1677, 1608, 1609, 1611, 0},
-    {851, 1378, 1021, 1678, 1609, 1610, 1611, 0},
-    {1663, 1843, 948, 1679, 1599, 2481, 2477, 0},
-    {1663, 1750, 1843, 1680, 1599, 1608, 2481, 0},
-    {1750, 871, 1843, 1681, 1608, 2480, 2481, 0},
-    {870, 1957, 1071, 1682, 1607, 2482, 2483, 0},
-    {870, 1970, 1957, 1683, 1607, 1606, 2482, 0},
-    {1970, 1039, 1957, 1684, 1606, 1256, 2482, 0},
-    {1029, 870, 1071, 1685, 1602, 1607, 2483, 0},
-    {1029, 848, 870, 1686, 1602, 1604, 1607, 0},
-    {848, 1198, 870, 1687, 1604, 1605, 1607, 0},
-    {1305, 1814, 1038, 1688, 1603, 1761, 2427, 0},
-    {1305, 1029, 1814, 1689, 1603, 1602, 1761, 0},
-    {1029, 1071, 1814, 1690, 1602, 2483, 1761, 0},
-    {1569, 1967, 1108, 1691, 1600, 1616, 1615, 0},
-    {1569, 1663, 1967, 1692, 1600, 1599, 1616, 0},
-    {1663, 948, 1967, 1693, 1599, 2477, 1616, 0},
-    {1481, 1569, 1108, 1694, 1595, 1600, 1615, 0},
-    {1481, 1157, 1569, 1695, 1595, 1597, 1600, 0},
-    {1157, 928, 1569, 1695, 1597, 1598, 1600, 0},
-    {1661, 1845, 949, 1696, 1596, 1313, 1312, 0},
-    {1661, 1481, 1845, 1697, 1596, 1595, 1313, 0},
-    {1481, 1108, 1845, 1694, 1595, 1615, 1313, 0},
-    {1165, 857, 983, 1698, 1593, 2484, 2485, 0},
-    {1165, 1973, 857, 1699, 1593, 1442, 2484, 0},
-    {1973, 1150, 857, 1700, 1442, 2486, 2484, 0},
-    {1293, 1165, 983, 1701, 1590, 1593, 2485, 0},
-    {1293, 1063, 1165, 1701, 1590, 1592, 1593, 0},
-    {1063, 1130, 1165, 1702, 1592, 1440, 1593, 0},
-    {963, 1653, 1330, 590, 1591, 2487, 2488, 0},
-    {963, 1293, 1653, 1703, 1591, 1590, 2487, 0},
-    {1293, 983, 1653, 1704, 1590, 2485, 2487, 0},
-    {1522, 1595, 1400, 1705, 1588, 2489, 2490, 0},
-    {1522, 1974, 1595, 1706, 1588, 1535, 2489, 0},
-    {1974, 1244, 1595, 1707, 1535, 2491, 2489, 0},
-    {1521, 1522, 1400, 1708, 1585, 1588, 2490, 0},
-    {1521, 958, 1522, 1709, 1585, 1587, 1588, 0},
-    {958, 1310, 1522, 1710, 1587, 1533, 1588, 0},
-    {1089, 1975, 1060, 1711, 1586, 2492, 1348, 0},
-    {1089, 1521, 1975, 1712, 1586, 1585, 2492, 0},
-    {1521, 1400, 1975, 1713, 1585, 2490, 2492, 0},
-    {1099, 1548, 1175, 1714, 1583, 1384, 1461, 0},
-    {1099, 1976, 1548, 1715, 1583, 1582, 1384, 0},
-    {1976, 974, 1548, 1716, 1582, 1382, 1384, 0},
-    {1831, 1099, 1175, 1714, 1578, 1583, 1461, 0},
-    {1831, 906, 1099, 1717, 1578, 1580, 1583, 0},
-    {906, 1040, 1099, 1718, 1580, 1581, 1583, 0},
-    {1626, 1977, 1330, 1719, 1579, 1463, 2488, 0},
-    {1626, 1831, 1977, 1720, 1579, 1578, 1463, 0},
-    {1831, 1175, 1977, 1720, 1578, 1461, 1463, 0},
-    {952, 946, 1074, 1721, 1576, 2493, 2494, 0},
-    {952, 1979, 946, 1722, 1576, 1449, 2493, 0},
-    {1979, 970, 946, 1723, 1449, 1328, 2493, 0},
-    {1437, 952, 1074, 1724, 1573, 1576, 2494, 0},
-    {1437, 1794, 952, 1725, 1573, 1575, 1576, 0},
-    {1794, 860, 952, 1726, 1575, 1447, 1576, 0},
-    {934, 1744, 1420, 1727, 1574, 2495, 2496, 0},
-    {934, 1437, 1744, 1728, 1574, 1573, 2495, 0},
-    {1437, 1074, 1744, 1729, 1573, 2494, 2495, 0},
-    {1698, 1821, 905, 1730, 1571, 1506, 1505, 0},
-    {1698, 1164, 1821, 1730, 1571, 1570, 1506, 0},
-    {1164, 1107, 1821, 1731, 1570, 1342, 1506, 0},
-    {1789, 1698, 905, 1730, 1567, 1571, 1505, 0},
-    {1789, 1606, 1698, 695, 1567, 1568, 1571, 0},
-    {1606, 855, 1698, 695, 1568, 1569, 1571, 0},
-    {1639, 1981, 1472, 1730, 1365, 1366, 1363, 0},
-    {1639, 1789, 1981, 1730, 1365, 1567, 1366, 0},
-    {1789, 905, 1981, 1730, 1567, 1505, 1366, 0},
-    {1559, 1504, 1520, 1732, 1566, 2497, 2498, 0},
-    {1559, 1179, 1504, 1732, 1566, 1565, 2497, 0},
-    {1179, 927, 1504, 1733, 1565, 1351, 2497, 0},
-    {1710, 1559, 1520, 1734, 1562, 1566, 2498, 0},
-    {1710, 1618, 1559, 1735, 1562, 1563, 1566, 0},
-    {1618, 1096, 1559, 1735, 1563, 1564, 1566, 0},
-    {1462, 1983, 1292, 693, 1499, 2499, 2500, 0},
-    {1462, 1710, 1983, 1736, 1499, 1562, 2499, 0},
-    {1710, 1520, 1983, 1737, 1562, 2498, 2499, 0},
-    {1216, 1571, 1184, 1738, 1561, 1368, 1494, 0},
-    {1216, 1608, 1571, 1738, 1561, 1560, 1368, 0},
-    {1608, 1287, 1571, 1739, 1560, 1337, 1368, 0},
-    {1421, 1216, 1184, 1740, 1556, 1561, 1494, 0},
-    {1421, 1767, 1216, 1741, 1556, 1558, 1561, 0},
-    {1767, 852, 1216, 1742, 1558, 1559, 1561, 0},
-    {1754, 1987, 1112, 689, 1557, 1496, 2501, 0},
-    {1754, 1421, 1987, 689, 1557, 1556, 1496, 0},
-    {1421, 1184, 1987, 1740, 1556, 1494, 1496, 0},
-    {1347, 842, 914, 1743, 1554, 1381, 1468, 0},
-    {1347, 954, 842, 1744, 1554, 1553, 1381, 0},
-    {954, 1017, 842, 1745, 1553, 1214, 1381, 0},
-    {1832, 1347, 914, 1746, 1550, 1554, 1468, 0},
-    {1832, 1078, 1347, 1747, 1550, 1551, 1554, 0},
-    {1078, 1391, 1347, 1748, 1551, 1552, 1554, 0},
-    {1620, 1989, 1382, 1749, 1459, 1470, 2502, 0},
-    {1620, 1832, 1989, 1750, 1459, 1550, 1470, 0},
-    {1832, 914, 1989, 1751, 1550, 1468, 1470, 0},
-    {1385, 1815, 1454, 684, 1549, 1377, 1481, 0},
-    {1385, 1990, 1815, 1752, 1549, 1378, 1377, 0},
-    {1990, 1064, 1815, 1753, 1378, 1375, 1377, 0},
-    {898, 1385, 1454, 1754, 1546, 1549, 1481, 0},
-    {898, 1304, 1385, 1754, 1546, 1548, 1549, 0},
-    {1304, 1274, 1385, 1755, 1548, 1479, 1549, 0},
-    {1736, 1991, 1420, 1756, 1547, 1483, 2496, 0},
-    {1736, 898, 1991, 1757, 1547, 1546, 1483, 0},
-    {898, 1454, 1991, 1758, 1546, 1481, 1483, 0},
-    {1740, 1761, 1047, 1759, 1544, 1385, 1454, 0},
-    {1740, 1700, 1761, 1760, 1544, 1543, 1385, 0},
-    {1700, 1377, 1761, 1761, 1543, 1345, 1385, 0},
-    {1482, 1740, 1047, 1762, 1540, 1544, 1454, 0},
-    {1482, 997, 1740, 1763, 1540, 1541, 1544, 0},
-    {997, 918, 1740, 1764, 1541, 1542, 1544, 0},
-    {1670, 1993, 932, 1765, 1371, 1456, 1369, 0},
-    {1670, 1482, 1993, 1765, 1371, 1540, 1456, 0},
-    {1482, 1047, 1993, 1766, 1540, 1454, 1456, 0},
-    {1557, 1810, 1407, 1767, 1539, 1357, 1526, 0},
-    {1557, 1146, 1810, 1768, 1539, 1538, 1357, 0},
-    {1146, 880, 1810, 1769, 1538, 1355, 1357, 0},
-    {956, 1557, 1407, 1770, 1534, 1539, 1526, 0},
-    {956, 1281, 1557, 1771, 1534, 1536, 1539, 0},
-    {1281, 1197, 1557, 1772, 1536, 1537, 1539, 0},
-    {1974, 1994, 1244, 1773, 1535, 1528, 2491, 0},
-    {1974, 956, 1994, 1774, 1535, 1534, 1528, 0},
-    {956, 1407, 1994, 1770, 1534, 1526, 1528, 0},
-    {925, 1508, 1006, 1775, 1532, 2503, 2504, 0},
-    {925, 1995, 1508, 1776, 1532, 1531, 2503, 0},
-    {1995, 884, 1508, 1777, 1531, 2505, 2503, 0},
-    {1269, 925, 1006, 1778, 1527, 1532, 2504, 0},
-    {1269, 1172, 925, 1779, 1527, 1529, 1532, 0},
-    {1172, 1317, 925, 1780, 1529, 1530, 1532, 0},
-    {1994, 935, 1244, 1781, 1528, 2506, 2491, 0},
-    {1994, 1269, 935, 1781, 1528, 1527, 2506, 0},
-    {1269, 1006, 935, 1782, 1527, 2504, 2506, 0},
-    {1532, 1737, 849, 1783, 1525, 2507, 2508, 0},
-    {1532, 988, 1737, 1784, 1525, 1524, 2507, 0},
-    {988, 1150, 1737, 1785, 1524, 2486, 2507, 0},
-    {1024, 1532, 849, 1786, 1521, 1525, 2508, 0},
-    {1024, 843, 1532, 1787, 1521, 1522, 1525, 0},
-    {843, 920, 1532, 1788, 1522, 1523, 1525, 0},
-    {1828, 1997, 1514, 1789, 1431, 2509, 1372, 0},
-    {1828, 1024, 1997, 1790, 1431, 1521, 2509, 0},
-    {1024, 849, 1997, 1791, 1521, 2508, 2509, 0},
-    {1550, 1995, 1317, 1792, 1520, 1531, 1530, 0},
-    {1550, 1998, 1995, 1793, 1520, 1519, 1531, 0},
-    {1998, 884, 1995, 1794, 1519, 2505, 1531, 0},
-    {1573, 1550, 1317, 1792, 1515, 1520, 1530, 0},
-    {1573, 891, 1550, 670, 1515, 1517, 1520, 0},
-    {891, 1209, 1550, 1795, 1517, 1518, 1520, 0},
-    {1819, 1719, 880, 1796, 1516, 1356, 1355, 0},
-    {1819, 1573, 1719, 1797, 1516, 1515, 1356, 0},
-    {1573, 1317, 1719, 1797, 1515, 1530, 1356, 0},
-    {1329, 1998, 1209, 1798, 1513, 1519, 1518, 0},
-    {1329, 1728, 1998, 668, 1513, 1512, 1519, 0},
-    {1728, 884, 1998, 1799, 1512, 2505, 1519, 0},
-    {1491, 1329, 1209, 1798, 1509, 1513, 1518, 0},
-    {1491, 1582, 1329, 1800, 1509, 1510, 1513, 0},
-    {1582, 853, 1329, 668, 1510, 1511, 1513, 0},
-    {1980, 1555, 1467, 605, 1336, 1361, 1334, 0},
-    {1980, 1491, 1555, 605, 1336, 1509, 1361, 0},
-    {1491, 1209, 1555, 668, 1509, 1518, 1361, 0},
-    {883, 1986, 980, 1801, 1507, 1344, 1555, 0},
-    {883, 1821, 1986, 1802, 1507, 1506, 1344, 0},
-    {1821, 1107, 1986, 1802, 1506, 1342, 1344, 0},
-    {1679, 883, 980, 1803, 1502, 1507, 1555, 0},
-    {1679, 1770, 883, 1804, 1502, 1504, 1507, 0},
-    {1770, 905, 883, 1805, 1504, 1505, 1507, 0},
-    {839, 1754, 1112, 1806, 1503, 1557, 2501, 0},
-    {839, 1679, 1754, 666, 1503, 1502, 1557, 0},
-    {1679, 980, 1754, 666, 1502, 1555, 1557, 0},
-    {1604, 1613, 1392, 1807, 1500, 2510, 2511, 0},
-    {1604, 1462, 1613, 1808, 1500, 1499, 2510, 0},
-    {1462, 1292, 1613, 1809, 1499, 2500, 2510, 0},
-    {1538, 1604, 1392, 1807, 1495, 1500, 2511, 0},
-    {1538, 1110, 1604, 663, 1495, 1497, 1500, 0},
-    {1110, 1265, 1604, 1810, 1497, 1498, 1500, 0},
-    {1987, 1782, 1112, 1811, 1496, 2512, 2501, 0},
-    {1987, 1538, 1782, 1811, 1496, 1495, 2512, 0},
-    {1538, 1392, 1782, 1812, 1495, 2511, 2512, 0},
-    {1628, 1983, 1520, 1813, 1493, 2499, 2498, 0},
-    {1628, 1577, 1983, 1814, 1493, 1492, 2499, 0},
-    {1577, 1292, 1983, 661, 1492, 2500, 2499, 0},
-    {1383, 1628, 1520, 1815, 1489, 1493, 2498, 0},
-    {1383, 1762, 1628, 1816, 1489, 1490, 1493, 0},
-    {1762, 1409, 1628, 1817, 1490, 1491, 1493, 0},
-    {1992, 1504, 927, 1818, 1353, 2497, 1351, 0},
-    {1992, 1383, 1504, 1814, 1353, 1489, 2497, 0},
-    {1383, 1520, 1504, 1819, 1489, 2498, 2497, 0},
-    {1853, 1978, 995, 1820, 1487, 1333, 1572, 0},
-    {1853, 1262, 1978, 659, 1487, 1486, 1333, 0},
-    {1262, 1424, 1978, 1821, 1486, 1331, 1333, 0},
-    {1556, 1853, 995, 1822, 1482, 1487, 1572, 0},
-    {1556, 1211, 1853, 1823, 1482, 1484, 1487, 0},
-    {1211, 1125, 1853, 1824, 1484, 1485, 1487, 0},
-    {1991, 934, 1420, 1825, 1483, 1574, 2496, 0},
-    {1991, 1556, 934, 1826, 1483, 1482, 1574, 0},
-    {1556, 995, 934, 1827, 1482, 1572, 1574, 0},
-    {1786, 1975, 1400, 657, 1480, 2492, 2490, 0},
-    {1786, 1680, 1975, 657, 1480, 1349, 2492, 0},
-    {1680, 1060, 1975, 1828, 1349, 1348, 2492, 0},
-    {875, 1786, 1400, 1829, 1476, 1480, 2490, 0},
-    {875, 947, 1786, 1829, 1476, 1478, 1480, 0},
-    {947, 1274, 1786, 1830, 1478, 1479, 1480, 0},
-    {1565, 1595, 1244, 1831, 1477, 2489, 2491, 0},
-    {1565, 875, 1595, 1831, 1477, 1476, 2489, 0},
-    {875, 1400, 1595, 1832, 1476, 2490, 2489, 0},
-    {1257, 1153, 1526, 1833, 1474, 2513, 2514, 0},
-    {1257, 1712, 1153, 1834, 1474, 1473, 2513, 0},
-    {1712, 1022, 1153, 1834, 1473, 2398, 2513, 0},
-    {1186, 1257, 1526, 1835, 1469, 1474, 2514, 0},
-    {1186, 933, 1257, 1836, 1469, 1471, 1474, 0},
-    {933, 1340, 1257, 1836, 1471, 1472, 1474, 0},
-    {1989, 1693, 1382, 1837, 1470, 2515, 2502, 0},
-    {1989, 1186, 1693, 1838, 1470, 1469, 2515, 0},
-    {1186, 1526, 1693, 1839, 1469, 2514, 2515, 0},
-    {1178, 1972, 840, 1840, 1467, 1324, 1589, 0},
-    {1178, 1536, 1972, 651, 1467, 1466, 1324, 0},
-    {1536, 1334, 1972, 651, 1466, 1322, 1324, 0},
-    {864, 1178, 840, 1841, 1462, 1467, 1589, 0},
-    {864, 1515, 1178, 1842, 1462, 1464, 1467, 0},
-    {1515, 1121, 1178, 1843, 1464, 1465, 1467, 0},
-    {1977, 963, 1330, 1844, 1463, 1591, 2488, 0},
-    {1977, 864, 963, 1845, 1463, 1462, 1591, 0},
-    {864, 840, 963, 650, 1462, 1589, 1591, 0},
-    {845, 1705, 1458, 1846, 1460, 2516, 2517, 0},
-    {845, 1620, 1705, 1847, 1460, 1459, 2516, 0},
-    {1620, 1382, 1705, 1848, 1459, 2502, 2516, 0},
-    {1295, 845, 1458, 1849, 1455, 1460, 2517, 0},
-    {1295, 940, 845, 1850, 1455, 1457, 1460, 0},
-    {940, 1004, 845, 1851, 1457, 1458, 1460, 0},
-    {1993, 1065, 932, 1846, 1456, 2518, 1369, 0},
-    {1993, 1295, 1065, 1852, 1456, 1455, 2518, 0},
-    {1295, 1458, 1065, 1853, 1455, 2517, 2518, 0},
-    {1773, 1976, 1040, 1854, 1453, 1582, 1581, 0},
-    {1773, 1617, 1976, 1854, 1453, 1452, 1582, 0},
-    {1617, 974, 1976, 1855, 1452, 1382, 1582, 0},
-    {1797, 1773, 1040, 1856, 1448, 1453, 1581, 0},
-    {1797, 1590, 1773, 1857, 1448, 1450, 1453, 0},
-    {1590, 1483, 1773, 646, 1450, 1451, 1453, 0},
-    {1979, 1778, 970, 1854, 1449, 1329, 1328, 0},
-    {1979, 1797, 1778, 1858, 1449, 1448, 1329, 0},
-    {1797, 1040, 1778, 1859, 1448, 1581, 1329, 0},
-    {1566, 1602, 1389, 1860, 1446, 1390, 1433, 0},
-    {1566, 1716, 1602, 1861, 1446, 1445, 1390, 0},
-    {1716, 1154, 1602, 1862, 1445, 1388, 1390, 0},
-    {1741, 1566, 1389, 1863, 1441, 1446, 1433, 0},
-    {1741, 1650, 1566, 1864, 1441, 1443, 1446, 0},
-    {1650, 1523, 1566, 1865, 1443, 1444, 1446, 0},
-    {1973, 2000, 1150, 1866, 1442, 1435, 2486, 0},
-    {1973, 1741, 2000, 640, 1442, 1441, 1435, 0},
-    {1741, 1389, 2000, 1867, 1441, 1433, 1435, 0},
-    {1605, 1997, 849, 1868, 1439, 2509, 2508, 0},
-    {1605, 1533, 1997, 640, 1439, 1438, 2509, 0},
-    {1533, 1514, 1997, 616, 1438, 1372, 2509, 0},
-    {1589, 1605, 849, 1869, 1434, 1439, 2508, 0},
-    {1589, 1697, 1605, 1870, 1434, 1436, 1439, 0},
-    {1697, 1460, 1605, 616, 1436, 1437, 1439, 0},
-    {2000, 1737, 1150, 1871, 1435, 2507, 2486, 0},
-    {2000, 1589, 1737, 1872, 1435, 1434, 2507, 0},
-    {1589, 849, 1737, 1873, 1434, 2508, 2507, 0},
-    {1681, 1631, 1431, 1874, 1432, 2519, 2520, 0},
-    {1681, 1828, 1631, 1875, 1432, 1431, 2519, 0},
-    {1828, 1514, 1631, 1876, 1431, 1372, 2519, 0},
-    {1583, 1681, 1431, 1877, 1427, 1432, 2520, 0},
-    {1583, 1106, 1681, 1878, 1427, 1429, 1432, 0},
-    {1106, 1137, 1681, 1879, 1429, 1430, 1432, 0},
-    {1640, 1958, 441, 1880, 1428, 1092, 2521, 0},
-    {1640, 1583, 1958, 1881, 1428, 1427, 1092, 0},
-    {1583, 1431, 1958, 1881, 1427, 2520, 1092, 0},
-    {1201, 1546, 1051, 1882, 1425, 2522, 2523, 0},
-    {1201, 1920, 1546, 1883, 1425, 1211, 2522, 0},
-    {1920, 1512, 1546, 1884, 1211, 1210, 2522, 0},
-    {1775, 1201, 1051, 1885, 1421, 1425, 2523, 0},
-    {1775, 1545, 1201, 1886, 1421, 1423, 1425, 0},
-    {1545, 1406, 1201, 1887, 1423, 1424, 1425, 0},
-    {1784, 1847, 444, 1888, 1422, 1175, 2524, 0},
-    {1784, 1775, 1847, 1889, 1422, 1421, 1175, 0},
-    {1775, 1051, 1847, 1890, 1421, 2523, 1175, 0},
-    {1799, 1667, 1302, 1891, 1419, 1254, 1253, 0},
-    {1799, 964, 1667, 1891, 1419, 1408, 1254, 0},
-    {964, 437, 1667, 1892, 1408, 2525, 1254, 0},
-    {1374, 1799, 1302, 1892, 1416, 1419, 1253, 0},
-    {1374, 1568, 1799, 1893, 1416, 1417, 1419, 0},
-    {1568, 945, 1799, 1894, 1417, 1418, 1419, 0},
-    {1087, 1622, 1530, 1895, 1295, 2526, 1293, 0},
-    {1087, 1374, 1622, 1895, 1295, 1416, 2526, 0},
-    {1374, 1302, 1622, 1892, 1416, 1253, 2526, 0},
-    {1960, 1568, 1161, 1896, 1414, 1417, 1415, 0},
-    {1960, 863, 1568, 1897, 1414, 1413, 1417, 0},
-    {863, 945, 1568, 1898, 1413, 1418, 1417, 0},
-    {1738, 1805, 440, 1899, 1412, 2527, 2528, 0},
-    {1738, 1855, 1805, 1900, 1412, 1411, 2527, 0},
-    {1855, 1530, 1805, 1901, 1411, 1293, 2527, 0},
-    {2046, 945, 863, 1902, 1409, 1418, 1413, 0},
-    {1756, 863, 1529, 1903, 1406, 1413, 1404, 0},
-    {434, 2046, 1756, 1904, 2529, 1409, 1406, 0},
-    {1756, 1706, 434, 1905, 1406, 2530, 2529, 0},
-    {1756, 1854, 1706, 1906, 1406, 1405, 2530, 0},
-    {1854, 435, 1706, 1907, 1405, 2531, 2530, 0},
-    {2047, 1076, 1784, 1908, 1403, 1420, 1422, 0},
-    {1554, 1784, 444, 1909, 2532, 1422, 2524, 0},
-    {436, 2047, 1554, 1910, 1395, 1403, 2532, 0},
-    {1665, 1675, 422, 1911, 1402, 2533, 2534, 0},
-    {1665, 1837, 1675, 1912, 1402, 1401, 2533, 0},
-    {1837, 423, 1675, 1913, 1401, 2535, 2533, 0},
-    {836, 1545, 1076, 1914, 1400, 1423, 1420, 0},
-    {836, 1644, 1545, 1888, 1400, 1399, 1423, 0},
-    {1644, 1406, 1545, 1915, 1399, 1424, 1423, 0},
-    {1780, 1854, 1529, 1916, 1397, 2536, 1398, 0},
-    {1780, 844, 1854, 1917, 1397, 1396, 2536, 0},
-    {844, 435, 1854, 1918, 1396, 2537, 2536, 0},
-    {2048, 1139, 1645, 1919, 1394, 1920, 1922, 0},
-    {1552, 1645, 443, 1920, 2538, 1922, 2370, 0},
-    {424, 2048, 1552, 1921, 1391, 1394, 2538, 0},
-    {1936, 1106, 1412, 1880, 1167, 1429, 1426, 0},
-    {1936, 1996, 1106, 1922, 1167, 1360, 1429, 0},
-    {1996, 1137, 1106, 1923, 1360, 1430, 1429, 0},
-    {888, 1837, 1512, 1924, 1393, 2539, 1152, 0},
-    {888, 1798, 1837, 1925, 1393, 1392, 2539, 0},
-    {1798, 423, 1837, 1926, 1392, 2540, 2539, 0},
-    {1602, 1697, 1389, 1927, 1390, 1436, 1433, 0},
-    {1602, 1373, 1697, 1867, 1390, 1389, 1436, 0},
-    {1373, 1460, 1697, 616, 1389, 1437, 1436, 0},
-    {1687, 1650, 1130, 1928, 1323, 1443, 1440, 0},
-    {1687, 1657, 1650, 1929, 1323, 1387, 1443, 0},
-    {1657, 1523, 1650, 1865, 1387, 1444, 1443, 0},
-    {1730, 1590, 860, 1930, 1332, 1450, 1447, 0},
-    {1730, 1748, 1590, 1931, 1332, 1386, 1450, 0},
-    {1748, 1483, 1590, 1931, 1386, 1451, 1450, 0},
-    {1761, 940, 1047, 1932, 1385, 1457, 1454, 0},
-    {1761, 1988, 940, 1933, 1385, 1347, 1457, 0},
-    {1988, 1004, 940, 1846, 1347, 1458, 1457, 0},
-    {1548, 1515, 1175, 651, 1384, 1464, 1461, 0},
-    {1548, 1517, 1515, 1934, 1384, 1383, 1464, 0},
-    {1517, 1121, 1515, 1934, 1383, 1465, 1464, 0},
-    {842, 933, 914, 1935, 1381, 1471, 1468, 0},
-    {842, 1984, 933, 1936, 1381, 1380, 1471, 0},
-    {1984, 1340, 933, 1937, 1380, 1472, 1471, 0},
-    {1442, 947, 960, 1938, 1379, 1478, 1475, 0},
-    {1442, 1990, 947, 1939, 1379, 1378, 1478, 0},
-    {1990, 1274, 947, 1940, 1378, 1479, 1478, 0},
-    {1815, 1211, 1454, 1941, 1377, 1484, 1481, 0},
-    {1815, 1145, 1211, 1942, 1377, 1376, 1484, 0},
-    {1145, 1125, 1211, 1943, 1376, 1485, 1484, 0},
-    {1985, 1694, 430, 1944, 1374, 2541, 2542, 0},
-    {1985, 1839, 1694, 1945, 1374, 1373, 2541, 0},
-    {1839, 431, 1694, 1946, 1373, 2543, 2541, 0},
-    {1670, 1762, 867, 1814, 1371, 1490, 1488, 0},
-    {1670, 1282, 1762, 1813, 1371, 1370, 1490, 0},
-    {1282, 1409, 1762, 1947, 1370, 1491, 1490, 0},
-    {1571, 1110, 1184, 1948, 1368, 1497, 1494, 0},
-    {1571, 1982, 1110, 1810, 1368, 1339, 1497, 0},
-    {1982, 1265, 1110, 1949, 1339, 1498, 1497, 0},
-    {1551, 1770, 1323, 1950, 1367, 1504, 1501, 0},
-    {1551, 1981, 1770, 1950, 1367, 1366, 1504, 0},
-    {1981, 905, 1770, 1951, 1366, 1505, 1504, 0},
-    {1639, 1582, 1445, 667, 1365, 1510, 1508, 0},
-    {1639, 1796, 1582, 605, 1365, 1364, 1510, 0},
-    {1796, 853, 1582, 1952, 1364, 1511, 1510, 0},
-    {1791, 891, 1393, 1953, 1362, 1517, 1514, 0},
-    {1791, 1555, 891, 1954, 1362, 1361, 1517, 0},
-    {1555, 1209, 891, 1955, 1361, 1518, 1517, 0},
-    {1996, 843, 1137, 1956, 1360, 1522, 1430, 0},
-    {1996, 1642, 843, 1957, 1360, 1359, 1522, 0},
-    {1642, 920, 843, 1958, 1359, 1523, 1522, 0},
-    {1810, 1172, 1407, 676, 1357, 1529, 1526, 0},
-    {1810, 1719, 1172, 602, 1357, 1356, 1529, 0},
-    {1719, 1317, 1172, 1959, 1356, 1530, 1529, 0},
-    {976, 1281, 1310, 1960, 1326, 1536, 1533, 0},
-    {976, 1641, 1281, 1961, 1326, 1354, 1536, 0},
-    {1641, 1197, 1281, 1962, 1354, 1537, 1536, 0},
-    {1992, 997, 867, 1963, 1353, 1541, 1488, 0},
-    {1992, 1643, 997, 1963, 1353, 1352, 1541, 0},
-    {1643, 918, 997, 1764, 1352, 1542, 1541, 0},
-    {930, 1304, 1256, 1964, 1350, 1548, 1545, 0},
-    {930, 1680, 1304, 1965, 1350, 1349, 1548, 0},
-    {1680, 1274, 1304, 1966, 1349, 1479, 1548, 0},
-    {1988, 1078, 1004, 688, 1347, 1551, 1458, 0},
-    {1988, 1268, 1078, 688, 1347, 1346, 1551, 0},
-    {1268, 1391, 1078, 1967, 1346, 1552, 1551, 0},
-    {1986, 1767, 980, 1968, 1344, 1558, 1555, 0},
-    {1986, 1493, 1767, 1969, 1344, 1343, 1558, 0},
-    {1493, 852, 1767, 1970, 1343, 1559, 1558, 0},
-    {1343, 1656, 438, 1971, 1341, 2544, 2545, 0},
-    {1343, 1855, 1656, 1972, 1341, 1340, 2544, 0},
-    {1855, 439, 1656, 1973, 1340, 2546, 2544, 0},
-    {1982, 1618, 1265, 1974, 1339, 1563, 1498, 0},
-    {1982, 1203, 1618, 1974, 1339, 1338, 1563, 0},
-    {1203, 1096, 1618, 1975, 1338, 1564, 1563, 0},
-    {1980, 1606, 1445, 594, 1336, 1568, 1508, 0},
-    {1980, 847, 1606, 594, 1336, 1335, 1568, 0},
-    {847, 855, 1606, 1730, 1335, 1569, 1568, 0},
-    {1978, 1794, 995, 698, 1333, 1575, 1572, 0},
-    {1978, 1730, 1794, 1976, 1333, 1332, 1575, 0},
-    {1730, 860, 1794, 1977, 1332, 1447, 1575, 0},
-    {1237, 906, 1432, 1978, 1330, 1580, 1577, 0},
-    {1237, 1778, 906, 1979, 1330, 1329, 1580, 0},
-    {1778, 1040, 906, 1980, 1329, 1581, 1580, 0},
-    {1561, 958, 1230, 1981, 1327, 1587, 1584, 0},
-    {1561, 976, 958, 1982, 1327, 1326, 1587, 0},
-    {976, 1310, 958, 1982, 1326, 1533, 1587, 0},
-    {1972, 1063, 840, 1983, 1324, 1592, 1589, 0},
-    {1972, 1687, 1063, 590, 1324, 1323, 1592, 0},
-    {1687, 1130, 1063, 1984, 1323, 1440, 1592, 0},
-    {1722, 1157, 1344, 1985, 1321, 1597, 1594, 0},
-    {1722, 1968, 1157, 1986, 1321, 1317, 1597, 0},
-    {1968, 928, 1157, 1987, 1317, 1598, 1597, 0},
-    {1597, 1239, 426, 1988, 1320, 2547, 2548, 0},
-    {1597, 1835, 1239, 1989, 1320, 1319, 2547, 0},
-    {1835, 427, 1239, 1990, 1319, 2549, 2547, 0},
-    {910, 848, 1346, 1991, 1318, 1604, 1601, 0},
-    {910, 1451, 848, 1992, 1318, 1012, 1604, 0},
-    {1451, 1198, 848, 1689, 1012, 1605, 1604, 0},
-    {1968, 851, 928, 1993, 1317, 1609, 1598, 0},
-    {1968, 1093, 851, 1994, 1317, 1316, 1609, 0},
-    {1093, 1378, 851, 1995, 1316, 1610, 1609, 0},
-    {1369, 1817, 1468, 1996, 1314, 1614, 1612, 0},
-    {1369, 1845, 1817, 1997, 1314, 1313, 1614, 0},
-    {1845, 1108, 1817, 1998, 1313, 1615, 1614, 0},
-    {1755, 1066, 1459, 1999, 1311, 1621, 1618, 0},
-    {1755, 1088, 1066, 2000, 1311, 1310, 1621, 0},
-    {1088, 1301, 1066, 2001, 1310, 1622, 1621, 0},
-    {1541, 1311, 971, 2002, 1308, 1627, 1625, 0},
-    {1541, 1134, 1311, 583, 1308, 1307, 1627, 0},
-    {1134, 873, 1311, 2003, 1307, 1628, 1627, 0},
-    {1966, 1461, 1468, 2004, 1305, 1632, 1612, 0},
-    {1966, 1965, 1461, 2005, 1305, 1304, 1632, 0},
-    {1965, 1241, 1461, 1645, 1304, 1633, 1632, 0},
-    {1965, 1647, 1241, 2006, 1304, 1637, 1633, 0},
-    {1965, 1629, 1647, 2007, 1304, 1303, 1637, 0},
-    {1629, 1122, 1647, 2008, 1303, 1638, 1637, 0},
-    {1630, 1167, 893, 734, 1301, 1644, 1641, 0},
-    {1630, 1769, 1167, 2009, 1301, 1300, 1644, 0},
-    {1769, 1061, 1167, 2009, 1300, 1645, 1644, 0},
-    {1963, 1456, 971, 2010, 1298, 1649, 1625, 0},
-    {1963, 1952, 1456, 2011, 1298, 1297, 1649, 0},
-    {1952, 1138, 1456, 2012, 1297, 1650, 1649, 0},
-    {1087, 1531, 1161, 2013, 1295, 1654, 1415, 0},
-    {1087, 1715, 1531, 578, 1295, 1294, 1654, 0},
-    {1715, 1413, 1531, 1610, 1294, 1655, 1654, 0},
-    {1082, 1224, 872, 2014, 1259, 1661, 1658, 0},
-    {1082, 1953, 1224, 2015, 1259, 1292, 1661, 0},
-    {1953, 1030, 1224, 2016, 1292, 1662, 1661, 0},
-    {1961, 969, 1511, 2017, 1291, 1668, 1665, 0},
-    {1961, 1000, 969, 2017, 1291, 1290, 1668, 0},
-    {1000, 1190, 969, 2018, 1290, 1669, 1668, 0},
-    {1723, 1549, 1341, 2019, 1288, 1675, 1672, 0},
-    {1723, 1947, 1549, 2020, 1288, 1266, 1675, 0},
-    {1947, 1275, 1549, 2021, 1266, 1676, 1675, 0},
-    {1222, 1207, 1120, 1581, 1287, 1682, 1679, 0},
-    {1222, 1247, 1207, 2022, 1287, 1286, 1682, 0},
-    {1247, 1321, 1207, 749, 1286, 1683, 1682, 0},
-    {1363, 1574, 917, 491, 2459, 1284, 1687, 0},
-    {939, 2049, 1363, 491, 2450, 1282, 2459, 0},
-    {1430, 1876, 2049, 482, 1693, 2318, 1282, 0},
-    {885, 1370, 1320, 2023, 1281, 1698, 1695, 0},
-    {885, 1946, 1370, 2024, 1281, 1280, 1698, 0},
-    {1946, 1365, 1370, 2025, 1280, 1699, 1698, 0},
-    {1745, 878, 1048, 2026, 1267, 1705, 1702, 0},
-    {1745, 1945, 878, 2027, 1267, 1263, 1705, 0},
-    {1945, 1005, 878, 2028, 1263, 1706, 1705, 0},
-    {1851, 1818, 1366, 2029, 1278, 1712, 1709, 0},
-    {1851, 1954, 1818, 2030, 1278, 1277, 1712, 0},
-    {1954, 1390, 1818, 2031, 1277, 1713, 1712, 0},
-    {1954, 908, 1390, 2032, 1277, 1717, 1713, 0},
-    {1954, 1402, 908, 2033, 1277, 1276, 1717, 0},
-    {1402, 1300, 908, 1545, 1276, 1718, 1717, 0},
-    {1764, 1558, 943, 2034, 1274, 1724, 1721, 0},
-    {1764, 1950, 1558, 2035, 1274, 1273, 1724, 0},
-    {1950, 1408, 1558, 1539, 1273, 1725, 1724, 0},
-    {1673, 1660, 1188, 2036, 1271, 1731, 1728, 0},
-    {1673, 1792, 1660, 2037, 1271, 1270, 1731, 0},
-    {1792, 1318, 1660, 2038, 1270, 1732, 1731, 0},
-    {1202, 1838, 1215, 2039, 1268, 1738, 1735, 0},
-    {1202, 1745, 1838, 2040, 1268, 1267, 1738, 0},
-    {1745, 1048, 1838, 2041, 1267, 1702, 1738, 0},
-    {1947, 1126, 1275, 1520, 1266, 1741, 1676, 0},
-    {1947, 1027, 1126, 2042, 1266, 1265, 1741, 0},
-    {1027, 1010, 1126, 1521, 1265, 1742, 1741, 0},
-    {1945, 937, 1005, 1515, 1263, 1746, 1706, 0},
-    {1945, 1691, 937, 1514, 1263, 1262, 1746, 0},
-    {1691, 1500, 937, 1513, 1262, 1747, 1746, 0},
-    {998, 1725, 1319, 2043, 1260, 1753, 1750, 0},
-    {998, 1082, 1725, 2044, 1260, 1259, 1753, 0},
-    {1082, 872, 1725, 2045, 1259, 1658, 1753, 0},
-    {1115, 1666, 1457, 2046, 2434, 1257, 1756, 0},
-    {1070, 2050, 1115, 2047, 2424, 1255, 2434, 0},
-    {1447, 1957, 2050, 2048, 1762, 2482, 1255, 0},
-    {1848, 1667, 437, 2049, 2550, 1254, 2525, 0},
-    {440, 2051, 1848, 2050, 2528, 1252, 2550, 0},
-    {1805, 1622, 2051, 2051, 2527, 2526, 1252, 0},
-    {1596, 999, 1214, 2052, 1251, 1767, 1764, 0},
-    {1596, 1940, 999, 2053, 1251, 1221, 1767, 0},
-    {1940, 919, 999, 2054, 1221, 1768, 1767, 0},
-    {1906, 1835, 1510, 2055, 1166, 2551, 1358, 0},
-    {1906, 1326, 1835, 2056, 1166, 1250, 2551, 0},
-    {1326, 427, 1835, 2057, 1250, 2552, 2551, 0},
-    {1713, 1356, 1009, 2058, 1248, 1774, 1771, 0},
-    {1713, 1923, 1356, 2059, 1248, 1191, 1774, 0},
-    {1923, 1525, 1356, 2060, 1191, 1775, 1774, 0},
-    {962, 1771, 1124, 795, 1247, 1780, 1778, 0},
-    {962, 1427, 1771, 2061, 1247, 1246, 1780, 0},
-    {1427, 1122, 1771, 2062, 1246, 1781, 1780, 0},
-    {1688, 1057, 1394, 2063, 1244, 1786, 1784, 0},
-    {1688, 910, 1057, 2064, 1244, 1243, 1786, 0},
-    {910, 1346, 1057, 2065, 1243, 1787, 1786, 0},
-    {1779, 1023, 854, 2066, 1241, 1792, 1790, 0},
-    {1779, 1809, 1023, 2067, 1241, 1240, 1792, 0},
-    {1809, 1162, 1023, 799, 1240, 1793, 1792, 0},
-    {876, 1840, 1189, 2068, 1238, 1798, 1796, 0},
-    {876, 1733, 1840, 2069, 1238, 1237, 1798, 0},
-    {1733, 1190, 1840, 2070, 1237, 1799, 1798, 0},
-    {1553, 1704, 1255, 2071, 1235, 1804, 1802, 0},
-    {1553, 1851, 1704, 2072, 1235, 1234, 1804, 0},
-    {1851, 1366, 1704, 2073, 1234, 1805, 1804, 0},
-    {953, 1564, 1075, 2074, 1232, 1811, 1808, 0},
-    {953, 1916, 1564, 2075, 1232, 1182, 1811, 0},
-    {1916, 1273, 1564, 2076, 1182, 1812, 1811, 0},
-    {1692, 1368, 985, 2077, 1231, 1817, 1815, 0},
-    {1692, 885, 1368, 2078, 1231, 1230, 1817, 0},
-    {885, 1320, 1368, 2079, 1230, 1818, 1817, 0},
-    {1352, 1476, 1136, 2080, 1228, 1824, 1821, 0},
-    {1352, 1918, 1476, 2081, 1228, 1185, 1824, 0},
-    {1918, 866, 1476, 2081, 1185, 1825, 1824, 0},
-    {941, 923, 1003, 1411, 1227, 1830, 1828, 0},
-    {941, 1534, 923, 1410, 1227, 1226, 1830, 0},
-    {1534, 1524, 923, 2082, 1226, 1831, 1830, 0},
-    {1735, 1724, 1316, 2083, 1224, 1836, 1834, 0},
-    {1735, 1709, 1724, 2084, 1224, 1223, 1836, 0},
-    {1709, 1123, 1724, 2085, 1223, 1837, 1836, 0},
-    {1940, 874, 919, 825, 1221, 1841, 1768, 0},
-    {1940, 1702, 874, 2086, 1221, 1220, 1841, 0},
-    {1702, 1278, 874, 2087, 1220, 1842, 1841, 0},
-    {1938, 1497, 1189, 2088, 1218, 1846, 1796, 0},
-    {1938, 1351, 1497, 2089, 1218, 1217, 1846, 0},
-    {1351, 1143, 1497, 2089, 1217, 1847, 1846, 0},
-    {1284, 1806, 1187, 2090, 2405, 1215, 1851, 0},
-    {1250, 2052, 1284, 2091, 2395, 1213, 2405, 0},
-    {1357, 1984, 2052, 2092, 1856, 1380, 1213, 0},
-    {1731, 1480, 1322, 2093, 1212, 1861, 1858, 0},
-    {1731, 1920, 1480, 2094, 1212, 1211, 1861, 0},
-    {1920, 1406, 1480, 1380, 1211, 1424, 1861, 0},
-    {1625, 1227, 913, 2095, 1209, 1866, 1863, 0},
-    {1625, 994, 1227, 1374, 1209, 1208, 1866, 0},
-    {994, 1280, 1227, 1373, 1208, 1867, 1866, 0},
-    {1933, 1425, 854, 2096, 1206, 1871, 1790, 0},
-    {1933, 1415, 1425, 2097, 1206, 1205, 1871, 0},
-    {1415, 1049, 1425, 2097, 1205, 1872, 1871, 0},
-    {1931, 1299, 1394, 2098, 1203, 1876, 1784, 0},
-    {1931, 911, 1299, 2099, 1203, 1202, 1876, 0},
-    {911, 1031, 1299, 2100, 1202, 1877, 1876, 0},
-    {1929, 1261, 1124, 2101, 1200, 1881, 1778, 0},
-    {1929, 1610, 1261, 541, 1200, 1199, 1881, 0},
-    {1610, 1032, 1261, 1359, 1199, 1882, 1881, 0},
-    {1927, 1016, 1255, 2102, 1197, 1886, 1802, 0},
-    {1927, 903, 1016, 2103, 1197, 1196, 1886, 0},
-    {903, 1219, 1016, 1352, 1196, 1887, 1886, 0},
-    {1925, 1117, 985, 2104, 1194, 1891, 1815, 0},
-    {1925, 1563, 1117, 2105, 1194, 1193, 1891, 0},
-    {1563, 1050, 1117, 2105, 1193, 1892, 1891, 0},
-    {1923, 1513, 1525, 853, 1191, 1896, 1775, 0},
-    {1923, 1793, 1513, 853, 1191, 1190, 1896, 0},
-    {1793, 1213, 1513, 853, 1190, 1897, 1896, 0},
-    {1921, 1312, 1316, 2106, 1188, 1901, 1834, 0},
-    {1921, 1746, 1312, 537, 1188, 1187, 1901, 0},
-    {1746, 1254, 1312, 537, 1187, 1902, 1901, 0},
-    {1918, 1114, 866, 2107, 1185, 1906, 1825, 0},
-    {1918, 1527, 1114, 2108, 1185, 1184, 1906, 0},
-    {1527, 1072, 1114, 536, 1184, 1907, 1906, 0},
-    {1916, 1251, 1273, 1320, 1182, 1911, 1812, 0},
-    {1916, 1478, 1251, 2109, 1182, 1181, 1911, 0},
-    {1478, 1485, 1251, 2110, 1181, 1912, 1911, 0},
-    {1914, 1151, 1003, 863, 1179, 1916, 1828, 0},
-    {1914, 1655, 1151, 534, 1179, 1178, 1916, 0},
-    {1655, 1163, 1151, 2111, 1178, 1917, 1916, 0},
-    {2053, 1051, 1546, 2112, 1176, 2523, 2522, 0},
-    {1665, 1546, 1512, 2113, 1402, 2522, 1210, 0},
-    {422, 2053, 1665, 2114, 2534, 1176, 1402, 0},
-    {1054, 861, 1139, 2115, 1173, 1923, 1920, 0},
-    {1054, 1729, 861, 2116, 1173, 1154, 1923, 0},
-    {1729, 1339, 861, 2117, 1154, 1924, 1923, 0},
-    {1711, 1371, 1313, 2118, 1172, 1929, 1927, 0},
-    {1711, 1718, 1371, 2119, 1172, 1171, 1929, 0},
-    {1718, 1072, 1371, 2120, 1171, 1930, 1929, 0},
-    {1475, 1410, 1294, 2121, 1169, 1936, 1933, 0},
-    {1475, 1901, 1410, 2122, 1169, 1129, 1936, 0},
-    {1901, 1176, 1410, 2121, 1129, 1937, 1936, 0},
-    {2054, 1412, 1640, 2123, 1168, 1426, 1428, 0},
-    {1593, 1640, 441, 2124, 2553, 1428, 2521, 0},
-    {428, 2054, 1593, 2125, 1249, 1168, 2553, 0},
-    {1547, 1081, 1441, 2126, 1165, 1943, 1940, 0},
-    {1547, 1890, 1081, 2127, 1165, 1111, 1943, 0},
-    {1890, 1516, 1081, 2128, 1111, 1944, 1943, 0},
-    {1686, 1471, 1246, 2129, 1164, 1950, 1947, 0},
-    {1686, 1892, 1471, 2129, 1164, 1114, 1950, 0},
-    {1892, 1270, 1471, 2130, 1114, 1951, 1950, 0},
-    {955, 1083, 1360, 2131, 1163, 1957, 1954, 0},
-    {955, 1887, 1083, 526, 1163, 1105, 1957, 0},
-    {1887, 1380, 1083, 2131, 1105, 1958, 1957, 0},
-    {1619, 1205, 1403, 2132, 1162, 1964, 1961, 0},
-    {1619, 1895, 1205, 2133, 1162, 1120, 1964, 0},
-    {1895, 1384, 1205, 2134, 1120, 1965, 1964, 0},
-    {1808, 1208, 1183, 2135, 1161, 1971, 1968, 0},
-    {1808, 1899, 1208, 2136, 1161, 1126, 1971, 0},
-    {1899, 1236, 1208, 2137, 1126, 1972, 1971, 0},
-    {1415, 1100, 1049, 1261, 1160, 1978, 1975, 0},
-    {1415, 1912, 1100, 2138, 1160, 1159, 1978, 0},
-    {1912, 1028, 1100, 2139, 1159, 1979, 1978, 0},
-    {1351, 1012, 1143, 2140, 1157, 1985, 1982, 0},
-    {1351, 1900, 1012, 1242, 1157, 1156, 1985, 0},
-    {1900, 1463, 1012, 2141, 1156, 1986, 1985, 0},
-    {1729, 1192, 1339, 1238, 1154, 1990, 1924, 0},
-    {1729, 1824, 1192, 1238, 1154, 1153, 1990, 0},
-    {1824, 1280, 1192, 1238, 1153, 1991, 1990, 0},
-    {1759, 1147, 1388, 2142, 1144, 1997, 1994, 0},
-    {1759, 1179, 1147, 2143, 1144, 1151, 1997, 0},
-    {1179, 1096, 1147, 2144, 1151, 1998, 1997, 0},
-    {1674, 1757, 1097, 2145, 2349, 1150, 2002, 0},
-    {1119, 2055, 1674, 2146, 2340, 1148, 2349, 0},
-    {1473, 1937, 2055, 2147, 2008, 2416, 1148, 0},
-    {1492, 959, 1298, 2148, 1147, 2013, 2010, 0},
-    {1492, 1111, 959, 518, 1147, 1146, 2013, 0},
-    {1111, 1031, 959, 2149, 1146, 2014, 2013, 0},
-    {1668, 1444, 1118, 904, 1142, 2020, 2017, 0},
-    {1668, 1759, 1444, 2150, 1142, 1144, 2020, 0},
-    {1759, 1388, 1444, 2151, 1144, 1994, 2020, 0},
-    {1643, 1743, 918, 2152, 1143, 2025, 2022, 0},
-    {1643, 1668, 1743, 2153, 1143, 1142, 2025, 0},
-    {1668, 1118, 1743, 2154, 1142, 2017, 2025, 0},
-    {1907, 1037, 1429, 2155, 1140, 2030, 2027, 0},
-    {1907, 1850, 1037, 2156, 1140, 1139, 2030, 0},
-    {1850, 1069, 1037, 2157, 1139, 2031, 2030, 0},
-    {977, 1283, 432, 2158, 1138, 2554, 2555, 0},
-    {977, 1839, 1283, 2159, 1138, 1137, 2554, 0},
-    {1839, 1514, 1283, 2160, 1137, 1065, 2554, 0},
-    {1642, 1058, 920, 2161, 1135, 2037, 2034, 0},
-    {1642, 838, 1058, 911, 1135, 1134, 2037, 0},
-    {838, 1159, 1058, 2162, 1134, 2038, 2037, 0},
-    {1597, 1825, 1510, 2163, 1320, 1132, 1133, 0},
-    {426, 2056, 1597, 2164, 2548, 1130, 1320, 0},
-    {1803, 1689, 2056, 2165, 2556, 2369, 1130, 0},
-    {1901, 1401, 1176, 2166, 1129, 2042, 1937, 0},
-    {1901, 1561, 1401, 2167, 1129, 1128, 2042, 0},
-    {1561, 1230, 1401, 2168, 1128, 2043, 2042, 0},
-    {1899, 1018, 1236, 2169, 1126, 2047, 1972, 0},
-    {1899, 1608, 1018, 2170, 1126, 1125, 2047, 0},
-    {1608, 852, 1018, 2171, 1125, 2048, 2047, 0},
-    {1897, 1102, 1426, 2172, 1123, 2054, 2051, 0},
-    {1897, 1164, 1102, 2172, 1123, 1122, 2054, 0},
-    {1164, 855, 1102, 2173, 1122, 2055, 2054, 0},
-    {1895, 1235, 1384, 2174, 1120, 2059, 1965, 0},
-    {1895, 1146, 1235, 2175, 1120, 1119, 2059, 0},
-    {1146, 1197, 1235, 2176, 1119, 2060, 2059, 0},
-    {1894, 1435, 1313, 2177, 1117, 2064, 1927, 0},
-    {1894, 1237, 1435, 2178, 1117, 1116, 2064, 0},
-    {1237, 1432, 1435, 2179, 1116, 2065, 2064, 0},
-    {1892, 1671, 1270, 2180, 1114, 2069, 1951, 0},
-    {1892, 1791, 1671, 2181, 1114, 1113, 2069, 0},
-    {1791, 1393, 1671, 2182, 1113, 2070, 2069, 0},
-    {1890, 1196, 1516, 2183, 1111, 2074, 1944, 0},
-    {1890, 930, 1196, 2184, 1111, 1110, 2074, 0},
-    {930, 1256, 1196, 2185, 1110, 2075, 2074, 0},
-    {1889, 837, 1505, 2186, 1108, 2081, 2078, 0},
-    {1889, 1653, 837, 2187, 1108, 1107, 2081, 0},
-    {1653, 983, 837, 2188, 1107, 2082, 2081, 0},
-    {1887, 1450, 1380, 2189, 1105, 2086, 1958, 0},
-    {1887, 1744, 1450, 2190, 1105, 1104, 2086, 0},
-    {1744, 1074, 1450, 2190, 1104, 2087, 2086, 0},
-    {1885, 1055, 1264, 2191, 1102, 2093, 2090, 0},
-    {1885, 965, 1055, 1110, 1102, 1101, 2093, 0},
-    {965, 1290, 1055, 1111, 1101, 2094, 2093, 0},
-    {1486, 1140, 1386, 501, 1099, 2099, 2097, 0},
-    {1486, 1536, 1140, 482, 1099, 1098, 2099, 0},
-    {1536, 1121, 1140, 2192, 1098, 2100, 2099, 0},
-    {1829, 1518, 1272, 2193, 1096, 2105, 2103, 0},
-    {1829, 1262, 1518, 2194, 1096, 1095, 2105, 0},
-    {1262, 1125, 1518, 500, 1095, 2106, 2105, 0},
-    {2057, 1431, 1631, 2195, 1093, 2520, 2519, 0},
-    {1985, 1631, 1514, 2196, 1374, 2519, 1372, 0},
-    {430, 2057, 1985, 2197, 2542, 1093, 1374, 0},
-    {1676, 858, 1068, 1097, 1090, 2111, 2109, 0},
-    {1676, 1617, 858, 1097, 1090, 1089, 2111, 0},
-    {1617, 1483, 858, 2198, 1089, 2112, 2111, 0},
-    {1677, 1218, 1002, 2199, 1087, 2117, 2115, 0},
-    {1677, 1728, 1218, 2200, 1087, 1086, 2117, 0},
-    {1728, 853, 1218, 2201, 1086, 2118, 2117, 0},
-    {1834, 1007, 1315, 2202, 1084, 2123, 2121, 0},
-    {1834, 1442, 1007, 486, 1084, 1083, 2123, 0},
-    {1442, 960, 1007, 2203, 1083, 2124, 2123, 0},
-    {1703, 1448, 1452, 482, 1081, 2129, 2127, 0},
-    {1703, 1551, 1448, 482, 1081, 1080, 2129, 0},
-    {1551, 1323, 1448, 2204, 1080, 2130, 2129, 0},
-    {1726, 1014, 1328, 953, 1056, 2136, 2133, 0},
-    {1726, 1693, 1014, 491, 1056, 1078, 2136, 0},
-    {1693, 1526, 1014, 491, 1078, 2137, 2136, 0},
-    {1699, 894, 1045, 482, 1077, 2142, 2140, 0},
-    {1699, 1782, 894, 482, 1077, 1076, 2142, 0},
-    {1782, 1392, 894, 482, 1076, 2143, 2142, 0},
-    {2058, 1199, 1449, 2205, 1074, 2259, 1017, 0},
-    {1343, 1449, 1530, 2206, 1341, 1017, 1016, 0},
-    {438, 2058, 1343, 2207, 2545, 1074, 1341, 0},
-    {1659, 1560, 1286, 2208, 1071, 2149, 2146, 0},
-    {1659, 1065, 1560, 486, 1071, 1070, 2149, 0},
-    {1065, 1458, 1560, 2209, 1070, 2150, 2149, 0},
-    {1707, 1404, 1509, 482, 1061, 2156, 2153, 0},
-    {1707, 1882, 1404, 482, 1061, 1064, 2156, 0},
-    {1882, 1376, 1404, 2210, 1064, 2157, 2156, 0},
-    {1611, 1148, 865, 482, 1068, 2163, 2160, 0},
-    {1611, 1863, 1148, 2211, 1068, 1033, 2163, 0},
-    {1863, 1026, 1148, 2212, 1033, 2164, 2163, 0},
-    {1776, 889, 1158, 2213, 1067, 2169, 2167, 0},
-    {1776, 1533, 889, 490, 1067, 1066, 2169, 0},
-    {1533, 1460, 889, 482, 1066, 2170, 2169, 0},
-    {1882, 1470, 1376, 2214, 1064, 2174, 2157, 0},
-    {1882, 1362, 1470, 2215, 1064, 1063, 2174, 0},
-    {1362, 1342, 1470, 2216, 1063, 2175, 2174, 0},
-    {1661, 1543, 1344, 486, 1062, 2181, 2178, 0},
-    {1661, 1707, 1543, 491, 1062, 1061, 2181, 0},
-    {1707, 1509, 1543, 491, 1061, 2153, 2181, 0},
-    {1715, 1194, 1413, 958, 1059, 2186, 2183, 0},
-    {1715, 1635, 1194, 980, 1059, 1058, 2186, 0},
-    {1635, 1418, 1194, 2217, 1058, 2187, 2186, 0},
-    {1877, 1013, 1195, 482, 1057, 2193, 2190, 0},
-    {1877, 1726, 1013, 482, 1057, 1056, 2193, 0},
-    {1726, 1328, 1013, 491, 1056, 2133, 2193, 0},
-    {1225, 1465, 1367, 2218, 2302, 1054, 2196, 0},
-    {1479, 2059, 1225, 2219, 2292, 1052, 2302, 0},
-    {1307, 1850, 2059, 2220, 2201, 1139, 1052, 0},
-    {1873, 1884, 1272, 2221, 1051, 2204, 2103, 0},
-    {1873, 1202, 1884, 2221, 1051, 1050, 2204, 0},
-    {1202, 1215, 1884, 2222, 1050, 2205, 2204, 0},
-    {1871, 1971, 1452, 951, 1045, 2209, 2127, 0},
-    {1871, 996, 1971, 951, 1045, 1044, 2209, 0},
-    {996, 1010, 1971, 951, 1044, 2210, 2209, 0},
-    {1869, 2002, 1002, 2223, 1042, 2214, 2115, 0},
-    {1869, 1813, 2002, 951, 1042, 1041, 2214, 0},
-    {1813, 1321, 2002, 2223, 1041, 2215, 2214, 0},
-    {1867, 2005, 1045, 2224, 1039, 2219, 2140, 0},
-    {1867, 1630, 2005, 1031, 1039, 1038, 2219, 0},
-    {1630, 893, 2005, 482, 1038, 2220, 2219, 0},
-    {1865, 2008, 1315, 482, 1036, 2224, 2121, 0},
-    {1865, 1581, 2008, 1027, 1036, 1035, 2224, 0},
-    {1581, 1500, 2008, 2225, 1035, 2225, 2224, 0},
-    {1863, 2011, 1026, 2226, 1033, 2229, 2164, 0},
-    {1863, 1501, 2011, 482, 1033, 1032, 2229, 0},
-    {1501, 1276, 2011, 1019, 1032, 2230, 2229, 0},
-    {1862, 2014, 1386, 2227, 1030, 2234, 2097, 0},
-    {1862, 998, 2014, 2228, 1030, 1029, 2234, 0},
-    {998, 1319, 2014, 2229, 1029, 2235, 2234, 0},
-    {1861, 2017, 1296, 2230, 1027, 2241, 2238, 0},
-    {1861, 1673, 2017, 2231, 1027, 1026, 2241, 0},
-    {1673, 1188, 2017, 490, 1026, 2242, 2241, 0},
-    {1859, 2020, 1068, 2232, 1024, 2246, 2109, 0},
-    {1859, 1764, 2020, 482, 1024, 1023, 2246, 0},
-    {1764, 943, 2020, 482, 1023, 2247, 2246, 0},
-    {1857, 2023, 1338, 482, 1021, 2253, 2250, 0},
-    {1857, 1495, 2023, 1097, 1021, 1020, 2253, 0},
-    {1495, 1428, 2023, 1097, 1020, 2254, 2253, 0},
-    {1856, 2026, 1158, 2233, 1018, 2258, 2167, 0},
-    {1856, 1449, 2026, 2234, 1018, 1017, 2258, 0},
-    {1449, 1199, 2026, 2233, 1017, 2259, 2258, 0},
-    {1823, 879, 442, 2235, 2557, 1015, 2267, 0},
-    {432, 2060, 1823, 2236, 2555, 1013, 2557, 0},
-    {1283, 1875, 2060, 2237, 2554, 2268, 1013, 0},
-    {1451, 2029, 1198, 2238, 1012, 2262, 1605, 0},
-    {1451, 1969, 2029, 995, 1012, 1011, 2262, 0},
-    {1969, 1378, 2029, 2239, 1011, 1610, 2262, 0},
-    {385, 437, 1586, 2240, 467, 2558, 468, 0},
-    {1820, 430, 429, 2241, 475, 2559, 476, 0},
-    {1823, 442, 433, 2242, 478, 2560, 479, 0},
-    {1803, 426, 425, 2243, 481, 2561, 482, 0},
-    {1593, 441, 429, 2244, 484, 2562, 476, 0},
-    {1554, 444, 421, 2245, 486, 2563, 487, 0},
-    {1846, 438, 433, 2246, 489, 2564, 479, 0},
-    {1848, 437, 385, 2247, 491, 2558, 492, 0},
-    {1600, 422, 421, 2248, 494, 2565, 487, 0},
-    {1552, 443, 425, 2249, 496, 2566, 482, 0},
-    {1798, 424, 425, 2250, 992, 2567, 447, 0},
-    {398, 422, 1675, 2251, 448, 991, 993, 0},
-    {1326, 428, 429, 2252, 996, 2568, 453, 0},
-    {395, 426, 1239, 2253, 454, 995, 997, 0},
-    {977, 432, 433, 2254, 1000, 2569, 459, 0},
-    {392, 430, 1694, 2255, 460, 999, 1001, 0},
-    {844, 436, 421, 2256, 1004, 2570, 466, 0},
-    {386, 434, 1706, 2257, 464, 1003, 1005, 0},
-    {1738, 440, 385, 2258, 1008, 2571, 472, 0},
-    {389, 438, 1656, 2259, 473, 1007, 1009, 0},
-    {2060, 1875, 1263, 2260, 1013, 2268, 1014, 0},
-    {1752, 445, 1059, 487, 2572, 2346, 2573, 0},
-    {1411, 1833, 1807, 487, 2574, 2575, 2576, 0},
-    {1752, 1059, 984, 487, 2572, 2573, 2577, 0},
-    {449, 1739, 966, 487, 2578, 2579, 2580, 0},
-    {984, 1059, 1411, 487, 2577, 2573, 2574, 0},
-    {1833, 446, 1807, 487, 2575, 2581, 2576, 0},
-    {1433, 1648, 1575, 487, 1046, 2582, 2583, 0},
-    {1411, 1807, 1433, 487, 2574, 2576, 1046, 0},
-    {1739, 984, 966, 487, 2579, 2577, 2580, 0},
-    {1053, 966, 984, 487, 1048, 2580, 2577, 0},
-    {1633, 448, 1623, 487, 2584, 2585, 2586, 0},
-    {1053, 984, 1411, 487, 1048, 2577, 2574, 0},
-    {1633, 1623, 1053, 487, 2584, 2586, 1048, 0},
-    {447, 1575, 1648, 487, 2587, 2583, 2582, 0},
-    {1253, 1633, 1053, 487, 1047, 2584, 1048, 0},
-    {1053, 1411, 1433, 487, 1048, 2574, 1046, 0},
-    {1433, 1575, 1253, 487, 1046, 2583, 1047, 0},
-    {2059, 1850, 1019, 2261, 1052, 1139, 1053, 0},
-    {1846, 442, 1732, 2262, 1072, 2267, 1073, 0},
-    {1820, 441, 1958, 2263, 1091, 2521, 1092, 0},
-    {2056, 1689, 1008, 2264, 1130, 2369, 1131, 0},
-    {2055, 1937, 1038, 2265, 1148, 2416, 1149, 0},
-    {1906, 1510, 1936, 2266, 1166, 1358, 1167, 0},
-    {1600, 444, 1847, 2267, 1174, 2524, 1175, 0},
-    {2052, 1984, 1017, 2268, 1213, 1380, 1214, 0},
-    {2051, 1622, 1302, 2269, 1252, 2526, 1253, 0},
-    {2050, 1957, 1039, 2270, 1255, 2482, 1256, 0},
-    {2049, 1876, 1022, 2271, 1282, 2318, 1283, 0},
-    {888, 1512, 1054, 2272, 1393, 1152, 1173, 0},
-    {1780, 1529, 836, 2273, 1397, 1398, 1400, 0},
-    {1586, 437, 964, 2274, 1407, 2525, 1408, 0},
-    {2045, 1363, 917, 753, 1686, 2459, 1687, 0},
-    {1592, 939, 1191, 752, 1689, 2450, 1690, 0},
-    {1683, 1477, 1430, 2275, 1692, 2319, 1693, 0},
-    {2042, 1115, 1457, 2276, 1755, 2434, 1756, 0},
-    {1327, 1070, 869, 2277, 1758, 2424, 1759, 0},
-    {1814, 1071, 1447, 2278, 1761, 2483, 1762, 0},
-    {2039, 1284, 1187, 2279, 1850, 2405, 1851, 0},
-    {1243, 1250, 1238, 2280, 1853, 2395, 1854, 0},
-    {1712, 1340, 1357, 2281, 1473, 1472, 1856, 0},
-    {2036, 1674, 1097, 2282, 2001, 2349, 2002, 0},
-    {1355, 1119, 951, 2283, 2004, 2340, 2005, 0},
-    {1822, 1052, 1473, 2284, 2007, 2417, 2008, 0},
-    {2033, 1225, 1367, 2285, 2195, 2302, 2196, 0},
-    {1499, 1479, 1537, 2286, 2198, 2292, 2199, 0},
-    {1908, 1069, 1307, 2287, 2032, 2031, 2201, 0},
-    {2031, 1307, 1479, 2288, 2202, 2201, 2292, 0},
-    {1806, 2031, 1499, 2289, 2293, 2202, 2198, 0},
-    {1017, 1908, 2031, 2290, 2295, 2032, 2202, 0},
-    {2032, 1537, 984, 2291, 2200, 2199, 2296, 0},
-    {1042, 2032, 1739, 2292, 2298, 2200, 2297, 0},
-    {1187, 1499, 2032, 2293, 2294, 2198, 2200, 0},
-    {1752, 2033, 846, 2294, 2300, 2195, 2197, 0},
-    {984, 1537, 2033, 2295, 2296, 2199, 2195, 0},
-    {1537, 1479, 1225, 2296, 2199, 2292, 2302, 0},
-    {2034, 1473, 1119, 2297, 2009, 2008, 2340, 0},
-    {1465, 2034, 1355, 2298, 2341, 2009, 2004, 0},
-    {1019, 1822, 2034, 2299, 1201, 2007, 2009, 0},
-    {2035, 951, 1411, 2300, 2006, 2005, 2343, 0},
-    {846, 2035, 1059, 2301, 2345, 2006, 2344, 0},
-    {1367, 1355, 2035, 2302, 2342, 2004, 2006, 0},
-    {1833, 2036, 1539, 2303, 2347, 2001, 2003, 0},
-    {1411, 951, 2036, 2304, 2343, 2005, 2001, 0},
-    {951, 1119, 1674, 2283, 2005, 2340, 2349, 0},
-    {2037, 1357, 1250, 2305, 1857, 1856, 2395, 0},
-    {1574, 2037, 1243, 2306, 2396, 1857, 1853, 0},
-    {1022, 1712, 2037, 2307, 2398, 1473, 1857, 0},
-    {2038, 1238, 1053, 2308, 1855, 1854, 2399, 0},
-    {1335, 2038, 1623, 2309, 2401, 1855, 2400, 0},
-    {917, 1243, 2038, 2310, 2397, 1853, 1855, 0},
-    {966, 2039, 1042, 2311, 2403, 1850, 1852, 0},
-    {1053, 1238, 2039, 2312, 2399, 1854, 1850, 0},
-    {1238, 1250, 1284, 2313, 1854, 2395, 2405, 0},
-    {2040, 1447, 1070, 2314, 1763, 1762, 2424, 0},
-    {1757, 2040, 1327, 2315, 2425, 1763, 1758, 0},
-    {1038, 1814, 2040, 2316, 2427, 1761, 1763, 0},
-    {2041, 869, 1433, 2317, 1760, 1759, 2428, 0},
-    {1539, 2041, 1807, 2318, 2430, 1760, 2429, 0},
-    {1097, 1327, 2041, 2319, 2426, 1758, 1760, 0},
-    {1648, 2042, 1540, 2320, 2432, 1755, 1757, 0},
-    {1433, 869, 2042, 2321, 2428, 1759, 1755, 0},
-    {869, 1070, 1115, 2277, 1759, 2424, 2434, 0},
-    {2043, 1430, 939, 491, 1694, 1693, 2450, 0},
-    {1666, 2043, 1592, 491, 2451, 1694, 1689, 0},
-    {1039, 1683, 2043, 2275, 2305, 1692, 1694, 0},
-    {2044, 1191, 1253, 491, 1691, 1690, 2453, 0},
-    {1540, 2044, 1575, 491, 2455, 1691, 2454, 0},
-    {1457, 1592, 2044, 752, 2452, 1689, 1691, 0},
-    {1633, 2045, 1335, 2322, 2457, 1686, 1688, 0},
-    {1253, 1191, 2045, 491, 2453, 1690, 1686, 0},
-    {1191, 939, 1363, 753, 1690, 2450, 2459, 0},
-    {2046, 964, 945, 2323, 1409, 1408, 1418, 0},
-    {1756, 2046, 863, 2324, 1406, 1409, 1413, 0},
-    {434, 1586, 2046, 2325, 2529, 1407, 1409, 0},
-    {2047, 836, 1076, 2326, 1403, 1400, 1420, 0},
-    {1554, 2047, 1784, 2327, 2532, 1403, 1422, 0},
-    {436, 1780, 2047, 2328, 1395, 1397, 1403, 0},
-    {2048, 1054, 1139, 2329, 1394, 1173, 1920, 0},
-    {1552, 2048, 1645, 2330, 2538, 1394, 1922, 0},
-    {424, 888, 2048, 2331, 1391, 1393, 1394, 0},
-    {1363, 2049, 1574, 491, 2459, 1282, 1284, 0},
-    {939, 1430, 2049, 491, 2450, 1693, 1282, 0},
-    {1430, 1477, 1876, 2332, 1693, 2319, 2318, 0},
-    {1115, 2050, 1666, 2333, 2434, 1255, 1257, 0},
-    {1070, 1447, 2050, 2334, 2424, 1762, 1255, 0},
-    {1447, 1071, 1957, 2335, 1762, 2483, 2482, 0},
-    {1848, 2051, 1667, 2336, 2550, 1252, 1254, 0},
-    {440, 1805, 2051, 2337, 2528, 2527, 1252, 0},
-    {1805, 1530, 1622, 2338, 2527, 1293, 2526, 0},
-    {1284, 2052, 1806, 2339, 2405, 1213, 1215, 0},
-    {1250, 1357, 2052, 2340, 2395, 1856, 1213, 0},
-    {1357, 1340, 1984, 2341, 1856, 1472, 1380, 0},
-    {2053, 1847, 1051, 2342, 1176, 1175, 2523, 0},
-    {1665, 2053, 1546, 2343, 1402, 1176, 2522, 0},
-    {422, 1600, 2053, 2344, 2534, 1174, 1176, 0},
-    {2054, 1936, 1412, 2345, 1168, 1167, 1426, 0},
-    {1593, 2054, 1640, 2346, 2553, 1168, 1428, 0},
-    {428, 1906, 2054, 2347, 1249, 1166, 1168, 0},
-    {1674, 2055, 1757, 2348, 2349, 1148, 1150, 0},
-    {1119, 1473, 2055, 2349, 2340, 2008, 1148, 0},
-    {1473, 1052, 1937, 2350, 2008, 2417, 2416, 0},
-    {1597, 2056, 1825, 2351, 1320, 1130, 1132, 0},
-    {426, 1803, 2056, 2352, 2548, 2556, 1130, 0},
-    {1803, 443, 1689, 2353, 2556, 2370, 2369, 0},
-    {2057, 1958, 1431, 2354, 1093, 1092, 2520, 0},
-    {1985, 2057, 1631, 2355, 1374, 1093, 2519, 0},
-    {430, 1820, 2057, 2356, 2542, 1091, 1093, 0},
-    {2058, 1732, 1199, 2357, 1074, 1073, 2259, 0},
-    {1343, 2058, 1449, 2358, 1341, 1074, 1017, 0},
-    {438, 1846, 2058, 2359, 2545, 1072, 1074, 0},
-    {1225, 2059, 1465, 2360, 2302, 1052, 1054, 0},
-    {1479, 1307, 2059, 2361, 2292, 2201, 1052, 0},
-    {1307, 1069, 1850, 2362, 2201, 2031, 1139, 0},
-    {1823, 2060, 879, 2363, 2557, 1013, 1015, 0},
-    {432, 1283, 2060, 2364, 2555, 2554, 1013, 0},
-    {1283, 1514, 1875, 2365, 2554, 1065, 2268, 0},
-    {760, 762, 763, 2366, 2588, 2589, 2590, 0},
-    {746, 747, 745, 2367, 2591, 2592, 2593, 0},
-    {744, 745, 742, 2368, 2594, 2595, 2596, 0},
-    {644, 647, 739, 2369, 2597, 2598, 2599, 0},
-    {684, 685, 683, 2370, 2600, 2601, 2602, 0},
-    {655, 653, 652, 2371, 2603, 2604, 2605, 0},
-    {832, 833, 831, 2372, 2606, 2607, 2608, 0},
-    {196, 198, 199, 2373, 2609, 2610, 2611, 0},
-    {732, 733, 731, 2374, 2612, 2613, 2614, 0},
-    {792, 794, 795, 2375, 2615, 2616, 2617, 0},
-    {200, 201, 199, 2376, 2618, 2619, 2611, 0},
-    {782, 784, 785, 2377, 2620, 2621, 2622, 0},
-    {200, 202, 203, 2378, 2618, 2623, 2624, 0},
-    {260, 261, 259, 2379, 2625, 2626, 2627, 0},
-    {662, 664, 665, 2380, 2628, 2629, 2630, 0},
-    {798, 800, 801, 2381, 2631, 2632, 2633, 0},
-    {810, 812, 813, 2382, 2634, 2635, 2636, 0},
-    {698, 699, 697, 2383, 2637, 2638, 2639, 0},
-    {250, 252, 253, 2384, 2640, 2641, 2642, 0},
-    {804, 806, 807, 2385, 2643, 2644, 2645, 0},
-    {254, 256, 257, 2386, 2646, 2647, 2648, 0},
-    {260, 262, 263, 2387, 2625, 2649, 2650, 0},
-    {204, 206, 207, 2388, 2651, 2652, 2653, 0},
-    {782, 783, 781, 2389, 2620, 2654, 2655, 0},
-    {810, 811, 809, 2390, 2634, 2656, 2657, 0},
-    {204, 205, 203, 2391, 2651, 2658, 2624, 0},
-    {236, 238, 239, 2392, 2659, 2660, 2661, 0},
-    {758, 760, 761, 2393, 2662, 2663, 2664, 0},
-    {772, 773, 771, 2394, 2665, 2666, 2667, 0},
-    {776, 777, 775, 2395, 2668, 2669, 2670, 0},
-    {266, 267, 265, 2396, 2671, 2672, 2673, 0},
-    {750, 751, 749, 2397, 2674, 2675, 2676, 0},
-    {764, 765, 763, 2398, 2677, 2678, 2590, 0},
-    {704, 705, 703, 2399, 2679, 2680, 2681, 0},
-    {746, 748, 749, 2400, 2591, 2682, 2676, 0},
-    {752, 753, 751, 2401, 2683, 2684, 2685, 0},
-    {736, 738, 739, 2402, 2686, 2687, 2599, 0},
-    {758, 759, 757, 2403, 2662, 2688, 2689, 0},
-    {222, 223, 221, 2404, 2690, 2691, 2692, 0},
-    {814, 815, 813, 2405, 2693, 2694, 2636, 0},
-    {818, 819, 817, 2406, 2695, 2696, 2697, 0},
-    {822, 823, 821, 2407, 2698, 2699, 2700, 0},
-    {192, 194, 195, 2408, 2701, 2702, 2703, 0},
-    {196, 194, 193, 2409, 2609, 2702, 2704, 0},
-    {196, 199, 197, 2373, 2609, 2705, 2706, 0},
-    {200, 199, 198, 2410, 2618, 2705, 2707, 0},
-    {200, 203, 201, 2411, 2618, 2708, 2709, 0},
-    {204, 203, 202, 2412, 2651, 2708, 2710, 0},
-    {204, 207, 205, 2413, 2651, 2711, 2712, 0},
-    {208, 207, 206, 2414, 2713, 2711, 2714, 0},
-    {210, 209, 208, 2415, 2715, 2716, 2717, 0},
-    {210, 213, 211, 2416, 2715, 2718, 2719, 0},
-    {214, 213, 212, 2417, 2720, 2718, 2721, 0},
-    {216, 215, 214, 2418, 2722, 2723, 2724, 0},
-    {218, 217, 216, 2419, 2725, 2726, 2727, 0},
-    {218, 221, 219, 2420, 2725, 2728, 2729, 0},
-    {222, 221, 220, 2421, 2690, 2728, 2730, 0},
-    {224, 223, 222, 2422, 2731, 2691, 2732, 0},
-    {226, 225, 224, 2423, 2733, 2734, 2735, 0},
-    {226, 229, 227, 2424, 2733, 2736, 2737, 0},
-    {230, 229, 228, 2425, 2738, 2736, 2739, 0},
-    {230, 233, 231, 2426, 2738, 2740, 2741, 0},
-    {234, 233, 232, 2427, 2742, 2740, 2743, 0},
-    {234, 237, 235, 2428, 2742, 2744, 2745, 0},
-    {236, 239, 237, 2429, 2659, 2746, 2747, 0},
-    {238, 241, 239, 2430, 2748, 2749, 2661, 0},
-    {242, 241, 240, 2431, 2750, 2749, 2751, 0},
-    {242, 245, 243, 2432, 2750, 2752, 2753, 0},
-    {246, 245, 244, 2433, 2754, 2752, 2755, 0},
-    {246, 249, 247, 2434, 2754, 2756, 2757, 0},
-    {250, 249, 248, 2435, 2640, 2756, 2758, 0},
-    {250, 253, 251, 2436, 2640, 2759, 2760, 0},
-    {254, 253, 252, 2437, 2646, 2759, 2761, 0},
-    {254, 257, 255, 2438, 2646, 2762, 2763, 0},
-    {258, 257, 256, 2439, 2764, 2762, 2765, 0},
-    {260, 259, 258, 2379, 2625, 2766, 2767, 0},
-    {260, 263, 261, 2440, 2625, 2768, 2769, 0},
-    {264, 263, 262, 2441, 2770, 2768, 2771, 0},
-    {266, 265, 264, 2442, 2671, 2772, 2773, 0},
-    {268, 267, 266, 2443, 2774, 2672, 2775, 0},
-    {268, 271, 269, 2444, 2774, 2776, 2777, 0},
-    {272, 271, 270, 2445, 2778, 2776, 2779, 0},
-    {272, 275, 273, 2446, 2778, 2780, 2781, 0},
-    {276, 275, 274, 2447, 2782, 2780, 2783, 0},
-    {276, 279, 277, 2448, 2782, 2784, 2785, 0},
-    {280, 279, 278, 2449, 2786, 2784, 2787, 0},
-    {280, 283, 281, 2450, 2786, 2788, 2789, 0},
-    {282, 285, 283, 2451, 2790, 2791, 2792, 0},
-    {286, 285, 284, 2452, 2793, 2791, 2794, 0},
-    {286, 195, 287, 2453, 2793, 2795, 2796, 0},
-    {288, 290, 291, 2454, 2797, 2798, 2799, 0},
-    {289, 293, 290, 2455, 2800, 2801, 2802, 0},
-    {294, 293, 292, 2456, 2803, 2801, 2804, 0},
-    {294, 297, 295, 2457, 2803, 2805, 2806, 0},
-    {296, 299, 297, 2458, 2807, 2808, 2809, 0},
-    {300, 299, 298, 2459, 2810, 2808, 2811, 0},
-    {300, 303, 301, 2460, 2810, 2812, 2813, 0},
-    {302, 305, 303, 2461, 2814, 2815, 2816, 0},
-    {304, 307, 305, 2462, 2817, 2818, 2819, 0},
-    {308, 307, 306, 2463, 2820, 2818, 2821, 0},
-    {308, 311, 309, 2464, 2820, 2822, 2823, 0},
-    {310, 313, 311, 2465, 2824, 2825, 2826, 0},
-    {314, 313, 312, 2466, 2827, 2825, 2828, 0},
-    {314, 317, 315, 2467, 2827, 2829, 2830, 0},
-    {318, 317, 316, 2468, 2831, 2829, 2832, 0},
-    {318, 321, 319, 2469, 2831, 2833, 2834, 0},
-    {322, 321, 320, 2470, 2835, 2833, 2836, 0},
-    {324, 323, 322, 2471, 2837, 2838, 2839, 0},
-    {324, 327, 325, 2472, 2837, 2840, 2841, 0},
-    {326, 329, 327, 2473, 2842, 2843, 2844, 0},
-    {328, 331, 329, 2474, 2845, 2846, 2847, 0},
-    {332, 331, 330, 2475, 2848, 2846, 2849, 0},
-    {334, 333, 332, 2476, 2850, 2851, 2852, 0},
-    {336, 335, 334, 2477, 2853, 2854, 2855, 0},
-    {338, 337, 336, 2478, 2856, 2857, 2858, 0},
-    {338, 341, 339, 2479, 2856, 2859, 2860, 0},
-    {340, 343, 341, 2480, 2861, 2862, 2863, 0},
-    {344, 343, 342, 2481, 2864, 2862, 2865, 0},
-    {346, 345, 344, 2482, 2866, 2867, 2868, 0},
-    {348, 347, 346, 2483, 2869, 2870, 2871, 0},
-    {350, 349, 348, 2484, 2872, 2873, 2874, 0},
-    {350, 353, 351, 2485, 2872, 2875, 2876, 0},
-    {352, 355, 353, 2486, 2877, 2878, 2879, 0},
-    {354, 357, 355, 2487, 2880, 2881, 2882, 0},
-    {358, 357, 356, 2488, 2883, 2881, 2884, 0},
-    {358, 361, 359, 2489, 2883, 2885, 2886, 0},
-    {360, 363, 361, 2490, 2887, 2888, 2889, 0},
-    {362, 365, 363, 2491, 2890, 2891, 2892, 0},
-    {366, 365, 364, 2492, 2893, 2891, 2894, 0},
-    {368, 367, 366, 2493, 2895, 2896, 2897, 0},
-    {370, 369, 368, 2494, 2898, 2899, 2900, 0},
-    {372, 371, 370, 2495, 2901, 2902, 2903, 0},
-    {372, 375, 373, 2496, 2901, 2904, 2905, 0},
-    {374, 377, 375, 2497, 2906, 2907, 2908, 0},
-    {378, 377, 376, 2498, 2909, 2907, 2910, 0},
-    {378, 381, 379, 2499, 2909, 2911, 2912, 0},
-    {382, 381, 380, 2500, 2913, 2911, 2914, 0},
-    {382, 291, 383, 2501, 2913, 2915, 2916, 0},
-    {660, 661, 659, 2502, 2917, 2918, 2919, 0},
-    {681, 679, 678, 2503, 2920, 2921, 2922, 0},
-    {218, 220, 221, 2504, 2725, 2923, 2692, 0},
-    {707, 705, 704, 2505, 2924, 2680, 2925, 0},
-    {820, 821, 819, 2506, 2926, 2927, 2928, 0},
-    {702, 703, 701, 2507, 2929, 2930, 2931, 0},
-    {764, 766, 767, 2508, 2677, 2932, 2933, 0},
-    {268, 269, 267, 2509, 2774, 2934, 2935, 0},
-    {242, 244, 245, 2510, 2750, 2936, 2937, 0},
-    {768, 770, 771, 2511, 2938, 2939, 2667, 0},
-    {216, 217, 215, 2512, 2722, 2726, 2940, 0},
-    {230, 231, 229, 2513, 2738, 2941, 2942, 0},
-    {214, 215, 213, 2514, 2720, 2723, 2943, 0},
-    {210, 212, 213, 2515, 2715, 2944, 2943, 0},
-    {234, 236, 237, 2516, 2742, 2945, 2747, 0},
-    {722, 724, 725, 2517, 2946, 2947, 2948, 0},
-    {678, 679, 677, 2518, 2949, 2921, 2950, 0},
-    {208, 209, 207, 2414, 2713, 2716, 2653, 0},
-    {788, 789, 787, 2519, 2951, 2952, 2953, 0},
-    {796, 797, 795, 2520, 2954, 2955, 2617, 0},
-    {210, 211, 209, 2521, 2715, 2956, 2957, 0},
-    {772, 774, 775, 2522, 2665, 2958, 2670, 0},
-    {814, 816, 817, 2523, 2693, 2959, 2697, 0},
-    {652, 653, 651, 2524, 2960, 2604, 2961, 0},
-    {666, 668, 669, 2525, 2962, 2963, 2964, 0},
-    {826, 828, 829, 2526, 2965, 2966, 2967, 0},
-    {732, 734, 735, 2527, 2612, 2968, 2969, 0},
-    {790, 791, 789, 2528, 2970, 2971, 2972, 0},
-    {728, 729, 727, 2529, 2973, 2974, 2975, 0},
-    {723, 721, 720, 2530, 2976, 2977, 2978, 0},
-    {798, 799, 797, 2531, 2631, 2979, 2980, 0},
-    {246, 247, 245, 2532, 2754, 2981, 2937, 0},
-    {724, 726, 727, 2533, 2982, 2983, 2975, 0},
-    {675, 673, 672, 2534, 2984, 2985, 2986, 0},
-    {716, 718, 719, 2535, 2987, 2988, 2989, 0},
-    {709, 707, 706, 2536, 2990, 2991, 2992, 0},
-    {712, 714, 715, 2537, 2993, 2994, 2995, 0},
-    {663, 661, 660, 2538, 2996, 2918, 2997, 0},
-    {672, 673, 671, 2539, 2998, 2985, 2999, 0},
-    {824, 825, 823, 2540, 3000, 3001, 3002, 0},
-    {666, 667, 665, 2541, 2962, 3003, 2630, 0},
-    {730, 731, 729, 2542, 3004, 3005, 3006, 0},
-    {832, 834, 835, 2543, 2606, 3007, 3008, 0},
-    {276, 278, 279, 2544, 2782, 3009, 3010, 0},
-    {668, 670, 671, 2545, 3011, 3012, 2999, 0},
-    {280, 281, 279, 2449, 2786, 3013, 3010, 0},
-    {696, 697, 695, 2546, 3014, 3015, 3016, 0},
-    {654, 656, 657, 2547, 3017, 3018, 3019, 0},
-    {282, 284, 285, 2548, 2790, 3020, 3021, 0},
-    {645, 646, 647, 2549, 3022, 3023, 3024, 0},
-    {826, 827, 825, 2550, 2965, 3025, 3026, 0},
-    {710, 711, 709, 2551, 3027, 3028, 3029, 0},
-    {276, 277, 275, 2552, 2782, 3030, 3031, 0},
-    {692, 694, 695, 2553, 3032, 3033, 3016, 0},
-    {264, 265, 263, 2554, 2770, 2772, 2650, 0},
-    {690, 692, 693, 2555, 3034, 3035, 3036, 0},
-    {648, 649, 646, 2556, 3037, 3038, 3039, 0},
-    {690, 691, 689, 2557, 3034, 3040, 3041, 0},
-    {677, 675, 674, 2558, 3042, 3043, 3044, 0},
-    {698, 700, 701, 2559, 2637, 3045, 2931, 0},
-    {736, 737, 735, 2560, 2686, 3046, 2969, 0},
-    {686, 688, 689, 2561, 3047, 3048, 3041, 0},
-    {250, 251, 249, 2562, 2640, 3049, 3050, 0},
-    {650, 651, 649, 2563, 3051, 3052, 3053, 0},
-    {778, 779, 777, 2564, 3054, 3055, 3056, 0},
-    {768, 769, 767, 2565, 2938, 3057, 2933, 0},
-    {800, 802, 803, 2566, 3058, 3059, 3060, 0},
-    {784, 786, 787, 2567, 3061, 3062, 2953, 0},
-    {808, 809, 807, 2568, 3063, 3064, 2645, 0},
-    {720, 721, 719, 2569, 3065, 2977, 2989, 0},
-    {778, 780, 781, 2570, 3054, 3066, 2655, 0},
-    {687, 685, 684, 2571, 3067, 2601, 3068, 0},
-    {714, 716, 717, 2572, 3069, 3070, 3071, 0},
-    {234, 235, 233, 2573, 2742, 3072, 3073, 0},
-    {230, 232, 233, 2574, 2738, 3074, 3073, 0},
-    {242, 243, 241, 2575, 2750, 3075, 3076, 0},
-    {192, 193, 194, 2576, 2701, 3077, 3078, 0},
-    {246, 248, 249, 2577, 2754, 3079, 3050, 0},
-    {272, 273, 271, 2578, 2778, 3080, 3081, 0},
-    {804, 805, 803, 2579, 2643, 3082, 3060, 0},
-    {272, 274, 275, 2580, 2778, 3083, 3031, 0},
-    {224, 225, 223, 2581, 2731, 2734, 3084, 0},
-    {658, 659, 657, 2582, 3085, 3086, 3019, 0},
-    {710, 712, 713, 2583, 3027, 3087, 3088, 0},
-    {790, 792, 793, 2584, 2970, 3089, 3090, 0},
-    {238, 240, 241, 2585, 2748, 3091, 3076, 0},
-    {258, 259, 257, 2586, 2764, 2766, 2648, 0},
-    {254, 255, 253, 2587, 2646, 3092, 2642, 0},
-    {218, 219, 217, 2588, 2725, 3093, 3094, 0},
-    {196, 197, 194, 2409, 2609, 3095, 3078, 0},
-    {226, 228, 229, 2589, 2733, 3096, 2942, 0},
-    {740, 741, 742, 2590, 3097, 3098, 2596, 0},
-    {752, 754, 755, 2591, 2683, 3099, 3100, 0},
-    {828, 830, 831, 2592, 3101, 3102, 2608, 0},
-    {754, 756, 757, 2593, 3103, 3104, 2689, 0},
-    {286, 192, 195, 2594, 2793, 3105, 2703, 0},
-    {226, 227, 225, 2595, 2733, 3106, 3107, 0},
-    {268, 270, 271, 2444, 2774, 3108, 3081, 0},
-    {280, 282, 283, 2450, 2786, 3109, 2792, 0},
-    {286, 287, 285, 2596, 2793, 3110, 3021, 0},
-    {645, 647, 644, 2597, 3022, 2598, 3111, 0},
-    {720, 719, 718, 2598, 3065, 3112, 3113, 0},
-    {696, 695, 694, 2546, 3014, 3114, 3115, 0},
-    {684, 683, 682, 2599, 2600, 3116, 3117, 0},
-    {654, 657, 655, 2600, 3017, 3118, 3119, 0},
-    {655, 652, 654, 2601, 2603, 3120, 3121, 0},
-    {707, 704, 706, 2602, 2924, 3122, 2992, 0},
-    {650, 649, 648, 2603, 3051, 3038, 3123, 0},
-    {672, 671, 670, 2604, 2998, 3124, 3125, 0},
-    {662, 665, 663, 2605, 2628, 3126, 3127, 0},
-    {666, 665, 664, 2606, 2962, 3126, 3128, 0},
-    {666, 669, 667, 2607, 2962, 3129, 3130, 0},
-    {668, 671, 669, 2608, 3011, 3124, 2964, 0},
-    {732, 735, 733, 2527, 2612, 3131, 3132, 0},
-    {698, 697, 696, 2609, 2637, 3015, 3133, 0},
-    {722, 725, 723, 2610, 2946, 3134, 3135, 0},
-    {702, 701, 700, 2611, 2929, 3136, 3137, 0},
-    {678, 677, 676, 2612, 2949, 3138, 3139, 0},
-    {698, 701, 699, 2613, 2637, 3136, 3140, 0},
-    {732, 731, 730, 2374, 2612, 3005, 3141, 0},
-    {648, 646, 645, 2614, 3037, 3023, 3142, 0},
-    {686, 689, 687, 2561, 3047, 3143, 3144, 0},
-    {690, 689, 688, 2615, 3034, 3143, 3145, 0},
-    {690, 693, 691, 2555, 3034, 3146, 3147, 0},
-    {692, 695, 693, 2616, 3032, 3114, 3036, 0},
-    {710, 709, 708, 2617, 3027, 3148, 3149, 0},
-    {660, 659, 658, 2618, 2917, 3086, 3150, 0},
-    {652, 651, 650, 2619, 2960, 3052, 3151, 0},
-    {730, 729, 728, 2620, 3004, 2974, 3152, 0},
-    {681, 678, 680, 2621, 2920, 3153, 3154, 0},
-    {724, 727, 725, 2622, 2982, 3155, 2948, 0},
-    {682, 681, 680, 2623, 3156, 3157, 3154, 0},
-    {675, 672, 674, 2624, 2984, 3158, 3044, 0},
-    {687, 684, 686, 2625, 3067, 3159, 3160, 0},
-    {710, 713, 711, 2626, 3027, 3161, 3162, 0},
-    {712, 715, 713, 2627, 2993, 3163, 3088, 0},
-    {714, 717, 715, 2628, 3069, 3164, 2995, 0},
-    {716, 719, 717, 2629, 2987, 3112, 3071, 0},
-    {663, 660, 662, 2630, 2996, 3165, 3166, 0},
-    {709, 706, 708, 2631, 2990, 3167, 3149, 0},
-    {658, 657, 656, 2632, 3085, 3118, 3168, 0},
-    {728, 727, 726, 2633, 2973, 3155, 3169, 0},
-    {677, 674, 676, 2634, 3042, 3170, 3139, 0},
-    {723, 720, 722, 2530, 2976, 3171, 3172, 0},
-    {704, 703, 702, 2635, 2679, 2930, 3173, 0},
-    {736, 735, 734, 2636, 2686, 3131, 3174, 0},
-    {736, 739, 737, 2637, 2686, 3175, 3176, 0},
-    {644, 739, 738, 2638, 2597, 3175, 3177, 0},
-    {740, 742, 743, 2639, 3097, 3178, 3179, 0},
-    {744, 742, 741, 2640, 2594, 3178, 3180, 0},
-    {746, 745, 744, 2641, 2591, 2595, 3181, 0},
-    {746, 749, 747, 2642, 2591, 3182, 3183, 0},
-    {750, 749, 748, 2643, 2674, 3182, 3184, 0},
-    {752, 751, 750, 2644, 2683, 2675, 3185, 0},
-    {752, 755, 753, 2645, 2683, 3186, 3187, 0},
-    {754, 757, 755, 2646, 3103, 3188, 3100, 0},
-    {758, 757, 756, 2647, 2662, 3188, 3189, 0},
-    {758, 761, 759, 2393, 2662, 3190, 3191, 0},
-    {760, 763, 761, 2648, 2588, 3192, 2664, 0},
-    {764, 763, 762, 2649, 2677, 3192, 3193, 0},
-    {764, 767, 765, 2650, 2677, 3194, 3195, 0},
-    {768, 767, 766, 2651, 2938, 3194, 3196, 0},
-    {768, 771, 769, 2511, 2938, 3197, 3198, 0},
-    {772, 771, 770, 2652, 2665, 3197, 3199, 0},
-    {772, 775, 773, 2653, 2665, 3200, 3201, 0},
-    {776, 775, 774, 2654, 2668, 3200, 3202, 0},
-    {778, 777, 776, 2655, 3054, 2669, 3203, 0},
-    {778, 781, 779, 2656, 3054, 3204, 3205, 0},
-    {782, 781, 780, 2657, 2620, 3204, 3206, 0},
-    {782, 785, 783, 2658, 2620, 3207, 3208, 0},
-    {784, 787, 785, 2659, 3061, 3209, 2622, 0},
-    {788, 787, 786, 2660, 2951, 3209, 3210, 0},
-    {790, 789, 788, 2661, 2970, 2952, 3211, 0},
-    {790, 793, 791, 2662, 2970, 3212, 3213, 0},
-    {792, 795, 793, 2663, 2615, 3214, 3090, 0},
-    {796, 795, 794, 2520, 2954, 3214, 3215, 0},
-    {798, 797, 796, 2664, 2631, 2955, 3216, 0},
-    {798, 801, 799, 2665, 2631, 3217, 3218, 0},
-    {800, 803, 801, 2666, 3058, 3219, 2633, 0},
-    {804, 803, 802, 2667, 2643, 3219, 3220, 0},
-    {804, 807, 805, 2668, 2643, 3221, 3222, 0},
-    {808, 807, 806, 2669, 3063, 3221, 3223, 0},
-    {810, 809, 808, 2670, 2634, 3064, 3224, 0},
-    {810, 813, 811, 2671, 2634, 3225, 3226, 0},
-    {814, 813, 812, 2672, 2693, 3225, 3227, 0},
-    {814, 817, 815, 2673, 2693, 3228, 3229, 0},
-    {818, 817, 816, 2674, 2695, 3228, 3230, 0},
-    {820, 819, 818, 2675, 2926, 2696, 3231, 0},
-    {822, 821, 820, 2676, 2698, 2927, 3232, 0},
-    {824, 823, 822, 2677, 3000, 2699, 3233, 0},
-    {826, 825, 824, 2678, 2965, 3001, 3234, 0},
-    {826, 829, 827, 2679, 2965, 3235, 3236, 0},
-    {828, 831, 829, 2592, 3101, 3237, 2967, 0},
-    {832, 831, 830, 2680, 2606, 3237, 3238, 0},
-    {832, 835, 833, 2681, 2606, 3239, 3240, 0},
-    {834, 743, 835, 2682, 3241, 3242, 3008, 0},
-    {682, 683, 681, 2683, 3156, 3116, 3243, 0},
-    {834, 740, 743, 2684, 3241, 3244, 3179, 0},
-    {288, 289, 290, 2685, 2797, 3245, 2802, 0},
-    {289, 292, 293, 2686, 2800, 3246, 3247, 0},
-    {294, 295, 293, 2456, 2803, 3248, 3247, 0},
-    {294, 296, 297, 2687, 2803, 3249, 2809, 0},
-    {296, 298, 299, 2688, 2807, 3250, 3251, 0},
-    {300, 301, 299, 2689, 2810, 3252, 3251, 0},
-    {300, 302, 303, 2690, 2810, 3253, 2816, 0},
-    {302, 304, 305, 2691, 2814, 3254, 2819, 0},
-    {304, 306, 307, 2692, 2817, 3255, 3256, 0},
-    {308, 309, 307, 2693, 2820, 3257, 3256, 0},
-    {308, 310, 311, 2694, 2820, 3258, 2826, 0},
-    {310, 312, 313, 2695, 2824, 3259, 3260, 0},
-    {314, 315, 313, 2696, 2827, 3261, 3260, 0},
-    {314, 316, 317, 2697, 2827, 3262, 3263, 0},
-    {318, 319, 317, 2698, 2831, 3264, 3263, 0},
-    {318, 320, 321, 2469, 2831, 3265, 3266, 0},
-    {322, 323, 321, 2699, 2835, 2838, 3266, 0},
-    {324, 325, 323, 2700, 2837, 3267, 3268, 0},
-    {324, 326, 327, 2701, 2837, 3269, 2844, 0},
-    {326, 328, 329, 2702, 2842, 3270, 2847, 0},
-    {328, 330, 331, 2703, 2845, 3271, 3272, 0},
-    {332, 333, 331, 2704, 2848, 2851, 3272, 0},
-    {334, 335, 333, 2705, 2850, 2854, 3273, 0},
-    {336, 337, 335, 2706, 2853, 2857, 3274, 0},
-    {338, 339, 337, 2707, 2856, 3275, 3276, 0},
-    {338, 340, 341, 2708, 2856, 3277, 2863, 0},
-    {340, 342, 343, 2709, 2861, 3278, 3279, 0},
-    {344, 345, 343, 2710, 2864, 2867, 3279, 0},
-    {346, 347, 345, 2711, 2866, 2870, 3280, 0},
-    {348, 349, 347, 2712, 2869, 2873, 3281, 0},
-    {350, 351, 349, 2713, 2872, 3282, 3283, 0},
-    {350, 352, 353, 2714, 2872, 3284, 2879, 0},
-    {352, 354, 355, 2715, 2877, 3285, 2882, 0},
-    {354, 356, 357, 2716, 2880, 3286, 3287, 0},
-    {358, 359, 357, 2717, 2883, 3288, 3287, 0},
-    {358, 360, 361, 2718, 2883, 3289, 2889, 0},
-    {360, 362, 363, 2719, 2887, 3290, 2892, 0},
-    {362, 364, 365, 2720, 2890, 3291, 3292, 0},
-    {366, 367, 365, 2721, 2893, 2896, 3292, 0},
-    {368, 369, 367, 2493, 2895, 2899, 3293, 0},
-    {370, 371, 369, 2722, 2898, 2902, 3294, 0},
-    {372, 373, 371, 2723, 2901, 3295, 3296, 0},
-    {372, 374, 375, 2724, 2901, 3297, 2908, 0},
-    {374, 376, 377, 2725, 2906, 3298, 3299, 0},
-    {378, 379, 377, 2726, 2909, 3300, 3299, 0},
-    {378, 380, 381, 2727, 2909, 3301, 3302, 0},
-    {382, 383, 381, 2728, 2913, 3303, 3302, 0},
-    {382, 288, 291, 2729, 2913, 3304, 2799, 0},
-};
-
-model_t get_model_tower() {
-    model_t model;
-
-    model.vertices = vertices;
-    model.normals = normals;
-    model.texcoords = texcoords;
-    model.faces = faces;
-
-    model.num_vertices = NUM_VERTICES;
-    model.num_normals = NUM_NORMALS;
-    model.num_texcoords = NUM_TEXCOORDS;
-    model.num_faces = NUM_FACES;
-
-    model.modelview = imat4x4(
-        INT_FIXED(1), 0, 0, 0,
-        0, INT_FIXED(1), 0, 0,
-        0, 0, INT_FIXED(1), 0,
-        0, 0, 0, INT_FIXED(1)
-    );
-
-    return model;
-}
-
@@ -0,0 +1,134 @@
+/**
+* Timeline export: Timer rings to Chrome Trace Event JSON
+*/
+
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "trace.h"
+#include "timing.h"
+#include "threads.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define sleep_ms(ms) Sleep(ms)
+#else
+#include <time.h>
+static void sleep_ms(int32_t ms) {
+    struct timespec duration = { 0, ms * 1000000L };
+    nanosleep(&duration, 0);
+}
+#endif
+
+// Large stdio buffer, so the writer thread hits the disk in big chunks
+#define TRACE_BUFFER_SIZE (1 << 20)
+
+// Writer state: Where it is in every ring, which rings got their name
+// written, and whether the file is still going (stop asks the writer to
+// finish up, done is its answer)
+static FILE* trace_file = 0;
+static char* trace_buffer = 0;
+static uint64_t trace_base = 0;
+static uint32_t trace_positions[TIMER_MAX_RINGS];
+static int32_t trace_named[TIMER_MAX_RINGS];
+static int32_t trace_events = 0;
+static int64_t trace_lost = 0;
+static volatile int32_t trace_stopping = 0;
+static volatile int32_t trace_done = 0;
+
+static void write_event(const timer_event_t* event, int32_t ring) {
+    double ts = timer_ticks_to_seconds(event->start - trace_base) * 1.0e6;
+    double dur = timer_ticks_to_seconds(event->end - event->start) * 1.0e6;
+    fprintf(
+        trace_file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}",
+        trace_events++ ? "," : "", event->name, ring + 1, ts, dur, event->frame
+    );
+}
+
+// Everything new in every ring
+static void trace_drain() {
+    static timer_event_t events[TIMER_RING_SIZE];
+    for(int32_t ring = 0; ring < timer_num_rings(); ring++) {
+        const char* name = timer_ring_name(ring);
+        if(name != 0 && !trace_named[ring]) {
+            fprintf(
+                trace_file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                trace_events++ ? "," : "", ring + 1, name
+            );
+            trace_named[ring] = 1;
+        }
+
+        int32_t count;
+        do {
+            uint32_t position = trace_positions[ring];
+            count = timer_read_ring_from(ring, &trace_positions[ring], events, TIMER_RING_SIZE);
+            trace_lost += trace_positions[ring] - position - count;
+            for(int32_t i = 0; i < count; i++) {
+                if(events[i].end >= trace_base) {
+                    write_event(&events[i], ring);
+                }
+            }
+        } while(count != 0);
+    }
+}
+
+static void trace_writer(void* unused) {
+    while(1) {
+        int32_t stopping = trace_stopping;
+        trace_drain();
+        if(stopping) {
+            fprintf(trace_file, "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"lost_events\":%lld}}\n", (long long)trace_lost);
+            fclose(trace_file);
+            trace_done = 1;
+            return;
+        }
+        sleep_ms(TRACE_FLUSH_MS);
+    }
+}
+
+int32_t trace_start(const char* path) {
+    if(trace_file != 0) {
+        return 0;
+    }
+    trace_file = fopen(path, "w");
+    if(trace_file == 0) {
+        return 0;
+    }
+    trace_buffer = (char*)malloc(TRACE_BUFFER_SIZE);
+    setvbuf(trace_file, trace_buffer, _IOFBF, TRACE_BUFFER_SIZE);
+    fprintf(trace_file, "{\"traceEvents\":[");
+
+    // Whatever the rings hold from before gets read and dropped
+    trace_base = timer_ticks();
+    for(int32_t ring = 0; ring < TIMER_MAX_RINGS; ring++) {
+        trace_positions[ring] = 0;
+        trace_named[ring] = 0;
+    }
+    trace_events = 0;
+    trace_lost = 0;
+    trace_stopping = 0;
+    trace_done = 0;
+
+    thread_start(trace_writer, 0);
+    return 1;
+}
+
+void trace_stop() {
+    if(trace_file == 0) {
+        return;
+    }
+    trace_stopping = 1;
+    while(!trace_done) {
+        sleep_ms(1);
+    }
+    if(trace_lost != 0) {
+        fprintf(stderr, "Trace: %lld scopes lost, the writer fell behind\n", (long long)trace_lost);
+    }
+    trace_file = 0;
+    free(trace_buffer);
+    trace_buffer = 0;
+}
@@ -0,0 +1,26 @@
+/**
+* Timeline export: Streams the timer scopes of every thread into a Chrome
+* Trace Event JSON file, for chrome://tracing or ui.perfetto.dev
+*/
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdint.h>
+
+// Scopes are picked up from the timer rings by a writer thread every
+// TRACE_FLUSH_MS, so the threads being traced only ever write their rings.
+// Each becomes a complete event on the track of its thread (one per ring,
+// named with timer_name_thread), with the frame number it was tagged with.
+// If a thread laps the writer, its oldest scopes are lost and counted.
+#define TRACE_FLUSH_MS 5
+
+// Start tracing to path, returns 0 if it can't be written. Only scopes that
+// end after this are traced.
+int32_t trace_start(const char* path);
+
+// Write out what is left and finish the file. Safe to call when not tracing
+// and from atexit.
+void trace_stop();
+
+#endif